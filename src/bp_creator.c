@@ -5,313 +5,313 @@
 
 #include "bp_creator.h"
 #include "helpers.h"
-#include "rom_bp_strings.h"
+#include "rom_templates.h"
 
-// Replace placeholder strings in a blueprint string with int32 data.
-// Leftover spots are not covered by this function, they must be set to
-// a blank value in data.
-char *bp_replace(const char *bp_str_in, placeholder_index_func_t is_placeholder, int32_t *data, size_t len_data)
+// Returns the template with the given name, or NULL if there is none
+const rom_template_t *bp_template_find(const char *name)
+{
+    for (int t = 0; t < len_rom_templates; t++)
+        if (strcmp(rom_templates[t].name, name) == 0)
+            return &rom_templates[t];
+    return NULL;
+}
+
+// Returns the index of the word whose placeholder in the template is count, or -1
+int64_t bp_template_word(const rom_template_t *tmpl, int32_t count)
+{
+    uint32_t word = (uint32_t) count - tmpl->placeholder_base;
+    return (word < tmpl->capacity) ? word : -1;
+}
+
+// Decode and decompress a blueprint string into its null-terminated JSON, whose
+// length is stored in json_len
+// Returns the malloced JSON, or NULL if the string is not a valid blueprint
+char *bp_decode(const char *bp_str, size_t *json_len)
 {
-    char *bp_str_out = NULL;
     // The first char is ignored, that is the version number and always '0' for
     // Factorio versions through 1.1
-    size_t b64_decoded_size = base64_decode_len(bp_str_in + 1, strlen(bp_str_in + 1));
+    size_t b64_len = strlen(bp_str + 1);
+    size_t b64_decoded_size = base64_decode_len(bp_str + 1, b64_len);
+    if (b64_len == 0 || b64_decoded_size == (size_t) -1)
+        return NULL;
 
     // Decode input BP string
-    char *b64_decoded_data = malloc(b64_decoded_size);
-    int res = base64_decode(b64_decoded_data, bp_str_in + 1);
-    if (res != 0)
+    unsigned char *b64_decoded_data = malloc(b64_decoded_size);
+    if (b64_decoded_data == NULL)
     {
-        free(b64_decoded_data);
+        perror("bp_decode malloc");
         return NULL;
     }
-
-    // Write to a tmpfile
-    FILE *fd_def_in = tmpfile();
-    if (fd_def_in == NULL)
+    int res = base64_decode((char *) b64_decoded_data, bp_str + 1);
+    if (res != 0)
     {
-        perror("bp_replace tmpfile");
         free(b64_decoded_data);
         return NULL;
     }
 
-    res = fwrite(b64_decoded_data, 1, b64_decoded_size, fd_def_in);
-    if (res != b64_decoded_size)
-    {
-        perror("bp_replace fwrite");
-        free(b64_decoded_data);
-        fclose(fd_def_in);
-        return NULL;
-    }
+    // Decompress decoded data
+    unsigned char *json = NULL;
+    res = inf_mem(b64_decoded_data, b64_decoded_size, &json, json_len);
     free(b64_decoded_data);
-
-    // Decompress decoded data into a tmpfile
-    rewind(fd_def_in);
-    FILE *fd_json_in = tmpfile();
-    if (fd_json_in == NULL)
-    {
-        perror("bp_replace tmpfile");
-        fclose(fd_def_in);
-        return NULL;
-    }
-
-    res = inf(fd_def_in, fd_json_in);
     if (res != Z_OK)
     {
         zerr(res);
-        fclose(fd_json_in);
-        fclose(fd_def_in);
         return NULL;
     }
-    fclose(fd_def_in);
 
-    // Modify json and copy into a tmpfile
-    rewind(fd_json_in);
-    // make changes and write into new file
-    FILE *fd_json_out = tmpfile();
-    if (fd_json_out == NULL)
-    {
-        perror("bp_replace tmpfile");
-        fclose(fd_json_in);
-        return NULL;
-    }
+    return (char *) json;
+}
+
+// Add len bytes of JSON to the compressor
+static void bp_write(def_par_t *w, const char *data, size_t len)
+{
+    def_par_write(w, (const unsigned char *) data, len);
+}
 
-    char buf[BUFSIZ] = { 0 };
-    char numbuf[128] = { 0 };
-    int num_i = 0;
-    while ((res = fread(buf, 1, BUFSIZ, fd_json_in)) > 0)
+// Add text as the contents of a JSON string, escaping quotes, backslashes and control
+// characters like newlines
+static void bp_write_json_str(def_par_t *w, const char *text)
+{
+    for (; *text; text++)
     {
-        // Replacement algorithm:
-        // - Read a character
-        // - If char is '-' or '0'-'9': add to numbuf and keep count
-        // - Else:
-        //   - If numbuf is not empty, test if placeholder
-        //     - If numbuf is a placeholder, write to out the appropriate program word
-        //     - Else, write numbuf to out
-        //   - Else, write char to out
-        //
-        // Potential improvement: write both to buffers, when the char buffer fills or a numeric char
-        // is read, flush the text buffer and fill the numbuf, when a non numeric char is found, do the
-        // above. This avoids unneeded file I/O
-        for (int i = 0; i < res; i++)
+        unsigned char c = *text;
+        char esc[8];
+        switch (c)
         {
-            switch (buf[i])
-            {
-                case '-':
-                    if (num_i)
-                    {
-                        // Something is wrong if we ever get here, but that is not for us to worry about.
-                        // This is to avoid more errors, and if a number is written to output here, it will
-                        // get mixed up with the previous one and be wrong regardless.
-                        fwrite(numbuf, 1, num_i, fd_json_out);
-                        num_i = 0;
-                    }
-
-                    // fallthrough
-                case '0': case '1': case '2': case '3': case '4': case '5': case '6': case '7': case '8': case '9':
-                    numbuf[num_i++] = buf[i];
-                    break;
-                default:
-                    if (num_i)
-                    {
-                        numbuf[num_i] = 0;
-                        int32_t num = atoi(numbuf);
-                        int64_t placeholder_i = is_placeholder(num);
-
-                        // Put the relevant data word, or 0 if past data length
-                        if (placeholder_i >= 0)
-                        {
-                            if (placeholder_i < len_data)
-                                fprintf(fd_json_out, "%d", data[placeholder_i]);
-                            else
-                                putc('0', fd_json_out);
-                        }
-                        else
-                            fwrite(numbuf, 1, num_i, fd_json_out);
-
-                        num_i = 0;
-                    }
-
-                    putc(buf[i], fd_json_out);
-                    break;
-            }
+            case '"':  bp_write(w, "\\\"", 2); break;
+            case '\\': bp_write(w, "\\\\", 2); break;
+            case '\n': bp_write(w, "\\n", 2); break;
+            case '\r': bp_write(w, "\\r", 2); break;
+            case '\t': bp_write(w, "\\t", 2); break;
+            default:
+                if (c < 0x20)
+                    bp_write(w, esc, snprintf(esc, sizeof(esc), "\\u%04x", c));
+                else
+                    bp_write(w, (const char *) text, 1);
+                break;
         }
     }
-    if (feof(fd_json_in))
-    {
-        fclose(fd_json_in);
-    }
-    else
-    {
-        perror("bp_replace fread");
-        fclose(fd_json_in);
-        fclose(fd_json_out);
-        return NULL;
-    }
-
-    // Compress json into a tmpfile
-    rewind(fd_json_out);
-    FILE *fd_def_out = tmpfile();
-    if (fd_def_out == NULL)
-    {
-        perror("bp_replace tmpfile");
-        fclose(fd_json_out);
-        return NULL;
-    }
+}
 
-    res = def(fd_json_out, fd_def_out, 9);
+// Finish compressing and encode the result into a new blueprint string, the compressor
+// is freed in any case
+// Returns the string, or NULL on errors
+static char *bp_encode(def_par_t *w)
+{
+    unsigned char *def_out = NULL;
+    size_t def_out_size = 0;
+    int res = def_par_finish(w, &def_out, &def_out_size);
     if (res != Z_OK)
     {
         zerr(res);
-        fclose(fd_def_out);
-        fclose(fd_json_out);
         return NULL;
     }
-    fclose(fd_json_out);
-
-    // Encode compressed data into new BP string
-    fseek(fd_def_out, 0, SEEK_END);
-    long def_out_size = ftell(fd_def_out);
-    rewind(fd_def_out);
-
-    size_t bp_str_out_size = base64_encode_len(def_out_size);
-    bp_str_out = malloc(bp_str_out_size + 1);
 
-    char *buf_def_out = malloc(def_out_size + 2);
-    res = fread(buf_def_out, 1, def_out_size, fd_def_out);
-    fclose(fd_def_out);
-
-    base64_encode(bp_str_out + 1, buf_def_out, def_out_size);
-    bp_str_out[0] = '0';
-    free(buf_def_out);
+    // Encode compressed data into new BP string, after the version number
+    char *bp_str_out = malloc(base64_encode_len(def_out_size) + 2);
+    if (bp_str_out == NULL)
+        perror("bp_encode malloc");
+    else
+    {
+        bp_str_out[0] = '0';
+        base64_encode(bp_str_out + 1, (const char *) def_out, def_out_size);
+    }
+    free(def_out);
 
     return bp_str_out;
 }
 
-char *bp_set_name_desc(const char *bp_str_in, const char *placeholder_name, const char *new_name, const char *placeholder_desc, const char *new_desc)
+// Write the JSON from start with the placeholders at the positions the template lists
+// replaced
+// Returns the position up to which the JSON was written
+static size_t bp_splice(def_par_t *w, const char *json, size_t start, const rom_template_t *tmpl, const bp_transform_t *transforms, int len_transforms)
 {
-    char *bp_str_out = NULL;
-    // The first char is ignored, that is the version number and always '0' for
-    // Factorio versions through 1.1
-    size_t b64_decoded_size = base64_decode_len(bp_str_in + 1, strlen(bp_str_in + 1));
-
-    // Decode input BP string
-    char *b64_decoded_data = malloc(b64_decoded_size);
-    int res = base64_decode(b64_decoded_data, bp_str_in + 1);
-    if (res != 0)
+    char numbuf[16];
+    size_t copied = start;
+    for (int s = 0; s < tmpl->len_spans; s++)
     {
-        free(b64_decoded_data);
-        return NULL;
+        const rom_span_t *span = &tmpl->spans[s];
+        const bp_transform_t *tr = NULL;
+        if (span->offset < start)
+            continue;
+        for (int t = 0; t < len_transforms && !tr; t++)
+        {
+            if (span->index >= 0 && transforms[t].kind == BP_WORDS)
+                tr = &transforms[t];
+            else if (span->index == ROM_SPAN_ROW && transforms[t].kind == BP_ROWS)
+                tr = &transforms[t];
+            else if (span->index != ROM_SPAN_ROW && span->index < 0 && transforms[t].kind == BP_TEXT && transforms[t].text && transforms[t].placeholder &&
+                strlen(transforms[t].placeholder) == span->len && strncmp(json + span->offset, transforms[t].placeholder, span->len) == 0)
+                tr = &transforms[t];
+        }
+        if (tr == NULL)
+            continue;
+
+        bp_write(w, json + copied, span->offset - copied);
+        if (tr->kind == BP_TEXT)
+            bp_write_json_str(w, tr->text);
+        else if (tr->kind == BP_ROWS)
+            bp_write(w, numbuf, snprintf(numbuf, sizeof(numbuf), "%d", atoi(json + span->offset) + tr->rows));
+        else
+            bp_write(w, numbuf, snprintf(numbuf, sizeof(numbuf), "%d", (span->index < tr->len_data) ? tr->data[span->index] : 0));
+        copied = span->offset + span->len;
     }
+    return copied;
+}
 
-    // Write to a tmpfile
-    FILE *fd_def_in = tmpfile();
-    if (fd_def_in == NULL)
-    {
-        perror("bp_replace tmpfile");
-        free(b64_decoded_data);
-        return NULL;
-    }
+// Write a template's JSON from start with every transform applied
+static void bp_write_template(def_par_t *w, const rom_template_t *tmpl, size_t start, const bp_transform_t *transforms, int len_transforms)
+{
+    size_t copied = bp_splice(w, tmpl->json, start, tmpl, transforms, len_transforms);
+    bp_write(w, tmpl->json + copied, tmpl->json_len - copied);
+}
 
-    res = fwrite(b64_decoded_data, 1, b64_decoded_size, fd_def_in);
-    if (res != b64_decoded_size)
+// Choose the templates holding len_words words with the fewest combinators in total,
+// and of those the fewest ROMs, only from tmpl if it is not NULL
+// Returns the number of ROMs, whose templates are stored largest first in a malloced
+// array in parts, or -1 on errors
+static int bp_split(size_t len_words, const rom_template_t *tmpl, int **parts)
+{
+    int first = tmpl ? tmpl - rom_templates : 0;
+    int last = tmpl ? first + 1 : len_rom_templates;
+
+    // Capacities are counted in units of their greatest common divisor, and the
+    // cheapest way to hold u units is found for every u up to the program's. Even an
+    // empty program gets a ROM
+    size_t unit = 0;
+    for (int t = first; t < last; t++)
     {
-        perror("bp_replace fwrite");
-        free(b64_decoded_data);
-        fclose(fd_def_in);
-        return NULL;
+        size_t a = rom_templates[t].capacity, b = unit;
+        while (b)
+        {
+            size_t r = a % b;
+            a = b;
+            b = r;
+        }
+        unit = a;
     }
-    free(b64_decoded_data);
-
-    // Decompress decoded data into a tmpfile
-    rewind(fd_def_in);
-    FILE *fd_json_in = tmpfile();
-    if (fd_json_in == NULL)
+    size_t len_units = (len_words + unit - 1) / unit;
+    if (len_units == 0)
+        len_units = 1;
+
+    int64_t *cost = malloc(sizeof(int64_t) * (len_units + 1));
+    int *count = malloc(sizeof(int) * (len_units + 1));
+    int *choice = malloc(sizeof(int) * (len_units + 1));
+    *parts = NULL;
+    if (cost == NULL || count == NULL || choice == NULL)
     {
-        perror("bp_replace tmpfile");
-        fclose(fd_def_in);
-        return NULL;
+        free(cost);
+        free(count);
+        free(choice);
+        return -1;
     }
 
-    res = inf(fd_def_in, fd_json_in);
-    if (res != Z_OK)
+    cost[0] = 0;
+    count[0] = 0;
+    for (size_t u = 1; u <= len_units; u++)
     {
-        zerr(res);
-        fclose(fd_json_in);
-        fclose(fd_def_in);
-        return NULL;
+        cost[u] = INT64_MAX;
+        for (int t = first; t < last; t++)
+        {
+            size_t units = rom_templates[t].capacity / unit;
+            size_t rest = (units < u) ? u - units : 0;
+            int64_t c = cost[rest] + rom_templates[t].combinators;
+            if (c < cost[u] || (c == cost[u] && count[rest] + 1 < count[u]))
+            {
+                cost[u] = c;
+                count[u] = count[rest] + 1;
+                choice[u] = t;
+            }
+        }
     }
-    fclose(fd_def_in);
 
-    // Modify json and copy into a tmpfile
-    rewind(fd_json_in);
-    // make changes and write into new file
-    FILE *fd_json_out = tmpfile();
-    if (fd_json_out == NULL)
+    // The templates are ordered largest first, so the parts are when taken in that order
+    int len_parts = count[len_units];
+    *parts = malloc(sizeof(int) * len_parts);
+    int i = 0;
+    for (int t = first; t < last && *parts; t++)
     {
-        perror("bp_replace tmpfile");
-        fclose(fd_json_in);
-        return NULL;
+        for (size_t u = len_units; u > 0; )
+        {
+            size_t units = rom_templates[choice[u]].capacity / unit;
+            if (choice[u] == t)
+                (*parts)[i++] = t;
+            u = (units < u) ? u - units : 0;
+        }
     }
 
-    // Get filesize
-    fseek(fd_json_in, 0, SEEK_END);
-    size_t fsize = ftell(fd_json_in);
-    char *buf = malloc(2 * fsize);
-    memset(buf, 0, 2 * fsize);
-
-    // Read in whole file
-    rewind(fd_json_in);
-    int c = 0;
-    int i = 0;
-    while ((c = fgetc(fd_json_in)) != EOF)
-        buf[i++] = c;
-    buf[i] = 0;
-
-    // Search and replace
-    if (new_desc) str_replace(buf, 2 * fsize, placeholder_desc, new_desc);
-    if (new_name) str_replace(buf, 2 * fsize, placeholder_name, new_name);
-
-    // Write out file
-    for (int i = 0; buf[i] != 0; i++)
-        fputc(buf[i], fd_json_out);
-    free(buf);
+    free(cost);
+    free(count);
+    free(choice);
+    return (*parts) ? len_parts : -1;
+}
 
-    // Compress json into a tmpfile
-    rewind(fd_json_out);
-    FILE *fd_def_out = tmpfile();
-    if (fd_def_out == NULL)
-    {
-        perror("bp_replace tmpfile");
-        fclose(fd_json_out);
+// Build the blueprint string of a program, split into a blueprint book if it doesn't
+// fit in one ROM
+char *bp_build_program(const int32_t *words, size_t len_words, const char *name, const char *desc, const rom_template_t *tmpl, int level)
+{
+    int *parts;
+    int len_parts = bp_split(len_words, tmpl, &parts);
+    if (len_parts < 0)
         return NULL;
-    }
 
-    res = def(fd_json_out, fd_def_out, 9);
-    if (res != Z_OK)
+    char *label = NULL;
+    if (name && len_parts > 1 && (label = malloc(strlen(name) + 32)) == NULL)
     {
-        zerr(res);
-        fclose(fd_def_out);
-        fclose(fd_json_out);
+        free(parts);
         return NULL;
     }
-    fclose(fd_json_out);
-
-    // Encode compressed data into new BP string
-    fseek(fd_def_out, 0, SEEK_END);
-    long def_out_size = ftell(fd_def_out);
-    rewind(fd_def_out);
 
-    size_t bp_str_out_size = base64_encode_len(def_out_size);
-    bp_str_out = malloc(bp_str_out_size + 1);
+    def_par_t w;
+    def_par_init(&w, level, BP_MAX_CHAIN, def_par_threads());
+    if (len_parts > 1)
+        bp_write(&w, "{\"blueprint_book\":{\"blueprints\":[", 33);
 
-    char *buf_def_out = malloc(def_out_size + 2);
-    res = fread(buf_def_out, 1, def_out_size, fd_def_out);
-    fclose(fd_def_out);
+    char numbuf[64];
+    size_t offset = 0;
+    for (int i = 0; i < len_parts; i++)
+    {
+        const rom_template_t *part = &rom_templates[parts[i]];
+        size_t len = (offset < len_words) ? len_words - offset : 0;
+        if (len > part->capacity)
+            len = part->capacity;
+        if (label)
+            sprintf(label, "%s %d/%d", name, i + 1, len_parts);
+
+        // The description comes first, as it starts with the name. Parts are full up to
+        // the last, so later ones start at a row of the address bus
+        bp_transform_t transforms[] = {
+            { .kind = BP_WORDS, .data = words + offset, .len_data = len },
+            { .kind = BP_TEXT, .placeholder = part->placeholder_desc, .text = desc },
+            { .kind = BP_TEXT, .placeholder = part->placeholder_name, .text = label ? label : name },
+            { .kind = BP_ROWS, .rows = offset / ROM_ROW_WORDS },
+        };
+        int len_transforms = offset ? 4 : 3;
+
+        // Templates are written as entries of the book by leaving out their opening brace
+        if (len_parts > 1)
+        {
+            bp_write(&w, numbuf, snprintf(numbuf, sizeof(numbuf), "%s{\"index\":%d,", i ? "," : "", i));
+            bp_write_template(&w, part, 1, transforms, len_transforms);
+        }
+        else
+            bp_write_template(&w, part, 0, transforms, len_transforms);
+        offset += len;
+    }
 
-    base64_encode(bp_str_out + 1, buf_def_out, def_out_size);
-    bp_str_out[0] = '0';
-    free(buf_def_out);
+    if (len_parts > 1)
+    {
+        bp_write(&w, "],\"item\":\"blueprint-book\",", 26);
+        if (name)
+        {
+            bp_write(&w, "\"label\":\"", 9);
+            bp_write_json_str(&w, name);
+            bp_write(&w, "\",", 2);
+        }
+        bp_write(&w, numbuf, snprintf(numbuf, sizeof(numbuf), "\"active_index\":0,\"version\":%lld}}", (long long) BP_BOOK_VERSION));
+    }
 
-    return bp_str_out;
+    free(label);
+    free(parts);
+    return bp_encode(&w);
 }
@@ -3,13 +3,64 @@
 
 #include <stdint.h>
 #include <stdio.h>
-#include "rom_bp_strings.h"
+#include "rom_templates.h"
 
-// Replace placeholder strings in a blueprint string with int32 data.
-// Leftover spots are not covered by this function, they must be set to
-// a blank value in data.
-char *bp_replace(const char *bp_str_in, placeholder_index_func_t is_placeholder, int32_t *data, size_t len_data);
+// zlib compression level of blueprint strings, 1 is the fastest and 9 the smallest
+#define BP_DEFAULT_LEVEL    9
+// Longest hash chain searched for matches at level 9, zlib's 4096 takes about twice
+// as long on the repetitive JSON of blueprints for output less than 0.1% smaller
+#define BP_MAX_CHAIN        256
 
-char *bp_set_name_desc(const char *bp_str_in, const char *placeholder_name, const char *new_name, const char *placeholder_desc, const char *new_desc);
+// Version of Factorio written into blueprint books, 1.1.107 like the templates
+#define BP_BOOK_VERSION     281479278690304
+
+// Kinds of bp_transform_t
+#define BP_WORDS    1
+#define BP_TEXT     2
+#define BP_ROWS     3
+
+// A change made to the JSON of a template by bp_build_program
+typedef struct {
+    int kind;
+
+    // BP_WORDS: the word placeholders of the template are replaced with data[index],
+    // or 0 past len_data
+    const int32_t *data;
+    size_t len_data;
+
+    // BP_TEXT: every occurrence of placeholder is replaced with text, escaped for a
+    // JSON string. If text is NULL, the placeholder is left as it is, including other
+    // placeholders in it
+    const char *placeholder;
+    const char *text;
+
+    // BP_ROWS: the decider constants selecting the rows of a ROM are increased by rows,
+    // so it answers from a later address
+    int32_t rows;
+} bp_transform_t;
+
+// Returns the template with the given name, or NULL if there is none
+const rom_template_t *bp_template_find(const char *name);
+
+// Returns the index of the word whose placeholder in the template is count, or -1 if
+// it is no placeholder
+int64_t bp_template_word(const rom_template_t *tmpl, int32_t count);
+
+// Decode and decompress a blueprint string into its null-terminated JSON, whose
+// length is stored in json_len
+// Returns the malloced JSON, or NULL if the string is not a valid blueprint
+char *bp_decode(const char *bp_str, size_t *json_len);
+
+// Build the blueprint string of a program with the given name and description, which
+// may be NULL. The words are split across as many ROMs as needed, choosing the
+// templates with the fewest combinators in total, so small programs get the smaller
+// ROM. Programs needing more than one ROM are built into a blueprint book holding a
+// blueprint for each consecutive part. The rows of each part answer from the address
+// of its first word, so every ROM of the book can be put on the same address bus. If
+// tmpl is not NULL, only that template is used. The placeholders are replaced at the
+// positions the templates list, in a single pass over their JSON, and the result is
+// compressed at the given zlib level in blocks on every CPU, see def_par_t.
+// Returns a malloced string, or NULL on errors.
+char *bp_build_program(const int32_t *words, size_t len_words, const char *name, const char *desc, const rom_template_t *tmpl, int level);
 
 #endif // BP_CREATOR_H
@@ -0,0 +1,574 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bp_creator.h"
+#include "bp_extract.h"
+#include "rom_templates.h"
+
+// Nesting of JSON values followed at most, blueprints are not nearly this deep
+#define BP_JSON_MAX_DEPTH   64
+
+// A constant combinator of the blueprint being read
+typedef struct {
+    double x;
+    double y;
+    int32_t counts[BP_MAX_FILTERS];     // indexed by the filter's slot - 1
+    uint32_t set;                       // bit per slot with a filter
+} bp_combinator_t;
+
+// Where the words of a template are: for each of its constant combinators, sorted by
+// position relative to the topmost and leftmost one, the word in every slot or -1
+typedef struct {
+    double x;
+    double y;
+    int words[BP_MAX_FILTERS];
+} bp_slot_t;
+
+typedef struct {
+    const char *name;
+    int capacity;
+    int len_slots;
+    bp_slot_t *slots;       // malloced
+} bp_layout_t;
+
+// State of the JSON scanner
+typedef struct {
+    const char *p;
+    const char *end;
+    int error;
+
+    // Constant combinators and label of the blueprint being read
+    bp_combinator_t *combinators;       // malloced
+    int len_combinators;
+    int len_combinators_space;
+    char *label;                        // malloced
+
+    // Templates the blueprints are matched with, NULL while reading a template
+    bp_layout_t *layouts;
+    bp_rom_t *roms;                     // malloced
+    int len_roms;
+    int len_roms_space;
+} bp_json_t;
+
+static int bp_json_value(bp_json_t *x, int depth);
+
+static void bp_json_ws(bp_json_t *x)
+{
+    while (x->p < x->end && (*x->p == ' ' || *x->p == '\n' || *x->p == '\r' || *x->p == '\t'))
+        x->p++;
+}
+
+// Consume c after any whitespace
+// Returns 1 if it was there, 0 otherwise
+static int bp_json_char(bp_json_t *x, char c)
+{
+    bp_json_ws(x);
+    if (x->p < x->end && *x->p == c)
+    {
+        x->p++;
+        return 1;
+    }
+    return 0;
+}
+
+// Read a string, whose raw contents up to the closing quote are stored in str and len
+// Returns 0 on success, -1 if it is not a string
+static int bp_json_string(bp_json_t *x, const char **str, size_t *len)
+{
+    if (!bp_json_char(x, '"'))
+        return x->error = -1;
+    *str = x->p;
+    while (x->p < x->end && *x->p != '"')
+        x->p += (*x->p == '\\') ? 2 : 1;
+    if (x->p >= x->end)
+        return x->error = -1;
+    *len = x->p - *str;
+    x->p++;
+    return 0;
+}
+
+// Returns 1 if the raw string str of length len is key
+static int bp_json_is(const char *str, size_t len, const char *key)
+{
+    return strlen(key) == len && memcmp(str, key, len) == 0;
+}
+
+// Unescape the raw contents of a string into a malloced UTF-8 string
+static char *bp_json_unescape(const char *str, size_t len)
+{
+    char *out = malloc(len + 1);
+    if (out == NULL)
+        return NULL;
+
+    size_t j = 0;
+    for (size_t i = 0; i < len; i++)
+    {
+        if (str[i] != '\\' || i + 1 >= len)
+        {
+            out[j++] = str[i];
+            continue;
+        }
+
+        switch (str[++i])
+        {
+            case 'n': out[j++] = '\n'; break;
+            case 'r': out[j++] = '\r'; break;
+            case 't': out[j++] = '\t'; break;
+            case 'b': out[j++] = '\b'; break;
+            case 'f': out[j++] = '\f'; break;
+            case 'u':
+            {
+                // Code points of the basic plane, written as 1 to 3 bytes, are never
+                // longer than the 6 characters of the escape
+                unsigned cp = 0;
+                if (i + 4 >= len || sscanf(str + i + 1, "%4x", &cp) != 1)
+                    break;
+                i += 4;
+                if (cp < 0x80)
+                    out[j++] = cp;
+                else if (cp < 0x800)
+                {
+                    out[j++] = 0xC0 | (cp >> 6);
+                    out[j++] = 0x80 | (cp & 0x3F);
+                }
+                else
+                {
+                    out[j++] = 0xE0 | (cp >> 12);
+                    out[j++] = 0x80 | ((cp >> 6) & 0x3F);
+                    out[j++] = 0x80 | (cp & 0x3F);
+                }
+                break;
+            }
+            default: out[j++] = str[i]; break;
+        }
+    }
+    out[j] = 0;
+    return out;
+}
+
+// Read a number
+// Returns 0 on success, -1 if it is not a number
+static int bp_json_number(bp_json_t *x, double *value)
+{
+    bp_json_ws(x);
+    char *num_end;
+    *value = strtod(x->p, &num_end);
+    if (num_end == x->p || num_end > x->end)
+        return x->error = -1;
+    x->p = num_end;
+    return 0;
+}
+
+// Read an object, calling member for the value of every key, or skipping it if member
+// is NULL or returns 1
+// Returns 0 on success, -1 on errors
+static int bp_json_object(bp_json_t *x, int depth, int (*member)(bp_json_t *x, const char *key, size_t len, int depth, void *arg), void *arg)
+{
+    if (depth >= BP_JSON_MAX_DEPTH || !bp_json_char(x, '{'))
+        return x->error = -1;
+    if (bp_json_char(x, '}'))
+        return 0;
+
+    do
+    {
+        const char *key;
+        size_t len;
+        if (bp_json_string(x, &key, &len) != 0 || !bp_json_char(x, ':'))
+            return x->error = -1;
+
+        int res = (member) ? member(x, key, len, depth + 1, arg) : 1;
+        if (res == 1)
+            res = bp_json_value(x, depth + 1);
+        if (res != 0 || x->error)
+            return x->error = -1;
+    } while (bp_json_char(x, ','));
+
+    return bp_json_char(x, '}') ? 0 : (x->error = -1);
+}
+
+// Read an array, calling element for every value
+// Returns 0 on success, -1 on errors
+static int bp_json_array(bp_json_t *x, int depth, int (*element)(bp_json_t *x, int depth, void *arg), void *arg)
+{
+    if (depth >= BP_JSON_MAX_DEPTH || !bp_json_char(x, '['))
+        return x->error = -1;
+    if (bp_json_char(x, ']'))
+        return 0;
+
+    do
+    {
+        if (element(x, depth + 1, arg) != 0 || x->error)
+            return x->error = -1;
+    } while (bp_json_char(x, ','));
+
+    return bp_json_char(x, ']') ? 0 : (x->error = -1);
+}
+
+// Skip any value
+static int bp_json_value_element(bp_json_t *x, int depth, void *arg)
+{
+    return bp_json_value(x, depth);
+}
+
+static int bp_json_value(bp_json_t *x, int depth)
+{
+    const char *str;
+    size_t len;
+    double num;
+
+    bp_json_ws(x);
+    if (x->p >= x->end)
+        return x->error = -1;
+
+    switch (*x->p)
+    {
+        case '{': return bp_json_object(x, depth, NULL, NULL);
+        case '[': return bp_json_array(x, depth, bp_json_value_element, NULL);
+        case '"': return bp_json_string(x, &str, &len);
+        case 't': case 'f': case 'n':
+            while (x->p < x->end && *x->p >= 'a' && *x->p <= 'z')
+                x->p++;
+            return 0;
+        default: return bp_json_number(x, &num);
+    }
+}
+
+// Members of a filter: its slot and count
+static int bp_json_filter_member(bp_json_t *x, const char *key, size_t len, int depth, void *arg)
+{
+    double *filter = arg;
+    if (bp_json_is(key, len, "index"))
+        return bp_json_number(x, &filter[0]);
+    if (bp_json_is(key, len, "count"))
+        return bp_json_number(x, &filter[1]);
+    return 1;
+}
+
+static int bp_json_filter(bp_json_t *x, int depth, void *arg)
+{
+    bp_combinator_t *combinator = arg;
+    double filter[2] = { 0, 0 };
+    if (bp_json_object(x, depth, bp_json_filter_member, filter) != 0)
+        return -1;
+
+    int slot = (int) filter[0] - 1;
+    if (slot >= 0 && slot < BP_MAX_FILTERS)
+    {
+        combinator->counts[slot] = (int32_t) (int64_t) filter[1];
+        combinator->set |= 1u << slot;
+    }
+    return 0;
+}
+
+static int bp_json_control_member(bp_json_t *x, const char *key, size_t len, int depth, void *arg)
+{
+    if (bp_json_is(key, len, "filters"))
+        return bp_json_array(x, depth, bp_json_filter, arg);
+    return 1;
+}
+
+static int bp_json_position_member(bp_json_t *x, const char *key, size_t len, int depth, void *arg)
+{
+    bp_combinator_t *combinator = arg;
+    if (bp_json_is(key, len, "x"))
+        return bp_json_number(x, &combinator->x);
+    if (bp_json_is(key, len, "y"))
+        return bp_json_number(x, &combinator->y);
+    return 1;
+}
+
+// Members of an entity, which can come in any order, so every entity is read as if it
+// was a constant combinator until its name is known
+static int bp_json_entity_member(bp_json_t *x, const char *key, size_t len, int depth, void *arg)
+{
+    int *is_combinator = arg;
+    bp_combinator_t *combinator = &x->combinators[x->len_combinators];
+    const char *name;
+    size_t name_len;
+
+    if (bp_json_is(key, len, "name"))
+    {
+        if (bp_json_string(x, &name, &name_len) != 0)
+            return -1;
+        *is_combinator = bp_json_is(name, name_len, "constant-combinator");
+        return 0;
+    }
+    if (bp_json_is(key, len, "position"))
+        return bp_json_object(x, depth, bp_json_position_member, combinator);
+    if (bp_json_is(key, len, "control_behavior"))
+        return bp_json_object(x, depth, bp_json_control_member, combinator);
+    return 1;
+}
+
+static int bp_json_entity(bp_json_t *x, int depth, void *arg)
+{
+    if (x->len_combinators >= x->len_combinators_space)
+    {
+        x->len_combinators_space += 100;
+        x->combinators = realloc(x->combinators, sizeof(bp_combinator_t) * x->len_combinators_space);
+    }
+    memset(&x->combinators[x->len_combinators], 0, sizeof(bp_combinator_t));
+
+    int is_combinator = 0;
+    if (bp_json_object(x, depth, bp_json_entity_member, &is_combinator) != 0)
+        return -1;
+    x->len_combinators += is_combinator;
+    return 0;
+}
+
+static int bp_slot_cmp(const void *a, const void *b)
+{
+    const bp_slot_t *sa = a, *sb = b;
+    if (sa->y != sb->y)
+        return (sa->y > sb->y) - (sa->y < sb->y);
+    return (sa->x > sb->x) - (sa->x < sb->x);
+}
+
+// Positions of the combinators read, relative to the topmost and leftmost ones
+static void bp_json_relative(bp_json_t *x)
+{
+    double min_x = 0, min_y = 0;
+    for (int i = 0; i < x->len_combinators; i++)
+    {
+        if (i == 0 || x->combinators[i].x < min_x)
+            min_x = x->combinators[i].x;
+        if (i == 0 || x->combinators[i].y < min_y)
+            min_y = x->combinators[i].y;
+    }
+    for (int i = 0; i < x->len_combinators; i++)
+    {
+        x->combinators[i].x -= min_x;
+        x->combinators[i].y -= min_y;
+    }
+}
+
+// Find the template the blueprint just read was built from and add its words as a ROM
+static void bp_json_add_rom(bp_json_t *x)
+{
+    bp_json_relative(x);
+    for (int t = 0; t < len_rom_templates; t++)
+    {
+        bp_layout_t *layout = &x->layouts[t];
+        if (layout->len_slots != x->len_combinators)
+            continue;
+
+        int32_t *words = calloc(layout->capacity, sizeof(int32_t));
+        int matches = (words != NULL);
+        for (int i = 0; i < x->len_combinators && matches; i++)
+        {
+            bp_combinator_t *combinator = &x->combinators[i];
+            bp_slot_t key = { .x = combinator->x, .y = combinator->y };
+            bp_slot_t *slot = bsearch(&key, layout->slots, layout->len_slots, sizeof(bp_slot_t), bp_slot_cmp);
+            matches = (slot != NULL);
+            for (int f = 0; f < BP_MAX_FILTERS && slot; f++)
+                if ((combinator->set & (1u << f)) && slot->words[f] >= 0)
+                    words[slot->words[f]] = combinator->counts[f];
+        }
+        if (!matches)
+        {
+            free(words);
+            continue;
+        }
+
+        if (x->len_roms >= x->len_roms_space)
+        {
+            x->len_roms_space += 100;
+            x->roms = realloc(x->roms, sizeof(bp_rom_t) * x->len_roms_space);
+        }
+        bp_rom_t *rom = &x->roms[x->len_roms++];
+        rom->label = x->label;
+        rom->rom = layout->name;
+        rom->words = words;
+        rom->len_words = layout->capacity;
+        rom->index = -1;
+        while (rom->len_words > 0 && words[rom->len_words - 1] == 0)
+            rom->len_words--;
+        x->label = NULL;
+        return;
+    }
+}
+
+static int bp_json_blueprint_member(bp_json_t *x, const char *key, size_t len, int depth, void *arg)
+{
+    const char *label;
+    size_t label_len;
+
+    if (bp_json_is(key, len, "entities"))
+        return bp_json_array(x, depth, bp_json_entity, NULL);
+    if (bp_json_is(key, len, "label"))
+    {
+        if (bp_json_string(x, &label, &label_len) != 0)
+            return -1;
+        free(x->label);
+        x->label = bp_json_unescape(label, label_len);
+        return 0;
+    }
+    return 1;
+}
+
+static int bp_json_top_member(bp_json_t *x, const char *key, size_t len, int depth, void *arg);
+
+// Entries of books are read with their index, which the ROM of a blueprint in them gets
+// once the whole entry is read, as the index may come after the blueprint
+static int bp_json_book_entry(bp_json_t *x, int depth, void *arg)
+{
+    double index = 0;
+    int first = x->len_roms;
+    if (bp_json_object(x, depth, bp_json_top_member, &index) != 0)
+        return -1;
+    for (int i = first; i < x->len_roms; i++)
+        if (x->roms[i].index < 0)
+            x->roms[i].index = (int) index;
+    return 0;
+}
+
+static int bp_json_book_member(bp_json_t *x, const char *key, size_t len, int depth, void *arg)
+{
+    if (bp_json_is(key, len, "blueprints"))
+        return bp_json_array(x, depth, bp_json_book_entry, NULL);
+    return 1;
+}
+
+// Members of the top object and of the entries of books: a blueprint or another book
+static int bp_json_top_member(bp_json_t *x, const char *key, size_t len, int depth, void *arg)
+{
+    if (arg && bp_json_is(key, len, "index"))
+        return bp_json_number(x, arg);
+    if (bp_json_is(key, len, "blueprint_book"))
+        return bp_json_object(x, depth, bp_json_book_member, NULL);
+    if (!bp_json_is(key, len, "blueprint"))
+        return 1;
+
+    x->len_combinators = 0;
+    free(x->label);
+    x->label = NULL;
+    if (bp_json_object(x, depth, bp_json_blueprint_member, NULL) != 0)
+        return -1;
+    if (x->layouts)
+        bp_json_add_rom(x);
+    return 0;
+}
+
+// Scan the JSON of a blueprint
+// Returns 0 on success, -1 if it is not valid
+static int bp_json_scan(bp_json_t *x, const char *json, size_t json_len)
+{
+    x->p = json;
+    x->end = json + json_len;
+    x->error = 0;
+    return bp_json_object(x, 0, bp_json_top_member, NULL);
+}
+
+// Read where the words of a template are, from the placeholders of its combinators
+static int bp_layout_init(bp_layout_t *layout, int t)
+{
+    bp_json_t x = { 0 };
+    const rom_template_t *tmpl = &rom_templates[t];
+    layout->name = tmpl->name;
+    layout->capacity = tmpl->capacity;
+    layout->len_slots = 0;
+    layout->slots = NULL;
+    if (bp_json_scan(&x, tmpl->json, tmpl->json_len) != 0)
+    {
+        free(x.combinators);
+        free(x.label);
+        return -1;
+    }
+
+    bp_json_relative(&x);
+    layout->slots = malloc(sizeof(bp_slot_t) * (x.len_combinators + 1));
+    for (int i = 0; i < x.len_combinators && layout->slots; i++)
+    {
+        bp_slot_t *slot = &layout->slots[i];
+        slot->x = x.combinators[i].x;
+        slot->y = x.combinators[i].y;
+        for (int f = 0; f < BP_MAX_FILTERS; f++)
+        {
+            int64_t word = (x.combinators[i].set & (1u << f)) ? bp_template_word(tmpl, x.combinators[i].counts[f]) : -1;
+            slot->words[f] = (word >= 0 && word < layout->capacity) ? word : -1;
+        }
+        layout->len_slots++;
+    }
+    qsort(layout->slots, layout->len_slots, sizeof(bp_slot_t), bp_slot_cmp);
+
+    free(x.combinators);
+    free(x.label);
+    return 0;
+}
+
+// Returns 1 if str looks like a blueprint string, 0 otherwise
+int bp_is_string(const char *str)
+{
+    if (str[0] != '0')
+        return 0;
+
+    size_t len = 0;
+    for (const char *p = str + 1; *p; p++)
+    {
+        if ((*p >= 'A' && *p <= 'Z') || (*p >= 'a' && *p <= 'z') || (*p >= '0' && *p <= '9') || *p == '+' || *p == '/' || *p == '=')
+            len++;
+        else if (*p == '\n' || *p == '\r' || *p == ' ' || *p == '\t')
+            return strspn(p, "\n\r \t") == strlen(p) && len > 0;
+        else return 0;
+    }
+    return len > 0;
+}
+
+// Read the words of every ROM in a blueprint string or a blueprint book string
+int bp_extract(const char *bp_str, bp_rom_t **roms)
+{
+    bp_layout_t layouts[len_rom_templates];
+    memset(layouts, 0, sizeof(layouts));
+    bp_json_t x = { .layouts = layouts };
+    int res = 0;
+
+    *roms = NULL;
+    for (int t = 0; t < len_rom_templates && res == 0; t++)
+        res = bp_layout_init(&layouts[t], t);
+    if (res == 0)
+    {
+        size_t json_len = 0;
+        char *json = bp_decode(bp_str, &json_len);
+        res = json ? bp_json_scan(&x, json, json_len) : -1;
+        free(json);
+    }
+
+    for (int t = 0; t < len_rom_templates; t++)
+        free(layouts[t].slots);
+    free(x.combinators);
+    free(x.label);
+    if (res != 0)
+    {
+        bp_free_roms(x.roms, x.len_roms);
+        return -1;
+    }
+
+    // ROMs of books in the order of their index, which the game doesn't have to keep
+    // when exporting them. A blueprint outside of a book is the first
+    for (int i = 0; i < x.len_roms; i++)
+    {
+        bp_rom_t rom = x.roms[i];
+        int j = i;
+        if (rom.index < 0)
+            rom.index = 0;
+        for (; j > 0 && x.roms[j - 1].index > rom.index; j--)
+            x.roms[j] = x.roms[j - 1];
+        x.roms[j] = rom;
+    }
+
+    *roms = x.roms;
+    return x.len_roms;
+}
+
+// Free the ROMs returned by bp_extract
+void bp_free_roms(bp_rom_t *roms, int len_roms)
+{
+    for (int i = 0; i < len_roms; i++)
+    {
+        free(roms[i].label);
+        free(roms[i].words);
+    }
+    free(roms);
+}
@@ -0,0 +1,36 @@
+#ifndef BP_EXTRACT_H
+#define BP_EXTRACT_H
+
+#include <stdint.h>
+
+// Filter slots of a constant combinator
+#define BP_MAX_FILTERS  20
+
+// Program words read back from a ROM blueprint
+typedef struct {
+    char *label;            // malloced, NULL if the blueprint has none
+    const char *rom;        // name of the template it was built from, e.g. "rom_12"
+    int len_words;          // up to the last word which is not 0
+    int index;              // of its entry in the blueprint book, 0 outside of books
+    int32_t *words;         // malloced, as many as the template holds
+} bp_rom_t;
+
+// Returns 1 if str, up to trailing whitespace, looks like a blueprint string: the
+// version digit '0' followed by base64, 0 otherwise
+int bp_is_string(const char *str);
+
+// Read the words of every ROM in a blueprint string or a blueprint book string, in
+// the order of their index in the book, or else in the order they appear. ROMs are
+// recognized by the positions of their constant combinators relative to each other,
+// which the game keeps when exporting them again, and the count of each filter is the
+// word whose placeholder was there in the template. Filters the game dropped for being
+// empty are read as 0, and blueprints which are no ROM are skipped. The JSON is
+// scanned once, without building a tree.
+// Returns the number of ROMs stored in a malloced array in roms, or -1 if bp_str is
+// not a valid blueprint string
+int bp_extract(const char *bp_str, bp_rom_t **roms);
+
+// Free the ROMs returned by bp_extract
+void bp_free_roms(bp_rom_t *roms, int len_roms);
+
+#endif // BP_EXTRACT_H
@@ -0,0 +1,168 @@
+// Factorio computer blueprint tool
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+
+#include "fcerrors.h"
+#include "bp_extract.h"
+#include "helpers.h"
+
+// Error reporting
+int error = 0;
+
+// Options
+int opt;
+extern char *optarg;
+extern int optopt;
+
+const char *optstring = ":o:h";
+const char *req_opt = "nn";
+const char *opt_help[] = {
+    "Output file name. The words are written to '<name>.bin', or to\n\t\t\t'<name>-<n>.bin' for every ROM of a blueprint book\n\t\t\t(default: a.out)",
+    "Print this help menu and exit",
+};
+
+void help()
+{
+    int nopt = 0;
+
+    printf("Usage: fcbp extract [options] file\n");
+    printf("\nReads the program words back from the ROMs of a blueprint string or a blueprint\n");
+    printf("book string exported from the game, which can be - to read it from stdin. The\n");
+    printf("binary files written can be run with 'fcemu -b'.\n");
+    printf("\nAvailable options:\n");
+    for (int i = 0; i < strlen(optstring); i++)
+    {
+        switch (optstring[i])
+        {
+        case ':': case '-': case '+': case ';':
+            continue;
+        default:
+            printf("    -%c %s\r\t\t\t%s.\n", optstring[i], (optstring[i+1] == ':' ? "<argument>" : ""), opt_help[nopt]);
+            if (req_opt[nopt] == 'y')
+            {
+                printf("\t\t\tThis option is required.\n");
+            }
+            nopt++;
+            break;
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    char output_filename[BUFSIZ] = "a.out";
+
+    if (argc < 2 || strcmp(argv[1], "extract") != 0)
+    {
+        if (argc >= 2 && (strcmp(argv[1], "-h") == 0))
+        {
+            help();
+            return EXIT_SUCCESS;
+        }
+        error = ERR_MISSING_OPT;
+        help();
+        return EXIT_FAILURE;
+    }
+    argc--;
+    argv++;
+
+    while ((opt = getopt(argc, argv, optstring)) != -1)
+    {
+        switch (opt)
+        {
+        case 'o':
+            strncpy(output_filename, optarg, BUFSIZ - 1);
+            break;
+        case 'h':
+            help();
+            return EXIT_SUCCESS;
+        case ':':
+            error = ERR_NO_ARG;
+            help();
+            return EXIT_FAILURE;
+        default: // '?'
+            error = ERR_BAD_OPTION;
+            help();
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Error checking
+    if (optind != argc - 1)
+    {
+        error = ERR_MISSING_OPT;
+        help();
+        return EXIT_FAILURE;
+    }
+
+    // Read the blueprint string
+    const char *filename = argv[optind];
+    FILE *fd = (strcmp(filename, "-") == 0) ? stdin : fopen(filename, "r");
+    if (fd == NULL)
+    {
+        perror("fcbp");
+        return EXIT_FAILURE;
+    }
+    char *bp_str = fread_all(fd);
+    if (fd != stdin)
+        fclose(fd);
+    if (bp_str == NULL)
+    {
+        perror("fcbp");
+        return EXIT_FAILURE;
+    }
+
+    // Strings copied from the game may end with a newline
+    size_t len = strlen(bp_str);
+    while (len > 0 && (bp_str[len - 1] == '\n' || bp_str[len - 1] == '\r' || bp_str[len - 1] == ' ' || bp_str[len - 1] == '\t'))
+        bp_str[--len] = 0;
+
+    bp_rom_t *roms;
+    int len_roms = bp_extract(bp_str, &roms);
+    free(bp_str);
+    if (len_roms < 0)
+    {
+        printf("%s is not a valid blueprint string\n", filename);
+        return EXIT_FAILURE;
+    }
+    if (len_roms == 0)
+    {
+        printf("%s contains no ROM\n", filename);
+        bp_free_roms(roms, len_roms);
+        return EXIT_FAILURE;
+    }
+
+    // Output
+    int res = EXIT_SUCCESS;
+    for (int i = 0; i < len_roms && res == EXIT_SUCCESS; i++)
+    {
+        char binout[BUFSIZ + 16] = { 0 };
+        if (len_roms == 1)
+            sprintf(binout, "%s.bin", output_filename);
+        else sprintf(binout, "%s-%d.bin", output_filename, i);
+
+        if ((fd = fopen(binout, "wb")) != NULL)
+        {
+            // An empty ROM still holds a single word, so it can be loaded
+            int len_words = roms[i].len_words ? roms[i].len_words : 1;
+            for (int j = 0; j < len_words; j++)
+            {
+                uint32_t word = roms[i].words[j];
+                fwrite(&word, sizeof(uint32_t), 1, fd);
+            }
+            fclose(fd);
+            printf("%s: %s, %d words%s%s\n", binout, roms[i].rom, len_words,
+                roms[i].label ? ", " : "", roms[i].label ? roms[i].label : "");
+        } else
+        {
+            perror("fcbp");
+            res = EXIT_FAILURE;
+        }
+    }
+
+    bp_free_roms(roms, len_roms);
+    return res;
+}
@@ -5,8 +5,13 @@
 #include <string.h>
 #include <getopt.h>
 
+#include "horizon/horizon_cache.h"
 #include "horizon/horizon_compiler.h"
+#include "horizon/horizon_hl.h"
+#include "horizon/horizon_linker.h"
+#include "horizon/horizon_optimizer.h"
 #include "horizon/horizon_parser.h"
+#include "horizon/horizon_profile.h"
 #include "fcerrors.h"
 #include "program.h"
 #include "bp_creator.h"
@@ -19,16 +24,34 @@ int error = 0;
 int opt;
 extern char *optarg;
 extern int optopt;
+int use_cache = 1;
+int optimize = 0;
+int level = BP_DEFAULT_LEVEL;
+const rom_template_t *rom_template = NULL;
+horizon_profile_t *profile = NULL;
 
-const char *optstring = ":f:a:bo:h";
-const char *req_opt = "ynnnn";
+const char *optstring = ":f:a:bcSOP:o:z:T:I:nh";
+const char *req_opt = "ynnnnnnnnnnnn";
 const char *opt_help[] = {
-    "Filename of the program. May be passed without the flag as well",
+    "Filename of the program, or - to read it from stdin. May be passed without\n\t\t\tthe flag as well",
     "Architecture: currently only horizon is implemented (default: horizon)",
     "Generate only raw binary output (.bin output)",
-    "Output file name. By default blueprint strings are output to stdout, if\n\t\t\tgenerating binary output, the default is 'a.out.bin'",
+    "Generate a relocatable object file to link with fclink (.o output)",
+    "Generate only the assembly of a program in the structured language (.s\n\t\t\toutput), see doc/hl.md",
+    "Optimize the assembled code, see the assembly docs",
+    "Lay out the program and inline calls for a branch profile written by fcemu\n\t\t\t-p, see the assembly docs (same as --profile-use)",
+    "Output file name. By default blueprint strings are output to stdout, if\n\t\t\tgenerating binary output, the default is 'a.out.bin'\n\t\t\tand for object files 'a.out.o'",
+    "Compression level of blueprint strings, from 1 (fastest) to 9 (smallest,\n\t\t\tdefault)",
+    "ROM template of blueprint strings, by name: rom_11 (2048 words) or\n\t\t\trom_12 (4096 words). By default the templates with the fewest\n\t\t\tcombinators for the program are used",
+    "Add a directory to search for files in .include directives. May be repeated",
+    "Don't use the compilation cache (same as --no-cache)",
     "Print this help menu and exit",
 };
+const struct option long_options[] = {
+    { "no-cache", no_argument, NULL, 'n' },
+    { "profile-use", required_argument, NULL, 'P' },
+    { NULL, 0, NULL, 0 },
+};
 
 void help()
 {
@@ -59,12 +82,39 @@ int parse(FILE *fd, int arch)
 {
     if (arch == ARCH_HORIZON)
     {
-        ho_program = horizon_parse(fd, NULL, 0);
+        ho_program = horizon_parse_cached(fd, "horizon", use_cache);
         if (ho_program->error_count)
         {
             printf("Program contains at least %d errors, exiting\n", ho_program->error_count);
             return ERR_COMPILATION_ERR;
         }
+
+        // Cached programs are kept unoptimized, so this runs after loading them.
+        // Routines inlined everywhere are removed by optimizing again.
+        if (optimize)
+        {
+            horizon_optimize(ho_program);
+            if (horizon_inline_calls(ho_program, NULL) > 0)
+                horizon_optimize(ho_program);
+        }
+
+        // The profile was recorded for the program as compiled above
+        if (profile && !horizon_profile_matches(ho_program, profile))
+        {
+            fprintf(stderr, "fcc: the profile doesn't match the program, it was ignored\n");
+            horizon_profile_free(profile);
+            profile = NULL;
+        }
+
+        // Frequent calls are inlined too, which moves the profile's counts along with
+        // the instructions, and the new layout can leave jumps to the next instruction
+        if (profile)
+        {
+            int changes = (optimize) ? horizon_inline_calls(ho_program, profile) : 0;
+            changes += horizon_optimize_layout(ho_program, profile);
+            if (changes > 0 && optimize)
+                horizon_optimize(ho_program);
+        }
     } else
     {
         printf("Unknown architecture\n");
@@ -81,8 +131,11 @@ int main(int argc, char **argv)
     int output_filename_set = 0;
     int arch = ARCH_HORIZON;
     int output_binary = 0;
+    int output_object = 0;
+    int output_asm = 0;
+    FILE *profile_fd;
 
-    while ((opt = getopt(argc, argv, optstring)) != -1)
+    while ((opt = getopt_long(argc, argv, optstring, long_options, NULL)) != -1)
     {
         switch (opt)
         {
@@ -102,10 +155,57 @@ int main(int argc, char **argv)
         case 'b':
             output_binary = 1;
             break;
+        case 'c':
+            output_object = 1;
+            break;
+        case 'S':
+            output_asm = 1;
+            break;
+        case 'O':
+            optimize = 1;
+            break;
+        case 'P':
+            profile_fd = fopen(optarg, "r");
+            if (profile_fd == NULL)
+            {
+                perror("fcc");
+                return EXIT_FAILURE;
+            }
+            horizon_profile_free(profile);
+            profile = horizon_profile_read(profile_fd);
+            fclose(profile_fd);
+            if (profile == NULL)
+            {
+                printf("Invalid profile file: %s\n", optarg);
+                return EXIT_FAILURE;
+            }
+            break;
         case 'o':
             strncpy(output_filename, optarg, BUFSIZ - 1);
             output_filename_set = 1;
             break;
+        case 'z':
+            level = atoi(optarg);
+            if (level < 1 || level > 9)
+            {
+                printf("Invalid compression level: %s\n", optarg);
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'T':
+            rom_template = bp_template_find(optarg);
+            if (rom_template == NULL)
+            {
+                printf("Unknown ROM template: %s\n", optarg);
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'I':
+            horizon_add_include_dir(optarg);
+            break;
+        case 'n':
+            use_cache = 0;
+            break;
         case 'h':
             help();
             return EXIT_SUCCESS;
@@ -142,14 +242,78 @@ int main(int argc, char **argv)
         return EXIT_FAILURE;
     }
 
+    // Object files are only used for separate compilation, they are not cached
+    if (output_object)
+    {
+        horizon_set_relocatable(1);
+        use_cache = 0;
+    }
+
     // Parse program
     FILE *fd;
     if (arch == ARCH_HORIZON)
     {
-        if ((fd = fopen(filename, "r")) != NULL)
+        // "-" reads the program from stdin, e.g. piped from a generator
+        if (strcmp(filename, "-") == 0)
+        {
+            fd = stdin;
+            horizon_set_source_path(NULL);
+        }
+        else
+        {
+            fd = fopen(filename, "r");
+            horizon_set_source_path(filename);
+        }
+
+        // Programs in the structured language are compiled to assembly first, which is
+        // then assembled like any other program
+        char *asm_text = NULL;
+        if (fd != NULL && horizon_hl_source(filename))
+        {
+            int hl_errors = 0;
+            FILE *hl_fd = fd;
+            fd = horizon_hl_open(hl_fd, filename, &asm_text, &hl_errors);
+            if (hl_fd != stdin)
+                fclose(hl_fd);
+            if (fd == NULL)
+            {
+                printf("Program contains %d errors, exiting\n", hl_errors);
+                free(asm_text);
+                return EXIT_FAILURE;
+            }
+
+            if (output_asm)
+            {
+                char asmout[BUFSIZ + 4] = { 0 };
+                sprintf(asmout, "%s%s", output_filename, HORIZON_HL_ASM_EXT);
+                fclose(fd);
+                if ((fd = fopen(asmout, "w")) == NULL)
+                {
+                    perror("fcc");
+                    free(asm_text);
+                    return EXIT_FAILURE;
+                }
+                fwrite(asm_text, 1, strlen(asm_text), fd);
+                fclose(fd);
+                free(asm_text);
+                horizon_profile_free(profile);
+                return EXIT_SUCCESS;
+            }
+        }
+        else if (fd != NULL && output_asm)
+        {
+            printf("-S only applies to programs in the structured language (%s)\n", HORIZON_HL_EXT);
+            if (fd != stdin)
+                fclose(fd);
+            return EXIT_FAILURE;
+        }
+
+        if (fd != NULL)
         {
             int res = parse(fd, arch);
-            fclose(fd);
+            if (fd != stdin)
+                fclose(fd);
+            free(asm_text);
             if (res != 0)
                 return EXIT_FAILURE;
         } else
@@ -160,7 +324,30 @@ int main(int argc, char **argv)
     }
 
     // Output
-    if (output_binary)
+    if (output_object)
+    {
+        char objout[BUFSIZ + 4] = { 0 };
+        sprintf(objout, "%s%s", output_filename, HORIZON_OBJECT_EXT);
+        if (arch == ARCH_HORIZON)
+        {
+            if ((fd = fopen(objout, "wb")) != NULL)
+            {
+                int res = horizon_object_write(fd, ho_program);
+                fclose(fd);
+                if (res != 0)
+                {
+                    remove(objout);
+                    horizon_free(ho_program);
+                    return EXIT_FAILURE;
+                }
+            } else
+            {
+                perror("fcc");
+                return EXIT_FAILURE;
+            }
+        }
+    }
+    else if (output_binary)
     {
         char binout[BUFSIZ + 4] = { 0 };
         sprintf(binout, "%s.bin", output_filename);
@@ -193,11 +380,17 @@ int main(int argc, char **argv)
                 for (int i = 0; i < ho_program->len_code; i++)
                     code_array[i] = ho_program->code[i] & 0xFFFFFFFF;
 
-                char *bp_str = bp_replace(rom_12_bit, is_rom_12_placeholder, code_array, ho_program->len_code);
-                bp_str = bp_set_name_desc(bp_str, rom_12_name, ho_program->name, rom_12_desc, ho_program->desc);
+                // Programs too long for one ROM are split into a blueprint book
+                char *bp_str = bp_build_program(code_array, ho_program->len_code, ho_program->name, ho_program->desc, rom_template, level);
+                free(code_array);
+                if (bp_str == NULL)
+                {
+                    fprintf(stderr, "fcc: couldn't create the blueprint string\n");
+                    if (output_filename_set) fclose(fd);
+                    return EXIT_FAILURE;
+                }
 
                 fwrite(bp_str, 1, strlen(bp_str), fd);
-                free(code_array);
                 free(bp_str);
                 if (output_filename_set) fclose(fd);
                 else putchar('\n');
@@ -212,6 +405,7 @@ int main(int argc, char **argv)
     // Clean up
     if (arch == ARCH_HORIZON)
         horizon_free(ho_program);
+    horizon_profile_free(profile);
 
     return EXIT_SUCCESS;
 }
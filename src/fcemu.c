@@ -6,9 +6,15 @@
 #include <string.h>
 
 #include "fcerrors.h"
+#include "bp_creator.h"
+#include "bp_extract.h"
+#include "helpers.h"
 #include "fcgui.h"
+#include "horizon/horizon_cache.h"
 #include "horizon/horizon_compiler.h"
+#include "horizon/horizon_hl.h"
 #include "horizon/horizon_parser.h"
+#include "horizon/horizon_profile.h"
 #include "horizon/horizon_vm.h"
 #include "program.h"
 
@@ -20,16 +26,24 @@ int error = 0;
 int opt;
 extern char *optarg;
 extern int optopt;
+int use_cache = 1;
 
-const char *optstring = ":f:a:bth";
-const char *req_opt = "ynnnn";
+const char *optstring = ":f:a:btp:nh";
+const char *req_opt = "ynnnnnn";
 const char *opt_help[] = {
-    "Filename of the program. May be passed without the flag as well",
+    "Filename of the program, which can also be a blueprint string exported\n\t\t\tfrom the game. May be passed without the flag as well",
     "Architecture: currently only horizon is implemented (default: horizon)",
     "Interpret input file as compiled bytecode",
     "Run in TUI instead of GUI",
+    "Write how often each jump was taken to a profile file when the\n\t\t\tprogram stops, for fcc --profile-use (same as --profile)",
+    "Don't use the compilation cache (same as --no-cache)",
     "Print this help menu and exit",
 };
+const struct option long_options[] = {
+    { "no-cache", no_argument, NULL, 'n' },
+    { "profile", required_argument, NULL, 'p' },
+    { NULL, 0, NULL, 0 },
+};
 
 void help()
 {
@@ -55,12 +69,69 @@ void help()
     }
 }
 
+// Load the words of a ROM if the file is a blueprint string, or of every ROM of a book
+// joined in the order of their index
+// Returns 1 if it was loaded, 0 if the file is not a blueprint string, or -1 on errors
+static int load_bp(FILE *fd, const char *filename, uint32_t **program, size_t *program_size)
+{
+    int c = fgetc(fd);
+    if (c != '0')
+    {
+        rewind(fd);
+        return 0;
+    }
+    ungetc(c, fd);
+
+    char *bp_str = fread_all(fd);
+    if (bp_str == NULL || !bp_is_string(bp_str))
+    {
+        free(bp_str);
+        rewind(fd);
+        return 0;
+    }
+
+    // Strings copied from the game may end with a newline
+    size_t len = strlen(bp_str);
+    while (len > 0 && (bp_str[len - 1] == '\n' || bp_str[len - 1] == '\r' || bp_str[len - 1] == ' ' || bp_str[len - 1] == '\t'))
+        bp_str[--len] = 0;
+
+    bp_rom_t *roms;
+    int len_roms = bp_extract(bp_str, &roms);
+    free(bp_str);
+    if (len_roms <= 0)
+    {
+        printf("%s %s\n", filename, (len_roms < 0) ? "is not a valid blueprint string" : "contains no ROM");
+        bp_free_roms(roms, 0);
+        return -1;
+    }
+
+    // The ROMs of a book hold consecutive parts of the program, as bp_build_program
+    // splits it, so all but the last are full
+    size_t size = 0;
+    for (int i = 0; i < len_roms - 1; i++)
+        size += bp_template_find(roms[i].rom)->capacity;
+    size += roms[len_roms - 1].len_words;
+
+    *program_size = size ? size : 1;
+    *program = calloc(*program_size, sizeof(uint32_t));
+    size = 0;
+    for (int i = 0; i < len_roms; i++)
+    {
+        int len_words = (i < len_roms - 1) ? bp_template_find(roms[i].rom)->capacity : roms[i].len_words;
+        for (int j = 0; j < len_words; j++)
+            (*program)[size + j] = roms[i].words[j];
+        size += len_words;
+    }
+    bp_free_roms(roms, len_roms);
+    return 1;
+}
+
 static horizon_program_t *ho_program = { 0 };
 int parse(FILE *fd, int arch)
 {
     if (arch == ARCH_HORIZON)
     {
-        ho_program = horizon_parse(fd, NULL, 0);
+        ho_program = horizon_parse_cached(fd, "horizon", use_cache);
         if (ho_program->error_count)
         {
             printf("Program contains at least %d errors, exiting\n", ho_program->error_count);
@@ -81,8 +152,9 @@ int main(int argc, char **argv)
     int arch = ARCH_HORIZON;
     int input_binary = 0;
     int tui = 0;
+    char *profile_path = NULL;
 
-    while ((opt = getopt(argc, argv, optstring)) != -1)
+    while ((opt = getopt_long(argc, argv, optstring, long_options, NULL)) != -1)
     {
         switch (opt)
         {
@@ -105,6 +177,12 @@ int main(int argc, char **argv)
         case 't':
             tui = 1;
             break;
+        case 'p':
+            profile_path = optarg;
+            break;
+        case 'n':
+            use_cache = 0;
+            break;
         case 'h':
             help();
             return EXIT_SUCCESS;
@@ -152,8 +230,37 @@ int main(int argc, char **argv)
         {
             if ((fd = fopen(filename, "r")) != NULL)
             {
-                int res = parse(fd, arch);
+                // Blueprint strings are read in memory, without compiling anything
+                int res = load_bp(fd, filename, &program, &program_size);
+                if (res != 0)
+                {
+                    fclose(fd);
+                    if (res < 0)
+                        return EXIT_FAILURE;
+                    goto fcemu_run;
+                }
+
+                horizon_set_source_path(filename);
+
+                // Programs in the structured language are compiled to assembly first
+                char *asm_text = NULL;
+                if (horizon_hl_source(filename))
+                {
+                    int hl_errors = 0;
+                    FILE *hl_fd = fd;
+                    fd = horizon_hl_open(hl_fd, filename, &asm_text, &hl_errors);
+                    fclose(hl_fd);
+                    if (fd == NULL)
+                    {
+                        printf("Program contains %d errors, exiting\n", hl_errors);
+                        free(asm_text);
+                        return EXIT_FAILURE;
+                    }
+                }
+
+                res = parse(fd, arch);
                 fclose(fd);
+                free(asm_text);
                 if (res != 0)
                     return EXIT_FAILURE;
 
@@ -178,16 +285,22 @@ int main(int argc, char **argv)
             if ((fd = fopen(filename, "rb")) != NULL)
             {
                 fseek(fd, 0, SEEK_END);
-                program_size = ftell(fd);
+                program_size = ftell(fd) / sizeof(uint32_t);
                 fseek(fd, 0, SEEK_SET);
 
                 program = malloc(sizeof(uint32_t) * program_size);
-                fread(program, sizeof(uint32_t), program_size, fd);
+                program_size = fread(program, sizeof(uint32_t), program_size, fd);
+                fclose(fd);
+            } else
+            {
+                perror("fcemu");
+                return EXIT_FAILURE;
             }
         }
     }
 
     // Run program
+fcemu_run:
     if (program)
     {
         if (tui)
@@ -215,11 +328,20 @@ int main(int argc, char **argv)
             printf("    SP  = %08x = %d\n", vm.registers[HO_SP], vm.registers[HO_SP]);
             printf("    LR  = %08x = %d\n", vm.registers[HO_LR], vm.registers[HO_LR]);
             printf("    PC  = %08x = %d\n", vm.registers[HO_PC], vm.registers[HO_PC]);
+
+            if (profile_path)
+            {
+                FILE *profile_fd = fopen(profile_path, "w");
+                if (profile_fd == NULL || horizon_profile_write(profile_fd, vm.branch_taken, vm.branch_not_taken, HOVM_ROM_SIZE) != 0)
+                    perror("fcemu");
+                if (profile_fd != NULL)
+                    fclose(profile_fd);
+            }
         }
         else
         {
             // Run emulator in graphical mode
-            fcgui_start(arch, program, program_size);
+            fcgui_start(arch, program, program_size, profile_path);
         }
     }
 
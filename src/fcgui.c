@@ -9,6 +9,7 @@
 #include <string.h>
 
 #include "fcgui.h"
+#include "horizon/horizon_profile.h"
 #include "horizon/horizon_vm.h"
 #include "program.h"
 
@@ -411,7 +412,7 @@ void fcgui_draw_controls(int xoffset, int yoffset)
     fcgui_draw_text(buf, xoffset + 20 * fcgui_ptsize, yoffset + 1.5 * fcgui_ptsize, font_options);
 }
 
-void fcgui_start(int arch, uint32_t *program, size_t program_size)
+void fcgui_start(int arch, uint32_t *program, size_t program_size, const char *profile_path)
 {
     if (arch != ARCH_HORIZON)
         return;
@@ -558,4 +559,13 @@ void fcgui_start(int arch, uint32_t *program, size_t program_size)
     }
 
     fcgui_quit();
+
+    if (profile_path)
+    {
+        FILE *fd = fopen(profile_path, "w");
+        if (fd == NULL || horizon_profile_write(fd, vm.branch_taken, vm.branch_not_taken, HOVM_ROM_SIZE) != 0)
+            perror("fcemu");
+        if (fd != NULL)
+            fclose(fd);
+    }
 }
@@ -5,6 +5,7 @@
 #include <sys/types.h>
 
 // Start the main gui for execution
-void fcgui_start(int arch, uint32_t *program, size_t program_size);
+// If profile_path is not NULL, the branch profile is written to it on exit
+void fcgui_start(int arch, uint32_t *program, size_t program_size, const char *profile_path);
 
 #endif // FC_GUI_H
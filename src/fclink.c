@@ -0,0 +1,216 @@
+// Factorio computer linker
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+
+#include "horizon/horizon_compiler.h"
+#include "horizon/horizon_linker.h"
+#include "horizon/horizon_parser.h"
+#include "fcerrors.h"
+#include "program.h"
+#include "bp_creator.h"
+
+// Error reporting
+int error = 0;
+
+// Options
+int opt;
+extern char *optarg;
+extern int optopt;
+
+int level = BP_DEFAULT_LEVEL;
+const rom_template_t *rom_template = NULL;
+
+const char *optstring = ":bo:z:T:h";
+const char *req_opt = "nnnnn";
+const char *opt_help[] = {
+    "Generate only raw binary output (.bin output)",
+    "Output file name. By default blueprint strings are output to stdout, if\n\t\t\tgenerating binary output, the default is 'a.out.bin'",
+    "Compression level of blueprint strings, from 1 (fastest) to 9 (smallest,\n\t\t\tdefault)",
+    "ROM template of blueprint strings, by name: rom_11 (2048 words) or\n\t\t\trom_12 (4096 words). By default the templates with the fewest\n\t\t\tcombinators for the program are used",
+    "Print this help menu and exit",
+};
+
+void help()
+{
+    int nopt = 0;
+
+    printf("Usage: fclink [options] object-files...\n");
+    printf("\nLinks object files created with 'fcc -c' into a program. The data and program\n");
+    printf("sections are placed in the order the files are given.\n");
+    printf("\nAvailable options:\n");
+    for (int i = 0; i < strlen(optstring); i++)
+    {
+        switch (optstring[i])
+        {
+        case ':': case '-': case '+': case ';':
+            continue;
+        default:
+            printf("    -%c %s\r\t\t\t%s.\n", optstring[i], (optstring[i+1] == ':' ? "<argument>" : ""), opt_help[nopt]);
+            if (req_opt[nopt] == 'y')
+            {
+                printf("\t\t\tThis option is required.\n");
+            }
+            nopt++;
+            break;
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    char output_filename[BUFSIZ] = "a.out";
+    int output_filename_set = 0;
+    int output_binary = 0;
+
+    while ((opt = getopt(argc, argv, optstring)) != -1)
+    {
+        switch (opt)
+        {
+        case 'b':
+            output_binary = 1;
+            break;
+        case 'o':
+            strncpy(output_filename, optarg, BUFSIZ - 1);
+            output_filename_set = 1;
+            break;
+        case 'z':
+            level = atoi(optarg);
+            if (level < 1 || level > 9)
+            {
+                printf("Invalid compression level: %s\n", optarg);
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'T':
+            rom_template = bp_template_find(optarg);
+            if (rom_template == NULL)
+            {
+                printf("Unknown ROM template: %s\n", optarg);
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'h':
+            help();
+            return EXIT_SUCCESS;
+        case ':':
+            error = ERR_NO_ARG;
+            help();
+            return EXIT_FAILURE;
+        default: // '?'
+            error = ERR_BAD_OPTION;
+            help();
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Error checking
+    if (optind >= argc)
+    {
+        error = ERR_MISSING_OPT;
+        help();
+        return EXIT_FAILURE;
+    }
+
+    // Read objects
+    int len_objects = argc - optind;
+    horizon_object_t **objects = calloc(len_objects, sizeof(horizon_object_t *));
+    FILE *fd;
+    int res = 0;
+    for (int i = 0; i < len_objects; i++)
+    {
+        const char *filename = argv[optind + i];
+        if ((fd = fopen(filename, "rb")) != NULL)
+        {
+            objects[i] = horizon_object_read(fd, filename);
+            fclose(fd);
+            if (objects[i] == NULL)
+            {
+                printf("%s is not a valid object file\n", filename);
+                res = ERR_INVALID_ARG;
+            }
+        } else
+        {
+            perror("fclink");
+            res = ERR_INVALID_ARG;
+        }
+    }
+
+    horizon_program_t *ho_program = NULL;
+    if (res == 0)
+    {
+        ho_program = horizon_link(objects, len_objects);
+        if (ho_program->error_count)
+        {
+            printf("Linking failed with %d errors, exiting\n", ho_program->error_count);
+            res = ERR_COMPILATION_ERR;
+        }
+    }
+
+    for (int i = 0; i < len_objects; i++)
+        horizon_object_free(objects[i]);
+    free(objects);
+
+    if (res != 0)
+    {
+        horizon_free(ho_program);
+        return EXIT_FAILURE;
+    }
+
+    // Output
+    if (output_binary)
+    {
+        char binout[BUFSIZ + 4] = { 0 };
+        sprintf(binout, "%s.bin", output_filename);
+        if ((fd = fopen(binout, "wb")) != NULL)
+        {
+            for (int i = 0; i < ho_program->len_code; i++)
+                fwrite(ho_program->code + i, sizeof(uint32_t), 1, fd);
+
+            fclose(fd);
+        } else
+        {
+            perror("fclink");
+            return EXIT_FAILURE;
+        }
+    }
+    else
+    {
+        // Output compiled BP string
+        if (output_filename_set)
+            (fd = fopen(output_filename, "w"));
+        else fd = stdout;
+        if (fd != NULL)
+        {
+            int32_t *code_array = malloc(sizeof(int32_t) * ho_program->len_code);
+            for (int i = 0; i < ho_program->len_code; i++)
+                code_array[i] = ho_program->code[i] & 0xFFFFFFFF;
+
+            // Programs too long for one ROM are split into a blueprint book
+            char *bp_str = bp_build_program(code_array, ho_program->len_code, ho_program->name, ho_program->desc, rom_template, level);
+            free(code_array);
+            if (bp_str == NULL)
+            {
+                fprintf(stderr, "fclink: couldn't create the blueprint string\n");
+                if (output_filename_set) fclose(fd);
+                return EXIT_FAILURE;
+            }
+
+            fwrite(bp_str, 1, strlen(bp_str), fd);
+            free(bp_str);
+            if (output_filename_set) fclose(fd);
+            else putchar('\n');
+        } else
+        {
+            perror("fclink");
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Clean up
+    horizon_free(ho_program);
+
+    return EXIT_SUCCESS;
+}
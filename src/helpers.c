@@ -1,7 +1,10 @@
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <pthread.h>
+#include <unistd.h>
 #include <zlib.h>
 #include "helpers.h"
 
@@ -146,25 +149,182 @@ static const int ascii_to_base64[256] =
 	64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64
 };
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BASE64_SIMD
+#include <immintrin.h>
+
+// The SIMD codecs are compiled for their instruction sets on their own and chosen at
+// runtime, see Wojciech Muła's and Alfred Klomp's base64 work for the approach.
+// Each handles whole blocks without padding and returns how much input it consumed,
+// the scalar code does the rest.
+
+// Spread 12 bytes, as loaded at the start of in, into 16 6-bit indices and look up
+// their characters
+__attribute__((target("ssse3")))
+static inline __m128i base64_enc_reshuffle_ssse3(__m128i in)
+{
+    in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    __m128i t0 = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040));
+    __m128i t1 = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010));
+    __m128i indices = _mm_or_si128(t0, t1);
+
+    // 0..25 map to 13, 26..51 to 0, 52..61 to 1..10, 62 to 11 and 63 to 12, which
+    // select the offset from the index to its character
+    __m128i offset = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    offset = _mm_or_si128(offset, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+    const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+    return _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, offset));
+}
+
+// Encode 12 bytes at a time, 16 are read
+__attribute__((target("ssse3")))
+static size_t base64_encode_ssse3(char *encoded, const unsigned char *bytes, size_t len)
+{
+    size_t i = 0;
+    for (; i + 16 <= len; i += 12, encoded += 16)
+        _mm_storeu_si128((__m128i *) encoded, base64_enc_reshuffle_ssse3(_mm_loadu_si128((const __m128i *) (bytes + i))));
+    return i;
+}
+
+// Encode 24 bytes at a time, 28 are read
+__attribute__((target("avx2")))
+static size_t base64_encode_avx2(char *encoded, const unsigned char *bytes, size_t len)
+{
+    size_t i = 0;
+    const __m256i shuffle = _mm256_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+        10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+    const __m256i offsets = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+    for (; i + 28 <= len; i += 24, encoded += 32)
+    {
+        __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *) (bytes + i))),
+            _mm_loadu_si128((const __m128i *) (bytes + i + 12)), 1);
+        in = _mm256_shuffle_epi8(in, shuffle);
+        __m256i t0 = _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00)), _mm256_set1_epi32(0x04000040));
+        __m256i t1 = _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0)), _mm256_set1_epi32(0x01000010));
+        __m256i indices = _mm256_or_si256(t0, t1);
+
+        __m256i offset = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        offset = _mm256_or_si256(offset, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+        _mm256_storeu_si256((__m256i *) encoded, _mm256_add_epi8(indices, _mm256_shuffle_epi8(offsets, offset)));
+    }
+    return i + base64_encode_ssse3(encoded, bytes + i, len - i);
+}
+
+// Decode 16 characters at a time into 12 bytes, 16 are written. Stops at the first
+// block with a character outside of the alphabet, like padding, without branching on
+// every character: each character's low and high nibbles select bit sets which only
+// overlap for invalid ones
+__attribute__((target("ssse3")))
+static size_t base64_decode_ssse3(char *decoded, const char *b64_data, size_t len)
+{
+    const __m128i lut_lo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+    const __m128i lut_hi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m128i lut_roll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i mask_2f = _mm_set1_epi8(0x2f);
+
+    size_t i = 0;
+    // 8 more characters decode to at least the 4 bytes written past the block
+    for (; i + 24 <= len; i += 16, decoded += 12)
+    {
+        __m128i str = _mm_loadu_si128((const __m128i *) (b64_data + i));
+        __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(str, 4), mask_2f);
+        __m128i lo_nibbles = _mm_and_si128(str, mask_2f);
+        __m128i invalid = _mm_and_si128(_mm_shuffle_epi8(lut_lo, lo_nibbles), _mm_shuffle_epi8(lut_hi, hi_nibbles));
+        if (_mm_movemask_epi8(_mm_cmpgt_epi8(invalid, _mm_setzero_si128())))
+            break;
+
+        // '/' shares its high nibble with '+', it is moved to the entry before
+        __m128i roll = _mm_shuffle_epi8(lut_roll, _mm_add_epi8(_mm_cmpeq_epi8(str, mask_2f), hi_nibbles));
+        str = _mm_add_epi8(str, roll);
+
+        // Pack the 6-bit values of each 4 characters into 3 bytes
+        __m128i merged = _mm_maddubs_epi16(str, _mm_set1_epi32(0x01400140));
+        merged = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+        merged = _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        _mm_storeu_si128((__m128i *) decoded, merged);
+    }
+    return i;
+}
+
+// Decode 32 characters at a time into 24 bytes, 32 are written
+__attribute__((target("avx2")))
+static size_t base64_decode_avx2(char *decoded, const char *b64_data, size_t len)
+{
+    const __m256i lut_lo = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a,
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+        0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+    const __m256i lut_hi = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+        0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m256i lut_roll = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i mask_2f = _mm256_set1_epi8(0x2f);
+    const __m256i pack = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+    size_t i = 0;
+    // 16 more characters decode to at least the 8 bytes written past the block
+    for (; i + 48 <= len; i += 32, decoded += 24)
+    {
+        __m256i str = _mm256_loadu_si256((const __m256i *) (b64_data + i));
+        __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(str, 4), mask_2f);
+        __m256i lo_nibbles = _mm256_and_si256(str, mask_2f);
+        __m256i invalid = _mm256_and_si256(_mm256_shuffle_epi8(lut_lo, lo_nibbles), _mm256_shuffle_epi8(lut_hi, hi_nibbles));
+        if (_mm256_movemask_epi8(_mm256_cmpgt_epi8(invalid, _mm256_setzero_si256())))
+            break;
+
+        __m256i roll = _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(_mm256_cmpeq_epi8(str, mask_2f), hi_nibbles));
+        str = _mm256_add_epi8(str, roll);
+
+        __m256i merged = _mm256_maddubs_epi16(str, _mm256_set1_epi32(0x01400140));
+        merged = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+        merged = _mm256_shuffle_epi8(merged, pack);
+        // Move the 12 bytes of the upper lane next to the lower ones
+        merged = _mm256_permutevar8x32_epi32(merged, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+        _mm256_storeu_si256((__m256i *) decoded, merged);
+    }
+    return i + base64_decode_ssse3(decoded, b64_data + i, len - i);
+}
+#endif // BASE64_SIMD
+
 // Base64 decode
 // Quirks: requires padding, allows no characters outside of the base64 alphabet, not even whitespace.
 // On successful decoding returns 0, if an error was encountered with the data, -1.
+// Decoding is vectorized with AVX2 or SSSE3 if the CPU supports them.
 // decoded: destination buffer for decoded bytes data. Assumed to be big enough, does not null-terminate.
 // b64_data: null-terminated string of base 64 data to decode.
 int base64_decode(char *decoded, const char *b64_data)
 {
+    int i = 0;
     int j = 0;
     int qi = 0;
     char quad[4] = { 0 };
     int pad = 0;
 
-    for (int i = 0; b64_data[i] != '\0'; i++)
+#ifdef BASE64_SIMD
+    if (__builtin_cpu_supports("avx2"))
+        i = base64_decode_avx2(decoded, b64_data, strlen(b64_data));
+    else if (__builtin_cpu_supports("ssse3"))
+        i = base64_decode_ssse3(decoded, b64_data, strlen(b64_data));
+    j = i / 4 * 3;
+#endif
+
+    for (; b64_data[i] != '\0'; i++)
     {
-        if (ascii_to_base64[(int) b64_data[i]] == 64 && b64_data[i] != '=')
+        unsigned char c = b64_data[i];
+        if (ascii_to_base64[c] == 64 && c != '=')
             return -1;
 
-        quad[qi++] = ascii_to_base64[(int) b64_data[i]];
-        pad += (b64_data[i] == '=');
+        quad[qi++] = ascii_to_base64[c];
+        pad += (c == '=');
 
         if (qi == 4)
         {
@@ -181,18 +341,28 @@ int base64_decode(char *decoded, const char *b64_data)
 }
 
 // Base64 encode
+// Encoding is vectorized with AVX2 or SSSE3 if the CPU supports them.
 // encoded: destination buffer for encoded base 64 null-terminated string. Assumed to be big enough.
 // bytes_data: bytes buffer to encode, not necessarily null-terminated.
 // bytes_len: length of bytes_data.
 int base64_encode(char *encoded, const char *bytes_data, size_t bytes_len)
 {
+    size_t i = 0;
     int j = 0;
     int ti = 0;
     unsigned char triplet[3] = { 0 };
 
+#ifdef BASE64_SIMD
+    if (__builtin_cpu_supports("avx2"))
+        i = base64_encode_avx2(encoded, (const unsigned char *) bytes_data, bytes_len);
+    else if (__builtin_cpu_supports("ssse3"))
+        i = base64_encode_ssse3(encoded, (const unsigned char *) bytes_data, bytes_len);
+    j = i / 3 * 4;
+#endif
+
     // Iterate through source array and group triplets
     // When a triplet is complete, encode it and empty the triplet array
-    for (int i = 0; i < bytes_len; i++)
+    for (; i < bytes_len; i++)
     {
         triplet[ti++] = bytes_data[i];
         if (ti == 3)
@@ -384,6 +554,294 @@ int inf(FILE *source, FILE *dest)
     return ret == Z_STREAM_END ? Z_OK : Z_DATA_ERROR;
 }
 
+/* Compress len bytes from source into a newly allocated buffer of deflateBound()
+   bytes, which is stored in dest and the compressed length in dest_len.
+   def_mem() returns Z_OK on success, or the errors of def() except Z_ERRNO. */
+int def_mem(const unsigned char *source, size_t len, unsigned char **dest, size_t *dest_len, int level)
+{
+    int ret;
+    z_stream strm;
+
+    /* allocate deflate state */
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    ret = deflateInit(&strm, level);
+    if (ret != Z_OK)
+        return ret;
+
+    /* the bound fits the whole stream, so a single call finishes it */
+    uLong bound = deflateBound(&strm, len);
+    *dest = malloc(bound);
+    if (*dest == NULL) {
+        (void)deflateEnd(&strm);
+        return Z_MEM_ERROR;
+    }
+    strm.next_in = (unsigned char *)source;
+    strm.avail_in = len;
+    strm.next_out = *dest;
+    strm.avail_out = bound;
+    ret = deflate(&strm, Z_FINISH);
+    assert(ret != Z_STREAM_ERROR);  /* state not clobbered */
+    *dest_len = strm.total_out;
+
+    /* clean up and return */
+    (void)deflateEnd(&strm);
+    if (ret != Z_STREAM_END) {
+        free(*dest);
+        *dest = NULL;
+        return Z_BUF_ERROR;
+    }
+    return Z_OK;
+}
+
+/* Decompress a complete zlib stream of len bytes from source into a newly
+   allocated, null-terminated buffer, which is stored in dest and the
+   decompressed length in dest_len.
+   inf_mem() returns Z_OK on success, or the errors of inf() except Z_ERRNO. */
+int inf_mem(const unsigned char *source, size_t len, unsigned char **dest, size_t *dest_len)
+{
+    int ret;
+    z_stream strm;
+    size_t size = 4 * len + CHUNK;
+
+    /* allocate inflate state */
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    strm.avail_in = len;
+    strm.next_in = (unsigned char *)source;
+    ret = inflateInit(&strm);
+    if (ret != Z_OK)
+        return ret;
+
+    *dest = malloc(size + 1);
+    if (*dest == NULL) {
+        (void)inflateEnd(&strm);
+        return Z_MEM_ERROR;
+    }
+
+    /* decompress until the stream ends, growing the buffer when it fills up */
+    do {
+        if (strm.total_out == size) {
+            size *= 2;
+            unsigned char *grown = realloc(*dest, size + 1);
+            if (grown == NULL) {
+                ret = Z_MEM_ERROR;
+                break;
+            }
+            *dest = grown;
+        }
+        strm.next_out = *dest + strm.total_out;
+        strm.avail_out = size - strm.total_out;
+        ret = inflate(&strm, Z_NO_FLUSH);
+        assert(ret != Z_STREAM_ERROR);  /* state not clobbered */
+        if (ret == Z_NEED_DICT || (ret == Z_BUF_ERROR && strm.avail_in == 0))
+            ret = Z_DATA_ERROR;
+    } while (ret == Z_OK || ret == Z_BUF_ERROR);
+    *dest_len = strm.total_out;
+
+    /* clean up and return */
+    (void)inflateEnd(&strm);
+    if (ret != Z_STREAM_END) {
+        free(*dest);
+        *dest = NULL;
+        return ret;
+    }
+    (*dest)[*dest_len] = 0;
+    return Z_OK;
+}
+
+/* A block of input for def_par_t, compressed on its own thread */
+struct def_par_block {
+    unsigned char in[DEF_PAR_BLOCK];
+    size_t len_in;
+    const unsigned char *dict;      /* end of the previous block's input */
+    size_t len_dict;
+    int level;
+    int max_chain;
+    int last;                       /* finished instead of flushed */
+
+    unsigned char *out;             /* malloced raw deflate data */
+    size_t len_out;
+    uLong adler;                    /* of in alone */
+    int ret;
+    pthread_t thread;
+    int started;
+};
+
+/* Compress one block as raw deflate data, ending byte-aligned with a sync flush so
+   the next block's data can follow it, or with the final block */
+static void *def_par_compress(void *arg)
+{
+    struct def_par_block *block = arg;
+    z_stream strm;
+
+    strm.zalloc = Z_NULL;
+    strm.zfree = Z_NULL;
+    strm.opaque = Z_NULL;
+    block->ret = deflateInit2(&strm, block->level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
+    if (block->ret != Z_OK)
+        return NULL;
+    if (block->level == 9 && block->max_chain > 0)
+        deflateTune(&strm, 32, 258, 258, block->max_chain);
+    if (block->len_dict > 0)
+        deflateSetDictionary(&strm, block->dict, block->len_dict);
+
+    /* the flush adds at most a few bytes after the bound of the data */
+    size_t size = deflateBound(&strm, block->len_in) + 16;
+    block->out = malloc(size);
+    if (block->out == NULL) {
+        (void)deflateEnd(&strm);
+        block->ret = Z_MEM_ERROR;
+        return NULL;
+    }
+    strm.next_in = block->in;
+    strm.avail_in = block->len_in;
+    strm.next_out = block->out;
+    strm.avail_out = size;
+    int ret = deflate(&strm, block->last ? Z_FINISH : Z_SYNC_FLUSH);
+    assert(ret != Z_STREAM_ERROR);  /* state not clobbered */
+    block->len_out = strm.total_out;
+    block->ret = (strm.avail_in == 0 && (block->last ? ret == Z_STREAM_END : strm.avail_out > 0)) ? Z_OK : Z_BUF_ERROR;
+    block->adler = adler32(adler32(0L, Z_NULL, 0), block->in, block->len_in);
+    (void)deflateEnd(&strm);
+    return NULL;
+}
+
+/* Wait for the oldest block still being compressed */
+static void def_par_join(def_par_t *par)
+{
+    struct def_par_block *block = par->blocks[par->joined++];
+    if (block->started)
+        pthread_join(block->thread, NULL);
+    if (block->ret != Z_OK && par->ret == Z_OK)
+        par->ret = block->ret;
+}
+
+/* Start compressing the block being filled, on a new thread if there are more
+   than one, and add an empty one after it unless it is the last */
+static void def_par_start(def_par_t *par, int last)
+{
+    struct def_par_block *block = par->blocks[par->len_blocks - 1];
+    block->last = last;
+    block->level = par->level;
+    block->max_chain = par->max_chain;
+    if (par->len_blocks > 1) {
+        struct def_par_block *prev = par->blocks[par->len_blocks - 2];
+        block->len_dict = (prev->len_in < DEF_PAR_DICT) ? prev->len_in : DEF_PAR_DICT;
+        block->dict = prev->in + prev->len_in - block->len_dict;
+    }
+
+    while (par->len_blocks - 1 - par->joined >= par->threads)
+        def_par_join(par);
+    block->started = (par->threads > 1 && pthread_create(&block->thread, NULL, def_par_compress, block) == 0);
+    if (!block->started)
+        def_par_compress(block);
+
+    if (last)
+        return;
+    if (par->len_blocks >= par->len_blocks_space) {
+        par->len_blocks_space += 100;
+        par->blocks = realloc(par->blocks, sizeof(struct def_par_block *) * par->len_blocks_space);
+    }
+    par->blocks[par->len_blocks] = calloc(1, sizeof(struct def_par_block));
+    if (par->blocks[par->len_blocks] == NULL) {
+        par->ret = Z_MEM_ERROR;
+        return;
+    }
+    par->len_blocks++;
+}
+
+/* Start compressing, returns Z_OK or Z_STREAM_ERROR for an invalid level. par must
+   be passed to def_par_finish even on errors to free it */
+int def_par_init(def_par_t *par, int level, int max_chain, int threads)
+{
+    memset(par, 0, sizeof(def_par_t));
+    if (level < 1 || level > 9)
+        return par->ret = Z_STREAM_ERROR;
+    par->level = level;
+    par->max_chain = max_chain;
+    par->threads = (threads > 0) ? threads : 1;
+    par->len_blocks_space = 100;
+    par->blocks = malloc(sizeof(struct def_par_block *) * par->len_blocks_space);
+    if (par->blocks == NULL || (par->blocks[0] = calloc(1, sizeof(struct def_par_block))) == NULL)
+        return par->ret = Z_MEM_ERROR;
+    par->len_blocks = 1;
+    return par->ret = Z_OK;
+}
+
+/* Add len bytes of input, returns Z_OK or the first error of any block */
+int def_par_write(def_par_t *par, const unsigned char *data, size_t len)
+{
+    while (len > 0 && par->ret == Z_OK) {
+        struct def_par_block *block = par->blocks[par->len_blocks - 1];
+        size_t n = DEF_PAR_BLOCK - block->len_in;
+        if (n > len)
+            n = len;
+        memcpy(block->in + block->len_in, data, n);
+        block->len_in += n;
+        data += n;
+        len -= n;
+        if (block->len_in == DEF_PAR_BLOCK)
+            def_par_start(par, 0);
+    }
+    return par->ret;
+}
+
+/* Compress the rest and join the blocks into a newly allocated buffer, which is
+   stored in dest and its length in dest_len. par is freed in any case.
+   Returns Z_OK on success, or the first error of any block. */
+int def_par_finish(def_par_t *par, unsigned char **dest, size_t *dest_len)
+{
+    *dest = NULL;
+    *dest_len = 0;
+    if (par->ret == Z_OK && par->len_blocks > 0)
+        def_par_start(par, 1);
+    while (par->joined < par->len_blocks)
+        def_par_join(par);
+
+    /* zlib header with the level in FLEVEL, the deflate data and the adler32 of
+       all input, combined from the blocks */
+    size_t size = 6;
+    for (int i = 0; i < par->len_blocks; i++)
+        size += par->blocks[i]->len_out;
+    if (par->ret == Z_OK && (*dest = malloc(size)) == NULL)
+        par->ret = Z_MEM_ERROR;
+    if (par->ret == Z_OK) {
+        int flevel = (par->level == 1) ? 0 : (par->level < 6) ? 1 : (par->level == 6) ? 2 : 3;
+        unsigned header = (0x78 << 8) | (flevel << 6);
+        header += 31 - header % 31;
+        (*dest)[0] = header >> 8;
+        (*dest)[1] = header & 0xFF;
+        *dest_len = 2;
+
+        uLong adler = adler32(0L, Z_NULL, 0);
+        for (int i = 0; i < par->len_blocks; i++) {
+            struct def_par_block *block = par->blocks[i];
+            memcpy(*dest + *dest_len, block->out, block->len_out);
+            *dest_len += block->len_out;
+            adler = adler32_combine(adler, block->adler, block->len_in);
+        }
+        for (int i = 3; i >= 0; i--)
+            (*dest)[(*dest_len)++] = (adler >> (8 * i)) & 0xFF;
+    }
+
+    for (int i = 0; i < par->len_blocks; i++) {
+        free(par->blocks[i]->out);
+        free(par->blocks[i]);
+    }
+    free(par->blocks);
+    return par->ret;
+}
+
+/* Number of threads to compress with by default, the number of online CPUs */
+int def_par_threads(void)
+{
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return (cpus > 0) ? cpus : 1;
+}
+
 /* report a zlib or i/o error */
 void zerr(int ret)
 {
@@ -408,3 +866,71 @@ void zerr(int ret)
         fputs("zlib version mismatch!\n", stderr);
     }
 }
+
+// Write a 32-bit value to a binary file, in host byte order
+void fwrite_u32(FILE *fd, uint32_t value)
+{
+    fwrite(&value, sizeof(uint32_t), 1, fd);
+}
+
+// Read a value written by fwrite_u32
+// Returns 0 on success, -1 on EOF or errors
+int fread_u32(FILE *fd, uint32_t *value)
+{
+    return (fread(value, sizeof(uint32_t), 1, fd) == 1) ? 0 : -1;
+}
+
+// Write a string to a binary file as its length followed by its characters
+// NULL is written as a length of UINT32_MAX
+void fwrite_str(FILE *fd, const char *str)
+{
+    uint32_t len = (str) ? strlen(str) : UINT32_MAX;
+    fwrite_u32(fd, len);
+    if (str)
+        fwrite(str, 1, len, fd);
+}
+
+// Read a string written by fwrite_str into a newly allocated, null-terminated buffer
+// NULL strings are read back as NULL. Returns 0 on success, -1 on EOF or errors
+int fread_str(FILE *fd, char **str)
+{
+    uint32_t len;
+    *str = NULL;
+    if (fread_u32(fd, &len) != 0)
+        return -1;
+    if (len == UINT32_MAX)
+        return 0;
+
+    *str = malloc((size_t) len + 1);
+    if (*str == NULL || fread(*str, 1, len, fd) != len)
+        return -1;
+    (*str)[len] = 0;
+    return 0;
+}
+
+// Read the rest of a file into a newly allocated, null-terminated buffer
+char *fread_all(FILE *fd)
+{
+    size_t len = 0, space = BUFSIZ;
+    char *str = malloc(space);
+    size_t n;
+    while (str != NULL && (n = fread(str + len, 1, space - len - 1, fd)) > 0)
+    {
+        len += n;
+        if (len == space - 1)
+        {
+            space *= 2;
+            char *grown = realloc(str, space);
+            if (grown == NULL)
+                free(str);
+            str = grown;
+        }
+    }
+    if (str == NULL || ferror(fd))
+    {
+        free(str);
+        return NULL;
+    }
+    str[len] = 0;
+    return str;
+}
@@ -1,6 +1,7 @@
 #ifndef HELPERS_H
 #define HELPERS_H
 
+#include <stdint.h>
 #include <stdio.h>
 
 // Replace substrings in a string
@@ -31,6 +32,25 @@ size_t base64_decode_len(const char *b64_data, size_t b64_len);
 // bytes_len: length of bytes data.
 size_t base64_encode_len(size_t bytes_len);
 
+// Write a 32-bit value to a binary file, in host byte order
+void fwrite_u32(FILE *fd, uint32_t value);
+
+// Read a value written by fwrite_u32
+// Returns 0 on success, -1 on EOF or errors
+int fread_u32(FILE *fd, uint32_t *value);
+
+// Write a string to a binary file as its length followed by its characters
+// NULL is written as a length of UINT32_MAX
+void fwrite_str(FILE *fd, const char *str);
+
+// Read a string written by fwrite_str into a newly allocated, null-terminated buffer
+// NULL strings are read back as NULL. Returns 0 on success, -1 on EOF or errors
+int fread_str(FILE *fd, char **str);
+
+// Read the rest of a file into a newly allocated, null-terminated buffer
+// Returns the buffer, or NULL on errors
+char *fread_all(FILE *fd);
+
 // zlib compression and decompression functions from:
 /* zpipe.c: example of proper use of zlib's inflate() and deflate()
    Not copyrighted -- provided to the public domain
@@ -62,6 +82,54 @@ int def(FILE *source, FILE *dest, int level);
    is an error reading or writing the files. */
 int inf(FILE *source, FILE *dest);
 
+/* Compress len bytes from source into a newly allocated buffer of deflateBound()
+   bytes, which is stored in dest and the compressed length in dest_len.
+   def_mem() returns Z_OK on success, or the errors of def() except Z_ERRNO. */
+int def_mem(const unsigned char *source, size_t len, unsigned char **dest, size_t *dest_len, int level);
+
+/* Decompress a complete zlib stream of len bytes from source into a newly
+   allocated, null-terminated buffer, which is stored in dest and the
+   decompressed length in dest_len.
+   inf_mem() returns Z_OK on success, or the errors of inf() except Z_ERRNO. */
+int inf_mem(const unsigned char *source, size_t len, unsigned char **dest, size_t *dest_len);
+
+/* Parallel compression into a single zlib stream: the input is split into blocks of
+   DEF_PAR_BLOCK bytes, which are deflated on their own threads as soon as they are
+   complete, with the last 32K of the previous block as dictionary, and joined with
+   sync flushes. At most threads blocks are compressed at a time, the output is the
+   same for any number of threads. max_chain limits the matches searched with
+   deflateTune at level 9, 0 keeps zlib's. */
+#define DEF_PAR_BLOCK CHUNK
+#define DEF_PAR_DICT 32768
+
+struct def_par_block;
+
+typedef struct {
+    int level;
+    int max_chain;
+    int threads;
+    int ret;                        /* Z_OK until an error occurs */
+    int len_blocks;
+    int len_blocks_space;
+    int joined;                     /* blocks before this one are done */
+    struct def_par_block **blocks;  /* malloced, the last one is being filled */
+} def_par_t;
+
+/* Start compressing, returns Z_OK or Z_STREAM_ERROR for an invalid level. par must
+   be passed to def_par_finish even on errors to free it */
+int def_par_init(def_par_t *par, int level, int max_chain, int threads);
+
+/* Add len bytes of input, returns Z_OK or the first error of any block */
+int def_par_write(def_par_t *par, const unsigned char *data, size_t len);
+
+/* Compress the rest and join the blocks into a newly allocated buffer, which is
+   stored in dest and its length in dest_len. par is freed in any case.
+   Returns Z_OK on success, or the first error of any block. */
+int def_par_finish(def_par_t *par, unsigned char **dest, size_t *dest_len);
+
+/* Number of threads to compress with by default, the number of online CPUs */
+int def_par_threads(void);
+
 /* report a zlib or i/o error */
 void zerr(int ret);
 
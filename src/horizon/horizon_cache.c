@@ -0,0 +1,427 @@
+#include <dirent.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utime.h>
+
+#include "../helpers.h"
+#include "horizon_cache.h"
+#include "horizon_compiler.h"
+#include "horizon_parser.h"
+
+// Hash a program source together with everything else that changes its output:
+// the assembler version and build, and the options it is compiled with
+uint64_t horizon_cache_key(const char *src, size_t len, const char *options)
+{
+    // 64-bit FNV-1a
+    const uint64_t prime = 0x100000001b3;
+    uint64_t hash = 0xcbf29ce484222325;
+    const char *build = "horizon " HORIZON_ASM_VERSION " " __DATE__ " " __TIME__ "\n";
+
+    for (const char *c = build; *c; c++)
+        hash = (hash ^ (uint8_t) *c) * prime;
+    for (const char *c = options; c && *c; c++)
+        hash = (hash ^ (uint8_t) *c) * prime;
+    hash = (hash ^ '\n') * prime;
+    for (size_t i = 0; i < len; i++)
+        hash = (hash ^ (uint8_t) src[i]) * prime;
+
+    return hash;
+}
+
+// Create dir if it does not exist, errno.h can't be used with program.h
+static int ho_cache_mkdir_one(const char *dir)
+{
+    struct stat st;
+    if (mkdir(dir, 0755) == 0)
+        return 0;
+    return (stat(dir, &st) == 0 && S_ISDIR(st.st_mode)) ? 0 : -1;
+}
+
+// Create dir and its parents if they do not exist
+static int ho_cache_mkdir(char *dir)
+{
+    for (char *c = dir + 1; *c; c++)
+    {
+        if (*c != '/')
+            continue;
+        *c = 0;
+        int res = ho_cache_mkdir_one(dir);
+        *c = '/';
+        if (res != 0)
+            return -1;
+    }
+    return ho_cache_mkdir_one(dir);
+}
+
+// Set dest to the cache directory and create it if needed:
+// $FC_CACHE_DIR, $XDG_CACHE_HOME/fc-tools or $HOME/.cache/fc-tools
+// Returns 0 on success, -1 if there is no usable directory
+int horizon_cache_dir(char *dest, size_t size)
+{
+    const char *env;
+    int len;
+    if ((env = getenv("FC_CACHE_DIR")) && *env)
+        len = snprintf(dest, size, "%s", env);
+    else if ((env = getenv("XDG_CACHE_HOME")) && *env)
+        len = snprintf(dest, size, "%s/fc-tools", env);
+    else if ((env = getenv("HOME")) && *env)
+        len = snprintf(dest, size, "%s/.cache/fc-tools", env);
+    else
+        return -1;
+
+    if (len < 0 || len >= size)
+        return -1;
+
+    return ho_cache_mkdir(dest);
+}
+
+static int ho_cache_path(char *dest, size_t size, uint64_t key)
+{
+    char dir[BUFSIZ] = { 0 };
+    if (horizon_cache_dir(dir, BUFSIZ) != 0)
+        return -1;
+
+    int len = snprintf(dest, size, "%s/%016llx%s", dir, (unsigned long long) key, HORIZON_CACHE_EXT);
+    if (len < 0 || len >= size)
+        return -1;
+    return 0;
+}
+
+// Returns 1 if the file at path no longer has the given length and hash
+static int ho_cache_dep_changed(const char *path, uint32_t len, uint64_t hash)
+{
+    FILE *fd = fopen(path, "r");
+    if (fd == NULL)
+        return 1;
+
+    int size = 0;
+    int mapped = 0;
+    char *buf = horizon_read_source(fd, &size, &mapped);
+    fclose(fd);
+
+    int changed = (size != len || horizon_cache_key(buf, size, NULL) != hash);
+    horizon_free_source(buf, size, mapped);
+    return changed;
+}
+
+// Load the program stored under key
+// Returns a newly allocated horizon_program_t to be freed with horizon_free,
+// or NULL if there is no valid entry. Cached programs carry no source text, so
+// their code_lines are NULL and they have no modules.
+horizon_program_t *horizon_cache_load(uint64_t key, size_t src_len)
+{
+    char path[BUFSIZ] = { 0 };
+    if (ho_cache_path(path, BUFSIZ, key) != 0)
+        return NULL;
+
+    FILE *fd = fopen(path, "rb");
+    if (fd == NULL)
+        return NULL;
+
+    horizon_program_t *program = calloc(1, sizeof(horizon_program_t));
+    program->arch = ARCH_HORIZON;
+
+    char magic[4] = { 0 };
+    uint32_t version, key_lo, key_hi, len;
+    uint32_t len_code, len_data, code_start, len_symbols, len_code_lines;
+    int err = 0;
+
+    err |= fread(magic, 1, 4, fd) != 4 || memcmp(magic, HORIZON_CACHE_MAGIC, 4) != 0;
+    err |= fread_u32(fd, &version) || version != HORIZON_CACHE_VERSION;
+    err |= fread_u32(fd, &key_lo) || fread_u32(fd, &key_hi);
+    err |= ((uint64_t) key_hi << 32 | key_lo) != key;
+    err |= fread_u32(fd, &len) || len != src_len;
+    err |= fread_u32(fd, &len_code) || fread_u32(fd, &len_data);
+    err |= fread_u32(fd, &code_start) || fread_u32(fd, &len_symbols);
+    err |= fread_u32(fd, &len_code_lines);
+    if (err)
+        goto horizon_cache_load_invalid;
+
+    program->len_data = program->len_data_space = len_data;
+    program->data_offset = 1;
+    program->code_start = code_start;
+
+    // Machine code, including the data section
+    program->len_code = program->len_code_space = len_code;
+    program->code = malloc(sizeof(int64_t) * (len_code + 1));
+    program->data = malloc(sizeof(uint32_t) * (len_data + 1));
+    for (int i = 0; i < len_code && !err; i++)
+    {
+        uint32_t word;
+        err |= fread_u32(fd, &word);
+        program->code[i] = word;
+        if (i >= program->data_offset && i < program->data_offset + len_data)
+            program->data[i - program->data_offset] = word;
+    }
+
+    // Symbol table
+    program->symbols = malloc(sizeof(symbol_t) * (len_symbols + 1));
+    program->len_symbols_space = len_symbols + 1;
+    for (int i = 0; i < len_symbols && !err; i++)
+    {
+        symbol_t *symbol = &program->symbols[i];
+        uint32_t type, length;
+        char *name = NULL;
+        err |= fread_u32(fd, &symbol->value);
+        err |= fread_u32(fd, &type) || fread_u32(fd, &length);
+        err |= fread_str(fd, &name) || name == NULL;
+        symbol->type = type;
+        symbol->length = length;
+
+        // Symbol names are always HORIZON_IDENT_MAX_LEN + 1 long, see ho_add_symbol
+        symbol->name = calloc(1, HORIZON_IDENT_MAX_LEN + 1);
+        if (name)
+            strncpy(symbol->name, name, HORIZON_IDENT_MAX_LEN);
+        free(name);
+        program->len_symbols++;
+    }
+
+    // Line map: source line and first word of every code line
+    program->len_code_lines = program->len_code_lines_space = len_code_lines;
+    program->code_line_indices = malloc(sizeof(int) * (len_code_lines + 1));
+    program->code_line_offsets = malloc(sizeof(int) * (len_code_lines + 1));
+    for (int i = 0; i < len_code_lines && !err; i++)
+    {
+        uint32_t line, offset;
+        err |= fread_u32(fd, &line) || fread_u32(fd, &offset);
+        program->code_line_indices[i] = line;
+        program->code_line_offsets[i] = offset;
+    }
+
+    // Relocations
+    uint32_t len_relocs;
+    err |= fread_u32(fd, &len_relocs);
+    if (!err)
+    {
+        program->relocs = calloc(len_relocs + 1, sizeof(horizon_reloc_t));
+        program->len_relocs_space = len_relocs + 1;
+    }
+    for (int i = 0; i < len_relocs && !err; i++)
+    {
+        horizon_reloc_t *reloc = &program->relocs[i];
+        uint32_t offset, field, kind;
+        err |= fread_u32(fd, &offset) || fread_u32(fd, &field) || fread_u32(fd, &kind);
+        err |= fread_str(fd, &reloc->import);
+        reloc->offset = offset;
+        reloc->field = field;
+        reloc->kind = kind;
+        program->len_relocs++;
+    }
+
+    err |= fread_str(fd, &program->name);
+    err |= fread_str(fd, &program->desc);
+
+    // Included files, the entry is stale if any of them changed
+    uint32_t len_deps;
+    err |= fread_u32(fd, &len_deps);
+    for (int i = 0; i < len_deps && !err; i++)
+    {
+        char *dep_path = NULL;
+        uint32_t dep_len, dep_lo, dep_hi;
+        err |= fread_str(fd, &dep_path) || dep_path == NULL;
+        err |= fread_u32(fd, &dep_len);
+        err |= fread_u32(fd, &dep_lo) || fread_u32(fd, &dep_hi);
+        err |= err || ho_cache_dep_changed(dep_path, dep_len, (uint64_t) dep_hi << 32 | dep_lo);
+        free(dep_path);
+    }
+    if (err)
+        goto horizon_cache_load_invalid;
+
+    fclose(fd);
+
+    // Mark as recently used for eviction
+    utime(path, NULL);
+
+    return program;
+
+horizon_cache_load_invalid:
+    fclose(fd);
+    horizon_free(program);
+    return NULL;
+}
+
+struct ho_cache_entry {
+    char name[NAME_MAX + 1];
+    off_t size;
+    time_t mtime;
+};
+
+static int ho_cache_entry_cmp(const void *a, const void *b)
+{
+    const struct ho_cache_entry *ea = a, *eb = b;
+    return (ea->mtime > eb->mtime) - (ea->mtime < eb->mtime);
+}
+
+// Delete least recently used entries until the cache fits in max_size bytes
+static void ho_cache_evict(const char *dir, off_t max_size)
+{
+    DIR *d = opendir(dir);
+    if (d == NULL)
+        return;
+
+    int len_entries = 0;
+    int len_entries_space = 100;
+    struct ho_cache_entry *entries = malloc(sizeof(struct ho_cache_entry) * len_entries_space);
+    off_t total = 0;
+
+    struct dirent *ent;
+    char path[BUFSIZ] = { 0 };
+    while ((ent = readdir(d)) != NULL)
+    {
+        size_t len = strlen(ent->d_name);
+        size_t ext_len = strlen(HORIZON_CACHE_EXT);
+        if (len <= ext_len || strcmp(ent->d_name + len - ext_len, HORIZON_CACHE_EXT) != 0)
+            continue;
+
+        struct stat st;
+        snprintf(path, BUFSIZ, "%s/%s", dir, ent->d_name);
+        if (stat(path, &st) != 0)
+            continue;
+
+        if (len_entries >= len_entries_space)
+        {
+            len_entries_space += 100;
+            entries = realloc(entries, sizeof(struct ho_cache_entry) * len_entries_space);
+        }
+        strncpy(entries[len_entries].name, ent->d_name, NAME_MAX);
+        entries[len_entries].name[NAME_MAX] = 0;
+        entries[len_entries].size = st.st_size;
+        entries[len_entries].mtime = st.st_mtime;
+        len_entries++;
+        total += st.st_size;
+    }
+    closedir(d);
+
+    if (total > max_size)
+    {
+        qsort(entries, len_entries, sizeof(struct ho_cache_entry), ho_cache_entry_cmp);
+        for (int i = 0; i < len_entries && total > max_size; i++)
+        {
+            snprintf(path, BUFSIZ, "%s/%s", dir, entries[i].name);
+            if (unlink(path) == 0)
+                total -= entries[i].size;
+        }
+    }
+
+    free(entries);
+}
+
+// Store an error-free program under key. The file is written under a temporary
+// name and renamed into place, then the cache is trimmed to HORIZON_CACHE_MAX_SIZE.
+// Returns 0 on success, -1 otherwise
+int horizon_cache_store(uint64_t key, size_t src_len, horizon_program_t *program)
+{
+    if (program->error_count)
+        return -1;
+
+    char dir[BUFSIZ] = { 0 };
+    char path[BUFSIZ] = { 0 };
+    char tmp_path[BUFSIZ + 32] = { 0 };
+    if (horizon_cache_dir(dir, BUFSIZ) != 0 || ho_cache_path(path, BUFSIZ, key) != 0)
+        return -1;
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp.%ld", path, (long) getpid());
+
+    FILE *fd = fopen(tmp_path, "wb");
+    if (fd == NULL)
+        return -1;
+
+    fwrite(HORIZON_CACHE_MAGIC, 1, 4, fd);
+    fwrite_u32(fd, HORIZON_CACHE_VERSION);
+    fwrite_u32(fd, key & 0xFFFFFFFF);
+    fwrite_u32(fd, key >> 32);
+    fwrite_u32(fd, src_len);
+    fwrite_u32(fd, program->len_code);
+    fwrite_u32(fd, program->len_data);
+    fwrite_u32(fd, program->code_start);
+    fwrite_u32(fd, program->len_symbols);
+    fwrite_u32(fd, program->len_code_lines);
+
+    for (int i = 0; i < program->len_code; i++)
+        fwrite_u32(fd, program->code[i] & 0xFFFFFFFF);
+
+    for (int i = 0; i < program->len_symbols; i++)
+    {
+        fwrite_u32(fd, program->symbols[i].value);
+        fwrite_u32(fd, program->symbols[i].type);
+        fwrite_u32(fd, program->symbols[i].length);
+        fwrite_str(fd, program->symbols[i].name);
+    }
+
+    for (int i = 0; i < program->len_code_lines; i++)
+    {
+        fwrite_u32(fd, program->code_line_indices[i]);
+        fwrite_u32(fd, program->code_line_offsets[i]);
+    }
+
+    fwrite_u32(fd, program->len_relocs);
+    for (int i = 0; i < program->len_relocs; i++)
+    {
+        fwrite_u32(fd, program->relocs[i].offset);
+        fwrite_u32(fd, program->relocs[i].field);
+        fwrite_u32(fd, program->relocs[i].kind);
+        fwrite_str(fd, program->relocs[i].import);
+    }
+
+    fwrite_str(fd, program->name);
+    fwrite_str(fd, program->desc);
+
+    // The main file is the first module, the rest are included files
+    fwrite_u32(fd, (program->len_modules > 1) ? program->len_modules - 1 : 0);
+    for (int i = 1; i < program->len_modules; i++)
+    {
+        horizon_module_t *module = &program->modules[i];
+        uint64_t hash = horizon_cache_key(module->buf, module->len, NULL);
+        fwrite_str(fd, module->path);
+        fwrite_u32(fd, module->len);
+        fwrite_u32(fd, hash & 0xFFFFFFFF);
+        fwrite_u32(fd, hash >> 32);
+    }
+
+    int err = ferror(fd);
+    err |= fclose(fd);
+    if (err || rename(tmp_path, path) != 0)
+    {
+        unlink(tmp_path);
+        return -1;
+    }
+
+    ho_cache_evict(dir, HORIZON_CACHE_MAX_SIZE);
+    return 0;
+}
+
+// Read and parse a program, going through the cache unless use_cache is 0
+// Behaves like horizon_parse, options is the string of compiler options that
+// affect the output and is part of the key.
+horizon_program_t *horizon_parse_cached(FILE *fd, const char *options, int use_cache)
+{
+    int size = 0;
+    int mapped = 0;
+    char *program_buf = horizon_read_source(fd, &size, &mapped);
+    if (!use_cache)
+        return horizon_parse_buffer(program_buf, size, mapped, NULL, 0);
+
+    // Besides the options, the result depends on what .include resolves to: the
+    // location of the main file and the include search path
+    char key_options[BUFSIZ] = { 0 };
+    int len = snprintf(key_options, BUFSIZ, "%s\n%s", options, (horizon_source_path()) ? horizon_source_path() : "");
+    for (int i = 0; horizon_include_dir(i) && len < BUFSIZ; i++)
+        len += snprintf(key_options + len, BUFSIZ - len, "\n-I%s", horizon_include_dir(i));
+
+    uint64_t key = horizon_cache_key(program_buf, size, key_options);
+    horizon_program_t *program = horizon_cache_load(key, size);
+    if (program)
+    {
+        horizon_free_source(program_buf, size, mapped);
+        return program;
+    }
+
+    program = horizon_parse_buffer(program_buf, size, mapped, NULL, 0);
+    if (program->error_count == 0)
+        horizon_cache_store(key, size, program);
+
+    return program;
+}
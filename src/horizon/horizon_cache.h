@@ -0,0 +1,43 @@
+#ifndef HORIZON_CACHE_H
+#define HORIZON_CACHE_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "horizon_parser.h"
+
+// Version of the assembly language accepted by the parser, see doc/asm.md
+#define HORIZON_ASM_VERSION         "2"
+// Version of the cache file layout, bump when it changes
+#define HORIZON_CACHE_VERSION       3
+#define HORIZON_CACHE_MAGIC         "FCHC"
+#define HORIZON_CACHE_EXT           ".hoc"
+// Total size of all cache files after which the least recently used are deleted
+#define HORIZON_CACHE_MAX_SIZE      (64 * 1024 * 1024)
+
+// Hash a program source together with everything else that changes its output:
+// the assembler version and build, and the options it is compiled with
+uint64_t horizon_cache_key(const char *src, size_t len, const char *options);
+
+// Set dest to the cache directory and create it if needed:
+// $FC_CACHE_DIR, $XDG_CACHE_HOME/fc-tools or $HOME/.cache/fc-tools
+// Returns 0 on success, -1 if there is no usable directory
+int horizon_cache_dir(char *dest, size_t size);
+
+// Load the program stored under key
+// Returns a newly allocated horizon_program_t to be freed with horizon_free,
+// or NULL if there is no valid entry. Cached programs carry no source text, so
+// their code_lines are NULL and they have no modules.
+horizon_program_t *horizon_cache_load(uint64_t key, size_t src_len);
+
+// Store an error-free program under key. The file is written under a temporary
+// name and renamed into place, then the cache is trimmed to HORIZON_CACHE_MAX_SIZE.
+// Returns 0 on success, -1 otherwise
+int horizon_cache_store(uint64_t key, size_t src_len, horizon_program_t *program);
+
+// Read and parse a program, going through the cache unless use_cache is 0
+// Behaves like horizon_parse, options is the string of compiler options that
+// affect the output and is part of the key.
+horizon_program_t *horizon_parse_cached(FILE *fd, const char *options, int use_cache);
+
+#endif // HORIZON_CACHE_H
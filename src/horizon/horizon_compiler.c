@@ -1,12 +1,378 @@
-#include <ctype.h>
+#include <limits.h>
+#include <pthread.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "horizon_compiler.h"
+#include "horizon_optimizer.h"
 #include "horizon_parser.h"
 #include "../fcerrors.h"
 
+// A contiguous range of code lines encoded by one thread in the second pass
+struct ho_encode_chunk {
+    horizon_program_t program;  // private copy, only code, relocs and the scratch arguments are written
+    int first_line;
+    int end_line;
+    int *results;               // shared, one slot per code line
+};
+
+static void *ho_encode_worker(void *arg)
+{
+    struct ho_encode_chunk *chunk = arg;
+
+    for (int i = chunk->first_line; i < chunk->end_line; i++)
+    {
+        chunk->program.curr_code_line = i;
+        chunk->results[i] = ho_parse_instruction(&chunk->program, chunk->program.code_lines[i]);
+    }
+
+    return NULL;
+}
+
+// Second parsing pass: encode every code line into program->code.
+// Once the first pass is done the symbol and macro tables are only read, so the
+// code lines are split into chunks which are encoded by separate threads into
+// private buffers. The buffers are then appended in order, and errors reported
+// in line order, so the result is the same as encoding the lines one by one.
+static void ho_encode_code_lines(horizon_program_t *program)
+{
+    int len_lines = program->len_code_lines;
+    if (len_lines == 0)
+        return;
+
+    int nthreads = sysconf(_SC_NPROCESSORS_ONLN);
+    if (nthreads > len_lines / HORIZON_MIN_LINES_PER_THREAD)
+        nthreads = len_lines / HORIZON_MIN_LINES_PER_THREAD;
+    if (nthreads > HORIZON_MAX_THREADS)
+        nthreads = HORIZON_MAX_THREADS;
+    if (nthreads < 1)
+        nthreads = 1;
+
+    // The number of words each line produces is known from the first pass
+    int len_words = len_lines + program->len_extra_macro_code;
+    if (program->len_code + len_words > program->len_code_space)
+    {
+        program->len_code_space = program->len_code + len_words;
+        program->code = realloc(program->code, sizeof(int64_t) * program->len_code_space);
+    }
+
+    int *results = malloc(sizeof(int) * len_lines);
+    struct ho_encode_chunk chunks[HORIZON_MAX_THREADS];
+    pthread_t threads[HORIZON_MAX_THREADS];
+    int spawned[HORIZON_MAX_THREADS] = { 0 };
+
+    if (nthreads == 1)
+    {
+        for (int i = 0; i < len_lines; i++)
+        {
+            program->curr_code_line = i;
+            results[i] = ho_parse_instruction(program, program->code_lines[i]);
+        }
+    }
+    else
+    {
+        // The regex used by the matchers are initialized lazily. By now every one of
+        // them has been used by the first pass and the start instruction, so the
+        // workers only ever read shared state.
+        for (int t = 0; t < nthreads; t++)
+        {
+            struct ho_encode_chunk *chunk = &chunks[t];
+            chunk->first_line = (int64_t) len_lines * t / nthreads;
+            chunk->end_line = (int64_t) len_lines * (t + 1) / nthreads;
+            chunk->results = results;
+
+            int end_offset = (chunk->end_line < len_lines) ? program->code_line_offsets[chunk->end_line] : len_words;
+            chunk->program = *program;
+            chunk->program.len_code = 0;
+            chunk->program.len_code_space = end_offset - program->code_line_offsets[chunk->first_line];
+            chunk->program.code = malloc(sizeof(int64_t) * chunk->program.len_code_space);
+            chunk->program.len_relocs = 0;
+            chunk->program.len_relocs_space = 0;
+            chunk->program.relocs = NULL;
+
+            spawned[t] = (pthread_create(&threads[t], NULL, ho_encode_worker, chunk) == 0);
+            // Could not spawn, do this chunk on the calling thread instead
+            if (!spawned[t])
+                ho_encode_worker(chunk);
+        }
+
+        for (int t = 0; t < nthreads; t++)
+        {
+            struct ho_encode_chunk *chunk = &chunks[t];
+            if (spawned[t])
+                pthread_join(threads[t], NULL);
+
+            // On errors a chunk might not have produced the expected number of words
+            if (program->len_code + chunk->program.len_code > program->len_code_space)
+            {
+                program->len_code_space = program->len_code + chunk->program.len_code;
+                program->code = realloc(program->code, sizeof(int64_t) * program->len_code_space);
+            }
+            memcpy(program->code + program->len_code, chunk->program.code, sizeof(int64_t) * chunk->program.len_code);
+
+            // Relocation offsets are relative to the chunk
+            for (int i = 0; i < chunk->program.len_relocs; i++)
+            {
+                if (program->len_relocs >= program->len_relocs_space)
+                {
+                    program->len_relocs_space += chunk->program.len_relocs;
+                    program->relocs = realloc(program->relocs, sizeof(horizon_reloc_t) * program->len_relocs_space);
+                }
+                program->relocs[program->len_relocs] = chunk->program.relocs[i];
+                program->relocs[program->len_relocs++].offset += program->len_code;
+            }
+
+            program->len_code += chunk->program.len_code;
+            free(chunk->program.code);
+            free(chunk->program.relocs);
+        }
+    }
+
+    for (int i = 0; i < len_lines; i++)
+    {
+        if (!(results[i] == NO_ERR || results[i] == ERR_EOF))
+        {
+            int module = program->code_line_modules[i];
+            ho_parser_perror(NULL, results[i], (module > 0) ? program->modules[module].path : NULL, program->code_line_indices[i]);
+            program->error_count++;
+        }
+    }
+    free(results);
+}
+
+// Search path for .include, see horizon_add_include_dir
+static char **ho_include_dirs = NULL;
+static int ho_len_include_dirs = 0;
+// Resolved path of the main file, see horizon_set_source_path
+static char *ho_source_path = NULL;
+// See horizon_set_relocatable
+static int ho_relocatable = 0;
+
+// First parsing pass over one module: build the symbol and macro tables and
+// collect the code lines. Included modules are parsed recursively.
+static void ho_parse_module(horizon_program_t *program, int module)
+{
+    char *buf = program->modules[module].buf;
+    // Only name the file in errors if it is not the main file
+    const char *path = (module > 0) ? program->modules[module].path : NULL;
+    int prev_module = program->curr_module;
+    int retval = NO_ERR;
+
+    program->curr_module = module;
+    program->modules[module].parsing = 1;
+
+    int line = 1;
+    while (retval != ERR_EOF)
+    {
+        // This will consume whitespace even without newlines
+        while (!(retval = ho_match_newline(&buf)))
+            line++;
+        if (retval == ERR_EOF)
+            break;
+
+        int lines_consumed = 0;
+        program->curr_line = line;
+        retval = ho_parse_statement(program, &lines_consumed, &buf);
+        if (retval != NO_ERR)
+        {
+            program->error_count++;
+            ho_parser_perror(NULL, retval, path, line);
+            retval = ho_match_error(&buf);
+        } else
+        {
+            // successfully parsed lines should end here
+            retval = ho_match_newline(&buf);
+            if (retval == ERR_NO_MATCH)
+            {
+                program->error_count++;
+                ho_parser_perror(NULL, ERR_TOO_MANY_ARGUMENTS, path, line);
+                retval = ho_match_error(&buf);
+            }
+        }
+
+        line += lines_consumed;
+        line++;
+    }
+
+    // Modules are added, never removed, so the index is still valid
+    program->modules[module].parsing = 0;
+    program->curr_module = prev_module;
+}
+
+// Find an included file and return its resolved path in a malloced string, or NULL
+// Relative names are looked up next to the including file, or the working directory
+// if its path is not known, and then in each include directory in order.
+static char *ho_find_include(const char *name, const char *from)
+{
+    char path[PATH_MAX] = { 0 };
+    char *resolved;
+
+    if (name[0] == '/')
+        return realpath(name, NULL);
+
+    if (from)
+    {
+        const char *slash = strrchr(from, '/');
+        snprintf(path, PATH_MAX, "%.*s/%s", (int) (slash - from), from, name);
+    }
+    else
+        snprintf(path, PATH_MAX, "%s", name);
+    if ((resolved = realpath(path, NULL)) != NULL)
+        return resolved;
+
+    for (int i = 0; i < ho_len_include_dirs; i++)
+    {
+        snprintf(path, PATH_MAX, "%s/%s", ho_include_dirs[i], name);
+        if ((resolved = realpath(path, NULL)) != NULL)
+            return resolved;
+    }
+
+    return NULL;
+}
+
+// Parse the file included by the .include directive at the current position
+// A file is only parsed the first time it is included, after that the macros,
+// constants and labels it defined are simply shared with every file including it.
+// Errors inside the included file are reported and counted there.
+int horizon_include(horizon_program_t *program, const char *name)
+{
+    char *path = ho_find_include(name, program->modules[program->curr_module].path);
+    if (path == NULL)
+        return ERR_INCLUDE_NOT_FOUND;
+
+    for (int i = 0; i < program->len_modules; i++)
+    {
+        if (program->modules[i].path && strcmp(program->modules[i].path, path) == 0)
+        {
+            free(path);
+            return (program->modules[i].parsing) ? ERR_INCLUDE_CYCLE : NO_ERR;
+        }
+    }
+
+    FILE *fd = fopen(path, "r");
+    if (fd == NULL)
+    {
+        free(path);
+        return ERR_INCLUDE_NOT_FOUND;
+    }
+
+    if (program->len_modules >= program->len_modules_space)
+    {
+        program->len_modules_space += 100;
+        program->modules = realloc(program->modules, sizeof(horizon_module_t) * program->len_modules_space);
+    }
+    horizon_module_t *module = &program->modules[program->len_modules];
+    memset(module, 0, sizeof(horizon_module_t));
+    module->path = path;
+    module->buf = horizon_read_source(fd, &module->len, &module->mapped);
+    fclose(fd);
+
+    int curr_line = program->curr_line;
+    ho_parse_module(program, program->len_modules++);
+    program->curr_line = curr_line;
+
+    return NO_ERR;
+}
+
+// Add a directory to the search path of .include
+// Directories that don't exist are ignored
+void horizon_add_include_dir(const char *dir)
+{
+    char *resolved = realpath(dir, NULL);
+    if (resolved == NULL)
+        return;
+
+    ho_include_dirs = realloc(ho_include_dirs, sizeof(char *) * (ho_len_include_dirs + 1));
+    ho_include_dirs[ho_len_include_dirs++] = resolved;
+}
+
+// Return the ith include directory, or NULL if there are fewer
+const char *horizon_include_dir(int i)
+{
+    return (i >= 0 && i < ho_len_include_dirs) ? ho_include_dirs[i] : NULL;
+}
+
+// Set the path of the main file parsed next, so files it includes can be found
+// relative to it and it can't be included by them. NULL if read from a stream.
+void horizon_set_source_path(const char *path)
+{
+    free(ho_source_path);
+    ho_source_path = (path) ? realpath(path, NULL) : NULL;
+}
+
+// Parse the next programs for an object file: symbols which are not defined are
+// imported, to be resolved by the linker
+void horizon_set_relocatable(int relocatable)
+{
+    ho_relocatable = relocatable;
+}
+
+// Return the resolved path of the main file, or NULL if it is not known
+const char *horizon_source_path()
+{
+    return ho_source_path;
+}
+
+// Read a whole program source into a null-terminated buffer
+// Regular files are mapped into memory instead of copied, anything else (pipes,
+// terminals) is read in chunks until EOF. Sets len to the number of bytes read and
+// mapped to 1 if the buffer is mmapped. Release it with horizon_free_source.
+char *horizon_read_source(FILE *fd, int *len, int *mapped)
+{
+    struct stat st;
+    long pagesize = sysconf(_SC_PAGESIZE);
+    char *program_buf;
+
+    *mapped = 0;
+
+    // The rest of the last page of a mapping is zero-filled, which null-terminates
+    // the buffer, unless the file ends exactly on a page boundary
+    if (fstat(fileno(fd), &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0 &&
+        st.st_size < INT_MAX && st.st_size % pagesize != 0)
+    {
+        program_buf = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fileno(fd), 0);
+        if (program_buf != MAP_FAILED)
+        {
+            madvise(program_buf, st.st_size, MADV_SEQUENTIAL);
+            *len = st.st_size;
+            *mapped = 1;
+            return program_buf;
+        }
+    }
+
+    int size = 0;
+    int space = HORIZON_READ_CHUNK;
+    program_buf = malloc(space + 1);
+
+    size_t read;
+    while ((read = fread(program_buf + size, 1, space - size, fd)) > 0)
+    {
+        size += read;
+        if (size == space)
+        {
+            space *= 2;
+            program_buf = realloc(program_buf, space + 1);
+        }
+    }
+    program_buf[size] = 0;
+
+    *len = size;
+    return program_buf;
+}
+
+// Release a buffer returned by horizon_read_source
+void horizon_free_source(char *program_buf, int len, int mapped)
+{
+    if (mapped)
+        munmap(program_buf, len);
+    else
+        free(program_buf);
+}
+
 // Parse program to build the symbol table and check for errors
 // Returns the pointer to a newly allocated horizon_program_t
 // If there are any errors, they will be added to the err_array, as many as
@@ -15,31 +381,22 @@
 // allocated memory, regardless of if the program was error-free or not.
 horizon_program_t *horizon_parse(FILE *fd, error_t *err_array, int err_array_size)
 {
-    fseek(fd, 0, SEEK_END);
-    int size = ftell(fd);
-    rewind(fd);
+    int size = 0;
+    int mapped = 0;
+    char *program_buf = horizon_read_source(fd, &size, &mapped);
+    return horizon_parse_buffer(program_buf, size, mapped, err_array, err_array_size);
+}
 
+// Same as horizon_parse, but for a program already in memory
+// program_buf must be null-terminated and is only read, the returned program takes
+// ownership of it. mapped is as set by horizon_read_source, or 0 if it is malloced.
+horizon_program_t *horizon_parse_buffer(char *program_buf, int size, int mapped, error_t *err_array, int err_array_size)
+{
     horizon_program_t program = { ARCH_HORIZON };
-    char *program_buf = malloc(size + 1);
-    memset(program_buf, 0, size + 1);
 
     program.input_buf = program_buf;
-
-    // Read whole program in
-    program.len_input = 0;
-    fread(program_buf, 1, size, fd);
-
-    // Don't uppercase comments
-    int uppercase = 1;
-    for (int i = 0; i < size; i++)
-    {
-        if (program_buf[i] == ';')
-            uppercase = 0;
-        else if (program_buf[i] == '\n')
-            uppercase = 1;
-        if (uppercase)
-            program_buf[i] = toupper(program_buf[i]);
-    }
+    program.len_input = size;
+    program.input_mapped = mapped;
 
     // Allocate the needed program space
     int symbol_space = 100;
@@ -54,6 +411,8 @@ horizon_program_t *horizon_parse(FILE *fd, error_t *err_array, int err_array_siz
     program.code_lines = malloc(sizeof(char *) * code_lines_space);
     program.len_code_lines_space = code_lines_space;
     program.code_line_indices = malloc(sizeof(int) * code_lines_space);
+    program.code_line_offsets = malloc(sizeof(int) * code_lines_space);
+    program.code_line_modules = malloc(sizeof(int) * code_lines_space);
 
     int code_space = 100;
     program.code = malloc(sizeof(int64_t) * code_space);
@@ -63,48 +422,27 @@ horizon_program_t *horizon_parse(FILE *fd, error_t *err_array, int err_array_siz
     program.macros = malloc(sizeof(horizon_macro_t) * macro_space);
     program.len_macros_space = macro_space;
 
+    int module_space = 100;
+    program.modules = malloc(sizeof(horizon_module_t) * module_space);
+    program.len_modules_space = module_space;
+
     // Account for the initial start instruction
     program.data_offset = 1;
+    program.relocatable = ho_relocatable;
 
     program.name = NULL;
     program.desc = NULL;
 
-    int retval = NO_ERR;
+    // The main file is the first module
+    program.modules[0].path = (ho_source_path) ? strdup(ho_source_path) : NULL;
+    program.modules[0].buf = program_buf;
+    program.modules[0].len = size;
+    program.modules[0].mapped = mapped;
+    program.len_modules = 1;
 
     ho_add_builtin_macros(&program);
 
-    int line = 1;
-    while (retval != ERR_EOF)
-    {
-        // This will consume whitespace even without newlines
-        while (!(retval = ho_match_newline(&program_buf)))
-            line++;
-        if (retval == ERR_EOF)
-            break;
-
-        int lines_consumed = 0;
-        program.curr_line = line;
-        retval = ho_parse_statement(&program, &lines_consumed, &program_buf);
-        if (retval != NO_ERR)
-        {
-            program.error_count++;
-            ho_parser_perror(NULL, retval, line);
-            retval = ho_match_error(&program_buf);
-        } else
-        {
-            // successfully parsed lines should end here
-            retval = ho_match_newline(&program_buf);
-            if (retval == ERR_NO_MATCH)
-            {
-                program.error_count++;
-                ho_parser_perror(NULL, ERR_TOO_MANY_ARGUMENTS, line);
-                retval = ho_match_error(&program_buf);
-            }
-        }
-
-        line += lines_consumed;
-        line++;
-    }
+    ho_parse_module(&program, 0);
 
     // printf("Instructions:\n");
     char jmp_start_instr[HORIZON_IDENT_MAX_LEN + 1] = { 0 };
@@ -119,15 +457,12 @@ horizon_program_t *horizon_parse(FILE *fd, error_t *err_array, int err_array_siz
         program.code[program.len_code] = program.data[i];
         program.len_code++;
     }
-    for (int i = 0; i < program.len_code_lines; i++)
-    {
-        int res = ho_parse_instruction(&program, program.code_lines[i]);
-        if (!(res == NO_ERR || res == ERR_EOF))
-        {
-            ho_parser_perror(NULL, res, program.code_line_indices[i]);
-            program.error_count++;
-        }
-    }
+    ho_encode_code_lines(&program);
+
+    if (!program.error_count && program.len_unrolls)
+        horizon_unroll_loops(&program);
+    if (!program.error_count)
+        horizon_allocate_registers(&program);
 
     // Debug: output program binary
     if (DEBUG)
@@ -151,7 +486,7 @@ void horizon_free(horizon_program_t *program)
     if (!program)
         return;
     if (program->input_buf)
-        free(program->input_buf);
+        horizon_free_source(program->input_buf, program->len_input, program->input_mapped);
     if (program->len_symbols)
     {
         for (int i = 0; i < program->len_symbols; i++)
@@ -165,6 +500,29 @@ void horizon_free(horizon_program_t *program)
         free(program->code_lines);
     if (program->code_line_indices)
         free(program->code_line_indices);
+    if (program->code_line_offsets)
+        free(program->code_line_offsets);
+    if (program->code_line_modules)
+        free(program->code_line_modules);
+    for (int i = 0; i < program->len_modules; i++)
+    {
+        free(program->modules[i].path);
+        // The main file's buffer is input_buf
+        if (i > 0)
+            horizon_free_source(program->modules[i].buf, program->modules[i].len, program->modules[i].mapped);
+    }
+    if (program->modules)
+        free(program->modules);
+    for (int i = 0; i < program->len_relocs; i++)
+        free(program->relocs[i].import);
+    if (program->relocs)
+        free(program->relocs);
+    for (int i = 0; i < program->len_globals; i++)
+        free(program->globals[i]);
+    if (program->globals)
+        free(program->globals);
+    if (program->unrolls)
+        free(program->unrolls);
     if (program->name)
         free(program->name);
     if (program->desc)
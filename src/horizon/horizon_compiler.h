@@ -6,6 +6,12 @@
 #include "../program.h"
 #include "horizon_parser.h"
 
+// Code lines per thread below which the second pass is not split up
+#define HORIZON_MIN_LINES_PER_THREAD    512
+#define HORIZON_MAX_THREADS             64
+// Initial buffer size when reading sources that can't be mapped, doubled as needed
+#define HORIZON_READ_CHUNK              (64 * 1024)
+
 // raw_output: outputs only binary (uint32 instructions) instead of BP strings
 struct horizon_compiler_opt {
     uint8_t raw_output;
@@ -19,6 +25,43 @@ struct horizon_compiler_opt {
 // allocated memory, regardless of if the program was error-free or not.
 horizon_program_t *horizon_parse(FILE *program_fd, error_t *err_array, int err_array_size);
 
+// Same as horizon_parse, but for a program already in memory
+// program_buf must be null-terminated and is only read, the returned program takes
+// ownership of it. mapped is as set by horizon_read_source, or 0 if it is malloced.
+horizon_program_t *horizon_parse_buffer(char *program_buf, int size, int mapped, error_t *err_array, int err_array_size);
+
+// Read a whole program source into a null-terminated buffer
+// Regular files are mapped into memory instead of copied, anything else (pipes,
+// terminals) is read in chunks until EOF. Sets len to the number of bytes read and
+// mapped to 1 if the buffer is mmapped. Release it with horizon_free_source.
+char *horizon_read_source(FILE *fd, int *len, int *mapped);
+
+// Release a buffer returned by horizon_read_source
+void horizon_free_source(char *program_buf, int len, int mapped);
+
+// Parse the file included by the .include directive at the current position
+// A file is only parsed the first time it is included, after that the macros,
+// constants and labels it defined are simply shared with every file including it.
+int horizon_include(horizon_program_t *program, const char *name);
+
+// Add a directory to the search path of .include
+// Directories that don't exist are ignored
+void horizon_add_include_dir(const char *dir);
+
+// Return the ith include directory, or NULL if there are fewer
+const char *horizon_include_dir(int i);
+
+// Set the path of the main file parsed next, so files it includes can be found
+// relative to it and it can't be included by them. NULL if read from a stream.
+void horizon_set_source_path(const char *path);
+
+// Parse the next programs for an object file: symbols which are not defined are
+// imported, to be resolved by the linker
+void horizon_set_relocatable(int relocatable);
+
+// Return the resolved path of the main file, or NULL if it is not known
+const char *horizon_source_path();
+
 // Frees memory allocated by horizon_parse
 void horizon_free(horizon_program_t *program);
 
@@ -0,0 +1,2177 @@
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "horizon_compiler.h"
+#include "horizon_hl.h"
+#include "horizon_parser.h"
+
+// Compiler for the structured language, see doc/hl.md
+// Each function is parsed into a list of instructions on an unlimited number of
+// virtual registers, with expressions built as trees first so constants can be folded
+// and conditions compiled to jumps. The virtual registers are then assigned R0 to R11
+// by linear scan over their live ranges, and the function is written out as assembly.
+// Globals and functions are prefixed with '_' in the assembly, so they can't clash
+// with registers, instructions or the generated labels L<n> and spill slots S<n>.
+
+// Tokens longer than one character, the others are their character
+enum {
+    HO_HL_TOK_EOF = 256,
+    HO_HL_TOK_NUM,
+    HO_HL_TOK_IDENT,
+    HO_HL_TOK_EQ,
+    HO_HL_TOK_NE,
+    HO_HL_TOK_LE,
+    HO_HL_TOK_GE,
+    HO_HL_TOK_SHL,
+    HO_HL_TOK_SHR,
+    HO_HL_TOK_LAND,
+    HO_HL_TOK_LOR,
+    HO_HL_TOK_INC,
+    HO_HL_TOK_DEC,
+    HO_HL_TOK_OP_ASSIGN,    // value is the operator, e.g. '+' for +=
+};
+
+typedef struct {
+    int type;
+    int line;
+    int32_t value;
+    char ident[HORIZON_IDENT_MAX_LEN + 1];
+} ho_hl_token_t;
+
+// Kinds of global names
+enum {
+    HO_HL_CONST,
+    HO_HL_VAR,
+    HO_HL_ARRAY,
+    HO_HL_FUNC,
+};
+
+typedef struct {
+    char name[HORIZON_IDENT_MAX_LEN + 1];
+    int kind;
+    int32_t value;          // constant value, array length or number of parameters
+    int defined;            // functions can be called before they are defined
+    int line;               // first call of a function which is not defined yet
+} ho_hl_global_t;
+
+// Kinds of expression tree nodes
+enum {
+    HO_HL_NUM,
+    HO_HL_LOCAL,
+    HO_HL_GLOBAL,
+    HO_HL_INDEX,
+    HO_HL_CALL,
+    HO_HL_UNARY,
+    HO_HL_BINARY,
+    HO_HL_ASSIGN,
+};
+
+typedef struct ho_hl_node {
+    int kind;
+    int op;                 // operator token of UNARY and BINARY
+    int32_t value;          // NUM
+    int vreg;               // LOCAL
+    int global;             // GLOBAL, CALL
+    int line;
+    struct ho_hl_node *left, *right;    // INDEX base and index, ASSIGN target and value
+    struct ho_hl_node **args;
+    int argc;
+} ho_hl_node_t;
+
+// Instructions on virtual registers
+enum {
+    HO_HL_I_CONST,          // dst = imm
+    HO_HL_I_MOV,            // dst = a
+    HO_HL_I_ALU,            // dst = a alu b, or a alu imm
+    HO_HL_I_NOT,            // dst = ~a
+    HO_HL_I_ADDR,           // dst = address of sym + imm
+    HO_HL_I_LOAD,           // dst = memory at sym + a + imm, sym and a are optional
+    HO_HL_I_STORE,          // memory at sym + a + imm = b, or imm_value
+    HO_HL_I_PARAM,          // dst = next argument from the stack
+    HO_HL_I_ENTER,          // end of the parameters
+    HO_HL_I_CALL,           // dst = sym(args), dst is optional
+    HO_HL_I_RET,            // return a, a is optional
+    HO_HL_I_BR,             // if (a cond b or imm) jump to label
+    HO_HL_I_JMP,
+    HO_HL_I_LABEL,
+};
+
+// Virtual register standing for NIL, reading 0
+#define HO_HL_NIL   -2
+
+typedef struct {
+    int op;
+    int alu;                // ALU mnemonic index, or the comparison token of BR
+    int dst, a, b;          // virtual registers, -1 if not used
+    int imm_arg;            // ALU and BR use imm instead of b, STORE stores imm_value
+    int32_t imm;
+    int32_t imm_value;
+    int sym;                // global, -1 if not used
+    int label;
+    int *args;              // CALL arguments, virtual registers or -1 for constants
+    int32_t *arg_values;
+    int argc;
+    int removed;
+} ho_hl_instr_t;
+
+typedef struct {
+    char name[HORIZON_IDENT_MAX_LEN + 1];
+    int vreg;
+} ho_hl_local_t;
+
+typedef struct {
+    int is_var;             // holds a local variable, temporaries are only read once
+    int start, end;         // live range over instruction indices, end -1 if never live
+    int reg;                // physical register, -1 if spilled
+    int slot;               // spill slot S<n>, -1 if none
+    int hint;               // virtual register whose register is preferred, -1 if none
+    int hint_reg;           // physical register preferred, -1 if none
+} ho_hl_vreg_t;
+
+typedef struct {
+    int global;
+    ho_hl_local_t *locals;
+    int len_locals, len_locals_space;
+    int scope;              // first local of the innermost block
+    ho_hl_instr_t *instrs;
+    int len_instrs, len_instrs_space;
+    ho_hl_vreg_t *vregs;
+    int len_vregs, len_vregs_space;
+    int calls;              // calls other functions, so LR is saved on the stack
+    int loop_break[HORIZON_HL_MAX_LOOP_DEPTH];
+    int loop_continue[HORIZON_HL_MAX_LOOP_DEPTH];
+    int loop_depth;
+} ho_hl_func_t;
+
+typedef struct {
+    char *s;
+    int len, space;
+} ho_hl_text_t;
+
+typedef struct {
+    const char *p;
+    int line;
+    const char *path;
+    ho_hl_token_t tok;
+    int prev;               // type of the token before tok
+    int error_count;
+    int panic;              // an error was reported in the current statement
+    ho_hl_global_t *globals;
+    int len_globals, len_globals_space;
+    ho_hl_node_t **nodes;   // every node of the current declaration, to free them
+    int len_nodes, len_nodes_space;
+    ho_hl_func_t *fn;       // function being compiled, NULL outside of functions
+    int next_label;
+    int next_slot;
+    ho_hl_text_t data;
+    ho_hl_text_t code;
+} ho_hl_t;
+
+typedef struct {
+    int is_const;
+    int32_t value;
+    int vreg;
+} ho_hl_operand_t;
+
+static const char *ho_hl_keywords[] = {
+    "const", "var", "array", "func", "if", "else", "while", "for", "break", "continue", "return", NULL
+};
+
+static const char *ho_hl_alu_names[] = { "add", "sub", "mul", "div", "mod", "and", "or", "xor", "lsh", "rsh" };
+enum { HO_HL_ADD, HO_HL_SUB, HO_HL_MUL, HO_HL_DIV, HO_HL_MOD, HO_HL_AND, HO_HL_OR, HO_HL_XOR, HO_HL_LSH, HO_HL_RSH };
+
+static const char *ho_hl_reg_names[HORIZON_HL_REGISTERS] = {
+    "r0", "r1", "r2", "r3", "r4", "r5", "r6", "r7", "r8", "r9", "r10", "r11"
+};
+
+static void ho_hl_error(ho_hl_t *hl, int line, const char *fmt, ...)
+{
+    if (hl->panic)
+        return;
+    hl->panic = 1;
+    hl->error_count++;
+
+    if (hl->path)
+        printf("Error on line %d of %s: ", line, hl->path);
+    else
+        printf("Error on line %d: ", line);
+    va_list ap;
+    va_start(ap, fmt);
+    vprintf(fmt, ap);
+    va_end(ap);
+    putchar('\n');
+}
+
+static void ho_hl_emit(ho_hl_text_t *text, const char *fmt, ...)
+{
+    va_list ap;
+    va_start(ap, fmt);
+    int len = vsnprintf(NULL, 0, fmt, ap);
+    va_end(ap);
+
+    if (text->len + len + 1 > text->space)
+    {
+        text->space = (text->len + len + 1) * 2;
+        text->s = realloc(text->s, text->space);
+    }
+    va_start(ap, fmt);
+    vsnprintf(text->s + text->len, len + 1, fmt, ap);
+    va_end(ap);
+    text->len += len;
+}
+
+// Lexer
+
+static void ho_hl_next(ho_hl_t *hl)
+{
+    const char *p = hl->p;
+    ho_hl_token_t *tok = &hl->tok;
+
+    hl->prev = tok->type;
+    while (1)
+    {
+        if (*p == '\n')
+        {
+            hl->line++;
+            p++;
+        }
+        else if (isspace((unsigned char) *p))
+            p++;
+        else if (p[0] == '/' && p[1] == '/')
+        {
+            while (*p && *p != '\n')
+                p++;
+        }
+        else
+            break;
+    }
+
+    tok->line = hl->line;
+    tok->value = 0;
+    tok->ident[0] = 0;
+
+    if (*p == '\0')
+        tok->type = HO_HL_TOK_EOF;
+    else if (isdigit((unsigned char) *p))
+    {
+        char *end = NULL;
+        long long value = strtoll(p, &end, 0);
+        tok->type = HO_HL_TOK_NUM;
+        // Like in the assembly, numbers up to 2^32 - 1 are accepted and wrap around
+        if (value > UINT32_MAX)
+            ho_hl_error(hl, hl->line, "number out of range (greater than %u)", UINT32_MAX);
+        if (isalnum((unsigned char) *end) || *end == '_')
+            ho_hl_error(hl, hl->line, "invalid number");
+        while (isalnum((unsigned char) *end) || *end == '_')
+            end++;
+        tok->value = (int32_t) (uint32_t) value;
+        p = end;
+    }
+    else if (isalpha((unsigned char) *p) || *p == '_')
+    {
+        int len = 0;
+        while (isalnum((unsigned char) p[len]) || p[len] == '_')
+            len++;
+        // One character is taken by the prefix in the assembly
+        if (len > HORIZON_IDENT_MAX_LEN - 1)
+        {
+            ho_hl_error(hl, hl->line, "name longer than %d characters", HORIZON_IDENT_MAX_LEN - 1);
+            len = HORIZON_IDENT_MAX_LEN - 1;
+        }
+        memcpy(tok->ident, p, len);
+        tok->ident[len] = 0;
+        tok->type = HO_HL_TOK_IDENT;
+        while (isalnum((unsigned char) *p) || *p == '_')
+            p++;
+    }
+    else if ((p[0] == '<' || p[0] == '>') && p[1] == p[0] && p[2] == '=')
+    {
+        tok->type = HO_HL_TOK_OP_ASSIGN;
+        tok->value = (p[0] == '<') ? HO_HL_TOK_SHL : HO_HL_TOK_SHR;
+        p += 3;
+    }
+    else if (strchr("+-*/%&|^", p[0]) && p[1] == '=')
+    {
+        tok->type = HO_HL_TOK_OP_ASSIGN;
+        tok->value = p[0];
+        p += 2;
+    }
+    else
+    {
+        static const struct { const char *str; int type; } pairs[] = {
+            { "==", HO_HL_TOK_EQ }, { "!=", HO_HL_TOK_NE }, { "<=", HO_HL_TOK_LE }, { ">=", HO_HL_TOK_GE },
+            { "<<", HO_HL_TOK_SHL }, { ">>", HO_HL_TOK_SHR }, { "&&", HO_HL_TOK_LAND }, { "||", HO_HL_TOK_LOR },
+            { "++", HO_HL_TOK_INC }, { "--", HO_HL_TOK_DEC },
+        };
+        tok->type = 0;
+        for (int i = 0; i < sizeof(pairs) / sizeof(pairs[0]) && !tok->type; i++)
+        {
+            if (p[0] == pairs[i].str[0] && p[1] == pairs[i].str[1])
+            {
+                tok->type = pairs[i].type;
+                p += 2;
+            }
+        }
+        if (!tok->type && strchr("+-*/%&|^~!<>=(){}[],;", *p))
+            tok->type = *p++;
+        else if (!tok->type)
+        {
+            int prev = hl->prev;
+            ho_hl_error(hl, hl->line, "unexpected character '%c'", *p);
+            hl->p = p + 1;
+            ho_hl_next(hl);
+            hl->prev = prev;
+            return;
+        }
+    }
+
+    hl->p = p;
+}
+
+static int ho_hl_accept(ho_hl_t *hl, int type)
+{
+    if (hl->tok.type != type)
+        return 0;
+    ho_hl_next(hl);
+    return 1;
+}
+
+static int ho_hl_expect(ho_hl_t *hl, int type, const char *what)
+{
+    if (ho_hl_accept(hl, type))
+        return 1;
+    ho_hl_error(hl, hl->tok.line, "expected %s", what);
+    return 0;
+}
+
+static int ho_hl_is_keyword(ho_hl_t *hl, const char *keyword)
+{
+    return hl->tok.type == HO_HL_TOK_IDENT && strcasecmp(hl->tok.ident, keyword) == 0;
+}
+
+// Copy the name at the current token into dest, which can't be a keyword
+static int ho_hl_name(ho_hl_t *hl, char *dest)
+{
+    if (hl->tok.type != HO_HL_TOK_IDENT)
+    {
+        ho_hl_error(hl, hl->tok.line, "expected a name");
+        return 0;
+    }
+    for (int i = 0; ho_hl_keywords[i]; i++)
+    {
+        if (strcasecmp(hl->tok.ident, ho_hl_keywords[i]) == 0)
+        {
+            ho_hl_error(hl, hl->tok.line, "%s is a keyword", hl->tok.ident);
+            return 0;
+        }
+    }
+    strcpy(dest, hl->tok.ident);
+    ho_hl_next(hl);
+    return 1;
+}
+
+// Skip to the end of the statement in error, so one mistake is reported once
+// Errors found after the statement was read, e.g. undefined names, skip nothing.
+static void ho_hl_sync(ho_hl_t *hl)
+{
+    hl->panic = 0;
+    if (hl->prev == ';' || hl->prev == '}')
+        return;
+    while (hl->tok.type != HO_HL_TOK_EOF && hl->tok.type != ';' && hl->tok.type != '}')
+        ho_hl_next(hl);
+    ho_hl_accept(hl, ';');
+}
+
+// Skip the body of a function whose header is in error
+static void ho_hl_skip_body(ho_hl_t *hl)
+{
+    int depth = 0;
+    while (hl->tok.type != HO_HL_TOK_EOF && hl->tok.type != '{')
+        ho_hl_next(hl);
+    do
+    {
+        if (hl->tok.type == '{')
+            depth++;
+        else if (hl->tok.type == '}')
+            depth--;
+        ho_hl_next(hl);
+    } while (depth > 0 && hl->tok.type != HO_HL_TOK_EOF);
+}
+
+// Names
+
+static int ho_hl_find_global(ho_hl_t *hl, const char *name)
+{
+    for (int i = 0; i < hl->len_globals; i++)
+    {
+        if (strcasecmp(hl->globals[i].name, name) == 0)
+            return i;
+    }
+    return -1;
+}
+
+static int ho_hl_add_global(ho_hl_t *hl, const char *name, int kind, int32_t value, int line)
+{
+    if (hl->len_globals >= hl->len_globals_space)
+    {
+        hl->len_globals_space += 100;
+        hl->globals = realloc(hl->globals, sizeof(ho_hl_global_t) * hl->len_globals_space);
+    }
+    ho_hl_global_t *global = &hl->globals[hl->len_globals];
+    strcpy(global->name, name);
+    global->kind = kind;
+    global->value = value;
+    global->defined = 1;
+    global->line = line;
+    return hl->len_globals++;
+}
+
+// Returns the virtual register of a local, the innermost one if shadowed, or -1
+static int ho_hl_find_local(ho_hl_func_t *fn, const char *name, int from)
+{
+    for (int i = fn->len_locals - 1; i >= from; i--)
+    {
+        if (strcasecmp(fn->locals[i].name, name) == 0)
+            return fn->locals[i].vreg;
+    }
+    return -1;
+}
+
+static int ho_hl_vreg(ho_hl_func_t *fn, int is_var)
+{
+    if (fn->len_vregs >= fn->len_vregs_space)
+    {
+        fn->len_vregs_space += 100;
+        fn->vregs = realloc(fn->vregs, sizeof(ho_hl_vreg_t) * fn->len_vregs_space);
+    }
+    ho_hl_vreg_t *vreg = &fn->vregs[fn->len_vregs];
+    memset(vreg, 0, sizeof(ho_hl_vreg_t));
+    vreg->is_var = is_var;
+    vreg->hint = -1;
+    vreg->hint_reg = -1;
+    return fn->len_vregs++;
+}
+
+static int ho_hl_add_local(ho_hl_t *hl, const char *name, int line)
+{
+    ho_hl_func_t *fn = hl->fn;
+    if (ho_hl_find_local(fn, name, fn->scope) >= 0)
+        ho_hl_error(hl, line, "%s is already defined", name);
+
+    if (fn->len_locals >= fn->len_locals_space)
+    {
+        fn->len_locals_space += 100;
+        fn->locals = realloc(fn->locals, sizeof(ho_hl_local_t) * fn->len_locals_space);
+    }
+    strcpy(fn->locals[fn->len_locals].name, name);
+    fn->locals[fn->len_locals].vreg = ho_hl_vreg(fn, 1);
+    return fn->locals[fn->len_locals++].vreg;
+}
+
+static int ho_hl_label(ho_hl_t *hl)
+{
+    return hl->next_label++;
+}
+
+static ho_hl_instr_t *ho_hl_instr(ho_hl_func_t *fn, int op)
+{
+    if (fn->len_instrs >= fn->len_instrs_space)
+    {
+        fn->len_instrs_space += 100;
+        fn->instrs = realloc(fn->instrs, sizeof(ho_hl_instr_t) * fn->len_instrs_space);
+    }
+    ho_hl_instr_t *instr = &fn->instrs[fn->len_instrs++];
+    memset(instr, 0, sizeof(ho_hl_instr_t));
+    instr->op = op;
+    instr->dst = instr->a = instr->b = -1;
+    instr->sym = -1;
+    return instr;
+}
+
+static void ho_hl_jump(ho_hl_func_t *fn, int op, int label)
+{
+    ho_hl_instr(fn, op)->label = label;
+}
+
+// Expression trees
+
+static ho_hl_node_t *ho_hl_node(ho_hl_t *hl, int kind, int line)
+{
+    if (hl->len_nodes >= hl->len_nodes_space)
+    {
+        hl->len_nodes_space += 100;
+        hl->nodes = realloc(hl->nodes, sizeof(ho_hl_node_t *) * hl->len_nodes_space);
+    }
+    ho_hl_node_t *node = calloc(1, sizeof(ho_hl_node_t));
+    node->kind = kind;
+    node->line = line;
+    hl->nodes[hl->len_nodes++] = node;
+    return node;
+}
+
+static void ho_hl_free_nodes(ho_hl_t *hl)
+{
+    for (int i = 0; i < hl->len_nodes; i++)
+    {
+        free(hl->nodes[i]->args);
+        free(hl->nodes[i]);
+    }
+    hl->len_nodes = 0;
+}
+
+static ho_hl_node_t *ho_hl_num(ho_hl_t *hl, int32_t value, int line)
+{
+    ho_hl_node_t *node = ho_hl_node(hl, HO_HL_NUM, line);
+    node->value = value;
+    return node;
+}
+
+static int ho_hl_is_comparison(int op)
+{
+    return op == HO_HL_TOK_EQ || op == HO_HL_TOK_NE || op == '<' || op == '>' || op == HO_HL_TOK_LE || op == HO_HL_TOK_GE;
+}
+
+// Evaluate a binary operator on constants, wrapping around at 32 bits like the CPU
+// Returns 0 and reports an error if the result is undefined
+static int ho_hl_fold(ho_hl_t *hl, int line, int op, int32_t a, int32_t b, int32_t *dest)
+{
+    int64_t x = a, y = b;
+    switch (op)
+    {
+        case '+': x += y; break;
+        case '-': x -= y; break;
+        case '*': x *= y; break;
+        case '/':
+        case '%':
+            if (y == 0)
+            {
+                ho_hl_error(hl, line, "division by zero");
+                return 0;
+            }
+            x = (op == '/') ? x / y : x % y;
+            break;
+        case HO_HL_TOK_SHL:
+        case HO_HL_TOK_SHR:
+            if (y < 0 || y > 31)
+            {
+                ho_hl_error(hl, line, "shift count must be from 0 to 31");
+                return 0;
+            }
+            x = (op == HO_HL_TOK_SHL) ? (int64_t) ((uint64_t) x << y) : x >> y;
+            break;
+        case '&': x &= y; break;
+        case '|': x |= y; break;
+        case '^': x ^= y; break;
+        case HO_HL_TOK_EQ: x = x == y; break;
+        case HO_HL_TOK_NE: x = x != y; break;
+        case '<': x = x < y; break;
+        case '>': x = x > y; break;
+        case HO_HL_TOK_LE: x = x <= y; break;
+        case HO_HL_TOK_GE: x = x >= y; break;
+        case HO_HL_TOK_LAND: x = x && y; break;
+        case HO_HL_TOK_LOR: x = x || y; break;
+    }
+    *dest = (int32_t) (x & 0xFFFFFFFF);
+    return 1;
+}
+
+static ho_hl_node_t *ho_hl_expr(ho_hl_t *hl);
+
+// Call of a function, the name is already read
+static ho_hl_node_t *ho_hl_call(ho_hl_t *hl, const char *name, int line)
+{
+    ho_hl_node_t *node = ho_hl_node(hl, HO_HL_CALL, line);
+    int space = 0;
+
+    if (!ho_hl_accept(hl, ')'))
+    {
+        do
+        {
+            if (node->argc >= space)
+            {
+                space += 100;
+                node->args = realloc(node->args, sizeof(ho_hl_node_t *) * space);
+            }
+            node->args[node->argc++] = ho_hl_expr(hl);
+        } while (ho_hl_accept(hl, ','));
+        ho_hl_expect(hl, ')', "')'");
+    }
+
+    int global = ho_hl_find_global(hl, name);
+    if (global < 0)
+    {
+        global = ho_hl_add_global(hl, name, HO_HL_FUNC, node->argc, line);
+        hl->globals[global].defined = 0;
+    }
+    else if (hl->globals[global].kind != HO_HL_FUNC)
+        ho_hl_error(hl, line, "%s is not a function", name);
+    else if (hl->globals[global].value != node->argc)
+        ho_hl_error(hl, line, "wrong number of arguments for %s, expected %d", name, hl->globals[global].value);
+
+    node->global = global;
+    if (hl->fn)
+        hl->fn->calls = 1;
+    else
+        ho_hl_error(hl, line, "functions can only be called inside functions");
+    return node;
+}
+
+static ho_hl_node_t *ho_hl_primary(ho_hl_t *hl)
+{
+    int line = hl->tok.line;
+    ho_hl_node_t *node;
+
+    if (hl->tok.type == HO_HL_TOK_NUM)
+    {
+        node = ho_hl_num(hl, hl->tok.value, line);
+        ho_hl_next(hl);
+    }
+    else if (ho_hl_accept(hl, '('))
+    {
+        node = ho_hl_expr(hl);
+        ho_hl_expect(hl, ')', "')'");
+    }
+    else
+    {
+        char name[HORIZON_IDENT_MAX_LEN + 1];
+        if (!ho_hl_name(hl, name))
+            return ho_hl_num(hl, 0, line);
+
+        if (ho_hl_accept(hl, '('))
+            node = ho_hl_call(hl, name, line);
+        else
+        {
+            int vreg = (hl->fn) ? ho_hl_find_local(hl->fn, name, 0) : -1;
+            int global = ho_hl_find_global(hl, name);
+            if (vreg >= 0)
+            {
+                node = ho_hl_node(hl, HO_HL_LOCAL, line);
+                node->vreg = vreg;
+            }
+            else if (global >= 0 && hl->globals[global].kind == HO_HL_CONST)
+                node = ho_hl_num(hl, hl->globals[global].value, line);
+            else if (global >= 0 && hl->globals[global].kind != HO_HL_FUNC)
+            {
+                node = ho_hl_node(hl, HO_HL_GLOBAL, line);
+                node->global = global;
+                if (!hl->fn)
+                    ho_hl_error(hl, line, "expected a constant expression");
+            }
+            else
+            {
+                if (global >= 0)
+                    ho_hl_error(hl, line, "function %s can only be called", name);
+                else
+                    ho_hl_error(hl, line, "%s is not defined", name);
+                return ho_hl_num(hl, 0, line);
+            }
+        }
+    }
+
+    while (hl->tok.type == '[')
+    {
+        line = hl->tok.line;
+        ho_hl_next(hl);
+        ho_hl_node_t *index = ho_hl_node(hl, HO_HL_INDEX, line);
+        index->left = node;
+        index->right = ho_hl_expr(hl);
+        ho_hl_expect(hl, ']', "']'");
+        node = index;
+    }
+    return node;
+}
+
+static ho_hl_node_t *ho_hl_unary(ho_hl_t *hl)
+{
+    int op = hl->tok.type;
+    int line = hl->tok.line;
+    if (op != '-' && op != '+' && op != '~' && op != '!')
+        return ho_hl_primary(hl);
+
+    ho_hl_next(hl);
+    ho_hl_node_t *child = ho_hl_unary(hl);
+    if (op == '+')
+        return child;
+    if (child->kind == HO_HL_NUM)
+    {
+        int64_t value = child->value;
+        value = (op == '-') ? -value : (op == '~') ? ~value : !value;
+        child->value = (int32_t) (value & 0xFFFFFFFF);
+        return child;
+    }
+
+    ho_hl_node_t *node = ho_hl_node(hl, HO_HL_UNARY, line);
+    node->op = op;
+    node->left = child;
+    return node;
+}
+
+// Binary operators by precedence, from the lowest, as in C
+#define HO_HL_LEVELS 10
+static const int ho_hl_operators[HO_HL_LEVELS][4] = {
+    { HO_HL_TOK_LOR },
+    { HO_HL_TOK_LAND },
+    { '|' },
+    { '^' },
+    { '&' },
+    { HO_HL_TOK_EQ, HO_HL_TOK_NE },
+    { '<', '>', HO_HL_TOK_LE, HO_HL_TOK_GE },
+    { HO_HL_TOK_SHL, HO_HL_TOK_SHR },
+    { '+', '-' },
+    { '*', '/', '%' },
+};
+
+static ho_hl_node_t *ho_hl_binary(ho_hl_t *hl, int op, ho_hl_node_t *left, ho_hl_node_t *right, int line)
+{
+    if (left->kind == HO_HL_NUM && right->kind == HO_HL_NUM)
+    {
+        int32_t value = 0;
+        ho_hl_fold(hl, line, op, left->value, right->value, &value);
+        return ho_hl_num(hl, value, line);
+    }
+
+    ho_hl_node_t *node = ho_hl_node(hl, HO_HL_BINARY, line);
+    node->op = op;
+    node->left = left;
+    node->right = right;
+    return node;
+}
+
+static ho_hl_node_t *ho_hl_level(ho_hl_t *hl, int level)
+{
+    if (level == HO_HL_LEVELS)
+        return ho_hl_unary(hl);
+
+    ho_hl_node_t *node = ho_hl_level(hl, level + 1);
+    while (1)
+    {
+        int op = 0;
+        for (int i = 0; i < 4 && ho_hl_operators[level][i]; i++)
+        {
+            if (hl->tok.type == ho_hl_operators[level][i])
+                op = hl->tok.type;
+        }
+        if (!op)
+            return node;
+
+        int line = hl->tok.line;
+        ho_hl_next(hl);
+        node = ho_hl_binary(hl, op, node, ho_hl_level(hl, level + 1), line);
+    }
+}
+
+static ho_hl_node_t *ho_hl_expr(ho_hl_t *hl)
+{
+    return ho_hl_level(hl, 0);
+}
+
+// Parse an expression which must be constant
+static int32_t ho_hl_const_expr(ho_hl_t *hl)
+{
+    int line = hl->tok.line;
+    ho_hl_node_t *node = ho_hl_expr(hl);
+    if (node->kind != HO_HL_NUM)
+    {
+        ho_hl_error(hl, line, "expected a constant expression");
+        return 0;
+    }
+    return node->value;
+}
+
+// Code generation of expressions
+
+static ho_hl_operand_t ho_hl_const(int32_t value)
+{
+    ho_hl_operand_t operand = { 1, value, -1 };
+    return operand;
+}
+
+static ho_hl_operand_t ho_hl_reg(int vreg)
+{
+    ho_hl_operand_t operand = { 0, 0, vreg };
+    return operand;
+}
+
+static int ho_hl_imm8(int32_t value)
+{
+    // imm8 arguments are sign-extended
+    return value >= INT8_MIN && value <= INT8_MAX;
+}
+
+// Returns the virtual register holding the operand, loading constants into a new one
+static int ho_hl_materialize(ho_hl_func_t *fn, ho_hl_operand_t operand)
+{
+    if (!operand.is_const)
+        return operand.vreg;
+
+    ho_hl_instr_t *instr = ho_hl_instr(fn, HO_HL_I_CONST);
+    instr->dst = ho_hl_vreg(fn, 0);
+    instr->imm = operand.value;
+    return instr->dst;
+}
+
+static ho_hl_operand_t ho_hl_value(ho_hl_t *hl, ho_hl_node_t *node);
+static void ho_hl_cond(ho_hl_t *hl, ho_hl_node_t *node, int label, int jump_if);
+
+static ho_hl_operand_t ho_hl_alu(ho_hl_t *hl, int op, ho_hl_operand_t l, ho_hl_operand_t r, int line)
+{
+    ho_hl_func_t *fn = hl->fn;
+    int32_t value = 0;
+
+    if (l.is_const && r.is_const)
+    {
+        ho_hl_fold(hl, line, op, l.value, r.value, &value);
+        return ho_hl_const(value);
+    }
+
+    int alu = 0;
+    switch (op)
+    {
+        case '+': alu = HO_HL_ADD; break;
+        case '-': alu = HO_HL_SUB; break;
+        case '*': alu = HO_HL_MUL; break;
+        case '/': alu = HO_HL_DIV; break;
+        case '%': alu = HO_HL_MOD; break;
+        case '&': alu = HO_HL_AND; break;
+        case '|': alu = HO_HL_OR; break;
+        case '^': alu = HO_HL_XOR; break;
+        case HO_HL_TOK_SHL: alu = HO_HL_LSH; break;
+        case HO_HL_TOK_SHR: alu = HO_HL_RSH; break;
+    }
+
+    int commutative = alu == HO_HL_ADD || alu == HO_HL_MUL || alu == HO_HL_AND || alu == HO_HL_OR || alu == HO_HL_XOR;
+    if (l.is_const && commutative)
+    {
+        ho_hl_operand_t tmp = l;
+        l = r;
+        r = tmp;
+    }
+
+    ho_hl_instr_t *instr;
+    if (r.is_const)
+    {
+        int32_t v = r.value;
+        int identity = (v == 0 && (alu == HO_HL_ADD || alu == HO_HL_SUB || alu == HO_HL_OR || alu == HO_HL_XOR || alu == HO_HL_LSH || alu == HO_HL_RSH)) ||
+            (v == 1 && (alu == HO_HL_MUL || alu == HO_HL_DIV));
+        if (identity)
+            return l;
+        if (v == 0 && (alu == HO_HL_MUL || alu == HO_HL_AND))
+            return ho_hl_const(0);
+        if (v == 0 && (alu == HO_HL_DIV || alu == HO_HL_MOD))
+        {
+            ho_hl_error(hl, line, "division by zero");
+            return ho_hl_const(0);
+        }
+        if ((alu == HO_HL_LSH || alu == HO_HL_RSH) && (v < 0 || v > 31))
+        {
+            ho_hl_error(hl, line, "shift count must be from 0 to 31");
+            return ho_hl_const(0);
+        }
+        // Multiplying by a power of 2 is a shift
+        if (alu == HO_HL_MUL && v > 0 && (v & (v - 1)) == 0)
+        {
+            alu = HO_HL_LSH;
+            for (v = 0; (r.value >> v) != 1; v++)
+                ;
+        }
+        if (ho_hl_imm8(v))
+        {
+            instr = ho_hl_instr(fn, HO_HL_I_ALU);
+            instr->alu = alu;
+            instr->a = l.vreg;
+            instr->imm_arg = 1;
+            instr->imm = v;
+            instr->dst = ho_hl_vreg(fn, 0);
+            return ho_hl_reg(instr->dst);
+        }
+        r.vreg = ho_hl_materialize(fn, r);
+    }
+
+    int a = (l.is_const && l.value == 0 && alu == HO_HL_SUB) ? HO_HL_NIL : ho_hl_materialize(fn, l);
+    instr = ho_hl_instr(fn, HO_HL_I_ALU);
+    instr->alu = alu;
+    instr->a = a;
+    instr->b = r.vreg;
+    instr->dst = ho_hl_vreg(fn, 0);
+    return ho_hl_reg(instr->dst);
+}
+
+// Memory address of an indexed node, as sym + a + imm
+static void ho_hl_address(ho_hl_t *hl, ho_hl_node_t *node, int *sym, int *a, int32_t *imm)
+{
+    ho_hl_node_t *base = node->left;
+    ho_hl_node_t *index = node->right;
+    ho_hl_operand_t b = ho_hl_const(0);
+
+    *sym = -1;
+    *a = -1;
+    *imm = 0;
+    if (base->kind == HO_HL_GLOBAL && hl->globals[base->global].kind == HO_HL_ARRAY)
+        *sym = base->global;
+    else
+        b = ho_hl_value(hl, base);
+
+    // Constant offsets are added to the address instead of the index
+    ho_hl_operand_t i;
+    if (index->kind == HO_HL_BINARY && (index->op == '+' || index->op == '-') && index->right->kind == HO_HL_NUM)
+    {
+        i = ho_hl_value(hl, index->left);
+        *imm = (index->op == '+') ? index->right->value : -index->right->value;
+    }
+    else
+        i = ho_hl_value(hl, index);
+
+    if (i.is_const)
+    {
+        *imm += i.value;
+        i = b;
+    }
+    else if (!b.is_const)
+        i = ho_hl_alu(hl, '+', b, i, node->line);
+    else
+        *imm += b.value;
+
+    if (i.is_const)
+        *imm += i.value;
+    else
+        *a = i.vreg;
+}
+
+// Value of a condition, 0 or 1
+static ho_hl_operand_t ho_hl_cond_value(ho_hl_t *hl, ho_hl_node_t *node)
+{
+    ho_hl_func_t *fn = hl->fn;
+    int dst = ho_hl_vreg(fn, 0);
+    int label = ho_hl_label(hl);
+
+    ho_hl_instr_t *instr = ho_hl_instr(fn, HO_HL_I_CONST);
+    instr->dst = dst;
+    instr->imm = 0;
+    ho_hl_cond(hl, node, label, 0);
+    instr = ho_hl_instr(fn, HO_HL_I_CONST);
+    instr->dst = dst;
+    instr->imm = 1;
+    ho_hl_jump(fn, HO_HL_I_LABEL, label);
+    return ho_hl_reg(dst);
+}
+
+static ho_hl_operand_t ho_hl_value(ho_hl_t *hl, ho_hl_node_t *node)
+{
+    ho_hl_func_t *fn = hl->fn;
+    ho_hl_instr_t *instr;
+
+    switch (node->kind)
+    {
+        case HO_HL_NUM:
+            return ho_hl_const(node->value);
+
+        case HO_HL_LOCAL:
+            return ho_hl_reg(node->vreg);
+
+        case HO_HL_GLOBAL:
+            // The value of an array is its address
+            instr = ho_hl_instr(fn, (hl->globals[node->global].kind == HO_HL_ARRAY) ? HO_HL_I_ADDR : HO_HL_I_LOAD);
+            instr->sym = node->global;
+            instr->dst = ho_hl_vreg(fn, 0);
+            return ho_hl_reg(instr->dst);
+
+        case HO_HL_INDEX:
+        {
+            int sym, a;
+            int32_t imm;
+            ho_hl_address(hl, node, &sym, &a, &imm);
+            instr = ho_hl_instr(fn, HO_HL_I_LOAD);
+            instr->sym = sym;
+            instr->a = a;
+            instr->imm = imm;
+            instr->dst = ho_hl_vreg(fn, 0);
+            return ho_hl_reg(instr->dst);
+        }
+
+        case HO_HL_CALL:
+        {
+            int *args = malloc(sizeof(int) * (node->argc + 1));
+            int32_t *values = malloc(sizeof(int32_t) * (node->argc + 1));
+            for (int i = 0; i < node->argc; i++)
+            {
+                // PUSH takes 16-bit immediates
+                ho_hl_operand_t arg = ho_hl_value(hl, node->args[i]);
+                if (arg.is_const && (arg.value < 0 || arg.value > UINT16_MAX))
+                    arg = ho_hl_reg(ho_hl_materialize(fn, arg));
+                args[i] = (arg.is_const) ? -1 : arg.vreg;
+                values[i] = arg.value;
+            }
+            instr = ho_hl_instr(fn, HO_HL_I_CALL);
+            instr->sym = node->global;
+            instr->args = args;
+            instr->arg_values = values;
+            instr->argc = node->argc;
+            instr->dst = ho_hl_vreg(fn, 0);
+            fn->vregs[instr->dst].hint_reg = 0;
+            return ho_hl_reg(instr->dst);
+        }
+
+        case HO_HL_UNARY:
+            if (node->op == '!')
+                return ho_hl_cond_value(hl, node);
+            else
+            {
+                ho_hl_operand_t value = ho_hl_value(hl, node->left);
+                if (node->op == '-')
+                    return ho_hl_alu(hl, '-', ho_hl_const(0), value, node->line);
+                instr = ho_hl_instr(fn, HO_HL_I_NOT);
+                instr->a = ho_hl_materialize(fn, value);
+                instr->dst = ho_hl_vreg(fn, 0);
+                return ho_hl_reg(instr->dst);
+            }
+
+        case HO_HL_BINARY:
+            if (ho_hl_is_comparison(node->op) || node->op == HO_HL_TOK_LAND || node->op == HO_HL_TOK_LOR)
+                return ho_hl_cond_value(hl, node);
+            else
+            {
+                ho_hl_operand_t l = ho_hl_value(hl, node->left);
+                ho_hl_operand_t r = ho_hl_value(hl, node->right);
+                return ho_hl_alu(hl, node->op, l, r, node->line);
+            }
+    }
+
+    return ho_hl_const(0);
+}
+
+static int ho_hl_invert(int cond)
+{
+    switch (cond)
+    {
+        case HO_HL_TOK_EQ: return HO_HL_TOK_NE;
+        case HO_HL_TOK_NE: return HO_HL_TOK_EQ;
+        case '<': return HO_HL_TOK_GE;
+        case HO_HL_TOK_GE: return '<';
+        case '>': return HO_HL_TOK_LE;
+        default: return '>';
+    }
+}
+
+// Condition with the operands swapped
+static int ho_hl_mirror(int cond)
+{
+    switch (cond)
+    {
+        case '<': return '>';
+        case '>': return '<';
+        case HO_HL_TOK_LE: return HO_HL_TOK_GE;
+        case HO_HL_TOK_GE: return HO_HL_TOK_LE;
+        default: return cond;
+    }
+}
+
+// Jump to label if l cond r
+// Only JEQ, JNE, JLT and JGE are used, the others are reached by swapping the
+// operands or adding 1 to a constant.
+static void ho_hl_branch(ho_hl_t *hl, int cond, ho_hl_operand_t l, ho_hl_operand_t r, int label)
+{
+    ho_hl_func_t *fn = hl->fn;
+
+    if (l.is_const && r.is_const)
+    {
+        int32_t taken = 0;
+        ho_hl_fold(hl, 0, cond, l.value, r.value, &taken);
+        if (taken)
+            ho_hl_jump(fn, HO_HL_I_JMP, label);
+        return;
+    }
+    if (l.is_const)
+    {
+        ho_hl_operand_t tmp = l;
+        l = r;
+        r = tmp;
+        cond = ho_hl_mirror(cond);
+    }
+
+    if (r.is_const && (cond == '>' || cond == HO_HL_TOK_LE))
+    {
+        // Nothing is greater than the largest number
+        if (r.value == INT32_MAX)
+        {
+            if (cond == HO_HL_TOK_LE)
+                ho_hl_jump(fn, HO_HL_I_JMP, label);
+            return;
+        }
+        cond = (cond == '>') ? HO_HL_TOK_GE : '<';
+        r.value++;
+    }
+    else if (!r.is_const && (cond == '>' || cond == HO_HL_TOK_LE))
+    {
+        ho_hl_operand_t tmp = l;
+        l = r;
+        r = tmp;
+        cond = ho_hl_mirror(cond);
+    }
+    if (r.is_const && !ho_hl_imm8(r.value))
+        r = ho_hl_reg(ho_hl_materialize(fn, r));
+
+    ho_hl_instr_t *instr = ho_hl_instr(fn, HO_HL_I_BR);
+    instr->alu = cond;
+    instr->a = l.vreg;
+    instr->b = r.vreg;
+    instr->imm_arg = r.is_const;
+    instr->imm = r.value;
+    instr->label = label;
+}
+
+// Jump to label if the condition is true, or if it is false when jump_if is 0
+static void ho_hl_cond(ho_hl_t *hl, ho_hl_node_t *node, int label, int jump_if)
+{
+    ho_hl_func_t *fn = hl->fn;
+
+    if (node->kind == HO_HL_UNARY && node->op == '!')
+    {
+        ho_hl_cond(hl, node->left, label, !jump_if);
+        return;
+    }
+    if (node->kind == HO_HL_BINARY && (node->op == HO_HL_TOK_LAND || node->op == HO_HL_TOK_LOR))
+    {
+        // a && b jumps if both are true, a || b if either is, the first one decides
+        // alone when it is false or true respectively
+        int decides = node->op == HO_HL_TOK_LOR;
+        if (jump_if == decides)
+        {
+            ho_hl_cond(hl, node->left, label, jump_if);
+            ho_hl_cond(hl, node->right, label, jump_if);
+        }
+        else
+        {
+            int skip = ho_hl_label(hl);
+            ho_hl_cond(hl, node->left, skip, !jump_if);
+            ho_hl_cond(hl, node->right, label, jump_if);
+            ho_hl_jump(fn, HO_HL_I_LABEL, skip);
+        }
+        return;
+    }
+    if (node->kind == HO_HL_BINARY && ho_hl_is_comparison(node->op))
+    {
+        ho_hl_operand_t l = ho_hl_value(hl, node->left);
+        ho_hl_operand_t r = ho_hl_value(hl, node->right);
+        ho_hl_branch(hl, (jump_if) ? node->op : ho_hl_invert(node->op), l, r, label);
+        return;
+    }
+
+    ho_hl_operand_t value = ho_hl_value(hl, node);
+    ho_hl_branch(hl, (jump_if) ? HO_HL_TOK_NE : HO_HL_TOK_EQ, value, ho_hl_const(0), label);
+}
+
+// Set a local to the operand
+static void ho_hl_move(ho_hl_func_t *fn, int dst, ho_hl_operand_t value)
+{
+    ho_hl_instr_t *instr;
+    if (value.is_const)
+    {
+        instr = ho_hl_instr(fn, HO_HL_I_CONST);
+        instr->dst = dst;
+        instr->imm = value.value;
+        return;
+    }
+    if (value.vreg == dst)
+        return;
+
+    // Temporaries are read once, so the instruction computing it can write the local
+    instr = (fn->len_instrs > 0) ? &fn->instrs[fn->len_instrs - 1] : NULL;
+    if (instr && !fn->vregs[value.vreg].is_var && instr->dst == value.vreg && instr->op != HO_HL_I_LABEL)
+    {
+        instr->dst = dst;
+        return;
+    }
+
+    instr = ho_hl_instr(fn, HO_HL_I_MOV);
+    instr->dst = dst;
+    instr->a = value.vreg;
+    fn->vregs[dst].hint = value.vreg;
+    fn->vregs[value.vreg].hint = dst;
+}
+
+static void ho_hl_assign(ho_hl_t *hl, ho_hl_node_t *node)
+{
+    ho_hl_func_t *fn = hl->fn;
+    ho_hl_node_t *target = node->left;
+    ho_hl_instr_t *instr;
+    int sym = -1, a = -1;
+    int32_t imm = 0;
+
+    if (target->kind == HO_HL_LOCAL)
+    {
+        ho_hl_move(fn, target->vreg, ho_hl_value(hl, node->right));
+        return;
+    }
+
+    if (target->kind == HO_HL_GLOBAL)
+        sym = target->global;
+    else
+        ho_hl_address(hl, target, &sym, &a, &imm);
+
+    // STORE takes 16-bit immediates
+    ho_hl_operand_t value = ho_hl_value(hl, node->right);
+    int imm_arg = value.is_const && value.value >= 0 && value.value <= UINT16_MAX;
+    int b = (imm_arg) ? -1 : ho_hl_materialize(fn, value);
+    instr = ho_hl_instr(fn, HO_HL_I_STORE);
+    instr->sym = sym;
+    instr->a = a;
+    instr->imm = imm;
+    instr->b = b;
+    instr->imm_arg = imm_arg;
+    instr->imm_value = value.value;
+}
+
+// Statements
+
+static void ho_hl_statement(ho_hl_t *hl);
+
+// Assignment, increment or call, without the ';'
+static ho_hl_node_t *ho_hl_simple(ho_hl_t *hl)
+{
+    int line = hl->tok.line;
+    ho_hl_node_t *target = ho_hl_primary(hl);
+    if (target->kind == HO_HL_CALL)
+        return target;
+
+    int assignable = target->kind == HO_HL_LOCAL || target->kind == HO_HL_INDEX ||
+        (target->kind == HO_HL_GLOBAL && hl->globals[target->global].kind == HO_HL_VAR);
+    if (!assignable)
+    {
+        ho_hl_error(hl, line, "expected an assignment or a call");
+        return NULL;
+    }
+
+    ho_hl_node_t *node = ho_hl_node(hl, HO_HL_ASSIGN, line);
+    node->left = target;
+    int op = hl->tok.type;
+    int value = hl->tok.value;
+    line = hl->tok.line;
+    if (ho_hl_accept(hl, '='))
+        node->right = ho_hl_expr(hl);
+    else if (ho_hl_accept(hl, HO_HL_TOK_OP_ASSIGN))
+        node->right = ho_hl_binary(hl, value, target, ho_hl_expr(hl), line);
+    else if (ho_hl_accept(hl, HO_HL_TOK_INC) || ho_hl_accept(hl, HO_HL_TOK_DEC))
+        node->right = ho_hl_binary(hl, (op == HO_HL_TOK_INC) ? '+' : '-', target, ho_hl_num(hl, 1, line), line);
+    else
+    {
+        ho_hl_error(hl, line, "expected an assignment or a call");
+        return NULL;
+    }
+    return node;
+}
+
+static void ho_hl_gen_simple(ho_hl_t *hl, ho_hl_node_t *node)
+{
+    if (!node || hl->panic)
+        return;
+    if (node->kind == HO_HL_ASSIGN)
+        ho_hl_assign(hl, node);
+    else
+    {
+        // The result of a call statement is not used
+        ho_hl_value(hl, node);
+        hl->fn->instrs[hl->fn->len_instrs - 1].dst = -1;
+    }
+}
+
+// var name = value, name = value ... without the ';'
+static void ho_hl_local_decl(ho_hl_t *hl)
+{
+    do
+    {
+        char name[HORIZON_IDENT_MAX_LEN + 1];
+        int line = hl->tok.line;
+        if (!ho_hl_name(hl, name))
+            return;
+        // The value is read before the name is defined, so it can use an outer one
+        ho_hl_node_t *value = (ho_hl_accept(hl, '=')) ? ho_hl_expr(hl) : ho_hl_num(hl, 0, line);
+        ho_hl_operand_t operand = ho_hl_value(hl, value);
+        int vreg = ho_hl_add_local(hl, name, line);
+        ho_hl_move(hl->fn, vreg, operand);
+    } while (ho_hl_accept(hl, ','));
+}
+
+static void ho_hl_block(ho_hl_t *hl)
+{
+    ho_hl_func_t *fn = hl->fn;
+    int len_locals = fn->len_locals;
+    int scope = fn->scope;
+
+    fn->scope = fn->len_locals;
+    while (hl->tok.type != '}' && hl->tok.type != HO_HL_TOK_EOF)
+        ho_hl_statement(hl);
+    ho_hl_expect(hl, '}', "'}'");
+
+    fn->len_locals = len_locals;
+    fn->scope = scope;
+}
+
+// Body of a loop, with the labels break and continue jump to
+static void ho_hl_loop_body(ho_hl_t *hl, int break_label, int continue_label)
+{
+    ho_hl_func_t *fn = hl->fn;
+    if (fn->loop_depth >= HORIZON_HL_MAX_LOOP_DEPTH)
+    {
+        ho_hl_error(hl, hl->tok.line, "loops nested deeper than %d", HORIZON_HL_MAX_LOOP_DEPTH);
+        return;
+    }
+    fn->loop_break[fn->loop_depth] = break_label;
+    fn->loop_continue[fn->loop_depth] = continue_label;
+    fn->loop_depth++;
+    ho_hl_statement(hl);
+    fn->loop_depth--;
+}
+
+static void ho_hl_statement(ho_hl_t *hl)
+{
+    ho_hl_func_t *fn = hl->fn;
+    int line = hl->tok.line;
+
+    if (ho_hl_accept(hl, '{'))
+    {
+        ho_hl_block(hl);
+        return;
+    }
+    else if (ho_hl_accept(hl, ';'))
+        return;
+    else if (ho_hl_is_keyword(hl, "var"))
+    {
+        ho_hl_next(hl);
+        ho_hl_local_decl(hl);
+        ho_hl_expect(hl, ';', "';'");
+    }
+    else if (ho_hl_is_keyword(hl, "if"))
+    {
+        ho_hl_next(hl);
+        ho_hl_expect(hl, '(', "'('");
+        ho_hl_node_t *cond = ho_hl_expr(hl);
+        ho_hl_expect(hl, ')', "')'");
+
+        int else_label = ho_hl_label(hl);
+        ho_hl_cond(hl, cond, else_label, 0);
+        ho_hl_statement(hl);
+        if (ho_hl_is_keyword(hl, "else"))
+        {
+            ho_hl_next(hl);
+            int end_label = ho_hl_label(hl);
+            ho_hl_jump(fn, HO_HL_I_JMP, end_label);
+            ho_hl_jump(fn, HO_HL_I_LABEL, else_label);
+            ho_hl_statement(hl);
+            ho_hl_jump(fn, HO_HL_I_LABEL, end_label);
+        }
+        else
+            ho_hl_jump(fn, HO_HL_I_LABEL, else_label);
+        return;
+    }
+    else if (ho_hl_is_keyword(hl, "while"))
+    {
+        ho_hl_next(hl);
+        ho_hl_expect(hl, '(', "'('");
+        ho_hl_node_t *cond = ho_hl_expr(hl);
+        ho_hl_expect(hl, ')', "')'");
+
+        // The condition is tested at the bottom, so each iteration takes one jump
+        int body_label = ho_hl_label(hl), cond_label = ho_hl_label(hl), break_label = ho_hl_label(hl);
+        ho_hl_jump(fn, HO_HL_I_JMP, cond_label);
+        ho_hl_jump(fn, HO_HL_I_LABEL, body_label);
+        ho_hl_loop_body(hl, break_label, cond_label);
+        ho_hl_jump(fn, HO_HL_I_LABEL, cond_label);
+        ho_hl_cond(hl, cond, body_label, 1);
+        ho_hl_jump(fn, HO_HL_I_LABEL, break_label);
+        return;
+    }
+    else if (ho_hl_is_keyword(hl, "for"))
+    {
+        ho_hl_next(hl);
+        int len_locals = fn->len_locals;
+        int scope = fn->scope;
+        fn->scope = fn->len_locals;
+
+        ho_hl_expect(hl, '(', "'('");
+        if (ho_hl_is_keyword(hl, "var"))
+        {
+            ho_hl_next(hl);
+            ho_hl_local_decl(hl);
+        }
+        else if (hl->tok.type != ';')
+            ho_hl_gen_simple(hl, ho_hl_simple(hl));
+        ho_hl_expect(hl, ';', "';'");
+        ho_hl_node_t *cond = (hl->tok.type != ';') ? ho_hl_expr(hl) : ho_hl_num(hl, 1, line);
+        ho_hl_expect(hl, ';', "';'");
+        ho_hl_node_t *step = (hl->tok.type != ')') ? ho_hl_simple(hl) : NULL;
+        ho_hl_expect(hl, ')', "')'");
+
+        int body_label = ho_hl_label(hl), continue_label = ho_hl_label(hl);
+        int cond_label = ho_hl_label(hl), break_label = ho_hl_label(hl);
+        ho_hl_jump(fn, HO_HL_I_JMP, cond_label);
+        ho_hl_jump(fn, HO_HL_I_LABEL, body_label);
+        ho_hl_loop_body(hl, break_label, continue_label);
+        ho_hl_jump(fn, HO_HL_I_LABEL, continue_label);
+        ho_hl_gen_simple(hl, step);
+        ho_hl_jump(fn, HO_HL_I_LABEL, cond_label);
+        ho_hl_cond(hl, cond, body_label, 1);
+        ho_hl_jump(fn, HO_HL_I_LABEL, break_label);
+
+        fn->len_locals = len_locals;
+        fn->scope = scope;
+        return;
+    }
+    else if (ho_hl_is_keyword(hl, "break") || ho_hl_is_keyword(hl, "continue"))
+    {
+        int is_break = ho_hl_is_keyword(hl, "break");
+        ho_hl_next(hl);
+        if (fn->loop_depth == 0)
+            ho_hl_error(hl, line, "%s outside of a loop", (is_break) ? "break" : "continue");
+        else
+            ho_hl_jump(fn, HO_HL_I_JMP, (is_break) ? fn->loop_break[fn->loop_depth - 1] : fn->loop_continue[fn->loop_depth - 1]);
+        ho_hl_expect(hl, ';', "';'");
+    }
+    else if (ho_hl_is_keyword(hl, "return"))
+    {
+        ho_hl_next(hl);
+        int a = -1;
+        if (hl->tok.type != ';')
+        {
+            a = ho_hl_materialize(fn, ho_hl_value(hl, ho_hl_expr(hl)));
+            if (fn->vregs[a].hint_reg < 0 && !fn->vregs[a].is_var)
+                fn->vregs[a].hint_reg = 0;
+        }
+        ho_hl_instr(fn, HO_HL_I_RET)->a = a;
+        ho_hl_expect(hl, ';', "';'");
+    }
+    else
+    {
+        ho_hl_gen_simple(hl, ho_hl_simple(hl));
+        ho_hl_expect(hl, ';', "';'");
+    }
+
+    if (hl->panic)
+        ho_hl_sync(hl);
+}
+
+// Register allocation
+
+typedef struct {
+    int n;                  // instructions
+    int words;              // words per set
+    uint64_t *in;           // live virtual registers before each instruction
+    uint64_t *out;          // and after it
+} ho_hl_liveness_t;
+
+#define HO_HL_TEST(set, v)  (((set)[(v) / 64] >> ((v) % 64)) & 1)
+#define HO_HL_SET(set, v)   ((set)[(v) / 64] |= (uint64_t) 1 << ((v) % 64))
+
+// Virtual registers read by an instruction, returns how many
+static int ho_hl_uses(ho_hl_instr_t *instr, int *uses)
+{
+    int n = 0;
+    if (instr->a >= 0)
+        uses[n++] = instr->a;
+    if (instr->b >= 0 && !instr->imm_arg)
+        uses[n++] = instr->b;
+    for (int i = 0; i < instr->argc; i++)
+    {
+        if (instr->args[i] >= 0)
+            uses[n++] = instr->args[i];
+    }
+    return n;
+}
+
+// Remove the instructions after a jump or return up to the next label, and jumps
+// to the instruction right after them
+static void ho_hl_cleanup(ho_hl_func_t *fn)
+{
+    int dead = 0;
+    for (int i = 0; i < fn->len_instrs; i++)
+    {
+        ho_hl_instr_t *instr = &fn->instrs[i];
+        if (instr->op == HO_HL_I_LABEL)
+            dead = 0;
+        instr->removed = dead;
+        if (instr->op == HO_HL_I_JMP || instr->op == HO_HL_I_RET)
+            dead = 1;
+    }
+    for (int i = 0; i < fn->len_instrs; i++)
+    {
+        ho_hl_instr_t *instr = &fn->instrs[i];
+        if (instr->removed || (instr->op != HO_HL_I_JMP && instr->op != HO_HL_I_BR))
+            continue;
+        for (int j = i + 1; j < fn->len_instrs && (fn->instrs[j].removed || fn->instrs[j].op == HO_HL_I_LABEL); j++)
+        {
+            if (!fn->instrs[j].removed && fn->instrs[j].label == instr->label)
+            {
+                instr->removed = 1;
+                break;
+            }
+        }
+    }
+
+    int len = 0;
+    for (int i = 0; i < fn->len_instrs; i++)
+    {
+        if (fn->instrs[i].removed)
+        {
+            free(fn->instrs[i].args);
+            free(fn->instrs[i].arg_values);
+        }
+        else
+            fn->instrs[len++] = fn->instrs[i];
+    }
+    fn->len_instrs = len;
+}
+
+static void ho_hl_liveness(ho_hl_t *hl, ho_hl_func_t *fn, ho_hl_liveness_t *live)
+{
+    int n = fn->len_instrs;
+    int words = (fn->len_vregs + 63) / 64;
+    int *label_pos = malloc(sizeof(int) * (hl->next_label + 1));
+    int *uses = malloc(sizeof(int) * (fn->len_vregs * 2 + 2));
+
+    for (int i = 0; i < n; i++)
+    {
+        if (fn->instrs[i].op == HO_HL_I_LABEL)
+            label_pos[fn->instrs[i].label] = i;
+    }
+
+    live->n = n;
+    live->words = words;
+    live->in = calloc((size_t) n * words + 1, sizeof(uint64_t));
+    live->out = calloc((size_t) n * words + 1, sizeof(uint64_t));
+
+    int changed = 1;
+    while (changed)
+    {
+        changed = 0;
+        for (int i = n - 1; i >= 0; i--)
+        {
+            ho_hl_instr_t *instr = &fn->instrs[i];
+            uint64_t *in = live->in + (size_t) i * words;
+            uint64_t *out = live->out + (size_t) i * words;
+
+            int succ[2], len_succ = 0;
+            if (instr->op == HO_HL_I_JMP || instr->op == HO_HL_I_BR)
+                succ[len_succ++] = label_pos[instr->label];
+            if (instr->op != HO_HL_I_JMP && instr->op != HO_HL_I_RET && i + 1 < n)
+                succ[len_succ++] = i + 1;
+            for (int s = 0; s < len_succ; s++)
+            {
+                uint64_t *succ_in = live->in + (size_t) succ[s] * words;
+                for (int w = 0; w < words; w++)
+                    out[w] |= succ_in[w];
+            }
+
+            for (int w = 0; w < words; w++)
+            {
+                uint64_t word = out[w];
+                if (instr->dst >= 0 && instr->dst / 64 == w)
+                    word &= ~((uint64_t) 1 << (instr->dst % 64));
+                if (word & ~in[w])
+                {
+                    in[w] |= word;
+                    changed = 1;
+                }
+            }
+            int len_uses = ho_hl_uses(instr, uses);
+            for (int u = 0; u < len_uses; u++)
+            {
+                if (!HO_HL_TEST(in, uses[u]))
+                {
+                    HO_HL_SET(in, uses[u]);
+                    changed = 1;
+                }
+            }
+        }
+    }
+
+    for (int v = 0; v < fn->len_vregs; v++)
+    {
+        fn->vregs[v].start = n;
+        fn->vregs[v].end = -1;
+    }
+    for (int i = 0; i < n; i++)
+    {
+        uint64_t *in = live->in + (size_t) i * words;
+        uint64_t *out = live->out + (size_t) i * words;
+        for (int v = 0; v < fn->len_vregs; v++)
+        {
+            if (HO_HL_TEST(in, v) || HO_HL_TEST(out, v) || fn->instrs[i].dst == v)
+            {
+                if (i < fn->vregs[v].start)
+                    fn->vregs[v].start = i;
+                fn->vregs[v].end = i;
+            }
+        }
+    }
+
+    free(label_pos);
+    free(uses);
+}
+
+static int ho_hl_cmp_start(const void *a, const void *b)
+{
+    const int *x = a, *y = b;
+    return (x[0] != y[0]) ? x[0] - y[0] : x[1] - y[1];
+}
+
+// Linear scan over the live ranges with the first k registers
+// Returns the number of virtual registers spilled
+static int ho_hl_scan(ho_hl_func_t *fn, ho_hl_liveness_t *live, int k)
+{
+    int len = 0, spilled = 0;
+    int *order = malloc(sizeof(int) * 2 * (fn->len_vregs + 1));
+    int *active = malloc(sizeof(int) * (fn->len_vregs + 1));
+    int len_active = 0;
+    int used[HORIZON_HL_REGISTERS] = { 0 };
+
+    for (int v = 0; v < fn->len_vregs; v++)
+    {
+        fn->vregs[v].reg = -1;
+        if (fn->vregs[v].end >= 0)
+        {
+            order[len * 2] = fn->vregs[v].start;
+            order[len++ * 2 + 1] = v;
+        }
+    }
+    qsort(order, len, sizeof(int) * 2, ho_hl_cmp_start);
+
+    for (int i = 0; i < len; i++)
+    {
+        int v = order[i * 2 + 1];
+        ho_hl_vreg_t *vreg = &fn->vregs[v];
+        int p = vreg->start;
+
+        // Ranges ending where this one starts can share its register if the value
+        // is read there for the last time and this one is written there
+        int written = fn->instrs[p].dst == v && !HO_HL_TEST(live->in + (size_t) p * live->words, v);
+        int len_kept = 0;
+        for (int j = 0; j < len_active; j++)
+        {
+            ho_hl_vreg_t *other = &fn->vregs[active[j]];
+            int ends = other->end < p || (other->end == p && written && !HO_HL_TEST(live->out + (size_t) p * live->words, active[j]));
+            if (ends)
+                used[other->reg] = 0;
+            else
+                active[len_kept++] = active[j];
+        }
+        len_active = len_kept;
+
+        int reg = -1;
+        if (vreg->hint_reg >= 0 && vreg->hint_reg < k && !used[vreg->hint_reg])
+            reg = vreg->hint_reg;
+        else if (vreg->hint >= 0 && fn->vregs[vreg->hint].reg >= 0 && !used[fn->vregs[vreg->hint].reg])
+            reg = fn->vregs[vreg->hint].reg;
+        for (int r = 0; r < k && reg < 0; r++)
+        {
+            if (!used[r])
+                reg = r;
+        }
+
+        if (reg < 0)
+        {
+            // Spill the range ending last
+            int last = -1;
+            for (int j = 0; j < len_active; j++)
+            {
+                if (last < 0 || fn->vregs[active[j]].end > fn->vregs[active[last]].end)
+                    last = j;
+            }
+            spilled++;
+            if (fn->vregs[active[last]].end <= vreg->end)
+                continue;
+            reg = fn->vregs[active[last]].reg;
+            fn->vregs[active[last]].reg = -1;
+            active[last] = active[--len_active];
+        }
+
+        vreg->reg = reg;
+        used[reg] = 1;
+        active[len_active++] = v;
+    }
+
+    free(order);
+    free(active);
+    return spilled;
+}
+
+// Assembly output
+
+static const char *ho_hl_slot(ho_hl_t *hl, ho_hl_func_t *fn, int v)
+{
+    static char name[32];
+    if (fn->vregs[v].slot < 0)
+    {
+        fn->vregs[v].slot = hl->next_slot++;
+        ho_hl_emit(&hl->data, ".var S%d 0\n", fn->vregs[v].slot);
+    }
+    sprintf(name, "S%d", fn->vregs[v].slot);
+    return name;
+}
+
+// Register to read v from, spilled values are loaded into the scratch register
+static const char *ho_hl_read(ho_hl_t *hl, ho_hl_func_t *fn, int v, int scratch)
+{
+    if (v == HO_HL_NIL)
+        return "nil";
+    if (fn->vregs[v].reg >= 0)
+        return ho_hl_reg_names[fn->vregs[v].reg];
+
+    ho_hl_emit(&hl->code, "    li ar %s\n    load %s\n", ho_hl_slot(hl, fn, v), ho_hl_reg_names[scratch]);
+    return ho_hl_reg_names[scratch];
+}
+
+// Register to write v to, see ho_hl_written
+static const char *ho_hl_write(ho_hl_func_t *fn, int v, int scratch)
+{
+    return ho_hl_reg_names[(fn->vregs[v].reg >= 0) ? fn->vregs[v].reg : scratch];
+}
+
+// Store v if it is spilled, after it was written to the scratch register
+static void ho_hl_written(ho_hl_t *hl, ho_hl_func_t *fn, int v, int scratch)
+{
+    if (fn->vregs[v].reg < 0)
+        ho_hl_emit(&hl->code, "    li ar %s\n    store %s\n", ho_hl_slot(hl, fn, v), ho_hl_reg_names[scratch]);
+}
+
+// Load the address sym + a + imm into AR
+static void ho_hl_emit_address(ho_hl_t *hl, ho_hl_func_t *fn, ho_hl_instr_t *instr, int scratch)
+{
+    const char *a = (instr->a >= 0) ? ho_hl_read(hl, fn, instr->a, scratch) : NULL;
+    char imm[32] = { 0 };
+    if (instr->imm)
+        sprintf(imm, " %c %ld", (instr->imm < 0) ? '-' : '+', labs((long) instr->imm));
+
+    if (instr->sym >= 0)
+        ho_hl_emit(&hl->code, "    li ar _%s%s\n", hl->globals[instr->sym].name, imm);
+    else if (!a)
+        ho_hl_emit(&hl->code, "    li ar #%d\n", instr->imm);
+    else if (instr->imm == 0)
+        ho_hl_emit(&hl->code, "    mov ar %s\n", a);
+    else if (ho_hl_imm8(instr->imm))
+        ho_hl_emit(&hl->code, "    add ar %s #%d\n", a, instr->imm);
+    else
+        ho_hl_emit(&hl->code, "    li ar #%d\n", instr->imm);
+
+    if (a && (instr->sym >= 0 || (instr->imm && !ho_hl_imm8(instr->imm))))
+        ho_hl_emit(&hl->code, "    add ar ar %s\n", a);
+}
+
+// Load a constant with the fewest instructions: imm8 values take one ADD, 16-bit ones
+// a PUSH/POP pair, and the rest are left to LI
+static void ho_hl_emit_const(ho_hl_t *hl, const char *rd, int32_t value)
+{
+    if (ho_hl_imm8(value))
+        ho_hl_emit(&hl->code, "    mov %s #%d\n", rd, value);
+    else if (value >= 0 && value <= UINT16_MAX)
+        ho_hl_emit(&hl->code, "    mov16 %s #%d\n", rd, value);
+    else
+        ho_hl_emit(&hl->code, "    li %s #%d\n", rd, value);
+}
+
+static void ho_hl_emit_call(ho_hl_t *hl, ho_hl_func_t *fn, ho_hl_liveness_t *live, int p)
+{
+    ho_hl_instr_t *instr = &fn->instrs[p];
+    uint64_t *out = live->out + (size_t) p * live->words;
+    int s0 = HORIZON_HL_REGISTERS - HORIZON_HL_SCRATCH;
+    int *saved = malloc(sizeof(int) * (fn->len_vregs + 1));
+    int len_saved = 0;
+
+    // Every register is free to use in the called function, so the values still
+    // needed after the call are kept on the stack
+    for (int v = 0; v < fn->len_vregs; v++)
+    {
+        if (HO_HL_TEST(out, v) && v != instr->dst)
+            saved[len_saved++] = v;
+    }
+    for (int i = 0; i < len_saved; i++)
+        ho_hl_emit(&hl->code, "    push %s\n", ho_hl_read(hl, fn, saved[i], s0));
+
+    for (int i = 0; i < instr->argc; i++)
+    {
+        int32_t value = instr->arg_values[i];
+        if (instr->args[i] >= 0)
+            ho_hl_emit(&hl->code, "    push %s\n", ho_hl_read(hl, fn, instr->args[i], s0));
+        else
+            ho_hl_emit(&hl->code, "    push #%d\n", value);
+    }
+    ho_hl_emit(&hl->code, "    call _%s\n", hl->globals[instr->sym].name);
+
+    if (instr->dst >= 0)
+    {
+        if (fn->vregs[instr->dst].reg < 0)
+            ho_hl_written(hl, fn, instr->dst, 0);
+        else if (fn->vregs[instr->dst].reg != 0)
+            ho_hl_emit(&hl->code, "    mov %s r0\n", ho_hl_write(fn, instr->dst, s0));
+    }
+
+    for (int i = len_saved - 1; i >= 0; i--)
+    {
+        ho_hl_emit(&hl->code, "    pop %s\n", ho_hl_write(fn, saved[i], s0));
+        ho_hl_written(hl, fn, saved[i], s0);
+    }
+    free(saved);
+}
+
+static void ho_hl_emit_function(ho_hl_t *hl, ho_hl_func_t *fn, ho_hl_liveness_t *live)
+{
+    static const char *conds[] = { "jeq", "jne", "jlt", "jge" };
+    int s0 = HORIZON_HL_REGISTERS - HORIZON_HL_SCRATCH, s1 = s0 + 1;
+
+    ho_hl_emit(&hl->code, "_%s:\n", hl->globals[fn->global].name);
+    for (int i = 0; i < fn->len_instrs; i++)
+    {
+        ho_hl_instr_t *instr = &fn->instrs[i];
+        const char *ra, *rb, *rd;
+        char imm[32];
+
+        switch (instr->op)
+        {
+            case HO_HL_I_CONST:
+                ho_hl_emit_const(hl, ho_hl_write(fn, instr->dst, s0), instr->imm);
+                ho_hl_written(hl, fn, instr->dst, s0);
+                break;
+
+            case HO_HL_I_MOV:
+                ra = ho_hl_read(hl, fn, instr->a, s0);
+                rd = ho_hl_write(fn, instr->dst, s0);
+                if (strcmp(ra, rd) != 0)
+                    ho_hl_emit(&hl->code, "    mov %s %s\n", rd, ra);
+                ho_hl_written(hl, fn, instr->dst, s0);
+                break;
+
+            case HO_HL_I_ALU:
+                ra = ho_hl_read(hl, fn, instr->a, s0);
+                sprintf(imm, "#%d", instr->imm);
+                rb = (instr->imm_arg) ? imm : ho_hl_read(hl, fn, instr->b, s1);
+                rd = ho_hl_write(fn, instr->dst, s0);
+                ho_hl_emit(&hl->code, "    %s %s %s %s\n", ho_hl_alu_names[instr->alu], rd, ra, rb);
+                ho_hl_written(hl, fn, instr->dst, s0);
+                break;
+
+            case HO_HL_I_NOT:
+                ra = ho_hl_read(hl, fn, instr->a, s0);
+                rd = ho_hl_write(fn, instr->dst, s0);
+                ho_hl_emit(&hl->code, "    not %s %s\n", rd, ra);
+                ho_hl_written(hl, fn, instr->dst, s0);
+                break;
+
+            case HO_HL_I_ADDR:
+                rd = ho_hl_write(fn, instr->dst, s0);
+                ho_hl_emit(&hl->code, "    li %s _%s\n", rd, hl->globals[instr->sym].name);
+                ho_hl_written(hl, fn, instr->dst, s0);
+                break;
+
+            case HO_HL_I_LOAD:
+                ho_hl_emit_address(hl, fn, instr, s0);
+                rd = ho_hl_write(fn, instr->dst, s0);
+                ho_hl_emit(&hl->code, "    load %s\n", rd);
+                ho_hl_written(hl, fn, instr->dst, s0);
+                break;
+
+            case HO_HL_I_STORE:
+                sprintf(imm, "#%d", instr->imm_value);
+                rb = (instr->imm_arg) ? imm : ho_hl_read(hl, fn, instr->b, s1);
+                ho_hl_emit_address(hl, fn, instr, s0);
+                ho_hl_emit(&hl->code, "    store %s\n", rb);
+                break;
+
+            case HO_HL_I_PARAM:
+                ho_hl_emit(&hl->code, "    pop %s\n", ho_hl_write(fn, instr->dst, s0));
+                ho_hl_written(hl, fn, instr->dst, s0);
+                break;
+
+            case HO_HL_I_ENTER:
+                if (fn->calls)
+                    ho_hl_emit(&hl->code, "    push lr\n");
+                break;
+
+            case HO_HL_I_CALL:
+                ho_hl_emit_call(hl, fn, live, i);
+                break;
+
+            case HO_HL_I_RET:
+                if (instr->a >= 0)
+                {
+                    ra = ho_hl_read(hl, fn, instr->a, s0);
+                    if (strcmp(ra, "r0") != 0)
+                        ho_hl_emit(&hl->code, "    mov r0 %s\n", ra);
+                }
+                if (fn->calls)
+                    ho_hl_emit(&hl->code, "    pop lr\n");
+                ho_hl_emit(&hl->code, "    return\n");
+                break;
+
+            case HO_HL_I_BR:
+                ra = ho_hl_read(hl, fn, instr->a, s0);
+                sprintf(imm, "#%d", instr->imm);
+                rb = (instr->imm_arg) ? imm : ho_hl_read(hl, fn, instr->b, s1);
+                ho_hl_emit(&hl->code, "    cmp %s %s\n", ra, rb);
+                ho_hl_emit(&hl->code, "    %s L%d\n", conds[(instr->alu == HO_HL_TOK_EQ) ? 0 : (instr->alu == HO_HL_TOK_NE) ? 1 : (instr->alu == '<') ? 2 : 3], instr->label);
+                break;
+
+            case HO_HL_I_JMP:
+                ho_hl_emit(&hl->code, "    jmp L%d\n", instr->label);
+                break;
+
+            case HO_HL_I_LABEL:
+                ho_hl_emit(&hl->code, "L%d:\n", instr->label);
+                break;
+        }
+    }
+}
+
+// Allocate registers for a parsed function and write its assembly
+static void ho_hl_gen_function(ho_hl_t *hl, ho_hl_func_t *fn)
+{
+    ho_hl_liveness_t live = { 0 };
+
+    ho_hl_cleanup(fn);
+    ho_hl_liveness(hl, fn, &live);
+    for (int v = 0; v < fn->len_vregs; v++)
+        fn->vregs[v].slot = -1;
+
+    // Keep two registers to load spilled values into if the others are not enough
+    if (ho_hl_scan(fn, &live, HORIZON_HL_REGISTERS))
+        ho_hl_scan(fn, &live, HORIZON_HL_REGISTERS - HORIZON_HL_SCRATCH);
+
+    ho_hl_emit_function(hl, fn, &live);
+    free(live.in);
+    free(live.out);
+}
+
+// Declarations
+
+static void ho_hl_function(ho_hl_t *hl)
+{
+    char name[HORIZON_IDENT_MAX_LEN + 1];
+    int line = hl->tok.line;
+    if (!ho_hl_name(hl, name))
+        return;
+
+    ho_hl_func_t fn = { 0 };
+    char params[HORIZON_HL_REGISTERS * 8][HORIZON_IDENT_MAX_LEN + 1];
+    int len_params = 0;
+    ho_hl_expect(hl, '(', "'('");
+    if (!ho_hl_accept(hl, ')'))
+    {
+        do
+        {
+            if (len_params >= sizeof(params) / sizeof(params[0]))
+            {
+                ho_hl_error(hl, hl->tok.line, "more than %d parameters", len_params);
+                ho_hl_skip_body(hl);
+                return;
+            }
+            if (!ho_hl_name(hl, params[len_params++]))
+            {
+                ho_hl_skip_body(hl);
+                return;
+            }
+        } while (ho_hl_accept(hl, ','));
+        if (!ho_hl_expect(hl, ')', "')'"))
+        {
+            ho_hl_skip_body(hl);
+            return;
+        }
+    }
+
+    fn.global = ho_hl_find_global(hl, name);
+    if (fn.global < 0)
+        fn.global = ho_hl_add_global(hl, name, HO_HL_FUNC, len_params, line);
+    else if (hl->globals[fn.global].kind != HO_HL_FUNC || hl->globals[fn.global].defined)
+    {
+        ho_hl_error(hl, line, "%s is already defined", name);
+        ho_hl_skip_body(hl);
+        return;
+    }
+    else if (hl->globals[fn.global].value != len_params)
+    {
+        ho_hl_error(hl, line, "%s is called with %d arguments", name, hl->globals[fn.global].value);
+        ho_hl_skip_body(hl);
+        return;
+    }
+    hl->globals[fn.global].defined = 1;
+
+    // Arguments are pushed in order, so the last one is popped first
+    hl->fn = &fn;
+    int *vregs = malloc(sizeof(int) * (len_params + 1));
+    for (int i = 0; i < len_params; i++)
+        vregs[i] = ho_hl_add_local(hl, params[i], line);
+    for (int i = len_params - 1; i >= 0; i--)
+        ho_hl_instr(&fn, HO_HL_I_PARAM)->dst = vregs[i];
+    ho_hl_instr(&fn, HO_HL_I_ENTER);
+    free(vregs);
+
+    int errors = hl->error_count;
+    if (ho_hl_expect(hl, '{', "'{'"))
+    {
+        ho_hl_block(hl);
+        ho_hl_instr(&fn, HO_HL_I_RET);
+        if (hl->error_count == errors)
+            ho_hl_gen_function(hl, &fn);
+    }
+
+    for (int i = 0; i < fn.len_instrs; i++)
+    {
+        free(fn.instrs[i].args);
+        free(fn.instrs[i].arg_values);
+    }
+    free(fn.instrs);
+    free(fn.vregs);
+    free(fn.locals);
+    hl->fn = NULL;
+}
+
+static void ho_hl_declaration(ho_hl_t *hl)
+{
+    char name[HORIZON_IDENT_MAX_LEN + 1];
+    int line = hl->tok.line;
+
+    if (ho_hl_is_keyword(hl, "func"))
+    {
+        ho_hl_next(hl);
+        ho_hl_function(hl);
+        return;
+    }
+    else if (ho_hl_is_keyword(hl, "const"))
+    {
+        ho_hl_next(hl);
+        if (!ho_hl_name(hl, name) || !ho_hl_expect(hl, '=', "'='"))
+            return;
+        int32_t value = ho_hl_const_expr(hl);
+        if (ho_hl_find_global(hl, name) >= 0)
+            ho_hl_error(hl, line, "%s is already defined", name);
+        else
+            ho_hl_add_global(hl, name, HO_HL_CONST, value, line);
+    }
+    else if (ho_hl_is_keyword(hl, "var"))
+    {
+        ho_hl_next(hl);
+        do
+        {
+            line = hl->tok.line;
+            if (!ho_hl_name(hl, name))
+                return;
+            int32_t value = (ho_hl_accept(hl, '=')) ? ho_hl_const_expr(hl) : 0;
+            if (ho_hl_find_global(hl, name) >= 0)
+                ho_hl_error(hl, line, "%s is already defined", name);
+            ho_hl_add_global(hl, name, HO_HL_VAR, 0, line);
+            ho_hl_emit(&hl->data, ".var _%s %d\n", name, value);
+        } while (ho_hl_accept(hl, ','));
+    }
+    else if (ho_hl_is_keyword(hl, "array"))
+    {
+        ho_hl_next(hl);
+        if (!ho_hl_name(hl, name) || !ho_hl_expect(hl, '[', "'['"))
+            return;
+        int32_t len = (hl->tok.type != ']') ? ho_hl_const_expr(hl) : -1;
+        ho_hl_expect(hl, ']', "']'");
+
+        ho_hl_text_t values = { 0 };
+        int len_values = 0;
+        ho_hl_emit(&values, "0");
+        if (ho_hl_accept(hl, '=') && ho_hl_expect(hl, '{', "'{'"))
+        {
+            values.len = 0;
+            while (hl->tok.type != '}' && !hl->panic)
+            {
+                ho_hl_emit(&values, "%s%d", (len_values++) ? ", " : "", ho_hl_const_expr(hl));
+                if (!ho_hl_accept(hl, ','))
+                    break;
+            }
+            ho_hl_expect(hl, '}', "'}'");
+            if (len_values == 0)
+                ho_hl_emit(&values, "0");
+        }
+
+        if (len < 0)
+            len = len_values;
+        if (len <= 0 || len > UINT16_MAX)
+            ho_hl_error(hl, line, "the length of an array must be from 1 to %d", UINT16_MAX);
+        else if (len_values > len)
+            ho_hl_error(hl, line, "more than %d values for %s", len, name);
+        if (ho_hl_find_global(hl, name) >= 0)
+            ho_hl_error(hl, line, "%s is already defined", name);
+        ho_hl_add_global(hl, name, HO_HL_ARRAY, len, line);
+        ho_hl_emit(&hl->data, ".array _%s [%d] { %s }\n", name, len, values.s);
+        free(values.s);
+    }
+    else
+    {
+        ho_hl_error(hl, line, "expected const, var, array or func");
+        ho_hl_next(hl);
+    }
+    ho_hl_expect(hl, ';', "';'");
+}
+
+// Returns 1 if path is a program in the structured language, by its extension
+int horizon_hl_source(const char *path)
+{
+    int len = strlen(path);
+    int ext = strlen(HORIZON_HL_EXT);
+    return len > ext && strcmp(path + len - ext, HORIZON_HL_EXT) == 0;
+}
+
+// Compile a null-terminated program in the structured language to Horizon assembly
+char *horizon_hl_compile(const char *src, const char *path, int *error_count)
+{
+    ho_hl_t hl = { 0 };
+    hl.p = src;
+    hl.line = 1;
+    hl.path = path;
+
+    ho_hl_emit(&hl.code, ".start\n    call _main\n    halt\n");
+    ho_hl_next(&hl);
+    while (hl.tok.type != HO_HL_TOK_EOF)
+    {
+        ho_hl_declaration(&hl);
+        if (hl.panic)
+            ho_hl_sync(&hl);
+        ho_hl_free_nodes(&hl);
+    }
+
+    for (int i = 0; i < hl.len_globals; i++)
+    {
+        if (hl.globals[i].kind == HO_HL_FUNC && !hl.globals[i].defined)
+        {
+            ho_hl_error(&hl, hl.globals[i].line, "function %s is not defined", hl.globals[i].name);
+            hl.panic = 0;
+        }
+    }
+    int main = ho_hl_find_global(&hl, "main");
+    if (main < 0 || hl.globals[main].kind != HO_HL_FUNC || hl.globals[main].value != 0)
+        ho_hl_error(&hl, hl.line, "expected a function main without parameters");
+
+    char *text = NULL;
+    if (hl.error_count == 0)
+    {
+        // Data directives must come before the instructions
+        text = malloc(hl.data.len + hl.code.len + 1);
+        memcpy(text, hl.data.s, hl.data.len);
+        memcpy(text + hl.data.len, hl.code.s, hl.code.len + 1);
+    }
+
+    *error_count = hl.error_count;
+    free(hl.nodes);
+    free(hl.globals);
+    free(hl.data.s);
+    free(hl.code.s);
+    return text;
+}
+
+// Read a program in the structured language from fd and compile it
+FILE *horizon_hl_open(FILE *fd, const char *path, char **asm_text, int *error_count)
+{
+    int len = 0, mapped = 0;
+    char *src = horizon_read_source(fd, &len, &mapped);
+    *asm_text = horizon_hl_compile(src, path, error_count);
+    horizon_free_source(src, len, mapped);
+    if (*asm_text == NULL)
+        return NULL;
+
+    return fmemopen(*asm_text, strlen(*asm_text), "r");
+}
@@ -0,0 +1,34 @@
+#ifndef HORIZON_HL_H
+#define HORIZON_HL_H
+
+#include <stdio.h>
+
+// Extension of programs in the structured language, see doc/hl.md
+#define HORIZON_HL_EXT              ".hl"
+// Extension of the assembly written by fcc -S
+#define HORIZON_HL_ASM_EXT          ".s"
+
+// Registers the allocator assigns to values, R0 up to R11
+#define HORIZON_HL_REGISTERS        12
+// Registers kept free to load spilled values into when the others run out
+#define HORIZON_HL_SCRATCH          2
+// Nesting depth of loops for break and continue
+#define HORIZON_HL_MAX_LOOP_DEPTH   64
+
+// Returns 1 if path is a program in the structured language, by its extension
+int horizon_hl_source(const char *path);
+
+// Compile a null-terminated program in the structured language to Horizon assembly
+// Errors are printed with the line they are on and the path, if not NULL, and counted
+// in error_count.
+// Returns a newly allocated null-terminated assembly text to be parsed like any other
+// program, or NULL if the program has errors.
+char *horizon_hl_compile(const char *src, const char *path, int *error_count);
+
+// Read a program in the structured language from fd and compile it
+// Returns a stream over the assembly, to be passed to horizon_parse_cached, or NULL
+// if the program has errors. asm_text is set to the assembly, free it after closing
+// the stream. error_count is set as by horizon_hl_compile.
+FILE *horizon_hl_open(FILE *fd, const char *path, char **asm_text, int *error_count);
+
+#endif // HORIZON_HL_H
@@ -0,0 +1,311 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../helpers.h"
+#include "horizon_linker.h"
+#include "horizon_parser.h"
+
+// Write a program parsed with horizon_set_relocatable(1) as an object file
+// Returns 0 on success, or the number of errors found, e.g. symbols exported with
+// .global which are not defined as variables or labels
+int horizon_object_write(FILE *fd, horizon_program_t *program)
+{
+    // The program section starts after the start jump and the data
+    int code_base = program->data_offset + program->len_data;
+    int error_count = 0;
+
+    // Resolve exports first, nothing is written if any of them is wrong
+    horizon_export_t *exports = malloc(sizeof(horizon_export_t) * (program->len_globals + 1));
+    for (int i = 0; i < program->len_globals; i++)
+    {
+        symbol_t symbol = { 0 };
+        exports[i].name = program->globals[i];
+        if (!ho_get_symbol(*program, &symbol, program->globals[i]))
+            symbol.type = -1;
+
+        if (symbol.type == HO_SYM_VAR)
+        {
+            exports[i].kind = HO_RELOC_DATA;
+            exports[i].offset = symbol.value - program->data_offset;
+        }
+        else if (symbol.type == HO_SYM_LABEL)
+        {
+            exports[i].kind = HO_RELOC_CODE;
+            exports[i].offset = symbol.value - code_base;
+        }
+        else
+        {
+            printf("Error: %s is exported with .global, but is not a variable or label\n", program->globals[i]);
+            error_count++;
+        }
+    }
+    if (error_count)
+    {
+        free(exports);
+        return error_count;
+    }
+
+    fwrite(HORIZON_OBJECT_MAGIC, 1, 4, fd);
+    fwrite_u32(fd, HORIZON_OBJECT_VERSION);
+    fwrite_u32(fd, program->len_data);
+    fwrite_u32(fd, program->len_code - code_base);
+    fwrite_u32(fd, program->code_start);
+    fwrite_u32(fd, program->start_set);
+    fwrite_u32(fd, program->len_globals);
+    fwrite_u32(fd, program->len_relocs);
+
+    for (int i = 0; i < program->len_data; i++)
+        fwrite_u32(fd, program->data[i]);
+    for (int i = code_base; i < program->len_code; i++)
+        fwrite_u32(fd, program->code[i] & 0xFFFFFFFF);
+
+    for (int i = 0; i < program->len_globals; i++)
+    {
+        fwrite_str(fd, exports[i].name);
+        fwrite_u32(fd, exports[i].kind);
+        fwrite_u32(fd, exports[i].offset);
+    }
+
+    for (int i = 0; i < program->len_relocs; i++)
+    {
+        fwrite_u32(fd, program->relocs[i].offset - code_base);
+        fwrite_u32(fd, program->relocs[i].field);
+        fwrite_u32(fd, program->relocs[i].kind);
+        fwrite_str(fd, program->relocs[i].import);
+    }
+
+    fwrite_str(fd, program->name);
+    fwrite_str(fd, program->desc);
+
+    free(exports);
+    return ferror(fd) ? 1 : 0;
+}
+
+// Read an object file written by horizon_object_write
+// Returns a newly allocated object to be freed with horizon_object_free, or NULL
+// if the file is not a valid object file
+horizon_object_t *horizon_object_read(FILE *fd, const char *path)
+{
+    horizon_object_t *object = calloc(1, sizeof(horizon_object_t));
+    object->path = strdup(path);
+
+    char magic[4] = { 0 };
+    uint32_t version, len_data, len_code, code_start, start_set, len_exports, len_relocs;
+    int err = 0;
+
+    err |= fread(magic, 1, 4, fd) != 4 || memcmp(magic, HORIZON_OBJECT_MAGIC, 4) != 0;
+    err |= fread_u32(fd, &version) || version != HORIZON_OBJECT_VERSION;
+    err |= fread_u32(fd, &len_data) || fread_u32(fd, &len_code);
+    err |= fread_u32(fd, &code_start) || fread_u32(fd, &start_set);
+    err |= fread_u32(fd, &len_exports) || fread_u32(fd, &len_relocs);
+    // Every address in a program fits in 16 bits
+    err |= len_data > UINT16_MAX || len_code > UINT16_MAX || len_exports > UINT16_MAX || len_relocs > UINT16_MAX;
+    if (err)
+        goto horizon_object_read_invalid;
+
+    object->code_start = code_start;
+    object->start_set = start_set;
+
+    object->data = malloc(sizeof(uint32_t) * (len_data + 1));
+    for (int i = 0; i < len_data && !err; i++, object->len_data++)
+        err |= fread_u32(fd, &object->data[i]);
+
+    object->code = malloc(sizeof(uint32_t) * (len_code + 1));
+    for (int i = 0; i < len_code && !err; i++, object->len_code++)
+        err |= fread_u32(fd, &object->code[i]);
+
+    object->exports = calloc(len_exports + 1, sizeof(horizon_export_t));
+    for (int i = 0; i < len_exports && !err; i++, object->len_exports++)
+    {
+        uint32_t kind, offset;
+        err |= fread_str(fd, &object->exports[i].name) || object->exports[i].name == NULL;
+        err |= fread_u32(fd, &kind) || fread_u32(fd, &offset);
+        object->exports[i].kind = kind;
+        object->exports[i].offset = offset;
+    }
+
+    object->relocs = calloc(len_relocs + 1, sizeof(horizon_reloc_t));
+    for (int i = 0; i < len_relocs && !err; i++, object->len_relocs++)
+    {
+        uint32_t offset, field, kind;
+        err |= fread_u32(fd, &offset) || fread_u32(fd, &field) || fread_u32(fd, &kind);
+        err |= fread_str(fd, &object->relocs[i].import);
+        err |= offset >= len_code || (kind == HO_RELOC_IMPORT && object->relocs[i].import == NULL);
+        object->relocs[i].offset = offset;
+        object->relocs[i].field = field;
+        object->relocs[i].kind = kind;
+    }
+
+    err |= fread_str(fd, &object->name);
+    err |= fread_str(fd, &object->desc);
+    if (err)
+        goto horizon_object_read_invalid;
+
+    return object;
+
+horizon_object_read_invalid:
+    horizon_object_free(object);
+    return NULL;
+}
+
+// Frees memory allocated by horizon_object_read
+void horizon_object_free(horizon_object_t *object)
+{
+    if (!object)
+        return;
+
+    for (int i = 0; i < object->len_exports; i++)
+        free(object->exports[i].name);
+    for (int i = 0; i < object->len_relocs; i++)
+        free(object->relocs[i].import);
+    free(object->exports);
+    free(object->relocs);
+    free(object->data);
+    free(object->code);
+    free(object->name);
+    free(object->desc);
+    free(object->path);
+    free(object);
+}
+
+// Address of a symbol exported by an object, given where its sections were placed
+static int ho_export_address(horizon_export_t *export, int data_base, int code_base)
+{
+    return export->offset + ((export->kind == HO_RELOC_DATA) ? data_base : code_base);
+}
+
+// Link object files into a program in the same layout fcc produces: the start
+// jump, the data sections of every object in order, then their program sections.
+// Returns the pointer to a newly allocated horizon_program_t with the code, name and
+// description set, to be freed with horizon_free. Errors are printed and counted in
+// its error_count.
+horizon_program_t *horizon_link(horizon_object_t **objects, int len_objects)
+{
+    horizon_program_t *program = calloc(1, sizeof(horizon_program_t));
+    program->arch = ARCH_HORIZON;
+    program->data_offset = 1;
+
+    // Place the sections
+    int *data_base = malloc(sizeof(int) * (len_objects + 1));
+    int *code_base = malloc(sizeof(int) * (len_objects + 1));
+    int len_code = 0;
+    for (int i = 0; i < len_objects; i++)
+    {
+        data_base[i] = program->data_offset + program->len_data;
+        program->len_data += objects[i]->len_data;
+    }
+    for (int i = 0; i < len_objects; i++)
+    {
+        code_base[i] = program->data_offset + program->len_data + len_code;
+        len_code += objects[i]->len_code;
+    }
+
+    // Every exported symbol must be unique
+    for (int i = 0; i < len_objects; i++)
+    {
+        for (int j = 0; j < objects[i]->len_exports; j++)
+        {
+            for (int k = 0; k <= i; k++)
+            {
+                for (int l = 0; l < ((k == i) ? j : objects[k]->len_exports); l++)
+                {
+                    if (strcmp(objects[i]->exports[j].name, objects[k]->exports[l].name) == 0)
+                    {
+                        printf("Error: %s is exported by both %s and %s\n", objects[i]->exports[j].name, objects[k]->path, objects[i]->path);
+                        program->error_count++;
+                    }
+                }
+            }
+        }
+    }
+
+    // The entry point is the one set with .start, or the start of the first object
+    int entry = (len_objects > 0) ? code_base[0] + objects[0]->code_start : program->data_offset;
+    int entry_object = -1;
+    for (int i = 0; i < len_objects; i++)
+    {
+        if (!objects[i]->start_set)
+            continue;
+        if (entry_object >= 0)
+        {
+            printf("Error: both %s and %s set the entry point with .start\n", objects[entry_object]->path, objects[i]->path);
+            program->error_count++;
+        }
+        entry_object = i;
+        entry = code_base[i] + objects[i]->code_start;
+    }
+
+    program->len_code = program->len_code_space = program->data_offset + program->len_data + len_code;
+    program->code = malloc(sizeof(int64_t) * (program->len_code + 1));
+    program->code[0] = (int64_t) (HO_JMP | (1 << 7)) << 24 | (entry & 0xFFFF);
+    if (entry > UINT16_MAX)
+    {
+        printf("Error: the entry point is out of range at address %d\n", entry);
+        program->error_count++;
+    }
+
+    for (int i = 0; i < len_objects; i++)
+    {
+        horizon_object_t *object = objects[i];
+        for (int j = 0; j < object->len_data; j++)
+            program->code[data_base[i] + j] = object->data[j];
+        for (int j = 0; j < object->len_code; j++)
+            program->code[code_base[i] + j] = object->code[j];
+
+        if (!program->name && object->name)
+            program->name = strdup(object->name);
+        if (!program->desc && object->desc)
+            program->desc = strdup(object->desc);
+
+        // Addresses in the object assume it is the only one, with its data at
+        // address 1 and its program section right after
+        for (int j = 0; j < object->len_relocs; j++)
+        {
+            horizon_reloc_t *reloc = &object->relocs[j];
+            int64_t *word = &program->code[code_base[i] + reloc->offset];
+            uint32_t mask = (reloc->field == HO_RELOC_IMM8) ? UINT8_MAX : UINT16_MAX;
+            int64_t value = *word & mask;
+
+            if (reloc->kind == HO_RELOC_CODE)
+                value += code_base[i] - (program->data_offset + object->len_data);
+            else if (reloc->kind == HO_RELOC_DATA)
+                value += data_base[i] - program->data_offset;
+            else if (reloc->kind == HO_RELOC_IMPORT)
+            {
+                int found = 0;
+                for (int k = 0; k < len_objects && !found; k++)
+                {
+                    for (int l = 0; l < objects[k]->len_exports && !found; l++)
+                    {
+                        if (strcmp(reloc->import, objects[k]->exports[l].name) == 0)
+                        {
+                            // The field holds the offset from the symbol
+                            value += ho_export_address(&objects[k]->exports[l], data_base[k], code_base[k]);
+                            found = 1;
+                        }
+                    }
+                }
+                if (!found)
+                {
+                    printf("Error: undefined symbol %s in %s\n", reloc->import, object->path);
+                    program->error_count++;
+                    continue;
+                }
+            }
+
+            if (value > mask)
+            {
+                printf("Error: address of %s is out of range in %s (%ld, max %u)\n", (reloc->import) ? reloc->import : "symbol", object->path, (long) value, mask);
+                program->error_count++;
+                continue;
+            }
+            *word = (*word & ~(int64_t) mask) | value;
+        }
+    }
+
+    free(data_base);
+    free(code_base);
+    return program;
+}
@@ -0,0 +1,62 @@
+#ifndef HORIZON_LINKER_H
+#define HORIZON_LINKER_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "horizon_parser.h"
+
+#define HORIZON_OBJECT_VERSION      1
+#define HORIZON_OBJECT_MAGIC        "FCHO"
+#define HORIZON_OBJECT_EXT          ".o"
+
+// Symbol defined by an object file and exported with .global
+typedef struct {
+    char *name;             // malloced
+    int kind;               // HO_RELOC_CODE or HO_RELOC_DATA
+    int offset;             // relative to the start of its section
+} horizon_export_t;
+
+// Relocatable object file: a program assembled on its own, with the data section
+// at address 1 and the program section right after it. The linker moves both
+// sections and adjusts the addresses in every relocation.
+typedef struct {
+    char *path;             // malloced, for error messages
+
+    int len_data;
+    uint32_t *data;         // malloced
+    int len_code;
+    uint32_t *code;         // malloced, program section only
+    int code_start;         // relative to the start of the program section
+    int start_set;          // 1 if the entry point was set with .start
+
+    int len_exports;
+    horizon_export_t *exports;  // malloced
+    int len_relocs;
+    horizon_reloc_t *relocs;    // malloced, offsets relative to the start of the program section
+
+    char *name;             // malloced, optional
+    char *desc;             // malloced, optional
+} horizon_object_t;
+
+// Write a program parsed with horizon_set_relocatable(1) as an object file
+// Returns 0 on success, or the number of errors found, e.g. symbols exported with
+// .global which are not defined as variables or labels
+int horizon_object_write(FILE *fd, horizon_program_t *program);
+
+// Read an object file written by horizon_object_write
+// Returns a newly allocated object to be freed with horizon_object_free, or NULL
+// if the file is not a valid object file
+horizon_object_t *horizon_object_read(FILE *fd, const char *path);
+
+// Frees memory allocated by horizon_object_read
+void horizon_object_free(horizon_object_t *object);
+
+// Link object files into a program in the same layout fcc produces: the start
+// jump, the data sections of every object in order, then their program sections.
+// Returns the pointer to a newly allocated horizon_program_t with the code, name and
+// description set, to be freed with horizon_free. Errors are printed and counted in
+// its error_count.
+horizon_program_t *horizon_link(horizon_object_t **objects, int len_objects);
+
+#endif // HORIZON_LINKER_H
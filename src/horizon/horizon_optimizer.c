@@ -0,0 +1,3570 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "horizon_optimizer.h"
+#include "horizon_parser.h"
+#include "horizon_profile.h"
+#include "horizon_vm.h"
+
+// State of every instruction in the program section during optimization
+typedef struct {
+    int reloc;              // index of its relocation in program->relocs, -1 if none
+    int target;             // jumped to or its address is taken, it must stay addressable
+    int pinned;             // between a PC-relative reference and its destination, it
+                            //  can't be removed without changing the distance
+    int deleted;
+    int moved_before;       // index of the instruction it is moved in front of, -1 if none
+    uint32_t live_in;       // registers and flags read before being written from here on,
+    uint32_t live_out;      //  bits from ho_opt_reg_bit, HO_OPT_FLAGS_ZN and HO_OPT_FLAGS_V
+} ho_opt_instr_t;
+
+typedef struct {
+    horizon_program_t *program;
+    ho_opt_instr_t *instrs; // malloced
+    int base;               // index of the first instruction of the program section in code
+    int len;                // number of instructions in the program section
+} ho_opt_t;
+
+#define HO_OPT_OP(word)     (((word) >> 24) & 0x7F)
+#define HO_OPT_IMM(word)    (((word) >> 31) & 1)
+#define HO_OPT_RD(word)     (((word) >> 16) & 0xFF)
+#define HO_OPT_RM(word)     (((word) >> 8) & 0xFF)
+#define HO_OPT_RN(word)     ((word) & 0xFF)
+
+// Liveness bits after the registers R0-LR
+#define HO_OPT_FLAGS_ZN     (1 << 16)
+#define HO_OPT_FLAGS_V      (1 << 17)
+#define HO_OPT_LIVE_ALL     0x3FFFF
+
+static int ho_opt_is_alu(int op)
+{
+    return (op >= HO_ADD && op <= HO_HCAT) || (op >= HO_ADDS && op <= HO_HCATS);
+}
+
+static int ho_opt_is_jump(int op)
+{
+    return op >= HO_JEQ && op <= HO_JMP;
+}
+
+static uint32_t ho_opt_word(ho_opt_t *opt, int i)
+{
+    return opt->program->code[opt->base + i] & 0xFFFFFFFF;
+}
+
+static uint32_t ho_opt_reloc_mask(horizon_reloc_t *reloc)
+{
+    return (reloc->field == HO_RELOC_IMM8) ? UINT8_MAX : UINT16_MAX;
+}
+
+// Index of the first instruction at or after i which is not deleted, or len
+static int ho_opt_live(ho_opt_t *opt, int i)
+{
+    while (i < opt->len && opt->instrs[i].deleted)
+        i++;
+    return i;
+}
+
+// Index of the instruction a jump to a label goes to, or -1 if it is not one
+// Deleted instructions have no effect, so the jump goes to the next one left.
+static int ho_opt_jump_target(ho_opt_t *opt, int i)
+{
+    uint32_t word = ho_opt_word(opt, i);
+    int r = opt->instrs[i].reloc;
+    if (!ho_opt_is_jump(HO_OPT_OP(word)) || !HO_OPT_IMM(word) || r < 0 || opt->program->relocs[r].kind != HO_RELOC_CODE)
+        return -1;
+
+    int t = (int) (word & 0xFFFF) - opt->base;
+    if (t < 0 || t > opt->len)
+        return -1;
+    return ho_opt_live(opt, t);
+}
+
+// Follow unconditional jumps to labels starting at instruction t
+static int ho_opt_thread(ho_opt_t *opt, int t)
+{
+    for (int hops = 0; t < opt->len && hops < opt->len; hops++)
+    {
+        uint32_t word = ho_opt_word(opt, t);
+        int next = ho_opt_jump_target(opt, t);
+        if (HO_OPT_OP(word) != HO_JMP || next < 0 || next == t)
+            break;
+        t = next;
+    }
+    return t;
+}
+
+static void ho_opt_set_field(ho_opt_t *opt, int i, uint32_t value)
+{
+    horizon_reloc_t *reloc = &opt->program->relocs[opt->instrs[i].reloc];
+    uint32_t mask = ho_opt_reloc_mask(reloc);
+    int64_t *word = &opt->program->code[opt->base + i];
+    *word = (*word & ~(int64_t) mask) | (value & mask);
+}
+
+// Check if the overflow flag is written before it is read on every path starting
+// at instruction i. Only ADDS and SUBS write it, the other flag-setting instructions
+// only change zero and negative. Paths are followed through jumps to labels for at
+// most *budget instructions, anything else is taken as a read.
+static int ho_opt_overflow_dead(ho_opt_t *opt, int i, int *budget)
+{
+    while (i < opt->len)
+    {
+        if (--*budget < 0)
+            return 0;
+        if (opt->instrs[i].deleted)
+        {
+            i++;
+            continue;
+        }
+
+        uint32_t word = ho_opt_word(opt, i);
+        int op = HO_OPT_OP(word);
+        if (op == HO_ADDS || op == HO_SUBS)
+            return 1;
+        if (word == HOVM_HALT)
+            return 1;
+        if (!ho_opt_is_jump(op))
+        {
+            i++;
+            continue;
+        }
+
+        switch (op)
+        {
+        case HO_JLT: case HO_JGT: case HO_JLE: case HO_JGE: case HO_JVS: case HO_JVC:
+            return 0;
+        default:
+            break;
+        }
+
+        int t = ho_opt_jump_target(opt, i);
+        if (t < 0)
+            return 0;
+        if (op == HO_JMP)
+        {
+            i = t;
+            continue;
+        }
+        if (!ho_opt_overflow_dead(opt, t, budget))
+            return 0;
+        i++;
+    }
+
+    // Running past the end of the program
+    return 0;
+}
+
+// Allocate the state of every instruction in the program section
+static void ho_opt_init_instrs(ho_opt_t *opt)
+{
+    horizon_program_t *program = opt->program;
+
+    opt->instrs = calloc(opt->len, sizeof(ho_opt_instr_t));
+    for (int i = 0; i < opt->len; i++)
+    {
+        opt->instrs[i].reloc = -1;
+        opt->instrs[i].moved_before = -1;
+    }
+    for (int i = 0; i < program->len_relocs; i++)
+    {
+        int at = program->relocs[i].offset - opt->base;
+        if (at >= 0 && at < opt->len)
+            opt->instrs[at].reloc = i;
+    }
+}
+
+// Mark instructions which must stay addressable, these are recomputed every pass as
+// rewrites change jump targets
+static void ho_opt_mark_targets(ho_opt_t *opt)
+{
+    horizon_program_t *program = opt->program;
+
+    for (int i = 0; i < opt->len; i++)
+        opt->instrs[i].target = 0;
+
+    for (int i = 0; i < program->len_symbols; i++)
+    {
+        int t = (int) program->symbols[i].value - opt->base;
+        if (program->symbols[i].type == HO_SYM_LABEL && t >= 0 && t < opt->len)
+            opt->instrs[t].target = 1;
+    }
+    for (int i = 0; i < opt->len; i++)
+    {
+        int r = opt->instrs[i].reloc;
+        if (opt->instrs[i].deleted || r < 0 || program->relocs[r].kind != HO_RELOC_CODE)
+            continue;
+        int t = (int) (ho_opt_word(opt, i) & ho_opt_reloc_mask(&program->relocs[r])) - opt->base;
+        if (t >= 0 && t < opt->len)
+            opt->instrs[ho_opt_live(opt, t)].target = 1;
+    }
+    if (program->code_start >= 0 && program->code_start < opt->len)
+        opt->instrs[ho_opt_live(opt, program->code_start)].target = 1;
+}
+
+// Find the PC-relative windows, e.g. from CALL, which must keep their length
+// Returns 1 if instructions can be removed, or 0 if addresses are used in a way that
+// can't be followed
+static int ho_opt_mark_pinned(ho_opt_t *opt)
+{
+    for (int i = 0; i < opt->len; i++)
+    {
+        uint32_t word = ho_opt_word(opt, i);
+        int op = HO_OPT_OP(word);
+        int imm = HO_OPT_IMM(word);
+
+        if (ho_opt_is_alu(op))
+        {
+            int reads_pc = HO_OPT_RM(word) == HO_PC || (!imm && op != HO_NOT && op != HO_NOTS && HO_OPT_RN(word) == HO_PC);
+            if (!reads_pc)
+                continue;
+
+            // Only PC plus or minus a constant is understood
+            int k = (int8_t) HO_OPT_RN(word);
+            if (!imm || HO_OPT_RM(word) != HO_PC || (op & 0xF) > HO_SUB)
+                return 0;
+            if ((op & 0xF) == HO_SUB)
+                k = -k;
+
+            int from = (k < 0) ? i + k : i;
+            int to = (k < 0) ? i : i + k;
+            for (int j = (from < 0) ? 0 : from; j <= to && j < opt->len; j++)
+                opt->instrs[j].pinned = 1;
+        }
+        else if ((op == HO_STORE || op == HO_STOREI || op == HO_STORED || op == HO_PUSH) && !imm && HO_OPT_RM(word) == HO_PC)
+        {
+            // Storing the address of an instruction
+            return 0;
+        }
+        else if (ho_opt_is_jump(op) && imm && opt->instrs[i].reloc < 0 && (int) (word & 0xFFFF) >= opt->base)
+        {
+            // Jump to a literal address in the program section
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+// One pass of rewrites, returns the number of changes made
+static int ho_opt_pass(ho_opt_t *opt, int can_remove)
+{
+    horizon_program_t *program = opt->program;
+    int changes = 0;
+
+    ho_opt_mark_targets(opt);
+
+    // The start jump
+    int entry = ho_opt_live(opt, program->code_start);
+    int threaded = ho_opt_thread(opt, entry);
+    if (threaded != entry && threaded < opt->len)
+    {
+        program->code_start = threaded;
+        changes++;
+    }
+
+    for (int i = ho_opt_live(opt, 0); i < opt->len; i = ho_opt_live(opt, i + 1))
+    {
+        ho_opt_instr_t *instr = &opt->instrs[i];
+        uint32_t word = ho_opt_word(opt, i);
+        int op = HO_OPT_OP(word);
+        int imm = HO_OPT_IMM(word);
+        int rd = HO_OPT_RD(word);
+        int rm = HO_OPT_RM(word);
+        int rn = HO_OPT_RN(word);
+
+        // Jumps to jumps go to the last one directly
+        int t = ho_opt_jump_target(opt, i);
+        if (t >= 0)
+        {
+            int final = ho_opt_thread(opt, t);
+            if (final != t && final < opt->len)
+            {
+                ho_opt_set_field(opt, i, opt->base + final);
+                t = final;
+                changes++;
+            }
+        }
+
+        if (!can_remove)
+            continue;
+
+        int j = ho_opt_live(opt, i + 1);
+        int j_free = j < opt->len && !opt->instrs[j].target && !opt->instrs[j].pinned;
+
+        // Jumps to the next instruction
+        if (t >= 0 && t == j && !instr->pinned)
+        {
+            instr->deleted = 1;
+            changes++;
+            continue;
+        }
+
+        if (ho_opt_is_alu(op) && op <= HO_HCAT && rd != HO_PC && !instr->pinned)
+        {
+            // Results written to NIL without setting flags are discarded
+            int dead = rd == HO_NIL;
+            // Moves of a register to itself
+            if (!imm)
+                dead |= rd == rm && rn == HO_NIL && (op == HO_ADD || op == HO_SUB || op == HO_OR || op == HO_XOR);
+            if (!imm)
+                dead |= rd == rn && rm == HO_NIL && (op == HO_ADD || op == HO_OR || op == HO_XOR);
+            if (imm && instr->reloc < 0)
+                dead |= rd == rm && rn == 0 && (op == HO_ADD || op == HO_SUB || op == HO_LSH || op == HO_RSH || op == HO_OR || op == HO_XOR);
+            if (dead)
+            {
+                instr->deleted = 1;
+                changes++;
+                continue;
+            }
+        }
+        if (op == HO_LOAD && rd == HO_NIL && !instr->pinned)
+        {
+            instr->deleted = 1;
+            changes++;
+            continue;
+        }
+
+        if (!j_free)
+            continue;
+        uint32_t next = ho_opt_word(opt, j);
+
+        // Stepping AR by 1 after a memory access: LOAD rd, ADD AR AR #1 -> LOADI rd
+        // The VM steps AR after the access even if it is out of range, like the ADD
+        int steps_ar = HO_OPT_IMM(next) && opt->instrs[j].reloc < 0 && HO_OPT_RD(next) == HO_AR && HO_OPT_RM(next) == HO_AR;
+        int ar_step = 0;
+        if (steps_ar && ((HO_OPT_OP(next) == HO_ADD && HO_OPT_RN(next) == 1) || (HO_OPT_OP(next) == HO_SUB && HO_OPT_RN(next) == 0xFF)))
+            ar_step = 2;
+        if (steps_ar && ((HO_OPT_OP(next) == HO_SUB && HO_OPT_RN(next) == 1) || (HO_OPT_OP(next) == HO_ADD && HO_OPT_RN(next) == 0xFF)))
+            ar_step = 4;
+        if (ar_step && (op == HO_STORE || (op == HO_LOAD && rd != HO_PC)))
+        {
+            program->code[opt->base + i] += (int64_t) ar_step << 24;
+            opt->instrs[j].deleted = 1;
+            changes++;
+            continue;
+        }
+
+        // MOV16 of a constant which fits in an imm8: PUSH #imm, POP rd -> ADD rd NIL #imm
+        // PUSH zero extends its 16-bit immediate, imm8 is sign extended, so only up to 127
+        if (op == HO_PUSH && imm && instr->reloc < 0 && (word & 0xFFFF) <= INT8_MAX &&
+            HO_OPT_OP(next) == HO_POP && HO_OPT_RD(next) != HO_SP && HO_OPT_RD(next) != HO_PC)
+        {
+            program->code[opt->base + i] = (int64_t) (HO_ADD | (1 << 7)) << 24 | HO_OPT_RD(next) << 16 | HO_NIL << 8 | (word & 0xFF);
+            opt->instrs[j].deleted = 1;
+            changes++;
+            continue;
+        }
+
+        // Compare with zero after an ADD or SUB: ADD rd ..., CMP rd #0 -> ADDS rd ...
+        // The zero and negative flags are the same, the overflow flag is 0 after the
+        // compare, so it may not be read before it is written again
+        int is_cmp_zero = HO_OPT_OP(next) == HO_SUBS && HO_OPT_RD(next) == HO_NIL && HO_OPT_RM(next) == rd &&
+            ((HO_OPT_IMM(next) && HO_OPT_RN(next) == 0) || (!HO_OPT_IMM(next) && HO_OPT_RN(next) == HO_NIL));
+        if ((op == HO_ADD || op == HO_SUB) && rd != HO_NIL && rd != HO_PC && is_cmp_zero && opt->instrs[j].reloc < 0)
+        {
+            int budget = HORIZON_OPT_MAX_FLAG_SCAN;
+            if (ho_opt_overflow_dead(opt, ho_opt_live(opt, j + 1), &budget))
+            {
+                program->code[opt->base + i] |= (int64_t) 0x10 << 24;
+                opt->instrs[j].deleted = 1;
+                changes++;
+                continue;
+            }
+        }
+    }
+
+    return changes;
+}
+
+// Dataflow passes
+// Instead of lifting the program into SSA form and lowering it back, which would
+// need a register allocator for a machine with 12 general purpose registers, these
+// work on the instruction stream directly: liveness is computed over the whole
+// control-flow graph, values are numbered within basic blocks, which gives the
+// same facts as SSA there, and loops are found from their back edges.
+
+// Liveness bit of a register, 0 for NIL and PC which are not tracked
+static uint32_t ho_opt_reg_bit(int reg)
+{
+    return (reg < HO_PC) ? 1 << reg : 0;
+}
+
+// Registers and flags read by instruction i, and the ones it always writes
+// LOAD and POP don't write their register if AR or SP is out of range, so only the
+// address registers are killed by them
+static void ho_opt_use_kill(ho_opt_t *opt, int i, uint32_t *use, uint32_t *kill)
+{
+    uint32_t word = ho_opt_word(opt, i);
+    int op = HO_OPT_OP(word);
+    int imm = HO_OPT_IMM(word);
+    int rm = HO_OPT_RM(word);
+
+    *use = 0;
+    *kill = 0;
+    if (ho_opt_is_alu(op))
+    {
+        *use = ho_opt_reg_bit(rm);
+        if (!imm && (op & 0xF) != HO_NOT)
+            *use |= ho_opt_reg_bit(HO_OPT_RN(word));
+        *kill = ho_opt_reg_bit(HO_OPT_RD(word));
+        if (op & 0x10)
+            *kill |= HO_OPT_FLAGS_ZN | ((op == HO_ADDS || op == HO_SUBS) ? HO_OPT_FLAGS_V : 0);
+        return;
+    }
+
+    switch (op)
+    {
+    case HO_JEQ: case HO_JNE: case HO_JNG: case HO_JPZ:
+        *use = HO_OPT_FLAGS_ZN;
+        break;
+    case HO_JLT: case HO_JGT: case HO_JLE: case HO_JGE:
+        *use = HO_OPT_FLAGS_ZN | HO_OPT_FLAGS_V;
+        break;
+    case HO_JVS: case HO_JVC:
+        *use = HO_OPT_FLAGS_V;
+        break;
+    case HO_STORE: case HO_STOREI: case HO_STORED:
+        *use = ho_opt_reg_bit(HO_AR);
+        *kill = (op != HO_STORE) ? ho_opt_reg_bit(HO_AR) : 0;
+        break;
+    case HO_LOAD: case HO_LOADI: case HO_LOADD:
+        *use = ho_opt_reg_bit(HO_AR);
+        *kill = (op != HO_LOAD) ? ho_opt_reg_bit(HO_AR) : 0;
+        return;
+    case HO_PUSH: case HO_POP:
+        *use = ho_opt_reg_bit(HO_SP);
+        *kill = ho_opt_reg_bit(HO_SP);
+        if (op == HO_POP)
+            return;
+        break;
+    default:
+        return;
+    }
+
+    // Register argument of jumps, stores and push
+    if (!imm)
+        *use |= ho_opt_reg_bit(rm);
+}
+
+// Instructions which can run after instruction i
+// Returns their number, or -1 if they are not known, e.g. for returns or at the end
+// of the program
+static int ho_opt_successors(ho_opt_t *opt, int i, int *succ)
+{
+    uint32_t word = ho_opt_word(opt, i);
+    int op = HO_OPT_OP(word);
+    int rd = HO_OPT_RD(word);
+    int next = ho_opt_live(opt, i + 1);
+
+    if (word == HOVM_HALT)
+        return -1;
+    if (rd == HO_PC && (ho_opt_is_alu(op) || op == HO_POP || op == HO_LOAD || op == HO_LOADI || op == HO_LOADD))
+        return -1;
+
+    int len = 0;
+    if (ho_opt_is_jump(op))
+    {
+        int t = ho_opt_jump_target(opt, i);
+        if (t < 0 || t >= opt->len)
+            return -1;
+        succ[len++] = t;
+        if (op == HO_JMP)
+            return len;
+    }
+    if (next >= opt->len)
+        return -1;
+    succ[len++] = next;
+    return len;
+}
+
+// 1 if execution can continue with the next instruction after instruction i
+static int ho_opt_falls_through(ho_opt_t *opt, int i)
+{
+    uint32_t word = ho_opt_word(opt, i);
+    int op = HO_OPT_OP(word);
+
+    // Includes HALT and returns
+    if (op == HO_JMP)
+        return 0;
+    if (HO_OPT_RD(word) == HO_PC && (ho_opt_is_alu(op) || op == HO_POP || op == HO_LOAD || op == HO_LOADI || op == HO_LOADD))
+        return 0;
+    return 1;
+}
+
+// Compute live_in and live_out of every instruction left
+// Everything is live where the successors are unknown, the state of the machine when
+// it halts is the result of the program.
+static void ho_opt_liveness(ho_opt_t *opt)
+{
+    for (int i = 0; i < opt->len; i++)
+        opt->instrs[i].live_in = opt->instrs[i].live_out = 0;
+
+    int changed = 1;
+    while (changed)
+    {
+        changed = 0;
+        for (int i = opt->len - 1; i >= 0; i--)
+        {
+            ho_opt_instr_t *instr = &opt->instrs[i];
+            if (instr->deleted)
+                continue;
+
+            int succ[2];
+            int len_succ = ho_opt_successors(opt, i, succ);
+            uint32_t out = (len_succ < 0) ? HO_OPT_LIVE_ALL : 0;
+            for (int j = 0; j < len_succ; j++)
+                out |= opt->instrs[succ[j]].live_in;
+
+            uint32_t use, kill;
+            ho_opt_use_kill(opt, i, &use, &kill);
+            uint32_t in = use | (out & ~kill);
+            if (in != instr->live_in || out != instr->live_out)
+            {
+                instr->live_in = in;
+                instr->live_out = out;
+                changed = 1;
+            }
+        }
+    }
+}
+
+// Remove ALU instructions and LOADs whose results are never read
+static int ho_opt_dead_code(ho_opt_t *opt)
+{
+    int changes = 0;
+    ho_opt_liveness(opt);
+
+    for (int i = 0; i < opt->len; i++)
+    {
+        ho_opt_instr_t *instr = &opt->instrs[i];
+        uint32_t word = ho_opt_word(opt, i);
+        int op = HO_OPT_OP(word);
+        int rd = HO_OPT_RD(word);
+        if (instr->deleted || instr->pinned || !(rd < HO_PC || rd == HO_NIL))
+            continue;
+
+        uint32_t use, kill;
+        ho_opt_use_kill(opt, i, &use, &kill);
+        // MOD by zero stops the VM, so it is kept
+        if ((ho_opt_is_alu(op) && (op & 0xF) != HO_MOD && (kill & instr->live_out) == 0) ||
+            (op == HO_LOAD && (ho_opt_reg_bit(rd) & instr->live_out) == 0))
+        {
+            instr->deleted = 1;
+            changes++;
+        }
+    }
+
+    return changes;
+}
+
+// Remove instructions which can't be reached from the entry point
+// They are found from the start jump by following jumps and falling through, and from
+// every code address used by an instruction reached, like a label moved into a
+// register or the return address of CALL. Pinned instructions are kept.
+static int ho_opt_unreachable(ho_opt_t *opt)
+{
+    horizon_program_t *program = opt->program;
+    int changes = 0;
+    if (program->relocatable)
+        return 0;
+
+    int *reached = calloc(opt->len, sizeof(int));
+    int *stack = malloc(sizeof(int) * (2 * opt->len + program->len_relocs + 1));
+    int len_stack = 0;
+
+    stack[len_stack++] = program->code_start;
+    // Code addresses in the data section
+    for (int r = 0; r < program->len_relocs; r++)
+    {
+        horizon_reloc_t *reloc = &program->relocs[r];
+        int at = reloc->offset - opt->base;
+        if (reloc->kind == HO_RELOC_CODE && (at < 0 || at >= opt->len))
+            stack[len_stack++] = (int) (program->code[reloc->offset] & ho_opt_reloc_mask(reloc)) - opt->base;
+    }
+
+    while (len_stack > 0)
+    {
+        int i = stack[--len_stack];
+        if (i < 0 || i >= opt->len)
+            continue;
+        i = ho_opt_live(opt, i);
+        if (i >= opt->len || reached[i])
+            continue;
+        reached[i] = 1;
+
+        uint32_t word = ho_opt_word(opt, i);
+        int op = HO_OPT_OP(word);
+        int r = opt->instrs[i].reloc;
+        if (ho_opt_is_jump(op))
+        {
+            int t = ho_opt_jump_target(opt, i);
+            if (t >= 0)
+                stack[len_stack++] = t;
+            if (op != HO_JMP)
+                stack[len_stack++] = i + 1;
+            continue;
+        }
+
+        if (ho_opt_falls_through(opt, i))
+            stack[len_stack++] = i + 1;
+        if (r >= 0 && program->relocs[r].kind == HO_RELOC_CODE)
+            stack[len_stack++] = (int) (word & ho_opt_reloc_mask(&program->relocs[r])) - opt->base;
+        // PC plus or minus a constant, see ho_opt_mark_pinned
+        else if (ho_opt_is_alu(op) && HO_OPT_IMM(word) && HO_OPT_RM(word) == HO_PC)
+            stack[len_stack++] = i + (((op & 0xF) == HO_SUB) ? -(int8_t) HO_OPT_RN(word) : (int8_t) HO_OPT_RN(word));
+    }
+
+    for (int i = 0; i < opt->len; i++)
+    {
+        if (!reached[i] && !opt->instrs[i].deleted && !opt->instrs[i].pinned)
+        {
+            opt->instrs[i].deleted = 1;
+            changes++;
+        }
+    }
+
+    free(reached);
+    free(stack);
+    return changes;
+}
+
+// Value computed in a basic block
+typedef struct {
+    int op;                 // ALU opcode without the S bit, HO_OPT_VN_CONST or HO_OPT_VN_UNKNOWN
+    int a;                  // value numbers of the arguments, b is -1 for NOT
+    int b;
+    uint32_t value;         // for constants
+} ho_opt_value_t;
+
+#define HO_OPT_VN_CONST     -1
+#define HO_OPT_VN_UNKNOWN   -2
+
+typedef struct {
+    int len_values;
+    int len_values_space;
+    ho_opt_value_t *values; // malloced
+    int reg_vn[HO_NIL + 1]; // value held by every register, -1 if it is the one at the
+                            //  start of the block and not read yet
+    int reg_time[HO_NIL + 1];   // instruction which set it, for copy propagation
+} ho_opt_lvn_t;
+
+static int ho_opt_vn_add(ho_opt_lvn_t *lvn, int op, int a, int b, uint32_t value)
+{
+    // Look for the same value among the latest ones
+    if (op != HO_OPT_VN_UNKNOWN)
+    {
+        int first = lvn->len_values - HORIZON_OPT_VN_WINDOW;
+        for (int i = lvn->len_values - 1; i >= 0 && i >= first; i--)
+        {
+            ho_opt_value_t *v = &lvn->values[i];
+            if (v->op == op && ((op == HO_OPT_VN_CONST) ? v->value == value : v->a == a && v->b == b))
+                return i;
+        }
+    }
+
+    if (lvn->len_values >= lvn->len_values_space)
+    {
+        lvn->len_values_space += 100;
+        lvn->values = realloc(lvn->values, sizeof(ho_opt_value_t) * lvn->len_values_space);
+    }
+    lvn->values[lvn->len_values] = (ho_opt_value_t) { .op = op, .a = a, .b = b, .value = value };
+    return lvn->len_values++;
+}
+
+static int ho_opt_vn_const(ho_opt_lvn_t *lvn, uint32_t value)
+{
+    return ho_opt_vn_add(lvn, HO_OPT_VN_CONST, -1, -1, value);
+}
+
+static int ho_opt_vn_is_const(ho_opt_lvn_t *lvn, int vn)
+{
+    return lvn->values[vn].op == HO_OPT_VN_CONST;
+}
+
+// Value read from a register
+static int ho_opt_vn_reg(ho_opt_lvn_t *lvn, int reg)
+{
+    if (reg == HO_NIL)
+        return ho_opt_vn_const(lvn, 0);
+    if (reg == HO_PC)
+        return ho_opt_vn_add(lvn, HO_OPT_VN_UNKNOWN, -1, -1, 0);
+    if (lvn->reg_vn[reg] < 0)
+        lvn->reg_vn[reg] = ho_opt_vn_add(lvn, HO_OPT_VN_UNKNOWN, -1, -1, 0);
+    return lvn->reg_vn[reg];
+}
+
+// Register which has held the value in reg the longest, reading it instead lets the
+// copies be removed
+static int ho_opt_vn_holder(ho_opt_lvn_t *lvn, int reg)
+{
+    int vn = ho_opt_vn_reg(lvn, reg);
+    if (ho_opt_vn_is_const(lvn, vn) && lvn->values[vn].value == 0)
+        return HO_NIL;
+
+    int best = reg;
+    for (int r = 0; r < HO_PC; r++)
+    {
+        if (lvn->reg_vn[r] == vn && lvn->reg_time[r] < lvn->reg_time[best])
+            best = r;
+    }
+    return best;
+}
+
+static void ho_opt_vn_set(ho_opt_lvn_t *lvn, int reg, int vn, int time)
+{
+    if (reg == HO_NIL)
+        return;
+    lvn->reg_vn[reg] = vn;
+    lvn->reg_time[reg] = time;
+}
+
+// Evaluate an ALU operation on constants like the VM does
+// Returns 0 if it can't be folded, e.g. division, which is left to the VM
+static int ho_opt_fold(int op, uint32_t a, uint32_t b, uint32_t *res)
+{
+    switch (op)
+    {
+    case HO_ADD: *res = a + b; return 1;
+    case HO_SUB: *res = a - b; return 1;
+    case HO_MUL: *res = a * b; return 1;
+    case HO_AND: *res = a & b; return 1;
+    case HO_OR: *res = a | b; return 1;
+    case HO_XOR: *res = a ^ b; return 1;
+    case HO_NOT: *res = ~a; return 1;
+    case HO_BCAT: *res = (a << 8) | b; return 1;
+    case HO_HCAT: *res = (a << 16) | b; return 1;
+    case HO_LSH:
+        if (b >= 32)
+            return 0;
+        *res = a << b;
+        return 1;
+    case HO_RSH:
+        if (b >= 32)
+            return 0;
+        *res = (int32_t) a >> b;
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+// Local value numbering: within each basic block, propagate copies and constants into
+// the arguments of ALU instructions, fold constant results into a single ADD from
+// NIL and remove instructions setting a register to the value it already holds
+static int ho_opt_value_numbering(ho_opt_t *opt)
+{
+    horizon_program_t *program = opt->program;
+    ho_opt_lvn_t lvn = { 0 };
+    int changes = 0;
+    int prev = -1;
+
+    ho_opt_mark_targets(opt);
+
+    for (int i = ho_opt_live(opt, 0); i < opt->len; prev = i, i = ho_opt_live(opt, i + 1))
+    {
+        ho_opt_instr_t *instr = &opt->instrs[i];
+
+        // Start a new block after jumps and around PC-relative windows
+        int leader = prev < 0 || instr->target || instr->pinned || opt->instrs[prev].pinned;
+        if (!leader)
+        {
+            int succ[2];
+            int len_succ = ho_opt_successors(opt, prev, succ);
+            leader = len_succ != 1 || succ[0] != i || ho_opt_is_jump(HO_OPT_OP(ho_opt_word(opt, prev)));
+        }
+        if (leader)
+        {
+            lvn.len_values = 0;
+            for (int r = 0; r <= HO_NIL; r++)
+            {
+                lvn.reg_vn[r] = -1;
+                lvn.reg_time[r] = -1;
+            }
+        }
+
+        uint32_t word = ho_opt_word(opt, i);
+        int op = HO_OPT_OP(word);
+        int imm = HO_OPT_IMM(word);
+        int rd = HO_OPT_RD(word);
+        int rm = HO_OPT_RM(word);
+        int rn = HO_OPT_RN(word);
+        int64_t *code = &program->code[opt->base + i];
+
+        switch (op)
+        {
+        case HO_LOAD: case HO_LOADI: case HO_LOADD:
+        {
+            int ar = ho_opt_vn_reg(&lvn, HO_AR);
+            ho_opt_vn_set(&lvn, rd, ho_opt_vn_add(&lvn, HO_OPT_VN_UNKNOWN, -1, -1, 0), i);
+            if (op != HO_LOAD)
+                ho_opt_vn_set(&lvn, HO_AR, ho_opt_vn_add(&lvn, (op == HO_LOADI) ? HO_ADD : HO_SUB, ar, ho_opt_vn_const(&lvn, 1), 0), i);
+            continue;
+        }
+        case HO_STOREI: case HO_STORED:
+        {
+            int ar = ho_opt_vn_reg(&lvn, HO_AR);
+            ho_opt_vn_set(&lvn, HO_AR, ho_opt_vn_add(&lvn, (op == HO_STOREI) ? HO_ADD : HO_SUB, ar, ho_opt_vn_const(&lvn, 1), 0), i);
+            continue;
+        }
+        case HO_PUSH: case HO_POP:
+        {
+            int sp = ho_opt_vn_reg(&lvn, HO_SP);
+            if (op == HO_POP)
+                ho_opt_vn_set(&lvn, rd, ho_opt_vn_add(&lvn, HO_OPT_VN_UNKNOWN, -1, -1, 0), i);
+            ho_opt_vn_set(&lvn, HO_SP, ho_opt_vn_add(&lvn, (op == HO_PUSH) ? HO_ADD : HO_SUB, sp, ho_opt_vn_const(&lvn, 1), 0), i);
+            continue;
+        }
+        default:
+            break;
+        }
+        if (!ho_opt_is_alu(op) || rd == HO_PC)
+            continue;
+
+        int base = op & 0xF;
+        int set_flags = op & 0x10;
+
+        // Copy propagation
+        int holder = (rm != HO_PC) ? ho_opt_vn_holder(&lvn, rm) : rm;
+        if (holder != rm)
+        {
+            *code = (*code & ~((int64_t) 0xFF << 8)) | holder << 8;
+            rm = holder;
+            changes++;
+        }
+        if (!imm && base != HO_NOT && rn != HO_PC)
+        {
+            // Constants which fit are used as imm8 instead
+            int vn = ho_opt_vn_reg(&lvn, rn);
+            int32_t c = lvn.values[vn].value;
+            if (ho_opt_vn_is_const(&lvn, vn) && c >= INT8_MIN && c <= INT8_MAX && rn != HO_NIL)
+            {
+                *code = (*code & ~(int64_t) 0xFF) | (1u << 31) | (c & 0xFF);
+                imm = 1;
+                rn = c & 0xFF;
+                changes++;
+            }
+            else if ((holder = ho_opt_vn_holder(&lvn, rn)) != rn)
+            {
+                *code = (*code & ~(int64_t) 0xFF) | holder;
+                rn = holder;
+                changes++;
+            }
+        }
+
+        // Value of the result
+        int a = ho_opt_vn_reg(&lvn, rm);
+        int b = -1;
+        if (base != HO_NOT)
+        {
+            if (imm && instr->reloc >= 0)
+                b = ho_opt_vn_add(&lvn, HO_OPT_VN_UNKNOWN, -1, -1, 0);
+            else if (imm)
+                b = ho_opt_vn_const(&lvn, (int8_t) rn);
+            else
+                b = ho_opt_vn_reg(&lvn, rn);
+        }
+        if ((base == HO_ADD || base == HO_MUL || base == HO_AND || base == HO_OR || base == HO_XOR) && b < a)
+        {
+            int tmp = a;
+            a = b;
+            b = tmp;
+        }
+
+        uint32_t folded;
+        int result;
+        if (a == b && (base == HO_SUB || base == HO_XOR))
+            result = ho_opt_vn_const(&lvn, 0);
+        else if (a == b && (base == HO_AND || base == HO_OR))
+            result = a;
+        else if (ho_opt_vn_is_const(&lvn, a) && (b < 0 || ho_opt_vn_is_const(&lvn, b)) &&
+            ho_opt_fold(base, lvn.values[a].value, (b < 0) ? 0 : lvn.values[b].value, &folded))
+            result = ho_opt_vn_const(&lvn, folded);
+        else
+            result = ho_opt_vn_add(&lvn, base, a, b, 0);
+
+        if (!set_flags && rd != HO_NIL && !instr->pinned && lvn.reg_vn[rd] == result)
+        {
+            // The register already holds the value
+            instr->deleted = 1;
+            changes++;
+            continue;
+        }
+
+        int32_t c = lvn.values[result].value;
+        int64_t mov = (int64_t) (HO_ADD | (1 << 7)) << 24 | rd << 16 | HO_NIL << 8 | (c & 0xFF);
+        if (!set_flags && ho_opt_vn_is_const(&lvn, result) && c >= INT8_MIN && c <= INT8_MAX && instr->reloc < 0 && *code != mov)
+        {
+            *code = mov;
+            changes++;
+        }
+        ho_opt_vn_set(&lvn, rd, result, i);
+    }
+
+    free(lvn.values);
+    return changes;
+}
+
+// Move instructions computing the same value on every iteration of a loop in front of
+// it. Loops are found from jumps back to a label, and only simple ones are handled:
+// entered only by falling into the first instruction, without calls or returns.
+// The moves are recorded in moved_before and done by ho_opt_compact.
+// Returns the number of instructions moved.
+static int ho_opt_hoist_invariants(ho_opt_t *opt)
+{
+    int moves = 0;
+    if (opt->program->relocatable)
+        return 0;
+
+    ho_opt_mark_targets(opt);
+    ho_opt_liveness(opt);
+
+    for (int back = 0; back < opt->len; back++)
+    {
+        if (opt->instrs[back].deleted)
+            continue;
+        int head = ho_opt_jump_target(opt, back);
+        if (head < 0 || head > back)
+            continue;
+
+        // The loop is [head, back], every instruction in it must have known successors
+        // and nothing outside may jump into it
+        int ok = 1;
+        uint32_t defined = 0;
+        for (int i = head; i <= back && ok; i++)
+        {
+            if (opt->instrs[i].deleted)
+                continue;
+            uint32_t use, kill;
+            ho_opt_use_kill(opt, i, &use, &kill);
+            uint32_t word = ho_opt_word(opt, i);
+            int op = HO_OPT_OP(word);
+            if (op == HO_LOAD || op == HO_LOADI || op == HO_LOADD || op == HO_POP)
+                kill |= ho_opt_reg_bit(HO_OPT_RD(word));
+            defined |= kill;
+
+            int succ[2];
+            ok = !opt->instrs[i].pinned && opt->instrs[i].moved_before < 0 && (i == back || ho_opt_successors(opt, i, succ) >= 0);
+        }
+        for (int r = 0; r < opt->program->len_relocs && ok; r++)
+        {
+            horizon_reloc_t *reloc = &opt->program->relocs[r];
+            int at = reloc->offset - opt->base;
+            if (reloc->kind != HO_RELOC_CODE || (at >= head && at <= back) || (at >= 0 && at < opt->len && opt->instrs[at].deleted))
+                continue;
+            int t = (int) (opt->program->code[reloc->offset] & ho_opt_reloc_mask(reloc)) - opt->base;
+            t = (t >= 0 && t < opt->len) ? ho_opt_live(opt, t) : -1;
+            ok = t < head || t > back;
+        }
+        int entry = ho_opt_live(opt, opt->program->code_start);
+        ok &= entry < head || entry > back;
+        if (!ok)
+            continue;
+
+        // Registers read after leaving the loop
+        uint32_t live_exit = 0;
+        for (int i = head; i <= back; i++)
+        {
+            if (opt->instrs[i].deleted)
+                continue;
+            int succ[2];
+            int len_succ = ho_opt_successors(opt, i, succ);
+            if (len_succ < 0)
+                live_exit = HO_OPT_LIVE_ALL;
+            for (int j = 0; j < len_succ; j++)
+            {
+                if (succ[j] < head || succ[j] > back)
+                    live_exit |= opt->instrs[succ[j]].live_in;
+            }
+        }
+
+        // Instructions before the first branch of the loop run on every iteration, so
+        // their results may be read after it
+        int every_iteration = 1;
+        for (int i = head; i <= back; i++)
+        {
+            ho_opt_instr_t *instr = &opt->instrs[i];
+            if (instr->deleted)
+                continue;
+
+            int succ[2];
+            int straight = every_iteration;
+            every_iteration &= ho_opt_successors(opt, i, succ) == 1 && succ[0] == ho_opt_live(opt, i + 1);
+
+            uint32_t word = ho_opt_word(opt, i);
+            int op = HO_OPT_OP(word);
+            int rd = HO_OPT_RD(word);
+            if ((instr->target && i != head) || !ho_opt_is_alu(op) || (op & 0x10) || op == HO_MOD || rd >= HO_PC)
+                continue;
+
+            uint32_t use, kill;
+            ho_opt_use_kill(opt, i, &use, &kill);
+            int rn = (HO_OPT_IMM(word) || (op & 0xF) == HO_NOT) ? HO_NIL : HO_OPT_RN(word);
+            if ((HO_OPT_RM(word) >= HO_PC && HO_OPT_RM(word) != HO_NIL) || (rn >= HO_PC && rn != HO_NIL))
+                continue;
+            if ((use & defined) || (kill & opt->instrs[head].live_in) || (!straight && (kill & live_exit)))
+                continue;
+
+            // rd must only be written here
+            int once = 1;
+            for (int j = head; j <= back && once; j++)
+            {
+                if (j == i || opt->instrs[j].deleted)
+                    continue;
+                uint32_t use_j, kill_j;
+                ho_opt_use_kill(opt, j, &use_j, &kill_j);
+                int op_j = HO_OPT_OP(ho_opt_word(opt, j));
+                if (op_j == HO_LOAD || op_j == HO_LOADI || op_j == HO_LOADD || op_j == HO_POP)
+                    kill_j |= ho_opt_reg_bit(HO_OPT_RD(ho_opt_word(opt, j)));
+                once = !(kill_j & kill);
+            }
+            if (!once)
+                continue;
+
+            instr->moved_before = head;
+            defined &= ~kill;
+            moves++;
+        }
+    }
+
+    return moves;
+}
+
+// Put every instruction left at its new position in pos and update every address
+// pointing into the program section to the one in addr, the program section is len
+// instructions long afterwards
+static void ho_opt_relocate(ho_opt_t *opt, int *pos, int *addr, int len)
+{
+    horizon_program_t *program = opt->program;
+
+    int64_t *code = malloc(sizeof(int64_t) * opt->len);
+    for (int i = 0; i < opt->len; i++)
+    {
+        if (!opt->instrs[i].deleted)
+            code[pos[i]] = program->code[opt->base + i];
+    }
+    for (int i = 0; i < len; i++)
+        program->code[opt->base + i] = code[i];
+    program->len_code = opt->base + len;
+    free(code);
+
+    int len_relocs = 0;
+    for (int i = 0; i < program->len_relocs; i++)
+    {
+        horizon_reloc_t reloc = program->relocs[i];
+        int at = reloc.offset - opt->base;
+        if (at >= 0 && at < opt->len && opt->instrs[at].deleted)
+        {
+            free(reloc.import);
+            continue;
+        }
+        if (at >= 0 && at < opt->len)
+            reloc.offset = opt->base + pos[at];
+
+        if (reloc.kind == HO_RELOC_CODE)
+        {
+            uint32_t mask = ho_opt_reloc_mask(&reloc);
+            int64_t *word = &program->code[reloc.offset];
+            int t = (int) (*word & mask) - opt->base;
+            if (t >= 0 && t <= opt->len)
+                *word = (*word & ~(int64_t) mask) | ((opt->base + addr[t]) & mask);
+        }
+        program->relocs[len_relocs++] = reloc;
+    }
+    program->len_relocs = len_relocs;
+
+    for (int i = 0; i < program->len_symbols; i++)
+    {
+        int t = (int) program->symbols[i].value - opt->base;
+        if (program->symbols[i].type == HO_SYM_LABEL && t >= 0 && t <= opt->len)
+            program->symbols[i].value = opt->base + addr[t];
+    }
+
+    if (program->code_start >= 0 && program->code_start <= opt->len)
+        program->code_start = addr[program->code_start];
+
+    for (int i = 0; i < program->len_code_lines; i++)
+    {
+        int t = program->code_line_offsets[i];
+        if (t >= 0 && t <= opt->len)
+            program->code_line_offsets[i] = addr[t];
+    }
+}
+
+// Move the instructions left together, with hoisted ones in front of the instruction
+// they were moved before, and update every address pointing into the program section
+static void ho_opt_compact(ho_opt_t *opt)
+{
+    int *pos = malloc(sizeof(int) * opt->len);
+    int *addr = malloc(sizeof(int) * (opt->len + 1));
+    int *first_moved = malloc(sizeof(int) * opt->len);
+    int *next_moved = malloc(sizeof(int) * opt->len);
+
+    for (int i = 0; i < opt->len; i++)
+        first_moved[i] = -1;
+    for (int i = opt->len - 1; i >= 0; i--)
+    {
+        int before = opt->instrs[i].moved_before;
+        if (!opt->instrs[i].deleted && before >= 0)
+        {
+            next_moved[i] = first_moved[before];
+            first_moved[before] = i;
+        }
+    }
+
+    // New position of every instruction left
+    int len = 0;
+    for (int i = 0; i < opt->len; i++)
+    {
+        for (int m = first_moved[i]; m >= 0; m = next_moved[m])
+            pos[m] = len++;
+        if (!opt->instrs[i].deleted && opt->instrs[i].moved_before < 0)
+            pos[i] = len++;
+    }
+
+    // Addresses go to the instruction itself, or the next one which stayed in place if
+    // it was removed or moved
+    addr[opt->len] = len;
+    for (int i = opt->len - 1; i >= 0; i--)
+        addr[i] = (!opt->instrs[i].deleted && opt->instrs[i].moved_before < 0) ? pos[i] : addr[i + 1];
+
+    ho_opt_relocate(opt, pos, addr, len);
+
+    free(pos);
+    free(addr);
+    free(first_moved);
+    free(next_moved);
+}
+
+// Remove variables and arrays whose address is not used by any instruction, and move
+// the program section down over them
+// Returns the number of words removed.
+static int ho_opt_unused_data(ho_opt_t *opt)
+{
+    horizon_program_t *program = opt->program;
+    int start = program->data_offset;
+    if (program->len_data <= 0)
+        return 0;
+
+    // Every word belongs to the variable declared last in front of it, variables are
+    // placed in the order they are declared
+    int *owner = malloc(sizeof(int) * program->len_data);
+    int *used = calloc(program->len_symbols, sizeof(int));
+    for (int w = 0; w < program->len_data; w++)
+        owner[w] = -1;
+    for (int i = 0; i < program->len_symbols; i++)
+    {
+        int w = (int) program->symbols[i].value - start;
+        if (program->symbols[i].type != HO_SYM_VAR || w < 0 || w >= program->len_data)
+            continue;
+        for (; w < program->len_data && (owner[w] < 0 || program->symbols[owner[w]].value < program->symbols[i].value); w++)
+            owner[w] = i;
+    }
+
+    for (int r = 0; r < program->len_relocs; r++)
+    {
+        horizon_reloc_t *reloc = &program->relocs[r];
+        int w = (int) (program->code[reloc->offset] & ho_opt_reloc_mask(reloc)) - start;
+        if (reloc->kind == HO_RELOC_DATA && w >= 0 && w < program->len_data && owner[w] >= 0)
+            used[owner[w]] = 1;
+    }
+
+    // New index of every data word left
+    int *pos = malloc(sizeof(int) * program->len_data);
+    int len_data = 0;
+    for (int w = 0; w < program->len_data; w++)
+    {
+        pos[w] = len_data;
+        if (owner[w] < 0 || used[owner[w]])
+            program->data[len_data++] = program->data[w];
+    }
+    int removed = program->len_data - len_data;
+    if (removed == 0)
+    {
+        free(owner);
+        free(used);
+        free(pos);
+        return 0;
+    }
+
+    // Update the addresses before moving the words they are in
+    for (int r = 0; r < program->len_relocs; r++)
+    {
+        horizon_reloc_t *reloc = &program->relocs[r];
+        uint32_t mask = ho_opt_reloc_mask(reloc);
+        int64_t *word = &program->code[reloc->offset];
+        int t = (int) (*word & mask);
+        if (reloc->kind == HO_RELOC_DATA && t - start >= 0 && t - start < program->len_data)
+            t = start + pos[t - start];
+        else if (reloc->kind == HO_RELOC_DATA && t - start == program->len_data)
+            t -= removed;   // end of the data section, e.g. past the last array
+        else if (reloc->kind == HO_RELOC_CODE && t >= opt->base && t <= program->len_code)
+            t -= removed;
+        *word = (*word & ~(int64_t) mask) | (t & mask);
+        if (reloc->offset >= opt->base)
+            reloc->offset -= removed;
+    }
+
+    int len_symbols = 0;
+    for (int i = 0; i < program->len_symbols; i++)
+    {
+        symbol_t symbol = program->symbols[i];
+        int w = (int) symbol.value - start;
+        if (symbol.type == HO_SYM_VAR && w >= 0 && w < program->len_data)
+        {
+            if (!used[i])
+            {
+                free(symbol.name);
+                continue;
+            }
+            symbol.value = start + pos[w];
+        }
+        else if (symbol.type == HO_SYM_LABEL && (int) symbol.value >= opt->base && (int) symbol.value <= program->len_code)
+            symbol.value -= removed;
+        program->symbols[len_symbols++] = symbol;
+    }
+    program->len_symbols = len_symbols;
+
+    // Move the data words left and the program section
+    for (int w = 0; w < len_data; w++)
+        program->code[start + w] = program->data[w];
+    for (int i = opt->base; i < program->len_code; i++)
+        program->code[i - removed] = program->code[i];
+    program->len_code -= removed;
+    program->len_data = len_data;
+    opt->base -= removed;
+
+    free(owner);
+    free(used);
+    free(pos);
+    return removed;
+}
+
+// Run the optimizer over the program section of an error-free program
+// Returns the number of words removed.
+int horizon_optimize(horizon_program_t *program)
+{
+    if (!program || program->error_count)
+        return 0;
+
+    ho_opt_t opt = { 0 };
+    opt.program = program;
+    opt.base = program->data_offset + program->len_data;
+
+    int len = program->len_code;
+    int can_remove = 0;
+    for (int round = 0; round < HORIZON_OPT_MAX_PASSES; round++)
+    {
+        opt.len = program->len_code - opt.base;
+        if (opt.len <= 0)
+            break;
+
+        ho_opt_init_instrs(&opt);
+
+        // The dataflow passes need the whole control-flow graph, so they only run
+        // when every code address is known
+        can_remove = ho_opt_mark_pinned(&opt);
+        int changes = 0;
+        for (int pass = 0; pass < HORIZON_OPT_MAX_PASSES; pass++)
+        {
+            int pass_changes = ho_opt_pass(&opt, can_remove);
+            if (can_remove)
+            {
+                pass_changes += ho_opt_unreachable(&opt);
+                pass_changes += ho_opt_value_numbering(&opt) + ho_opt_dead_code(&opt);
+            }
+            if (!pass_changes)
+                break;
+            changes += pass_changes;
+        }
+        if (can_remove)
+        {
+            changes += ho_opt_hoist_invariants(&opt);
+            ho_opt_compact(&opt);
+        }
+
+        free(opt.instrs);
+        if (!can_remove || !changes)
+            break;
+    }
+
+    // Only the instructions left keep variables in use
+    if (can_remove && !program->relocatable)
+        ho_opt_unused_data(&opt);
+
+    // The start jump, see horizon_parse
+    program->code[0] = (program->code[0] & ~(int64_t) 0xFFFF) | ((opt.base + program->code_start) & 0xFFFF);
+
+    return len - program->len_code;
+}
+
+// Block layout
+// A chain is a sequence of basic blocks which each fall through into the next, the
+// last one ending with an unconditional jump. Chains can be placed anywhere, as long
+// as jumps are updated.
+
+typedef struct {
+    int first;              // first and last instruction
+    int last;
+    int prev;               // neighbouring blocks in the new layout, -1 if none
+    int next;
+} ho_opt_block_t;
+
+// Opcode of the jump taken exactly when op is not, or -1
+static int ho_opt_invert_jump(int op)
+{
+    switch (op)
+    {
+    case HO_JEQ: return HO_JNE;
+    case HO_JNE: return HO_JEQ;
+    case HO_JLT: return HO_JGE;
+    case HO_JGE: return HO_JLT;
+    case HO_JGT: return HO_JLE;
+    case HO_JLE: return HO_JGT;
+    case HO_JNG: return HO_JPZ;
+    case HO_JPZ: return HO_JNG;
+    case HO_JVS: return HO_JVC;
+    case HO_JVC: return HO_JVS;
+    default: return -1;
+    }
+}
+
+// 1 if block b must stay right in front of the next block in the layout
+static int ho_opt_block_glued(ho_opt_t *opt, ho_opt_block_t *blocks, int b)
+{
+    int last = blocks[b].last;
+    // PC-relative windows, e.g. CALL with its return address, can't be split
+    return ho_opt_falls_through(opt, last) || (last + 1 < opt->len && opt->instrs[last].pinned && opt->instrs[last + 1].pinned);
+}
+
+// Returns 1 if every address counted in the profile is the start jump or a jump of
+// the program section
+int horizon_profile_matches(horizon_program_t *program, horizon_profile_t *profile)
+{
+    int base = program->data_offset + program->len_data;
+    for (int a = 0; a < profile->len; a++)
+    {
+        if (!profile->taken[a] && !profile->not_taken[a])
+            continue;
+        if ((a > 0 && a < base) || a >= program->len_code || !ho_opt_is_jump(HO_OPT_OP(program->code[a])))
+            return 0;
+    }
+    return 1;
+}
+
+// Reorder basic blocks so the more often taken side of conditional jumps falls through
+// Returns the number of jumps inverted, or -1 if the profile doesn't match the program
+int horizon_optimize_layout(horizon_program_t *program, horizon_profile_t *profile)
+{
+    if (!program || program->error_count || program->relocatable || !profile)
+        return 0;
+
+    ho_opt_t opt = { 0 };
+    opt.program = program;
+    opt.base = program->data_offset + program->len_data;
+    opt.len = program->len_code - opt.base;
+    if (opt.len <= 0)
+        return 0;
+
+    // Every counted address must be a jump, otherwise the profile was recorded for a
+    // different program or different options
+    if (!horizon_profile_matches(program, profile))
+        return -1;
+
+    ho_opt_init_instrs(&opt);
+    if (!ho_opt_mark_pinned(&opt))
+    {
+        free(opt.instrs);
+        return 0;
+    }
+    ho_opt_mark_targets(&opt);
+
+    // Split into basic blocks, never inside a PC-relative window
+    ho_opt_block_t *blocks = malloc(sizeof(ho_opt_block_t) * opt.len);
+    int *block_of = malloc(sizeof(int) * opt.len);
+    int len_blocks = 0;
+    for (int i = 0; i < opt.len; i++)
+    {
+        int leader = i == 0 || opt.instrs[i].target || !ho_opt_falls_through(&opt, i - 1) || ho_opt_is_jump(HO_OPT_OP(ho_opt_word(&opt, i - 1)));
+        if (i > 0 && opt.instrs[i - 1].pinned && opt.instrs[i].pinned)
+            leader = 0;
+        if (leader)
+        {
+            blocks[len_blocks] = (ho_opt_block_t) { .first = i, .prev = len_blocks - 1, .next = -1 };
+            if (len_blocks > 0)
+                blocks[len_blocks - 1].next = len_blocks;
+            len_blocks++;
+        }
+        blocks[len_blocks - 1].last = i;
+        block_of[i] = len_blocks - 1;
+    }
+
+    // Conditional jumps which are taken more often than not, the most biased first
+    int *branches = malloc(sizeof(int) * len_blocks);
+    int len_branches = 0;
+    for (int b = 0; b < len_blocks; b++)
+    {
+        int a = opt.base + blocks[b].last;
+        if (a < profile->len && HO_OPT_OP(ho_opt_word(&opt, blocks[b].last)) != HO_JMP && profile->taken[a] > profile->not_taken[a])
+            branches[len_branches++] = b;
+    }
+    for (int i = 1; i < len_branches; i++)
+    {
+        for (int j = i; j > 0; j--)
+        {
+            int a = opt.base + blocks[branches[j]].last, b = opt.base + blocks[branches[j - 1]].last;
+            if ((uint64_t) profile->taken[a] - profile->not_taken[a] <= (uint64_t) profile->taken[b] - profile->not_taken[b])
+                break;
+            int tmp = branches[j];
+            branches[j] = branches[j - 1];
+            branches[j - 1] = tmp;
+        }
+    }
+
+    int inverted = 0;
+    for (int k = 0; k < len_branches; k++)
+    {
+        int b = branches[k];
+        int last = blocks[b].last;
+        int t = ho_opt_jump_target(&opt, last);
+        int op = HO_OPT_OP(ho_opt_word(&opt, last));
+        int f = blocks[b].next;
+        if (t < 0 || t >= opt.len || ho_opt_invert_jump(op) < 0 || f < 0 || opt.instrs[last].pinned)
+            continue;
+
+        // The chain starting at the target must not be fallen into, and can't contain
+        // the jump itself, e.g. for loops
+        int head = block_of[t];
+        if (head == f || blocks[head].first != t)
+            continue;
+        if (blocks[head].prev >= 0 && ho_opt_block_glued(&opt, blocks, blocks[head].prev))
+            continue;
+        int tail = head;
+        int ok = tail != b;
+        while (ok && ho_opt_block_glued(&opt, blocks, tail))
+        {
+            tail = blocks[tail].next;
+            ok = tail >= 0 && tail != b;
+        }
+        if (!ok)
+            continue;
+
+        // Move the chain behind the jump
+        if (blocks[head].prev >= 0)
+            blocks[blocks[head].prev].next = blocks[tail].next;
+        if (blocks[tail].next >= 0)
+            blocks[blocks[tail].next].prev = blocks[head].prev;
+        blocks[head].prev = b;
+        blocks[tail].next = f;
+        blocks[b].next = head;
+        blocks[f].prev = tail;
+
+        // Jump to the old fall-through instead
+        program->code[opt.base + last] = (program->code[opt.base + last] & ~((int64_t) 0x7F << 24)) | (int64_t) ho_opt_invert_jump(op) << 24;
+        ho_opt_set_field(&opt, last, opt.base + blocks[f].first);
+        inverted++;
+    }
+
+    if (inverted)
+    {
+        int *pos = malloc(sizeof(int) * (opt.len + 1));
+        int len = 0;
+        int first = 0;
+        while (blocks[first].prev >= 0)
+            first = blocks[first].prev;
+        for (int b = first; b >= 0; b = blocks[b].next)
+        {
+            for (int i = blocks[b].first; i <= blocks[b].last; i++)
+                pos[i] = len++;
+        }
+        pos[opt.len] = len;
+        ho_opt_relocate(&opt, pos, pos, len);
+        free(pos);
+
+        // The start jump, see horizon_parse
+        program->code[0] = (program->code[0] & ~(int64_t) 0xFFFF) | ((opt.base + program->code_start) & 0xFFFF);
+    }
+
+    free(blocks);
+    free(block_of);
+    free(branches);
+    free(opt.instrs);
+    return inverted;
+}
+
+// Inlining
+// Calls are replaced by the body of the routine, which is left in place for horizon_optimize
+// to remove once it is no longer called.
+
+typedef struct {
+    int site;               // ADD LR PC #2 of the call
+    int entry;              // first instruction of the routine called
+    int ret;                // its RETURN
+    uint32_t count;         // times the call ran according to the profile
+} ho_opt_call_t;
+
+// Index of the RETURN ending the routine starting at entry if it can be inlined,
+// otherwise -1
+static int ho_opt_inline_return(ho_opt_t *opt, int entry)
+{
+    horizon_program_t *program = opt->program;
+    int ret = -1;
+    for (int i = entry; i < opt->len && i <= entry + HORIZON_OPT_INLINE_MAX_LEN && ret < 0; i++)
+    {
+        uint32_t word = ho_opt_word(opt, i);
+        int op = HO_OPT_OP(word);
+        if (op == HO_JMP && !HO_OPT_IMM(word) && HO_OPT_RM(word) == HO_LR)
+        {
+            ret = i;
+            break;
+        }
+
+        uint32_t use, kill;
+        ho_opt_use_kill(opt, i, &use, &kill);
+        if (opt->instrs[i].pinned || ((use | kill) & ho_opt_reg_bit(HO_LR)) || word == HOVM_HALT)
+            return -1;
+        if ((ho_opt_is_alu(op) || op == HO_LOAD || op == HO_LOADI || op == HO_LOADD || op == HO_POP) &&
+            (HO_OPT_RD(word) == HO_LR || HO_OPT_RD(word) == HO_PC))
+            return -1;
+        if (ho_opt_is_jump(op))
+        {
+            int t = ho_opt_jump_target(opt, i);
+            if (!HO_OPT_IMM(word) || opt->instrs[i].reloc < 0 || t < entry || t > entry + HORIZON_OPT_INLINE_MAX_LEN)
+                return -1;
+        }
+    }
+    if (ret < 0)
+        return -1;
+
+    // Jumps within the routine must stay in it, and nothing else may jump into it
+    for (int r = 0; r < program->len_relocs; r++)
+    {
+        horizon_reloc_t *reloc = &program->relocs[r];
+        int at = reloc->offset - opt->base;
+        int t = (int) (program->code[reloc->offset] & ho_opt_reloc_mask(reloc)) - opt->base;
+        if (reloc->kind != HO_RELOC_CODE)
+            continue;
+        int inside = at >= entry && at < ret;
+        if (inside && ho_opt_is_jump(HO_OPT_OP(ho_opt_word(opt, at))) && (t < entry || t > ret))
+            return -1;
+        if (!inside && t > entry && t <= ret)
+            return -1;
+    }
+    if (program->code_start > entry && program->code_start <= ret)
+        return -1;
+    return ret;
+}
+
+// LR is read after instruction i before being written, i.e. the return address a call
+// sets is used after the call. Only HALT among unknown successors doesn't read it.
+static int *ho_opt_lr_live(ho_opt_t *opt)
+{
+    int *live = calloc(opt->len + 1, sizeof(int));
+    int changed = 1;
+    while (changed)
+    {
+        changed = 0;
+        for (int i = opt->len - 1; i >= 0; i--)
+        {
+            uint32_t word = ho_opt_word(opt, i);
+            int op = HO_OPT_OP(word);
+            int succ[2];
+            int len_succ = ho_opt_successors(opt, i, succ);
+            int out = len_succ < 0 && word != HOVM_HALT;
+            for (int j = 0; j < len_succ; j++)
+                out |= live[succ[j]];
+
+            uint32_t use, kill;
+            ho_opt_use_kill(opt, i, &use, &kill);
+            int writes = (ho_opt_is_alu(op) || op == HO_LOAD || op == HO_LOADI || op == HO_LOADD || op == HO_POP) && HO_OPT_RD(word) == HO_LR;
+            int in = (use & ho_opt_reg_bit(HO_LR)) || (out && !writes);
+            if (in != live[i])
+            {
+                live[i] = in;
+                changed = 1;
+            }
+        }
+    }
+    return live;
+}
+
+// Replace the chosen calls with copies of the routines, in order of their sites
+static void ho_opt_inline(ho_opt_t *opt, ho_opt_call_t *calls, int len_calls, horizon_profile_t *profile)
+{
+    horizon_program_t *program = opt->program;
+
+    // New positions, addresses of the call go to the copy
+    int *pos = malloc(sizeof(int) * (opt->len + 1));
+    int *replaced = calloc(opt->len + 1, sizeof(int));
+    int *copy_at = malloc(sizeof(int) * (len_calls + 1));
+    int len = 0;
+    for (int i = 0, c = 0; i < opt->len; i++)
+    {
+        pos[i] = len;
+        if (c < len_calls && calls[c].site == i)
+        {
+            copy_at[c] = len;
+            len += calls[c].ret - calls[c].entry;
+            replaced[i] = replaced[i + 1] = 1;
+            pos[++i] = len;
+            c++;
+            continue;
+        }
+        len++;
+    }
+    pos[opt->len] = len;
+
+    int64_t *code = malloc(sizeof(int64_t) * (len + 1));
+    for (int i = 0, c = 0; i < opt->len; i++)
+    {
+        if (c < len_calls && calls[c].site == i)
+        {
+            for (int k = calls[c].entry; k < calls[c].ret; k++)
+                code[copy_at[c] + k - calls[c].entry] = program->code[opt->base + k];
+            i++;
+            c++;
+            continue;
+        }
+        code[pos[i]] = program->code[opt->base + i];
+    }
+
+    if (opt->base + len > program->len_code_space)
+    {
+        program->len_code_space = opt->base + len;
+        program->code = realloc(program->code, sizeof(int64_t) * program->len_code_space);
+    }
+    for (int i = 0; i < len; i++)
+        program->code[opt->base + i] = code[i];
+    program->len_code = opt->base + len;
+    free(code);
+
+    // Relocations, the ones in a routine are repeated for every copy and jumps to its
+    // RETURN go after the call
+    int len_copied = 0;
+    for (int c = 0; c < len_calls; c++)
+    {
+        for (int r = 0; r < program->len_relocs; r++)
+        {
+            int at = program->relocs[r].offset - opt->base;
+            len_copied += at >= calls[c].entry && at < calls[c].ret;
+        }
+    }
+    horizon_reloc_t *relocs = malloc(sizeof(horizon_reloc_t) * (program->len_relocs + len_copied + 1));
+    int len_relocs = 0;
+    for (int c = -1; c < len_calls; c++)
+    {
+        for (int r = 0; r < program->len_relocs; r++)
+        {
+            horizon_reloc_t reloc = program->relocs[r];
+            int at = reloc.offset - opt->base;
+            if (c >= 0 && (at < calls[c].entry || at >= calls[c].ret))
+                continue;
+            if (c < 0 && at >= 0 && at < opt->len && replaced[at])
+            {
+                free(reloc.import);
+                continue;
+            }
+            if (c >= 0)
+            {
+                reloc.offset = opt->base + copy_at[c] + at - calls[c].entry;
+                if (reloc.import)
+                    reloc.import = strdup(reloc.import);
+            }
+            else if (at >= 0 && at < opt->len)
+                reloc.offset = opt->base + pos[at];
+
+            if (reloc.kind == HO_RELOC_CODE)
+            {
+                uint32_t mask = ho_opt_reloc_mask(&reloc);
+                int64_t *word = &program->code[reloc.offset];
+                int t = (int) (*word & mask) - opt->base;
+                if (c >= 0 && ho_opt_is_jump(HO_OPT_OP(*word)) && t >= calls[c].entry && t <= calls[c].ret)
+                    t = (t == calls[c].ret) ? pos[calls[c].site + 2] : copy_at[c] + t - calls[c].entry;
+                else if (t >= 0 && t <= opt->len)
+                    t = pos[t];
+                *word = (*word & ~(int64_t) mask) | ((opt->base + t) & mask);
+            }
+            relocs[len_relocs++] = reloc;
+        }
+    }
+    free(program->relocs);
+    program->relocs = relocs;
+    program->len_relocs = len_relocs;
+    program->len_relocs_space = program->len_relocs + len_copied + 1;
+
+    for (int i = 0; i < program->len_symbols; i++)
+    {
+        int t = (int) program->symbols[i].value - opt->base;
+        if (program->symbols[i].type == HO_SYM_LABEL && t >= 0 && t <= opt->len)
+            program->symbols[i].value = opt->base + pos[t];
+    }
+    if (program->code_start >= 0 && program->code_start <= opt->len)
+        program->code_start = pos[program->code_start];
+    for (int i = 0; i < program->len_code_lines; i++)
+    {
+        int t = program->code_line_offsets[i];
+        if (t >= 0 && t <= opt->len)
+            program->code_line_offsets[i] = pos[t];
+    }
+
+    // The counts move with the instructions, the copies have none
+    if (profile)
+    {
+        uint32_t *taken = calloc(program->len_code, sizeof(uint32_t));
+        uint32_t *not_taken = calloc(program->len_code, sizeof(uint32_t));
+        for (int a = opt->base; a < profile->len && a < opt->base + opt->len; a++)
+        {
+            int i = a - opt->base;
+            if (!replaced[i])
+            {
+                taken[opt->base + pos[i]] = profile->taken[a];
+                not_taken[opt->base + pos[i]] = profile->not_taken[a];
+            }
+        }
+        free(profile->taken);
+        free(profile->not_taken);
+        profile->taken = taken;
+        profile->not_taken = not_taken;
+        profile->len = program->len_code;
+    }
+
+    // The start jump, see horizon_parse
+    program->code[0] = (program->code[0] & ~(int64_t) 0xFFFF) | ((opt->base + program->code_start) & 0xFFFF);
+
+    free(pos);
+    free(replaced);
+    free(copy_at);
+}
+
+// Inline calls of small leaf routines, see horizon_inline_calls in the header
+int horizon_inline_calls(horizon_program_t *program, horizon_profile_t *profile)
+{
+    if (!program || program->error_count || program->relocatable)
+        return 0;
+    if (profile && !horizon_profile_matches(program, profile))
+        profile = NULL;
+
+    ho_opt_t opt = { 0 };
+    opt.program = program;
+    opt.base = program->data_offset + program->len_data;
+    opt.len = program->len_code - opt.base;
+    if (opt.len <= 0)
+        return 0;
+
+    ho_opt_init_instrs(&opt);
+    if (!ho_opt_mark_pinned(&opt))
+    {
+        free(opt.instrs);
+        return 0;
+    }
+    ho_opt_mark_targets(&opt);
+    int *lr_live = ho_opt_lr_live(&opt);
+
+    // Every call, and the routines which are only called and can be inlined
+    ho_opt_call_t *calls = malloc(sizeof(ho_opt_call_t) * (opt.len + 1));
+    int *ret = malloc(sizeof(int) * (opt.len + 1));
+    int *sites = calloc(opt.len + 1, sizeof(int));
+    int *used = calloc(opt.len + 1, sizeof(int));
+    int len_calls = 0;
+    for (int i = 0; i < opt.len; i++)
+        ret[i] = -2;
+    for (int i = 0; i + 1 < opt.len; i++)
+    {
+        uint32_t word = ho_opt_word(&opt, i);
+        int t = ho_opt_jump_target(&opt, i + 1);
+        if (word != ((uint32_t) (HO_ADD | (1 << 7)) << 24 | HO_LR << 16 | HO_PC << 8 | 2) ||
+            HO_OPT_OP(ho_opt_word(&opt, i + 1)) != HO_JMP || opt.instrs[i + 1].reloc < 0 || t < 0 || t >= opt.len)
+            continue;
+        sites[t]++;
+        if (ret[t] == -2)
+            ret[t] = ho_opt_inline_return(&opt, t);
+        if (ret[t] < 0 || opt.instrs[i + 1].target || i + 2 >= opt.len || lr_live[i + 2])
+            continue;
+        uint32_t count = (profile && opt.base + i + 1 < profile->len) ? profile->taken[opt.base + i + 1] : 0;
+        calls[len_calls++] = (ho_opt_call_t) { .site = i, .entry = t, .ret = ret[t], .count = count };
+    }
+    for (int r = 0; r < program->len_relocs; r++)
+    {
+        horizon_reloc_t *reloc = &program->relocs[r];
+        int at = reloc->offset - opt.base;
+        int t = (int) (program->code[reloc->offset] & ho_opt_reloc_mask(reloc)) - opt.base;
+        int call = at > 0 && at < opt.len && ho_opt_word(&opt, at - 1) == ((uint32_t) (HO_ADD | (1 << 7)) << 24 | HO_LR << 16 | HO_PC << 8 | 2);
+        if (reloc->kind == HO_RELOC_CODE && !call && t >= 0 && t < opt.len)
+            used[t] = 1;
+    }
+
+    // Calls which don't make the program longer come first, then the most frequent
+    int *chosen = calloc(len_calls + 1, sizeof(int));
+    int growth = 0;
+    for (int c = 0; c < len_calls; c++)
+    {
+        int t = calls[c].entry;
+        int body = calls[c].ret - t;
+        int only_call = sites[t] == 1 && !used[t] && program->code_start != t && (t == 0 || !ho_opt_falls_through(&opt, t - 1));
+        if (body <= 2 || only_call)
+        {
+            chosen[c] = 1;
+            growth += body - 2;
+        }
+    }
+    while (profile)
+    {
+        int best = -1;
+        for (int c = 0; c < len_calls; c++)
+        {
+            if (!chosen[c] && calls[c].count > 0 && (best < 0 || calls[c].count > calls[best].count))
+                best = c;
+        }
+        if (best < 0)
+            break;
+        int body = calls[best].ret - calls[best].entry;
+        chosen[best] = (program->len_code + growth + body - 2 <= HOVM_ROM_SIZE) ? 1 : -1;
+        if (chosen[best] > 0)
+            growth += body - 2;
+    }
+
+    int len_chosen = 0;
+    for (int c = 0; c < len_calls; c++)
+    {
+        if (chosen[c] > 0)
+            calls[len_chosen++] = calls[c];
+    }
+    if (len_chosen)
+        ho_opt_inline(&opt, calls, len_chosen, profile);
+
+    free(opt.instrs);
+    free(lr_live);
+    free(calls);
+    free(ret);
+    free(sites);
+    free(used);
+    free(chosen);
+    return len_chosen;
+}
+
+// Loop unrolling
+// Loops marked with .unroll are copied before the optimizer runs, so the copies are
+// optimized like any other straight-line code.
+
+typedef struct {
+    int head;               // first instruction of the loop
+    int back;               // first jump back to the head
+    int first;              // first instruction left out of every copy but the last one
+    int factor;             // number of copies
+    int kept;               // length of every copy but the last one
+} ho_opt_unroll_t;
+
+// New index of instruction t when reached from copy `copy` of the loop, or from
+// outside the loop if copy is -1
+static int ho_opt_unrolled_index(ho_opt_unroll_t *u, int copy, int t)
+{
+    if (t < u->head)
+        return t;
+    if (t > u->back)
+        return t + (u->factor - 1) * u->kept;
+    // Labels and jumps from outside go to the first copy
+    if (copy < 0)
+        return t;
+    // Jumping back to the head starts the next iteration, which is in the next copy
+    if (t == u->head)
+        return u->head + (copy + 1) % u->factor * u->kept;
+    // Instructions left out continue with the next copy
+    if (copy < u->factor - 1 && t >= u->first)
+        return u->head + (copy + 1) * u->kept;
+    return u->head + copy * u->kept + (t - u->head);
+}
+
+// Number of iterations of the loop if it counts a register by 1 down to 0, or up or
+// down to a constant, and nothing else in it uses the register, the flags set by the
+// count or leaves it. The count must start at a constant set right in front of the
+// loop, which is only entered from there. *update is set to the first instruction of
+// the count. Returns 0 if the loop is not one of these.
+static int ho_opt_trip_count(ho_opt_t *opt, int head, int back, int *update)
+{
+    horizon_program_t *program = opt->program;
+    if (program->relocatable || HO_OPT_OP(ho_opt_word(opt, back)) != HO_JNE || back - head < 2)
+        return 0;
+    if (opt->instrs[head].live_in & (HO_OPT_FLAGS_ZN | HO_OPT_FLAGS_V))
+        return 0;
+
+    // SUBS r r #1, JNE head or ADD r r #1, SUBS NIL r #k, JNE head
+    uint32_t test = ho_opt_word(opt, back - 1);
+    if (HO_OPT_OP(test) != HO_SUBS || !HO_OPT_IMM(test) || opt->instrs[back - 1].reloc >= 0)
+        return 0;
+    int reg = HO_OPT_RM(test);
+    int down = HO_OPT_RD(test) == reg;
+    int step = -1;
+    int limit = 0;
+    int first = back - 1;
+    if (down && HO_OPT_RN(test) != 1)
+        return 0;
+    if (!down)
+    {
+        uint32_t word = ho_opt_word(opt, back - 2);
+        int op = HO_OPT_OP(word);
+        if (HO_OPT_RD(test) != HO_NIL || (op != HO_ADD && op != HO_SUB) || !HO_OPT_IMM(word) || opt->instrs[back - 2].reloc >= 0 ||
+            HO_OPT_RD(word) != reg || HO_OPT_RM(word) != reg || HO_OPT_RN(word) != 1)
+            return 0;
+        step = (op == HO_ADD) ? 1 : -1;
+        limit = (int8_t) HO_OPT_RN(test);
+        first = back - 2;
+    }
+    if (reg >= HO_PC || first <= head)
+        return 0;
+
+    for (int i = head; i <= back; i++)
+    {
+        if (opt->instrs[i].pinned || (i > first && opt->instrs[i].target))
+            return 0;
+        if (i >= first)
+            continue;
+
+        uint32_t word = ho_opt_word(opt, i);
+        int op = HO_OPT_OP(word);
+        uint32_t use, kill;
+        ho_opt_use_kill(opt, i, &use, &kill);
+        if (op == HO_LOAD || op == HO_LOADI || op == HO_LOADD || op == HO_POP)
+            kill |= ho_opt_reg_bit(HO_OPT_RD(word));
+        if ((use | kill) & ho_opt_reg_bit(reg))
+            return 0;
+
+        int succ[2];
+        int len_succ = ho_opt_successors(opt, i, succ);
+        if (len_succ < 0)
+            return 0;
+        for (int j = 0; j < len_succ; j++)
+        {
+            if (succ[j] <= head || succ[j] > first)
+                return 0;
+        }
+    }
+
+    // Only entered by falling into the head
+    for (int r = 0; r < program->len_relocs; r++)
+    {
+        horizon_reloc_t *reloc = &program->relocs[r];
+        if (reloc->kind == HO_RELOC_CODE && reloc->offset != opt->base + back &&
+            (int) (program->code[reloc->offset] & ho_opt_reloc_mask(reloc)) == opt->base + head)
+            return 0;
+    }
+    if (program->code_start == head)
+        return 0;
+
+    // Initial value
+    int i = head - 1;
+    for (; i >= 0; i--)
+    {
+        uint32_t word = ho_opt_word(opt, i);
+        int op = HO_OPT_OP(word);
+        uint32_t use, kill;
+        ho_opt_use_kill(opt, i, &use, &kill);
+        if (op == HO_LOAD || op == HO_LOADI || op == HO_LOADD || op == HO_POP)
+            kill |= ho_opt_reg_bit(HO_OPT_RD(word));
+        if (kill & ho_opt_reg_bit(reg))
+            break;
+        if (opt->instrs[i].target || ho_opt_is_jump(op) || !ho_opt_falls_through(opt, i))
+            return 0;
+    }
+    if (i < 0 || opt->instrs[i].reloc >= 0)
+        return 0;
+
+    uint32_t word = ho_opt_word(opt, i);
+    int op = HO_OPT_OP(word);
+    int start;
+    if ((op == HO_ADD || op == HO_SUB) && HO_OPT_IMM(word) && HO_OPT_RD(word) == reg && HO_OPT_RM(word) == HO_NIL)
+    {
+        start = (int8_t) HO_OPT_RN(word);
+        if (op == HO_SUB)
+            start = -start;
+    }
+    else if (op == HO_POP && i > 0 && !opt->instrs[i].target && HO_OPT_OP(ho_opt_word(opt, i - 1)) == HO_PUSH &&
+        HO_OPT_IMM(ho_opt_word(opt, i - 1)) && opt->instrs[i - 1].reloc < 0)
+    {
+        start = ho_opt_word(opt, i - 1) & 0xFFFF;
+    }
+    else
+        return 0;
+
+    *update = first;
+    if (down)
+        return (start >= 1) ? start : 0;
+    if (step > 0)
+        return (limit > start) ? limit - start : 0;
+    return (start > limit) ? start - limit : 0;
+}
+
+// Copy the body of the loop starting at head factor times
+// Returns 1 if the loop was unrolled, 0 if it was left as it is
+static int ho_opt_unroll(ho_opt_t *opt, int head, int factor)
+{
+    horizon_program_t *program = opt->program;
+    ho_opt_unroll_t u = { .head = head, .back = -1, .factor = factor };
+
+    for (int i = head + 1; i < opt->len && u.back < 0; i++)
+    {
+        if (ho_opt_jump_target(opt, i) == head)
+            u.back = i;
+    }
+    if (u.back < 0)
+        return 0;
+
+    int op = HO_OPT_OP(ho_opt_word(opt, u.back));
+    // PC-relative windows can't cross into the loop
+    if (opt->instrs[u.back].pinned || (head > 0 && opt->instrs[head - 1].pinned && opt->instrs[head].pinned))
+        return 0;
+
+    // Counted loops only test the count in the last copy, and loops jumping back with
+    // JMP continue into the next copy. In other loops every copy would still test and
+    // leave where the original jumps back, running as many instructions as before
+    int update = -1;
+    int trips = ho_opt_trip_count(opt, head, u.back, &update);
+    int folded = trips > 0 && trips % factor == 0;
+    if (!folded && op != HO_JMP)
+        return 0;
+    u.first = (folded) ? update : u.back;
+    u.kept = u.first - head;
+
+    int growth = (factor - 1) * u.kept;
+    if (u.kept <= 0 || program->len_code + growth > HOVM_ROM_SIZE)
+        return 0;
+
+    // Instructions
+    int len = opt->len + growth;
+    int64_t *code = malloc(sizeof(int64_t) * len);
+    for (int i = 0; i < opt->len; i++)
+    {
+        if (i < head || i > u.back)
+        {
+            code[ho_opt_unrolled_index(&u, -1, i)] = program->code[opt->base + i];
+            continue;
+        }
+        for (int c = 0; c < factor; c++)
+        {
+            int64_t word = program->code[opt->base + i];
+            if (c < factor - 1 && i >= u.first)
+                continue;
+            // The last copy counts for all of them
+            if (folded && c == factor - 1 && i == u.first)
+                word = (word & ~(int64_t) 0xFF) | factor;
+            code[head + c * u.kept + (i - head)] = word;
+        }
+    }
+
+    if (program->len_code + growth > program->len_code_space)
+    {
+        program->len_code_space = program->len_code + growth;
+        program->code = realloc(program->code, sizeof(int64_t) * program->len_code_space);
+    }
+    for (int i = 0; i < len; i++)
+        program->code[opt->base + i] = code[i];
+    program->len_code += growth;
+    free(code);
+
+    // Relocations, the ones in the loop are repeated for every copy
+    horizon_reloc_t *relocs = malloc(sizeof(horizon_reloc_t) * (program->len_relocs * factor + 1));
+    int len_relocs = 0;
+    for (int r = 0; r < program->len_relocs; r++)
+    {
+        horizon_reloc_t reloc = program->relocs[r];
+        int at = reloc.offset - opt->base;
+        int in_loop = at >= head && at <= u.back;
+        int copies = 0;
+        for (int c = (in_loop) ? 0 : -1; c < ((in_loop) ? factor : 0); c++)
+        {
+            horizon_reloc_t copy = reloc;
+            if (c >= 0 && c < factor - 1 && at >= u.first)
+                continue;
+            if (copies++ && reloc.import)
+                copy.import = strdup(reloc.import);
+            if (at >= 0 && at < opt->len)
+                copy.offset = opt->base + ho_opt_unrolled_index(&u, c, at);
+
+            if (copy.kind == HO_RELOC_CODE)
+            {
+                uint32_t mask = ho_opt_reloc_mask(&copy);
+                int64_t *word = &program->code[copy.offset];
+                int t = (int) (*word & mask) - opt->base;
+                if (t >= 0 && t <= opt->len)
+                    t = ho_opt_unrolled_index(&u, c, t);
+                if (t >= 0 && t <= len)
+                    *word = (*word & ~(int64_t) mask) | ((opt->base + t) & mask);
+            }
+            relocs[len_relocs++] = copy;
+        }
+    }
+    free(program->relocs);
+    program->relocs = relocs;
+    program->len_relocs = len_relocs;
+    program->len_relocs_space = program->len_relocs * factor + 1;
+
+    // Labels and lines in the loop point to the first copy
+    for (int i = 0; i < program->len_symbols; i++)
+    {
+        int t = (int) program->symbols[i].value - opt->base;
+        if (program->symbols[i].type == HO_SYM_LABEL && t >= 0 && t <= opt->len)
+            program->symbols[i].value = opt->base + ho_opt_unrolled_index(&u, -1, t);
+    }
+    if (program->code_start >= 0 && program->code_start <= opt->len)
+        program->code_start = ho_opt_unrolled_index(&u, -1, program->code_start);
+    for (int i = 0; i < program->len_code_lines; i++)
+    {
+        int t = program->code_line_offsets[i];
+        if (t >= 0 && t <= opt->len)
+            program->code_line_offsets[i] = ho_opt_unrolled_index(&u, -1, t);
+    }
+
+    // The start jump, see horizon_parse
+    program->code[0] = (program->code[0] & ~(int64_t) 0xFFFF) | ((opt->base + program->code_start) & 0xFFFF);
+    return 1;
+}
+
+// Unroll the loops marked with .unroll in an error-free program
+// Returns the number of loops unrolled.
+int horizon_unroll_loops(horizon_program_t *program)
+{
+    if (!program || program->error_count)
+        return 0;
+
+    ho_opt_t opt = { 0 };
+    opt.program = program;
+    opt.base = program->data_offset + program->len_data;
+
+    // From the last loop, so unrolling doesn't move the ones left
+    int unrolled = 0;
+    for (int k = program->len_unrolls - 1; k >= 0; k--)
+    {
+        opt.len = program->len_code - opt.base;
+        int head = program->unrolls[k].offset;
+        if (head < 0 || head >= opt.len)
+            continue;
+
+        ho_opt_init_instrs(&opt);
+        if (!ho_opt_mark_pinned(&opt))
+        {
+            free(opt.instrs);
+            break;
+        }
+        ho_opt_mark_targets(&opt);
+        ho_opt_liveness(&opt);
+
+        unrolled += ho_opt_unroll(&opt, head, program->unrolls[k].factor);
+        free(opt.instrs);
+    }
+
+    return unrolled;
+}
+
+// Register allocation
+// Virtual registers are only followed within routines, where calls continue at their
+// return address, while physical registers are followed into called routines and back
+// to every call site. Every virtual register live into an instruction or written by
+// it is an element, and the elements flowing into each other along the edges of the
+// control-flow graph are joined into webs, which are colored with R0-R11.
+
+#define HO_RA_COLORS        12
+#define HO_RA_PALETTE       0xFFF           // liveness bits of R0-R11
+#define HO_RA_PHYSICAL      0x7FFF          // liveness bits of R0-LR
+#define HO_RA_NO_CALL       -2
+#define HO_RA_UNKNOWN       -1              // routine called through a register or imported
+#define HO_RA_MAX_DEPTH     4               // deepest loop nesting counted in spill costs
+#define HO_RA_NEVER         1e300           // cost of a spill which can't be done
+
+enum ho_ra_kind {
+    HO_RA_ORIGINAL,
+    HO_RA_SPILL,            // load or store of a web kept in memory, its webs are not spilled again
+    HO_RA_SPLIT,            // load or store around a call
+};
+
+enum ho_ra_mode {
+    HO_RA_KEEP,             // the web has a register
+    HO_RA_MEMORY,           // stored after every write and loaded before every read
+    HO_RA_AROUND_CALLS,     // stored in front of and loaded after every call it is live across
+};
+
+// Set of register numbers
+typedef struct {
+    uint64_t w[4];
+} ho_ra_regs_t;
+
+// Load or store of a memory slot inserted in front of or after an instruction
+typedef struct {
+    int at;
+    int after;
+    int kind;               // enum ho_ra_kind
+    int len;
+    int64_t words[5];
+    int addr_word;          // index of the word with the address of the slot
+    int field;              // of the address, HO_RELOC_IMM8 or HO_RELOC_IMM16
+} ho_ra_insert_t;
+
+typedef struct {
+    ho_opt_t opt;
+    int *kind;              // enum ho_ra_kind of every instruction, kept between rounds
+    int len_slots;          // memory words used so far, added after the data section at the end
+
+    // Control flow, see ho_ra_init
+    int *callee;            // for the JMP of a call, index in entries of the routine called or
+                            //  HO_RA_UNKNOWN, HO_RA_NO_CALL for other instructions
+    int *entries;           // first instruction of every routine called
+    int *entry_of;          // index in entries of the routine starting at an instruction, or -1
+    int len_entries;
+    int *cut;               // len + 1, 1 if words can be inserted in front of instruction i
+    double *weight;         // 10 to the power of the loop nesting depth
+
+    // Virtual registers live within routines, and the one written by every instruction
+    ho_ra_regs_t *vin;
+    ho_ra_regs_t *vout;
+    int *vdef;              // -1 if none
+
+    // Webs
+    int *in_base;           // first element of the registers live into each instruction
+    int *def_elem;          // element written by each instruction, -1 if none
+    int *web;               // web of every element
+    int len_webs;
+    int web_words;          // words of a set of webs
+
+    // Routines, see ho_ra_routines
+    uint32_t *clob_phys;    // R0-R11 written by every routine and the ones it calls
+    uint64_t *clob_webs;    // webs written by every routine and the ones it calls
+    int *open;              // exits of the instruction may return to code outside the program
+    int *exit_head;         // routines whose exits an instruction is, linked through exit_next
+    int *exit_next;
+    int *exit_routine;
+    int len_exits;
+
+    // Physical registers which may have been written since the routine was entered, the
+    // ones written by the program itself and the ones live, in liveness bits
+    uint32_t *win;
+    uint32_t *win_own;
+    uint32_t *pin;
+    uint32_t *pout;
+
+    // Interference graph, the colors come first and then the webs
+    int nodes;
+    int row;                // words of a row of adj
+    uint64_t *adj;
+    int *moves;             // pairs of nodes copied into each other
+    int len_moves;
+    int *color;             // of every web, -1 if none
+    int *mode;              // enum ho_ra_mode of every web
+    int *first_at;          // first instruction reading or writing every web
+    double *cost_memory;    // cost of each kind of spill of every web
+    double *cost_calls;
+} ho_ra_t;
+
+static int ho_ra_is_vreg(int reg)
+{
+    return reg >= HORIZON_VREG_BASE && reg < HORIZON_VREG_BASE + HORIZON_VREGS;
+}
+
+static int ho_ra_has(ho_ra_regs_t *set, int reg)
+{
+    return (set->w[reg >> 6] >> (reg & 63)) & 1;
+}
+
+// Number of registers in the set below reg
+static int ho_ra_rank(ho_ra_regs_t *set, int reg)
+{
+    int rank = 0;
+    for (int k = 0; k < (reg >> 6); k++)
+        rank += __builtin_popcountll(set->w[k]);
+    return rank + __builtin_popcountll(set->w[reg >> 6] & ((1ULL << (reg & 63)) - 1));
+}
+
+static int ho_ra_count(ho_ra_regs_t *set)
+{
+    return ho_ra_rank(set, 255) + ho_ra_has(set, 255);
+}
+
+// Next register in the set from reg on, or -1
+static int ho_ra_next(ho_ra_regs_t *set, int reg)
+{
+    for (int k = reg >> 6; reg < 256 && k < 4; k++, reg = k << 6)
+    {
+        uint64_t bits = set->w[k] & (~0ULL << (reg & 63));
+        if (bits)
+            return (k << 6) + __builtin_ctzll(bits);
+    }
+    return -1;
+}
+
+// Register fields of an instruction, the shift of the one written in *def (-1 if none)
+// and the shifts of the ones read in shifts
+// Returns the number of fields read.
+static int ho_ra_fields(uint32_t word, int *def, int *shifts)
+{
+    int op = HO_OPT_OP(word);
+    int imm = HO_OPT_IMM(word);
+    int len = 0;
+
+    *def = -1;
+    if (ho_opt_is_alu(op))
+    {
+        *def = 16;
+        shifts[len++] = 8;
+        if (!imm && (op & 0xF) != HO_NOT)
+            shifts[len++] = 0;
+    }
+    else if (op == HO_LOAD || op == HO_LOADI || op == HO_LOADD || op == HO_POP)
+        *def = 16;
+    else if (!imm && (ho_opt_is_jump(op) || op == HO_STORE || op == HO_STOREI || op == HO_STORED || op == HO_PUSH))
+        shifts[len++] = 8;
+    return len;
+}
+
+static int ho_ra_has_vreg(uint32_t word)
+{
+    int def, shifts[2];
+    int len = ho_ra_fields(word, &def, shifts);
+    for (int k = 0; k < len; k++)
+    {
+        if (ho_ra_is_vreg((word >> shifts[k]) & 0xFF))
+            return 1;
+    }
+    return def >= 0 && ho_ra_is_vreg((word >> def) & 0xFF);
+}
+
+// Physical registers written by instruction i, in liveness bits
+static uint32_t ho_ra_phys_defs(ho_opt_t *opt, int i)
+{
+    uint32_t word = ho_opt_word(opt, i);
+    int op = HO_OPT_OP(word);
+    uint32_t use, kill;
+    ho_opt_use_kill(opt, i, &use, &kill);
+    if (op == HO_LOAD || op == HO_LOADI || op == HO_LOADD || op == HO_POP)
+        kill |= ho_opt_reg_bit(HO_OPT_RD(word));
+    return kill & HO_RA_PHYSICAL;
+}
+
+// Instructions a routine continues with after instruction i, calls continue at their
+// return address. *leaves is set if control can also leave the routine, through
+// returns and other jumps through registers, HALT or the end of the program.
+static int ho_ra_successors(ho_ra_t *ra, int i, int *succ, int *leaves)
+{
+    ho_opt_t *opt = &ra->opt;
+    uint32_t word = ho_opt_word(opt, i);
+    int op = HO_OPT_OP(word);
+    int len = 0;
+
+    *leaves = 0;
+    if (ra->callee[i] == HO_RA_NO_CALL)
+    {
+        if (word == HOVM_HALT || (HO_OPT_RD(word) == HO_PC && (ho_opt_is_alu(op) || op == HO_POP || op == HO_LOAD || op == HO_LOADI || op == HO_LOADD)))
+        {
+            *leaves = 1;
+            return 0;
+        }
+        if (ho_opt_is_jump(op))
+        {
+            int t = ho_opt_jump_target(opt, i);
+            if (t >= 0 && t < opt->len)
+                succ[len++] = t;
+            else
+                *leaves = 1;
+            if (op == HO_JMP)
+                return len;
+        }
+    }
+
+    if (i + 1 < opt->len)
+        succ[len++] = i + 1;
+    else
+        *leaves = 1;
+    return len;
+}
+
+// Print an error on the line of instruction i
+static void ho_ra_error(ho_ra_t *ra, int i, int error)
+{
+    horizon_program_t *program = ra->opt.program;
+    int line = 0;
+    for (int k = 0; k < program->len_code_lines && program->code_line_offsets[k] <= i; k++)
+        line = k;
+
+    int module = (program->len_code_lines) ? program->code_line_modules[line] : 0;
+    int number = (program->len_code_lines) ? program->code_line_indices[line] : 0;
+    ho_parser_perror(NULL, error, (module > 0) ? program->modules[module].path : NULL, number);
+    program->error_count++;
+}
+
+// Find the calls and the routines they call, where words can be inserted and the loop
+// nesting of every instruction
+// Returns 0 if code addresses are used in ways which can't be followed.
+static int ho_ra_init(ho_ra_t *ra)
+{
+    ho_opt_t *opt = &ra->opt;
+    int len = opt->len;
+
+    ho_opt_init_instrs(opt);
+    ra->callee = malloc(sizeof(int) * len);
+    ra->entries = malloc(sizeof(int) * len);
+    ra->entry_of = malloc(sizeof(int) * len);
+    ra->cut = malloc(sizeof(int) * (len + 1));
+    ra->weight = malloc(sizeof(double) * len);
+    ra->len_entries = 0;
+    for (int i = 0; i < len; i++)
+    {
+        ra->callee[i] = HO_RA_NO_CALL;
+        ra->entry_of[i] = -1;
+        ra->cut[i] = 1;
+    }
+    ra->cut[len] = 1;
+    if (!ho_opt_mark_pinned(opt))
+        return 0;
+
+    // Nothing can go between PC plus a constant and its destination, except after the
+    // JMP of a call, where it returns to
+    for (int i = 0; i < len; i++)
+    {
+        uint32_t word = ho_opt_word(opt, i);
+        int op = HO_OPT_OP(word);
+        if (!ho_opt_is_alu(op) || !HO_OPT_IMM(word) || HO_OPT_RM(word) != HO_PC)
+            continue;
+        // A jump relative to PC can't be followed by the liveness of virtual registers
+        if (HO_OPT_RD(word) == HO_PC)
+            return 0;
+
+        int k = (int8_t) HO_OPT_RN(word);
+        if ((op & 0xF) == HO_SUB)
+            k = -k;
+        if (op == HO_ADD && HO_OPT_RD(word) == HO_LR && k == 2 && i + 1 < len && HO_OPT_OP(ho_opt_word(opt, i + 1)) == HO_JMP)
+        {
+            int t = ho_opt_jump_target(opt, i + 1);
+            ra->cut[i + 1] = 0;
+            ra->callee[i + 1] = HO_RA_UNKNOWN;
+            if (t >= 0 && t < len)
+            {
+                if (ra->entry_of[t] < 0)
+                {
+                    ra->entry_of[t] = ra->len_entries;
+                    ra->entries[ra->len_entries++] = t;
+                }
+                ra->callee[i + 1] = ra->entry_of[t];
+            }
+            continue;
+        }
+
+        int from = (k < 0) ? i + k : i;
+        int to = (k < 0) ? i : i + k;
+        for (int j = (from < 0) ? 1 : from + 1; j <= to && j <= len; j++)
+            ra->cut[j] = 0;
+    }
+
+    // Loops are found from their jumps back
+    int *depth = calloc(len, sizeof(int));
+    for (int i = 0; i < len; i++)
+    {
+        int t = ho_opt_jump_target(opt, i);
+        if (ra->callee[i] == HO_RA_NO_CALL && t >= 0 && t <= i)
+        {
+            for (int j = t; j <= i; j++)
+                depth[j]++;
+        }
+    }
+    for (int i = 0; i < len; i++)
+    {
+        ra->weight[i] = 1;
+        for (int d = 0; d < depth[i] && d < HO_RA_MAX_DEPTH; d++)
+            ra->weight[i] *= 10;
+    }
+    free(depth);
+    return 1;
+}
+
+// Virtual registers live into and out of every instruction, within routines
+static void ho_ra_vreg_liveness(ho_ra_t *ra)
+{
+    ho_opt_t *opt = &ra->opt;
+    int len = opt->len;
+
+    ra->vin = calloc(len, sizeof(ho_ra_regs_t));
+    ra->vout = calloc(len, sizeof(ho_ra_regs_t));
+    ra->vdef = malloc(sizeof(int) * len);
+    ho_ra_regs_t *use = calloc(len, sizeof(ho_ra_regs_t));
+    for (int i = 0; i < len; i++)
+    {
+        uint32_t word = ho_opt_word(opt, i);
+        int def, shifts[2];
+        int len_shifts = ho_ra_fields(word, &def, shifts);
+        for (int k = 0; k < len_shifts; k++)
+        {
+            int reg = (word >> shifts[k]) & 0xFF;
+            if (ho_ra_is_vreg(reg))
+                use[i].w[reg >> 6] |= 1ULL << (reg & 63);
+        }
+        ra->vdef[i] = (def >= 0 && ho_ra_is_vreg((word >> def) & 0xFF)) ? (int) (word >> def) & 0xFF : -1;
+    }
+
+    int changed = 1;
+    while (changed)
+    {
+        changed = 0;
+        for (int i = len - 1; i >= 0; i--)
+        {
+            int succ[2], leaves;
+            int len_succ = ho_ra_successors(ra, i, succ, &leaves);
+            ho_ra_regs_t out = { 0 };
+            for (int j = 0; j < len_succ; j++)
+            {
+                for (int k = 0; k < 4; k++)
+                    out.w[k] |= ra->vin[succ[j]].w[k];
+            }
+
+            ho_ra_regs_t in = out;
+            if (ra->vdef[i] >= 0)
+                in.w[ra->vdef[i] >> 6] &= ~(1ULL << (ra->vdef[i] & 63));
+            for (int k = 0; k < 4; k++)
+                in.w[k] |= use[i].w[k];
+
+            if (memcmp(&in, &ra->vin[i], sizeof(in)) || memcmp(&out, &ra->vout[i], sizeof(out)))
+            {
+                ra->vin[i] = in;
+                ra->vout[i] = out;
+                changed = 1;
+            }
+        }
+    }
+    free(use);
+}
+
+static int ho_ra_find(int *parent, int e)
+{
+    while (parent[e] != e)
+    {
+        parent[e] = parent[parent[e]];
+        e = parent[e];
+    }
+    return e;
+}
+
+// Element of virtual register reg live into instruction i
+static int ho_ra_in_elem(ho_ra_t *ra, int i, int reg)
+{
+    return ra->in_base[i] + ho_ra_rank(&ra->vin[i], reg);
+}
+
+// Element of virtual register reg live out of instruction i
+static int ho_ra_out_elem(ho_ra_t *ra, int i, int reg)
+{
+    return (ra->vdef[i] == reg) ? ra->def_elem[i] : ho_ra_in_elem(ra, i, reg);
+}
+
+// Node of web w in the interference graph
+static int ho_ra_node(int w)
+{
+    return HO_RA_COLORS + w;
+}
+
+// Join the elements into webs
+static void ho_ra_webs(ho_ra_t *ra)
+{
+    int len = ra->opt.len;
+    int len_elems = 0;
+
+    ra->in_base = malloc(sizeof(int) * len);
+    ra->def_elem = malloc(sizeof(int) * len);
+    for (int i = 0; i < len; i++)
+    {
+        ra->in_base[i] = len_elems;
+        len_elems += ho_ra_count(&ra->vin[i]);
+        ra->def_elem[i] = (ra->vdef[i] >= 0) ? len_elems++ : -1;
+    }
+
+    int *parent = malloc(sizeof(int) * (len_elems + 1));
+    for (int e = 0; e < len_elems; e++)
+        parent[e] = e;
+    for (int i = 0; i < len; i++)
+    {
+        int succ[2], leaves;
+        int len_succ = ho_ra_successors(ra, i, succ, &leaves);
+        for (int j = 0; j < len_succ; j++)
+        {
+            for (int reg = ho_ra_next(&ra->vin[succ[j]], 0); reg >= 0; reg = ho_ra_next(&ra->vin[succ[j]], reg + 1))
+            {
+                int a = ho_ra_find(parent, ho_ra_out_elem(ra, i, reg));
+                int b = ho_ra_find(parent, ho_ra_in_elem(ra, succ[j], reg));
+                parent[a] = b;
+            }
+        }
+    }
+
+    // Number the webs by their roots
+    int *web_of_root = malloc(sizeof(int) * (len_elems + 1));
+    ra->web = malloc(sizeof(int) * (len_elems + 1));
+    ra->len_webs = 0;
+    for (int e = 0; e < len_elems; e++)
+        web_of_root[e] = -1;
+    for (int e = 0; e < len_elems; e++)
+    {
+        int root = ho_ra_find(parent, e);
+        if (web_of_root[root] < 0)
+            web_of_root[root] = ra->len_webs++;
+        ra->web[e] = web_of_root[root];
+    }
+    ra->web_words = ra->len_webs / 64 + 1;
+
+    free(parent);
+    free(web_of_root);
+}
+
+// Find what every called routine writes, including the routines it calls, and the
+// exits of every routine
+// A routine is every instruction reached from its first one, and may call routines
+// which are not the program's. Routines whose address is used other than in a call,
+// or which are exported from an object file, may also be called from code outside the
+// program, like the code reached from the entry point, and so may their exits.
+static void ho_ra_routines(ho_ra_t *ra)
+{
+    ho_opt_t *opt = &ra->opt;
+    horizon_program_t *program = opt->program;
+    int len = opt->len;
+    int len_entries = ra->len_entries;
+
+    ra->clob_phys = calloc(len_entries + 1, sizeof(uint32_t));
+    ra->clob_webs = calloc((len_entries + 1) * ra->web_words, sizeof(uint64_t));
+    ra->open = calloc(len, sizeof(int));
+    ra->exit_head = malloc(sizeof(int) * len);
+    ra->exit_next = NULL;
+    ra->exit_routine = NULL;
+    ra->len_exits = 0;
+    int len_exits_space = 0;
+    for (int i = 0; i < len; i++)
+        ra->exit_head[i] = -1;
+
+    int *escapes = calloc(len_entries + 1, sizeof(int));
+    for (int r = 0; r < program->len_relocs; r++)
+    {
+        horizon_reloc_t *reloc = &program->relocs[r];
+        int at = reloc->offset - opt->base;
+        int t = (int) (program->code[reloc->offset] & ho_opt_reloc_mask(reloc)) - opt->base;
+        int call = at >= 0 && at < len && ra->callee[at] >= 0;
+        if (reloc->kind == HO_RELOC_CODE && !call && t >= 0 && t < len && ra->entry_of[t] >= 0)
+            escapes[ra->entry_of[t]] = 1;
+    }
+    for (int g = 0; program->relocatable && g < program->len_globals; g++)
+    {
+        for (int s = 0; s < program->len_symbols; s++)
+        {
+            int t = (int) program->symbols[s].value - opt->base;
+            if (program->symbols[s].type == HO_SYM_LABEL && t >= 0 && t < len && ra->entry_of[t] >= 0 &&
+                strcasecmp(program->symbols[s].name, program->globals[g]) == 0)
+                escapes[ra->entry_of[t]] = 1;
+        }
+    }
+
+    // Every routine, and last the code reached from the entry point
+    int *mark = calloc(len, sizeof(int));
+    int *in_routine = calloc(len, sizeof(int));
+    int *stack = malloc(sizeof(int) * (len + 1));
+    char *calls = calloc((len_entries + 1) * (len_entries + 1), 1);
+    for (int c = 0; c <= len_entries; c++)
+    {
+        int entry = (c < len_entries) ? ra->entries[c] : program->code_start;
+        int outside = c == len_entries || escapes[c];
+        if (entry < 0 || entry >= len)
+            continue;
+
+        int len_stack = 0;
+        stack[len_stack++] = entry;
+        mark[entry] = c + 1;
+        while (len_stack > 0)
+        {
+            int i = stack[--len_stack];
+            if (outside)
+                ra->open[i] = 1;
+            else
+                in_routine[i] = 1;
+
+            ra->clob_phys[c] |= ho_ra_phys_defs(opt, i) & HO_RA_PALETTE;
+            if (ra->def_elem[i] >= 0)
+            {
+                int w = ra->web[ra->def_elem[i]];
+                ra->clob_webs[c * ra->web_words + w / 64] |= 1ULL << (w % 64);
+            }
+            if (ra->callee[i] >= 0)
+                calls[c * (len_entries + 1) + ra->callee[i]] = 1;
+            else if (ra->callee[i] == HO_RA_UNKNOWN)
+                ra->clob_phys[c] |= HO_RA_PALETTE;
+
+            int succ[2], leaves;
+            int len_succ = ho_ra_successors(ra, i, succ, &leaves);
+            if (leaves && c < len_entries)
+            {
+                if (ra->len_exits >= len_exits_space)
+                {
+                    len_exits_space += 100;
+                    ra->exit_next = realloc(ra->exit_next, sizeof(int) * len_exits_space);
+                    ra->exit_routine = realloc(ra->exit_routine, sizeof(int) * len_exits_space);
+                }
+                ra->exit_routine[ra->len_exits] = c;
+                ra->exit_next[ra->len_exits] = ra->exit_head[i];
+                ra->exit_head[i] = ra->len_exits++;
+            }
+            for (int j = 0; j < len_succ; j++)
+            {
+                if (mark[succ[j]] != c + 1)
+                {
+                    mark[succ[j]] = c + 1;
+                    stack[len_stack++] = succ[j];
+                }
+            }
+        }
+    }
+
+    // Code only reached in other ways may be called from anywhere
+    for (int i = 0; i < len; i++)
+    {
+        if (!in_routine[i])
+            ra->open[i] = 1;
+    }
+
+    // Add what the routines called write
+    int changed = 1;
+    while (changed)
+    {
+        changed = 0;
+        for (int c = 0; c < len_entries; c++)
+        {
+            for (int d = 0; d < len_entries; d++)
+            {
+                if (!calls[c * (len_entries + 1) + d] || c == d)
+                    continue;
+                uint32_t phys = ra->clob_phys[c] | ra->clob_phys[d];
+                changed |= phys != ra->clob_phys[c];
+                ra->clob_phys[c] = phys;
+                for (int k = 0; k < ra->web_words; k++)
+                {
+                    uint64_t webs = ra->clob_webs[c * ra->web_words + k] | ra->clob_webs[d * ra->web_words + k];
+                    changed |= webs != ra->clob_webs[c * ra->web_words + k];
+                    ra->clob_webs[c * ra->web_words + k] = webs;
+                }
+            }
+        }
+    }
+
+    free(escapes);
+    free(mark);
+    free(in_routine);
+    free(stack);
+    free(calls);
+}
+
+// Physical registers which may have been written since the routine was entered
+// Calls add what the routine called writes, every register for unknown ones unless
+// only the registers written by the program itself are wanted.
+static uint32_t *ho_ra_written(ho_ra_t *ra, int own)
+{
+    ho_opt_t *opt = &ra->opt;
+    int len = opt->len;
+
+    uint32_t *win = calloc(len, sizeof(uint32_t));
+    int changed = 1;
+    while (changed)
+    {
+        changed = 0;
+        for (int i = 0; i < len; i++)
+        {
+            uint32_t written = win[i] | ho_ra_phys_defs(opt, i);
+            if (ra->callee[i] >= 0)
+                written |= ra->clob_phys[ra->callee[i]];
+            else if (ra->callee[i] == HO_RA_UNKNOWN && !own)
+                written |= HO_RA_PALETTE;
+
+            int succ[2], leaves;
+            int len_succ = ho_ra_successors(ra, i, succ, &leaves);
+            for (int j = 0; j < len_succ; j++)
+            {
+                if ((win[succ[j]] | written) != win[succ[j]])
+                {
+                    win[succ[j]] |= written;
+                    changed = 1;
+                }
+            }
+        }
+    }
+    return win;
+}
+
+// Physical registers live into and out of every instruction, across routines
+// Calls continue into the routine called, and its exits continue at the return
+// address of every call of it. Code outside the program reads the registers written
+// before control goes to it, by calls and exits which may return to it. The result of
+// the program when it halts is what its own code left in the registers, values only
+// written by routines outside the program are not kept for it.
+static void ho_ra_phys_liveness(ho_ra_t *ra)
+{
+    ho_opt_t *opt = &ra->opt;
+    int len = opt->len;
+
+    ra->pin = calloc(len, sizeof(uint32_t));
+    ra->pout = calloc(len, sizeof(uint32_t));
+    uint32_t *ret_live = calloc(ra->len_entries + 1, sizeof(uint32_t));
+    int changed = 1;
+    while (changed)
+    {
+        changed = 0;
+        for (int c = 0; c < ra->len_entries; c++)
+            ret_live[c] = 0;
+        for (int i = 0; i + 1 < len; i++)
+        {
+            if (ra->callee[i] >= 0)
+                ret_live[ra->callee[i]] |= ra->pin[i + 1];
+        }
+
+        for (int i = len - 1; i >= 0; i--)
+        {
+            uint32_t out = 0;
+            if (ra->callee[i] >= 0)
+                out = ra->pin[ra->entries[ra->callee[i]]];
+            else if (ra->callee[i] == HO_RA_UNKNOWN)
+                out = ra->win[i] | ((i + 1 < len) ? ra->pin[i + 1] & ~HO_RA_PALETTE : 0);
+            else
+            {
+                int succ[2], leaves;
+                int len_succ = ho_ra_successors(ra, i, succ, &leaves);
+                for (int j = 0; j < len_succ; j++)
+                    out |= ra->pin[succ[j]];
+                if (leaves && (ho_opt_word(opt, i) == HOVM_HALT || (i + 1 == len && ho_opt_falls_through(opt, i))))
+                    out |= ra->win_own[i];
+                else if (leaves && ra->open[i])
+                    out |= ra->win[i];
+                for (int k = (leaves) ? ra->exit_head[i] : -1; k >= 0; k = ra->exit_next[k])
+                    out |= ret_live[ra->exit_routine[k]];
+            }
+
+            uint32_t use, kill;
+            ho_opt_use_kill(opt, i, &use, &kill);
+            uint32_t in = (use | (out & ~kill)) & HO_RA_PHYSICAL;
+            if (in != ra->pin[i] || out != ra->pout[i])
+            {
+                ra->pin[i] = in;
+                ra->pout[i] = out;
+                changed = 1;
+            }
+        }
+    }
+    free(ret_live);
+}
+
+static void ho_ra_add_edge(ho_ra_t *ra, int a, int b)
+{
+    if (a == b || (a < HO_RA_COLORS && b < HO_RA_COLORS))
+        return;
+    ra->adj[(size_t) a * ra->row + b / 64] |= 1ULL << (b % 64);
+    ra->adj[(size_t) b * ra->row + a / 64] |= 1ULL << (a % 64);
+}
+
+static int ho_ra_adjacent(ho_ra_t *ra, int a, int b)
+{
+    return (ra->adj[(size_t) a * ra->row + b / 64] >> (b % 64)) & 1;
+}
+
+// Add the cost of spilling the web of element e read or written by instruction i
+// Words for a read go in front of at, for a write after i.
+static void ho_ra_occurrence(ho_ra_t *ra, int e, int i, int at, int write)
+{
+    int w = ra->web[e];
+    if (ra->first_at[w] < 0)
+        ra->first_at[w] = i;
+    if (ra->kind[i] == HO_RA_SPILL || !ra->cut[(write) ? i + 1 : at])
+        ra->cost_memory[w] = HO_RA_NEVER;
+    else if (ra->cost_memory[w] < HO_RA_NEVER)
+        ra->cost_memory[w] += ra->weight[i];
+}
+
+// Build the interference graph and the costs of spilling every web
+// Returns 0 if a web is live across a call which writes it.
+static int ho_ra_build_graph(ho_ra_t *ra)
+{
+    ho_opt_t *opt = &ra->opt;
+    int len = opt->len;
+
+    ra->nodes = HO_RA_COLORS + ra->len_webs;
+    ra->row = ra->nodes / 64 + 1;
+    ra->adj = calloc((size_t) ra->nodes * ra->row, sizeof(uint64_t));
+    ra->moves = malloc(sizeof(int) * 2 * (len + 1));
+    ra->len_moves = 0;
+    ra->color = malloc(sizeof(int) * (ra->len_webs + 1));
+    ra->mode = calloc(ra->len_webs + 1, sizeof(int));
+    ra->first_at = malloc(sizeof(int) * (ra->len_webs + 1));
+    ra->cost_memory = calloc(ra->len_webs + 1, sizeof(double));
+    ra->cost_calls = calloc(ra->len_webs + 1, sizeof(double));
+    for (int w = 0; w < ra->len_webs; w++)
+    {
+        ra->color[w] = -1;
+        ra->first_at[w] = -1;
+    }
+
+    for (int i = 0; i < len; i++)
+    {
+        uint32_t word = ho_opt_word(opt, i);
+        int op = HO_OPT_OP(word);
+        int def = (ra->vdef[i] >= 0) ? ho_ra_node(ra->web[ra->def_elem[i]]) : -1;
+        uint32_t phys_defs = ho_ra_phys_defs(opt, i) & HO_RA_PALETTE;
+
+        // The source of a copy can share a register with its destination
+        int src = -1;
+        if (op == HO_ADD && !HO_OPT_IMM(word) && HO_OPT_RM(word) == HO_NIL)
+        {
+            int reg = HO_OPT_RN(word);
+            if (ho_ra_is_vreg(reg))
+                src = ho_ra_node(ra->web[ho_ra_in_elem(ra, i, reg)]);
+            else if (reg < HO_RA_COLORS)
+                src = reg;
+            int dst = (def >= 0) ? def : (int) HO_OPT_RD(word);
+            if (src >= 0 && dst < ra->nodes && (src >= HO_RA_COLORS || dst >= HO_RA_COLORS))
+            {
+                ra->moves[2 * ra->len_moves] = dst;
+                ra->moves[2 * ra->len_moves++ + 1] = src;
+            }
+        }
+
+        // Everything live after a write interferes with it
+        for (int reg = ho_ra_next(&ra->vout[i], 0); reg >= 0; reg = ho_ra_next(&ra->vout[i], reg + 1))
+        {
+            int live = ho_ra_node(ra->web[ho_ra_out_elem(ra, i, reg)]);
+            if (live == src)
+                continue;
+            if (def >= 0)
+                ho_ra_add_edge(ra, def, live);
+            for (int p = 0; p < HO_RA_COLORS; p++)
+            {
+                if (phys_defs & (1 << p))
+                    ho_ra_add_edge(ra, p, live);
+            }
+        }
+        for (int p = 0; p < HO_RA_COLORS && def >= 0; p++)
+        {
+            if ((ra->pout[i] & (1 << p)) && p != src)
+                ho_ra_add_edge(ra, def, p);
+        }
+
+        // Webs live across a call interfere with everything the routine called writes
+        if (ra->callee[i] != HO_RA_NO_CALL)
+        {
+            int c = ra->callee[i];
+            for (int reg = ho_ra_next(&ra->vout[i], 0); reg >= 0; reg = ho_ra_next(&ra->vout[i], reg + 1))
+            {
+                int w = ra->web[ho_ra_in_elem(ra, i, reg)];
+                uint32_t phys = (c >= 0) ? ra->clob_phys[c] : HO_RA_PALETTE;
+                for (int p = 0; p < HO_RA_COLORS; p++)
+                {
+                    if (phys & (1 << p))
+                        ho_ra_add_edge(ra, p, ho_ra_node(w));
+                }
+                for (int k = 0; c >= 0 && k < ra->web_words; k++)
+                {
+                    uint64_t bits = ra->clob_webs[c * ra->web_words + k];
+                    while (bits)
+                    {
+                        int x = k * 64 + __builtin_ctzll(bits);
+                        bits &= bits - 1;
+                        if (x == w)
+                        {
+                            ho_ra_error(ra, i, ERR_VREG_CALL);
+                            return 0;
+                        }
+                        ho_ra_add_edge(ra, ho_ra_node(x), ho_ra_node(w));
+                    }
+                }
+
+                // Stored in front of the call and loaded after it
+                if (ra->cut[i - 1] && ra->cut[i + 1])
+                    ra->cost_calls[w] += 2 * ra->weight[i];
+                else
+                    ra->cost_calls[w] = HO_RA_NEVER;
+            }
+        }
+
+        // Costs of loading every read and storing every write
+        int def_shift, shifts[2];
+        int len_shifts = ho_ra_fields(word, &def_shift, shifts);
+        int at = (ra->callee[i] != HO_RA_NO_CALL) ? i - 1 : i;
+        for (int k = 0; k < len_shifts; k++)
+        {
+            int reg = (word >> shifts[k]) & 0xFF;
+            if (ho_ra_is_vreg(reg) && (k == 0 || reg != (int) ((word >> shifts[0]) & 0xFF)))
+                ho_ra_occurrence(ra, ho_ra_in_elem(ra, i, reg), i, at, 0);
+        }
+        if (ra->def_elem[i] >= 0)
+            ho_ra_occurrence(ra, ra->def_elem[i], i, at, 1);
+    }
+
+    // Webs not live across any call can't be split around them
+    for (int w = 0; w < ra->len_webs; w++)
+    {
+        if (ra->cost_calls[w] == 0)
+            ra->cost_calls[w] = HO_RA_NEVER;
+    }
+    return 1;
+}
+
+// Color the webs by simplifying the graph and assigning registers in reverse order,
+// webs with as many neighbours as registers are taken out optimistically, the one
+// cheapest to spill for its number of neighbours first. Copies get the register of
+// the other side when it is free.
+// Returns the number of webs left without a register.
+static int ho_ra_color(ho_ra_t *ra)
+{
+    int len_webs = ra->len_webs;
+    int *degree = calloc(len_webs + 1, sizeof(int));
+    int *removed = calloc(len_webs + 1, sizeof(int));
+    int *stack = malloc(sizeof(int) * (len_webs + 1));
+    int len_stack = 0;
+
+    for (int w = 0; w < len_webs; w++)
+    {
+        uint64_t *row = &ra->adj[(size_t) ho_ra_node(w) * ra->row];
+        for (int k = 0; k < ra->row; k++)
+            degree[w] += __builtin_popcountll(row[k]);
+    }
+
+    while (len_stack < len_webs)
+    {
+        int pick = -1;
+        double best = 0;
+        for (int w = 0; w < len_webs && (pick < 0 || degree[pick] >= HO_RA_COLORS); w++)
+        {
+            if (removed[w])
+                continue;
+            double cost = ra->cost_memory[w];
+            if (ra->cost_calls[w] < cost)
+                cost = ra->cost_calls[w];
+            cost /= degree[w] + 1;
+            if (degree[w] < HO_RA_COLORS || pick < 0 || cost < best)
+            {
+                pick = w;
+                best = cost;
+            }
+        }
+
+        removed[pick] = 1;
+        stack[len_stack++] = pick;
+        uint64_t *row = &ra->adj[(size_t) ho_ra_node(pick) * ra->row];
+        for (int k = 0; k < ra->row; k++)
+        {
+            uint64_t bits = row[k];
+            while (bits)
+            {
+                int n = k * 64 + __builtin_ctzll(bits);
+                bits &= bits - 1;
+                if (n >= HO_RA_COLORS)
+                    degree[n - HO_RA_COLORS]--;
+            }
+        }
+    }
+
+    int spilled = 0;
+    while (len_stack > 0)
+    {
+        int w = stack[--len_stack];
+        int node = ho_ra_node(w);
+        int taken = 0;
+        for (int p = 0; p < HO_RA_COLORS; p++)
+        {
+            if (ho_ra_adjacent(ra, node, p))
+                taken |= 1 << p;
+        }
+        uint64_t *row = &ra->adj[(size_t) node * ra->row];
+        for (int k = 0; k < ra->row; k++)
+        {
+            uint64_t bits = row[k];
+            while (bits)
+            {
+                int n = k * 64 + __builtin_ctzll(bits);
+                bits &= bits - 1;
+                if (n >= HO_RA_COLORS && ra->color[n - HO_RA_COLORS] >= 0)
+                    taken |= 1 << ra->color[n - HO_RA_COLORS];
+            }
+        }
+
+        int color = -1;
+        for (int m = 0; m < ra->len_moves && color < 0; m++)
+        {
+            int other = -1;
+            if (ra->moves[2 * m] == node)
+                other = ra->moves[2 * m + 1];
+            else if (ra->moves[2 * m + 1] == node)
+                other = ra->moves[2 * m];
+            int c = (other < 0) ? -1 : (other < HO_RA_COLORS) ? other : ra->color[other - HO_RA_COLORS];
+            if (c >= 0 && !(taken & (1 << c)))
+                color = c;
+        }
+        for (int p = 0; p < HO_RA_COLORS && color < 0; p++)
+        {
+            if (!(taken & (1 << p)))
+                color = p;
+        }
+
+        ra->color[w] = color;
+        if (color < 0)
+        {
+            ra->mode[w] = (ra->cost_calls[w] <= ra->cost_memory[w]) ? HO_RA_AROUND_CALLS : HO_RA_MEMORY;
+            spilled++;
+        }
+    }
+
+    free(degree);
+    free(removed);
+    free(stack);
+    return spilled;
+}
+
+// Add a load into or store from reg of a memory slot, with AR pushed around it if it
+// is live
+static void ho_ra_add_insert(ho_ra_t *ra, ho_ra_insert_t **inserts, int *len_inserts, int *space,
+    int at, int after, int kind, int load, int reg, int slot, int save_ar)
+{
+    horizon_program_t *program = ra->opt.program;
+    if (*len_inserts >= *space)
+    {
+        *space += 100;
+        *inserts = realloc(*inserts, sizeof(ho_ra_insert_t) * *space);
+    }
+
+    ho_ra_insert_t *insert = &(*inserts)[(*len_inserts)++];
+    uint32_t addr = program->data_offset + program->len_data + slot;
+    insert->at = at;
+    insert->after = after;
+    insert->kind = kind;
+    insert->len = 0;
+    if (save_ar)
+        insert->words[insert->len++] = (int64_t) HO_PUSH << 24 | HO_AR << 8;
+    insert->addr_word = insert->len;
+    if (!program->relocatable && addr <= INT8_MAX)
+    {
+        insert->field = HO_RELOC_IMM8;
+        insert->words[insert->len++] = (int64_t) (HO_ADD | (1 << 7)) << 24 | HO_AR << 16 | HO_NIL << 8 | addr;
+    }
+    else
+    {
+        insert->field = HO_RELOC_IMM16;
+        insert->words[insert->len++] = (int64_t) (HO_PUSH | (1 << 7)) << 24 | addr;
+        insert->words[insert->len++] = (int64_t) HO_POP << 24 | HO_AR << 16;
+    }
+    if (load)
+        insert->words[insert->len++] = (int64_t) HO_LOAD << 24 | reg << 16;
+    else
+        insert->words[insert->len++] = (int64_t) HO_STORE << 24 | reg << 8;
+    if (save_ar)
+        insert->words[insert->len++] = (int64_t) HO_POP << 24 | HO_AR << 16;
+}
+
+// Rebuild the program section with the inserted words and without the deleted
+// instructions, and update every address pointing into it
+// Addresses of an instruction go to the words in front of it, the words after it
+// only run after it.
+static void ho_ra_rebuild(ho_ra_t *ra, ho_ra_insert_t *inserts, int len_inserts, int *deleted)
+{
+    ho_opt_t *opt = &ra->opt;
+    horizon_program_t *program = opt->program;
+    int len = opt->len;
+
+    // Inserts in front of and after every instruction, in the order they were made
+    int *first = malloc(sizeof(int) * 2 * len);
+    int *next = malloc(sizeof(int) * (len_inserts + 1));
+    int *insert_pos = malloc(sizeof(int) * (len_inserts + 1));
+    int new_len = len;
+    for (int i = 0; i < 2 * len; i++)
+        first[i] = -1;
+    for (int k = len_inserts - 1; k >= 0; k--)
+    {
+        int at = 2 * inserts[k].at + inserts[k].after;
+        next[k] = first[at];
+        first[at] = k;
+        new_len += inserts[k].len;
+    }
+    for (int i = 0; deleted && i < len; i++)
+        new_len -= deleted[i];
+
+    int64_t *code = malloc(sizeof(int64_t) * (new_len + 1));
+    int *kind = malloc(sizeof(int) * (new_len + 1));
+    int *pos = malloc(sizeof(int) * len);
+    int *addr = malloc(sizeof(int) * (len + 1));
+    int n = 0;
+    for (int i = 0; i < len; i++)
+    {
+        addr[i] = n;
+        for (int side = 0; side < 2; side++)
+        {
+            for (int k = first[2 * i + side]; k >= 0; k = next[k])
+            {
+                insert_pos[k] = n;
+                for (int j = 0; j < inserts[k].len; j++)
+                {
+                    code[n] = inserts[k].words[j];
+                    kind[n++] = inserts[k].kind;
+                }
+            }
+            if (side == 1)
+                break;
+            pos[i] = n;
+            if (!deleted || !deleted[i])
+            {
+                code[n] = program->code[opt->base + i];
+                kind[n++] = ra->kind[i];
+            }
+        }
+    }
+    addr[len] = n;
+
+    if (opt->base + new_len > program->len_code_space)
+    {
+        program->len_code_space = opt->base + new_len;
+        program->code = realloc(program->code, sizeof(int64_t) * program->len_code_space);
+    }
+    memcpy(program->code + opt->base, code, sizeof(int64_t) * new_len);
+    program->len_code = opt->base + new_len;
+
+    int len_relocs = 0;
+    for (int r = 0; r < program->len_relocs; r++)
+    {
+        horizon_reloc_t reloc = program->relocs[r];
+        int at = reloc.offset - opt->base;
+        if (at >= 0 && at < len && deleted && deleted[at])
+        {
+            free(reloc.import);
+            continue;
+        }
+        if (at >= 0 && at < len)
+            reloc.offset = opt->base + pos[at];
+
+        if (reloc.kind == HO_RELOC_CODE)
+        {
+            uint32_t mask = ho_opt_reloc_mask(&reloc);
+            int64_t *word = &program->code[reloc.offset];
+            int t = (int) (*word & mask) - opt->base;
+            if (t >= 0 && t <= len)
+                *word = (*word & ~(int64_t) mask) | ((opt->base + addr[t]) & mask);
+        }
+        program->relocs[len_relocs++] = reloc;
+    }
+    program->len_relocs = len_relocs;
+
+    // The addresses of the memory slots
+    for (int k = 0; k < len_inserts; k++)
+    {
+        if (program->len_relocs >= program->len_relocs_space)
+        {
+            program->len_relocs_space += 100;
+            program->relocs = realloc(program->relocs, sizeof(horizon_reloc_t) * program->len_relocs_space);
+        }
+        program->relocs[program->len_relocs++] = (horizon_reloc_t) {
+            .offset = opt->base + insert_pos[k] + inserts[k].addr_word,
+            .field = inserts[k].field,
+            .kind = HO_RELOC_DATA,
+            .import = NULL,
+        };
+    }
+
+    for (int i = 0; i < program->len_symbols; i++)
+    {
+        int t = (int) program->symbols[i].value - opt->base;
+        if (program->symbols[i].type == HO_SYM_LABEL && t >= 0 && t <= len)
+            program->symbols[i].value = opt->base + addr[t];
+    }
+    if (program->code_start >= 0 && program->code_start <= len)
+        program->code_start = addr[program->code_start];
+    for (int i = 0; i < program->len_code_lines; i++)
+    {
+        int t = program->code_line_offsets[i];
+        if (t >= 0 && t <= len)
+            program->code_line_offsets[i] = addr[t];
+    }
+
+    // The start jump, see horizon_parse
+    program->code[0] = (program->code[0] & ~(int64_t) 0xFFFF) | ((opt->base + program->code_start) & 0xFFFF);
+
+    free(ra->kind);
+    ra->kind = kind;
+    opt->len = new_len;
+
+    free(first);
+    free(next);
+    free(insert_pos);
+    free(code);
+    free(pos);
+    free(addr);
+}
+
+// Insert the loads and stores of the webs which got no register, each in a new
+// memory slot
+// Returns 0 if one of them can't be kept in memory.
+static int ho_ra_spill(ho_ra_t *ra)
+{
+    int len = ra->opt.len;
+    int *slot = malloc(sizeof(int) * (ra->len_webs + 1));
+    for (int w = 0; w < ra->len_webs; w++)
+    {
+        slot[w] = -1;
+        if (ra->color[w] >= 0)
+            continue;
+        if ((ra->mode[w] == HO_RA_MEMORY && ra->cost_memory[w] >= HO_RA_NEVER) ||
+            (ra->mode[w] == HO_RA_AROUND_CALLS && ra->cost_calls[w] >= HO_RA_NEVER))
+        {
+            ho_ra_error(ra, ra->first_at[w], ERR_VREG_SPILL);
+            free(slot);
+            return 0;
+        }
+        slot[w] = ra->len_slots++;
+    }
+
+    ho_ra_insert_t *inserts = NULL;
+    int len_inserts = 0, space = 0;
+    for (int i = 0; i < len; i++)
+    {
+        uint32_t word = ho_opt_word(&ra->opt, i);
+        int def_shift, shifts[2];
+        int len_shifts = ho_ra_fields(word, &def_shift, shifts);
+
+        // Reads of a call's JMP are loaded in front of the whole call
+        int at = (ra->callee[i] != HO_RA_NO_CALL) ? i - 1 : i;
+        for (int k = 0; k < len_shifts; k++)
+        {
+            int reg = (word >> shifts[k]) & 0xFF;
+            if (!ho_ra_is_vreg(reg) || (k > 0 && reg == (int) ((word >> shifts[0]) & 0xFF)))
+                continue;
+            int w = ra->web[ho_ra_in_elem(ra, i, reg)];
+            if (slot[w] >= 0 && ra->mode[w] == HO_RA_MEMORY)
+                ho_ra_add_insert(ra, &inserts, &len_inserts, &space, at, 0, HO_RA_SPILL, 1, reg, slot[w], (ra->pin[at] >> HO_AR) & 1);
+        }
+        if (ra->def_elem[i] >= 0)
+        {
+            int w = ra->web[ra->def_elem[i]];
+            if (slot[w] >= 0 && ra->mode[w] == HO_RA_MEMORY)
+                ho_ra_add_insert(ra, &inserts, &len_inserts, &space, i, 1, HO_RA_SPILL, 0, ra->vdef[i], slot[w], (ra->pout[i] >> HO_AR) & 1);
+        }
+
+        if (ra->callee[i] == HO_RA_NO_CALL)
+            continue;
+        for (int reg = ho_ra_next(&ra->vout[i], 0); reg >= 0; reg = ho_ra_next(&ra->vout[i], reg + 1))
+        {
+            int w = ra->web[ho_ra_in_elem(ra, i, reg)];
+            if (slot[w] < 0 || ra->mode[w] != HO_RA_AROUND_CALLS)
+                continue;
+            int ar_after = (i + 1 < len) ? (ra->pin[i + 1] >> HO_AR) & 1 : 0;
+            ho_ra_add_insert(ra, &inserts, &len_inserts, &space, i - 1, 0, HO_RA_SPLIT, 0, reg, slot[w], (ra->pin[i - 1] >> HO_AR) & 1);
+            ho_ra_add_insert(ra, &inserts, &len_inserts, &space, i, 1, HO_RA_SPLIT, 1, reg, slot[w], ar_after);
+        }
+    }
+
+    ho_ra_rebuild(ra, inserts, len_inserts, NULL);
+    free(inserts);
+    free(slot);
+    return 1;
+}
+
+// Replace the virtual registers with the colors of their webs and remove the copies
+// left between the same registers
+static void ho_ra_assign(ho_ra_t *ra)
+{
+    ho_opt_t *opt = &ra->opt;
+    horizon_program_t *program = opt->program;
+    int len = opt->len;
+    int *deleted = calloc(len, sizeof(int));
+    int removed = 0;
+
+    for (int i = 0; i < len; i++)
+    {
+        int64_t *code = &program->code[opt->base + i];
+        uint32_t word = *code & 0xFFFFFFFF;
+        if (!ho_ra_has_vreg(word))
+            continue;
+
+        int def_shift, shifts[2];
+        int len_shifts = ho_ra_fields(word, &def_shift, shifts);
+        for (int k = 0; k < len_shifts; k++)
+        {
+            int reg = (word >> shifts[k]) & 0xFF;
+            if (ho_ra_is_vreg(reg))
+                *code = (*code & ~((int64_t) 0xFF << shifts[k])) | (int64_t) ra->color[ra->web[ho_ra_in_elem(ra, i, reg)]] << shifts[k];
+        }
+        if (ra->def_elem[i] >= 0)
+            *code = (*code & ~((int64_t) 0xFF << def_shift)) | (int64_t) ra->color[ra->web[ra->def_elem[i]]] << def_shift;
+
+        word = *code & 0xFFFFFFFF;
+        if (HO_OPT_OP(word) == HO_ADD && !HO_OPT_IMM(word) && HO_OPT_RM(word) == HO_NIL && HO_OPT_RD(word) == HO_OPT_RN(word) &&
+            opt->instrs[i].reloc < 0 && ra->cut[i] && ra->cut[i + 1])
+        {
+            deleted[i] = 1;
+            removed++;
+        }
+    }
+
+    if (removed)
+        ho_ra_rebuild(ra, NULL, 0, deleted);
+    free(deleted);
+}
+
+// Add the memory slots after the data section and move the program section up
+// behind them
+static void ho_ra_add_slots(ho_ra_t *ra)
+{
+    ho_opt_t *opt = &ra->opt;
+    horizon_program_t *program = opt->program;
+    int slots = ra->len_slots;
+    int end = program->data_offset + program->len_data;
+
+    for (int r = 0; r < program->len_relocs; r++)
+    {
+        horizon_reloc_t *reloc = &program->relocs[r];
+        uint32_t mask = ho_opt_reloc_mask(reloc);
+        int64_t *word = &program->code[reloc->offset];
+        int t = (int) (*word & mask);
+        if (reloc->kind == HO_RELOC_CODE && t >= opt->base && t <= program->len_code)
+            *word = (*word & ~(int64_t) mask) | ((t + slots) & mask);
+        if (reloc->offset >= opt->base)
+            reloc->offset += slots;
+    }
+    for (int i = 0; i < program->len_symbols; i++)
+    {
+        symbol_t *symbol = &program->symbols[i];
+        if (symbol->type == HO_SYM_LABEL && (int) symbol->value >= opt->base && (int) symbol->value <= program->len_code)
+            symbol->value += slots;
+    }
+    for (int s = 0; s < slots; s++)
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "%%spill%d", s);
+        ho_add_symbol(program, name, end + s, HO_SYM_VAR);
+    }
+
+    if (program->len_data + slots > program->len_data_space)
+    {
+        program->len_data_space = program->len_data + slots;
+        program->data = realloc(program->data, sizeof(uint32_t) * program->len_data_space);
+    }
+    if (program->len_code + slots > program->len_code_space)
+    {
+        program->len_code_space = program->len_code + slots;
+        program->code = realloc(program->code, sizeof(int64_t) * program->len_code_space);
+    }
+    memmove(program->code + opt->base + slots, program->code + opt->base, sizeof(int64_t) * (program->len_code - opt->base));
+    for (int s = 0; s < slots; s++)
+    {
+        program->data[program->len_data + s] = 0;
+        program->code[end + s] = 0;
+    }
+    program->len_data += slots;
+    program->len_code += slots;
+    opt->base += slots;
+
+    // The start jump, see horizon_parse
+    program->code[0] = (program->code[0] & ~(int64_t) 0xFFFF) | ((opt->base + program->code_start) & 0xFFFF);
+}
+
+static void ho_ra_free_round(ho_ra_t *ra)
+{
+    free(ra->opt.instrs);
+    free(ra->callee);
+    free(ra->entries);
+    free(ra->entry_of);
+    free(ra->cut);
+    free(ra->weight);
+    free(ra->vin);
+    free(ra->vout);
+    free(ra->vdef);
+    free(ra->in_base);
+    free(ra->def_elem);
+    free(ra->web);
+    free(ra->clob_phys);
+    free(ra->clob_webs);
+    free(ra->open);
+    free(ra->exit_head);
+    free(ra->exit_next);
+    free(ra->exit_routine);
+    free(ra->win);
+    free(ra->win_own);
+    free(ra->pin);
+    free(ra->pout);
+    free(ra->adj);
+    free(ra->moves);
+    free(ra->color);
+    free(ra->mode);
+    free(ra->first_at);
+    free(ra->cost_memory);
+    free(ra->cost_calls);
+
+    ho_opt_t opt = ra->opt;
+    int *kind = ra->kind;
+    int len_slots = ra->len_slots;
+    *ra = (ho_ra_t) { .opt = opt, .kind = kind, .len_slots = len_slots };
+    ra->opt.instrs = NULL;
+}
+
+// Replace the virtual registers of an error-free program with R0-R11
+// Returns the number of words inserted into the program.
+int horizon_allocate_registers(horizon_program_t *program)
+{
+    if (!program || program->error_count)
+        return 0;
+
+    ho_ra_t ra = { 0 };
+    ra.opt.program = program;
+    ra.opt.base = program->data_offset + program->len_data;
+    ra.opt.len = program->len_code - ra.opt.base;
+
+    int first = -1;
+    for (int i = 0; i < ra.opt.len && first < 0; i++)
+    {
+        if (ho_ra_has_vreg(ho_opt_word(&ra.opt, i)))
+            first = i;
+    }
+    if (first < 0)
+        return 0;
+
+    int len = program->len_code;
+    int done = 0;
+    ra.kind = calloc(ra.opt.len, sizeof(int));
+    for (int round = 0; round < HORIZON_RA_MAX_ROUNDS && !done; round++)
+    {
+        if (!ho_ra_init(&ra))
+        {
+            ho_ra_error(&ra, first, ERR_VREG_ADDRESSES);
+            ho_ra_free_round(&ra);
+            break;
+        }
+        ho_ra_vreg_liveness(&ra);
+        ho_ra_webs(&ra);
+        ho_ra_routines(&ra);
+        ra.win = ho_ra_written(&ra, 0);
+        ra.win_own = ho_ra_written(&ra, 1);
+        ho_ra_phys_liveness(&ra);
+        if (!ho_ra_build_graph(&ra))
+        {
+            ho_ra_free_round(&ra);
+            break;
+        }
+
+        int spilled = ho_ra_color(&ra);
+        if (!spilled)
+        {
+            ho_ra_assign(&ra);
+            done = 1;
+        }
+        else if (round == HORIZON_RA_MAX_ROUNDS - 1)
+        {
+            for (int w = 0; w < ra.len_webs; w++)
+            {
+                if (ra.color[w] < 0)
+                {
+                    ho_ra_error(&ra, ra.first_at[w], ERR_VREG_SPILL);
+                    break;
+                }
+            }
+        }
+        else if (!ho_ra_spill(&ra))
+        {
+            ho_ra_free_round(&ra);
+            break;
+        }
+        ho_ra_free_round(&ra);
+    }
+
+    if (done && ra.len_slots)
+        ho_ra_add_slots(&ra);
+    free(ra.kind);
+    return program->len_code - len;
+}
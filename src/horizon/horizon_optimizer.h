@@ -0,0 +1,98 @@
+#ifndef HORIZON_OPTIMIZER_H
+#define HORIZON_OPTIMIZER_H
+
+#include "horizon_parser.h"
+#include "horizon_profile.h"
+
+// Number of times the passes are repeated at most, each one can enable more rewrites
+// in the next
+#define HORIZON_OPT_MAX_PASSES      8
+// Instructions followed when checking if the flags set by an instruction are read
+#define HORIZON_OPT_MAX_FLAG_SCAN   64
+// Latest values of a basic block searched for an equal one in value numbering
+#define HORIZON_OPT_VN_WINDOW       256
+// Longest routine body inlined at call sites which run according to a profile
+#define HORIZON_OPT_INLINE_MAX_LEN  16
+// Times the register allocator spills and colors again at most
+#define HORIZON_RA_MAX_ROUNDS       16
+
+// Run the optimizer over the program section of an error-free program
+// Rewrites instruction windows into shorter or cheaper equivalents, propagates
+// constants and copies and removes recomputed values within basic blocks, removes
+// instructions whose results are never read or which can't be reached from the entry
+// point and moves loop-invariant computations in front of simple loops. Then moves
+// the remaining instructions together and updates labels, relocated addresses, the
+// start jump and code_line_offsets. Last, variables not addressed by any instruction
+// are removed and the program section is moved down over them.
+// Code addresses must only come from labels or from reading PC, e.g. in CALL. If a
+// jump to a literal address in the program section or another use of PC is found,
+// only the jump rewrites which keep every instruction in place are done. Object files
+// keep unreachable code and every variable.
+// Returns the number of words removed.
+int horizon_optimize(horizon_program_t *program);
+
+// Reorder the basic blocks of an error-free program with a branch profile recorded by
+// fcemu for the same program, so that conditional jumps taken more often than not
+// fall through instead. The jumps are inverted to go to the old fall-through block,
+// and the blocks they skip are moved behind them together with the blocks falling
+// into each other after them. JGT and JLE are left as they are. Object files and
+// programs using code addresses in ways the optimizer can't follow are not changed.
+// Returns the number of jumps inverted, or -1 if the profile doesn't match the program,
+// see horizon_profile_matches.
+int horizon_optimize_layout(horizon_program_t *program, horizon_profile_t *profile);
+
+// Returns 1 if every address counted in the profile is a jump of the program, i.e. the
+// profile could have been recorded for it, 0 otherwise
+int horizon_profile_matches(horizon_program_t *program, horizon_profile_t *profile);
+
+// Replace CALLs of small leaf routines of an error-free program with a copy of the
+// routine's body, jumps within it going to the copy and jumps to its RETURN going
+// after the call. A routine can be inlined if it ends with the first JMP LR after its
+// label, and in between nothing reads or writes LR or PC, jumps outside of it or
+// through a register, and no label used from elsewhere points into it. LR must not be
+// read after the call before it is written again, HALT doesn't read it.
+// Without a profile, only calls which don't make the program longer are inlined:
+// routines of up to 2 instructions, and routines called from a single place and used
+// nowhere else, which horizon_optimize then removes. With a profile matching the
+// program, calls which ran are also inlined for routines of up to
+// HORIZON_OPT_INLINE_MAX_LEN instructions, the most frequent first, as long as the
+// program fits in ROM. The profile's counts are moved to the new addresses.
+// Object files and programs using code addresses the optimizer can't follow are not
+// changed.
+// Returns the number of calls inlined.
+int horizon_inline_calls(horizon_program_t *program, horizon_profile_t *profile);
+
+// Unroll the loops marked with the .unroll directive in an error-free program, right
+// after encoding. The loop is the marked instruction up to the first jump back to it,
+// and its body is copied the given number of times. If the loop counts a register
+// from a constant set in front of it by 1 to 0 or another constant, and the number
+// of iterations is a multiple of the factor, only the last copy updates and tests the
+// count, by the factor at once. Otherwise every copy but the last one leaves the
+// loop with the inverted jump back. Loops ending with JGT or JLE, programs using code
+// addresses the optimizer can't follow and programs which would not fit in ROM are
+// not changed.
+// Returns the number of loops unrolled.
+int horizon_unroll_loops(horizon_program_t *program);
+
+// Replace the virtual registers %v0 to %v238 of an error-free program with R0 to R11,
+// right after encoding and unrolling. Every write of a virtual register and the reads
+// it reaches form a web, webs which are live at the same time or live while a physical
+// register they would share is written or still needed get different registers, by
+// graph coloring. Virtual registers are local to a routine: calls continue at their
+// return address, and webs live across a call can't share a register with anything the
+// called routine writes, including its own webs. Physical registers are followed into
+// called routines and back to every call site; code outside the program, through
+// register calls or imported symbols, is taken to change every register and to read
+// the ones written before it. At HALT, the registers written by the program are read.
+// Webs which don't get a register are kept in memory, in words added after the data
+// section: either only around the calls they are live across, or with a STORE after
+// every write and a LOAD before every read, whichever is cheaper with reads in loops
+// counting 10 times for every level, and coloring starts again. AR is pushed around
+// the inserted loads and stores where it is live. Copies between webs which end up in
+// the same register are removed.
+// Errors are printed and counted in error_count, e.g. for webs live across a call
+// which writes them, like a recursive one.
+// Returns the number of words inserted into the program.
+int horizon_allocate_registers(horizon_program_t *program);
+
+#endif // HORIZON_OPTIMIZER_H
@@ -1,12 +1,16 @@
+#include <ctype.h>
 #include <limits.h>
 #include <regex.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h>
 
 #include "../helpers.h"
+#include "horizon_compiler.h"
 #include "horizon_parser.h"
+#include "horizon_vm.h"
 #include "../fcerrors.h"
 
 struct horizon_regex_t horizon_regex = { 0 };
@@ -60,6 +64,7 @@ const char *horizon_reserved[] = {
     "LOADD",
     "PUSH",
     "POP",
+    "LI",
     "CONST",
     "DEFINE",
     "INCLUDE",
@@ -90,6 +95,15 @@ const char *horizon_reserved[] = {
 //     "RAM"
 // };
 
+// Copy an identifier of len characters into dest, which must hold len + 1 bytes
+// Identifiers are case insensitive, so they are stored in upper case
+void ho_copy_ident(char *dest, const char *src, int len)
+{
+    for (int i = 0; i < len; i++)
+        dest[i] = toupper(src[i]);
+    dest[len] = 0;
+}
+
 // Print an error message
 void ho_syntax_error(const char *message, int line_minus_one)
 {
@@ -204,12 +218,16 @@ int ho_add_code_line(horizon_program_t *program, char *buf)
     if (program->len_code_lines >= program->len_code_lines_space)
     {
         program->len_code_lines_space += 100;
-        program->code_lines = realloc(program->code_lines, sizeof(uint32_t) * program->len_code_lines_space);
+        program->code_lines = realloc(program->code_lines, sizeof(char *) * program->len_code_lines_space);
         program->code_line_indices = realloc(program->code_line_indices, sizeof(int) * program->len_code_lines_space);
+        program->code_line_offsets = realloc(program->code_line_offsets, sizeof(int) * program->len_code_lines_space);
+        program->code_line_modules = realloc(program->code_line_modules, sizeof(int) * program->len_code_lines_space);
     }
 
     program->code_lines[program->len_code_lines] = buf;
     program->code_line_indices[program->len_code_lines] = program->curr_line;
+    program->code_line_offsets[program->len_code_lines] = program->len_code_lines + program->len_extra_macro_code;
+    program->code_line_modules[program->len_code_lines] = program->curr_module;
     program->len_code_lines++;
 
     return 0;
@@ -230,6 +248,26 @@ int ho_add_code(horizon_program_t *program, int64_t code)
     return 0;
 }
 
+// Record that the last instruction added has an address in the given field
+// The kind of address is taken from program->reloc_kind, which is then reset
+int ho_add_reloc(horizon_program_t *program, int field)
+{
+    if (program->len_relocs >= program->len_relocs_space)
+    {
+        program->len_relocs_space += 100;
+        program->relocs = realloc(program->relocs, sizeof(horizon_reloc_t) * program->len_relocs_space);
+    }
+
+    horizon_reloc_t *reloc = &program->relocs[program->len_relocs++];
+    reloc->offset = program->len_code - 1;
+    reloc->field = field;
+    reloc->kind = program->reloc_kind;
+    reloc->import = (program->reloc_kind == HO_RELOC_IMPORT) ? strdup(program->reloc_import) : NULL;
+
+    program->reloc_kind = HO_RELOC_NONE;
+    return 0;
+}
+
 // Initilizes all regex used by the parser
 // If free_instead is not 0, frees the regex variables instead
 int ho_init_regex(int free_instead)
@@ -318,6 +356,10 @@ int ho_match_literal(uint32_t *dest, char **buf)
     char *endptr = NULL;
     int64_t num = strtol(*buf + match.rm_so, &endptr, 0);
 
+    // The regex only checks the first character, e.g. of identifiers starting with x
+    if (endptr == *buf + match.rm_so)
+        return ERR_NO_MATCH;
+
     if (num < INT32_MIN || num > UINT32_MAX)
     {
         *dest = -1;
@@ -415,7 +457,7 @@ int ho_match_register(uint32_t *dest, char **buf)
      *  6: P matched // discarded, analogous to 2
      *  7: N matched // discarded, analogous to 2
      *  8: NI matched // discarded, analogous to 2
-     *  9: Register matched, expect non-alphanumeric
+     *  9: Register matched, expect non-alphanumeric, %v<n> goes here directly
      *  10: error
     */
     int state = 0;
@@ -437,7 +479,7 @@ int ho_match_register(uint32_t *dest, char **buf)
             }
         }
 
-        switch ((*buf)[i])
+        switch (toupper((*buf)[i]))
         {
             case 'R':
                 if (state == 0)
@@ -475,7 +517,7 @@ int ho_match_register(uint32_t *dest, char **buf)
                 if (state == 0)
                 {
                     i++;
-                    if ((*buf)[i] != 'R')
+                    if (toupper((*buf)[i]) != 'R')
                         return ERR_NO_MATCH;
                     i++;
                     regnum = 12;
@@ -487,7 +529,7 @@ int ho_match_register(uint32_t *dest, char **buf)
                 if (state == 0)
                 {
                     i++;
-                    if ((*buf)[i] != 'P')
+                    if (toupper((*buf)[i]) != 'P')
                         return ERR_NO_MATCH;
                     i++;
                     regnum = 13;
@@ -499,7 +541,7 @@ int ho_match_register(uint32_t *dest, char **buf)
                 if (state == 0)
                 {
                     i++;
-                    if ((*buf)[i] != 'R')
+                    if (toupper((*buf)[i]) != 'R')
                         return ERR_NO_MATCH;
                     i++;
                     regnum = 14;
@@ -511,7 +553,7 @@ int ho_match_register(uint32_t *dest, char **buf)
                 if (state == 0)
                 {
                     i++;
-                    if ((*buf)[i] != 'C')
+                    if (toupper((*buf)[i]) != 'C')
                         return ERR_NO_MATCH;
                     i++;
                     regnum = 15;
@@ -523,7 +565,7 @@ int ho_match_register(uint32_t *dest, char **buf)
                 if (state == 0)
                 {
                     i++;
-                    if ((*buf)[i] != 'I' && (*buf)[i + 1] != 'L')
+                    if (toupper((*buf)[i]) != 'I' && toupper((*buf)[i + 1]) != 'L')
                         return ERR_NO_MATCH;
                     i += 2;
                     regnum = 255;
@@ -531,6 +573,21 @@ int ho_match_register(uint32_t *dest, char **buf)
                     continue;
                 } // else
                 return ERR_NO_MATCH;
+            case '%':
+                // Virtual register, numbered after the physical ones
+                if (state == 0 && toupper((*buf)[i + 1]) == 'V' && isdigit((*buf)[i + 2]))
+                {
+                    i += 2;
+                    regnum = 0;
+                    while (isdigit((*buf)[i]) && regnum < HORIZON_VREGS)
+                        regnum = regnum * 10 + (*buf)[i++] - '0';
+                    if (regnum >= HORIZON_VREGS)
+                        return ERR_NO_MATCH;
+                    regnum += HORIZON_VREG_BASE;
+                    state = 9;
+                    continue;
+                } // else
+                return ERR_NO_MATCH;
 
             default:
                 return ERR_NO_MATCH;
@@ -564,7 +621,7 @@ int ho_match_identifier(uint32_t *dest, char **buf)
         return ERR_IDENT_TOO_LONG;
 
     char word[HORIZON_IDENT_MAX_LEN + 1] = { 0 };
-    strncpy(word, *buf, len);
+    ho_copy_ident(word, *buf, len);
 
     if (ho_is_reserved(word))
         return ERR_RESERVED_WORD;
@@ -588,12 +645,12 @@ int ho_match_directive(uint32_t *dest, char **buf)
     int ret = regexec(&regex, *buf, 1, &match, 0);
 
     int len = match.rm_eo - match.rm_so;
-    if (ret != 0 || len < 4 || len > 6)
+    if (ret != 0 || len < 4 || len > 8)
         return ERR_NO_MATCH;
 
     if (len == 4)
     {
-        if (strncmp(*buf, ".VAR", len) == 0)
+        if (strncasecmp(*buf, ".VAR", len) == 0)
         {
             *dest = HO_VAR;
             *buf += len;
@@ -601,13 +658,13 @@ int ho_match_directive(uint32_t *dest, char **buf)
         }
     } else if (len == 5)
     {
-        if (strncmp(*buf, ".NAME", len) == 0)
+        if (strncasecmp(*buf, ".NAME", len) == 0)
         {
             *dest = HO_NAME;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, ".DESC", len) == 0)
+        if (strncasecmp(*buf, ".DESC", len) == 0)
         {
             *dest = HO_DESC;
             *buf += len;
@@ -615,30 +672,52 @@ int ho_match_directive(uint32_t *dest, char **buf)
         }
     } else if (len == 6)
     {
-        if (strncmp(*buf, ".CONST", len) == 0)
+        if (strncasecmp(*buf, ".CONST", len) == 0)
         {
             *dest = HO_CONST;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, ".ARRAY", len) == 0)
+        if (strncasecmp(*buf, ".ARRAY", len) == 0)
         {
             *dest = HO_ARRAY;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, ".START", len) == 0)
+        if (strncasecmp(*buf, ".START", len) == 0)
         {
             *dest = HO_START;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, ".MACRO", len) == 0)
+        if (strncasecmp(*buf, ".MACRO", len) == 0)
         {
             *dest = HO_MACRO;
             *buf += len;
             return NO_ERR;
         }
+    } else if (len == 7)
+    {
+        if (strncasecmp(*buf, ".GLOBAL", len) == 0)
+        {
+            *dest = HO_GLOBAL;
+            *buf += len;
+            return NO_ERR;
+        }
+        if (strncasecmp(*buf, ".UNROLL", len) == 0)
+        {
+            *dest = HO_UNROLL;
+            *buf += len;
+            return NO_ERR;
+        }
+    } else if (len == 8)
+    {
+        if (strncasecmp(*buf, ".INCLUDE", len) == 0)
+        {
+            *dest = HO_INCLUDE;
+            *buf += len;
+            return NO_ERR;
+        }
     }
 
     return ERR_NO_MATCH;
@@ -656,7 +735,7 @@ int ho_match_whitespace(char **buf)
 int ho_match_string(const char *str, char **buf)
 {
     int len = strlen(str);
-    if (strncmp(str, *buf, len) == 0)
+    if (strncasecmp(str, *buf, len) == 0)
     {
         *buf += len;
         return NO_ERR;
@@ -692,7 +771,7 @@ int ho_match_comment(char **dest, char **buf)
     {
         if (dest)
             *dest = *buf + 1;
-        while (**buf != '\n')
+        while (**buf != '\n' && **buf != '\0')
             (*buf)++;
     } else
     {
@@ -740,7 +819,7 @@ int ho_match_noop(uint32_t *dest, char **buf)
     if (ret != 0 || len != 4)
         return ERR_NO_MATCH;
 
-    if (strncmp(*buf, "NOOP", len) == 0)
+    if (strncasecmp(*buf, "NOOP", len) == 0)
     {
         *dest = HO_NOOP;
         *buf += len;
@@ -770,7 +849,7 @@ int ho_match_not(uint32_t *dest, char **buf)
 
     if (len == 3)
     {
-        if (strncmp(*buf, "NOT", len) == 0)
+        if (strncasecmp(*buf, "NOT", len) == 0)
         {
             *dest = HO_NOT;
             *buf += len;
@@ -778,7 +857,7 @@ int ho_match_not(uint32_t *dest, char **buf)
         }
     } else
     {
-        if (strncmp(*buf, "NOTS", len) == 0)
+        if (strncasecmp(*buf, "NOTS", len) == 0)
         {
             *dest = HO_NOTS;
             *buf += len;
@@ -809,7 +888,7 @@ int ho_match_pop(uint32_t *dest, char **buf)
 
     if (len == 3)
     {
-        if (strncmp(*buf, "POP", len) == 0)
+        if (strncasecmp(*buf, "POP", len) == 0)
         {
             *dest = HO_POP;
             *buf += len;
@@ -838,74 +917,74 @@ int ho_match_alu(uint32_t *dest, char **buf)
     if (ret != 0 || len < 2 || len > 5)
         return ERR_NO_MATCH;
 
-    if (len == 2 && strncmp(*buf, "OR", len) == 0)
+    if (len == 2 && strncasecmp(*buf, "OR", len) == 0)
     {
         *dest = HO_OR;
         *buf += len;
         return NO_ERR;
     } else if (len == 3)
     {
-        if (strncmp(*buf, "ADD", len) == 0)
+        if (strncasecmp(*buf, "ADD", len) == 0)
         {
             *dest = HO_ADD;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, "SUB", len) == 0)
+        if (strncasecmp(*buf, "SUB", len) == 0)
         {
             *dest = HO_SUB;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, "MUL", len) == 0)
+        if (strncasecmp(*buf, "MUL", len) == 0)
         {
             *dest = HO_MUL;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, "DIV", len) == 0)
+        if (strncasecmp(*buf, "DIV", len) == 0)
         {
             *dest = HO_DIV;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, "MOD", len) == 0)
+        if (strncasecmp(*buf, "MOD", len) == 0)
         {
             *dest = HO_MOD;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, "EXP", len) == 0)
+        if (strncasecmp(*buf, "EXP", len) == 0)
         {
             *dest = HO_EXP;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, "LSH", len) == 0)
+        if (strncasecmp(*buf, "LSH", len) == 0)
         {
             *dest = HO_LSH;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, "RSH", len) == 0)
+        if (strncasecmp(*buf, "RSH", len) == 0)
         {
             *dest = HO_RSH;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, "AND", len) == 0)
+        if (strncasecmp(*buf, "AND", len) == 0)
         {
             *dest = HO_AND;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, "XOR", len) == 0)
+        if (strncasecmp(*buf, "XOR", len) == 0)
         {
             *dest = HO_XOR;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, "ORS", len) == 0)
+        if (strncasecmp(*buf, "ORS", len) == 0)
         {
             *dest = HO_ORS;
             *buf += len;
@@ -913,73 +992,73 @@ int ho_match_alu(uint32_t *dest, char **buf)
         }
     } else if (len == 4)
     {
-        if (strncmp(*buf, "BCAT", len) == 0)
+        if (strncasecmp(*buf, "BCAT", len) == 0)
         {
             *dest = HO_BCAT;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, "HCAT", len) == 0)
+        if (strncasecmp(*buf, "HCAT", len) == 0)
         {
             *dest = HO_HCAT;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, "ADDS", len) == 0)
+        if (strncasecmp(*buf, "ADDS", len) == 0)
         {
             *dest = HO_ADDS;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, "SUBS", len) == 0)
+        if (strncasecmp(*buf, "SUBS", len) == 0)
         {
             *dest = HO_SUBS;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, "MULS", len) == 0)
+        if (strncasecmp(*buf, "MULS", len) == 0)
         {
             *dest = HO_MULS;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, "DIVS", len) == 0)
+        if (strncasecmp(*buf, "DIVS", len) == 0)
         {
             *dest = HO_DIVS;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, "MODS", len) == 0)
+        if (strncasecmp(*buf, "MODS", len) == 0)
         {
             *dest = HO_MODS;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, "EXPS", len) == 0)
+        if (strncasecmp(*buf, "EXPS", len) == 0)
         {
             *dest = HO_EXPS;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, "LSHS", len) == 0)
+        if (strncasecmp(*buf, "LSHS", len) == 0)
         {
             *dest = HO_LSHS;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, "RSHS", len) == 0)
+        if (strncasecmp(*buf, "RSHS", len) == 0)
         {
             *dest = HO_RSHS;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, "ANDS", len) == 0)
+        if (strncasecmp(*buf, "ANDS", len) == 0)
         {
             *dest = HO_ANDS;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, "XORS", len) == 0)
+        if (strncasecmp(*buf, "XORS", len) == 0)
         {
             *dest = HO_XORS;
             *buf += len;
@@ -987,13 +1066,13 @@ int ho_match_alu(uint32_t *dest, char **buf)
         }
     } else if (len == 5)
     {
-        if (strncmp(*buf, "BCATS", len) == 0)
+        if (strncasecmp(*buf, "BCATS", len) == 0)
         {
             *dest = HO_BCATS;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, "HCATS", len) == 0)
+        if (strncasecmp(*buf, "HCATS", len) == 0)
         {
             *dest = HO_HCATS;
             *buf += len;
@@ -1022,7 +1101,7 @@ int ho_match_push(uint32_t *dest, char **buf)
     if (ret != 0 || len != 4)
         return ERR_NO_MATCH;
 
-    if (strncmp(*buf, "PUSH", len) == 0)
+    if (strncasecmp(*buf, "PUSH", len) == 0)
     {
         *dest = HO_PUSH;
         *buf += len;
@@ -1032,6 +1111,34 @@ int ho_match_push(uint32_t *dest, char **buf)
     return ERR_NO_MATCH;
 }
 
+// Match the load immediate pseudo-instruction, dest is set to 0 as it has no opcode
+int ho_match_li(uint32_t *dest, char **buf)
+{
+    static regex_t regex;
+    static int reret = INT_MAX;
+    if (reret == INT_MAX)
+    {
+        reret = ho_init_regex(0);
+        regex = horizon_regex.instruction_re;
+    }
+
+    regmatch_t match = { 0 };
+    int ret = regexec(&regex, *buf, 1, &match, 0);
+
+    int len = match.rm_eo - match.rm_so;
+    if (ret != 0 || len != 2)
+        return ERR_NO_MATCH;
+
+    if (strncasecmp(*buf, "LI", len) == 0)
+    {
+        *dest = 0;
+        *buf += len;
+        return NO_ERR;
+    }
+
+    return ERR_NO_MATCH;
+}
+
 // Match any jump instruction and set dest to the opcode
 int ho_match_cond(uint32_t *dest, char **buf)
 {
@@ -1050,67 +1157,67 @@ int ho_match_cond(uint32_t *dest, char **buf)
     if (ret != 0 || len != 3)
         return ERR_NO_MATCH;
 
-    if (strncmp(*buf, "JMP", len) == 0)
+    if (strncasecmp(*buf, "JMP", len) == 0)
     {
         *dest = HO_JMP;
         *buf += len;
         return NO_ERR;
     }
-    if (strncmp(*buf, "JEQ", len) == 0)
+    if (strncasecmp(*buf, "JEQ", len) == 0)
     {
         *dest = HO_JEQ;
         *buf += len;
         return NO_ERR;
     }
-    if (strncmp(*buf, "JNE", len) == 0)
+    if (strncasecmp(*buf, "JNE", len) == 0)
     {
         *dest = HO_JNE;
         *buf += len;
         return NO_ERR;
     }
-    if (strncmp(*buf, "JLT", len) == 0)
+    if (strncasecmp(*buf, "JLT", len) == 0)
     {
         *dest = HO_JLT;
         *buf += len;
         return NO_ERR;
     }
-    if (strncmp(*buf, "JGT", len) == 0)
+    if (strncasecmp(*buf, "JGT", len) == 0)
     {
         *dest = HO_JGT;
         *buf += len;
         return NO_ERR;
     }
-    if (strncmp(*buf, "JLE", len) == 0)
+    if (strncasecmp(*buf, "JLE", len) == 0)
     {
         *dest = HO_JLE;
         *buf += len;
         return NO_ERR;
     }
-    if (strncmp(*buf, "JGE", len) == 0)
+    if (strncasecmp(*buf, "JGE", len) == 0)
     {
         *dest = HO_JGE;
         *buf += len;
         return NO_ERR;
     }
-    if (strncmp(*buf, "JNG", len) == 0)
+    if (strncasecmp(*buf, "JNG", len) == 0)
     {
         *dest = HO_JNG;
         *buf += len;
         return NO_ERR;
     }
-    if (strncmp(*buf, "JPZ", len) == 0)
+    if (strncasecmp(*buf, "JPZ", len) == 0)
     {
         *dest = HO_JPZ;
         *buf += len;
         return NO_ERR;
     }
-    if (strncmp(*buf, "JVS", len) == 0)
+    if (strncasecmp(*buf, "JVS", len) == 0)
     {
         *dest = HO_JVS;
         *buf += len;
         return NO_ERR;
     }
-    if (strncmp(*buf, "JVC", len) == 0)
+    if (strncasecmp(*buf, "JVC", len) == 0)
     {
         *dest = HO_JVC;
         *buf += len;
@@ -1140,7 +1247,7 @@ int ho_match_store(uint32_t *dest, char **buf)
 
     if (len == 5)
     {
-        if (strncmp(*buf, "STORE", len) == 0)
+        if (strncasecmp(*buf, "STORE", len) == 0)
         {
             *dest = HO_STORE;
             *buf += len;
@@ -1148,13 +1255,13 @@ int ho_match_store(uint32_t *dest, char **buf)
         }
     } else if (len == 6)
     {
-        if (strncmp(*buf, "STOREI", len) == 0)
+        if (strncasecmp(*buf, "STOREI", len) == 0)
         {
             *dest = HO_STOREI;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, "STORED", len) == 0)
+        if (strncasecmp(*buf, "STORED", len) == 0)
         {
             *dest = HO_STORED;
             *buf += len;
@@ -1183,20 +1290,20 @@ int ho_match_load(uint32_t *dest, char **buf)
     if (ret != 0 || len < 4 || len > 5)
         return ERR_NO_MATCH;
 
-    if (len == 4 && strncmp(*buf, "LOAD", len) == 0)
+    if (len == 4 && strncasecmp(*buf, "LOAD", len) == 0)
     {
         *dest = HO_LOAD;
         *buf += len;
         return NO_ERR;
     } else if (len == 5)
     {
-        if (strncmp(*buf, "LOADI", len) == 0)
+        if (strncasecmp(*buf, "LOADI", len) == 0)
         {
             *dest = HO_LOADI;
             *buf += len;
             return NO_ERR;
         }
-        if (strncmp(*buf, "LOADD", len) == 0)
+        if (strncasecmp(*buf, "LOADD", len) == 0)
         {
             *dest = HO_LOADD;
             *buf += len;
@@ -1207,42 +1314,226 @@ int ho_match_load(uint32_t *dest, char **buf)
     return ERR_NO_MATCH;
 }
 
-// Parses a value and places it into dest
-// Expects the tokens:
-//  literal
-//  identifiers // which must be a constant
-int ho_parse_value(horizon_program_t *program, uint32_t *dest, char **buf)
+// Value of a subexpression, see ho_parse_expr
+typedef struct {
+    int64_t value;
+    int reloc_kind;         // kind of the address the value is offset from, HO_RELOC_NONE if none
+} ho_expr_value_t;
+
+// Binary operators by precedence, from the lowest, as in C
+#define HO_EXPR_LEVELS 6
+static const char *ho_expr_operators[HO_EXPR_LEVELS][3] = {
+    { "|" },
+    { "^" },
+    { "&" },
+    { "<<", ">>" },
+    { "+", "-" },
+    { "*", "/", "%" },
+};
+
+static int ho_parse_expr_level(horizon_program_t *program, int flags, int level, ho_expr_value_t *dest, char **buf);
+
+// Literal, symbol or parenthesized expression
+static int ho_parse_expr_primary(horizon_program_t *program, int flags, ho_expr_value_t *dest, char **buf)
 {
-    int res = 0;
+    int res;
     uint32_t val = 0;
+
+    dest->reloc_kind = HO_RELOC_NONE;
+    if (**buf == '(')
+    {
+        (*buf)++;
+        res = ho_parse_expr_level(program, flags, 0, dest, buf);
+        if (res != NO_ERR)
+            return res;
+        ho_match_whitespace(buf);
+        if (**buf != ')')
+            return ERR_EXPECTED_CLOSE_P;
+        (*buf)++;
+        return NO_ERR;
+    }
+
+    res = ho_match_literal(&val, buf);
+    if (res == NO_ERR)
+    {
+        dest->value = (int32_t) val;
+        return NO_ERR;
+    }
+    if (res != ERR_NO_MATCH)
+        return res;
+
+    res = ho_match_identifier(&val, buf);
+    if (res == ERR_IDENT_TOO_LONG)
+        return res;
+    if (res != NO_ERR)
+        return (flags & HO_EXPR_ADDRESS) ? ERR_NO_MATCH : ERR_EXPECTED_CONST_OR_LITERAL;
+
     char ident[HORIZON_IDENT_MAX_LEN + 1] = { 0 };
     symbol_t symbol = { 0 };
+    ho_copy_ident(ident, *buf, val);
+    int defined = ho_get_symbol(*program, &symbol, ident) && symbol.type != HO_SYM_MACRO;
 
-    // Try reading a literal first
-    res = ho_match_literal(&val, buf);
-    if (res == ERR_NO_MATCH)
-        goto ho_parse_value_try_ident;
+    if (defined && symbol.type == HO_SYM_CONST)
+        dest->value = (int32_t) symbol.value;
+    else if (!(flags & HO_EXPR_ADDRESS))
+        return ERR_EXPECTED_CONST_OR_LITERAL;
+    else if (defined)
+    {
+        dest->value = symbol.value;
+        dest->reloc_kind = (symbol.type == HO_SYM_VAR) ? HO_RELOC_DATA : HO_RELOC_CODE;
+    }
+    else if ((flags & HO_EXPR_FORWARD) || program->relocatable)
+    {
+        // Filled in by the linker, or a label further down in the first pass
+        dest->value = 0;
+        dest->reloc_kind = HO_RELOC_IMPORT;
+        strcpy(program->reloc_import, ident);
+    }
+    else
+        return ERR_NO_MATCH;
+
+    *buf += val;
+    return NO_ERR;
+}
+
+// Unary minus, plus and bitwise not
+static int ho_parse_expr_unary(horizon_program_t *program, int flags, ho_expr_value_t *dest, char **buf)
+{
+    ho_match_whitespace(buf);
+    char op = **buf;
+    if (op != '-' && op != '+' && op != '~')
+        return ho_parse_expr_primary(program, flags, dest, buf);
+
+    (*buf)++;
+    int res = ho_parse_expr_unary(program, flags, dest, buf);
     if (res != NO_ERR)
         return res;
+    if (op != '+' && dest->reloc_kind != HO_RELOC_NONE)
+        return ERR_ADDRESS_EXPR;
 
-    *dest = val;
+    if (op == '-')
+        dest->value = (int32_t) -dest->value;
+    else if (op == '~')
+        dest->value = (int32_t) ~dest->value;
     return NO_ERR;
+}
 
-ho_parse_value_try_ident:
-    // Try reading an identifier (has to be a const)
-    res = ho_match_identifier(&val, buf);
-    if (res == ERR_NO_MATCH)
-        return ERR_EXPECTED_CONST_OR_LITERAL;
+// Apply a binary operator to a and b, leaving the result in a
+static int ho_expr_apply(char op, ho_expr_value_t *a, ho_expr_value_t *b)
+{
+    // Addresses can still be moved by the linker and the optimizer, so only values at
+    // a constant distance from one address are known
+    if (a->reloc_kind != HO_RELOC_NONE || b->reloc_kind != HO_RELOC_NONE)
+    {
+        int offset = (op == '+' && (a->reloc_kind == HO_RELOC_NONE || b->reloc_kind == HO_RELOC_NONE)) ||
+            (op == '-' && b->reloc_kind == HO_RELOC_NONE);
+        if (!offset)
+            return ERR_ADDRESS_EXPR;
+        if (a->reloc_kind == HO_RELOC_NONE)
+            a->reloc_kind = b->reloc_kind;
+    }
+
+    int64_t x = a->value, y = b->value;
+    switch (op)
+    {
+        case '+': x += y; break;
+        case '-': x -= y; break;
+        case '*': x *= y; break;
+        case '/':
+        case '%':
+            if (y == 0)
+                return ERR_DIVISION_BY_ZERO;
+            x = (op == '/') ? x / y : x % y;
+            break;
+        case '<':
+        case '>':
+            if (y < 0 || y > 31)
+                return ERR_SHIFT_RANGE;
+            x = (op == '<') ? (int64_t) ((uint64_t) x << y) : x >> y;
+            break;
+        case '&': x &= y; break;
+        case '|': x |= y; break;
+        case '^': x ^= y; break;
+    }
+
+    // Values wrap around at 32 bits like in the CPU
+    a->value = (int32_t) (x & 0xFFFFFFFF);
+    return NO_ERR;
+}
+
+// Operands joined by the operators of a precedence level and the levels above it
+static int ho_parse_expr_level(horizon_program_t *program, int flags, int level, ho_expr_value_t *dest, char **buf)
+{
+    if (level == HO_EXPR_LEVELS)
+        return ho_parse_expr_unary(program, flags, dest, buf);
+
+    int res = ho_parse_expr_level(program, flags, level + 1, dest, buf);
+    while (res == NO_ERR)
+    {
+        ho_match_whitespace(buf);
+        const char *op = NULL;
+        for (int i = 0; i < 3 && ho_expr_operators[level][i] && !op; i++)
+        {
+            const char *candidate = ho_expr_operators[level][i];
+            if (strncmp(*buf, candidate, strlen(candidate)) == 0)
+                op = candidate;
+        }
+        if (!op)
+            break;
+
+        *buf += strlen(op);
+        ho_expr_value_t rhs = { 0 };
+        res = ho_parse_expr_level(program, flags, level + 1, &rhs, buf);
+        if (res == NO_ERR)
+            res = ho_expr_apply(op[0], dest, &rhs);
+    }
+    return res;
+}
+
+// Parses an expression of literals and constants with the operators + - * / % << >> &
+// | ^ ~ and parentheses and places its value into dest. Values are 32-bit integers
+// and wrap around, right shifts keep the sign.
+// With HO_EXPR_ADDRESS, variables and labels can also be used, offset by adding or
+// subtracting a constant, and program->reloc_kind is set for the relocation. With
+// HO_EXPR_FORWARD, undefined symbols are taken as addresses, for the first pass.
+int ho_parse_expr(horizon_program_t *program, int flags, int32_t *dest, char **buf)
+{
+    ho_expr_value_t value = { 0 };
+    int res = ho_parse_expr_level(program, flags, 0, &value, buf);
     if (res != NO_ERR)
         return res;
 
-    // check if const
-    strncpy(ident, *buf, val);
-    if (!ho_get_symbol(*program, &symbol, ident) || symbol.type != HO_SYM_CONST)
-        return ERR_EXPECTED_CONST_OR_LITERAL;
+    *dest = value.value;
+    if (flags & HO_EXPR_ADDRESS)
+        program->reloc_kind = value.reloc_kind;
+    return NO_ERR;
+}
+
+// Returns 1 if res is an error in an expression which should be reported as it is,
+// instead of as a mismatched instruction format
+static int ho_expr_error(int res)
+{
+    switch (res)
+    {
+    case ERR_OUT_OF_RANGE_8: case ERR_OUT_OF_RANGE_16: case ERR_OUT_OF_RANGE_32:
+    case ERR_EXPECTED_CLOSE_P: case ERR_DIVISION_BY_ZERO: case ERR_ADDRESS_EXPR: case ERR_SHIFT_RANGE:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+// Parses a value and places it into dest
+// Expects the tokens:
+//  expression  // of literals and constants, see ho_parse_expr
+int ho_parse_value(horizon_program_t *program, uint32_t *dest, char **buf)
+{
+    int32_t value = 0;
+    int res = ho_parse_expr(program, 0, &value, buf);
+    if (res != NO_ERR)
+        return res;
 
-    *dest = symbol.value;
-    *buf += val;    // advance buffer
+    *dest = value;
     return NO_ERR;
 }
 
@@ -1310,16 +1601,14 @@ int ho_parse_directive(horizon_program_t *program, int *lines_consumed, char **b
                 return res;
 
             // check if appropriate
-            strncpy(ident, *buf, len);
+            ho_copy_ident(ident, *buf, len);
             if (ho_symbol_exists(*program, ident))
                 return ERR_REDEFINED_IDENT;
 
-            // if so, define with the value of literal
+            // if so, define with the value of the expression
             *buf += len;
             ho_match_whitespace(buf);
-            res = ho_match_literal(&value, buf);
-            if (res == ERR_NO_MATCH)
-                return ERR_EXPECTED_LITERAL;
+            res = ho_parse_value(program, &value, buf);
             if (res != NO_ERR)
                 return res;
             ho_add_symbol(program, ident, value, HO_SYM_CONST);
@@ -1338,7 +1627,7 @@ int ho_parse_directive(horizon_program_t *program, int *lines_consumed, char **b
                 return res;
 
             // check if appropriate
-            strncpy(ident, *buf, len);
+            ho_copy_ident(ident, *buf, len);
             if (ho_symbol_exists(*program, ident))
                 return ERR_REDEFINED_IDENT;
 
@@ -1365,7 +1654,7 @@ int ho_parse_directive(horizon_program_t *program, int *lines_consumed, char **b
                 return res;
 
             // check if appropriate
-            strncpy(ident, *buf, len);
+            ho_copy_ident(ident, *buf, len);
             if (ho_symbol_exists(*program, ident))
                 return ERR_REDEFINED_IDENT;
 
@@ -1384,6 +1673,8 @@ int ho_parse_directive(horizon_program_t *program, int *lines_consumed, char **b
                 return res;
             if (array_len == 0)
                 return ERR_EXPECTED_NON_ZERO;
+            if (array_len > UINT16_MAX)
+                return ERR_OUT_OF_RANGE_16;
 
             ho_match_whitespace(buf);
             res = ho_match_string("]", buf);
@@ -1429,7 +1720,8 @@ int ho_parse_directive(horizon_program_t *program, int *lines_consumed, char **b
             free(array);
             break;
         case HO_START:
-            program->code_start = program->len_code_lines;
+            program->code_start = program->len_code_lines + program->len_extra_macro_code;
+            program->start_set = 1;
             break;
         case HO_NAME:
             ho_match_whitespace(buf);
@@ -1506,7 +1798,7 @@ int ho_parse_directive(horizon_program_t *program, int *lines_consumed, char **b
                 return res;
 
             // check if appropriate
-            strncpy(ident, *buf, len);
+            ho_copy_ident(ident, *buf, len);
             if (ho_symbol_exists(*program, ident))
                 return ERR_REDEFINED_IDENT;
 
@@ -1530,6 +1822,67 @@ int ho_parse_directive(horizon_program_t *program, int *lines_consumed, char **b
                 return res;
             *lines_consumed = program->macros[program->len_macros - 1].len;
             break;
+        case HO_GLOBAL:
+            // read identifier, it is looked up when writing an object file so it
+            // may be defined later
+            ho_match_whitespace(buf);
+            res = ho_match_identifier(&len, buf);
+            if (res == ERR_NO_MATCH)
+                return ERR_EXPECTED_IDENT;
+            if (res != NO_ERR)
+                return res;
+
+            if (program->len_globals >= program->len_globals_space)
+            {
+                program->len_globals_space += 100;
+                program->globals = realloc(program->globals, sizeof(char *) * program->len_globals_space);
+            }
+            program->globals[program->len_globals] = malloc(len + 1);
+            ho_copy_ident(program->globals[program->len_globals++], *buf, len);
+            *buf += len;
+            break;
+        case HO_UNROLL:
+            // the loop starts at the next instruction and is unrolled after encoding
+            ho_match_whitespace(buf);
+            res = ho_parse_value(program, &value, buf);
+            if (res != NO_ERR)
+                return res;
+            if (value < 2 || value > HORIZON_UNROLL_MAX)
+                return ERR_UNROLL_FACTOR;
+
+            if (program->len_unrolls >= program->len_unrolls_space)
+            {
+                program->len_unrolls_space += 100;
+                program->unrolls = realloc(program->unrolls, sizeof(horizon_unroll_t) * program->len_unrolls_space);
+            }
+            program->unrolls[program->len_unrolls].offset = program->len_code_lines + program->len_extra_macro_code;
+            program->unrolls[program->len_unrolls++].factor = value;
+            break;
+        case HO_INCLUDE:
+            // read the file name between double quotes
+            ho_match_whitespace(buf);
+            res = ho_match_string("\"", buf);
+            if (res != NO_ERR)
+                return ERR_EXPECTED_STRING;
+
+            len = 0;
+            while ((*buf)[len] != '"')
+            {
+                if ((*buf)[len] == '\n' || (*buf)[len] == '\0' || len >= PATH_MAX - 1)
+                    return ERR_EXPECTED_STRING;
+                len++;
+            }
+            if (len == 0)
+                return ERR_EXPECTED_STRING;
+
+            char path[PATH_MAX] = { 0 };
+            strncpy(path, *buf, len);
+            *buf += len + 1;
+
+            res = horizon_include(program, path);
+            if (res != NO_ERR)
+                return res;
+            break;
         default:
             return ERR_NOT_IMPLEMENTED;
             break;
@@ -1651,7 +2004,7 @@ int ho_parse_label(horizon_program_t *program, char **buf)
     if (res != NO_ERR)
         return res;
 
-    strncpy(ident, *buf, len);
+    ho_copy_ident(ident, *buf, len);
     *buf += len;
 
     // check if it is supposed to be a label
@@ -1673,6 +2026,35 @@ int ho_parse_label(horizon_program_t *program, char **buf)
     return NO_ERR;
 }
 
+// Parse an immediate argument, '#' followed by an expression or an expression
+// starting with a symbol or parenthesis, and set dest to its value in the given
+// number of bits. Addresses of variables and labels are marked for relocation in
+// program->reloc_kind, and in relocatable programs undefined symbols are imported
+// with a value of 0 to be filled in by the linker.
+static int ho_parse_imm(horizon_program_t *program, uint32_t *dest, int bits, char **buf)
+{
+    if (**buf == '#')
+        (*buf)++;
+    else if (**buf != '(' && **buf != '_' && !isalpha(**buf))
+        return ERR_NO_MATCH;
+
+    int32_t value = 0;
+    int res = ho_parse_expr(program, HO_EXPR_ADDRESS, &value, buf);
+    if (res != NO_ERR)
+        return res;
+
+    int64_t max = (bits == 8) ? UINT8_MAX : UINT16_MAX;
+    int64_t min = (bits == 8) ? INT8_MIN : INT16_MIN;
+    // Addresses are never negative
+    if (program->reloc_kind != HO_RELOC_NONE)
+        min = 0;
+    if (value < min || value > max)
+        return (bits == 8) ? ERR_OUT_OF_RANGE_8 : ERR_OUT_OF_RANGE_16;
+
+    *dest = value & max;
+    return NO_ERR;
+}
+
 // Match "reg reg" or "reg reg reg"
 int ho_parse_format_2(horizon_program_t *program, char **buf)
 {
@@ -1752,27 +2134,11 @@ int ho_parse_format_3(horizon_program_t *program, char **buf)
     }
 
     uint32_t imm8;
-    res = ho_match_imm8(&imm8, buf);
+    res = ho_parse_imm(program, &imm8, 8, buf);
     if (res != NO_ERR)
     {
-        char ident[HORIZON_IDENT_MAX_LEN + 1] = { 0 };
-        uint32_t len = 0;
-        res = ho_match_identifier(&len, buf);
-        if (res != NO_ERR)
-        {
-            *buf = start;
-            return ERR_EXPECTED_IMM8;
-        }
-        strncpy(ident, *buf, len);
-        symbol_t symbol = { 0 };
-        if (!(ho_get_symbol(*program, &symbol, ident) && (symbol.type == HO_SYM_VAR || symbol.type == HO_SYM_LABEL || symbol.type == HO_SYM_CONST) && symbol.value <= UINT8_MAX))
-        {
-            *buf = start;
-            return ERR_EXPECTED_IMM8;
-        }
-
-        imm8 = symbol.value;
-        *buf += len;
+        *buf = start;
+        return ho_expr_error(res) ? res : ERR_EXPECTED_IMM8;
     }
 
     // After this there should be no more arguments
@@ -1823,22 +2189,11 @@ int ho_parse_format_5(horizon_program_t *program, char **buf)
     program->imm_arg = 1;
     char *start = *buf;
     uint32_t imm16;
-    int res = ho_match_imm16(&imm16, buf);
+    int res = ho_parse_imm(program, &imm16, 16, buf);
     if (res != NO_ERR)
     {
-        char ident[HORIZON_IDENT_MAX_LEN + 1] = { 0 };
-        uint32_t len = 0;
-        res = ho_match_identifier(&len, buf);
-        strncpy(ident, *buf, len);
-        symbol_t symbol = { 0 };
-        if (!(ho_get_symbol(*program, &symbol, ident) && (symbol.type == HO_SYM_VAR || symbol.type == HO_SYM_LABEL || symbol.type == HO_SYM_CONST) && symbol.value <= UINT16_MAX))
-        {
-            *buf = start;
-            return ERR_EXPECTED_IMM16;
-        }
-
-        imm16 = symbol.value;
-        *buf += len;
+        *buf = start;
+        return ho_expr_error(res) ? res : ERR_EXPECTED_IMM16;
     }
 
     // After this there should be no more arguments
@@ -1916,6 +2271,216 @@ int ho_parse_push(horizon_program_t *program, char **buf)
     return ERR_NOT_IMPLEMENTED;
 }
 
+// ALU instruction with an imm8 argument
+static int64_t ho_li_alu(uint32_t opcode, uint32_t rd, uint32_t rm, uint32_t imm8)
+{
+    return (int64_t) (opcode | (1 << 7)) << 24 | rd << 16 | rm << 8 | (imm8 & 0xFF);
+}
+
+// Find the shortest sequence of at most max instructions which sets rd to value
+// without changing any other register, the stack or the flags. Every sequence ends
+// in an instruction which combines the value built by a shorter sequence with an
+// imm8, or is a single instruction or PUSH/POP pair.
+// Returns the length of the sequence written to seq, or 0 if there is none.
+static int ho_li_search(uint32_t value, uint32_t rd, int max, int64_t *seq)
+{
+    int32_t v = value;
+    if (max < 1)
+        return 0;
+
+    if (v >= INT8_MIN && v <= INT8_MAX)
+    {
+        seq[0] = ho_li_alu(HO_ADD, rd, HO_NIL, v);
+        return 1;
+    }
+    if (v == -INT8_MIN)
+    {
+        seq[0] = ho_li_alu(HO_SUB, rd, HO_NIL, INT8_MIN);
+        return 1;
+    }
+    if (max < 2)
+        return 0;
+
+    // POP SP would be overwritten by the stack pointer update
+    if (value <= UINT16_MAX && rd != HO_SP)
+    {
+        seq[0] = (int64_t) (HO_PUSH | (1 << 7)) << 24 | value;
+        seq[1] = (int64_t) HO_POP << 24 | rd << 16;
+        return 2;
+    }
+
+    // Candidates, the shorter value built first and the instruction combining it
+    uint32_t prefix[5];
+    int64_t last[5];
+    int len_candidates = 0;
+    if ((value & 0xFF) <= INT8_MAX)
+    {
+        prefix[len_candidates] = v >> 8;
+        last[len_candidates++] = ho_li_alu(HO_BCAT, rd, rd, value & 0xFF);
+    }
+    if ((value & 0xFFFF) <= INT8_MAX)
+    {
+        prefix[len_candidates] = v >> 16;
+        last[len_candidates++] = ho_li_alu(HO_HCAT, rd, rd, value & 0xFFFF);
+    }
+    if (value != 0 && (value & 1) == 0)
+    {
+        int shift = __builtin_ctz(value);
+        prefix[len_candidates] = v >> shift;
+        last[len_candidates++] = ho_li_alu(HO_LSH, rd, rd, shift);
+    }
+    if ((int8_t) (value & 0xFF) != 0)
+    {
+        prefix[len_candidates] = value - (int8_t) (value & 0xFF);
+        last[len_candidates++] = ho_li_alu(HO_ADD, rd, rd, value & 0xFF);
+    }
+    prefix[len_candidates] = ~value;
+    last[len_candidates++] = (int64_t) HO_NOT << 24 | rd << 16 | rd << 8;
+
+    int best = 0;
+    int64_t tmp[HORIZON_LI_MAX_WORDS];
+    for (int i = 0; i < len_candidates; i++)
+    {
+        int len = ho_li_search(prefix[i], rd, ((best) ? best : max + 1) - 2, tmp);
+        if (len)
+        {
+            memcpy(seq, tmp, sizeof(int64_t) * len);
+            seq[len] = last[i];
+            best = len + 1;
+        }
+    }
+
+    return best;
+}
+
+// Number of instructions LI takes for a value, the same in both passes as long as
+// the value and its kind are known in the first
+// Addresses are loaded with a single instruction with the address in its immediate
+// argument, so they can be relocated
+static int ho_li_words(horizon_program_t *program, uint32_t rd, uint32_t value, int reloc_kind)
+{
+    if (reloc_kind != HO_RELOC_NONE)
+        return (!program->relocatable && value <= INT8_MAX) ? 1 : 2;
+
+    int64_t seq[HORIZON_LI_MAX_WORDS];
+    int len = ho_li_search(value, rd, HORIZON_LI_MAX_WORDS, seq);
+    return (len) ? len : 1;
+}
+
+// Match "reg #expression" or "reg expression" after LI, see ho_parse_expr for flags
+static int ho_parse_li_args(horizon_program_t *program, int flags, uint32_t *rd, uint32_t *value, char **buf)
+{
+    int res = ho_match_register(rd, buf);
+    if (res != NO_ERR || *rd == HO_PC)
+        return ERR_EXPECTED_LI;
+    ho_match_whitespace(buf);
+
+    if (**buf == '#')
+        (*buf)++;
+    int32_t expr = 0;
+    res = ho_parse_expr(program, HO_EXPR_ADDRESS | flags, &expr, buf);
+    if (res != NO_ERR)
+        return ho_expr_error(res) ? res : ERR_EXPECTED_LI;
+    *value = expr;
+    return NO_ERR;
+}
+
+// Number of instructions a LI line is lowered to, for the first pass
+// Labels defined further down are not known yet, and get room for an imm16 address.
+int ho_count_li(horizon_program_t *program, char **buf)
+{
+    char *start = *buf;
+    uint32_t rd = 0, value = 0;
+
+    ho_match_whitespace(buf);
+    program->reloc_kind = HO_RELOC_NONE;
+    int res = ho_parse_li_args(program, HO_EXPR_FORWARD, &rd, &value, buf);
+    *buf = start;
+    if (res != NO_ERR)
+        return 1;
+    if (program->reloc_kind == HO_RELOC_IMPORT)
+        return 2;
+    return ho_li_words(program, rd, value, program->reloc_kind);
+}
+
+// Lower "LI reg value" to the shortest sequence of instructions loading the value,
+// with as many instructions as the first pass counted for the line
+int ho_parse_li(horizon_program_t *program, char **buf)
+{
+    uint32_t rd = 0, value = 0;
+    int res = ho_parse_li_args(program, 0, &rd, &value, buf);
+    if (res != NO_ERR)
+        return res;
+
+    int line = program->curr_code_line;
+    int end = (line + 1 < program->len_code_lines) ? program->code_line_offsets[line + 1] : program->len_code_lines + program->len_extra_macro_code;
+    int words = end - program->code_line_offsets[line];
+
+    if (program->reloc_kind != HO_RELOC_NONE)
+    {
+        if (words == 1 && value <= INT8_MAX)
+        {
+            ho_add_code(program, ho_li_alu(HO_ADD, rd, HO_NIL, value));
+            ho_add_reloc(program, HO_RELOC_IMM8);
+            return NO_ERR;
+        }
+        if (words != 2 || value > UINT16_MAX || rd == HO_SP)
+            return ERR_EXPECTED_LI;
+        ho_add_code(program, (int64_t) (HO_PUSH | (1 << 7)) << 24 | value);
+        ho_add_reloc(program, HO_RELOC_IMM16);
+        ho_add_code(program, (int64_t) HO_POP << 24 | rd << 16);
+        return NO_ERR;
+    }
+
+    int64_t seq[HORIZON_LI_MAX_WORDS];
+    int len = ho_li_search(value, rd, HORIZON_LI_MAX_WORDS, seq);
+    if (len != words)
+    {
+        // A constant defined further down was taken for a label in the first pass
+        if (words != 2 || value > UINT16_MAX || rd == HO_SP)
+            return ERR_LI_FORWARD_CONST;
+        len = 2;
+        seq[0] = (int64_t) (HO_PUSH | (1 << 7)) << 24 | value;
+        seq[1] = (int64_t) HO_POP << 24 | rd << 16;
+    }
+    for (int i = 0; i < len; i++)
+        ho_add_code(program, seq[i]);
+    return NO_ERR;
+}
+
+// Copy a macro argument of at most HORIZON_IDENT_MAX_LEN characters into dest
+// Arguments are separated by whitespace, except around the operators of an expression
+// and inside parentheses, e.g. "list + (len - 1)" is a single argument.
+static void ho_copy_macro_arg(char *dest, char **buf)
+{
+    const char *operators = "+-*/%<>&|^~(";
+    int depth = 0, len = 0;
+
+    dest[0] = 0;
+    while (len < HORIZON_IDENT_MAX_LEN && **buf != '\n' && **buf != '\0')
+    {
+        if (**buf == ' ' || **buf == '\t')
+        {
+            char *next = *buf;
+            ho_match_whitespace(&next);
+            // A virtual register is not a remainder
+            int vreg = *next == '%' && toupper(next[1]) == 'V' && isdigit(next[2]);
+            int joined = depth > 0 || (len > 0 && strchr(operators, dest[len - 1])) ||
+                (*next && *next != '~' && *next != '(' && !vreg && strchr(operators, *next));
+            if (!joined || *next == '\n' || *next == '\0')
+                break;
+            *buf = next;
+            dest[len++] = ' ';
+            dest[len] = 0;
+            continue;
+        }
+        depth += (**buf == '(') - (**buf == ')');
+        dest[len++] = **buf;
+        dest[len] = 0;
+        (*buf)++;
+    }
+}
+
 // Returns NO_ERR if the next token is a valid instruction
 int ho_valid_instruction(horizon_program_t *program, char **buf)
 {
@@ -2004,18 +2569,30 @@ int ho_count_instruction(horizon_program_t *program, char **buf)
         return NO_ERR;
     }
 
+    res = ho_match_li(&opcode, buf);
+    if (res == NO_ERR)
+    {
+        ho_add_code_line(program, bufpos);
+        program->len_extra_macro_code += ho_count_li(program, buf) - 1;
+        return NO_ERR;
+    }
+
+    // The whole identifier must match, otherwise e.g. MOV16 would be counted as MOV
+    uint32_t len_token = 0;
+    if (ho_match_identifier(&len_token, buf) != NO_ERR)
+        return ERR_NO_MATCH;
     for (int i = 0; i < program->len_macros; i++)
     {
-        res = ho_match_string(program->macros[i].name, buf);
-        if (res == NO_ERR)
+        if (strlen(program->macros[i].name) == len_token && strncasecmp(program->macros[i].name, *buf, len_token) == 0)
         {
+            *buf += len_token;
             ho_add_code_line(program, bufpos);
             program->len_extra_macro_code += program->macros[i].len - 1;
             return NO_ERR;
         }
     }
 
-    return res;
+    return ERR_NO_MATCH;
 }
 
 // Parse instructions into machine code
@@ -2026,6 +2603,8 @@ int ho_parse_instruction(horizon_program_t *program, char *buf)
     int res;
     uint32_t opcode;
 
+    program->reloc_kind = HO_RELOC_NONE;
+
     // Format 1
     // For the simple instructions no complex parsing is necessary
     res = ho_match_noop(&opcode, &buf);
@@ -2051,12 +2630,14 @@ int ho_parse_instruction(horizon_program_t *program, char *buf)
             res = ho_parse_format_3(program, &buf);
             if (res != NO_ERR)
             {
-                return ERR_EXPECTED_FORMAT_2_3;
+                return ho_expr_error(res) ? res : ERR_EXPECTED_FORMAT_2_3;
             }
         }
 
         int64_t instr = (opcode | (program->imm_arg << 7)) << 24 | program->args[0] << 16 | program->args[1] << 8 | program->args[2];
         ho_add_code(program, instr);
+        if (program->reloc_kind != HO_RELOC_NONE)
+            ho_add_reloc(program, HO_RELOC_IMM8);
         res = ho_match_newline(&buf);
         if (res != NO_ERR && res != ERR_EOF)
             return ERR_EXPECTED_FORMAT_2_3;
@@ -2094,7 +2675,7 @@ int ho_parse_instruction(horizon_program_t *program, char *buf)
         {
             res = ho_parse_format_5(program, &buf);
             if (res != NO_ERR)
-                return ERR_EXPECTED_FORMAT_4_5;
+                return ho_expr_error(res) ? res : ERR_EXPECTED_FORMAT_4_5;
         }
 
         // When the argument is an imm16, it takes up the 2 MSBs, otherwise
@@ -2105,6 +2686,8 @@ int ho_parse_instruction(horizon_program_t *program, char *buf)
         else
             instr = (opcode | (1 << 7)) << 24 | program->args[0];
         ho_add_code(program, instr);
+        if (program->reloc_kind != HO_RELOC_NONE)
+            ho_add_reloc(program, HO_RELOC_IMM16);
 
         res = ho_match_newline(&buf);
         if (res != NO_ERR && res != ERR_EOF)
@@ -2144,6 +2727,22 @@ int ho_parse_instruction(horizon_program_t *program, char *buf)
     if (res == NO_ERR)
         goto ho_parse_instruction_4;
 
+    // Load immediate
+    // Pseudo-instruction lowered to one or more instructions
+    res = ho_match_li(&opcode, &buf);
+    if (res == NO_ERR)
+    {
+        ho_match_whitespace(&buf);
+        res = ho_parse_li(program, &buf);
+        if (res != NO_ERR)
+            return res;
+
+        res = ho_match_newline(&buf);
+        if (res != NO_ERR && res != ERR_EOF)
+            return ERR_EXPECTED_LI;
+        return res;
+    }
+
     // Macro
     // Replace args in definition and recurse into this function.
     // As the instructions in a macro cannot be macros themselves, that is the virtual
@@ -2155,7 +2754,7 @@ int ho_parse_instruction(horizon_program_t *program, char *buf)
     if (res != NO_ERR)
         goto ho_parse_instruction_unknown;
 
-    strncpy(token, buf, len_token);
+    ho_copy_ident(token, buf, len_token);
     buf += len_token;
     if (ho_get_macro(*program, &macro, token))
     {
@@ -2168,12 +2767,7 @@ int ho_parse_instruction(horizon_program_t *program, char *buf)
         for (int i = 0; i < macro.argc; i++)
         {
             argv[i] = malloc(HORIZON_IDENT_MAX_LEN + 1);
-            for (int j = 0; j <= HORIZON_IDENT_MAX_LEN && *buf != ' ' && *buf != '\t' && *buf != '\n' && *buf != '\0'; j++)
-            {
-                argv[i][j] = *buf;
-                argv[i][j + 1] = 0; // null terminating byte in case the arg ends
-                buf++;
-            }
+            ho_copy_macro_arg(argv[i], &buf);
             if (strlen(argv[i]) == 0)
                 return ERR_TOO_FEW_ARGUMENTS;
             ho_match_whitespace(&buf);
@@ -2248,12 +2842,15 @@ int ho_parse_statement(horizon_program_t *program, int *lines_consumed, char **b
 
 
 // Print an error message for a parser error
-void ho_parser_perror(char *msg, int error, int line)
+void ho_parser_perror(char *msg, int error, const char *file, int line)
 {
     if (error == NO_ERR)
         return;
 
-    printf("Error on line %d: ", line);
+    if (file)
+        printf("Error on line %d of %s: ", line, file);
+    else
+        printf("Error on line %d: ", line);
 
     switch (error)
     {
@@ -2368,6 +2965,42 @@ void ho_parser_perror(char *msg, int error, int line)
         case ERR_EXPECTED_INSTRUCTION:
             printf("expected an instruction (no directives or macros)");
             break;
+        case ERR_EXPECTED_STRING:
+            printf("expected a string in double quotes");
+            break;
+        case ERR_INCLUDE_NOT_FOUND:
+            printf("included file not found");
+            break;
+        case ERR_INCLUDE_CYCLE:
+            printf("file includes itself");
+            break;
+        case ERR_EXPECTED_LI:
+            printf("instruction takes Rd (not PC) and a literal or symbol argument");
+            break;
+        case ERR_LI_FORWARD_CONST:
+            printf("constant must be defined before its use in LI");
+            break;
+        case ERR_UNROLL_FACTOR:
+            printf("expected a number of copies from 2 to %d", HORIZON_UNROLL_MAX);
+            break;
+        case ERR_DIVISION_BY_ZERO:
+            printf("division by zero");
+            break;
+        case ERR_ADDRESS_EXPR:
+            printf("addresses can only be offset by adding or subtracting a constant");
+            break;
+        case ERR_SHIFT_RANGE:
+            printf("shift count must be from 0 to 31");
+            break;
+        case ERR_VREG_ADDRESSES:
+            printf("virtual registers can't be used in programs using code addresses other than labels");
+            break;
+        case ERR_VREG_CALL:
+            printf("virtual register is needed after a call which changes it, e.g. a recursive one, save it with PUSH and POP");
+            break;
+        case ERR_VREG_SPILL:
+            printf("too many values in registers at once, a virtual register can't be kept in memory here");
+            break;
         default:
             printf("%d", error);
     }
@@ -45,9 +45,32 @@
 #define ERR_EXPECTED_IMM16              133
 #define ERR_EXPECTED_INSTRUCTION        134
 #define ERR_TOO_FEW_ARGUMENTS           135
+#define ERR_EXPECTED_STRING             136
+#define ERR_INCLUDE_NOT_FOUND           137
+#define ERR_INCLUDE_CYCLE               138
+#define ERR_EXPECTED_LI                 139
+#define ERR_LI_FORWARD_CONST            140
+#define ERR_UNROLL_FACTOR               141
+#define ERR_DIVISION_BY_ZERO            142
+#define ERR_ADDRESS_EXPR                143
+#define ERR_SHIFT_RANGE                 144
+#define ERR_VREG_ADDRESSES              145
+#define ERR_VREG_CALL                   146
+#define ERR_VREG_SPILL                  147
 
 #define HORIZON_IDENT_MAX_LEN 255
 
+// Longest sequence the LI pseudo-instruction is lowered to, any 32-bit value fits
+#define HORIZON_LI_MAX_WORDS 8
+
+// Largest number of copies of a loop body made with the .unroll directive
+#define HORIZON_UNROLL_MAX 16
+
+// Virtual registers %v0 to %v238 are numbered from 16 in register fields, after the
+// physical ones and before NIL, until horizon_allocate_registers replaces them
+#define HORIZON_VREG_BASE 16
+#define HORIZON_VREGS 239
+
 typedef struct {
     char name[HORIZON_IDENT_MAX_LEN + 1];
     int argc;
@@ -55,6 +78,31 @@ typedef struct {
     char **lines;
 } horizon_macro_t;
 
+// A source file taking part in a compilation, the main file or one added with .include
+typedef struct {
+    char *path;             // malloced, resolved path, NULL if the main file was read from a stream
+    char *buf;              // source text, see horizon_read_source. For the main file this is
+                            //  the program's input_buf, which owns it
+    int len;
+    int mapped;
+    int parsing;            // set while its statements are being parsed, to detect cycles
+} horizon_module_t;
+
+// Address field of an instruction which depends on where the program is placed,
+// recorded so object files can be linked and code can be moved around
+typedef struct {
+    int offset;             // index of the instruction in code
+    int field;              // HO_RELOC_IMM8 or HO_RELOC_IMM16
+    int kind;               // what the address points into, enum horizon_reloc_kind
+    char *import;           // malloced, name of the symbol for HO_RELOC_IMPORT, NULL otherwise
+} horizon_reloc_t;
+
+// Loop marked with the .unroll directive
+typedef struct {
+    int offset;             // first instruction, relative to the start of the program section
+    int factor;             // number of copies of the body
+} horizon_unroll_t;
+
 typedef struct {
     int arch;
 
@@ -70,13 +118,18 @@ typedef struct {
     uint32_t *data;         // malloced
 
     // Program text
-    char *input_buf;        // malloced
+    char *input_buf;        // malloced, or mmapped if input_mapped is set
     int len_input;
+    int input_mapped;       // input_buf must be released with munmap, see horizon_free_source
 
     // Instructions
     int curr_line;          // to store which line in the text corresponds to which 
                             // instruction
+    int curr_code_line;     // index of the code line being encoded in the second pass
     int *code_line_indices; // malloced, same size as code_lines
+    int *code_line_offsets; // malloced, same size as code_lines, index of the first code
+                            //  word of each line relative to the start of the program section
+    int *code_line_modules; // malloced, same size as code_lines, module each line is from
     int code_offset;        // for labels
     int code_start;         // for the initial jmp start instruction
     int len_code_lines;
@@ -88,6 +141,8 @@ typedef struct {
     // Machine code
     uint32_t args[3];       // arguments parsed are placed here temporarily
     int imm_arg;            // zero if no immediate arguments, 1 if there is
+    int reloc_kind;         // kind of address in the immediate argument, HO_RELOC_NONE if it is not one
+    char reloc_import[HORIZON_IDENT_MAX_LEN + 1];   // imported symbol for HO_RELOC_IMPORT
     int len_code;
     int len_code_space;
     int64_t *code;          // malloced
@@ -98,6 +153,29 @@ typedef struct {
     int len_extra_macro_code ;  // number of additional (over 1) code lines introduced by
                                 // macros, for processing labels in first pass
 
+    // Relocations, recorded for every address field in code
+    int len_relocs;
+    int len_relocs_space;
+    horizon_reloc_t *relocs;    // malloced
+
+    // Separate compilation
+    int relocatable;        // undefined symbols in address fields are imported instead of errors
+    int start_set;          // 1 if the .start directive was used
+    int len_globals;
+    int len_globals_space;
+    char **globals;         // malloced, names of the symbols exported with .global
+
+    // Loops to unroll after encoding, see horizon_unroll_loops
+    int len_unrolls;
+    int len_unrolls_space;
+    horizon_unroll_t *unrolls;  // malloced
+
+    // Source files, every file is parsed only once no matter how often it is included
+    int curr_module;        // index of the module being parsed, 0 is the main file
+    int len_modules;
+    int len_modules_space;
+    horizon_module_t *modules;  // malloced
+
     // Number of errors encountered
     int error_count;
 
@@ -177,9 +255,24 @@ enum horizon_directive {
     HO_NAME,
     HO_DESC,
     HO_MACRO,
+    HO_INCLUDE,
+    HO_GLOBAL,
+    HO_UNROLL,
     HO_DIR_NONE = -1,
 };
 
+enum horizon_reloc_kind {
+    HO_RELOC_NONE,
+    HO_RELOC_CODE,          // label, relative to the start of the program section
+    HO_RELOC_DATA,          // variable, relative to the start of the data section
+    HO_RELOC_IMPORT,        // symbol defined in another object file
+};
+
+enum horizon_reloc_field {
+    HO_RELOC_IMM8,          // bits 0-7
+    HO_RELOC_IMM16,         // bits 0-15
+};
+
 enum horizon_symbol_type {
     HO_SYM_CONST,
     HO_SYM_VAR,
@@ -216,10 +309,16 @@ int ho_match_push(uint32_t *dest, char **buf);
 int ho_match_cond(uint32_t *dest, char **buf);
 int ho_match_store(uint32_t *dest, char **buf);
 int ho_match_load(uint32_t *dest, char **buf);
+int ho_match_li(uint32_t *dest, char **buf);
 
 // Parse means this is a rule in the grammar
 // Return values are errors
 
+// Flags of ho_parse_expr
+#define HO_EXPR_ADDRESS     1   // variables and labels can be used, see program->reloc_kind
+#define HO_EXPR_FORWARD     2   // undefined symbols are taken as addresses, for the first pass
+
+int ho_parse_expr(horizon_program_t *program, int flags, int32_t *dest, char **buf);
 int ho_parse_value(horizon_program_t *program, uint32_t *dest, char **buf);
 int ho_parse_value_list(horizon_program_t *program, uint32_t **dest_list, int len, char **buf);
 int ho_parse_directive(horizon_program_t *program, int *lines_consumed, char **buf);
@@ -234,6 +333,8 @@ int ho_parse_alu(horizon_program_t *program, char **buf);
 int ho_parse_ram(horizon_program_t *program, char **buf);
 int ho_parse_cond(horizon_program_t *program, char **buf);
 int ho_parse_push(horizon_program_t *program, char **buf);
+int ho_parse_li(horizon_program_t *program, char **buf);
+int ho_count_li(horizon_program_t *program, char **buf);
 int ho_valid_instruction(horizon_program_t *program, char **buf);
 int ho_count_instruction(horizon_program_t *program, char **buf);
 int ho_parse_instruction(horizon_program_t *program, char *buf);
@@ -242,9 +343,11 @@ int ho_parse_statement(horizon_program_t *program, int *lines_consumed, char **b
 // Helper functions
 
 int ho_add_builtin_macros(horizon_program_t *program);
+void ho_copy_ident(char *dest, const char *src, int len);
 int ho_symbol_exists(horizon_program_t program, const char *token);
+int ho_get_symbol(horizon_program_t program, symbol_t *dest, const char *token);
 int ho_add_symbol(horizon_program_t *program, const char *ident, uint32_t value, int type);
-void ho_parser_perror(char *msg, int error, int line);
+void ho_parser_perror(char *msg, int error, const char *file, int line);
 int ho_is_reserved(const char *word);
 int ho_is_reserved_ident(const char *ident);
 
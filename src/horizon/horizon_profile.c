@@ -0,0 +1,74 @@
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "horizon_profile.h"
+
+// Write the counts of every address below len which ran at least once
+// Returns 0 on success, -1 if writing failed
+int horizon_profile_write(FILE *fd, const uint32_t *taken, const uint32_t *not_taken, int len)
+{
+    fprintf(fd, "%s\n", HORIZON_PROFILE_HEADER);
+    for (int i = 0; i < len; i++)
+    {
+        if (taken[i] || not_taken[i])
+            fprintf(fd, "%d %" PRIu32 " %" PRIu32 "\n", i, taken[i], not_taken[i]);
+    }
+
+    return ferror(fd) ? -1 : 0;
+}
+
+// Read a profile written by horizon_profile_write
+// Returns a newly allocated profile to be freed with horizon_profile_free, or NULL if
+// the file is not a valid profile
+horizon_profile_t *horizon_profile_read(FILE *fd)
+{
+    char line[BUFSIZ];
+    if (!fgets(line, sizeof(line), fd) || strncmp(line, HORIZON_PROFILE_HEADER, strlen(HORIZON_PROFILE_HEADER)) != 0)
+        return NULL;
+
+    horizon_profile_t *profile = calloc(1, sizeof(horizon_profile_t));
+    int len_space = 0;
+
+    while (fgets(line, sizeof(line), fd))
+    {
+        unsigned int address;
+        uint32_t taken, not_taken;
+        char extra;
+        if (line[0] == '\n')
+            continue;
+        // Every address in a program fits in 16 bits
+        if (sscanf(line, "%u %" SCNu32 " %" SCNu32 " %c", &address, &taken, &not_taken, &extra) != 3 || address > UINT16_MAX)
+        {
+            horizon_profile_free(profile);
+            return NULL;
+        }
+
+        if (address >= len_space)
+        {
+            int old_space = len_space;
+            len_space = address + 100;
+            profile->taken = realloc(profile->taken, sizeof(uint32_t) * len_space);
+            profile->not_taken = realloc(profile->not_taken, sizeof(uint32_t) * len_space);
+            memset(profile->taken + old_space, 0, sizeof(uint32_t) * (len_space - old_space));
+            memset(profile->not_taken + old_space, 0, sizeof(uint32_t) * (len_space - old_space));
+        }
+        profile->taken[address] = taken;
+        profile->not_taken[address] = not_taken;
+        if (address >= profile->len)
+            profile->len = address + 1;
+    }
+
+    return profile;
+}
+
+// Frees memory allocated by horizon_profile_read
+void horizon_profile_free(horizon_profile_t *profile)
+{
+    if (!profile)
+        return;
+
+    free(profile->taken);
+    free(profile->not_taken);
+    free(profile);
+}
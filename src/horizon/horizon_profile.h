@@ -0,0 +1,31 @@
+#ifndef HORIZON_PROFILE_H
+#define HORIZON_PROFILE_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define HORIZON_PROFILE_HEADER      "# horizon branch profile: address taken not-taken"
+
+// How often each jump of a program was taken, recorded by fcemu -p and used by fcc
+// --profile-use to lay out the program and choose the calls to inline
+// The file is a text file with the header line, then one line per jump which ran,
+// with its address and counts as decimal numbers.
+typedef struct {
+    int len;                // highest address with counts + 1
+    uint32_t *taken;        // malloced, indexed by address
+    uint32_t *not_taken;    // malloced, indexed by address
+} horizon_profile_t;
+
+// Write the counts of every address below len which ran at least once
+// Returns 0 on success, -1 if writing failed
+int horizon_profile_write(FILE *fd, const uint32_t *taken, const uint32_t *not_taken, int len);
+
+// Read a profile written by horizon_profile_write
+// Returns a newly allocated profile to be freed with horizon_profile_free, or NULL if
+// the file is not a valid profile
+horizon_profile_t *horizon_profile_read(FILE *fd);
+
+// Frees memory allocated by horizon_profile_read
+void horizon_profile_free(horizon_profile_t *profile);
+
+#endif // HORIZON_PROFILE_H
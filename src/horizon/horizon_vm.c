@@ -182,6 +182,7 @@ void hovm_execute_cond(horizon_vm_t *vm, uint32_t ir)
 
     uint16_t A = (imm_arg) ? imm16 : hovm_read_reg(vm, rn);
 
+    uint32_t pc = vm->registers[HO_PC];
     vm->registers[HO_PC]++;
 
     switch ((ir >> 24) & 0x7F)
@@ -199,7 +200,7 @@ void hovm_execute_cond(horizon_vm_t *vm, uint32_t ir)
             if (!vm->z && vm->n == vm->v) vm->registers[HO_PC] = A;
             break;
         case HO_JLE:
-            if (vm->z && vm->n != vm->v) vm->registers[HO_PC] = A;
+            if (vm->z || vm->n != vm->v) vm->registers[HO_PC] = A;
             break;
         case HO_JGE:
             if (vm->n == vm->v) vm->registers[HO_PC] = A;
@@ -220,6 +221,15 @@ void hovm_execute_cond(horizon_vm_t *vm, uint32_t ir)
             vm->registers[HO_PC] = A;
             break;
     }
+
+    // Count jumps for branch profiles, JMP is always taken
+    if (pc < HOVM_ROM_SIZE)
+    {
+        if (vm->registers[HO_PC] == pc + 1 && ((ir >> 24) & 0x7F) != HO_JMP)
+            vm->branch_not_taken[pc]++;
+        else
+            vm->branch_taken[pc]++;
+    }
 }
 
 void hovm_execute_mem(horizon_vm_t *vm, uint32_t ir)
@@ -229,7 +239,8 @@ void hovm_execute_mem(horizon_vm_t *vm, uint32_t ir)
     int rd = (ir >> 16) & 0xFF;
     uint16_t imm16 = ir & 0xFFFF;
 
-    uint16_t A = (imm_arg) ? imm16 : hovm_read_reg(vm, rn);
+    // Registers are stored whole, immediates zero extended
+    uint32_t A = (imm_arg) ? imm16 : hovm_read_reg(vm, rn);
 
     uint32_t op = (ir >> 24);
     uint32_t ar = hovm_read_reg(vm, HO_AR);
@@ -265,7 +276,8 @@ void hovm_execute_stack(horizon_vm_t *vm, uint32_t ir)
     int rd = (ir >> 16) & 0xFF;
     uint16_t imm16 = ir & 0xFFFF;
 
-    uint16_t A = (imm_arg) ? imm16 : hovm_read_reg(vm, rn);
+    // Registers are pushed whole, immediates zero extended
+    uint32_t A = (imm_arg) ? imm16 : hovm_read_reg(vm, rn);
 
     uint32_t op = (ir >> 24);
     uint32_t sp = hovm_read_reg(vm, HO_SP);
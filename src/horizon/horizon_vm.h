@@ -23,6 +23,9 @@ typedef struct {
     // 1 if the corresponding code should break execution
     // 0 if not
     uint8_t breakpoint_map[HOVM_ROM_SIZE];
+    // Times the jump at each address was taken and not taken, for branch profiles
+    uint32_t branch_taken[HOVM_ROM_SIZE];
+    uint32_t branch_not_taken[HOVM_ROM_SIZE];
     // Set on ROM load, for dissassembly
     uint32_t program_size;
 } horizon_vm_t;
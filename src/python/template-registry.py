@@ -0,0 +1,106 @@
+import json
+import os
+import re
+import sys
+
+# Usage: python template-registry.py <rom_templates.c> <template.json>...
+# Output: the registry of ROM templates compiled into fcc, fclink, fcbp and fcemu. Every
+# template is the decoded JSON of a ROM blueprint, whose constant combinators hold the
+# placeholder PLACEHOLDER_BASE + i for the ith word, and is named after its file. The
+# blueprint's label and description are the placeholders for the program's name and
+# description, and the constants of its decider combinators select the rows of words
+# answering an address. Run by make whenever a template changes.
+
+PLACEHOLDER_BASE = 0xFF000000
+
+argv = sys.argv
+out_filename = argv[1]
+templates = []
+for filename in argv[2:]:
+    with open(filename, "rb") as fd:
+        raw = fd.read()
+    text = raw.decode('utf-8')
+    bp = json.loads(text)['blueprint']
+
+    # The texts are found as they are written in the JSON, escapes included
+    name = re.search(r'"label":"((?:[^"\\]|\\.)*)"', text).group(1)
+    desc = re.search(r'"description":"((?:[^"\\]|\\.)*)"', text).group(1)
+    combinators = sum(e['name'].endswith('-combinator') for e in bp['entities'])
+
+    # The description comes first, as it starts with the name. Counts of filters are words
+    # if they are placeholders
+    spans = []
+    taken = []
+    for placeholder, index in ((desc, 'ROM_SPAN_DESC'), (name, 'ROM_SPAN_NAME')):
+        for m in re.finditer(re.escape(placeholder), text):
+            if not any(s <= m.start() < e for s, e in taken):
+                spans.append((len(text[:m.start()].encode('utf-8')), len(placeholder.encode('utf-8')), index))
+                taken.append((m.start(), m.end()))
+    capacity = 0
+    for m in re.finditer(r'"count":(-?\d+)', text):
+        word = (int(m.group(1)) - PLACEHOLDER_BASE) & 0xFFFFFFFF
+        if word < 0x01000000 and not any(s <= m.start() < e for s, e in taken):
+            spans.append((len(text[:m.start(1)].encode('utf-8')), len(m.group(1)), str(word)))
+            capacity = max(capacity, word + 1)
+    for m in re.finditer(r'"constant":(-?\d+)', text):
+        spans.append((len(text[:m.start(1)].encode('utf-8')), len(m.group(1)), 'ROM_SPAN_ROW'))
+    spans.sort()
+
+    rom = os.path.splitext(os.path.basename(filename))[0]
+    templates.append((rom, capacity, combinators, name, desc, raw, spans))
+
+def c_string(data, width=120):
+    # Split into lines of escaped bytes, octal escapes are always written with 3 digits so
+    # the digits after them are not read as part of them
+    lines = []
+    line = ''
+    for b in data:
+        c = chr(b)
+        if c in '"\\':
+            line += '\\' + c
+        elif 0x20 <= b < 0x7F and c != '?':
+            line += c
+        else:
+            line += '\\%03o' % b
+        if len(line) >= width:
+            lines.append('"' + line + '"')
+            line = ''
+    if line or not lines:
+        lines.append('"' + line + '"')
+    return '\n    '.join(lines)
+
+out = ['// Generated by src/python/template-registry.py from src/templates, don\'t edit',
+       '#include "rom_templates.h"', '']
+
+# Largest first, see rom_templates
+templates.sort(key=lambda t: -t[1])
+for rom, capacity, combinators, name, desc, raw, spans in templates:
+    out.append('static const char ' + rom + '_json[] =')
+    out.append('    ' + c_string(raw) + ';')
+    out.append('')
+    out.append('static const rom_span_t ' + rom + '_spans[] = {')
+    for offset, length, index in spans:
+        out.append('    { %d, %d, %s },' % (offset, length, index))
+    out.append('};')
+    out.append('')
+
+out.append('const rom_template_t rom_templates[] = {')
+for rom, capacity, combinators, name, desc, raw, spans in templates:
+    out.append('    {')
+    out.append('        .name = "%s",' % rom)
+    out.append('        .capacity = %d,' % capacity)
+    out.append('        .combinators = %d,' % combinators)
+    out.append('        .placeholder_base = 0x%08X,' % PLACEHOLDER_BASE)
+    out.append('        .placeholder_name = ' + c_string(name.encode('utf-8')) + ',')
+    out.append('        .placeholder_desc = ' + c_string(desc.encode('utf-8'), 1 << 30) + ',')
+    out.append('        .json = %s_json,' % rom)
+    out.append('        .json_len = %d,' % len(raw))
+    out.append('        .len_spans = %d,' % len(spans))
+    out.append('        .spans = %s_spans,' % rom)
+    out.append('    },')
+out.append('};')
+out.append('const int len_rom_templates = %d;' % len(templates))
+out.append('')
+
+with open(out_filename, "wt") as fd:
+    fd.write('\n'.join(out))
@@ -1,48 +0,0 @@
-#include <stdint.h>
-#include <stdio.h>
-
-const int rom_11_capacity = 2048;
-const char *rom_11_name = "64-value ROM";
-const char *rom_11_desc = "64-value ROM with decimal(0xFF000000 + i) as a placeholder value for the ith word.\\\\n\\\\nFor programming with outside tools.";
-const char *rom_11_bit = "0eNrNnV1vHVdyrv+KoKtzTqxBfVctA7k4XzOTyWQmM3MmNyeBQUu0RUQiBZKyxxj4v2dRMixrs3v37tVvkwyCIJbFMsndrL246nnq/fvzr9+8P393fXF5+/zLvz9/dX7z8vri3e3F1eXzL5+HvfjurP/rZ3/+4788+/7i9vWzV+cvL96evflv9Ldf/5o+/M+zf3h28d+fnd08O3v27s3Zy/PXV29enV8/+/hx31xdP7t9ff7s7kO/v7p+9at///fL/r+/7n/87vrq2+uzt28vLr/9WPrq/e3NxavzZ7dXV29ufvX8i+cXL68ub55/+f///vzm4tvLszd3n9/tD+/O+yf23cX17fv+J188vzx7e/cHH//Gi3j+Y/+4y1fnf3v+Jf/4xYqPtF98pKz6yD//4iN11Uf+8RcfaT/+xxfPzy9vL24vzj9+0R/+4YevLt+//fr8un85P3/03bfl9uzy9sXLq7dfX1ye3V5d99Lvrm4uPr5sf3/e670w/pV/8fyH/v8x5a+8/5deXVyfv/z4V+yLuyq311dvvvr6/PXZdxe9RP+4by7e3J5fr/yev3x9/vI/776Sl1fv7x4i+sUr8B8f/vjy8uN/9+auGt/9n2+vz88vf/lVXrx6/mX0v3tx/fL9xe2Hf7z76B/vvp8H3whZ+42wT98I+/CNgH3pv/nFl/2CIzOFaPAB/O29Wtza4CP5TxO1avAh/d1ErfzFY7um1j9P1Iqfa/mqWr+fqOU/14pVtd5dXP7nRDn7uVyuKveHiVr6c61a3yMOasnPtdqqWv86UYs/Pa60qtifJor94tnn9T3082L16eHndU//XyaKfXr6ed3j//8min16/Hnd8//XiWKfnn9e9wPwbxPFPv0AcMw23+vzV4etV3/RZ+/+2Wd6r67tvb5b76X7vZdjsPfyRC0f7L0yUcsGe69O1NLB3msTtWSw9/pELR7svTFRiwYbb068H7fBxlsTtWqw8baJWjnaeP/nRLEYbbz/a6KYjzbe/z1RzEYb7/+ZKKajjff/ThST0cb764liPNh4ZabR2tpGK5sb7cXt+dtPX+vr87PvfnhxdfHmxddn19fnb+6/2UQtdNvPC765+Pb17fGCudByDwq+//r64uXdd2a2YCz03c8Lvju/+4adv3/74tuzm/mivtCAPy968/7NN+/75/ni7OXFq/mittCJPy/6/Vl/GeeL6UIr/rzYy6t373q1l2dfvzmfKCYLvfjzYhfXV5cvbm4vXk6cp4MXWvFEqW/Pz65ffP/6fPLrpIV2/Hm987fvbn+Y/aZ5W+rHB9Xe9J/u/hn2V/anX1onatZSW/685tmr784uX56/OlIxl3rzwSN9ffXy/Obm4vLbF+8vJwvGUn8++LIvv724PJ8r5kv9eep72L+Dx6vaUqP+vOo3b364+3qvr76+un3xzfXdH96vqYP92g8OyifeWfjadq7gdv791dWrid8XbFULf3l1NvGTU7qqbd/cXl1OvCIlq3r1h+ZwdT1ViFf155+633QpWtWV31+fXV70d4/JWtlWNeXrs+9ffHNx83qiUK1vyO/e9DeMiVK5qiH/9K2aKxaruvHN1Zv+fvjN+6lenL6uF9/c9veH2c/L1jXhXubu/evujWKimK7rvx/f/SfqyLq2+/XZbf9J/2GiEK9suX9796b3mu/ObyZq0bpG+/L6/avz4ye6Nnws/rzN2kxfjZ8/mbvBxKu7Y8zxO/HPm+ovbsRlusX+VPar/u9eXfz8aX9zcX1z+9XIDfnH5v/hkrx/pu/Orj98pl8+/8f+QVfvb9+9X1H2/Lv+SNy+7m92H2u/++GrD9/+r765vnr71cVlL/b8y9vr9+c/nv6N/zCGmLyd54OX5O4X/s/f+j7/92L33xq/eC4z/93DarJQbe73plz5RqvtAS+o2AV2QcXOsAsqdoJdULE12AUVW8EuqNgSdkHFFrALKjaHXVCxGeyCik1xF1RsgrugYmPcBRUb4S6oWBvugoq1cBdUrDn4TlwzjbbWNtp6wCksa+CmsOq4KawabgqripvCquCmsMrQKawSbgorDTeFlcJNYSWBU1gJ4BRWHDiFFQNOYUWBU1gR4BRWRocBeXDobTO9t63tvfkgt0lCgNskbojbJC7QbRIn7DaJA3ebxA66TWKD3SaxAm+TWGC3SczA2yQm4G0SNcxtEhXoNokSd5tEgb5NIh8+wx5cXdBMY717ddd11njwsSsZeOxKCh67kuwwdiXeYexKhBu7Umu4sSu1Qo1dqSV07EotcGNXag4fu1Iz8NiVmmLHrtQEN3alxjuMXakRfOxKNToPaIuXzzMNndcNCNSfyoCAn+iA4O6984sT+f3PXzNdNRCI4/OAu8Pmmv/Y3LyAP9kEZ9cXt6/fnt+d1o4/I7r2GflUGfSY3Jzf1fnq09Pyoj8uV/3t5Ownced/DDwtP1Vf8yzoqhGPnviS6IaXxB/4JTk/e/l68hWhz1+Qfxj58f1Qe83rIcd/KO4P2Y6+XrLwIzg3lOVP8OLb81d3v8P+/I7zrh/0pl4/njhGjzyBs8+UbwDXZee5YLQg1FwwmjfUXLDXKtRcsNdK1Fyw1wrUXLDXctRcsNcy1Fyw11LUXLDXEtRcsNdi2FywFyPYXDCaNdhcsBcr2FywF0vYXLAXC9hcsBcbvVP58LcnW21s8DNl58lg/4INNRnstRQ1Gey1BDUZ7LUYNRnstQg1GYymDTgZ7OUKNRnstRI1Gey1AjUZ7LUcNhnsxQw2GezFFDYZ7MUENhnsxRg2GezFCDYZjCaj9x98yJ3z3GyQc0P71b3BDEqBgRmUDAMzKAkGZlA0GJhBUTAwgyKRYAZFwMAMCoeBGRQGAzMoFAdmUAgOzKBgHJhBQTgwg7zhwAzywoEZ5KMQHB9OEGX2oqE2XDTo3gAyVcEAZKqEAchUAQOQqRwGIFMZDECmUhiATCUwAJmKYQAyFcEAZMqGA5ApCwcgUyYOQKYMHIBM6TgAmdJwADLlqHHJOddq2wapUvbC4PohvzZjcL1IbsfgepWAYHC9kIMwuF7KUBhcr6UQDK4XEhAG10sxDIPrxQiEwUXjBsPgerGCYXC9WCIwuF4nIBhcL+QoDK7XMiwG1yvq+JXtwSl2joMT2rB+RB6Cg+vfBoFycL0gQzm4XpDgHFw0anAOrhctGAfXiyWMg+vFAsTB9VKO5OB6PYNxcL2Yojm4XlOwHFyvyFAOrhckGAcX1Rqeg+tVC83B9ZrDFxGHIJzoiUtTeUNH1wchm8kISzaTNizZTFp4spk08WQzaQDJZnUg2awGI5tVsWSzCpBsVsaTzUposlkamGyWApLNknuQzRJ4sllGOQqRE/ZmTHZ02XD9obtZgOSx3QIkd4AFSG4YC5BcURYgucAsQHLGWIDkhLIAyRrOAiQrlAVIljgLkCxwFiCZQyxAMsNYgGQKswDJBGwBkvH4RfJBp51trTq6Vkoe2RqxJ2qNyLw1cv/97mD11ypt5P6eqOPV5ua4YqOPgD7yIyBP9RHgUXFIFCgOyYnGgPiGBTe7Y6xVsJiRqITFjPRasJiRXgsWM9JrwWJGei1kzEgvB4sZ6bVgMSO9FixmpNfCxYz0YriYkajAxYz0YriYkV4MFzPSi+FiRnqx4V92DydQOjuBig2LHHcXtqrBkkZ6LVjSSK8FSxrptWBJI70WLGmk14IljfRasKSR/pYMSxrptWBJI70WLmmkF8MljfRiuKSRXgyXNNKL4ZJGejFc0kgvNpw0MpfpJFt25u6PrIrhkFVRHLIqgkNWhXHIqhAOWeWGQ1a5cMgqJw5Z5cAhq+xAZJUNiKyyApFVFiCyygxEVpmAyCoNb6+fW5orW7bm7i9nUeHkLEqcnEWBk7PIcXIWGU7OIoXKWSQ4OYsYJ2cR4dzY1oBubCugG9sS6Ma2ALqxzYFubDOgG9tGsVY5nOvo7FynbVjv+DBYaxk2Va8XxKbq9YL4VL1eFJ+q14viUvV6MVyqXi+GStXrpaCper0eLlUvSuGper0mOFWvV8Sm6vWCAcRa1ffAWtXwWKuOtnClwxZ+ItaqtGEV+n4OWMX2YL1eBBCs16tggvV6IVSwXi8FC9aLckywXi+ECtbrpXDBer0YKlivl8IF6/ViuGC9XgwSrNfrYIL1eiFYsF6vBQ7W62/SbfwW+ICHmFsko7yhtep+em0TgF7bGKHXNgLptdVgem0VTq+tBOm1FTC9thyo15bB9NpSoF5bAtRrizF6bRFIr82G02uz0Hpt5vit78Ehdo4tU9lwD6EPo9dmgPXadLBem7aDXpu6g16bAtRrk4F6bRJMr42G1WujgHptJF6vjUDrteFgvTYMdw/RQne4h2gh8HuIFqOMhJ6SWTDZ0XU0Z+KxjQF/qrh4m8XFdcEY8FXGgC4YA36iMaA2+gg8tjGgT/QRuDs/zYWRL4SPqyLDx/VEZ0C3pAzQ3tBqEoyk6rVgJFWvBSOpei0YSdVrwUiqiAYjqXotGEnVa8FIql4LRlL1WjiSqhfDkVS9GI6k6sVwJFUvhiOpejEcSRUxnPulcykDuiVlgPbWs6JgJFWvBSOpei0YSdVrwUiqXgtGUvVaSJKql4ORVL0WjKTqtXAkVSSQpIoEklSRQJIqEkhSRQJJqkggSRXDq1b1cDiks8Oh3HDS5d31LBWcnqWM07OUcHqWNJyeJYXTsyRxepYETs8Sx+lZYjg9SxSoZ4kA9SxhoJ4lBNSzuAH1LC6gnsWj0yOdcwa0Npx0efdFBBy4RQTsuEUEbLhFBKy4RQQsuEUEzNBFBEy4RQTUcIsIqHCLCCiBiwgogIsIyIGLCMiAiwhIgYsISICLCGh40HPoDNjsZGdLygDthkFFAjCoSAQGFQnCoCJgGFQEDoOKAGFQETAMKgKIQUXAMKgIIAYVAcSgIjAYVAQIgwrHYVDhaAwqhrOy9HDHi83teLEtKQP0IBhUOBiDCgdjUOE7YFDhO2BQ4UAMKhyIQYXDMKgwLAYVBsSgwvAYVBgagwoDY1BhQAwqbA8MKgyPQcXwplQ9TBmwE3Us4w2HZd5PxyLafljO1gCH5WyFOSxnS9RhOVvADsvZHHNYzmaow3I2xR2WswnqsJyNcYflbIQ7LGc1yGE5qzCH5ayEHZazAnxYzvLxW9+DTjvHlplsOCzzgxyWswx7WM5S7GE5S/CH5SzGH5azCHdYzmy4w3JmoQ7LmQk9LGcG7rCc6fDDcqaBD8uZij0sZwrusJzJOxyWMwl+WM4YRdTslIX1kx19OGWAHhkYrycKjNt8yoAtOAOxChi3BWcgTgTGbThlgB/5EYin+gjMOwP3YwSWf8k9EjShC0ETpz4CW3IG9gdZh7evToCsw9tXJ0DW4e2rEyDr8PbVCZB1ePvqBMg6vH11GmQdXsA6AbIOL2CdAFmHF7BOgKzjC1gnQNbxBawTIOv4AtYJkHV8AesEyDq+gHUCZB1fwDoBsg4vYLXDGZTPzqC25AzsrmyFEQxkDW0wkDW0YCBraMJA1tDAKVvqOGVLDadsqeKULRWcsqUMVLaUgMqWNKCyJQVUtiSBypYEUNkaDjS1uZwByw0n3d1B1nSBnXTTGXbSTSfYSTetwU66aQU76aYl8qSbFrCTbprDTrppBjvppinupJsmuJNuGuNOummEO+mmNtxJN7VwJ93UUdrKDgdIPnvRUBtOursrWxmFW04QiVtOEIFbThCOW04QBjvpZijspJshsJNuBsNOuhkEO+mmN9xJN71wJ930xJ100wN30k133Ek33XAn3fRRXdZyrtVuyRl4GLDVV65RXZzV+8qVqouzel+5XfWkWb2v3LR60qzeV+5cPTqr95VLV4/O6n1k8er0rN5XLl5dmtX7yt2rR2f1vnb76gmzel+7hHVxVu9rN7Euzep97UrWY1N1X72W9ZRZva9d0HrCrN6HV7T6Yc6Anwi2+pacgR0tMCqABUaJsMAoQBYYOcwCI8NZYKQgC4wEZoERAy0wIhTY6q3hwFZvhQNbvSUEbPUWGLDVm8PAVm8GBlt9OJTLDlfJ2NwqGecNh+UHAluFwGArNzDYyrUD2Mq5A9jKAQRb2YFgKxsMbGXFgq0sQLCVGQ+2MqHBVmpgsJUKCLZS7gG2UuDBVhod5LmcsFd5sqPLhsPyfhZYagAsMHWEBaYGssBUYRaYCs4CUwZZYEowC0wa0AKTgllgkkALTAJogYljLDAxkAUmirPARNAWmPD4RfJBp51trcM5A4/tDLSnCozP5wz4gjOQq4BxX3AG8kRg3IdzBh7bGcgn+gjc/bTNRU0sOAO+6hHQBWfAT30ExnMGWtt7ku8ZsEm+p8Mm+Z4Gm+R7KmyS7ymwSb4nwyb5ngSb5Hs02CTfo2CTfI/ETfI9AjfJ93DcJN/DcJN8D8VN8j0EN8n34dwnn4sZ8PGYAXSn/c3E10swZNW9wZBV94Ihq+4JQ1bdA4asujsSWXU3GLLqrjBk1V1gyKo745BVd8Ihq24Nh6y6FQ5ZdUscsuoWOGTVbfhe8XA05LOjoRzvvrV39zXFCQOmOGHAFCcMmOCEAROcMGACFQZMcMKACU4YMMEJAyZAYcAEKAyYAIUBE6AwYAwUBoyBwoAN5wz4oTAQs7cMNX7LUHvfMpjhfAEznC9ghvMFzHC+gBnOFzDD+QJmOF/ADOcLmOF8AVOgL2AK9AVMgb6AKdAXMAX6AqZAX8B0lInyOV/AxzMGRm8ZTpiXu9n2ebmbAublboKZl7sxal7uRrB5uWvDzMtdCzUvd03cvNw1YHCpOhAuVQPCpaoYuFQFBJcq4+BSJTRcKm38uvbgDDu33iXGIwYwnXVZxJICi1iSYBFLYgcRS3wHEUsMKGKJAkUsEZiIJYwVsYSAIhY3vIjFhRaxOMEiFgdQxGLfQ8Riw4tYPHwUbifs35xs6Dze0OtBGroRWBbQBpYFtO0gC2jbQRbQBpQFtAFlAW0wWUAbVhbQBpQFtOFlAW1oWUALLAtoAWUBrT1kAS28LKDDQQZxbwXyibJAyPjdR+1292EMcAWMEa6AMcgVMIa5AsY4V8AY5AoYw1wBI6ArYARzBYyAroAR0BUwwrgCRiBXwAjnChihXQEbTq71Q1cgZjvrYL7ATxcfj8eJ3/0cP0lQPI7kCyyA4lNvh0fyBRZA8bDTQPEYzBf46Z31ER8BeaqPwLwrEAuPQK16BGLhEahTH4HxfIH9CVZrgWOomuMYqmY4hqopjqFqgmOoGkMZqkY4hqoajqGqwjFUlUCGqgLIUJUDGaoyIENVCmSoSoAMVY2eweJw/pSz86fxeIEHMLVYcKYWM87UYsKZWtRwphYVztSixJlaFDhTixxnapHhTC1SoKlFAjS1iIGmFhGQoWoNyFC1AjJUbRRfjbl0gcjxTrs7raplsE6rpbBOqyWwTqvFsE6rRbBOq9lgnVazYJ1WM2GdVjNgnVbTcZ1W03CdVlNxnVZTcJ1Wk3GdVpNwnVaHc02j5jptjd8o7G5l6XCOwG8naiXsRkGHcwR+N1HLYTcKOpwj8PuJWoq8UdDhKIE/TNRi2I2CDkcJ3L9R0PEogT9NFCvcjYKORwn8ZaJY4G4UdDxK4K8TxQx3o6DDUQJxONXJ2anOeLbAAxGtFoYFoCwUC0BZCB6AsmA8AGVBOADKvOEAKPNCAVDmCQWgzAMHQJk7HIAyNzAAZa5YAMpccACUOe8AQJkTHIAyGz0uJ52wHW6qoed4tMCO8pcVAQCobAgAKgsEQGXCAKgMHACVDgKg0mAAVCoQgEqBAVDJQAAqCQhARcMAUFEgACoSB0BFoAGo8PEb4AMYZm59TPJ4Z90PLVWX7Z1VnQGdVZ0wnVWtoTqrWsE6q1piOqtaoDqrmuM6q5qhOqua4jqrmuA6qxpDOqsaYTqraoN1VtUCd1YdzpKNw9UwOQeVpYxfQjyMhaUrl/0vW1grF/8vW1grMwBOs7BW5gGcZmGtTAY4bmGtjAY4bmGNxAPMWFgr4wEWLayVCQHHLay1GQGnWFhrowKWLay1eQGLFtba4ICjvtTq8ICTLKy1MQKnWFjDQQJ5b0X9iRZWDuYKPL4rwE8VFD+SK7AAiucqUNwXQPE8ERTPwVyBx3cF9Ik+AnfHp5lHIBcegbbqEciFR6Cd+ghsyBWIvRkqbjhalRuOVuWGo1W5cLQqF45W5cLRqlw4WpULR6ty4WhVLiCtygWkVbmAtCoXkFblBNKqnEBalYfzpnMuVyA35ArE3gwVJ87K4sRZWZw4K4sTZ2Vx4qwsTqiVxYmzsjhwVhYHzsriAFpZHEAriwNoZXEArSwOoJXFAbSyeDjEJQ8HQzk7GNqQK5C7E6xkOIKVFEewkuAIVmIcwUoE677SGrL7SitY95WWsO4rLWDdV5rjuq80w3VfaYrrvtIE132lMa77SiNc95Ua5p8Oh0c1e8uwIVcgdze1hHCmFjecqcWFM7U4caYWB87UYseZWmw4U4sVZ2qx4EwtZqCpxQQ0tagBTS0qoKlFCTS1KICmFo0SUTmXK5AbcgViNwCKA4CWsiPQUnYQWsoOQ0vZcWgpOwgtZYehpexAtJQdhpayA9FSdiBayoZBS9lAaCkbDi1lQ6OlPJxMmId7XWpur0ttyBWIBwGg2MAWFhvYwmLbwcJi28HCYgNaWKxAC4sVZmGxYi0sVqCFxYq3sFjRFhYr2MJiBVpYrHtYWKx4C4uHk2HyMFegTrSwakOuQD5IQ5cUbEOXZGxDlyR8Q5do+IYuUbiGLpG4hi4RqIYu4dCGLmG4hi6h8IYuIeCGLsHYhi5BuIYu3nZo6OIFb+jiowRFyQlbdCcb+oZcgdzt7kOqtt99SCXg7kMqMHcfUo66+5Ay2N2HlGLuPqQEdfchxbi7DylC3X1INtzdh2Th7j4kE3L3IRmYuw9Jh919SBr47kNSxy+RDxrtbGcdzRWIxwbF44mC4jWfK3D/7e7zV4lJ15Di97fGL5SbG+LWaLJAPvZDYE/1ITiSLLDwENSqZyAWnoE69RHYkCywP8M6vNt6gmEd3m09wbAO77aeYFiHd1tPMKzDu60nGNbh3dbTDOvweusJhnV4vfUEwzq83nqCYR1fbz3BsI6vt55gWMfXW08wrOPrre9TVDS+3vqvE8UKR1HR8HrrOpxAtdkJ1IZkgf1dLSmcqyWJc7UkcK6WOM7VEsO5WqI4V0sE52oJ41wtIZyrxQ3oanEBXS1OoKvFAXS12IGuFhvQ1RqOpK65ZIHakCywO68qHrBOK+6wTitusE4rrrBOKy6wTivOsE4rTrBOK9ZgnVasYJ1WLHGdVixwnVbMcZ1WzHCdVkxxnVZMcJ1WbFTUqrlkgdqQLLC7lyVGsBsF0Qa7URAt2I2CaMJuFEQD52WpQ70sNZyXpYrzslRwXpYy0MtSAnpZ0oBelhTQy5IEelkSQC9LRpnWOpzrtNm5zoZkgYdhWmnlUupFBIpWLqheRKBo5a7qkxAoWrm3+iQEilZusD6KQNHKFdZHESgaWWM9jUDRyjXWSwgUrdxkfRSBorW7rE9AoGjtSutFBIrW7rVeQqBo7YLrY7ASrV5yfQoCRWvXXZ+AQNHwwut2mCzQTmRa24Zkgf30L2qxHYGi5gAEipphEChqikKgqAkMgaLGGASKGqEQKKqGQ6CoCoVAUSUOgaIKHAJF5RAEisowCBSVwhAoKgEjUDQc612HC2RqboFM25AssCNcKgaAS0URcKkICC4VhsGlQji4lBsILuWCwaWcQLiUAwaXsgPhUjYgXMqKgUtZQHApMw4uZULDpdTGb3wPjrBzUFnbkCzwQB4WFdjDogR7WBQ7eFjkO3hYZEAPixToYZHAPCxirIdFBBRrW8OLta3QYm1LsFjbAijWNt9DrG2GF2vbKB3RTtlQPtnQR5MFHt0WyKcKis8nC7QlW4BXkeJtyRbgE1HxNpot8Oi2gD/Rh6AdyRZYeAjaqmcgF56BduojsCFbwPemqCgMRlFRKIyiohAYRUXBMIqKgmAUFXmDUVTkBaOoyBNGUZEHjKIidxxFRW44iopccRQVueAoKnLGUVTkhKOoaDhwus1lC7QN2QK+N0VFVjCKiixhFBVZwCgqModRVGQGo6jIFElRkQmMoiJjGEVFRjCKirThKCrSwlFUpImjqEgD6GWpA70sNaCXpcO//h6OhtrsaGhDtoDt3H29CYxh9cYwhrXXgjGsvRaMYe21YAxrr4VkWHs5GMPaa8EY1l4LxrD2WjiGtRfDMazeCMew9mI4hrUXwzGsvRiOYe3FhgmouremYvaaYUO4gO18zeBNYbJWrwWTtXotmKzVa8FkrV4LJmv1WjBZq9eCyVr9LRkma/VaMFmr18LJWr0YTtbqxXCyVi+Gk7V6MZys1YvhZK1ebBSKanPhAm1DuIDvR5eqAOhSZQRdqgSiS6XB6FIpHF0qCaJLJWB0qTiQLhWD0aWiQLpUBEiXCmPoUiEQXcoNR5dyoelSzvH72sND7Nxulw9rcka3UfvDqFgcYBWLHaxise2gYrHuoGKxAFUsZqCKxQRTsahhVSwqoIpFiVexKNAqFjlYxSIDqlike6hYJHgVi4YPw+2U9ZvTLX1DwIA9REv3KizY2gtiwdZeEA+29qJ4sLUXxYGtvRgObO3FUGBrLwUFW3s9HNjqlXCwtdcEg629IhZs7QVxYGsvtgPY2qvCwdZec3Syd3eVfNjT7dSeviFjwPa6AvFG2zWwXgSggfUqGA2sF0JpYL0UTAPzahgNrBdCaWC9FE4D68VQGlgvhdPAejGcBtaLQTSwXgejgfVCMA2s1wJrYP1tuo3fJR+22vneOpoy4I+NjNcTRcY/3DfNxQzoUsyArYoZ0KWYATuNGv/wF4ceA3vkx+DuOvSJPgbzQQMTv84evHCySh6YiJNYqDf/IGxIG/DduaoyHFdViuOqSnBcVTGOqyrCcVXZoFxVFo6rysRxVRk4riodyFWlAbmqVCBXlQLkqpKBXFUSkKuKNvy7772ZFM/PpDYEDuwvcBHhyKrWcGRVKxxZ1RJHVrXAkVXNcWRVMxxZ1RRHVjXBkVWNgWRVIyBZVQ1IVlUByapKIFlVASSryoe7r8/22g2RA7tTrJUC67WVDOu1lQTrtRUN1msrCtZrKxLWaysC1msrHNZrKwzWaysU12srBNdrKxjXaysI12vLG67Xlheu19ZwjDRTzfbaDaEDuwtbNRzv8tuJWg67WKjheJffTdRS2MVCDce7/H6iFiMvFmo44eX+xUINJ7z8caJWwS4Wajzh5U8TxQJ3sVDjCS9/mShmuIuFGk94+etEMcFdLNRwwks/wN67WJif9GzIHXgQ2NWbC5aMas5YMqo54cmoZg1PRjUrHBnVLHFkVLNAkVHNHEpGNTMcGdVM4WRUMwGTUc0YS0Y1IxwZ1bTtQEY1LTgZ1XT4zMx0yvq4yZ7OG6IHfD8yKgpARkUiyKgIEBkVDiOjwmBkVAvFkFEtBEVGtWAcGdWCUGRU84Yjo5oXjoxqnhAyqnlgyKjmDiOjmhuYjGquG+6CDxGZNttcN6QP7IedltH25lraAM21tDDNtTRRzbU0cNipOgg7VYNhp6pA7FQFhp0qA7FTJSB2Kg2DnUqBsFNJHHYqgcZOxTdc/h4eZGc5M94QQPBAntbKmJdlT2tl5Muyp7Uy/eU0T2tlEsxpntbKTJjjntbKUJjjntZIMMyMp7UyGGbR01qZDXPc01qbDnOKp7U2JGbZ01qbFLPoaa2NjDlqVK2OjTnJ01obIHOKpzUcIcN8f5n9qZ4Wj2YQPLpL0J4sRH4khGCJIedVLkFbQsj5VJeAR1MIHt0l4Kf6GPB8DMHEZeHBC6frXAJeehD0VJeAfXxHq+498s8msJF/NoaN/LMRbOSf1WAj/6yCjfyzEjnyzwrYyD/LYSP/LION/LMUN/LPEtzIP4txI/8swo38Mxtu5J9ZuJF/5vi06J5LILMuAcf4llbdnW+lwvGtlDi+lQLHt5Lj+FYyHN9KiuNbSXB8KzGObyWC8a3ZGo5vzVY4vjVb4vjWbIHjW7M5jm/NZji+NYfj+fqRdrbXbggkkL0PuxE4cTYCJ85G4MTZCJw4G4ETZ8Oh4mw4TpwNx4mz4ThxNhwozoYDxdlwoDgbDhRnw4HibDhQnA0bv4y8N1GS+duGDZEEsvdhNwonzkbixNlInDgbiRNnI3HibCROnI3EibOROHE2EifORgLF2UigOBsBFGcjgOJsBFCcjQCKsxHD83zO2V7bxres6oNM7zMIO71Pb9jpfXrhp/fpiZ/epwduep/uuOl9uqGm9+kKnd6nC256n87w6X06gaf3aQ07vU8r3PQ+LXeY3qcFfHqfNtyyhU7ZJDbZ04XGt6zqbrhrZmzHXTMdgLtmGgZ3zVQU7popMNw1kzG4ayahcNeMhsNdMwqFu2YkDnfNCBzumuEQ3DXDMLhrhsJw1wwB464ZvOEu+BCRmXUJZEMsgTzIgTkULN+GguXb0B3k25Ad5NsQoHwbApRvQ2DybQhWvg0ByrchePk2BC3fhoDl2xCgfBu8h3wbjJdvYzgt7O4++fDAfCruKhtiCWS3A3MYQL4NQ8i3YSD5Ngwm34bh5NswkHwbBpNvw4DybRhMvg0FyrehQPk2FCPfhoLk21CcfBuKlm9DdcN98mGvnW+uo7kE+tgQuTxZiLwdWUhvSwvpbd1CeltaSH+qTSCjyQTy2A+CPdUHQY4kE8iSTWDrHgRZsgns5AfBx5e17g6zphlsvp+msPl+msDm+2kMm++nEWy+n9pg8/3Ugs33UxM2308NHMyqDoRZ1YAwqyoQZlUBwqzKQJhVCQizyjBdJTHba2N8Wev+5pYUztySxJlbEjhzSxxnbonhzC1RqLklgjO3hHHmlhDO3OIGNLe4gOYWJ9Dc4gCaW+xAc4sNaG7x8K+/cm9eJPPzog3JBPvDrBw4mJUdB7Oy4WBWVhzMyoKDWZlxMCsTDmalhoNZqXAwKyUQZqUAwqzkQJiVDAizkgJhVhIgzErD03qZTSaQDckE+5tbw4lb9w+7Ppy49U8TtQp22PXhxK1/nqgVsMOuDyduTR52fTh06w8TtRR22PXh0K1/najFuMOuj4du3T/s+njo1l8mihXusOvjoVt/nSgWuMOuj4duyb1Zj87Petr4otUdyVMWAHnKjCBPmUDkKTUYeUqFI08pQeQpBYw8JQeSp2Qw8pQUSJ6SAMlTYgx5SgQapLeGG6S3Qg/SW264uD1srrM7YJTGF60+jKoVLcDkaXMwedpsB/K06Q7kaRMgedoYSJ42gpGn1bDkaRWQPK3Ek6cVaPK0HEyelgHJ09I9yNMSPHla4xcS7ZRFjdM9fUMywX7kqZdtPzB7KeDA7CWYA7MXow7MXgQ7MHs2zIHZs1AHZs/EHZg9A3Vg9nTcgdnTcAdmT4UcmD0Fc2D2ZNiB2ZPAB2aPtuHy97DXznJmuiGZ4GFULV+Zr7V4YPaVWVuLB2ZfGbt10oHZV0ZwnXRg9pVhXEcPzL4yjevogdlHErmmD8y+MpFr6cDsK0O5jh6YfW0s1wkHZl+bzrV4YPa1EV1LB2Zfm9V17Gjrq/O6Tjkw+9rkrhMOzD6e3aX3N5ufqmrpaDLBo9sE+lQh8rsbp9mV9Es2ga6DyHnJJtBTIXIdzSZ4dJvAn+yDcCSbQJdsAl/3IOiSTeAnPwg+vi2Q9gasTHA2gQnOJjDB2QQmOJvABGcTGONsAmOcTWCMswmMcTaBMdAmMAbaBMZAm8AYaBMYA20CY6BNYOPBUTprE2iMr8amvQErI5xNYISzCYxwNoERziYwwtkERlCbwAhnExjhbAIjnE2gDWgTaAPaBNqANoE2oE2gDWgTaAPaBDqeRKD3bAKdtQl0QzYB792AXQNHuKrjCFc1HOGqiiNcVXCEqzKUcFXCEa7ScISrFI5wlQQSrhJAwlUcSLiKAQlXUSDhKgIkXGV4fq/3Zko2f9uwIZuA975tcBfYbYM7w24b3Al22+DWYLcNbgW7bXBL2G2DW8BuG9wcdtvgZrDbBjfF3Ta4Ce62wY1xtw1uhLttcG242wbXwt02uA4jsDqbTaBtfC0f7QZHaQPYBNoQNoE2kE2gBbMJtHA2gRbIJtCC2QRaQJtAC2YTaAFtAi2gTaCFsQm0QDaBJs4m0ETbBDqeKKv3bAKbtQmMxvdY04PAUZpgm0ATbBNo7mATaO5gE2gCbQJNoE2gCbMJNLA2gQbQJtDA2wQaaJtAA2wTaABtAo09bAINvE2g42EEes8msFNtAtuQTcAPA7ySgYFXUjDwSrID8Eq8A/BKhOvp1hqup1srVE+3ltCebi1wPd2aw3u6NQP3dGuK7enWBNfTrfEOPd0awXu61TBRYXLK8t3pnr4hm4D3M8SEAIYYN4QhxgUyxDhhhhgHzhBjBxlibDBDjBVoiLHADDFmoCHGBDTEqGEMMSqQIUaJM8Qo0IYY+Yb75MNeO99cR7MJ6LEh8nqqELkdsQlsySa4E4hWQOS2ZBMc1psd69poNgE/9oMQT/ZBOJZNsPQgTP3KeyybYOlBMD31QfDxFYK7E646nE3w24laCgOsdDib4HcTtRgGWOlwNsF9wEqHswkmASsdjif4w0SthAFWOhxPMEG4jscTTBCu4/EEE4TreDzBBOE6Hk8wQbiOxxNMEK7j8QQThOt4PIHdm0v5/Fwqxvdl765zaRAMsFJvMMBKvWCAlXrCACv1gAFW6g4DrNQNBlipKwywUhcYYKXOOMBKnXCAlVrDAVZqhQOs1BIHWKkFDrBSG/6F2Hy2127IJtgdZrUqnDpbiVNnK3DqbDlOnS3DqbOlOHW2BKfOFuPU2SKcOpsNqM5mAdXZTKA6mwFUZ9OB6mwaUJ3NYZfLZrMJbEM2we7mlqXg1NlknDqbhFNno+HU2SicOhsJVWcjcOpsOE6dDYNdLFgo7mLBQnAXCxaMu1iwINzFgnnDXSyYF+5iwXwYeLV7sx6fn/W08W2ADwS8rswpWAZeV2YWLAOvK+MLTgNeV0YZnAa8rgw1OA68rkw1OA68jiQbzACvK5MNFoHXleEGx4HXtfEGpwCva1MOloHXtVEHi8Dr2syDYxiTrM49OAWOkrUJCCfAUTKegeB0r4mfCrw6ja/P3tEQkwIYYpIIQ0wCZIiJwwwxMZwhJgoyxERghpgw0BATghli3ICGGBfQEOPEGGIcIEOMHWeIsaENsfHkWru3a8Zmd834hmyC/chT89jeXM0d0FzNDdNczRXVXM0F1lzNGdNczQnVXM0arrmaFaq5miWuuZoFrrmaOaS5mhmmuZoprLmaCbi5mvGGy9/Dg+wsZ+YbsgkeRtUyI+xthGnD3kaYFv42wjTxtxGmAVS11IGqlhpM1VLFqloqQFVLGa9qKaFVLWlgVUsKqGpJ7qFqSeBVLRmmJfykzebTPX00m+DRbYL2ZCHyNg+R+xJEHutW0vsSRB6nrqT30WyCR7cJ8qk+CH4sm2BRK1lnE+iiVnKqTeDj2QTV9gaspAUMsJLmMMBKmsEAK2kKA6ykCQywksYwwEoawQArqQYDrKQKBlhJJQ6wkgocYCXlOMBKynCAlZTiACspwQFWMp616rPZBD6eTYDutb+Z+IoJBlhJNhhgJVkwwEoyYYCVZMAAK0lHAlaSBgOsJBUGWEkKDLCSZBxgJUk4wEqi4QAricIBVhKJA6wkAgdYSYz/NnxvXuSz61o9hzeVjDbgE+ZFEoAsawlElrUEKMtaApZlLYHLshYHZVmLw7KsxYFZ1uKwLGtxYJa1ODDLWhyTZS0OyrIWx2VZi6OzrMXahrPsYXOd1Qe8hlf7YZrr4rxIDJxlLQbOshbbIctabIcsazFglrUYMMtaDJZlLYbNshYDZlmL4rOsRdFZ1qLgLGtRYJa16B5Z1qL4LGvRYaLK85QlRtM9vY0tHfqpoT/emOBu7vlExwR1ZPvUuinAySuDgobNvge4eGJcJpswLpNNGJfJJozLZBPGZbIJQzPZhHGZbEK4TDYhXCabEDCTTQiYySYEzGQTAmayCQEz2YSAmWxCw/f8cX+ar7MNmIfXWDzAlFVxmWyiuEw2UVwmmwguk00El8kmgstkE8FlsongMtlEcJlsIsBMNhFgJpsIMJNNBJjJJgzMZBMGZrIJDyt5MbueLca55Qe6h+ICR0xwgSMmuHaImODaIWKCCxgxwQmMmOCERUxwYiMmOIERE5z4iAlOdMQEJzhighMYMcG5R8QEJz5igmN4mBB6Cv463dN1WPTbc3BLgIgJboiICW6giAlusIgJbriICW6giAlusIgJbsCICW6wiAluwIgJbsCICS5MxAQXKGKCCxcxwYWOmODyDcfjw147fzs86AI8/iU/P9VL/jjiAqxE/adJ/l79w8PUH+0378/fXV/078cXz9+cfd0foy+fh7347qz/+bM///Ff+h/3r/Dm4+tTbNkks7RU48cf/wtWujJc";
-
-// Sets dest to the placeholder string for the ith element in the json of the blueprint
-int rom_11_placeholder(char dest[8], int i)
-{
-    sprintf(dest, "%d", 0xFF000000 + i);
-    return 0;
-}
-
-// Returns the index of the placeholder if valid, or -1 of not
-int64_t is_rom_11_placeholder(int placeholder)
-{
-    if ((placeholder & 0xFF000000) == 0)
-        return -1;
-
-    if ((placeholder & 0x00FFFFFF) < rom_11_capacity)
-        return placeholder & 0x00FFFFFF;
-    return -1;
-}
-
-const int rom_12_capacity = 4096;
-const char *rom_12_name = "64-value ROM";
-const char *rom_12_desc = "64-value ROM with decimal(0xFF000000 + i) as a placeholder value for the ith word. 4096 words. For programming with outside tools.";
-const char *rom_12_bit = "0eNrNvVuvJcd1bvlXCD51o0Uj5j1CQD/0zdaRfWQ1W62XhiFQZEkqNMUiikXZgqH/frIoQbL2yly5MnLk3tsPgllVe9a+rJpzrowx4vvPT3/99fdvvn3/9psPn/74Pz/96s13X75/++2Ht++++fTHn6Z/9ocvlt/+5PN//e+f/PvbD7/75Ks3X779/Rdf/0/tP/7xH9sP//fJ//LJ2//5ky++++SLT779+osv3/zu3ddfvXn/yZ8/7jfv3n/y4XdvPvn4of/+7v1X//CJt5E//L/f/cMn/7j87rfv3/32/Re///3bb37757/h3fcfvnv71ZtPPrx79/V3//Dpjz59++W7b7779Mf/339++t3b337zxdcfP80Pf/z2zfL5/eHt+w/fL7/yo0+/+eL3H3/hz3/is/z0T8vHffPVm//49Mfypx8d+Ej/Lx+phz7y8//ykXboI//1v3yk/+nffvTpm28+vP3w9s2fv+gf/uOPv/rm+9//+s375cv560d//LZ8+OKbD599+e73v377zRcf3r1fSn/77ru3f/7p/eenHz+Tkn+IH336x09//Fm0f4jlL1o+7MP7d1//6tdvfvfFH94uH7P8wd+8/frDm/cHv8nt0x+qff/xhfOZZFWp5OS3XVZqxeQPQldq+eSPxlZq2X/5YR1+aT2ppX+tFYdqxUot+WutPFQrV2q1v9aqQ7XqtlYbf63VD9XqK7X6X2uNQ7XGSq3622u1HSr2v60U+y8v/GOv/P99pdjfXvly7KX/f6wU+9tLX4699v/PlWJ/e+3LsRf//7VS7G8vfjn26v/HlWJ/e/VL/unf/tznvnnz5cdW+N3HkvLxf96/+eq/9tS3X33sB//2pz99/Nuf9Fk92mftbJ99++HN7//2pf77u3df3XyZ0n2nwf59kS/fLb95W8R2OuvfF/nuw7tv3qxU0Z2e+vdV3r5/981n796vFZKdhvr0a/r22zfvN0q1nX7696W+f//FN2+///16rRo7/fTva73/4t8/+83b7363UqjvNNOVb9SySX1Y+5xqp5eufqu2iuVOM33yMnj39duvPvvN929WXlEVe7306UvqzZuvNz8v3+ulf19sKfPdh7dffvbrL96vFLO9XvrkM/v+6998v1ZH99ro39f59Rcfln/pf1wpJHst9O8LvfmPb79eWs0flm3wtlbb66BPXg/vv//qzWfv3n798Xv1fu0HmWO6jf7o7/47NtqqHW2retX6+k8rQ6RNrq8/uf1OjjG5vv63lVp9cn396Uqtmlxf/3mlVk6ur/+yUism19dv337z/6+U88kN9mcrtWxyg/3XlVo6ucH+fKWWzG6w//dKsTa7wX6+MofH7Ab7/6wU67Mb7C9WitXsBvv/rhTL2Q32lyvFYrL1ypPWqxut1//6SXx8iPPVshjc77z5d333q7fv//y5/LAar3Xhv1T91fJ7X73962f9m7fvv/vwq4e/MV/+7s2Xf/nn/Ofx8OmP28f/+P23X7z/4RP98af/6/JB777/8O33B8q++cMyjD/87u03v/1z7W//+Ksfvvu/+s37d7//1dtvlmKf/vjD++/f/Onx73t8fFTz2/dv3nzz9HeWV/+Xb99/+f3bD6s/ILn5/Y8/bd34a578Yd0ptvXTj6OD19n3M79788Uf/nh/9+iH3tt8/fa3v/twv2Adep/z9fe/fv/2y4/fmM2Ceegtz7dvPn7D3ixvMH77xXfbRePQ258/L6jLuvvF8q9tu6gfeiP078si/n67mB16J/SXdx1ffvHrr1e2+9Tj74Y+rvcrMz7l0LuhH0r99s0X7z/799+9Wf0626E3RG9+/+2HP25+02Ice0v05uul5Syf4fKT/cs/55Wa/dg7oy+++sMX33z55qs7FevY26Nv37/78s133y199LPvv1ktmMfeJ7355rdvv3mzVSwOvlf64Xu4fAfvV/Vj75p+8/UfP36979/9+t2Hz37z/uMv3ta0yeH9tJ377WhY6+Z5tJvX850CSCh2CiAh2CmARMNOAcQHdgog3rFTAPHCTgHEEzsFEA/sFEDcsVMAceNOAcSVOwUQF+4UQLxxpwBigzsFEOvcKYBYTbbhvtFn62ifHc9xCqANOAWQQZwCSIdOAaSwUwBJ7hRAAjoFEMdOAcTAUwBR7BRABDwFkAaeArTBnAK0Dp0CtOJOAVrSpwAtptvok4cTbaOv9qN9tT/fMYBYcscAFtwxgDl3DGDGHQOYcscAJugxgDXuGEAHdwygnTsG0AKPATTBYwAN8BhAHTwGUAOPAVTBYwCdBVnySe+tjdY7jh0DfMQ8XsUxgLzSY4CPM27jHMDvnwPooXMAv38OoA+eA3zcqw6N3t6e+yCgOXwQ0Aw+CGh6wUFAkwsOAlrjDgLaGNxBQBudOghoo9CDgDaSOwhoI/CDgDYcPghow9iDgDaUOwhoQy44CGij4QcBrc8CVPWkn4/HDgJk3gfwfvFJQI5s1ElAjhjUScBSq1MnAUutok4CllpJnQQstYI6CVhqOXUSsNQy6iRgqaXUScBSS7CTgKVYw04CcvjATgKWYh07CViKFXYSsBRL7CRgKTZNU/lWp9X5TjuuPnNtvWNnrq0XdubaemJnrq0HdubaumNnrq0bdubaumJnrq0LdubaesPOXFsN7sy1VefOXFsVd+baKrkz11bBnbm2cu7MtdUs+vLDn17ttDbtXs3utPunrjm0nz51XYrU+VPXpUoip65LoYBOXZdSTp26LrUMOXVdCil06rqUEuzUdSnWoFPXHDKwU9elWMdOXZdiRZy6LnUSOXVdCgV16rrUcvbUdalo8yvrk2PXLZxFfFq/op8W/NPKzu7UuetSy6hz16WWUueuSy2hzl2XWo06d81hAzx3Xcp16tx1qVXUuetSK6lz16VWYOeuSzHHzl2XYoaduy7FFDt3XYoJdu66FGvYuesykWcf3MqN3rN1pYDE/F47LqMJW+R5mrBFADRhC2dowhZG0YQtFKMJWwhDE7ZoFE3YfHA0YfNO0YTNi6MJmydHEzYPhCZs7gxN2NwwmrC5wjRhc5l/QPCEcdjCCSXn99pxNU/YSjGesJVgPGGrhvGELQfGE7bsGE/YskiesGViPGHLwHjClo7xhC2N4wlbKscTthSOJ2zZOJ6wxeB4whad4wlbzCoxcmOab93pIjV3s8BfHim8HFLorxUp7JtIoezcLWCHmELZuVzAHoUK+/TtAswT+z2oMIcoChUuBQWFCpeCDYcKc7SBQ4VL0Y5BhUuxwqDCpVhCUOFSKkiocKnnGFS4FDMaKlxqKgsVLhUFhQqXgg2DCrOPwUOFS9VOQ4VLzekZ/vRato+j+iGscEyO9PHCI11f6UjXaUtg7Uc2bQk8LbY10LXND/TxLJZA88ZaAs0Gawk067wl0Kx4S6BZgpaABWgJmGOWgBlrCZiCloAJbwlYoy0BHbAloB20BLSusAQ0eUtAp+nUeOAuudWGLtM3Bl3vCfSB5QYstbDcgKUWlhuw1MJyA5ZaWG7AUgvLDVhqYbkB2TuWG7DUwnIDllpcbsBSjMsNWIpxuQFLMS43YCnG5QYsxbjcgKXY7OGUbnkCqvOd9npPQJ3zBNQ4T0CV8wRUOE9AG+cJyOA8AemcJyDFeQKSnCcgAXoC4qAnIAZ6AqKgJyACegLSQE+gzQJWuuUJqE3fznahJ9DzfEbLUgTIaFmqMBktSyEqo2UphWW0ZA8mo2UpRGW0LKW4jJalGJXRspTiMlqWYlxGy1IMyWhZ6jAZLUshLKNlqQVntGT3Mb+yPuGptjwB9en72a73BHrHYlqyFxbTstTCYlqWWlhMy1ILi2lZapExLUs5LKZlqYXFtCy1sJiWpRYX07IU42JallHMxbQsxbiYlqUYF9OyFONiWpZis49u9eb6r83owZjfa8d1/utQwH8dQvivo0H+ax+Y/9o757/2gvzXnpj/2gP0X7tj/ms30H/tCvqvXRj/tTfIf63B+a/Vaf+1av4BwRNsccsT0Jzfa6/3BFrnPIFWnCfQkvMEWnCeQHPOE2iGegJNOU+gCecJtMb5r2OA/uvooP86CvRfR4L+6wjQfx0O+q9jOsHo5ibaLU9Aa+7q4Rf3BOK1QoXbnoDueAJ+yBPQHU/AH/QEtE9fPvxMnkB3NoVwKcimEC4F+RTCpSifQrgU5VIIl2JcCuFSjEohXEqhKYRLPS6FMLvhKYRLTTiFcKnIphAuBRP0BCyu8ATMeU/Apmf4U09AH/QEdDJN4MU9AXulI93abKqwFpgqrA96AjafJvA8nkCOSlj8q4DFv/ILxL+yC8S/UlD8KwHFv2qY+JeDFf+yg+JfFi/+ZdLiXwYs/qVzA32kXTDQRyo+0EdO06nxQNbMakM/kSeQV3sC1TB6damF0atLLYxeXWph9OpSC6NXMwdGry61MHp1qYXRq0stjF5danH06lKMo1eXYhy9uhTj6NWlGEevLsU4ejVzOtfFtjwBO5EnUJcbWaackWXCGVnWOCNLB2dkaeeMLC3OyNLkjCwNzshS54wsNdDIUgWNLBXQyNIGGlkyQCNLOmhkySwGYFuegJ3IE8jLeKosgKfKIniqLIinysR4qkyOp8qEeKpMjKfKBHmqTIynygR5qkyQp8pkeKpMiKfK4HiqDJqnyumb/+ypJ2BbnoCdyBPIqz2B7BhPtdTCeKqlFsZTLbUwnmqphfFUSy2Sp1rKYTzVUgvjqZZaHE+VBfJUWSBPlQXyVFkgT5UF8lRZIE+V07FYdnOl55YnYCfyBOo6/7W183ttjQHstTU6s9fWKGqvrZHYXlsjmL22hlN7bQ3j9toaSu21NYTba2s0bq+tPpC9tnpn9trqhe211RPea6vH/AOCJ9jilidgJ/IE6nL/VZLzXyU4/1Wc81/FOP9VlPNfRVD/VRrnv7bB+a+tc/5rK9B/bQn6ry1A/7U56L82A/3XpqD/2maRBLu5XH7LE7DZPIF8Yaiwv1aocNsTsB2qMA55AraDFcaDnoCdyBPIZ8EKM2CsMAPGCjMuwAozLsAKM0CsMAPECjMwrDCdxQrTQawwnccK02msMB3GCtNBrDD9CqwwnccKczqRzZ56AvagJ2CzeQL1wiM9X+lI921P4DYwYP9ndiciqHYigh40BfxEokA9y0iv7uxIr27sSK+u/EivLvxIr964kV41uJFe1amRXlXoSK9KbqRXBT7Sqxwe6VXGjvQq5UZ6lVww0qsaPtIrp/nUeCBBbrWhn0gUuNwUSG8Yv5o2MH41rWP8alph/GpacqaABWcKmHOmgBlnCphypoAJaApYA00BHaApoB00BbRAU0ATNAWms118yxTwE4kCl5sClZ1zsrI4JyuTc7IyOCcrHeu0lYZ12krFOm2lYJ22smGdtmJwnbaic522orhOW5Fcp60IrtNWONdpK2YRK98yBfxEosCFpkDrgCnQijAFWkKmQAvMFGjOmQLNIFOgKWYKNAFNgdYooirG4IiqGJ0jqmIUQlTFSIaoihEYURXDYaIqpu/+86emgG+ZAn4iUeB6U2A6FWvFFJhOxVoxBaZTsVZMgelUrBVTYDoVa8UUmE7FWjcFpoOxVkyB6WCsFVNgOhhrxRSYD8ZaMQXmg7FWTIH5YKwVU2A+GGvFFJgPxloxBeaDsVZMgelgLL+51HPLFPATiQLXmQJlCZgCFoQpYA6ZAmaYKWDKmQImkClgDTMFdICmgHbMFNACTQFN0BTQYEwBdcgUUONMAVXaFFCZf0DwBFzcMgX8RKLA5aZAhWJ7bYVge21Fw/ba8oHtteUd22vLi9xryxPba8sD22vLHdtry43ba8uV22vLhdtryxu315YNbq8t69xeWzZ7/4DfXC+/ZQr4bKLAS5sC47VihdumgO+YAnnIFPAdUyAfNAX8RKLA85gCcTA3bRcrjIMZartYYRyMU3sIK4yD0WoPYYVxMGTtLlYYB1PW7mKFMZO0to4VxsGktT2sMA6Grd3FCuNo3NoDWGEcTV3bxQrjaPTaHlYYRzPY7gGAcTiH7RGsMI4msj2AFcZ0Jps/NQX8QVPAZxMFXtoUqFc60mPbFNAdU8APmQK6Ywr4g6ZAnMgUeCZTQBtsCsiATQHpF5gCUheYApKgKSABmgLimCkgxpoCoqApIMKbAtJoU6AN2BRoHTQFWl1hCrTkTYE2zafGAxlyqw39RKaAX82vunP8qjvHr7pz/Ko7x6+6c/yqO8evunP8qjvHr7pz/KobyK+6gfyqG8ivuoH8qhvIr7qB/KpPx7XFlikQJzIF4upOG5VYp40KrNNGOdZpowzrtFGKddoowTptVMM6beTAOm1kxzptZHGdNjK5ThsZXKeNdK7TRhrXaSOV67QxnaMVW6ZAnMgU8MuIKheAqHIhiCoXiKhywYgqF46ocoGIKheMqPIGElXeMKLKG0hUeQOJKm8MUeUNIqq8cUSVN5qo8unb/+KpKRBbpkCcyBTwq4kqN46ocuOIKjeOqHLliCpXjqhyRYkqV46ocuWIKleOqHIFiSpXkKhyBYkqV5CocgGJKheQqPLpaKy4udZzyxSIE5kCcdleG+7n99pwA/bacGX22nCh9trwhu21YYPZa8M6tdeGFbfXhiVmwFqABqw5aMCaMQasKWTAmnAGrDXagNUx/4DgCbi4ZQrEiUyBuHqvjWzYXhsxsL02omN7bURhe21EYnttRJB7bYRje22EYXtthGJ7bYRwe21E4/ba8MHtteGd22vDi9trw5Pba8NnkYS4uWB+yxSI2UwBf2GsUPS1coXbqkDsqAJ1SBWIHVWgHlQF4kSogD8LV+gN5gptwFyhjQu4QhsXcIU2QK7QBsgV2sC4QhssV2gD5Apt8FyhDZortA5zhdZBrtD6FVyhdZ4rtOlYtniqCsSDqkDMhgrES8/09kpnem67ArbjCsQhV8B2XIF40BXIE6kC8Tz6n3ZY/9OC9T/NC/Q/jQv0P3VQ/1MD9T9VTP9TYfU/baD+J4PX/6TT+p8UrP9JgvqfxBX6nziv/8k0oRoP5MitNvQTqQKXuwLWHSNYrRtGsFpXjGC1LhjBar1hBKvVwAhWq44RrFaFEaxWiRGsVsERrFbOEaxWxhGsVsoRrFbCEaxWjSNYbTrfJbdcgTyRKnC9KyDKuQIinCsgjXMF2uBcgdY5V6AV5wq05FyBFpwr0JxzBZqBrkBT0BVoAroCrYFW1higlTU6aGWNWcgqt1yBPJEqcJ0rYKHnmSoLAZgqi8YwVeaDYqrMO8ZUmRfDVJknxVSZB8dUmTvFVJkbx1SZK8dUmQvCVJk3hqkyGxhTZdZhpsqm7//Lp65AbrkCeSJV4HJXwKaTsX6yUqswpsqmk7F+ulIrMKbKppOx/mWllpFMlU2HY/1spZZgTJVNh2P9fGUID46psvlwrM9XihXHVNl8ONYvVooFx1TZfDjWL1eKzT66zZuLPbdcgTyRKnCdK+C9AQ5sDcKBrQ45sFWYA1vJObAVkANbjjmwZaADW4o5sCWgA1sNdGBzMA5sdsiBzeIc2Ezagc2Yf0DwhFzccgXyRKrA5a6Aj+Qc2BGcAzucc2CHcQ7sUM6BHYI6sKNxDmwfnAPbO+fA9gId2J6gA9sDdGC7gw5sN9CB7Qo6sH32BoK8uWJ+yxXI2VSBF3cF7LVyhduuQO64Av2QK5A7rkB/0BXIE7ECz+MK2MHwtH1X4GCQ2r4rcDBT7TFX4GC+2mOuwMGktfuuwMGotfuuwEzc2oYrcDBubdcVOJi4dt8VOJq59ogrcDR6bd8VOJq/tusKHA1iu0v1Hw5je8gVOBrL9ogrMB3Mlk9dgXzQFcjZWIEXdwXklc702nYFfMcVyEOugO+4AvmgK1AncgWexxXwdHamexo70z2Vn+mews90z8bNdI/BzXSPTs10j0JnukdyM90j8Jnu4fBM9zB2pnsoN9M95IKZ7tHwme4+TajGA0lyqw39RK6AXk2wyuAIVhkcwSqDI1ilcwSrdI5glc4RrNI5glU6R7BK5whW6SDBKh0kWKWDBKt0kGCVAglWKZBglenQttpyBepEroBdbmVp46wsGZyVJZ2zsqQ4K0uSs7IkOCtLnLOyxDgrS5SzskRAK0saaGW1AVpZrYNWVivQymoJWlnTWVq15QrUiVwBvYypkgSYKgmCqZKAmCoJjKmS4JgqCYipksCYKgmQqZLAmCoJkKmSAJkqcYapEoeYKnGOqRKnmSqZvgGwnroCteUK1IlcAb2aqZLimCopjqmS4pgqKY6pkuKYKimUqZLimCpJjqmS5JgqSZCpkgSZKkmQqZIEmSpJkKmSBJkqmY7HqpubPbdcgTqRK2CX7bXa+/m9VnsBe632ZPZa7UHttdod22u1G7PXaldqr9Uu3F6rvVF7rdbg9lqtzu21WoXstVrJ7LVage21Wg7vtVo2/4DgCbm45QrUiVwBu9yBbc45sM04B7Yp58A24RzY1rC9Vscg91odHdtrdRS21+pIbK/VEdxeq8O5vVaHcXutDuX2Wh3C7bU6GrfXap9FEurmjvktV6BmcwX0pbnCfK1c4bYrUDuuwDjkCtSOKzAedAXqRK6APgtXKA5zheIwVyh+AVcofgFXKA5yhWIgVyiGcYViLFcoBnKFYjxXKEZzhWIwVygGcoViV3CFYjxXKNPRbPXUFagHXYGazRWwl57p/kpnet92BWLHFahDrkDsuAL1oCvQT+QK2LPMdC1lZ7qWsDNdq/EzXXPwM12zczNds7iZrpnUTNcMdKZrOjfTNQ2f6ZoKz3RNYWe6ZuNmusa4YKZrdHyma0wTqvFAlNxqQz+RK3C9K6CdcwW0OFdAk3MFNDhXQJ1zBdQ4V0CVcwVUOFdAG+cKyABdAemgKyAFugKSoCsgAboC4qArMJ3w0rdcgX4iV+ByV0AjsU6rEVin1XCs02oY1mk1FOu0GoJ1Wo2GdVr1gXVa9Y51WvXiOq16cp1WPbhOq+5cp1U3rtOqK9dp1Wchq77lCvQTuQLXuQJt5Hmmqo0AmKo2nGGq2jCKqWpDMaaqDWGYqjYaxVS1PjimqvVOMVWtF8dUtZ4cU9V6IExV684wVa0bxlS1rjBT1aZvAOxPXYG+5Qr0E7kC17sC09lYK67AdDbWiiswnY214gpMZ2OtuALT2VgrrsB0Nta6KzAdj7XiCkzHY624AtPxWCuuwHw81oorMB+PteIKzMdjrbgC8/FYv1iZx4Njqtp8PNYvV4rNPrrtNzd7brkC/USuwIWugDrgCqgRroAq5AqoYK6ANs4VkAG5AtIxV0AKdAUkMVdAAnQFxEFXQIxxBUQhV0CEcwWk0a5AG/MPCJ6Qi1uuQD+RK3C5K6DesL1WbWB7rVrH9lq1wvZateRcAQvUFTDnXAEzzhUw5VwBE9AVsAa6AjpAV0A76Apoga6AJugK6OwNBP3mjvktV6DP5gq8uCtQr5Ur3HYF+o4r8MMThsfBwr4jC9yU2yQLTyQLPI8t0A4GqO2She1gmNouWdgO5qo9RBa2gxlrD5GF7WDa2l2ysB2MW7tLFraZyLV1srAdjFzbIwvbwdS1u2RhO5q79gBZ2I7Gr+2She1oBtseWdiOhrHdYwDb4UC2R8jCdjSa7QGysE2Hs/WntkB/0Bbos8kCL24LxCud6mPbFsgdW6AfsgVyxxboD9oC40SywDPZAq3DtkAr2BZoeYEt0OICW6A5aAs0A22Bppgt0IS1BVoDDcAxeANwdNoAHAUbgCNBA3DEFQbgcN4AHNOMajwQJrfa0E8kC7SLGdYYhjGsSy2MYV1qYQzrUgtjWJdaGMO61MIY1qUWxrDGUIxhXWphDOtSi2NYl2Icw7oU4xjWpRjHsC7FOIZ1KcYxrEuxWfRqbNkC40SygFxtC7R0zBZoaZgt0FIxW6ClYLZAy4bZAi0GZgu06Jgt0KIwW6BFYrZAi+BsgRbO2QItjLMFWihnC7QQzhZo0ThboE2naY0tW2CcSBZoV1FVMdp5qmopAlBVSxWGqloKUVTVUgqjqqIPhqpaClFU1VKKo6qWYhRVtZTiqKqlGEdVLcUQqmqpw1BVSyGMqlpqwVRV9Ok7AMdTW2Bs2QLjRLJAu5iqWnZ2jKqKIRhVtdTCqKqlFkZVLbUwqmqpRVJVSzmMqlpqYVTVUgujqpZaHFW1FOOoqmUUc1TVUoyjqpZiHFW1FOOoqqXY7HHsuLnbc8sWGCeSBeQ6C9YUsGBNCAvWGmTB6sAsWO2cBasFWbCamAWrAVqw6pgFqwZasKqgBavCWLDaIAtWBmfBSqctWKn5BwRP0cUtXWCciBaQq3WB5h3TBZoXpgs0T0wXaB6YLtDcMV2guZG6QHPFdIHmgukCzRumCzQbnC7QrHO6QLPidIFmCWqwFqAGaw5qsDbLJIyba+a3dIExGy3QXhgs/DiBXydYuK0LjD1dQA7pAmNPF5AHdYFxIlygPQdaGL2zaOFSkEULl4I8WrgU5dHCpSiHFi7FOLRwKUahhUspFC1c6nFoYfTC0cKlJowWLhVZtHApyKGFS7EL0MKlKo4WLjWnx/hTXWA8qAuM2XABeWldoL/Sqf7D+9etxKAdX2Ac8gVqxxcYD/oCP9wVMzvV5XkkQElYApSAJUDxCyRAsQskQFFQAhQBJUBpmATYBisBtg5KgK14CbAlLQG2gCXA5qAE2OwKCbApLwG2aUw1HkiUW+/oJ/IFLjcGeilmDPQSzBjo1TBjoOfAjIGeHTMGehZmDPRMzBjoGZgx0NMxY6CnccZAT+WMgZ7CGQM9G2cM9BicMdCjc8ZAn056keabvfZEwsD1zkBrnJ01Bmdnjc7ZWaM4O2skZ2eN4Oys4ZydNYyzs4ZydtYQ0M4aDbSz+gDtrN5BO6sXaGf1BO2sHtO9Njd77YmMgeusge7tvDXQbQDWQLfOWAPdirIGuiVnDVhA1oA5Zg2YgdaAKWYNmIDWgDXQGtDBWAPaIWtAi7MGNGlrQOPE2voUr+qbzfVEzMDl4kCfjsr6yUqtwMSBPh2V9dOVWoaJA306KutfVmoJKQ706bSsn62M3oGJA306LevnK7WKEwf6fFrW5yvFghMH+nxa1i9WihknDvT5tKxfrhST6QZ8e9OnbTbgE0kDcp0Tmx1wYrMIJzYTcmIzMCc2HdtuRxqz3Y5UarsdKdx2O7JR2+2IwW23Izq33Y4oZLsdkcx2OyKw7XaEw9vtCDvxoOApyNg2m+uJsAG5XIvtzmmx3TgttiunxXbhtNjeOC22BqrFVue02CpOi63ktNgKUIstB7XYMlCLLQW12BJQi60GarE5phvw7cXzsdmAZ/MGXlwgkFeLGm4bBCuBAk9+UnpIIVhJFNipt40bnsgceCaJ4GC42r5EcDBobV8iOJi59phEcDB/7TGJ4GAS232J4GAU232JYCaObUMiOBjHtisRHExkuy8RHM1ke0QiOBrNti8RHM1n25UIjga13cX9D4e1PSQRHI1te0QiaPPT3G6meT0KHM7GDry4RzBe63CXbY+g116a0CGRoNdemtCjJoGciB54FpMgRig72kcIO9pHNH60Dx/8aB/eudE+vLjRPjyp0T480NE+3LnRPtzw0T5c4dE+XNjRPrxxo33YuGC0D+v4aB82j6/GI4Fz6z19Pn3A+tUuQXaOb83i+NYsjm/N4vjWLI5vzeL41iyOb83i+NYsjm/NAvnWLJBvzQT51kyQb80E+dZMkG/N6Ww3kU2XQObzB2xc7m21znlbrThvqyXnbbXgvK3mnLfVjPO2mnLeVhPO22oN67U1Btdra3Su19YortfWSK7X1giu19ZwrtfWdOaWyKZLIPMJBLN77QO0VTpAW6UTtFU6RFulY7RVOkdbpUO0VTpGW6WDtFU6RlulgbRVGkhbpTG0VRpEW6VxtFUaTVul2Ym19SlttekSyHwIAf3Q4J9WVneOtsrkaKtMjrbK5GirTI62ykBpqwyOtsrgaKsMjrbKAGmrDJC2ygBpqwyQtsoAaasMkLbK6SwtkdtrQDddApnPIZh9kvDAdluV57fbqgC22ypnttsqo7bbKsW22yphttuqRm23lYPbbis7td1WFrfdVia33VYGst1WOrPdVhq23VYqvN1WyokHBU+Bxk2XQOaTCOjHtP+08rBEse22hmDbbY2GbbfVB7bdVu/Ydlu9yO22emLbbfXAttvqjm231Y3bbqsrt91WF267rd647bZqcNttVee226ppREFub6XfdAlkMozgL88WXtAl8FeLG95xCWTPJbBjLoHsuQT2qEsg84EEzEP8XeAwDQYO02DgMO0C4DD1AuAwFQQOU0HgMBUDDlNZ4DAVBA5TeeAwlQYOU2HgMBUEDlOuAA5TeOAwZX6a37gE8qhLIJOZBH95a/WCw11f63DXbZdg7LkEcsglGHsugTzqEuh8KgHzBHN3tFc2drRXDHa0V3R+tFcUP9orkhvtFcGN9gqnRnuFoaO9QrnRXiH4aK9o8GgvH+xoL+/caC+vC0Z7eeKjvXweX41H0ujWe/p8LsEzuASSnEsgwbkE4pxLIMa5BKKcSyDCuQTSOJegDc4laJ1zCVqBLkFL0CVoAboEzUGXoBnoEjQFXYLpiBjRTZdA53MJrncJyh3rteWG9dpyxXptuWC9trxhvbZsYL22rGO9tqywXluWnEtgAboE5qBLYAa6BKagS2ACugTWQJdAp/kr3XQJdD6X4EKXILqfp62iG0BbRVeGtoouFG0VvWG0VdRgaKuoTtFWUcXRVlFJ0VZRwdFWUc7RVlGG0FZRytBWUYLRVlENpq1i/uJAvXEJdNMl0PlcgmdwCaYDtm5pq5gO2PpvK7U6RlvFdMDWP6/USoy2iumArVXaKqYztn62Ussw2iqmM7Z+vlJLONoq5jO2Pl+ZxoOjrWI+Y+sXK8WKo61iPmPrlyvFph/i6u19oJsugc7nElzpEogCLoEI4RJIg1yCNjCXoHXOJWgFuQQtMZegBegSNMdcgmagS9AUdAmaMC5Ba5ApOwZnyo5Om7KjTjwoeAo0broEOp9L8AwugXbOJdDiXAJNziXQ4FwCdc4lUENdAlXOJVDhXAJtnEsgA3QJpIMugRToEkiCLoEE6BKIgy6BTF9VoLe302+6BDqZS/DyLkG8Wtzwjkugey6BH3MJdM8l8EddAp3PJXgmlyAORrHtAodxMJZtFziMgwltDwGHcTCt7SHgMA7mtt0FDuNgcNtd4DBmwtvWgcM4GN62BxzGwfy2u8BhHE1wewA4jKNBbrvAYRxNc9sDDuNorNs9NDAOR7s9AhzG0ZC3B4DDmI950xuXQB91CXQyl+DlXQJ7rcPd2p3QoT2ZQOtY6NCeTaCP2gQ2n0zwTDZBjoRFwRGwKDj8AlFw2AWi4FBQFBwCioKjYaJgH6wo2DsoCvbiRcGetCjYAxYFu4OiYLcrRMGuvCjY5wHWeCSYbr2nn0gmyKsJV1eOcHXlCFdXjnB15QhXV45wdeEIVxeOcHXhCFcXjnB1AQlXF5BwdQEJVxeQcHUBCVcXkHD1+QQ427QJ7EQyQV3dayMU67URgvXaiIb12vCB9drwjvXa8MJ6bXhivTY8sF4b7livDTeu14Yr12vDheu14Y3rtWGD67Vhneu1MR/JZZs2gZ1IJsjLeCsbAG9lg+CtbEC8lXWMt7LO8VbWId7KOsZbWQd5K+sYb2Ud5K2sg7yVdYa3sg7xVlYcb2VF81Y2f3Wg3dgEtmkT2Ilkgryat/LG8VbeON7KG8dbeeN4K28cb+UN5a28cbyVN4638sbxVjZA3soGyFvZAHkrGyBvZQPkrWyAvJXNp2zZ7Y2gmzaBnUgmqOtcWW2AKyuDcGWlQ66sFObKSnKurATkyopjrqwY6MqKYq6sCOjKSgNd2TYYV7Z1yJVtxbmyLWlXtsWJBwVPkcZNm8BOJBPU1dttWHKurAXnyppzrqwZ58qacq6sCerKWuNcWR2cK6udc2W1QFdWE3RlNUBXVh10ZdVAV1YVdGV1GlGw2/vpN20Cm00myJcGDvurBQ7v2AS2ZxPEMZvA9myCeNQmsBPJBPkswKEVDBxawcCh1QXAodUFwKEVCBxagcChFQYcWrLAoSUIHFrywKElDRxawsChJQgcWl4BHFrywKHNB73ZjU1gj9oENptMUC893PO1Dne/YxPInk1gx2wC2bMJ7FGbwE9kE9TzqILNYVWwGawKNr1AFWxygSrYGjfcfQxuuPvo1HD3Uehw95HccPcR+HD34fBw92HscPeh3HD3IRcMdx8NH+7e5wHWeCSabr2nn8gmuNwmsGwY4WoxMMLVomOEq0VhhKtFYoSrRWCEq4VjhKuFYYSrhWKEq4VwhKtF4whX88ERruadI1zNiyNczZMjXG0+KMY3bQI/kU1wuU3gvXPmVi/O3OrJmVs9OHOrO2dudePMra6cudWFM7d648ytGqC5VR00t6pAc6sSNLcqQHOrHDS3aprA8k2bwE9kE1xoE2gHbAItwibQhGwCDcwmUOdsAjXIJlDFbAIV0CbQhtkEMkCbQDpoE0gxNoEkZBNIcDaBOG0TzF8e6Dc2gW/aBH4im+Bym8CmQ7Z+slLLMN7KpkO2frpSSzDeyqZDtm55K5sO2VrlrWw6Z+tnK7UK461sOmdrxSaYz9lasQnmc7ZWbIL5nK0Vm2A+Z2vFJpjP2VqxCeZztlZsgvmcLb+9E3TTJvAT2QTX2QQeeX679Qhgu/VwZrv1MGq79VBsu/UQZrv1aNR26z647da9U9ute3HbrXty2617INutuzPbrbth2627wtutu5x4UPAUady0CfxENsHlNoGXcq5sCefKVuNc2RycK5udc2WzUFc2k3NlMzhXNh3bbj2N2249ldtuPYXbbj0bt916DG679ejcdusxfVmB395Qv2kT+Gw2wYvbBOPVAod3bALfswnymE3gezZBPmoT+IlsgmeyCQ7Gse3bBAej2fZtgoMpbY/ZBAcT2x6zCQ5mt923CQ6Gt923CWYC3DZsgoMBbrs2wcEMt/s2wdEUt0dsgqNhbvs2wdFEt12b4Gi02z00UA/Huz0CHOrRoLcHgEOdj3rzG5vAH7UJfDab4MVtgnqtwz3u2AS6ZxP4MZtA92wCf9QmiBPZBM9jE7g3dri7DXa4u3V+uLsVP9zdErQJLECbwByzCcxYm8AUtAlMeJvAGm0T6IBtAu2gTaB1hU2gydsEOg+wxiPhdOs9/UQ2gV9NuEpyhKskR7hKcoSrJEe4SnKEqyRHuEpyhKskR7hKcoSrBEi4SoCEqwRIuEqAhKsESLhKgISrzKfAxaZNECeyCeLqXqsjsV6rI7Beq8OxXqvDsF6rQ7Feq0OwXqujYb1W+8B6rfaO9VrtxfVa7cn1Wu3B9VrtzvVa7cb1Wu3K9VqdD+WKTZsgTmQT+GW8lRjAW4kRvJUYxFuJYbyVGMdbiUG8lRjGW4mCvJUoxluJgryVKMhbiTK8lSjEW4lyvJUozVvJ/OWBcWMTxKZNECeyCfxq3kqC460kON5KguOtxDneSpzjrcRR3kqc463EOd5KnOOtxEHeShzkrcRB3koc5K3EQN5KDOStZD5nK27vBN20CeJENkFctt1q+vntVtOA7VZTme1WU6jtVrNh263GYLZbjU5ttxrFbbcaSW23GsFttxrObbcahmy3GspstxqCbbcaDd5u1ceJBwVPkcZNmyBOZBPE1dut9oZtt1oD2261OrbdahW23Woltt1qBbndajm23WoZtt1qKbbdagm33Wo1brvVHNx2q9m57VazuO1WM7ntVnMaUYjbG+o3bYKYzSbwFwYOTV8tcHjHJog9m6CO2QSxZxPUozZBnMgm8GcBDkVh4FAEBg5FLgAORS4ADkVA4FAEBA5FMOBQhAUORUDgUIQHDkVo4FAaDBxKA4FDaVcAh9J44FDmo97ixiaIR22CmM0miJce7u21Dve8YxPYnk0Qx2wC27MJ4lGbIE9kE8SzDHf1zg539WKHu3ryw109+OGu7txwVzduuKsrNdzVBR3u6o0b7moDH+5qHR7uasUOd7UEVUGLK1RBc14VtHmANR4Jp1vv6SeyCa63CZpzNkEzziZoytkETTiboDWMcG1jYIRrGx0jXNsojHBtIzHCtY3gCNc2nCNc2zCOcG1DOcK1DeEI1zYaR7i2+aCY3LQJ8kQ2wfU2gSlnE5hwNoE1zibQwdkE2jmbQIuzCTQ5m0CDswnUOZtADbQJVEGbQAW0CbSBNoEM0CaQDtoEMk1g5aZNkCeyCa6zCVrped6qlQC8VavG8FYtB8VbtewYb9WyGN6qZVK8VcvgeKuWTvFWLY3jrVoqx1u1FIS3atkY3qrFwHirFh3mrdr85YF5YxPkpk2QJ7IJLrcJ2nTI1k9WahXGW7XpkK2frtQKjLdq0yFb/7JSy0jeqk3nbP1spZZgvFWbztn6+cocHhxv1eZztj5fKVYcb9Xmc7Z+sVIsON6qzeds/XKl2PRD3Ly9E3TTJsgT2QQX2gStAa7sGIQrOzrkyo7CXNmRnCs7AnJlh2Ou7DDQlR2KubJDQFd2NNCV7YNxZXuHXNlenCvbk3Zle5x4UPAUady0CfJENsH1NoEkZxNIcDaBOGcTiHE2gShnE4igNoE0ziZog7MJWudsglagTdAStAlagDZBc9AmaAbaBE1Bm6BNX1aQtzfUb9oEOZtN8OI2gb1a4PCOTZB7NkE/ZhPknk3QH7UJ8kQ2wfPYBO1gHNsucNgORrPtAoftYErbQ8BhO5jY9hBw2A5mt90FDtvB8La7wGGbCXBbBw7bwQC3PeCwHcxwuwsctqMpbg8Ah+1omNsucNiOJrrtAYftaLTbPTSwHY53ewQ4bEeD3h4ADtt81Fve2AT5qE2Qs9kEL24TyGsd7nXHJvA9myCP2QS+ZxPkozZBncgmeB6bQLrDqmA3WBXseoEq2OUCVbA3UBWsAaqC1TFVsIpVBStBVbCCVwXLaVWwDFYFS0FVsOQKVbAarwrmPMAaj4TTrff0E9kEejHh6kMwwnWphRGuSy2McPXRMMJ1qYURrkstjHBdamGE61ILI1yXWhjhutTiCNelGEe4LsU4wnUpxhGu3gdHuC7FOMJ1KTaNZdWmTVAnsgnsapugecNsgmYDswmadcwmaFaYTdAsOXPLgjO3zDlzy4wzt0w5c8sENLesgeaWDtDc0g6aW1qguaUJmlvzoVy1aRPUiWwCvYq38t7P81beC+CtlioMb7UUonirpRTGWy21GN5qKUTxVkspjrdailG81VKK462WYhxv5T0R3mqpw/BWSyGMt1pqwbzVUjFOrK1PeatNm6BOZBPoxbzVsrpjvNVSC+OtlloYb7XUwnirpRbGWy21SN5qKYfxVsvoxXirpRbGWy21ON5qKcbxVksxjrdainG81VKM462WYhxvtRSbPqGt2ztBN22COpFNYNe5sq0DrmwrwpVtCbmyLTBXtjnnyjaDXNmmmCvbBHRlW6O22zEGt92O0bntdoxCttsxktluxwhsux3D4e12DDvxoOAp0rhpE9SJbAK73JVV51xZNc6VVeVcWRXOldXGubIyUFdWOufKSnGurCTnykqArqw46MqKga6sKOjKioCurDTQlW3TiELd3lC/aRPUbDaBvjRwmK8WOLxjE9SeTTCO2QS1ZxOMR22COpFNoM8BHHpPFjhcCrLA4VKQBw6XojxwuBTlgEPvwQGHSzEKOFxKocDhUo8DDpdiOHC41ISBw6UiCxwuBTngcCl2AXC4VMWBQ+/zUW91YxPUozZBzWYT2EsPd3+tw73fsQlizyaoYzZB7NkE9ahN0E9kE9izDPcxlB3uYwg73Mdo/HAfffDDffTODffRixvuoyc13EcPdLiP7txwH93w4T66wsN9dGGH++iNG+6jxgXDfVTHh/uoeYA1HgmnW+/pJ7IJLrcJunfMJuhemE3QPTGboHtgNkF3x2yC7obZBN0Vswm6C2YTdG+YTdBtcDZBt87ZBN2Kswm6JWgTWIA2gTloE8wHxfRNm6CfyCawy82tSs7cquDMrXLO3CrjzK1Sztwq4cytapy5lYMzt7Jz5lYWaG5lguZWBmhupXO9dqRxvXakcr125DSB1Tdtgn4im+BCm0ASsAkkCJtAHLIJxDCbQJSzCUQgm0AaZhO0AdoErWM2QSvQJmgJ2gQtGJugOWQTNONsgqa0TTB/eWC/sQn6pk3QT2QTXG8TTIdsrdgE0yFbKzbBdMjWik0wHbK1YhNMh2yt2ATTIVvrNsF0ztaKTTCds7ViE0znbK3YBPM5Wys2wXzO1opNMJ+ztWITzOdsrdgE8zlbKzbBfM7Wik0wn7PVb+8E3bQJ+olsgstsAh/u57fb4QZst8OV2W6HC7XdDm/YdjtsMNvtsE5tt8OK226HJWYTWIA2gTloE5gxNoEpZBOYcDaBNdom0HHiQcFTpHHTJugnsgmutgl8ZMO22xED225HdGy7HVHYdjsise12RJDb7QjHttsRhm23IxTbbkcIt92OaNx2O3xw2+3wzm23w4vbbocnt90On76soN/eUL9pE/TZbIIXtwnq1QKHd2yCvmMT/JB7cgA47Ds2wU29beDwRDbBM9kEB+PYdoHDOhjNtgsc1sGUtoeAwzqY2PYQcFgHs9vuAod1MLztLnBYMwFu68BhHQxw2wMO62CG213gsI6muD0AHNbRMLdd4LCOJrrtAYd1NNrtHhpYh+PdHgEO62jQ2wPAYc1HvfUbm6A/ahP02WyCF7cJ4rUO93HHJsg9m6Afswlyzyboj9oE40Q2wTPZBNphm0ALtgk0L7AJNC6wCdRBm0ANtAlUMZtAhbUJtIE2gQzeJpBO2wRSsE0gCdoEElfYBOK8TSDzAGs8Ek633tNPZBO0qwnXDI5wzeAI1wyOcM3gCNcMjnDN4AjXDI5wTecI13SOcE0HCdd0kHBNBwnXdJBwTQcJ13SQcM35FLixaROME9kEcnWvre5Yr61uWK+trlivrS5Yr63esF5bNbBeW9WxXltVWK+tSqzXVgXXa6uc67VVxvXaKuV6bZVwvbaqcb225kO5xqZNME5kE7TLeKtUgLdKJXirVIi3SsV4q1SOt0qBeKsUjLdKAXmrFIy3SgF5qxSQt0pheKsUiLdK4XirFJq3yvnLA8eNTTA2bYJxIpugXc1bpXO8VRrHW6VxvFUax1ulcbxVGspbpXG8VRrHW6VxvFUayFulgbxVKshbpYK8VSrIW6WCvFXO52yN2ztBN22CcSKbQC7bbiv0/HZbIcB2W9GY7bZ8UNttece22/JittvypLbb8uC223Knttty47bbcuW223JBttvyxmy3ZQPbbss6vN2W1YkHBU+Rxk2bYJzIJpCrt9vKjm23lYVtt5WJbbeVgW23lY5tt5VGbreVim23lYJtt5UN224rBrfdVnRuu60obrutSG67rQhuu61wbrutmEYUxu0N9Zs2wZjNJmgvDBx+HMOvFDi8YxOMPZtAjtkEY88mkEdtgnEim6A9C3CYDQYOs8HAYbYLgMNsFwCH2UDgMBsIHGbDgMNsLHCYDQQOY/DAYQwaOIwBA4cxQOAwxhXAYQweOIz5qLdxYxOMR22CMZtNIC9tE/RXOtx/eCu7GTy0ZxOMYzZB7dkE40GbQNuJbAJ5luFelrAqaAGrguYXqIJmF6iCpqAqaAKqgtYwVVAHqwpqB1VBLV4V1KRVQQ1YFVQHVUG1K1RBVV4V1HmANR4Jp1vv6SeyCS63CWIoRrjGEIxwjdEwwjX6wAjX6B0jXKMXRrhGT4xwjR4Y4RrdMcI1unGEa3TlCNfowhGu0RtHuEYNjnCN6hzhGtNBMdp8s9eeyCa43ibQxtkEMjibQDpnE0hxNoEkZxNIcDaBOGcTiHE2gShnE4iANoE00CZoA7QJWgdtglagTdAStAlaTPfa3Oy1J7IJrrMJItt53ipiALxVRGd4q4iieKuIxHiriGB4qwineKsI43irCKV4qwjheKuIxvFW4QPhrcI7w1uFF8ZbhSfMW4XHibX1KW/VN5vriWyCy22CmA7Z+slKrcB4q5gO2frpSi3DeKuYDtn6l5VaQvJWMZ2z9bOV0Tsw3iqmc7Z+vlKrON4q5nO2Pl8pFhxvFfM5W79YKWYcbxXzOVu/XCkm0w349k5Q22zAJ7IJrrMJsnfAle1FuLI9IVe2B+bKdudc2W6QK9sVc2W7gK5sb5grWwN0ZauDrmwV48pWQq5sBefKltOubNmJBwVPkca22VxPZBNcbxM052yCZpxN0JSzCZpwNkFrnCs7BurKjs65sqM4V3Yk58qOAF3Z4aArOwx0ZYeCruwQ0JUdDXRl+5huwLc31MdmA57NJnhxm0BeLXC4bROsRA88+UnpIZtgJXpgp942cHgim+B5bII4GMe2CxzGwWi2XeAwDqa0PQQcxsHEtoeAwziY3XYXOIyD4W13gcOYCXBbBw7jYIDbHnAYBzPc7tsER1PcHrEJjoa57dsERxPddm2Co9Fud7n/w/FuD9kER4PeHrEJdH6a2800r0eBw9lsghe3CcZrHe5yxybotRc8dMwm6LUXPPSoTSAnsgmexybIUlgVLIFVwWoXqII5LlAFs4OqYBaoCmZiqmAGqwqmc8M90/DhnqnwcM8UdrhnNm64Z4wLhntGx4d7xjzAGo+E06339PlsAu1XE67eOMLVBke42uAIVxsc4WqDI1xtcISrDY5wtcERrjY4wtUGSLjaAAlX6yDhah0kXK2DhKt1kHC16RQ4lU2bQOazCXRcbm5p58wtLc7c0uTMLQ3O3FLnzC01ztxS5cwtFc7c0saZWzJAc0s6aG5JgeaWJGhuSYDmljhobk2Hcqls2gQyn00wu9c+wFtZAryVJcFbWUK8lSXGW1lyvJUlxFtZYryVJchbWWK8lQXIW1mAvJUFw1tZQLyVBcdbWdC8lYWdWFuf8labNoHMZxPQDw3+aWV153gr6xxvZZ3jraxzvJV1jreyQnkrK463suJ4KyuOt7ICeSsrkLeyAnkrK5C3sgJ5KyuQt7LpnC2V2ztBN20Cmc8mmH2S8MB26yPPb7c+AthufTiz3fowarv1odh260OY7dZHo7Zb74Pbbr13arv1Xtx26z257dZ7INutd2e2W++GbbfeFd5uvcuJBwVPkcZNm0Dmswnox7Qrrqwo58qKcK6sNM6VbYNzZVvnXNlWqCvbknNlW3CubHPOlW0GurJNQVe2CejKtsZttz4Gt9366Nx262MaUZDbG+o3bQKZzCb4y7OFF7QJ/NUCh3dsAtmzCeyYTSB7NoE9ahPIfDYB8xB/Fzi0gIFDCxg4tLgAODS/ADg0B4FDcxA4NMeAQ3MWODQHgUNzHjg0p4FDcxg4NAeBQ7MrgEMzHjg0m5/mNzaBPGoTyGQ2wV/eWr3gcNfXOtz1jk0w9mwCOWYTjD2bQB61CXQ+m4B5hrk73L03drh7DXa4e3V+uHsVP9y9khvuXsENdy+nhruXocPdS7nh7iX4cPdq8HD3HOxw9+zccPesC4a7Z+LD3XMeYI1HwunWe/p8NsH1NoFZcjaBBWcTmHM2gRlnE5hyNoEJZxNY42wCHZxNoJ2zCbRAm0ATtAk0QJtAHbQJ1ECbQBW0CaaDYlQ3bQKdzya43ibwdKzXehrWaz0V67WegvVaz4b1Wo+B9VqPjvVaj8J6rUdivdYjuF7r4Vyv9TCu13oo12s9hOu1Ho3rte7TBJZu2gQ6n01wpU3QHLAJmhE2QVPIJmiC2QStYbyVjsHwVjo6xVvpKI630pEUb6UjON5Kh3O8lQ5DeCsdyvBWOgTjrXQ0mLfS+csD9cYm0E2bQOezCZ7BJpgO2VqxCaZDtlZsgumQrRWbYDpka8UmmA7ZWrEJpkO21m2C6ZytFZtgOmdrxSaYztlasQnmc7ZWbIL5nK0Vm2A+Z2vFJpjP2VqxCeZztlZsgvmcrRWbYD5nS2/vBN20CXQ+m+BKm8AUsAlMCJvAGmQT6MBsAu2cTaAF2QSamE2gAdoE6phNoAbaBKqgTaDC2ATaIJtABmcTSKdtAqkTDwqeIo2bNoHOZxNcbxO4d2y7dS9su3VPbLt1D2y7dXdsu3U3crt1V2y7dRdsu3Vv2HbrNrjt1q1z261bcdutW4I2gQVoE5iDNoFNX1agtzfUb9oEOplN8PI2Qbxa4PCOTaB7NoEfswl0zybwR20Cnc8meCabQA/Gse0Ch3owmm0XONSDKW0PAYd6MLHtIeBQD2a33QUO9WB4213gUGcC3NaBQz0Y4LYHHOrBDLe7wKEeTXF7ADjUo2Fuu8ChHk102wMO9Wi02z00UA/Huz0CHOrRoLcHgEOdj3rTG5tAH7UJdDKb4OVtAnutw93aneChPZtA61jw0J5NoI/aBDafTfBcNoEkbBNIwDaB+AU2gdgFNoEoaBOIgDaBNMwmaIO1CVoHbYJWvE3QkrYJWsA2QXPQJmh2hU3QlLcJ2jzAGo+E06339BPZBHk14SrOEa7iHOEqzhGu4hzhKs4RrmIc4SrGEa5iHOEqxhGuYiDhKgYSrmIg4SoGEq5iIOEqBhKuMp8CZ5s2gZ3IJqire62WYr1WS7Beq9WwXqs5sF6r2bFeq1lYr9VMrNdqBtZrNR3rtZrG9VpN5XqtpnC9VrNxvVZjcL1Wo3O9VudDuWzTJrAT2QR5GW8lAvBWIgRvJQLxVtIw3koax1tJg3graRhvJQ3kraRhvJU0kLeSBvJW0hjeShrEW7XB8VZt0LxVm7880G5sAtu0CexENkFezVuJcryVKMdbiXK8lSjHW4lyvJUoyluJcryVKMdbiXK8lQjIW4mAvJUIyFuJgLyVCMhbiYC8lcznbNntnaCbNoGdyCaoy7Zb9XZ+u1UbwHar1pntVq2o7VYtOVfWAnJlzTFX1gx0ZU0xV9YEdGWtga6sDsaV1Q65slqcK6tJu7IaJx4UPEUaN20CO5FNUFdvtxqJbbcagW23Go5ttxqGbbcaim23GkJutxoN227VB7bdqndsu1UvbrtVT267VQ9uu1V3brtVN267VVduu1WfRhTs9ob6TZvAZrMJ8qWBw/5qgcM7NoHt2QRxzCawPZsgHrUJ7EQ2QT4LcNgGDBy2AQOHbVwAHLZxAXDYBggctgECh21gwGHrLHDYOggcts4Dh63TwGHrMHDYOggctn4FcNg6Dxy2+ag3u7EJ7FGbwGazCeqlh3u+1uHud2wC2bMJ7JhNIHs2gT1qE/iJbIJ6HlVQHVYF1WBVUPUCVVDlAlVQG6gKygBVQemYKijFqoKSoCoowauC4rQqKAargqKgKihyhSoojVcF2zzAGo+E06339BPZBJfbBK03jHBtNTDCtVXHCNdWhRGurRIjXFsFRri2coxwbWUY4dpKMcK1lXCEa6vGEa4tB0e4tuwc4dqyOMK1ZXKEa5sPivFNm8BPZBNcbxO0ztkErTiboCVnE7TgbILmnE3QjLMJmnI2QRPOJmiNM7fGAM2t0UFzaxRobo0Eza0RoLk1HDS3xjSB5Zs2gZ/IJrjOJmjez/NWzQvgrZonw1s1D4q3au4Yb9XcGN6quVK8VXPheKvmjeKtmg2Ot2rWOd6qWSG8VbOEbAILziYwp22C+csD/cYm8E2bwE9kE1xuE7TpkK2frNQyjLdq0yFbP12pJRhv1aZDtm55qzYdsrXKW7XpnK2frdQqjLdq0zlbP1+pFRxv1eZztj5fKWYcb9Xmc7Z+sVJMON6qzeds/XJlKE8/xPXbO0E3bQI/kU1wnU0glYArW0G4suWQK1uGubKlnCtbArmy1TBXNgfoymbHXNks0JXNBF3ZDMaVTWe2W0nDtltJhbdbSTnxoOAp0rhpE/iJbILLbQIZyrmyQzhXdjTOle2Dc2V751zZXqgr25NzZXtwrmx3zpXtBrqyXUFXtgvoyvYGurI1QFe2OujK1vRlBX57Q/2mTeCz2QQvbhOMVwsc3rEJfM8myGM2ge/ZBPmoTeAnsgmeySY4GMe2bxMcjGbbtwkOprQ9ZhMcTGx7zCY4mN123yY4GN523yaYCXDbsAkOBrjt2gQHM9zu2wRHU9wesQmOhrnt2wRHE912bYKj0W53uf/D8W4P2QRHg94esQnmo978xibwR20Cn80meHGboF7rcI87NoHu2QR+zCbQPZvAH7UJ4kQ2wfPYBJKNHe4Sgx3uEp0f7hLFD3eJ5Ia7RHDDXcKp4S5h6HCXUG64Swg+3CUaPNzFBzvcxTs33MXrguEunvhwF58HWOORcLr1nn4im8AvJlytd4xwXWphhOtSCyNcl1oY4brUwgjXpRZGuC61MMJ1qYURrkstjHC1XhzhuhTjCNelGEe4LsU4wnUpxhGuSzGOcF2KTWNZsWkTxIlsgrjc3JLkzC0JztwS58wtMc7cEuXMLRHO3JLGmVttcOZW65y51Qo0t1qC5lYL0NxqDppbzUBzqylobs2HcsWmTRAnsgn8Kt7KepznrZYiAG+1VGF4q6UQxVstpTDeaqnF8FZLIYq3su4cb7UUo3irpRTHWy3FON5qKYbwVksdhrdaCmG81VIL5q2WinJibX3KW23aBHEim8Av5q2W1R3jrZZaGG+11MJ4K+uJ8VZLLYy3WmqRvNVSDuOtlloYb7XUwnirpRbHWy3FON5qKcbxVksxjrdaRjLHWy3FON5qKTZ9Qhu3d4Ju2gRxIpsgLttuR/fz2+3oBmy3oyuz3Y4u1HY7esO221GD2W5HdWq7HVXcdjsqqe12VHDb7SjntttRhmy3o5TZbkcJtt2OavB2O3KceFDwFGnctAniRDZBXO7KtoZtt2MMbLsdo2Pb7RiFbbdjJLbdjhHkdjuGY9vtGIZtt2Mott2OIdx2O0bjttvRB7fdjt657Xb04rbb0ZPbbkefRhTi9ob6TZsgZrMJ/IWBw9BXCxzesQlizyaoYzZB7NkE9ahNECeyCfw5gEPrzgKH1o0FDpeCPHC4FOWBw6UoBxwuxTjgcClGAYdLKRQ4XOpxwOFSDAcOl5owcGhdWeBwKcgBh0uxC4DDpSoOHC4156f5jU0Qj9oEMZtNEC893NtrHe55xyawPZsgjtkEtmcTxKM2QZ7IJohnGe4jOzvcRxY73EcmP9xHBj/cRzo33EcaN9xHKjXcRwo63Ec2briPGPhwH9Hh4T6i2OE+IrnhPiIuGO4jHB/uI+YB1ngknG69p5/IJrjeJlDnbAI1ziZQ5WwCFc4m0MbZBDI4m0A6ZxNIcTaBJGcTSIA2gThoE4iBNoEoaBOIgDaBNNAmmA+KyU2bIE9kE1xtEyzjR7FeO0KwXjuiYb12+MB67fCO9drhhfXa4Yn12uGB9drhjvXa4cb12uHK9drhwvXa4Y3rtcMG12uHda7XDpsmsHLTJsgT2QTX2QQ19DxvVUMA3qpGY3ir6oPirap3jLeqXgxvVT0p3qp6cLxVdad4q+rG8VbVleOtqgvCW1VvDG9VNTDeqqrDvFXNXx6YNzZBbtoEeSKb4HqbYDpka8UmmA7ZWrEJpkO2VmyC6ZCtFZtgOmRrxSaYDtlatwmmc7ZWbILpnK0Vm2A6Z+vnK3N4cLxVzedsfb5SrDjequZztn6xUiw43qrmc7Z+uVJs+iFu3t4JumkT5IlsggttAm2ATSCDsAmkQzaBFGYTSHI2gQRkE4hjNoEYaBOIYjaBCGgTSANtgjYYm6B1yCZoxdkELWmboMWJBwVPkcZNmyBPZBNcbRPYsORsAgvOJjDnbAIzziYw5WwCE9QmsMbZBDo4m0A7ZxNogTaBJmgTaIA2gTpoE6iBNoEqaBPo9GUFeXtD/aZNkLPZBC9uE9irBQ7v2AS5ZxP0YzZB7tkE/VGbIE9kEzyPTVAH49h2gcM6GM22CxzWwZS2h4DDOpjY9hBwWAez2+4Ch3UwvO0ucFgzAW7rwGEdDHDbAw7rYIbbXeCwjqa4PQAc1tEwt13gsI4muu0Bh3U02u0eGliH490eAQ7raNDbA8BhzUe95Y1NkI/aBDmbTfDiNoG81uFed2wC37MJ8phN4Hs2QT5qE9SJbIJnsgmawzZBM9gmaHqBTdDkApugNVAVHANUBUfHVMFRrCo4ElQFR/Cq4HBaFRwGq4JDQVVwyBWq4Gi8KtjnAdZ4JJxuvaefyCbQqwnXNI5wTeMI1zSOcE3lCNdUjnBN5QjXVI5wTeUI11SOcE0FCddUkHBNBQnXVJBwTQEJ1xSQcM35FLjatAnqRDaBXd1rKxvWaysG1msrOtZrKwrrtRWJ9dqKwHpthWO9tsKwXluhWK+tEK7XVjSu15YPrteWd67XlhfXa8uT67U1H8pVmzZBncgm0Mt4q2wAbxWD4K1iQLxVDIy3isHxVjEg3ioGxlvFAHmrGBhvFQPkrWKAvFV0hreKDvFW0TneKjrNW8X85YF1YxPUpk1QJ7IJ9GreKoXjrVI43iqF461SON4qheOtUlDeKoXjrbJxvFU2jrfKBvJW2UDeKhvIW2UDeatsIG+VDeStcj5nq27vBN20CepENoFd58pqB1xZLcKV1YRcWQ3MlVXnXFk1yJVVxVxZFdCV1Ya5sjJAV1Y66MpKMa6sJOTKSnCurDjtyoqdeFDwFGnctAnqRDaBXb3dlju23ZYbtt2WK7bdlgu23ZY3bLstG+R2W9ax7bassO22LDlX1gJ0Zc1BV9YMdGVNQVfWBHRlrYGurE4jCnV7Q/2mTVCz2QT60sBhvlrg8I5NUHs2wThmE9SeTTAetQnqRDaBPgtwGB0GDqPDwGH0C4DD6BcAh9FB4DAKBA6jMOAwigUOo0DgMIoHDqNo4DAKBg6jQOAw6grgMIoHDmM+6q1ubIJ61Cao2WwCe+nh7q91uPc7NkHs2QR1zCaIPZugHrUJ+olsAnseVVAUVgVFYFVQ2gWqYBsXqIKtg6pgK1AVbImpgi1YVbA5qAo241XBprQq2ARWBVvjhnuOccFwz9Hx4Z5jHmCNR8Lp1nv6iWyCy22CyI4RrpGFEa6RiRGukYERrpGOEa6RhhGukYoRrpGCEa6RDSNcIwZHuEZ0jnCNKI5wjUiOcI0IjnCNcI5wjfmgmL5pE/QT2QSX2wQ5kjO3RnDm1nDO3BrGmVtDOXNrCGdujcaZW31w5lbvnLnVCzS3eoLmVg/Q3OoOmlvdQHOrK2hu9WkCq2/aBP1ENsF1NkFYAjaBBWETmEM2gRlmE5hyNoEJZBNYw2wCHaBNoB2zCbRAm0ATtAk0GJtAHbIJ1DibQJW2CeYvD+w3NkHftAn6iWyCy22CmA7Z+slKLcF4q5gO2brlrWI6ZOufV2p1jLeK6ZCtVd4qpnO2frZSKzDeKqZztn6+Uss43irmc7Y+XykmHG8V8zlbv1gZyYPjrWI+Z+uXK8WmH+L22ztBN22CfiKb4DqbINPPb7eZBmy3mcpst5lCbbeZDdtuMwaz3WZ0arvNKG67zUhqu80IbrvNcG67zTBku81QZrvNEGy7zWjwdps+TjwoeIo0btoE/UQ2weU2QfbGubI1OFe2OufKVnGubCXnylagrmw558qWca5sKefKloCubDXQlc0BurLZQVc2C3RlM0FXNqcvK+i3N9Rv2gR9NpvgxW2CerXA4R2boO/YBNaO2QR9xya4qbcNHJ7IJngmm+BgHNu+TXAwmm3fJjiY0vaYTXAwse0xm+Bgdtt9m+BgeNt9m2AmwG3DJjgY4LZrExzMcLtvExxNcXvEJjga5rZvExxNdNu1CY5Gu93l/g/Huz1kExwNenvEJpiPeus3NkF/1Cbos9kEL24TxGsd7uOOTZB7NkE/ZhPknk3QH7UJxolsguexCdI7O9zTix3u6ckP9/Tgh3u6c8M93bjhnq7UcE8XdLinN264pw18uKd1eLinFTvc0xK0CSyusAnMeZvA5gHWeCScbr2nn8gmaFcTrlYc4WrFEa5WHOFqxRGuVhzhasURrlYc4WrJEa6WHOFqCRKuliDhagkSrpYg4WoJEq6WIOFq8ylwY9MmGCeyCeRyc6s5Z24148ytppy51YQzt1rDeq2PgfVaHx3rtT4K67U+Euu1PoLrtT6c67U+jOu1PpTrtT6E67U+GtdrfT6Ua2zaBONENkG7jLcyB3grc4K3Mod4K3OMtzLneCsziLcyw3grM5C3MsN4KzOQtzIDeSszhrcyg3grM463MqN5K5u/PHDc2ARj0yYYJ7IJ2tW8lSXHW1lwvJUFx1tZcLyVBcdbWaC8lQXHW1lwvJUFx1tZgLyVBchbmYO8lTnIW5mDvJU5yFvZfM7WuL0TdNMmGCeyCeSy7dZLz2+3XgJst16N2W49B7XdenZsu/UsZrv1TGq79Qxuu/V0arv1NG679VRuu/UUZLv1bMx26zGw7dajw9utR514UPAUady0CcaJbAK5erv13rHt1nth2633xLZb74Ftt94d2269G7ndeldsu/Uu2HbrvWHbrdfgtluvzm23XsVtt17JbbdewW23Xs5tt17TiMK4vaF+0yYYs9kE7YWBw49j+JUCh3dsgrFnE3xkqQ8Ah2PPJnhabxs4PJFN0J4FODSFgUNTGDg0vQA4NL0AODQFgUNTEDg0xYBDUxY4NAWBQxMeODShgUMTGDg0AYFDkyuAQxMeOLT5qLdxYxOMR22CMZtNIC9tE/RXOtx/eCu7GTy0ZxOMYzZB7dkE40GbwNqJbAJ5luHukexw9wh2uHs4P9w9jB/uHsoNdw/hhrtHo4a7+0CHu3vnhrt74cPdPeHh7h7scHd3bri72wXD3V3x4e4+D7DGI+F06z39RDbB9TaBKGcTiHA2gTTOJmiDswla52yCVpxN0JKzCVpwNkFzziZoBtoETUGboAloE7TGEa46Bke46ugc4arTQTHLa2qz157IJrjcJnBvWK91G1ivdetYr3UrrNe6JWcTWHA2gTlnE5hxNoEpZxOYgDaBNdAm0AHaBNpBm0ALtAk0QZtAY7rX5mavPZFNcJ1NoL2d5620BsBbaXWGt9IqirfSSoy30gqGt9JyirfSMo630lKKt9ISjrfSahxvpTkQ3kqzM7yVZmG8lWbCvJVmnFhbn/JWfbO5nsgmuNwm0OmQrZ+s1AqMt9LpkK2frtQyjLfS6ZCtf1mpJSRvpdM5Wz9bGb0D4610Omfr5yu1iuOtdD5n6/OVYsHxVjqfs/WLlWLG8VY6n7P1y5ViMt2Ab+8Etc0GfCKb4EKboHXAJmhF2AQtIZugBWYTNOdsgmaQTdAUswmagDZBa5grOwboyo4OurKjGFd2JOTKjuBc2eG0KzvsxIOCp0hj22yuJ7IJrrcJ1DmbQI2zCVQ5m0CFswm0cTaBDNQmkM7ZBFKcTSDJ2QQSoE0gDtoEYqBNIAraBCKgTSANtAnamG7AtzfUx2YDns0meHGbQF4tcLhtE6xEDzwdlYeyCVaiB3bqbQOHJ7IJnscm0INxbLvAoR6MZtsFDvVgSttDwKEeTGx7CDjUg9ltd4FDPRjedhc41JkAt3XgUA8GuO0Bh3oww+0ucKhHU9weAA71aJjbLnCoRxPd9oBDPRrtdg8N1MPxbo8Ah3o06O0B4FB9fprbzTSvR4HD2WyCF7cJxmsd7nLHJui1Fzx0zCbotRc89KhNICeyCZ7HJrChsCo4BFYFR7tAFezjAlWwd1AV7AWqgj0xVbAHqwp2B1XBbrwq2JVWBbvAqmBvoCpY4wpVsDqvCtY8wBqPhNOt9/T5bAIZVxOu6h0jXNULI1zVEyNc1QMjXNUdI1zVDSNc1RUjXNUFI1zVG0a4qg2OcFXrHOGqVhzhqpagTWAB2gTmoE0wHRRjsskAiE7fKDjbax8hXCUBwlWCIFzFIcJVDCNcRTnCVQQiXKVhhGsbIOHaOka4tgIJ15Yg4dqCIVybQ4RrM45wbUoTrk1OtNKnBxGbR1Bi0zcK0ovsCuFqyhGuJhzhao0jXHVwhKt2jnDVQglXTY5w1eAIV3WOcFUDCVdVkHBVAQlXbSDhKgMkXKWDhKtMP1iQ25Pl7afDPnfp0F+67wsyAPpqjwnizo2Cx04BHr4ySGL6yiDmTcr+CX5r7EN+GYN9yC+j8w/5ZRT/kF9Gcg/5ZQT3kF+GUw/5ZRj6kF+Gcg/5ZQj+kF9Ggx/ySx/sQ37pnXvIL70ueMgvPfGH/NKndT/RR+6MXe/pOX2NxfUP+aVzoZjSuVBM6VwopnQuFFM6F4opxYViSnGhmFJcKKYUF4opBYZiSoGhmFJgKKYUGIopBYZiSoGhmJLTOJVsmtZS06LfhQ/5JYDYIAkiNkgCig0Sx2KDxLnYIHEoNkgciw0SB2ODxLHYIHEwNkgcjA0SZ2KDxKHYIDEuNkiMjg0SqxOt9Mleq5uin/Rp0e/6h/ySXGyQJBcbJMnFBklysUGSXGyQJBobJMnFBklysUGSXGyQBBgbJAHGBkmAsUESYGyQBBgbJAHGBknMAyu3pnVtNuBJF+DlH/Lba33Ir+2O6FfHPL5HH/LrPMn/TA/5xeBcADE4F0DsglwAsQtyAcTAXAAxMBdADMsFEGVzAUTBXABRPhdAlM4FEIVzAUTBXADRK3IBRPlcANF54qkeUbn/9HFi/PBpLe8Xv/7+zbfv3y5/+48+/fqLXy8vvh9/mv7ZH75Yfv2Tz//1vy+/vEyt7/48c7t4Da2eo328PvBP/wPY6qPT";
-
-// Sets dest to the placeholder string for the ith element in the json of the blueprint
-int rom_12_placeholder(char dest[8], int i)
-{
-    sprintf(dest, "%d", 0xFF000000 + i);
-    return 0;
-}
-
-// Returns the index of the placeholder if valid, or -1 of not
-int64_t is_rom_12_placeholder(int placeholder)
-{
-    if ((placeholder & 0xFF000000) == 0)
-        return -1;
-
-    if ((placeholder & 0x00FFFFFF) < rom_12_capacity)
-        return placeholder & 0x00FFFFFF;
-    return -1;
-}
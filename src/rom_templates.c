@@ -0,0 +1,12099 @@
+// Generated by src/python/template-registry.py from src/templates, don't edit
+#include "rom_templates.h"
+
+static const char rom_12_json[] =
+    "{\"blueprint\":{\"description\":\"64-value ROM with decimal(0xFF000000 + i) as a placeholder value for the ith word. 409"
+    "6 words. For programming with outside tools.\",\"icons\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"ind"
+    "ex\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-R\"},\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"index\":4}],\"entities\":[{\"enti"
+    "ty_number\":1,\"name\":\"constant-combinator\",\"position\":{\"x\":371.5,\"y\":-50.5},\"control_behavior\":{\"filters\":"
+    "[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16777216,\"index\":1},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-1\"},\"count\":-16777215,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\""
+    "count\":-16777214,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16777213,\"index\":4}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16777212,\"index\":5},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-5\"},\"count\":-16777211,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\""
+    "count\":-16777210,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16777209,\"index\":8}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16777208,\"index\":9},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-9\"},\"count\":-16777207,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\""
+    "count\":-16777206,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16777205,\"index\":1"
+    "2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16777204,\"index\":13},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-D\"},\"count\":-16777203,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\""
+    "},\"count\":-16777202,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16777201,\"index"
+    "\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":3}]}}},{\"entity_number\":2,\"name\":\"constant-combinator\",\""
+    "position\":{\"x\":373.5,\"y\":-50.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\""
+    "},\"count\":-16777184,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16777183,\"index\":2},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16777182,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"iron-ore\"},\"count\":-16777181,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16777"
+    "180,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16777179,\"index\":6},{\"signal\":{"
+    "\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16777178,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron"
+    "-plate\"},\"count\":-16777177,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16777176"
+    ",\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16777175,\"index\":10},{\"signal\":{\"t"
+    "ype\":\"item\",\"name\":\"steel-plate\"},\"count\":-16777174,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"pla"
+    "stic-bar\"},\"count\":-16777173,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16777172,\""
+    "index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16777171,\"index\":14},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"explosives\"},\"count\":-16777170,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil"
+    "-barrel\"},\"count\":-16777169,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":3},{\"entity_id\":5}]}}},"
+    "{\"entity_number\":3,\"name\":\"constant-combinator\",\"position\":{\"x\":372.5,\"y\":-50.5},\"control_behavior\":{\"fil"
+    "ters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16777200,\"index\":1},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-H\"},\"count\":-16777199,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-"
+    "I\"},\"count\":-16777198,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16777197,\"ind"
+    "ex\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16777196,\"index\":5},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-L\"},\"count\":-16777195,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-"
+    "pink\"},\"count\":-16777194,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16777193,\""
+    "index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16777192,\"index\":9},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16777191,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"sig"
+    "nal-Q\"},\"count\":-16777190,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16777189,"
+    "\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16777188,\"index\":13},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16777187,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-U\"},\"count\":-16777186,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-167771"
+    "85,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":1},{\"entity_id\":2}]}}},{\"entity_number\":4,\"name\""
+    ":\"decider-combinator\",\"position\":{\"x\":376,\"y\":-50.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\""
+    ":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":0,\"comparator\":\"=\",\"output_signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":"
+    "[{\"entity_id\":5}],\"green\":[{\"entity_id\":9,\"circuit_id\":1},{\"entity_id\":19,\"circuit_id\":1}]},\"2\":{\"red\":["
+    "{\"entity_id\":9,\"circuit_id\":2},{\"entity_id\":19,\"circuit_id\":2}]}}},{\"entity_number\":5,\"name\":\"constant-comb"
+    "inator\",\"position\":{\"x\":374.5,\"y\":-50.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name"
+    "\":\"heavy-oil-barrel\"},\"count\":-16777168,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},"
+    "\"count\":-16777167,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16777166,\"ind"
+    "ex\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16777165,\"index\":4},{\"signal\":{"
+    "\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16777164,\"index\":5},{\"signal\":{\"type\":\"item\",\"n"
+    "ame\":\"water-barrel\"},\"count\":-16777163,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"cou"
+    "nt\":-16777162,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16777161,\"index\":8},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16777160,\"index\":9},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"empty-barrel\"},\"count\":-16777159,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circu"
+    "it\"},\"count\":-16777158,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-1677715"
+    "7,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16777156,\"index\":13},{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16777155,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"electric-engine-unit\"},\"count\":-16777154,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-fram"
+    "e\"},\"count\":-16777153,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":2},{\"entity_id\":4,\"circuit_i"
+    "d\":1}]}}},{\"entity_number\":6,\"name\":\"constant-combinator\",\"position\":{\"x\":377.5,\"y\":-50.5},\"control_behavi"
+    "or\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16777152,\"index\":1},{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16777151,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-2\"},\"count\":-16777150,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-1677"
+    "7149,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16777148,\"index\":5},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16777147,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-6\"},\"count\":-16777146,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-1677"
+    "7145,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16777144,\"index\":9},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16777143,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-A\"},\"count\":-16777142,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-167"
+    "77141,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16777140,\"index\":13},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16777139,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-E\"},\"count\":-16777138,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":"
+    "-16777137,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":8}]}}},{\"entity_number\":7,\"name\":\"constan"
+    "t-combinator\",\"position\":{\"x\":379.5,\"y\":-50.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\","
+    "\"name\":\"wood\"},\"count\":-16777120,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-1677711"
+    "9,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16777118,\"index\":3},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"iron-ore\"},\"count\":-16777117,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\""
+    "},\"count\":-16777116,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16777115,\"index\""
+    ":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16777114,\"index\":7},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"iron-plate\"},\"count\":-16777113,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"c"
+    "ount\":-16777112,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16777111,\"index\":10},"
+    "{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16777110,\"index\":11},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"plastic-bar\"},\"count\":-16777109,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count"
+    "\":-16777108,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16777107,\"index\":14},{\"sig"
+    "nal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16777106,\"index\":15},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"crude-oil-barrel\"},\"count\":-16777105,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":8},{\"enti"
+    "ty_id\":10}]}}},{\"entity_number\":8,\"name\":\"constant-combinator\",\"position\":{\"x\":378.5,\"y\":-50.5},\"control_b"
+    "ehavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16777136,\"index\":1},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16777135,\"index\":2},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-I\"},\"count\":-16777134,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\""
+    ":-16777133,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16777132,\"index\":5},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16777131,\"index\":6},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-pink\"},\"count\":-16777130,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"coun"
+    "t\":-16777129,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16777128,\"index\":9},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16777127,\"index\":10},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-Q\"},\"count\":-16777126,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"cou"
+    "nt\":-16777125,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16777124,\"index\":13},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16777123,\"index\":14},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-U\"},\"count\":-16777122,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\""
+    "count\":-16777121,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":6},{\"entity_id\":7}]}}},{\"entity_num"
+    "ber\":9,\"name\":\"decider-combinator\",\"position\":{\"x\":382,\"y\":-50.5},\"direction\":2,\"control_behavior\":{\"dec"
+    "ider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":1,\"comparator\":\"=\""
+    ",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\""
+    ":{\"1\":{\"red\":[{\"entity_id\":10}],\"green\":[{\"entity_id\":4,\"circuit_id\":1},{\"entity_id\":29,\"circuit_id\":1}]"
+    "},\"2\":{\"red\":[{\"entity_id\":4,\"circuit_id\":2},{\"entity_id\":29,\"circuit_id\":2}]}}},{\"entity_number\":10,\"nam"
+    "e\":\"constant-combinator\",\"position\":{\"x\":380.5,\"y\":-50.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16777104,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"l"
+    "ight-oil-barrel\"},\"count\":-16777103,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"coun"
+    "t\":-16777102,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16777101,\"index"
+    "\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16777100,\"index\":5},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16777099,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"co"
+    "pper-cable\"},\"count\":-16777098,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-167770"
+    "97,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16777096,\"index\":9},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16777095,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"electronic-circuit\"},\"count\":-16777094,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"}"
+    ",\"count\":-16777093,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16777092,\"in"
+    "dex\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16777091,\"index\":14},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16777090,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"flying-robot-frame\"},\"count\":-16777089,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":7},{\"entit"
+    "y_id\":9,\"circuit_id\":1}]}}},{\"entity_number\":11,\"name\":\"constant-combinator\",\"position\":{\"x\":371.5,\"y\":-4"
+    "8.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16776960,\"i"
+    "ndex\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16776959,\"index\":2},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-2\"},\"count\":-16776958,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-3\"},\"count\":-16776957,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16776956,\"in"
+    "dex\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16776955,\"index\":6},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-6\"},\"count\":-16776954,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-7\"},\"count\":-16776953,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16776952,\"in"
+    "dex\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16776951,\"index\":10},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-A\"},\"count\":-16776950,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signa"
+    "l-B\"},\"count\":-16776949,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16776948,\""
+    "index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16776947,\"index\":14},{\"signal\":{\"ty"
+    "pe\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16776946,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-F\"},\"count\":-16776945,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":14}]}}},{\"entity_number\""
+    ":12,\"name\":\"constant-combinator\",\"position\":{\"x\":371.5,\"y\":-49.5},\"control_behavior\":{\"filters\":[{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16777088,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"nam"
+    "e\":\"signal-1\"},\"count\":-16777087,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-1"
+    "6777086,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16777085,\"index\":4},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16777084,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"nam"
+    "e\":\"signal-5\"},\"count\":-16777083,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-1"
+    "6777082,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16777081,\"index\":8},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16777080,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"nam"
+    "e\":\"signal-9\"},\"count\":-16777079,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-"
+    "16777078,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16777077,\"index\":12},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16777076,\"index\":13},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-D\"},\"count\":-16777075,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\""
+    ":-16777074,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16777073,\"index\":16}]},\""
+    "connections\":{\"1\":{\"red\":[{\"entity_id\":16}]}}},{\"entity_number\":13,\"name\":\"constant-combinator\",\"position\""
+    ":{\"x\":373.5,\"y\":-48.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\""
+    ":-16776928,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16776927,\"index\":2},{\"signal\":{"
+    "\"type\":\"item\",\"name\":\"stone\"},\"count\":-16776926,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-or"
+    "e\"},\"count\":-16776925,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16776924,\"inde"
+    "x\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16776923,\"index\":6},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"raw-fish\"},\"count\":-16776922,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\""
+    "count\":-16776921,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16776920,\"index\":9"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16776919,\"index\":10},{\"signal\":{\"type\":\"item"
+    "\",\"name\":\"steel-plate\"},\"count\":-16776918,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},"
+    "\"count\":-16776917,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16776916,\"index\":13},"
+    "{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16776915,\"index\":14},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"explosives\"},\"count\":-16776914,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\""
+    "count\":-16776913,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":14},{\"entity_id\":18}]}}},{\"entity_n"
+    "umber\":14,\"name\":\"constant-combinator\",\"position\":{\"x\":372.5,\"y\":-48.5},\"control_behavior\":{\"filters\":[{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16776944,\"index\":1},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-H\"},\"count\":-16776943,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"coun"
+    "t\":-16776942,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16776941,\"index\":4},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16776940,\"index\":5},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-L\"},\"count\":-16776939,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"c"
+    "ount\":-16776938,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16776937,\"index\":8},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16776936,\"index\":9},{\"signal\":{\"type\":\"virtua"
+    "l\",\"name\":\"signal-P\"},\"count\":-16776935,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\""
+    "count\":-16776934,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16776933,\"index\":1"
+    "2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16776932,\"index\":13},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-T\"},\"count\":-16776931,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\""
+    "},\"count\":-16776930,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16776929,\"index"
+    "\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":11},{\"entity_id\":13}]}}},{\"entity_number\":15,\"name\":\"con"
+    "stant-combinator\",\"position\":{\"x\":373.5,\"y\":-49.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"wood\"},\"count\":-16777056,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-167"
+    "77055,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16777054,\"index\":3},{\"signal\":{\"ty"
+    "pe\":\"item\",\"name\":\"iron-ore\"},\"count\":-16777053,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-o"
+    "re\"},\"count\":-16777052,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16777051,\"in"
+    "dex\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16777050,\"index\":7},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"iron-plate\"},\"count\":-16777049,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\""
+    "},\"count\":-16777048,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16777047,\"index\""
+    ":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16777046,\"index\":11},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"plastic-bar\"},\"count\":-16777045,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\""
+    "count\":-16777044,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16777043,\"index\":14},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16777042,\"index\":15},{\"signal\":{\"type\":\"item\","
+    "\"name\":\"crude-oil-barrel\"},\"count\":-16777041,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":16},{"
+    "\"entity_id\":20}]}}},{\"entity_number\":16,\"name\":\"constant-combinator\",\"position\":{\"x\":372.5,\"y\":-49.5},\"co"
+    "ntrol_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16777072,\"index\":1}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16777071,\"index\":2},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-I\"},\"count\":-16777070,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\""
+    "count\":-16777069,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16777068,\"index\":5}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16777067,\"index\":6},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-pink\"},\"count\":-16777066,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"}"
+    ",\"count\":-16777065,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16777064,\"index\""
+    ":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16777063,\"index\":10},{\"signal\":{\"type\":\"v"
+    "irtual\",\"name\":\"signal-Q\"},\"count\":-16777062,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\""
+    "},\"count\":-16777061,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16777060,\"index"
+    "\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16777059,\"index\":14},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-U\"},\"count\":-16777058,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-V\"},\"count\":-16777057,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":12},{\"entity_id\":15}]}}},{\""
+    "entity_number\":17,\"name\":\"decider-combinator\",\"position\":{\"x\":376,\"y\":-48.5},\"direction\":2,\"control_behavi"
+    "or\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":4,\"compara"
+    "tor\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"c"
+    "onnections\":{\"1\":{\"red\":[{\"entity_id\":18}],\"green\":[{\"entity_id\":19,\"circuit_id\":1},{\"entity_id\":39,\"cir"
+    "cuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":19,\"circuit_id\":2},{\"entity_id\":39,\"circuit_id\":2}]}}},{\"entity_num"
+    "ber\":18,\"name\":\"constant-combinator\",\"position\":{\"x\":374.5,\"y\":-48.5},\"control_behavior\":{\"filters\":[{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16776912,\"index\":1},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"light-oil-barrel\"},\"count\":-16776911,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-bar"
+    "rel\"},\"count\":-16776910,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-167"
+    "76909,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16776908,\"index\":5},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16776907,\"index\":6},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"copper-cable\"},\"count\":-16776906,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"coun"
+    "t\":-16776905,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16776904,\"index\":9}"
+    ",{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16776903,\"index\":10},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"electronic-circuit\"},\"count\":-16776902,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advance"
+    "d-circuit\"},\"count\":-16776901,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-1"
+    "6776900,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16776899,\"index\":14},{\"sign"
+    "al\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16776898,\"index\":15},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"flying-robot-frame\"},\"count\":-16776897,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\""
+    ":13},{\"entity_id\":17,\"circuit_id\":1}]}}},{\"entity_number\":19,\"name\":\"decider-combinator\",\"position\":{\"x\":3"
+    "76,\"y\":-49.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"n"
+    "ame\":\"signal-check\"},\"constant\":2,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-ev"
+    "erything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":20}],\"green\":[{\"entity_i"
+    "d\":4,\"circuit_id\":1},{\"entity_id\":17,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":4,\"circuit_id\":2},{\"enti"
+    "ty_id\":17,\"circuit_id\":2}]}}},{\"entity_number\":20,\"name\":\"constant-combinator\",\"position\":{\"x\":374.5,\"y\":"
+    "-49.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16777"
+    "040,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16777039,\"index\":2},{\"signa"
+    "l\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16777038,\"index\":3},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"petroleum-gas-barrel\"},\"count\":-16777037,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-aci"
+    "d-barrel\"},\"count\":-16777036,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-167770"
+    "35,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16777034,\"index\":7},{\"signal\":{"
+    "\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16777033,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"ir"
+    "on-gear-wheel\"},\"count\":-16777032,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-1"
+    "6777031,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16777030,\"index\":11},"
+    "{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16777029,\"index\":12},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"processing-unit\"},\"count\":-16777028,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-"
+    "unit\"},\"count\":-16777027,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-1"
+    "6777026,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16777025,\"index\":16}]"
+    "},\"connections\":{\"1\":{\"red\":[{\"entity_id\":15},{\"entity_id\":19,\"circuit_id\":1}]}}},{\"entity_number\":21,\"na"
+    "me\":\"constant-combinator\",\"position\":{\"x\":377.5,\"y\":-48.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"ty"
+    "pe\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16776896,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"si"
+    "gnal-1\"},\"count\":-16776895,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16776894,"
+    "\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16776893,\"index\":4},{\"signal\":{\"ty"
+    "pe\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16776892,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"si"
+    "gnal-5\"},\"count\":-16776891,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16776890,"
+    "\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16776889,\"index\":8},{\"signal\":{\"ty"
+    "pe\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16776888,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"si"
+    "gnal-9\"},\"count\":-16776887,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16776886"
+    ",\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16776885,\"index\":12},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16776884,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-D\"},\"count\":-16776883,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-167768"
+    "82,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16776881,\"index\":16}]},\"connecti"
+    "ons\":{\"1\":{\"red\":[{\"entity_id\":24}]}}},{\"entity_number\":22,\"name\":\"constant-combinator\",\"position\":{\"x\""
+    ":377.5,\"y\":-49.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\""
+    ":-16777024,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16777023,\"index\":2},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16777022,\"index\":3},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-3\"},\"count\":-16777021,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\""
+    ":-16777020,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16777019,\"index\":6},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16777018,\"index\":7},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-7\"},\"count\":-16777017,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\""
+    ":-16777016,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16777015,\"index\":10},{\"si"
+    "gnal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16777014,\"index\":11},{\"signal\":{\"type\":\"virtual\","
+    "\"name\":\"signal-B\"},\"count\":-16777013,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"coun"
+    "t\":-16777012,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16777011,\"index\":14},{"
+    "\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16777010,\"index\":15},{\"signal\":{\"type\":\"virtua"
+    "l\",\"name\":\"signal-F\"},\"count\":-16777009,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":26}]}}},{"
+    "\"entity_number\":23,\"name\":\"constant-combinator\",\"position\":{\"x\":379.5,\"y\":-48.5},\"control_behavior\":{\"fil"
+    "ters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16776864,\"index\":1},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"coal\"},\"count\":-16776863,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16776"
+    "862,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16776861,\"index\":4},{\"signal\":{\"t"
+    "ype\":\"item\",\"name\":\"copper-ore\"},\"count\":-16776860,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"urani"
+    "um-ore\"},\"count\":-16776859,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16776858,\"i"
+    "ndex\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16776857,\"index\":8},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"copper-plate\"},\"count\":-16776856,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fu"
+    "el\"},\"count\":-16776855,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16776854,\"i"
+    "ndex\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16776853,\"index\":12},{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"sulfur\"},\"count\":-16776852,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"}"
+    ",\"count\":-16776851,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16776850,\"index\""
+    ":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16776849,\"index\":16}]},\"connections\":{"
+    "\"1\":{\"red\":[{\"entity_id\":24},{\"entity_id\":28}]}}},{\"entity_number\":24,\"name\":\"constant-combinator\",\"posit"
+    "ion\":{\"x\":378.5,\"y\":-48.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G"
+    "\"},\"count\":-16776880,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16776879,\"inde"
+    "x\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16776878,\"index\":3},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-J\"},\"count\":-16776877,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\""
+    "},\"count\":-16776876,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16776875,\"index\""
+    ":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16776874,\"index\":7},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-N\"},\"count\":-16776873,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\""
+    "},\"count\":-16776872,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16776871,\"index\""
+    ":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16776870,\"index\":11},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-R\"},\"count\":-16776869,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S"
+    "\"},\"count\":-16776868,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16776867,\"ind"
+    "ex\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16776866,\"index\":15},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-V\"},\"count\":-16776865,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":"
+    "21},{\"entity_id\":23}]}}},{\"entity_number\":25,\"name\":\"constant-combinator\",\"position\":{\"x\":379.5,\"y\":-49.5}"
+    ",\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16776992,\"index\":1},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16776991,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"stone\"},\"count\":-16776990,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16776989,\""
+    "index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16776988,\"index\":5},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"uranium-ore\"},\"count\":-16776987,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\""
+    "},\"count\":-16776986,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16776985,\"index\""
+    ":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16776984,\"index\":9},{\"signal\":{\"type\":\"i"
+    "tem\",\"name\":\"solid-fuel\"},\"count\":-16776983,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\""
+    "},\"count\":-16776982,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16776981,\"index"
+    "\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16776980,\"index\":13},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"battery\"},\"count\":-16776979,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"co"
+    "unt\":-16776978,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16776977,\"index\""
+    ":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":26},{\"entity_id\":30}]}}},{\"entity_number\":26,\"name\":\"const"
+    "ant-combinator\",\"position\":{\"x\":378.5,\"y\":-49.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-G\"},\"count\":-16777008,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\""
+    "count\":-16777007,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16777006,\"index\":3}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16777005,\"index\":4},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-K\"},\"count\":-16777004,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\""
+    "count\":-16777003,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16777002,\"index\""
+    ":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16777001,\"index\":8},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-O\"},\"count\":-16777000,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"}"
+    ",\"count\":-16776999,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16776998,\"index\""
+    ":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16776997,\"index\":12},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-S\"},\"count\":-16776996,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T"
+    "\"},\"count\":-16776995,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16776994,\"ind"
+    "ex\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16776993,\"index\":16}]},\"connections\":{\""
+    "1\":{\"red\":[{\"entity_id\":22},{\"entity_id\":25}]}}},{\"entity_number\":27,\"name\":\"decider-combinator\",\"position"
+    "\":{\"x\":382,\"y\":-48.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-check\"},\"constant\":5,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":"
+    "\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":28}],\"green\":["
+    "{\"entity_id\":29,\"circuit_id\":1},{\"entity_id\":49,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":29,\"circuit_id"
+    "\":2},{\"entity_id\":49,\"circuit_id\":2}]}}},{\"entity_number\":28,\"name\":\"constant-combinator\",\"position\":{\"x\""
+    ":380.5,\"y\":-48.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"c"
+    "ount\":-16776848,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16776847,\"index\""
+    ":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16776846,\"index\":3},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16776845,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "sulfuric-acid-barrel\"},\"count\":-16776844,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"cou"
+    "nt\":-16776843,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16776842,\"index\":7},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16776841,\"index\":8},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"iron-gear-wheel\"},\"count\":-16776840,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\""
+    "count\":-16776839,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16776838,\"in"
+    "dex\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16776837,\"index\":12},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16776836,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"engine-unit\"},\"count\":-16776835,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"c"
+    "ount\":-16776834,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16776833,\"ind"
+    "ex\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":23},{\"entity_id\":27,\"circuit_id\":1}]}}},{\"entity_number\""
+    ":29,\"name\":\"decider-combinator\",\"position\":{\"x\":382,\"y\":-49.5},\"direction\":2,\"control_behavior\":{\"decider"
+    "_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":3,\"comparator\":\"=\",\"o"
+    "utput_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\""
+    "1\":{\"red\":[{\"entity_id\":30}],\"green\":[{\"entity_id\":9,\"circuit_id\":1},{\"entity_id\":27,\"circuit_id\":1}]},\""
+    "2\":{\"red\":[{\"entity_id\":9,\"circuit_id\":2},{\"entity_id\":27,\"circuit_id\":2}]}}},{\"entity_number\":30,\"name\":"
+    "\"constant-combinator\",\"position\":{\"x\":380.5,\"y\":-49.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16776976,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light"
+    "-oil-barrel\"},\"count\":-16776975,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":"
+    "-16776974,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16776973,\"index\":4"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16776972,\"index\":5},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"water-barrel\"},\"count\":-16776971,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper"
+    "-cable\"},\"count\":-16776970,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16776969,\""
+    "index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16776968,\"index\":9},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16776967,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"e"
+    "lectronic-circuit\"},\"count\":-16776966,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"c"
+    "ount\":-16776965,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16776964,\"index\""
+    ":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16776963,\"index\":14},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"electric-engine-unit\"},\"count\":-16776962,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"fl"
+    "ying-robot-frame\"},\"count\":-16776961,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":25},{\"entity_id"
+    "\":29,\"circuit_id\":1}]}}},{\"entity_number\":31,\"name\":\"constant-combinator\",\"position\":{\"x\":371.5,\"y\":-46.5"
+    "},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16776704,\"inde"
+    "x\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16776703,\"index\":2},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-2\"},\"count\":-16776702,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\""
+    "},\"count\":-16776701,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16776700,\"index\""
+    ":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16776699,\"index\":6},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-6\"},\"count\":-16776698,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"}"
+    ",\"count\":-16776697,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16776696,\"index\""
+    ":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16776695,\"index\":10},{\"signal\":{\"type\":\"v"
+    "irtual\",\"name\":\"signal-A\"},\"count\":-16776694,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\""
+    "},\"count\":-16776693,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16776692,\"index"
+    "\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16776691,\"index\":14},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-E\"},\"count\":-16776690,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-F\"},\"count\":-16776689,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":34}]}}},{\"entity_number\":32,"
+    "\"name\":\"constant-combinator\",\"position\":{\"x\":371.5,\"y\":-47.5},\"control_behavior\":{\"filters\":[{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16776832,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":"
+    "\"signal-1\"},\"count\":-16776831,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16776"
+    "830,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16776829,\"index\":4},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16776828,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":"
+    "\"signal-5\"},\"count\":-16776827,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16776"
+    "826,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16776825,\"index\":8},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16776824,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":"
+    "\"signal-9\"},\"count\":-16776823,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-1677"
+    "6822,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16776821,\"index\":12},{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16776820,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name"
+    "\":\"signal-D\"},\"count\":-16776819,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-1"
+    "6776818,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16776817,\"index\":16}]},\"con"
+    "nections\":{\"1\":{\"red\":[{\"entity_id\":36}]}}},{\"entity_number\":33,\"name\":\"constant-combinator\",\"position\":{"
+    "\"x\":373.5,\"y\":-46.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":"
+    "-16776672,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16776671,\"index\":2},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"stone\"},\"count\":-16776670,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\""
+    "},\"count\":-16776669,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16776668,\"index\""
+    ":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16776667,\"index\":6},{\"signal\":{\"type\":\"it"
+    "em\",\"name\":\"raw-fish\"},\"count\":-16776666,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"c"
+    "ount\":-16776665,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16776664,\"index\":9}"
+    ",{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16776663,\"index\":10},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"steel-plate\"},\"count\":-16776662,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\""
+    "count\":-16776661,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16776660,\"index\":13},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16776659,\"index\":14},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"explosives\"},\"count\":-16776658,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"co"
+    "unt\":-16776657,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":34},{\"entity_id\":38}]}}},{\"entity_num"
+    "ber\":34,\"name\":\"constant-combinator\",\"position\":{\"x\":372.5,\"y\":-46.5},\"control_behavior\":{\"filters\":[{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16776688,\"index\":1},{\"signal\":{\"type\":\"virtual\","
+    "\"name\":\"signal-H\"},\"count\":-16776687,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count"
+    "\":-16776686,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16776685,\"index\":4},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16776684,\"index\":5},{\"signal\":{\"type\":\"virtual\","
+    "\"name\":\"signal-L\"},\"count\":-16776683,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"co"
+    "unt\":-16776682,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16776681,\"index\":8},{"
+    "\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16776680,\"index\":9},{\"signal\":{\"type\":\"virtual"
+    "\",\"name\":\"signal-P\"},\"count\":-16776679,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"c"
+    "ount\":-16776678,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16776677,\"index\":12"
+    "},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16776676,\"index\":13},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-T\"},\"count\":-16776675,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"}"
+    ",\"count\":-16776674,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16776673,\"index\""
+    ":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":31},{\"entity_id\":33}]}}},{\"entity_number\":35,\"name\":\"const"
+    "ant-combinator\",\"position\":{\"x\":373.5,\"y\":-47.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"wood\"},\"count\":-16776800,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-167767"
+    "99,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16776798,\"index\":3},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"iron-ore\"},\"count\":-16776797,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\""
+    "},\"count\":-16776796,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16776795,\"index\""
+    ":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16776794,\"index\":7},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"iron-plate\"},\"count\":-16776793,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"c"
+    "ount\":-16776792,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16776791,\"index\":10},"
+    "{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16776790,\"index\":11},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"plastic-bar\"},\"count\":-16776789,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count"
+    "\":-16776788,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16776787,\"index\":14},{\"sig"
+    "nal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16776786,\"index\":15},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"crude-oil-barrel\"},\"count\":-16776785,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":36},{\"ent"
+    "ity_id\":40}]}}},{\"entity_number\":36,\"name\":\"constant-combinator\",\"position\":{\"x\":372.5,\"y\":-47.5},\"control"
+    "_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16776816,\"index\":1},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16776815,\"index\":2},{\"signal\":{\"type\":\"virtual\","
+    "\"name\":\"signal-I\"},\"count\":-16776814,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count"
+    "\":-16776813,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16776812,\"index\":5},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16776811,\"index\":6},{\"signal\":{\"type\":\"virtual\","
+    "\"name\":\"signal-pink\"},\"count\":-16776810,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"co"
+    "unt\":-16776809,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16776808,\"index\":9},{"
+    "\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16776807,\"index\":10},{\"signal\":{\"type\":\"virtua"
+    "l\",\"name\":\"signal-Q\"},\"count\":-16776806,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\""
+    "count\":-16776805,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16776804,\"index\":1"
+    "3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16776803,\"index\":14},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-U\"},\"count\":-16776802,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\""
+    "},\"count\":-16776801,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":32},{\"entity_id\":35}]}}},{\"enti"
+    "ty_number\":37,\"name\":\"decider-combinator\",\"position\":{\"x\":376,\"y\":-46.5},\"direction\":2,\"control_behavior\""
+    ":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":8,\"comparator\""
+    ":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connec"
+    "tions\":{\"1\":{\"red\":[{\"entity_id\":38}],\"green\":[{\"entity_id\":39,\"circuit_id\":1},{\"entity_id\":59,\"circuit_"
+    "id\":1}]},\"2\":{\"red\":[{\"entity_id\":39,\"circuit_id\":2},{\"entity_id\":59,\"circuit_id\":2}]}}},{\"entity_number\""
+    ":38,\"name\":\"constant-combinator\",\"position\":{\"x\":374.5,\"y\":-46.5},\"control_behavior\":{\"filters\":[{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16776656,\"index\":1},{\"signal\":{\"type\":\"item\",\"n"
+    "ame\":\"light-oil-barrel\"},\"count\":-16776655,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\""
+    "},\"count\":-16776654,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16776653"
+    ",\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16776652,\"index\":5},{\"sign"
+    "al\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16776651,\"index\":6},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"copper-cable\"},\"count\":-16776650,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\""
+    ":-16776649,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16776648,\"index\":9},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16776647,\"index\":10},{\"signal\":{\"type\":\"item\","
+    "\"name\":\"electronic-circuit\"},\"count\":-16776646,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-ci"
+    "rcuit\"},\"count\":-16776645,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16776"
+    "644,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16776643,\"index\":14},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16776642,\"index\":15},{\"signal\":{\"type\":\"item\","
+    "\"name\":\"flying-robot-frame\"},\"count\":-16776641,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":33}"
+    ",{\"entity_id\":37,\"circuit_id\":1}]}}},{\"entity_number\":39,\"name\":\"decider-combinator\",\"position\":{\"x\":376,\""
+    "y\":-47.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-check\"},\"constant\":6,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everyth"
+    "ing\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":40}],\"green\":[{\"entity_id\":1"
+    "7,\"circuit_id\":1},{\"entity_id\":37,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":17,\"circuit_id\":2},{\"entity_"
+    "id\":37,\"circuit_id\":2}]}}},{\"entity_number\":40,\"name\":\"constant-combinator\",\"position\":{\"x\":374.5,\"y\":-47"
+    ".5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16776784"
+    ",\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16776783,\"index\":2},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16776782,\"index\":3},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"petroleum-gas-barrel\"},\"count\":-16776781,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-b"
+    "arrel\"},\"count\":-16776780,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16776779,"
+    "\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16776778,\"index\":7},{\"signal\":{\"t"
+    "ype\":\"item\",\"name\":\"iron-stick\"},\"count\":-16776777,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-"
+    "gear-wheel\"},\"count\":-16776776,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-1677"
+    "6775,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16776774,\"index\":11},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16776773,\"index\":12},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"processing-unit\"},\"count\":-16776772,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-uni"
+    "t\"},\"count\":-16776771,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-1677"
+    "6770,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16776769,\"index\":16}]},\""
+    "connections\":{\"1\":{\"red\":[{\"entity_id\":35},{\"entity_id\":39,\"circuit_id\":1}]}}},{\"entity_number\":41,\"name\""
+    ":\"constant-combinator\",\"position\":{\"x\":377.5,\"y\":-46.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-0\"},\"count\":-16776640,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-1\"},\"count\":-16776639,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16776638,\"in"
+    "dex\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16776637,\"index\":4},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-4\"},\"count\":-16776636,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-5\"},\"count\":-16776635,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16776634,\"in"
+    "dex\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16776633,\"index\":8},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-8\"},\"count\":-16776632,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-9\"},\"count\":-16776631,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16776630,\"i"
+    "ndex\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16776629,\"index\":12},{\"signal\":{\"typ"
+    "e\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16776628,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"si"
+    "gnal-D\"},\"count\":-16776627,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16776626"
+    ",\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16776625,\"index\":16}]},\"connection"
+    "s\":{\"1\":{\"red\":[{\"entity_id\":44}]}}},{\"entity_number\":42,\"name\":\"constant-combinator\",\"position\":{\"x\":3"
+    "77.5,\"y\":-47.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":"
+    "-16776768,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16776767,\"index\":2},{\"sign"
+    "al\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16776766,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"n"
+    "ame\":\"signal-3\"},\"count\":-16776765,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":"
+    "-16776764,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16776763,\"index\":6},{\"sign"
+    "al\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16776762,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"n"
+    "ame\":\"signal-7\"},\"count\":-16776761,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":"
+    "-16776760,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16776759,\"index\":10},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16776758,\"index\":11},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-B\"},\"count\":-16776757,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\""
+    ":-16776756,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16776755,\"index\":14},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16776754,\"index\":15},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-F\"},\"count\":-16776753,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":46}]}}},{\"e"
+    "ntity_number\":43,\"name\":\"constant-combinator\",\"position\":{\"x\":379.5,\"y\":-46.5},\"control_behavior\":{\"filter"
+    "s\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16776608,\"index\":1},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"coal\"},\"count\":-16776607,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16776606"
+    ",\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16776605,\"index\":4},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"copper-ore\"},\"count\":-16776604,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-"
+    "ore\"},\"count\":-16776603,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16776602,\"inde"
+    "x\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16776601,\"index\":8},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"copper-plate\"},\"count\":-16776600,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\""
+    "},\"count\":-16776599,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16776598,\"index"
+    "\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16776597,\"index\":12},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"sulfur\"},\"count\":-16776596,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"c"
+    "ount\":-16776595,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16776594,\"index\":15}"
+    ",{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16776593,\"index\":16}]},\"connections\":{\"1\""
+    ":{\"red\":[{\"entity_id\":44},{\"entity_id\":48}]}}},{\"entity_number\":44,\"name\":\"constant-combinator\",\"position\""
+    ":{\"x\":378.5,\"y\":-46.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\""
+    "count\":-16776624,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16776623,\"index\":2}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16776622,\"index\":3},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-J\"},\"count\":-16776621,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\""
+    "count\":-16776620,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16776619,\"index\":6}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16776618,\"index\":7},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-N\"},\"count\":-16776617,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"}"
+    ",\"count\":-16776616,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16776615,\"index\""
+    ":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16776614,\"index\":11},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-R\"},\"count\":-16776613,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S"
+    "\"},\"count\":-16776612,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16776611,\"ind"
+    "ex\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16776610,\"index\":15},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-V\"},\"count\":-16776609,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":"
+    "41},{\"entity_id\":43}]}}},{\"entity_number\":45,\"name\":\"constant-combinator\",\"position\":{\"x\":379.5,\"y\":-47.5}"
+    ",\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16776736,\"index\":1},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16776735,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"stone\"},\"count\":-16776734,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16776733,\""
+    "index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16776732,\"index\":5},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"uranium-ore\"},\"count\":-16776731,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\""
+    "},\"count\":-16776730,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16776729,\"index\""
+    ":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16776728,\"index\":9},{\"signal\":{\"type\":\"i"
+    "tem\",\"name\":\"solid-fuel\"},\"count\":-16776727,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\""
+    "},\"count\":-16776726,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16776725,\"index"
+    "\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16776724,\"index\":13},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"battery\"},\"count\":-16776723,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"co"
+    "unt\":-16776722,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16776721,\"index\""
+    ":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":46},{\"entity_id\":50}]}}},{\"entity_number\":46,\"name\":\"const"
+    "ant-combinator\",\"position\":{\"x\":378.5,\"y\":-47.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-G\"},\"count\":-16776752,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\""
+    "count\":-16776751,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16776750,\"index\":3}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16776749,\"index\":4},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-K\"},\"count\":-16776748,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\""
+    "count\":-16776747,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16776746,\"index\""
+    ":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16776745,\"index\":8},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-O\"},\"count\":-16776744,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"}"
+    ",\"count\":-16776743,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16776742,\"index\""
+    ":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16776741,\"index\":12},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-S\"},\"count\":-16776740,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T"
+    "\"},\"count\":-16776739,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16776738,\"ind"
+    "ex\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16776737,\"index\":16}]},\"connections\":{\""
+    "1\":{\"red\":[{\"entity_id\":42},{\"entity_id\":45}]}}},{\"entity_number\":47,\"name\":\"decider-combinator\",\"position"
+    "\":{\"x\":382,\"y\":-46.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-check\"},\"constant\":9,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":"
+    "\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":48}],\"green\":["
+    "{\"entity_id\":49,\"circuit_id\":1},{\"entity_id\":69,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":49,\"circuit_id"
+    "\":2},{\"entity_id\":69,\"circuit_id\":2}]}}},{\"entity_number\":48,\"name\":\"constant-combinator\",\"position\":{\"x\""
+    ":380.5,\"y\":-46.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"c"
+    "ount\":-16776592,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16776591,\"index\""
+    ":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16776590,\"index\":3},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16776589,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "sulfuric-acid-barrel\"},\"count\":-16776588,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"cou"
+    "nt\":-16776587,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16776586,\"index\":7},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16776585,\"index\":8},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"iron-gear-wheel\"},\"count\":-16776584,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\""
+    "count\":-16776583,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16776582,\"in"
+    "dex\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16776581,\"index\":12},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16776580,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"engine-unit\"},\"count\":-16776579,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"c"
+    "ount\":-16776578,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16776577,\"ind"
+    "ex\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":43},{\"entity_id\":47,\"circuit_id\":1}]}}},{\"entity_number\""
+    ":49,\"name\":\"decider-combinator\",\"position\":{\"x\":382,\"y\":-47.5},\"direction\":2,\"control_behavior\":{\"decider"
+    "_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":7,\"comparator\":\"=\",\"o"
+    "utput_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\""
+    "1\":{\"red\":[{\"entity_id\":50}],\"green\":[{\"entity_id\":27,\"circuit_id\":1},{\"entity_id\":47,\"circuit_id\":1}]},\""
+    "2\":{\"red\":[{\"entity_id\":27,\"circuit_id\":2},{\"entity_id\":47,\"circuit_id\":2}]}}},{\"entity_number\":50,\"name\""
+    ":\"constant-combinator\",\"position\":{\"x\":380.5,\"y\":-47.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16776720,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"ligh"
+    "t-oil-barrel\"},\"count\":-16776719,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\""
+    ":-16776718,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16776717,\"index\":"
+    "4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16776716,\"index\":5},{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"water-barrel\"},\"count\":-16776715,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"coppe"
+    "r-cable\"},\"count\":-16776714,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16776713,"
+    "\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16776712,\"index\":9},{\"signal\":{"
+    "\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16776711,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "electronic-circuit\"},\"count\":-16776710,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\""
+    "count\":-16776709,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16776708,\"index"
+    "\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16776707,\"index\":14},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16776706,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "flying-robot-frame\"},\"count\":-16776705,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":45},{\"entity_"
+    "id\":49,\"circuit_id\":1}]}}},{\"entity_number\":51,\"name\":\"constant-combinator\",\"position\":{\"x\":371.5,\"y\":-44"
+    ".5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16776448,\"in"
+    "dex\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16776447,\"index\":2},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-2\"},\"count\":-16776446,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-3\"},\"count\":-16776445,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16776444,\"in"
+    "dex\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16776443,\"index\":6},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-6\"},\"count\":-16776442,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-7\"},\"count\":-16776441,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16776440,\"in"
+    "dex\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16776439,\"index\":10},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-A\"},\"count\":-16776438,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signa"
+    "l-B\"},\"count\":-16776437,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16776436,\""
+    "index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16776435,\"index\":14},{\"signal\":{\"ty"
+    "pe\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16776434,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-F\"},\"count\":-16776433,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":54}]}}},{\"entity_number\""
+    ":52,\"name\":\"constant-combinator\",\"position\":{\"x\":371.5,\"y\":-45.5},\"control_behavior\":{\"filters\":[{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16776576,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"nam"
+    "e\":\"signal-1\"},\"count\":-16776575,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-1"
+    "6776574,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16776573,\"index\":4},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16776572,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"nam"
+    "e\":\"signal-5\"},\"count\":-16776571,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-1"
+    "6776570,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16776569,\"index\":8},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16776568,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"nam"
+    "e\":\"signal-9\"},\"count\":-16776567,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-"
+    "16776566,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16776565,\"index\":12},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16776564,\"index\":13},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-D\"},\"count\":-16776563,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\""
+    ":-16776562,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16776561,\"index\":16}]},\""
+    "connections\":{\"1\":{\"red\":[{\"entity_id\":56}]}}},{\"entity_number\":53,\"name\":\"constant-combinator\",\"position\""
+    ":{\"x\":373.5,\"y\":-44.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\""
+    ":-16776416,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16776415,\"index\":2},{\"signal\":{"
+    "\"type\":\"item\",\"name\":\"stone\"},\"count\":-16776414,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-or"
+    "e\"},\"count\":-16776413,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16776412,\"inde"
+    "x\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16776411,\"index\":6},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"raw-fish\"},\"count\":-16776410,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\""
+    "count\":-16776409,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16776408,\"index\":9"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16776407,\"index\":10},{\"signal\":{\"type\":\"item"
+    "\",\"name\":\"steel-plate\"},\"count\":-16776406,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},"
+    "\"count\":-16776405,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16776404,\"index\":13},"
+    "{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16776403,\"index\":14},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"explosives\"},\"count\":-16776402,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\""
+    "count\":-16776401,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":54},{\"entity_id\":58}]}}},{\"entity_n"
+    "umber\":54,\"name\":\"constant-combinator\",\"position\":{\"x\":372.5,\"y\":-44.5},\"control_behavior\":{\"filters\":[{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16776432,\"index\":1},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-H\"},\"count\":-16776431,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"coun"
+    "t\":-16776430,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16776429,\"index\":4},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16776428,\"index\":5},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-L\"},\"count\":-16776427,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"c"
+    "ount\":-16776426,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16776425,\"index\":8},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16776424,\"index\":9},{\"signal\":{\"type\":\"virtua"
+    "l\",\"name\":\"signal-P\"},\"count\":-16776423,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\""
+    "count\":-16776422,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16776421,\"index\":1"
+    "2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16776420,\"index\":13},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-T\"},\"count\":-16776419,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\""
+    "},\"count\":-16776418,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16776417,\"index"
+    "\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":51},{\"entity_id\":53}]}}},{\"entity_number\":55,\"name\":\"con"
+    "stant-combinator\",\"position\":{\"x\":373.5,\"y\":-45.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"wood\"},\"count\":-16776544,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-167"
+    "76543,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16776542,\"index\":3},{\"signal\":{\"ty"
+    "pe\":\"item\",\"name\":\"iron-ore\"},\"count\":-16776541,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-o"
+    "re\"},\"count\":-16776540,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16776539,\"in"
+    "dex\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16776538,\"index\":7},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"iron-plate\"},\"count\":-16776537,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\""
+    "},\"count\":-16776536,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16776535,\"index\""
+    ":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16776534,\"index\":11},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"plastic-bar\"},\"count\":-16776533,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\""
+    "count\":-16776532,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16776531,\"index\":14},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16776530,\"index\":15},{\"signal\":{\"type\":\"item\","
+    "\"name\":\"crude-oil-barrel\"},\"count\":-16776529,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":56},{"
+    "\"entity_id\":60}]}}},{\"entity_number\":56,\"name\":\"constant-combinator\",\"position\":{\"x\":372.5,\"y\":-45.5},\"co"
+    "ntrol_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16776560,\"index\":1}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16776559,\"index\":2},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-I\"},\"count\":-16776558,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\""
+    "count\":-16776557,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16776556,\"index\":5}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16776555,\"index\":6},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-pink\"},\"count\":-16776554,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"}"
+    ",\"count\":-16776553,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16776552,\"index\""
+    ":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16776551,\"index\":10},{\"signal\":{\"type\":\"v"
+    "irtual\",\"name\":\"signal-Q\"},\"count\":-16776550,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\""
+    "},\"count\":-16776549,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16776548,\"index"
+    "\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16776547,\"index\":14},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-U\"},\"count\":-16776546,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-V\"},\"count\":-16776545,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":52},{\"entity_id\":55}]}}},{\""
+    "entity_number\":57,\"name\":\"decider-combinator\",\"position\":{\"x\":376,\"y\":-44.5},\"direction\":2,\"control_behavi"
+    "or\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":12,\"compar"
+    "ator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\""
+    "connections\":{\"1\":{\"red\":[{\"entity_id\":58}],\"green\":[{\"entity_id\":59,\"circuit_id\":1},{\"entity_id\":79,\"ci"
+    "rcuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":59,\"circuit_id\":2},{\"entity_id\":79,\"circuit_id\":2}]}}},{\"entity_nu"
+    "mber\":58,\"name\":\"constant-combinator\",\"position\":{\"x\":374.5,\"y\":-44.5},\"control_behavior\":{\"filters\":[{\""
+    "signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16776400,\"index\":1},{\"signal\":{\"type\":\"item"
+    "\",\"name\":\"light-oil-barrel\"},\"count\":-16776399,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-b"
+    "arrel\"},\"count\":-16776398,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-1"
+    "6776397,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16776396,\"index\":5},"
+    "{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16776395,\"index\":6},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"copper-cable\"},\"count\":-16776394,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"c"
+    "ount\":-16776393,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16776392,\"index\""
+    ":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16776391,\"index\":10},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"electronic-circuit\"},\"count\":-16776390,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"adva"
+    "nced-circuit\"},\"count\":-16776389,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\""
+    ":-16776388,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16776387,\"index\":14},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16776386,\"index\":15},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"flying-robot-frame\"},\"count\":-16776385,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_i"
+    "d\":53},{\"entity_id\":57,\"circuit_id\":1}]}}},{\"entity_number\":59,\"name\":\"decider-combinator\",\"position\":{\"x\""
+    ":376,\"y\":-45.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-check\"},\"constant\":10,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-"
+    "everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":60}],\"green\":[{\"entity"
+    "_id\":37,\"circuit_id\":1},{\"entity_id\":57,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":37,\"circuit_id\":2},{\""
+    "entity_id\":57,\"circuit_id\":2}]}}},{\"entity_number\":60,\"name\":\"constant-combinator\",\"position\":{\"x\":374.5,\""
+    "y\":-45.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-1"
+    "6776528,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16776527,\"index\":2},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16776526,\"index\":3},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"petroleum-gas-barrel\"},\"count\":-16776525,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-"
+    "acid-barrel\"},\"count\":-16776524,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-167"
+    "76523,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16776522,\"index\":7},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16776521,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "iron-gear-wheel\"},\"count\":-16776520,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":"
+    "-16776519,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16776518,\"index\":11"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16776517,\"index\":12},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"processing-unit\"},\"count\":-16776516,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engin"
+    "e-unit\"},\"count\":-16776515,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":"
+    "-16776514,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16776513,\"index\":16"
+    "}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":55},{\"entity_id\":59,\"circuit_id\":1}]}}},{\"entity_number\":61,\""
+    "name\":\"constant-combinator\",\"position\":{\"x\":377.5,\"y\":-44.5},\"control_behavior\":{\"filters\":[{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16776384,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-1\"},\"count\":-16776383,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-1677638"
+    "2,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16776381,\"index\":4},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16776380,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-5\"},\"count\":-16776379,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-1677637"
+    "8,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16776377,\"index\":8},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16776376,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-9\"},\"count\":-16776375,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-167763"
+    "74,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16776373,\"index\":12},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16776372,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-D\"},\"count\":-16776371,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-167"
+    "76370,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16776369,\"index\":16}]},\"conne"
+    "ctions\":{\"1\":{\"red\":[{\"entity_id\":64}]}}},{\"entity_number\":62,\"name\":\"constant-combinator\",\"position\":{\""
+    "x\":377.5,\"y\":-45.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"cou"
+    "nt\":-16776512,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16776511,\"index\":2},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16776510,\"index\":3},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-3\"},\"count\":-16776509,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"coun"
+    "t\":-16776508,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16776507,\"index\":6},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16776506,\"index\":7},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-7\"},\"count\":-16776505,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"coun"
+    "t\":-16776504,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16776503,\"index\":10},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16776502,\"index\":11},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-B\"},\"count\":-16776501,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"cou"
+    "nt\":-16776500,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16776499,\"index\":14},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16776498,\"index\":15},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-F\"},\"count\":-16776497,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":66}]}}},"
+    "{\"entity_number\":63,\"name\":\"constant-combinator\",\"position\":{\"x\":379.5,\"y\":-44.5},\"control_behavior\":{\"fi"
+    "lters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16776352,\"index\":1},{\"signal\":{\"type\":\"item"
+    "\",\"name\":\"coal\"},\"count\":-16776351,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-167"
+    "76350,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16776349,\"index\":4},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16776348,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uran"
+    "ium-ore\"},\"count\":-16776347,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16776346,\""
+    "index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16776345,\"index\":8},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"copper-plate\"},\"count\":-16776344,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fu"
+    "el\"},\"count\":-16776343,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16776342,\"i"
+    "ndex\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16776341,\"index\":12},{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"sulfur\"},\"count\":-16776340,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"}"
+    ",\"count\":-16776339,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16776338,\"index\""
+    ":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16776337,\"index\":16}]},\"connections\":{"
+    "\"1\":{\"red\":[{\"entity_id\":64},{\"entity_id\":68}]}}},{\"entity_number\":64,\"name\":\"constant-combinator\",\"posit"
+    "ion\":{\"x\":378.5,\"y\":-44.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G"
+    "\"},\"count\":-16776368,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16776367,\"inde"
+    "x\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16776366,\"index\":3},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-J\"},\"count\":-16776365,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\""
+    "},\"count\":-16776364,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16776363,\"index\""
+    ":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16776362,\"index\":7},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-N\"},\"count\":-16776361,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\""
+    "},\"count\":-16776360,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16776359,\"index\""
+    ":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16776358,\"index\":11},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-R\"},\"count\":-16776357,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S"
+    "\"},\"count\":-16776356,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16776355,\"ind"
+    "ex\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16776354,\"index\":15},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-V\"},\"count\":-16776353,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":"
+    "61},{\"entity_id\":63}]}}},{\"entity_number\":65,\"name\":\"constant-combinator\",\"position\":{\"x\":379.5,\"y\":-45.5}"
+    ",\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16776480,\"index\":1},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16776479,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"stone\"},\"count\":-16776478,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16776477,\""
+    "index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16776476,\"index\":5},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"uranium-ore\"},\"count\":-16776475,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\""
+    "},\"count\":-16776474,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16776473,\"index\""
+    ":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16776472,\"index\":9},{\"signal\":{\"type\":\"i"
+    "tem\",\"name\":\"solid-fuel\"},\"count\":-16776471,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\""
+    "},\"count\":-16776470,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16776469,\"index"
+    "\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16776468,\"index\":13},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"battery\"},\"count\":-16776467,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"co"
+    "unt\":-16776466,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16776465,\"index\""
+    ":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":66},{\"entity_id\":70}]}}},{\"entity_number\":66,\"name\":\"const"
+    "ant-combinator\",\"position\":{\"x\":378.5,\"y\":-45.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-G\"},\"count\":-16776496,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\""
+    "count\":-16776495,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16776494,\"index\":3}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16776493,\"index\":4},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-K\"},\"count\":-16776492,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\""
+    "count\":-16776491,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16776490,\"index\""
+    ":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16776489,\"index\":8},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-O\"},\"count\":-16776488,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"}"
+    ",\"count\":-16776487,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16776486,\"index\""
+    ":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16776485,\"index\":12},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-S\"},\"count\":-16776484,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T"
+    "\"},\"count\":-16776483,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16776482,\"ind"
+    "ex\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16776481,\"index\":16}]},\"connections\":{\""
+    "1\":{\"red\":[{\"entity_id\":62},{\"entity_id\":65}]}}},{\"entity_number\":67,\"name\":\"decider-combinator\",\"position"
+    "\":{\"x\":382,\"y\":-44.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-check\"},\"constant\":13,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":68}],\"green\":"
+    "[{\"entity_id\":69,\"circuit_id\":1},{\"entity_id\":89,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":69,\"circuit_i"
+    "d\":2},{\"entity_id\":89,\"circuit_id\":2}]}}},{\"entity_number\":68,\"name\":\"constant-combinator\",\"position\":{\"x\""
+    ":380.5,\"y\":-44.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"c"
+    "ount\":-16776336,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16776335,\"index\""
+    ":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16776334,\"index\":3},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16776333,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "sulfuric-acid-barrel\"},\"count\":-16776332,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"cou"
+    "nt\":-16776331,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16776330,\"index\":7},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16776329,\"index\":8},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"iron-gear-wheel\"},\"count\":-16776328,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\""
+    "count\":-16776327,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16776326,\"in"
+    "dex\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16776325,\"index\":12},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16776324,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"engine-unit\"},\"count\":-16776323,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"c"
+    "ount\":-16776322,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16776321,\"ind"
+    "ex\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":63},{\"entity_id\":67,\"circuit_id\":1}]}}},{\"entity_number\""
+    ":69,\"name\":\"decider-combinator\",\"position\":{\"x\":382,\"y\":-45.5},\"direction\":2,\"control_behavior\":{\"decider"
+    "_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":11,\"comparator\":\"=\",\""
+    "output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{"
+    "\"1\":{\"red\":[{\"entity_id\":70}],\"green\":[{\"entity_id\":47,\"circuit_id\":1},{\"entity_id\":67,\"circuit_id\":1}]}"
+    ",\"2\":{\"red\":[{\"entity_id\":47,\"circuit_id\":2},{\"entity_id\":67,\"circuit_id\":2}]}}},{\"entity_number\":70,\"nam"
+    "e\":\"constant-combinator\",\"position\":{\"x\":380.5,\"y\":-45.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16776464,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"l"
+    "ight-oil-barrel\"},\"count\":-16776463,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"coun"
+    "t\":-16776462,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16776461,\"index"
+    "\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16776460,\"index\":5},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16776459,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"co"
+    "pper-cable\"},\"count\":-16776458,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-167764"
+    "57,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16776456,\"index\":9},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16776455,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"electronic-circuit\"},\"count\":-16776454,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"}"
+    ",\"count\":-16776453,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16776452,\"in"
+    "dex\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16776451,\"index\":14},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16776450,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"flying-robot-frame\"},\"count\":-16776449,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":65},{\"enti"
+    "ty_id\":69,\"circuit_id\":1}]}}},{\"entity_number\":71,\"name\":\"constant-combinator\",\"position\":{\"x\":371.5,\"y\":"
+    "-42.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16776192,\""
+    "index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16776191,\"index\":2},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16776190,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-3\"},\"count\":-16776189,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16776188,\""
+    "index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16776187,\"index\":6},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16776186,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-7\"},\"count\":-16776185,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16776184,\""
+    "index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16776183,\"index\":10},{\"signal\":{\"typ"
+    "e\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16776182,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"si"
+    "gnal-B\"},\"count\":-16776181,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16776180"
+    ",\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16776179,\"index\":14},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16776178,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-F\"},\"count\":-16776177,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":74}]}}},{\"entity_number"
+    "\":72,\"name\":\"constant-combinator\",\"position\":{\"x\":371.5,\"y\":-43.5},\"control_behavior\":{\"filters\":[{\"sign"
+    "al\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16776320,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"n"
+    "ame\":\"signal-1\"},\"count\":-16776319,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":"
+    "-16776318,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16776317,\"index\":4},{\"sign"
+    "al\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16776316,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"n"
+    "ame\":\"signal-5\"},\"count\":-16776315,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":"
+    "-16776314,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16776313,\"index\":8},{\"sign"
+    "al\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16776312,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"n"
+    "ame\":\"signal-9\"},\"count\":-16776311,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\""
+    ":-16776310,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16776309,\"index\":12},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16776308,\"index\":13},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-D\"},\"count\":-16776307,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"cou"
+    "nt\":-16776306,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16776305,\"index\":16}]"
+    "},\"connections\":{\"1\":{\"red\":[{\"entity_id\":76}]}}},{\"entity_number\":73,\"name\":\"constant-combinator\",\"posit"
+    "ion\":{\"x\":373.5,\"y\":-42.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"c"
+    "ount\":-16776160,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16776159,\"index\":2},{\"sign"
+    "al\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16776158,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"i"
+    "ron-ore\"},\"count\":-16776157,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16776156,"
+    "\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16776155,\"index\":6},{\"signal\":{\"ty"
+    "pe\":\"item\",\"name\":\"raw-fish\"},\"count\":-16776154,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-pla"
+    "te\"},\"count\":-16776153,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16776152,\"i"
+    "ndex\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16776151,\"index\":10},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"steel-plate\"},\"count\":-16776150,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-"
+    "bar\"},\"count\":-16776149,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16776148,\"index"
+    "\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16776147,\"index\":14},{\"signal\":{\"type\":\"it"
+    "em\",\"name\":\"explosives\"},\"count\":-16776146,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barr"
+    "el\"},\"count\":-16776145,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":74},{\"entity_id\":78}]}}},{\""
+    "entity_number\":74,\"name\":\"constant-combinator\",\"position\":{\"x\":372.5,\"y\":-42.5},\"control_behavior\":{\"filte"
+    "rs\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16776176,\"index\":1},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-H\"},\"count\":-16776175,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\""
+    "},\"count\":-16776174,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16776173,\"index\""
+    ":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16776172,\"index\":5},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-L\"},\"count\":-16776171,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink"
+    "\"},\"count\":-16776170,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16776169,\"inde"
+    "x\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16776168,\"index\":9},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-P\"},\"count\":-16776167,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q"
+    "\"},\"count\":-16776166,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16776165,\"ind"
+    "ex\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16776164,\"index\":13},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-T\"},\"count\":-16776163,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signa"
+    "l-U\"},\"count\":-16776162,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16776161,\""
+    "index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":71},{\"entity_id\":73}]}}},{\"entity_number\":75,\"name\":"
+    "\"constant-combinator\",\"position\":{\"x\":373.5,\"y\":-43.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"wood\"},\"count\":-16776288,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\""
+    ":-16776287,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16776286,\"index\":3},{\"signal\":"
+    "{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16776285,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"cop"
+    "per-ore\"},\"count\":-16776284,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16776283"
+    ",\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16776282,\"index\":7},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"iron-plate\"},\"count\":-16776281,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-p"
+    "late\"},\"count\":-16776280,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16776279,\"i"
+    "ndex\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16776278,\"index\":11},{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16776277,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfu"
+    "r\"},\"count\":-16776276,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16776275,\"index\""
+    ":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16776274,\"index\":15},{\"signal\":{\"type\":\"i"
+    "tem\",\"name\":\"crude-oil-barrel\"},\"count\":-16776273,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\""
+    ":76},{\"entity_id\":80}]}}},{\"entity_number\":76,\"name\":\"constant-combinator\",\"position\":{\"x\":372.5,\"y\":-43.5"
+    "},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16776304,\"inde"
+    "x\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16776303,\"index\":2},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-I\"},\"count\":-16776302,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\""
+    "},\"count\":-16776301,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16776300,\"index\""
+    ":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16776299,\"index\":6},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-pink\"},\"count\":-16776298,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N"
+    "\"},\"count\":-16776297,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16776296,\"inde"
+    "x\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16776295,\"index\":10},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-Q\"},\"count\":-16776294,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-R\"},\"count\":-16776293,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16776292,\"i"
+    "ndex\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16776291,\"index\":14},{\"signal\":{\"typ"
+    "e\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16776290,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"si"
+    "gnal-V\"},\"count\":-16776289,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":72},{\"entity_id\":75}]}}}"
+    ",{\"entity_number\":77,\"name\":\"decider-combinator\",\"position\":{\"x\":376,\"y\":-42.5},\"direction\":2,\"control_be"
+    "havior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":16,\"co"
+    "mparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}"
+    "},\"connections\":{\"1\":{\"red\":[{\"entity_id\":78}],\"green\":[{\"entity_id\":79,\"circuit_id\":1},{\"entity_id\":99,"
+    "\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":79,\"circuit_id\":2},{\"entity_id\":99,\"circuit_id\":2}]}}},{\"entit"
+    "y_number\":78,\"name\":\"constant-combinator\",\"position\":{\"x\":374.5,\"y\":-42.5},\"control_behavior\":{\"filters\":"
+    "[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16776144,\"index\":1},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"light-oil-barrel\"},\"count\":-16776143,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubrica"
+    "nt-barrel\"},\"count\":-16776142,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\""
+    ":-16776141,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16776140,\"index\":"
+    "5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16776139,\"index\":6},{\"signal\":{\"type\":\"it"
+    "em\",\"name\":\"copper-cable\"},\"count\":-16776138,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"}"
+    ",\"count\":-16776137,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16776136,\"ind"
+    "ex\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16776135,\"index\":10},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16776134,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"a"
+    "dvanced-circuit\"},\"count\":-16776133,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"coun"
+    "t\":-16776132,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16776131,\"index\":14},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16776130,\"index\":15},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16776129,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entit"
+    "y_id\":73},{\"entity_id\":77,\"circuit_id\":1}]}}},{\"entity_number\":79,\"name\":\"decider-combinator\",\"position\":{\""
+    "x\":376,\"y\":-43.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-check\"},\"constant\":14,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":80}],\"green\":[{\"ent"
+    "ity_id\":57,\"circuit_id\":1},{\"entity_id\":77,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":57,\"circuit_id\":2},"
+    "{\"entity_id\":77,\"circuit_id\":2}]}}},{\"entity_number\":80,\"name\":\"constant-combinator\",\"position\":{\"x\":374.5"
+    ",\"y\":-43.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\""
+    ":-16776272,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16776271,\"index\":2},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16776270,\"index\":3},{\"signal\":{\"type\":\"it"
+    "em\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16776269,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfu"
+    "ric-acid-barrel\"},\"count\":-16776268,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":"
+    "-16776267,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16776266,\"index\":7},{\"sig"
+    "nal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16776265,\"index\":8},{\"signal\":{\"type\":\"item\",\"name"
+    "\":\"iron-gear-wheel\"},\"count\":-16776264,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"cou"
+    "nt\":-16776263,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16776262,\"index"
+    "\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16776261,\"index\":12},{\"signal\":{\"ty"
+    "pe\":\"item\",\"name\":\"processing-unit\"},\"count\":-16776260,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "engine-unit\"},\"count\":-16776259,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"cou"
+    "nt\":-16776258,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16776257,\"index"
+    "\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":75},{\"entity_id\":79,\"circuit_id\":1}]}}},{\"entity_number\":"
+    "81,\"name\":\"constant-combinator\",\"position\":{\"x\":377.5,\"y\":-42.5},\"control_behavior\":{\"filters\":[{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16776128,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-1\"},\"count\":-16776127,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-1677"
+    "6126,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16776125,\"index\":4},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16776124,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-5\"},\"count\":-16776123,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-1677"
+    "6122,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16776121,\"index\":8},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16776120,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-9\"},\"count\":-16776119,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-167"
+    "76118,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16776117,\"index\":12},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16776116,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-D\"},\"count\":-16776115,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":"
+    "-16776114,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16776113,\"index\":16}]},\"c"
+    "onnections\":{\"1\":{\"red\":[{\"entity_id\":84}]}}},{\"entity_number\":82,\"name\":\"constant-combinator\",\"position\""
+    ":{\"x\":377.5,\"y\":-43.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\""
+    "count\":-16776256,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16776255,\"index\":2}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16776254,\"index\":3},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-3\"},\"count\":-16776253,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\""
+    "count\":-16776252,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16776251,\"index\":6}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16776250,\"index\":7},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-7\"},\"count\":-16776249,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\""
+    "count\":-16776248,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16776247,\"index\":10"
+    "},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16776246,\"index\":11},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-B\"},\"count\":-16776245,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"}"
+    ",\"count\":-16776244,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16776243,\"index\""
+    ":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16776242,\"index\":15},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-F\"},\"count\":-16776241,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":86}"
+    "]}}},{\"entity_number\":83,\"name\":\"constant-combinator\",\"position\":{\"x\":379.5,\"y\":-42.5},\"control_behavior\":"
+    "{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16776096,\"index\":1},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"coal\"},\"count\":-16776095,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":"
+    "-16776094,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16776093,\"index\":4},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16776092,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "uranium-ore\"},\"count\":-16776091,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-1677609"
+    "0,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16776089,\"index\":8},{\"signal\":{\"t"
+    "ype\":\"item\",\"name\":\"copper-plate\"},\"count\":-16776088,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"sol"
+    "id-fuel\"},\"count\":-16776087,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-1677608"
+    "6,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16776085,\"index\":12},{\"signal\":{"
+    "\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16776084,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"batte"
+    "ry\"},\"count\":-16776083,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16776082,\"in"
+    "dex\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16776081,\"index\":16}]},\"connection"
+    "s\":{\"1\":{\"red\":[{\"entity_id\":84},{\"entity_id\":88}]}}},{\"entity_number\":84,\"name\":\"constant-combinator\",\""
+    "position\":{\"x\":378.5,\"y\":-42.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"sig"
+    "nal-G\"},\"count\":-16776112,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16776111,\""
+    "index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16776110,\"index\":3},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16776109,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-K\"},\"count\":-16776108,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16776107,\""
+    "index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16776106,\"index\":7},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16776105,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-O\"},\"count\":-16776104,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16776103"
+    ",\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16776102,\"index\":11},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16776101,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-S\"},\"count\":-16776100,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-167760"
+    "99,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16776098,\"index\":15},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16776097,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"ent"
+    "ity_id\":81},{\"entity_id\":83}]}}},{\"entity_number\":85,\"name\":\"constant-combinator\",\"position\":{\"x\":379.5,\"y"
+    "\":-43.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16776224,\"ind"
+    "ex\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16776223,\"index\":2},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"stone\"},\"count\":-16776222,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-1"
+    "6776221,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16776220,\"index\":5},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16776219,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "raw-fish\"},\"count\":-16776218,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16776217"
+    ",\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16776216,\"index\":9},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16776215,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"ste"
+    "el-plate\"},\"count\":-16776214,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-167762"
+    "13,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16776212,\"index\":13},{\"signal\":{\"ty"
+    "pe\":\"item\",\"name\":\"battery\"},\"count\":-16776211,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosiv"
+    "es\"},\"count\":-16776210,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-1677620"
+    "9,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":86},{\"entity_id\":90}]}}},{\"entity_number\":86,\"nam"
+    "e\":\"constant-combinator\",\"position\":{\"x\":378.5,\"y\":-43.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"typ"
+    "e\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16776240,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"sig"
+    "nal-H\"},\"count\":-16776239,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16776238,\""
+    "index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16776237,\"index\":4},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16776236,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-L\"},\"count\":-16776235,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16776234"
+    ",\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16776233,\"index\":8},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16776232,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-P\"},\"count\":-16776231,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-1677623"
+    "0,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16776229,\"index\":12},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16776228,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-T\"},\"count\":-16776227,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-167"
+    "76226,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16776225,\"index\":16}]},\"conne"
+    "ctions\":{\"1\":{\"red\":[{\"entity_id\":82},{\"entity_id\":85}]}}},{\"entity_number\":87,\"name\":\"decider-combinator\""
+    ",\"position\":{\"x\":382,\"y\":-42.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":17,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual"
+    "\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":88}]"
+    ",\"green\":[{\"entity_id\":89,\"circuit_id\":1},{\"entity_id\":109,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":89"
+    ",\"circuit_id\":2},{\"entity_id\":109,\"circuit_id\":2}]}}},{\"entity_number\":88,\"name\":\"constant-combinator\",\"pos"
+    "ition\":{\"x\":380.5,\"y\":-42.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil"
+    "-barrel\"},\"count\":-16776080,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-167"
+    "76079,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16776078,\"index\":3},{\"sig"
+    "nal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16776077,\"index\":4},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16776076,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-"
+    "barrel\"},\"count\":-16776075,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16776074"
+    ",\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16776073,\"index\":8},{\"signal\":{\"ty"
+    "pe\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16776072,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"e"
+    "mpty-barrel\"},\"count\":-16776071,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count"
+    "\":-16776070,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16776069,\"index\":1"
+    "2},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16776068,\"index\":13},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"engine-unit\"},\"count\":-16776067,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-"
+    "engine-unit\"},\"count\":-16776066,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count"
+    "\":-16776065,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":83},{\"entity_id\":87,\"circuit_id\":1}]}}}"
+    ",{\"entity_number\":89,\"name\":\"decider-combinator\",\"position\":{\"x\":382,\"y\":-43.5},\"direction\":2,\"control_be"
+    "havior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":15,\"co"
+    "mparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}"
+    "},\"connections\":{\"1\":{\"red\":[{\"entity_id\":90}],\"green\":[{\"entity_id\":67,\"circuit_id\":1},{\"entity_id\":87,"
+    "\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":67,\"circuit_id\":2},{\"entity_id\":87,\"circuit_id\":2}]}}},{\"entit"
+    "y_number\":90,\"name\":\"constant-combinator\",\"position\":{\"x\":380.5,\"y\":-43.5},\"control_behavior\":{\"filters\":"
+    "[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16776208,\"index\":1},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"light-oil-barrel\"},\"count\":-16776207,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubrica"
+    "nt-barrel\"},\"count\":-16776206,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\""
+    ":-16776205,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16776204,\"index\":"
+    "5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16776203,\"index\":6},{\"signal\":{\"type\":\"it"
+    "em\",\"name\":\"copper-cable\"},\"count\":-16776202,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"}"
+    ",\"count\":-16776201,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16776200,\"ind"
+    "ex\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16776199,\"index\":10},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16776198,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"a"
+    "dvanced-circuit\"},\"count\":-16776197,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"coun"
+    "t\":-16776196,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16776195,\"index\":14},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16776194,\"index\":15},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16776193,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entit"
+    "y_id\":85},{\"entity_id\":89,\"circuit_id\":1}]}}},{\"entity_number\":91,\"name\":\"constant-combinator\",\"position\":{"
+    "\"x\":371.5,\"y\":-40.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"c"
+    "ount\":-16775936,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16775935,\"index\":2},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16775934,\"index\":3},{\"signal\":{\"type\":\"virtua"
+    "l\",\"name\":\"signal-3\"},\"count\":-16775933,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"c"
+    "ount\":-16775932,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16775931,\"index\":6},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16775930,\"index\":7},{\"signal\":{\"type\":\"virtua"
+    "l\",\"name\":\"signal-7\"},\"count\":-16775929,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"c"
+    "ount\":-16775928,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16775927,\"index\":10}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16775926,\"index\":11},{\"signal\":{\"type\":\"virt"
+    "ual\",\"name\":\"signal-B\"},\"count\":-16775925,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},"
+    "\"count\":-16775924,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16775923,\"index\""
+    ":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16775922,\"index\":15},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-F\"},\"count\":-16775921,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":94}"
+    "]}}},{\"entity_number\":92,\"name\":\"constant-combinator\",\"position\":{\"x\":371.5,\"y\":-41.5},\"control_behavior\":"
+    "{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16776064,\"index\":1},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16776063,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-2\"},\"count\":-16776062,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16776061"
+    ",\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16776060,\"index\":5},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16776059,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-6\"},\"count\":-16776058,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16776057"
+    ",\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16776056,\"index\":9},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16776055,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-A\"},\"count\":-16776054,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-167760"
+    "53,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16776052,\"index\":13},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16776051,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-E\"},\"count\":-16776050,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-167"
+    "76049,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":96}]}}},{\"entity_number\":93,\"name\":\"constant-"
+    "combinator\",\"position\":{\"x\":373.5,\"y\":-40.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\""
+    "name\":\"wood\"},\"count\":-16775904,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16775903,"
+    "\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16775902,\"index\":3},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"iron-ore\"},\"count\":-16775901,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\""
+    "count\":-16775900,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16775899,\"index\":6}"
+    ",{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16775898,\"index\":7},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"iron-plate\"},\"count\":-16775897,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"coun"
+    "t\":-16775896,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16775895,\"index\":10},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16775894,\"index\":11},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"plastic-bar\"},\"count\":-16775893,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":"
+    "-16775892,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16775891,\"index\":14},{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16775890,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"crude-oil-barrel\"},\"count\":-16775889,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":94},{\"entity"
+    "_id\":98}]}}},{\"entity_number\":94,\"name\":\"constant-combinator\",\"position\":{\"x\":372.5,\"y\":-40.5},\"control_be"
+    "havior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16775920,\"index\":1},{\"sign"
+    "al\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16775919,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"n"
+    "ame\":\"signal-I\"},\"count\":-16775918,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":"
+    "-16775917,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16775916,\"index\":5},{\"sign"
+    "al\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16775915,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"n"
+    "ame\":\"signal-pink\"},\"count\":-16775914,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count"
+    "\":-16775913,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16775912,\"index\":9},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16775911,\"index\":10},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-Q\"},\"count\":-16775910,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"cou"
+    "nt\":-16775909,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16775908,\"index\":13},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16775907,\"index\":14},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-U\"},\"count\":-16775906,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\""
+    "count\":-16775905,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":91},{\"entity_id\":93}]}}},{\"entity_n"
+    "umber\":95,\"name\":\"constant-combinator\",\"position\":{\"x\":373.5,\"y\":-41.5},\"control_behavior\":{\"filters\":[{\""
+    "signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16776032,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"coal\"},\"count\":-16776031,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16776030,\"inde"
+    "x\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16776029,\"index\":4},{\"signal\":{\"type\":\"it"
+    "em\",\"name\":\"copper-ore\"},\"count\":-16776028,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},"
+    "\"count\":-16776027,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16776026,\"index\":7},"
+    "{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16776025,\"index\":8},{\"signal\":{\"type\":\"item\","
+    "\"name\":\"copper-plate\"},\"count\":-16776024,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"co"
+    "unt\":-16776023,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16776022,\"index\":11}"
+    ",{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16776021,\"index\":12},{\"signal\":{\"type\":\"item"
+    "\",\"name\":\"sulfur\"},\"count\":-16776020,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\""
+    ":-16776019,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16776018,\"index\":15},{\"si"
+    "gnal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16776017,\"index\":16}]},\"connections\":{\"1\":{\"r"
+    "ed\":[{\"entity_id\":96},{\"entity_id\":100}]}}},{\"entity_number\":96,\"name\":\"constant-combinator\",\"position\":{\""
+    "x\":372.5,\"y\":-41.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"cou"
+    "nt\":-16776048,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16776047,\"index\":2},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16776046,\"index\":3},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-J\"},\"count\":-16776045,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"coun"
+    "t\":-16776044,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16776043,\"index\":6},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16776042,\"index\":7},{\"signal\":{\"type\":\"virtua"
+    "l\",\"name\":\"signal-N\"},\"count\":-16776041,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"c"
+    "ount\":-16776040,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16776039,\"index\":10}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16776038,\"index\":11},{\"signal\":{\"type\":\"virt"
+    "ual\",\"name\":\"signal-R\"},\"count\":-16776037,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},"
+    "\"count\":-16776036,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16776035,\"index\""
+    ":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16776034,\"index\":15},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-V\"},\"count\":-16776033,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":92}"
+    ",{\"entity_id\":95}]}}},{\"entity_number\":97,\"name\":\"decider-combinator\",\"position\":{\"x\":376,\"y\":-40.5},\"dir"
+    "ection\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\""
+    "},\"constant\":20,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_co"
+    "unt_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":98}],\"green\":[{\"entity_id\":99,\"circuit_id\""
+    ":1},{\"entity_id\":119,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":99,\"circuit_id\":2},{\"entity_id\":119,\"circ"
+    "uit_id\":2}]}}},{\"entity_number\":98,\"name\":\"constant-combinator\",\"position\":{\"x\":374.5,\"y\":-40.5},\"control_"
+    "behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16775888,\"index\":1},"
+    "{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16775887,\"index\":2},{\"signal\":{\"type\":\"i"
+    "tem\",\"name\":\"lubricant-barrel\"},\"count\":-16775886,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleu"
+    "m-gas-barrel\"},\"count\":-16775885,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"cou"
+    "nt\":-16775884,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16775883,\"index\":6},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16775882,\"index\":7},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"iron-stick\"},\"count\":-16775881,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},"
+    "\"count\":-16775880,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16775879,\"index\""
+    ":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16775878,\"index\":11},{\"signal\":{\"ty"
+    "pe\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16775877,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "processing-unit\"},\"count\":-16775876,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":"
+    "-16775875,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16775874,\"index\":"
+    "15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16775873,\"index\":16}]},\"connections\":"
+    "{\"1\":{\"red\":[{\"entity_id\":93},{\"entity_id\":97,\"circuit_id\":1}]}}},{\"entity_number\":99,\"name\":\"decider-com"
+    "binator\",\"position\":{\"x\":376,\"y\":-41.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":18,\"comparator\":\"=\",\"output_signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_"
+    "id\":100}],\"green\":[{\"entity_id\":77,\"circuit_id\":1},{\"entity_id\":97,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entit"
+    "y_id\":77,\"circuit_id\":2},{\"entity_id\":97,\"circuit_id\":2}]}}},{\"entity_number\":100,\"name\":\"constant-combinato"
+    "r\",\"position\":{\"x\":374.5,\"y\":-41.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\""
+    "heavy-oil-barrel\"},\"count\":-16776016,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"cou"
+    "nt\":-16776015,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16776014,\"index\":"
+    "3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16776013,\"index\":4},{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16776012,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"water-barrel\"},\"count\":-16776011,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":"
+    "-16776010,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16776009,\"index\":8},{\"signa"
+    "l\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16776008,\"index\":9},{\"signal\":{\"type\":\"item\",\"n"
+    "ame\":\"empty-barrel\"},\"count\":-16776007,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\""
+    "},\"count\":-16776006,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16776005,\""
+    "index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16776004,\"index\":13},{\"signal\":{"
+    "\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16776003,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "electric-engine-unit\"},\"count\":-16776002,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\""
+    "},\"count\":-16776001,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":95},{\"entity_id\":99,\"circuit_id"
+    "\":1}]}}},{\"entity_number\":101,\"name\":\"constant-combinator\",\"position\":{\"x\":377.5,\"y\":-40.5},\"control_behav"
+    "ior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16775872,\"index\":1},{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16775871,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-2\"},\"count\":-16775870,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-1677"
+    "5869,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16775868,\"index\":5},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16775867,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-6\"},\"count\":-16775866,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-1677"
+    "5865,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16775864,\"index\":9},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16775863,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-A\"},\"count\":-16775862,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-167"
+    "75861,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16775860,\"index\":13},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16775859,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-E\"},\"count\":-16775858,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":"
+    "-16775857,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":104}]}}},{\"entity_number\":102,\"name\":\"con"
+    "stant-combinator\",\"position\":{\"x\":377.5,\"y\":-41.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-0\"},\"count\":-16776000,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},"
+    "\"count\":-16775999,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16775998,\"index\":"
+    "3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16775997,\"index\":4},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-4\"},\"count\":-16775996,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},"
+    "\"count\":-16775995,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16775994,\"index\":"
+    "7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16775993,\"index\":8},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-8\"},\"count\":-16775992,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},"
+    "\"count\":-16775991,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16775990,\"index\""
+    ":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16775989,\"index\":12},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-C\"},\"count\":-16775988,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D"
+    "\"},\"count\":-16775987,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16775986,\"ind"
+    "ex\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16775985,\"index\":16}]},\"connections\":{\""
+    "1\":{\"red\":[{\"entity_id\":106}]}}},{\"entity_number\":103,\"name\":\"constant-combinator\",\"position\":{\"x\":379.5,"
+    "\"y\":-40.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16775840,\""
+    "index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16775839,\"index\":2},{\"signal\":{\"type\":\"it"
+    "em\",\"name\":\"stone\"},\"count\":-16775838,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\""
+    ":-16775837,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16775836,\"index\":5},{\"sign"
+    "al\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16775835,\"index\":6},{\"signal\":{\"type\":\"item\",\"name"
+    "\":\"raw-fish\"},\"count\":-16775834,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-167"
+    "75833,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16775832,\"index\":9},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16775831,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "steel-plate\"},\"count\":-16775830,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-167"
+    "75829,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16775828,\"index\":13},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"battery\"},\"count\":-16775827,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explos"
+    "ives\"},\"count\":-16775826,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16775"
+    "825,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":104},{\"entity_id\":108}]}}},{\"entity_number\":104,"
+    "\"name\":\"constant-combinator\",\"position\":{\"x\":378.5,\"y\":-40.5},\"control_behavior\":{\"filters\":[{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16775856,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":"
+    "\"signal-H\"},\"count\":-16775855,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16775"
+    "854,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16775853,\"index\":4},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16775852,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":"
+    "\"signal-L\"},\"count\":-16775851,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16"
+    "775850,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16775849,\"index\":8},{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16775848,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-P\"},\"count\":-16775847,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-167"
+    "75846,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16775845,\"index\":12},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16775844,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-T\"},\"count\":-16775843,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":"
+    "-16775842,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16775841,\"index\":16}]},\"c"
+    "onnections\":{\"1\":{\"red\":[{\"entity_id\":101},{\"entity_id\":103}]}}},{\"entity_number\":105,\"name\":\"constant-com"
+    "binator\",\"position\":{\"x\":379.5,\"y\":-41.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"wood\"},\"count\":-16775968,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16775967,\"i"
+    "ndex\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16775966,\"index\":3},{\"signal\":{\"type\":\"it"
+    "em\",\"name\":\"iron-ore\"},\"count\":-16775965,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"c"
+    "ount\":-16775964,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16775963,\"index\":6},"
+    "{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16775962,\"index\":7},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"iron-plate\"},\"count\":-16775961,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"coun"
+    "t\":-16775960,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16775959,\"index\":10},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16775958,\"index\":11},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"plastic-bar\"},\"count\":-16775957,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":"
+    "-16775956,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16775955,\"index\":14},{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16775954,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"crude-oil-barrel\"},\"count\":-16775953,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":106},{\"entit"
+    "y_id\":110}]}}},{\"entity_number\":106,\"name\":\"constant-combinator\",\"position\":{\"x\":378.5,\"y\":-41.5},\"control"
+    "_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16775984,\"index\":1},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16775983,\"index\":2},{\"signal\":{\"type\":\"virtual\","
+    "\"name\":\"signal-I\"},\"count\":-16775982,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count"
+    "\":-16775981,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16775980,\"index\":5},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16775979,\"index\":6},{\"signal\":{\"type\":\"virtual\","
+    "\"name\":\"signal-pink\"},\"count\":-16775978,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"co"
+    "unt\":-16775977,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16775976,\"index\":9},{"
+    "\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16775975,\"index\":10},{\"signal\":{\"type\":\"virtua"
+    "l\",\"name\":\"signal-Q\"},\"count\":-16775974,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\""
+    "count\":-16775973,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16775972,\"index\":1"
+    "3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16775971,\"index\":14},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-U\"},\"count\":-16775970,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\""
+    "},\"count\":-16775969,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":102},{\"entity_id\":105}]}}},{\"en"
+    "tity_number\":107,\"name\":\"decider-combinator\",\"position\":{\"x\":382,\"y\":-40.5},\"direction\":2,\"control_behavio"
+    "r\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":21,\"compara"
+    "tor\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"c"
+    "onnections\":{\"1\":{\"red\":[{\"entity_id\":108}],\"green\":[{\"entity_id\":109,\"circuit_id\":1},{\"entity_id\":129,\""
+    "circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":109,\"circuit_id\":2},{\"entity_id\":129,\"circuit_id\":2}]}}},{\"entit"
+    "y_number\":108,\"name\":\"constant-combinator\",\"position\":{\"x\":380.5,\"y\":-40.5},\"control_behavior\":{\"filters\""
+    ":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16775824,\"index\":1},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"light-oil-barrel\"},\"count\":-16775823,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubrica"
+    "nt-barrel\"},\"count\":-16775822,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\""
+    ":-16775821,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16775820,\"index\":"
+    "5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16775819,\"index\":6},{\"signal\":{\"type\":\"it"
+    "em\",\"name\":\"copper-cable\"},\"count\":-16775818,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"}"
+    ",\"count\":-16775817,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16775816,\"ind"
+    "ex\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16775815,\"index\":10},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16775814,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"a"
+    "dvanced-circuit\"},\"count\":-16775813,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"coun"
+    "t\":-16775812,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16775811,\"index\":14},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16775810,\"index\":15},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16775809,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entit"
+    "y_id\":103},{\"entity_id\":107,\"circuit_id\":1}]}}},{\"entity_number\":109,\"name\":\"decider-combinator\",\"position\""
+    ":{\"x\":382,\"y\":-41.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virt"
+    "ual\",\"name\":\"signal-check\"},\"constant\":19,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":110}],\"green\":[{"
+    "\"entity_id\":87,\"circuit_id\":1},{\"entity_id\":107,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":87,\"circuit_id"
+    "\":2},{\"entity_id\":107,\"circuit_id\":2}]}}},{\"entity_number\":110,\"name\":\"constant-combinator\",\"position\":{\"x"
+    "\":380.5,\"y\":-41.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\""
+    "count\":-16775952,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16775951,\"index"
+    "\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16775950,\"index\":3},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16775949,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"sulfuric-acid-barrel\"},\"count\":-16775948,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"c"
+    "ount\":-16775947,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16775946,\"index\":7}"
+    ",{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16775945,\"index\":8},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"iron-gear-wheel\"},\"count\":-16775944,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\""
+    "},\"count\":-16775943,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16775942,"
+    "\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16775941,\"index\":12},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16775940,\"index\":13},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"engine-unit\"},\"count\":-16775939,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"}"
+    ",\"count\":-16775938,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16775937,\""
+    "index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":105},{\"entity_id\":109,\"circuit_id\":1}]}}},{\"entity_nu"
+    "mber\":111,\"name\":\"constant-combinator\",\"position\":{\"x\":371.5,\"y\":-38.5},\"control_behavior\":{\"filters\":[{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16775680,\"index\":1},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-1\"},\"count\":-16775679,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"coun"
+    "t\":-16775678,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16775677,\"index\":4},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16775676,\"index\":5},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-5\"},\"count\":-16775675,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"coun"
+    "t\":-16775674,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16775673,\"index\":8},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16775672,\"index\":9},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-9\"},\"count\":-16775671,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"cou"
+    "nt\":-16775670,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16775669,\"index\":12},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16775668,\"index\":13},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-D\"},\"count\":-16775667,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\""
+    "count\":-16775666,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16775665,\"index\":1"
+    "6}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":114}]}}},{\"entity_number\":112,\"name\":\"constant-combinator\",\""
+    "position\":{\"x\":371.5,\"y\":-39.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"sig"
+    "nal-0\"},\"count\":-16775808,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16775807,\""
+    "index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16775806,\"index\":3},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16775805,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-4\"},\"count\":-16775804,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16775803,\""
+    "index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16775802,\"index\":7},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16775801,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-8\"},\"count\":-16775800,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16775799,\""
+    "index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16775798,\"index\":11},{\"signal\":{\"ty"
+    "pe\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16775797,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-C\"},\"count\":-16775796,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-1677579"
+    "5,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16775794,\"index\":15},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16775793,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"enti"
+    "ty_id\":116}]}}},{\"entity_number\":113,\"name\":\"constant-combinator\",\"position\":{\"x\":373.5,\"y\":-38.5},\"contro"
+    "l_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16775648,\"index\":1},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16775647,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\""
+    "},\"count\":-16775646,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16775645,\"index\":4"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16775644,\"index\":5},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"uranium-ore\"},\"count\":-16775643,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"coun"
+    "t\":-16775642,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16775641,\"index\":8},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16775640,\"index\":9},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"solid-fuel\"},\"count\":-16775639,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"coun"
+    "t\":-16775638,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16775637,\"index\":12},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16775636,\"index\":13},{\"signal\":{\"type\":\"item\",\"na"
+    "me\":\"battery\"},\"count\":-16775635,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-1"
+    "6775634,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16775633,\"index\":16}]},"
+    "\"connections\":{\"1\":{\"red\":[{\"entity_id\":114},{\"entity_id\":118}]}}},{\"entity_number\":114,\"name\":\"constant-"
+    "combinator\",\"position\":{\"x\":372.5,\"y\":-38.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-G\"},\"count\":-16775664,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"coun"
+    "t\":-16775663,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16775662,\"index\":3},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16775661,\"index\":4},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-K\"},\"count\":-16775660,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"coun"
+    "t\":-16775659,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16775658,\"index\":7},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16775657,\"index\":8},{\"signal\":{\"type\":\"virtua"
+    "l\",\"name\":\"signal-O\"},\"count\":-16775656,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"c"
+    "ount\":-16775655,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16775654,\"index\":11"
+    "},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16775653,\"index\":12},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-S\"},\"count\":-16775652,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"}"
+    ",\"count\":-16775651,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16775650,\"index\""
+    ":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16775649,\"index\":16}]},\"connections\":{\"1\""
+    ":{\"red\":[{\"entity_id\":111},{\"entity_id\":113}]}}},{\"entity_number\":115,\"name\":\"constant-combinator\",\"positio"
+    "n\":{\"x\":373.5,\"y\":-39.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"cou"
+    "nt\":-16775776,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16775775,\"index\":2},{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16775774,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iro"
+    "n-ore\"},\"count\":-16775773,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16775772,\""
+    "index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16775771,\"index\":6},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"raw-fish\"},\"count\":-16775770,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate"
+    "\"},\"count\":-16775769,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16775768,\"ind"
+    "ex\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16775767,\"index\":10},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"steel-plate\"},\"count\":-16775766,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-b"
+    "ar\"},\"count\":-16775765,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16775764,\"index\""
+    ":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16775763,\"index\":14},{\"signal\":{\"type\":\"item"
+    "\",\"name\":\"explosives\"},\"count\":-16775762,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel"
+    "\"},\"count\":-16775761,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":116},{\"entity_id\":120}]}}},{\""
+    "entity_number\":116,\"name\":\"constant-combinator\",\"position\":{\"x\":372.5,\"y\":-39.5},\"control_behavior\":{\"filt"
+    "ers\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16775792,\"index\":1},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-H\"},\"count\":-16775791,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\""
+    "},\"count\":-16775790,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16775789,\"index\""
+    ":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16775788,\"index\":5},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-L\"},\"count\":-16775787,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink"
+    "\"},\"count\":-16775786,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16775785,\"inde"
+    "x\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16775784,\"index\":9},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-P\"},\"count\":-16775783,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q"
+    "\"},\"count\":-16775782,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16775781,\"ind"
+    "ex\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16775780,\"index\":13},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-T\"},\"count\":-16775779,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signa"
+    "l-U\"},\"count\":-16775778,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16775777,\""
+    "index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":112},{\"entity_id\":115}]}}},{\"entity_number\":117,\"name"
+    "\":\"decider-combinator\",\"position\":{\"x\":376,\"y\":-38.5},\"direction\":2,\"control_behavior\":{\"decider_condition"
+    "s\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":24,\"comparator\":\"=\",\"output_sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"r"
+    "ed\":[{\"entity_id\":118}],\"green\":[{\"entity_id\":119,\"circuit_id\":1},{\"entity_id\":139,\"circuit_id\":1}]},\"2\":"
+    "{\"red\":[{\"entity_id\":119,\"circuit_id\":2},{\"entity_id\":139,\"circuit_id\":2}]}}},{\"entity_number\":118,\"name\":"
+    "\"constant-combinator\",\"position\":{\"x\":374.5,\"y\":-38.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16775632,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light"
+    "-oil-barrel\"},\"count\":-16775631,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":"
+    "-16775630,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16775629,\"index\":4"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16775628,\"index\":5},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"water-barrel\"},\"count\":-16775627,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper"
+    "-cable\"},\"count\":-16775626,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16775625,\""
+    "index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16775624,\"index\":9},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16775623,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"e"
+    "lectronic-circuit\"},\"count\":-16775622,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"c"
+    "ount\":-16775621,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16775620,\"index\""
+    ":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16775619,\"index\":14},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"electric-engine-unit\"},\"count\":-16775618,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"fl"
+    "ying-robot-frame\"},\"count\":-16775617,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":113},{\"entity_i"
+    "d\":117,\"circuit_id\":1}]}}},{\"entity_number\":119,\"name\":\"decider-combinator\",\"position\":{\"x\":376,\"y\":-39.5"
+    "},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-check\"},\"constant\":22,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\""
+    "copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":120}],\"green\":[{\"entity_id\":97,\"circ"
+    "uit_id\":1},{\"entity_id\":117,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":97,\"circuit_id\":2},{\"entity_id\":11"
+    "7,\"circuit_id\":2}]}}},{\"entity_number\":120,\"name\":\"constant-combinator\",\"position\":{\"x\":374.5,\"y\":-39.5},\""
+    "control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16775760,\"ind"
+    "ex\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16775759,\"index\":2},{\"signal\":{\"ty"
+    "pe\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16775758,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "petroleum-gas-barrel\"},\"count\":-16775757,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\""
+    "},\"count\":-16775756,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16775755,\"index"
+    "\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16775754,\"index\":7},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"iron-stick\"},\"count\":-16775753,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-whe"
+    "el\"},\"count\":-16775752,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16775751,\"i"
+    "ndex\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16775750,\"index\":11},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16775749,\"index\":12},{\"signal\":{\"type\":\"item\",\"na"
+    "me\":\"processing-unit\"},\"count\":-16775748,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"c"
+    "ount\":-16775747,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16775746,\"i"
+    "ndex\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16775745,\"index\":16}]},\"connect"
+    "ions\":{\"1\":{\"red\":[{\"entity_id\":115},{\"entity_id\":119,\"circuit_id\":1}]}}},{\"entity_number\":121,\"name\":\"c"
+    "onstant-combinator\",\"position\":{\"x\":377.5,\"y\":-38.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"v"
+    "irtual\",\"name\":\"signal-0\"},\"count\":-16775616,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\""
+    "},\"count\":-16775615,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16775614,\"index\""
+    ":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16775613,\"index\":4},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-4\"},\"count\":-16775612,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"}"
+    ",\"count\":-16775611,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16775610,\"index\""
+    ":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16775609,\"index\":8},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-8\"},\"count\":-16775608,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"}"
+    ",\"count\":-16775607,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16775606,\"index\""
+    ":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16775605,\"index\":12},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-C\"},\"count\":-16775604,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D"
+    "\"},\"count\":-16775603,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16775602,\"ind"
+    "ex\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16775601,\"index\":16}]},\"connections\":{\""
+    "1\":{\"red\":[{\"entity_id\":124}]}}},{\"entity_number\":122,\"name\":\"constant-combinator\",\"position\":{\"x\":377.5,"
+    "\"y\":-39.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-1677"
+    "5744,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16775743,\"index\":2},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16775742,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-3\"},\"count\":-16775741,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-1677"
+    "5740,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16775739,\"index\":6},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16775738,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-7\"},\"count\":-16775737,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-1677"
+    "5736,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16775735,\"index\":10},{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16775734,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name"
+    "\":\"signal-B\"},\"count\":-16775733,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-1"
+    "6775732,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16775731,\"index\":14},{\"sign"
+    "al\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16775730,\"index\":15},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-F\"},\"count\":-16775729,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":126}]}}},{\"ent"
+    "ity_number\":123,\"name\":\"constant-combinator\",\"position\":{\"x\":379.5,\"y\":-38.5},\"control_behavior\":{\"filters"
+    "\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16775584,\"index\":1},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"coal\"},\"count\":-16775583,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16775582"
+    ",\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16775581,\"index\":4},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"copper-ore\"},\"count\":-16775580,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-"
+    "ore\"},\"count\":-16775579,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16775578,\"inde"
+    "x\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16775577,\"index\":8},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"copper-plate\"},\"count\":-16775576,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\""
+    "},\"count\":-16775575,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16775574,\"index"
+    "\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16775573,\"index\":12},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"sulfur\"},\"count\":-16775572,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"c"
+    "ount\":-16775571,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16775570,\"index\":15}"
+    ",{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16775569,\"index\":16}]},\"connections\":{\"1\""
+    ":{\"red\":[{\"entity_id\":124},{\"entity_id\":128}]}}},{\"entity_number\":124,\"name\":\"constant-combinator\",\"positio"
+    "n\":{\"x\":378.5,\"y\":-38.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\""
+    "},\"count\":-16775600,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16775599,\"index\""
+    ":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16775598,\"index\":3},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-J\"},\"count\":-16775597,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"}"
+    ",\"count\":-16775596,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16775595,\"index\""
+    ":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16775594,\"index\":7},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-N\"},\"count\":-16775593,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\""
+    "},\"count\":-16775592,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16775591,\"index\""
+    ":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16775590,\"index\":11},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-R\"},\"count\":-16775589,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S"
+    "\"},\"count\":-16775588,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16775587,\"ind"
+    "ex\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16775586,\"index\":15},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-V\"},\"count\":-16775585,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":"
+    "121},{\"entity_id\":123}]}}},{\"entity_number\":125,\"name\":\"constant-combinator\",\"position\":{\"x\":379.5,\"y\":-39"
+    ".5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16775712,\"index\":1"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16775711,\"index\":2},{\"signal\":{\"type\":\"item\",\"na"
+    "me\":\"stone\"},\"count\":-16775710,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-167757"
+    "09,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16775708,\"index\":5},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16775707,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw"
+    "-fish\"},\"count\":-16775706,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16775705,\""
+    "index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16775704,\"index\":9},{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16775703,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-"
+    "plate\"},\"count\":-16775702,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16775701,"
+    "\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16775700,\"index\":13},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"battery\"},\"count\":-16775699,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\""
+    "},\"count\":-16775698,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16775697,\""
+    "index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":126},{\"entity_id\":130}]}}},{\"entity_number\":126,\"name"
+    "\":\"constant-combinator\",\"position\":{\"x\":378.5,\"y\":-39.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16775728,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-H\"},\"count\":-16775727,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16775726,\""
+    "index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16775725,\"index\":4},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16775724,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-L\"},\"count\":-16775723,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16775722"
+    ",\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16775721,\"index\":8},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16775720,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-P\"},\"count\":-16775719,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-1677571"
+    "8,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16775717,\"index\":12},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16775716,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-T\"},\"count\":-16775715,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-167"
+    "75714,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16775713,\"index\":16}]},\"conne"
+    "ctions\":{\"1\":{\"red\":[{\"entity_id\":122},{\"entity_id\":125}]}}},{\"entity_number\":127,\"name\":\"decider-combinat"
+    "or\",\"position\":{\"x\":382,\"y\":-38.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":25,\"comparator\":\"=\",\"output_signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":"
+    "128}],\"green\":[{\"entity_id\":129,\"circuit_id\":1},{\"entity_id\":149,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_i"
+    "d\":129,\"circuit_id\":2},{\"entity_id\":149,\"circuit_id\":2}]}}},{\"entity_number\":128,\"name\":\"constant-combinator"
+    "\",\"position\":{\"x\":380.5,\"y\":-38.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"h"
+    "eavy-oil-barrel\"},\"count\":-16775568,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"coun"
+    "t\":-16775567,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16775566,\"index\":3"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16775565,\"index\":4},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16775564,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"water-barrel\"},\"count\":-16775563,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-"
+    "16775562,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16775561,\"index\":8},{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16775560,\"index\":9},{\"signal\":{\"type\":\"item\",\"na"
+    "me\":\"empty-barrel\"},\"count\":-16775559,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"}"
+    ",\"count\":-16775558,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16775557,\"i"
+    "ndex\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16775556,\"index\":13},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16775555,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"el"
+    "ectric-engine-unit\"},\"count\":-16775554,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},"
+    "\"count\":-16775553,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":123},{\"entity_id\":127,\"circuit_id"
+    "\":1}]}}},{\"entity_number\":129,\"name\":\"decider-combinator\",\"position\":{\"x\":382,\"y\":-39.5},\"direction\":2,\""
+    "control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant"
+    "\":23,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_inp"
+    "ut\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":130}],\"green\":[{\"entity_id\":107,\"circuit_id\":1},{\"ent"
+    "ity_id\":127,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":107,\"circuit_id\":2},{\"entity_id\":127,\"circuit_id\":"
+    "2}]}}},{\"entity_number\":130,\"name\":\"constant-combinator\",\"position\":{\"x\":380.5,\"y\":-39.5},\"control_behavior"
+    "\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16775696,\"index\":1},{\"signa"
+    "l\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16775695,\"index\":2},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"lubricant-barrel\"},\"count\":-16775694,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-ba"
+    "rrel\"},\"count\":-16775693,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16"
+    "775692,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16775691,\"index\":6},{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16775690,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"iron-stick\"},\"count\":-16775689,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\""
+    ":-16775688,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16775687,\"index\":10},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16775686,\"index\":11},{\"signal\":{\"type\":\"it"
+    "em\",\"name\":\"advanced-circuit\"},\"count\":-16775685,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processi"
+    "ng-unit\"},\"count\":-16775684,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-1677568"
+    "3,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16775682,\"index\":15},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16775681,\"index\":16}]},\"connections\":{\"1\":{"
+    "\"red\":[{\"entity_id\":125},{\"entity_id\":129,\"circuit_id\":1}]}}},{\"entity_number\":131,\"name\":\"constant-combina"
+    "tor\",\"position\":{\"x\":371.5,\"y\":-36.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name"
+    "\":\"signal-0\"},\"count\":-16775424,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16"
+    "775423,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16775422,\"index\":3},{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16775421,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-4\"},\"count\":-16775420,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-1677"
+    "5419,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16775418,\"index\":7},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16775417,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-8\"},\"count\":-16775416,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-1677"
+    "5415,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16775414,\"index\":11},{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16775413,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name"
+    "\":\"signal-C\"},\"count\":-16775412,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-1"
+    "6775411,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16775410,\"index\":15},{\"sign"
+    "al\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16775409,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{"
+    "\"entity_id\":134}]}}},{\"entity_number\":132,\"name\":\"constant-combinator\",\"position\":{\"x\":371.5,\"y\":-37.5},\""
+    "control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16775552,\"index\":"
+    "1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16775551,\"index\":2},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-2\"},\"count\":-16775550,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},"
+    "\"count\":-16775549,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16775548,\"index\":"
+    "5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16775547,\"index\":6},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-6\"},\"count\":-16775546,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},"
+    "\"count\":-16775545,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16775544,\"index\":"
+    "9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16775543,\"index\":10},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-A\"},\"count\":-16775542,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\""
+    "},\"count\":-16775541,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16775540,\"index"
+    "\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16775539,\"index\":14},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-E\"},\"count\":-16775538,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-F\"},\"count\":-16775537,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":136}]}}},{\"entity_number\":13"
+    "3,\"name\":\"constant-combinator\",\"position\":{\"x\":373.5,\"y\":-36.5},\"control_behavior\":{\"filters\":[{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16775392,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\""
+    "},\"count\":-16775391,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16775390,\"index\":3},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16775389,\"index\":4},{\"signal\":{\"type\":\"item\",\"n"
+    "ame\":\"copper-ore\"},\"count\":-16775388,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\""
+    ":-16775387,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16775386,\"index\":7},{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16775385,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"copper-plate\"},\"count\":-16775384,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16"
+    "775383,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16775382,\"index\":11},{\"signa"
+    "l\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16775381,\"index\":12},{\"signal\":{\"type\":\"item\",\"name"
+    "\":\"sulfur\"},\"count\":-16775380,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-1677537"
+    "9,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16775378,\"index\":15},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16775377,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"e"
+    "ntity_id\":134},{\"entity_id\":138}]}}},{\"entity_number\":134,\"name\":\"constant-combinator\",\"position\":{\"x\":372."
+    "5,\"y\":-36.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16"
+    "775408,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16775407,\"index\":2},{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16775406,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-J\"},\"count\":-16775405,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-1677"
+    "5404,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16775403,\"index\":6},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16775402,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"nam"
+    "e\":\"signal-N\"},\"count\":-16775401,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-1"
+    "6775400,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16775399,\"index\":10},{\"signa"
+    "l\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16775398,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"n"
+    "ame\":\"signal-R\"},\"count\":-16775397,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\""
+    ":-16775396,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16775395,\"index\":14},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16775394,\"index\":15},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-V\"},\"count\":-16775393,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":131},{\"enti"
+    "ty_id\":133}]}}},{\"entity_number\":135,\"name\":\"constant-combinator\",\"position\":{\"x\":373.5,\"y\":-37.5},\"contro"
+    "l_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16775520,\"index\":1},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16775519,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\""
+    "},\"count\":-16775518,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16775517,\"index\":4"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16775516,\"index\":5},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"uranium-ore\"},\"count\":-16775515,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"coun"
+    "t\":-16775514,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16775513,\"index\":8},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16775512,\"index\":9},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"solid-fuel\"},\"count\":-16775511,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"coun"
+    "t\":-16775510,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16775509,\"index\":12},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16775508,\"index\":13},{\"signal\":{\"type\":\"item\",\"na"
+    "me\":\"battery\"},\"count\":-16775507,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-1"
+    "6775506,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16775505,\"index\":16}]},"
+    "\"connections\":{\"1\":{\"red\":[{\"entity_id\":136},{\"entity_id\":140}]}}},{\"entity_number\":136,\"name\":\"constant-"
+    "combinator\",\"position\":{\"x\":372.5,\"y\":-37.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-G\"},\"count\":-16775536,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"coun"
+    "t\":-16775535,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16775534,\"index\":3},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16775533,\"index\":4},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-K\"},\"count\":-16775532,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"coun"
+    "t\":-16775531,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16775530,\"index\":7},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16775529,\"index\":8},{\"signal\":{\"type\":\"virtua"
+    "l\",\"name\":\"signal-O\"},\"count\":-16775528,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"c"
+    "ount\":-16775527,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16775526,\"index\":11"
+    "},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16775525,\"index\":12},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-S\"},\"count\":-16775524,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"}"
+    ",\"count\":-16775523,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16775522,\"index\""
+    ":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16775521,\"index\":16}]},\"connections\":{\"1\""
+    ":{\"red\":[{\"entity_id\":132},{\"entity_id\":135}]}}},{\"entity_number\":137,\"name\":\"decider-combinator\",\"position"
+    "\":{\"x\":376,\"y\":-36.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-check\"},\"constant\":28,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":138}],\"green\""
+    ":[{\"entity_id\":139,\"circuit_id\":1},{\"entity_id\":159,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":139,\"circu"
+    "it_id\":2},{\"entity_id\":159,\"circuit_id\":2}]}}},{\"entity_number\":138,\"name\":\"constant-combinator\",\"position\""
+    ":{\"x\":374.5,\"y\":-36.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel"
+    "\"},\"count\":-16775376,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16775375,\""
+    "index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16775374,\"index\":3},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16775373,\"index\":4},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"sulfuric-acid-barrel\"},\"count\":-16775372,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"}"
+    ",\"count\":-16775371,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16775370,\"index\""
+    ":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16775369,\"index\":8},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"iron-gear-wheel\"},\"count\":-16775368,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barre"
+    "l\"},\"count\":-16775367,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-167753"
+    "66,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16775365,\"index\":12},{\"sign"
+    "al\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16775364,\"index\":13},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"engine-unit\"},\"count\":-16775363,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit"
+    "\"},\"count\":-16775362,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-1677536"
+    "1,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":133},{\"entity_id\":137,\"circuit_id\":1}]}}},{\"entit"
+    "y_number\":139,\"name\":\"decider-combinator\",\"position\":{\"x\":376,\"y\":-37.5},\"direction\":2,\"control_behavior\""
+    ":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":26,\"comparator"
+    "\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"conn"
+    "ections\":{\"1\":{\"red\":[{\"entity_id\":140}],\"green\":[{\"entity_id\":117,\"circuit_id\":1},{\"entity_id\":137,\"cir"
+    "cuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":117,\"circuit_id\":2},{\"entity_id\":137,\"circuit_id\":2}]}}},{\"entity_n"
+    "umber\":140,\"name\":\"constant-combinator\",\"position\":{\"x\":374.5,\"y\":-37.5},\"control_behavior\":{\"filters\":[{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16775504,\"index\":1},{\"signal\":{\"type\":\"it"
+    "em\",\"name\":\"light-oil-barrel\"},\"count\":-16775503,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant"
+    "-barrel\"},\"count\":-16775502,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":"
+    "-16775501,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16775500,\"index\":5"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16775499,\"index\":6},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"copper-cable\"},\"count\":-16775498,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},"
+    "\"count\":-16775497,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16775496,\"inde"
+    "x\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16775495,\"index\":10},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16775494,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"a"
+    "dvanced-circuit\"},\"count\":-16775493,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"coun"
+    "t\":-16775492,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16775491,\"index\":14},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16775490,\"index\":15},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16775489,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entit"
+    "y_id\":135},{\"entity_id\":139,\"circuit_id\":1}]}}},{\"entity_number\":141,\"name\":\"constant-combinator\",\"position\""
+    ":{\"x\":377.5,\"y\":-36.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\""
+    "count\":-16775360,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16775359,\"index\":2}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16775358,\"index\":3},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-3\"},\"count\":-16775357,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\""
+    "count\":-16775356,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16775355,\"index\":6}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16775354,\"index\":7},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-7\"},\"count\":-16775353,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\""
+    "count\":-16775352,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16775351,\"index\":10"
+    "},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16775350,\"index\":11},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-B\"},\"count\":-16775349,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"}"
+    ",\"count\":-16775348,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16775347,\"index\""
+    ":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16775346,\"index\":15},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-F\"},\"count\":-16775345,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":144"
+    "}]}}},{\"entity_number\":142,\"name\":\"constant-combinator\",\"position\":{\"x\":377.5,\"y\":-37.5},\"control_behavior\""
+    ":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16775488,\"index\":1},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16775487,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-2\"},\"count\":-16775486,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-1677548"
+    "5,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16775484,\"index\":5},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16775483,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-6\"},\"count\":-16775482,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-1677548"
+    "1,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16775480,\"index\":9},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16775479,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-A\"},\"count\":-16775478,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-167754"
+    "77,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16775476,\"index\":13},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16775475,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-E\"},\"count\":-16775474,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-167"
+    "75473,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":146}]}}},{\"entity_number\":143,\"name\":\"constan"
+    "t-combinator\",\"position\":{\"x\":379.5,\"y\":-36.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\","
+    "\"name\":\"wood\"},\"count\":-16775328,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-1677532"
+    "7,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16775326,\"index\":3},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"iron-ore\"},\"count\":-16775325,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\""
+    "},\"count\":-16775324,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16775323,\"index\""
+    ":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16775322,\"index\":7},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"iron-plate\"},\"count\":-16775321,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"c"
+    "ount\":-16775320,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16775319,\"index\":10},"
+    "{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16775318,\"index\":11},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"plastic-bar\"},\"count\":-16775317,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count"
+    "\":-16775316,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16775315,\"index\":14},{\"sig"
+    "nal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16775314,\"index\":15},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"crude-oil-barrel\"},\"count\":-16775313,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":144},{\"en"
+    "tity_id\":148}]}}},{\"entity_number\":144,\"name\":\"constant-combinator\",\"position\":{\"x\":378.5,\"y\":-36.5},\"cont"
+    "rol_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16775344,\"index\":1},{"
+    "\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16775343,\"index\":2},{\"signal\":{\"type\":\"virtual"
+    "\",\"name\":\"signal-I\"},\"count\":-16775342,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"co"
+    "unt\":-16775341,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16775340,\"index\":5},{"
+    "\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16775339,\"index\":6},{\"signal\":{\"type\":\"virtual"
+    "\",\"name\":\"signal-pink\"},\"count\":-16775338,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\""
+    "count\":-16775337,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16775336,\"index\":9}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16775335,\"index\":10},{\"signal\":{\"type\":\"virt"
+    "ual\",\"name\":\"signal-Q\"},\"count\":-16775334,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},"
+    "\"count\":-16775333,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16775332,\"index\""
+    ":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16775331,\"index\":14},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-U\"},\"count\":-16775330,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V"
+    "\"},\"count\":-16775329,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":141},{\"entity_id\":143}]}}},{\""
+    "entity_number\":145,\"name\":\"constant-combinator\",\"position\":{\"x\":379.5,\"y\":-37.5},\"control_behavior\":{\"filt"
+    "ers\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16775456,\"index\":1},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"coal\"},\"count\":-16775455,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16775"
+    "454,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16775453,\"index\":4},{\"signal\":{\"t"
+    "ype\":\"item\",\"name\":\"copper-ore\"},\"count\":-16775452,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"urani"
+    "um-ore\"},\"count\":-16775451,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16775450,\"i"
+    "ndex\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16775449,\"index\":8},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"copper-plate\"},\"count\":-16775448,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fu"
+    "el\"},\"count\":-16775447,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16775446,\"i"
+    "ndex\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16775445,\"index\":12},{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"sulfur\"},\"count\":-16775444,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"}"
+    ",\"count\":-16775443,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16775442,\"index\""
+    ":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16775441,\"index\":16}]},\"connections\":{"
+    "\"1\":{\"red\":[{\"entity_id\":146},{\"entity_id\":150}]}}},{\"entity_number\":146,\"name\":\"constant-combinator\",\"po"
+    "sition\":{\"x\":378.5,\"y\":-37.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signa"
+    "l-G\"},\"count\":-16775472,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16775471,\"i"
+    "ndex\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16775470,\"index\":3},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-J\"},\"count\":-16775469,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-K\"},\"count\":-16775468,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16775467,\"in"
+    "dex\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16775466,\"index\":7},{\"signal\":{\"typ"
+    "e\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16775465,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"sig"
+    "nal-O\"},\"count\":-16775464,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16775463,\""
+    "index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16775462,\"index\":11},{\"signal\":{\"ty"
+    "pe\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16775461,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-S\"},\"count\":-16775460,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-1677545"
+    "9,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16775458,\"index\":15},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16775457,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"enti"
+    "ty_id\":142},{\"entity_id\":145}]}}},{\"entity_number\":147,\"name\":\"decider-combinator\",\"position\":{\"x\":382,\"y\""
+    ":-36.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-check\"},\"constant\":29,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everythin"
+    "g\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":148}],\"green\":[{\"entity_id\":14"
+    "9,\"circuit_id\":1},{\"entity_id\":169,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":149,\"circuit_id\":2},{\"entit"
+    "y_id\":169,\"circuit_id\":2}]}}},{\"entity_number\":148,\"name\":\"constant-combinator\",\"position\":{\"x\":380.5,\"y\""
+    ":-36.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-1677"
+    "5312,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16775311,\"index\":2},{\"sign"
+    "al\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16775310,\"index\":3},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"petroleum-gas-barrel\"},\"count\":-16775309,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-aci"
+    "d-barrel\"},\"count\":-16775308,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-167753"
+    "07,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16775306,\"index\":7},{\"signal\":{"
+    "\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16775305,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"ir"
+    "on-gear-wheel\"},\"count\":-16775304,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-1"
+    "6775303,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16775302,\"index\":11},"
+    "{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16775301,\"index\":12},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"processing-unit\"},\"count\":-16775300,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-"
+    "unit\"},\"count\":-16775299,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-1"
+    "6775298,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16775297,\"index\":16}]"
+    "},\"connections\":{\"1\":{\"red\":[{\"entity_id\":143},{\"entity_id\":147,\"circuit_id\":1}]}}},{\"entity_number\":149,\""
+    "name\":\"decider-combinator\",\"position\":{\"x\":382,\"y\":-37.5},\"direction\":2,\"control_behavior\":{\"decider_condi"
+    "tions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":27,\"comparator\":\"=\",\"output"
+    "_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":"
+    "{\"red\":[{\"entity_id\":150}],\"green\":[{\"entity_id\":127,\"circuit_id\":1},{\"entity_id\":147,\"circuit_id\":1}]},\""
+    "2\":{\"red\":[{\"entity_id\":127,\"circuit_id\":2},{\"entity_id\":147,\"circuit_id\":2}]}}},{\"entity_number\":150,\"nam"
+    "e\":\"constant-combinator\",\"position\":{\"x\":380.5,\"y\":-37.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16775440,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"l"
+    "ight-oil-barrel\"},\"count\":-16775439,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"coun"
+    "t\":-16775438,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16775437,\"index"
+    "\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16775436,\"index\":5},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16775435,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"co"
+    "pper-cable\"},\"count\":-16775434,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-167754"
+    "33,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16775432,\"index\":9},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16775431,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"electronic-circuit\"},\"count\":-16775430,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"}"
+    ",\"count\":-16775429,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16775428,\"in"
+    "dex\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16775427,\"index\":14},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16775426,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"flying-robot-frame\"},\"count\":-16775425,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":145},{\"ent"
+    "ity_id\":149,\"circuit_id\":1}]}}},{\"entity_number\":151,\"name\":\"constant-combinator\",\"position\":{\"x\":371.5,\"y"
+    "\":-34.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-1677516"
+    "8,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16775167,\"index\":2},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16775166,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-3\"},\"count\":-16775165,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-1677516"
+    "4,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16775163,\"index\":6},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16775162,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-7\"},\"count\":-16775161,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-1677516"
+    "0,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16775159,\"index\":10},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16775158,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-B\"},\"count\":-16775157,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-167751"
+    "56,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16775155,\"index\":14},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16775154,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-F\"},\"count\":-16775153,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":154}]}}},{\"entity_nu"
+    "mber\":152,\"name\":\"constant-combinator\",\"position\":{\"x\":371.5,\"y\":-35.5},\"control_behavior\":{\"filters\":[{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16775296,\"index\":1},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-1\"},\"count\":-16775295,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"coun"
+    "t\":-16775294,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16775293,\"index\":4},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16775292,\"index\":5},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-5\"},\"count\":-16775291,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"coun"
+    "t\":-16775290,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16775289,\"index\":8},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16775288,\"index\":9},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-9\"},\"count\":-16775287,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"cou"
+    "nt\":-16775286,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16775285,\"index\":12},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16775284,\"index\":13},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-D\"},\"count\":-16775283,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\""
+    "count\":-16775282,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16775281,\"index\":1"
+    "6}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":156}]}}},{\"entity_number\":153,\"name\":\"constant-combinator\",\""
+    "position\":{\"x\":373.5,\"y\":-34.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\""
+    "},\"count\":-16775136,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16775135,\"index\":2},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16775134,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"iron-ore\"},\"count\":-16775133,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16775"
+    "132,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16775131,\"index\":6},{\"signal\":{"
+    "\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16775130,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron"
+    "-plate\"},\"count\":-16775129,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16775128"
+    ",\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16775127,\"index\":10},{\"signal\":{\"t"
+    "ype\":\"item\",\"name\":\"steel-plate\"},\"count\":-16775126,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"pla"
+    "stic-bar\"},\"count\":-16775125,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16775124,\""
+    "index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16775123,\"index\":14},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"explosives\"},\"count\":-16775122,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil"
+    "-barrel\"},\"count\":-16775121,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":154},{\"entity_id\":158}]"
+    "}}},{\"entity_number\":154,\"name\":\"constant-combinator\",\"position\":{\"x\":372.5,\"y\":-34.5},\"control_behavior\":"
+    "{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16775152,\"index\":1},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16775151,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-I\"},\"count\":-16775150,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16775149"
+    ",\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16775148,\"index\":5},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16775147,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-pink\"},\"count\":-16775146,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16775"
+    "145,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16775144,\"index\":9},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16775143,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-Q\"},\"count\":-16775142,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-167"
+    "75141,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16775140,\"index\":13},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16775139,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-U\"},\"count\":-16775138,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":"
+    "-16775137,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":151},{\"entity_id\":153}]}}},{\"entity_number\""
+    ":155,\"name\":\"constant-combinator\",\"position\":{\"x\":373.5,\"y\":-35.5},\"control_behavior\":{\"filters\":[{\"signa"
+    "l\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16775264,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coa"
+    "l\"},\"count\":-16775263,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16775262,\"index\":3"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16775261,\"index\":4},{\"signal\":{\"type\":\"item\","
+    "\"name\":\"copper-ore\"},\"count\":-16775260,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"cou"
+    "nt\":-16775259,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16775258,\"index\":7},{\"si"
+    "gnal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16775257,\"index\":8},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"copper-plate\"},\"count\":-16775256,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\""
+    ":-16775255,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16775254,\"index\":11},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16775253,\"index\":12},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"sulfur\"},\"count\":-16775252,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-167"
+    "75251,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16775250,\"index\":15},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16775249,\"index\":16}]},\"connections\":{\"1\":{\"red\":["
+    "{\"entity_id\":156},{\"entity_id\":160}]}}},{\"entity_number\":156,\"name\":\"constant-combinator\",\"position\":{\"x\":"
+    "372.5,\"y\":-35.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\""
+    ":-16775280,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16775279,\"index\":2},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16775278,\"index\":3},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-J\"},\"count\":-16775277,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\""
+    ":-16775276,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16775275,\"index\":6},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16775274,\"index\":7},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-N\"},\"count\":-16775273,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"coun"
+    "t\":-16775272,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16775271,\"index\":10},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16775270,\"index\":11},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-R\"},\"count\":-16775269,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"cou"
+    "nt\":-16775268,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16775267,\"index\":14},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16775266,\"index\":15},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-V\"},\"count\":-16775265,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":152},{\""
+    "entity_id\":155}]}}},{\"entity_number\":157,\"name\":\"decider-combinator\",\"position\":{\"x\":376,\"y\":-34.5},\"direc"
+    "tion\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"}"
+    ",\"constant\":32,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_cou"
+    "nt_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":158}],\"green\":[{\"entity_id\":159,\"circuit_id\""
+    ":1},{\"entity_id\":179,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":159,\"circuit_id\":2},{\"entity_id\":179,\"cir"
+    "cuit_id\":2}]}}},{\"entity_number\":158,\"name\":\"constant-combinator\",\"position\":{\"x\":374.5,\"y\":-34.5},\"contro"
+    "l_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16775120,\"index\":1"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16775119,\"index\":2},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"lubricant-barrel\"},\"count\":-16775118,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petrole"
+    "um-gas-barrel\"},\"count\":-16775117,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"co"
+    "unt\":-16775116,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16775115,\"index\":6},"
+    "{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16775114,\"index\":7},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"iron-stick\"},\"count\":-16775113,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},"
+    "\"count\":-16775112,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16775111,\"index\""
+    ":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16775110,\"index\":11},{\"signal\":{\"ty"
+    "pe\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16775109,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "processing-unit\"},\"count\":-16775108,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":"
+    "-16775107,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16775106,\"index\":"
+    "15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16775105,\"index\":16}]},\"connections\":"
+    "{\"1\":{\"red\":[{\"entity_id\":153},{\"entity_id\":157,\"circuit_id\":1}]}}},{\"entity_number\":159,\"name\":\"decider-"
+    "combinator\",\"position\":{\"x\":376,\"y\":-35.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_"
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":30,\"comparator\":\"=\",\"output_signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"enti"
+    "ty_id\":160}],\"green\":[{\"entity_id\":137,\"circuit_id\":1},{\"entity_id\":157,\"circuit_id\":1}]},\"2\":{\"red\":[{\""
+    "entity_id\":137,\"circuit_id\":2},{\"entity_id\":157,\"circuit_id\":2}]}}},{\"entity_number\":160,\"name\":\"constant-co"
+    "mbinator\",\"position\":{\"x\":374.5,\"y\":-35.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"na"
+    "me\":\"heavy-oil-barrel\"},\"count\":-16775248,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\""
+    "},\"count\":-16775247,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16775246,\"i"
+    "ndex\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16775245,\"index\":4},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16775244,\"index\":5},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"water-barrel\"},\"count\":-16775243,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"co"
+    "unt\":-16775242,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16775241,\"index\":8},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16775240,\"index\":9},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"empty-barrel\"},\"count\":-16775239,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circu"
+    "it\"},\"count\":-16775238,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-1677523"
+    "7,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16775236,\"index\":13},{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16775235,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"electric-engine-unit\"},\"count\":-16775234,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-fram"
+    "e\"},\"count\":-16775233,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":155},{\"entity_id\":159,\"circu"
+    "it_id\":1}]}}},{\"entity_number\":161,\"name\":\"constant-combinator\",\"position\":{\"x\":377.5,\"y\":-34.5},\"control_"
+    "behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16775104,\"index\":1},{\"si"
+    "gnal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16775103,\"index\":2},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-2\"},\"count\":-16775102,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\""
+    ":-16775101,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16775100,\"index\":5},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16775099,\"index\":6},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-6\"},\"count\":-16775098,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\""
+    ":-16775097,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16775096,\"index\":9},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16775095,\"index\":10},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-A\"},\"count\":-16775094,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\""
+    ":-16775093,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16775092,\"index\":13},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16775091,\"index\":14},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-E\"},\"count\":-16775090,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"cou"
+    "nt\":-16775089,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":164}]}}},{\"entity_number\":162,\"name\":"
+    "\"constant-combinator\",\"position\":{\"x\":377.5,\"y\":-35.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-0\"},\"count\":-16775232,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-"
+    "1\"},\"count\":-16775231,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16775230,\"ind"
+    "ex\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16775229,\"index\":4},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-4\"},\"count\":-16775228,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-"
+    "5\"},\"count\":-16775227,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16775226,\"ind"
+    "ex\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16775225,\"index\":8},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-8\"},\"count\":-16775224,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-"
+    "9\"},\"count\":-16775223,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16775222,\"in"
+    "dex\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16775221,\"index\":12},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16775220,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"sig"
+    "nal-D\"},\"count\":-16775219,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16775218,"
+    "\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16775217,\"index\":16}]},\"connections"
+    "\":{\"1\":{\"red\":[{\"entity_id\":166}]}}},{\"entity_number\":163,\"name\":\"constant-combinator\",\"position\":{\"x\":"
+    "379.5,\"y\":-34.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16775"
+    "072,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16775071,\"index\":2},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"stone\"},\"count\":-16775070,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"c"
+    "ount\":-16775069,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16775068,\"index\":5},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16775067,\"index\":6},{\"signal\":{\"type\":\"item\","
+    "\"name\":\"raw-fish\"},\"count\":-16775066,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\""
+    ":-16775065,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16775064,\"index\":9},{\"si"
+    "gnal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16775063,\"index\":10},{\"signal\":{\"type\":\"item\",\"na"
+    "me\":\"steel-plate\"},\"count\":-16775062,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count"
+    "\":-16775061,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16775060,\"index\":13},{\"sign"
+    "al\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16775059,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"explosives\"},\"count\":-16775058,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\""
+    ":-16775057,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":164},{\"entity_id\":168}]}}},{\"entity_number"
+    "\":164,\"name\":\"constant-combinator\",\"position\":{\"x\":378.5,\"y\":-34.5},\"control_behavior\":{\"filters\":[{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16775088,\"index\":1},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-H\"},\"count\":-16775087,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\""
+    ":-16775086,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16775085,\"index\":4},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16775084,\"index\":5},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-L\"},\"count\":-16775083,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"coun"
+    "t\":-16775082,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16775081,\"index\":8},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16775080,\"index\":9},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-P\"},\"count\":-16775079,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"cou"
+    "nt\":-16775078,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16775077,\"index\":12},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16775076,\"index\":13},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-T\"},\"count\":-16775075,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\""
+    "count\":-16775074,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16775073,\"index\":1"
+    "6}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":161},{\"entity_id\":163}]}}},{\"entity_number\":165,\"name\":\"cons"
+    "tant-combinator\",\"position\":{\"x\":379.5,\"y\":-35.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item"
+    "\",\"name\":\"wood\"},\"count\":-16775200,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-1677"
+    "5199,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16775198,\"index\":3},{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"iron-ore\"},\"count\":-16775197,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-or"
+    "e\"},\"count\":-16775196,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16775195,\"ind"
+    "ex\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16775194,\"index\":7},{\"signal\":{\"type\":\"i"
+    "tem\",\"name\":\"iron-plate\"},\"count\":-16775193,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\""
+    "},\"count\":-16775192,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16775191,\"index\""
+    ":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16775190,\"index\":11},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"plastic-bar\"},\"count\":-16775189,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\""
+    "count\":-16775188,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16775187,\"index\":14},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16775186,\"index\":15},{\"signal\":{\"type\":\"item\","
+    "\"name\":\"crude-oil-barrel\"},\"count\":-16775185,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":166},"
+    "{\"entity_id\":170}]}}},{\"entity_number\":166,\"name\":\"constant-combinator\",\"position\":{\"x\":378.5,\"y\":-35.5},\""
+    "control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16775216,\"index\":"
+    "1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16775215,\"index\":2},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-I\"},\"count\":-16775214,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},"
+    "\"count\":-16775213,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16775212,\"index\":"
+    "5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16775211,\"index\":6},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-pink\"},\"count\":-16775210,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\""
+    "},\"count\":-16775209,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16775208,\"index\""
+    ":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16775207,\"index\":10},{\"signal\":{\"type\":\"v"
+    "irtual\",\"name\":\"signal-Q\"},\"count\":-16775206,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\""
+    "},\"count\":-16775205,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16775204,\"index"
+    "\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16775203,\"index\":14},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-U\"},\"count\":-16775202,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-V\"},\"count\":-16775201,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":162},{\"entity_id\":165}]}}},{"
+    "\"entity_number\":167,\"name\":\"decider-combinator\",\"position\":{\"x\":382,\"y\":-34.5},\"direction\":2,\"control_beh"
+    "avior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":33,\"com"
+    "parator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}}"
+    ",\"connections\":{\"1\":{\"red\":[{\"entity_id\":168}],\"green\":[{\"entity_id\":169,\"circuit_id\":1},{\"entity_id\":18"
+    "9,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":169,\"circuit_id\":2},{\"entity_id\":189,\"circuit_id\":2}]}}},{\"e"
+    "ntity_number\":168,\"name\":\"constant-combinator\",\"position\":{\"x\":380.5,\"y\":-34.5},\"control_behavior\":{\"filte"
+    "rs\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16775056,\"index\":1},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16775055,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lu"
+    "bricant-barrel\"},\"count\":-16775054,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"c"
+    "ount\":-16775053,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16775052,\"in"
+    "dex\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16775051,\"index\":6},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"copper-cable\"},\"count\":-16775050,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-sti"
+    "ck\"},\"count\":-16775049,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16775048,"
+    "\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16775047,\"index\":10},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16775046,\"index\":11},{\"signal\":{\"type\":\"item\",\"name"
+    "\":\"advanced-circuit\"},\"count\":-16775045,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},"
+    "\"count\":-16775044,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16775043,\"index\""
+    ":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16775042,\"index\":15},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16775041,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\""
+    "entity_id\":163},{\"entity_id\":167,\"circuit_id\":1}]}}},{\"entity_number\":169,\"name\":\"decider-combinator\",\"posit"
+    "ion\":{\"x\":382,\"y\":-35.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-check\"},\"constant\":31,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name"
+    "\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":170}],\"green"
+    "\":[{\"entity_id\":147,\"circuit_id\":1},{\"entity_id\":167,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":147,\"cir"
+    "cuit_id\":2},{\"entity_id\":167,\"circuit_id\":2}]}}},{\"entity_number\":170,\"name\":\"constant-combinator\",\"position"
+    "\":{\"x\":380.5,\"y\":-35.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barr"
+    "el\"},\"count\":-16775184,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16775183"
+    ",\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16775182,\"index\":3},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16775181,\"index\":4},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"sulfuric-acid-barrel\"},\"count\":-16775180,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel"
+    "\"},\"count\":-16775179,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16775178,\"ind"
+    "ex\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16775177,\"index\":8},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"iron-gear-wheel\"},\"count\":-16775176,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-ba"
+    "rrel\"},\"count\":-16775175,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-167"
+    "75174,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16775173,\"index\":12},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16775172,\"index\":13},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"engine-unit\"},\"count\":-16775171,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-u"
+    "nit\"},\"count\":-16775170,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-1677"
+    "5169,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":165},{\"entity_id\":169,\"circuit_id\":1}]}}},{\"en"
+    "tity_number\":171,\"name\":\"constant-combinator\",\"position\":{\"x\":371.5,\"y\":-32.5},\"control_behavior\":{\"filter"
+    "s\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16774912,\"index\":1},{\"signal\":{\"type\":\"v"
+    "irtual\",\"name\":\"signal-1\"},\"count\":-16774911,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\""
+    "},\"count\":-16774910,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16774909,\"index\""
+    ":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16774908,\"index\":5},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-5\"},\"count\":-16774907,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"}"
+    ",\"count\":-16774906,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16774905,\"index\""
+    ":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16774904,\"index\":9},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-9\"},\"count\":-16774903,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\""
+    "},\"count\":-16774902,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16774901,\"index"
+    "\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16774900,\"index\":13},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-D\"},\"count\":-16774899,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-E\"},\"count\":-16774898,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16774897,\"i"
+    "ndex\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":174}]}}},{\"entity_number\":172,\"name\":\"constant-combina"
+    "tor\",\"position\":{\"x\":371.5,\"y\":-33.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name"
+    "\":\"signal-0\"},\"count\":-16775040,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16"
+    "775039,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16775038,\"index\":3},{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16775037,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-4\"},\"count\":-16775036,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-1677"
+    "5035,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16775034,\"index\":7},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16775033,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-8\"},\"count\":-16775032,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-1677"
+    "5031,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16775030,\"index\":11},{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16775029,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name"
+    "\":\"signal-C\"},\"count\":-16775028,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-1"
+    "6775027,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16775026,\"index\":15},{\"sign"
+    "al\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16775025,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{"
+    "\"entity_id\":176}]}}},{\"entity_number\":173,\"name\":\"constant-combinator\",\"position\":{\"x\":373.5,\"y\":-32.5},\""
+    "control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16774880,\"index\":1},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16774879,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "stone\"},\"count\":-16774878,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16774877,\"in"
+    "dex\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16774876,\"index\":5},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"uranium-ore\"},\"count\":-16774875,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\""
+    "},\"count\":-16774874,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16774873,\"index\""
+    ":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16774872,\"index\":9},{\"signal\":{\"type\":\"i"
+    "tem\",\"name\":\"solid-fuel\"},\"count\":-16774871,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\""
+    "},\"count\":-16774870,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16774869,\"index"
+    "\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16774868,\"index\":13},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"battery\"},\"count\":-16774867,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"co"
+    "unt\":-16774866,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16774865,\"index\""
+    ":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":174},{\"entity_id\":178}]}}},{\"entity_number\":174,\"name\":\"co"
+    "nstant-combinator\",\"position\":{\"x\":372.5,\"y\":-32.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-G\"},\"count\":-16774896,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"}"
+    ",\"count\":-16774895,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16774894,\"index\""
+    ":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16774893,\"index\":4},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-K\"},\"count\":-16774892,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"}"
+    ",\"count\":-16774891,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16774890,\"inde"
+    "x\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16774889,\"index\":8},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-O\"},\"count\":-16774888,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\""
+    "},\"count\":-16774887,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16774886,\"index"
+    "\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16774885,\"index\":12},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-S\"},\"count\":-16774884,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-T\"},\"count\":-16774883,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16774882,\"i"
+    "ndex\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16774881,\"index\":16}]},\"connections\":"
+    "{\"1\":{\"red\":[{\"entity_id\":171},{\"entity_id\":173}]}}},{\"entity_number\":175,\"name\":\"constant-combinator\",\"p"
+    "osition\":{\"x\":373.5,\"y\":-33.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"}"
+    ",\"count\":-16775008,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16775007,\"index\":2},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16775006,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"iron-ore\"},\"count\":-16775005,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16775"
+    "004,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16775003,\"index\":6},{\"signal\":{"
+    "\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16775002,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron"
+    "-plate\"},\"count\":-16775001,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16775000"
+    ",\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16774999,\"index\":10},{\"signal\":{\"t"
+    "ype\":\"item\",\"name\":\"steel-plate\"},\"count\":-16774998,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"pla"
+    "stic-bar\"},\"count\":-16774997,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16774996,\""
+    "index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16774995,\"index\":14},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"explosives\"},\"count\":-16774994,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil"
+    "-barrel\"},\"count\":-16774993,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":176},{\"entity_id\":180}]"
+    "}}},{\"entity_number\":176,\"name\":\"constant-combinator\",\"position\":{\"x\":372.5,\"y\":-33.5},\"control_behavior\":"
+    "{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16775024,\"index\":1},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16775023,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-I\"},\"count\":-16775022,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16775021"
+    ",\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16775020,\"index\":5},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16775019,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-pink\"},\"count\":-16775018,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16775"
+    "017,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16775016,\"index\":9},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16775015,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-Q\"},\"count\":-16775014,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-167"
+    "75013,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16775012,\"index\":13},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16775011,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-U\"},\"count\":-16775010,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":"
+    "-16775009,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":172},{\"entity_id\":175}]}}},{\"entity_number\""
+    ":177,\"name\":\"decider-combinator\",\"position\":{\"x\":376,\"y\":-32.5},\"direction\":2,\"control_behavior\":{\"decide"
+    "r_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":36,\"comparator\":\"=\",\""
+    "output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{"
+    "\"1\":{\"red\":[{\"entity_id\":178}],\"green\":[{\"entity_id\":179,\"circuit_id\":1},{\"entity_id\":199,\"circuit_id\":1"
+    "}]},\"2\":{\"red\":[{\"entity_id\":179,\"circuit_id\":2},{\"entity_id\":199,\"circuit_id\":2}]}}},{\"entity_number\":178"
+    ",\"name\":\"constant-combinator\",\"position\":{\"x\":374.5,\"y\":-32.5},\"control_behavior\":{\"filters\":[{\"signal\":"
+    "{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16774864,\"index\":1},{\"signal\":{\"type\":\"item\",\"name"
+    "\":\"light-oil-barrel\"},\"count\":-16774863,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},"
+    "\"count\":-16774862,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16774861,\""
+    "index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16774860,\"index\":5},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16774859,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"copper-cable\"},\"count\":-16774858,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16"
+    "774857,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16774856,\"index\":9},{\"sig"
+    "nal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16774855,\"index\":10},{\"signal\":{\"type\":\"item\",\"n"
+    "ame\":\"electronic-circuit\"},\"count\":-16774854,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circu"
+    "it\"},\"count\":-16774853,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16774852"
+    ",\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16774851,\"index\":14},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16774850,\"index\":15},{\"signal\":{\"type\":\"item\",\"na"
+    "me\":\"flying-robot-frame\"},\"count\":-16774849,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":173},{\""
+    "entity_id\":177,\"circuit_id\":1}]}}},{\"entity_number\":179,\"name\":\"decider-combinator\",\"position\":{\"x\":376,\"y"
+    "\":-33.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":"
+    "\"signal-check\"},\"constant\":34,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everyth"
+    "ing\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":180}],\"green\":[{\"entity_id\":"
+    "157,\"circuit_id\":1},{\"entity_id\":177,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":157,\"circuit_id\":2},{\"ent"
+    "ity_id\":177,\"circuit_id\":2}]}}},{\"entity_number\":180,\"name\":\"constant-combinator\",\"position\":{\"x\":374.5,\"y"
+    "\":-33.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16"
+    "774992,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16774991,\"index\":2},{\"si"
+    "gnal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16774990,\"index\":3},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"petroleum-gas-barrel\"},\"count\":-16774989,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-"
+    "acid-barrel\"},\"count\":-16774988,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-167"
+    "74987,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16774986,\"index\":7},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16774985,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "iron-gear-wheel\"},\"count\":-16774984,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":"
+    "-16774983,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16774982,\"index\":11"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16774981,\"index\":12},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"processing-unit\"},\"count\":-16774980,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engin"
+    "e-unit\"},\"count\":-16774979,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":"
+    "-16774978,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16774977,\"index\":16"
+    "}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":175},{\"entity_id\":179,\"circuit_id\":1}]}}},{\"entity_number\":181"
+    ",\"name\":\"constant-combinator\",\"position\":{\"x\":377.5,\"y\":-32.5},\"control_behavior\":{\"filters\":[{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16774848,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-1\"},\"count\":-16774847,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-1677"
+    "4846,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16774845,\"index\":4},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16774844,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-5\"},\"count\":-16774843,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-1677"
+    "4842,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16774841,\"index\":8},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16774840,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-9\"},\"count\":-16774839,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-167"
+    "74838,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16774837,\"index\":12},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16774836,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-D\"},\"count\":-16774835,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":"
+    "-16774834,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16774833,\"index\":16}]},\"c"
+    "onnections\":{\"1\":{\"red\":[{\"entity_id\":184}]}}},{\"entity_number\":182,\"name\":\"constant-combinator\",\"position"
+    "\":{\"x\":377.5,\"y\":-33.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"}"
+    ",\"count\":-16774976,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16774975,\"index\""
+    ":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16774974,\"index\":3},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-3\"},\"count\":-16774973,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"}"
+    ",\"count\":-16774972,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16774971,\"index\""
+    ":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16774970,\"index\":7},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-7\"},\"count\":-16774969,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"}"
+    ",\"count\":-16774968,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16774967,\"index\""
+    ":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16774966,\"index\":11},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-B\"},\"count\":-16774965,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C"
+    "\"},\"count\":-16774964,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16774963,\"ind"
+    "ex\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16774962,\"index\":15},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-F\"},\"count\":-16774961,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":"
+    "186}]}}},{\"entity_number\":183,\"name\":\"constant-combinator\",\"position\":{\"x\":379.5,\"y\":-32.5},\"control_behavi"
+    "or\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16774816,\"index\":1},{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"coal\"},\"count\":-16774815,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"co"
+    "unt\":-16774814,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16774813,\"index\":4},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16774812,\"index\":5},{\"signal\":{\"type\":\"item\",\"na"
+    "me\":\"uranium-ore\"},\"count\":-16774811,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-"
+    "16774810,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16774809,\"index\":8},{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16774808,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"solid-fuel\"},\"count\":-16774807,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-1"
+    "6774806,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16774805,\"index\":12},{\"sign"
+    "al\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16774804,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "battery\"},\"count\":-16774803,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16774802"
+    ",\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16774801,\"index\":16}]},\"conne"
+    "ctions\":{\"1\":{\"red\":[{\"entity_id\":184},{\"entity_id\":188}]}}},{\"entity_number\":184,\"name\":\"constant-combina"
+    "tor\",\"position\":{\"x\":378.5,\"y\":-32.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name"
+    "\":\"signal-G\"},\"count\":-16774832,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16"
+    "774831,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16774830,\"index\":3},{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16774829,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-K\"},\"count\":-16774828,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-1677"
+    "4827,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16774826,\"index\":7},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16774825,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"nam"
+    "e\":\"signal-O\"},\"count\":-16774824,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-1"
+    "6774823,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16774822,\"index\":11},{\"sign"
+    "al\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16774821,\"index\":12},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-S\"},\"count\":-16774820,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\""
+    ":-16774819,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16774818,\"index\":15},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16774817,\"index\":16}]},\"connections\":{\"1\":{\"red\""
+    ":[{\"entity_id\":181},{\"entity_id\":183}]}}},{\"entity_number\":185,\"name\":\"constant-combinator\",\"position\":{\"x\""
+    ":379.5,\"y\":-33.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-1677"
+    "4944,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16774943,\"index\":2},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"stone\"},\"count\":-16774942,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\""
+    "count\":-16774941,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16774940,\"index\":5},"
+    "{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16774939,\"index\":6},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"raw-fish\"},\"count\":-16774938,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count"
+    "\":-16774937,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16774936,\"index\":9},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16774935,\"index\":10},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"steel-plate\"},\"count\":-16774934,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"cou"
+    "nt\":-16774933,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16774932,\"index\":13},{\"si"
+    "gnal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16774931,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"explosives\"},\"count\":-16774930,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count"
+    "\":-16774929,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":186},{\"entity_id\":190}]}}},{\"entity_numb"
+    "er\":186,\"name\":\"constant-combinator\",\"position\":{\"x\":378.5,\"y\":-33.5},\"control_behavior\":{\"filters\":[{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16774960,\"index\":1},{\"signal\":{\"type\":\"virtual\","
+    "\"name\":\"signal-H\"},\"count\":-16774959,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count"
+    "\":-16774958,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16774957,\"index\":4},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16774956,\"index\":5},{\"signal\":{\"type\":\"virtual\","
+    "\"name\":\"signal-L\"},\"count\":-16774955,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"co"
+    "unt\":-16774954,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16774953,\"index\":8},{"
+    "\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16774952,\"index\":9},{\"signal\":{\"type\":\"virtual"
+    "\",\"name\":\"signal-P\"},\"count\":-16774951,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"c"
+    "ount\":-16774950,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16774949,\"index\":12"
+    "},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16774948,\"index\":13},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-T\"},\"count\":-16774947,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"}"
+    ",\"count\":-16774946,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16774945,\"index\""
+    ":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":182},{\"entity_id\":185}]}}},{\"entity_number\":187,\"name\":\"de"
+    "cider-combinator\",\"position\":{\"x\":382,\"y\":-32.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\""
+    "first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":37,\"comparator\":\"=\",\"output_signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{"
+    "\"entity_id\":188}],\"green\":[{\"entity_id\":189,\"circuit_id\":1},{\"entity_id\":209,\"circuit_id\":1}]},\"2\":{\"red\""
+    ":[{\"entity_id\":189,\"circuit_id\":2},{\"entity_id\":209,\"circuit_id\":2}]}}},{\"entity_number\":188,\"name\":\"consta"
+    "nt-combinator\",\"position\":{\"x\":380.5,\"y\":-32.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"heavy-oil-barrel\"},\"count\":-16774800,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-bar"
+    "rel\"},\"count\":-16774799,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-1677479"
+    "8,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16774797,\"index\":4},{\"sig"
+    "nal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16774796,\"index\":5},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"water-barrel\"},\"count\":-16774795,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\""
+    "},\"count\":-16774794,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16774793,\"index\""
+    ":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16774792,\"index\":9},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"empty-barrel\"},\"count\":-16774791,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electron"
+    "ic-circuit\"},\"count\":-16774790,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":"
+    "-16774789,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16774788,\"index\":13},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16774787,\"index\":14},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"electric-engine-unit\"},\"count\":-16774786,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-r"
+    "obot-frame\"},\"count\":-16774785,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":183},{\"entity_id\":18"
+    "7,\"circuit_id\":1}]}}},{\"entity_number\":189,\"name\":\"decider-combinator\",\"position\":{\"x\":382,\"y\":-33.5},\"di"
+    "rection\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check"
+    "\"},\"constant\":35,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_"
+    "count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":190}],\"green\":[{\"entity_id\":167,\"circuit_"
+    "id\":1},{\"entity_id\":187,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":167,\"circuit_id\":2},{\"entity_id\":187,\""
+    "circuit_id\":2}]}}},{\"entity_number\":190,\"name\":\"constant-combinator\",\"position\":{\"x\":380.5,\"y\":-33.5},\"con"
+    "trol_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16774928,\"index\""
+    ":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16774927,\"index\":2},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16774926,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petr"
+    "oleum-gas-barrel\"},\"count\":-16774925,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\""
+    "count\":-16774924,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16774923,\"index\":6"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16774922,\"index\":7},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"iron-stick\"},\"count\":-16774921,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\""
+    "},\"count\":-16774920,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16774919,\"index"
+    "\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16774918,\"index\":11},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16774917,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"processing-unit\"},\"count\":-16774916,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count"
+    "\":-16774915,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16774914,\"index"
+    "\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16774913,\"index\":16}]},\"connections"
+    "\":{\"1\":{\"red\":[{\"entity_id\":185},{\"entity_id\":189,\"circuit_id\":1}]}}},{\"entity_number\":191,\"name\":\"const"
+    "ant-combinator\",\"position\":{\"x\":371.5,\"y\":-30.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-0\"},\"count\":-16774656,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\""
+    "count\":-16774655,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16774654,\"index\":3}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16774653,\"index\":4},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-4\"},\"count\":-16774652,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\""
+    "count\":-16774651,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16774650,\"index\":7}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16774649,\"index\":8},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-8\"},\"count\":-16774648,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\""
+    "count\":-16774647,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16774646,\"index\":1"
+    "1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16774645,\"index\":12},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-C\"},\"count\":-16774644,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\""
+    "},\"count\":-16774643,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16774642,\"index"
+    "\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16774641,\"index\":16}]},\"connections\":{\"1"
+    "\":{\"red\":[{\"entity_id\":194}]}}},{\"entity_number\":192,\"name\":\"constant-combinator\",\"position\":{\"x\":371.5,\""
+    "y\":-31.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-167747"
+    "84,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16774783,\"index\":2},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16774782,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-3\"},\"count\":-16774781,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-1677478"
+    "0,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16774779,\"index\":6},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16774778,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-7\"},\"count\":-16774777,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-1677477"
+    "6,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16774775,\"index\":10},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16774774,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-B\"},\"count\":-16774773,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-167747"
+    "72,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16774771,\"index\":14},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16774770,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-F\"},\"count\":-16774769,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":196}]}}},{\"entity_nu"
+    "mber\":193,\"name\":\"constant-combinator\",\"position\":{\"x\":373.5,\"y\":-30.5},\"control_behavior\":{\"filters\":[{\""
+    "signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16774624,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"coal\"},\"count\":-16774623,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16774622,\"inde"
+    "x\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16774621,\"index\":4},{\"signal\":{\"type\":\"it"
+    "em\",\"name\":\"copper-ore\"},\"count\":-16774620,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},"
+    "\"count\":-16774619,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16774618,\"index\":7},"
+    "{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16774617,\"index\":8},{\"signal\":{\"type\":\"item\","
+    "\"name\":\"copper-plate\"},\"count\":-16774616,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"co"
+    "unt\":-16774615,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16774614,\"index\":11}"
+    ",{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16774613,\"index\":12},{\"signal\":{\"type\":\"item"
+    "\",\"name\":\"sulfur\"},\"count\":-16774612,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\""
+    ":-16774611,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16774610,\"index\":15},{\"si"
+    "gnal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16774609,\"index\":16}]},\"connections\":{\"1\":{\"r"
+    "ed\":[{\"entity_id\":194},{\"entity_id\":198}]}}},{\"entity_number\":194,\"name\":\"constant-combinator\",\"position\":{"
+    "\"x\":372.5,\"y\":-30.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"c"
+    "ount\":-16774640,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16774639,\"index\":2},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16774638,\"index\":3},{\"signal\":{\"type\":\"virtua"
+    "l\",\"name\":\"signal-J\"},\"count\":-16774637,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"c"
+    "ount\":-16774636,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16774635,\"index\":6},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16774634,\"index\":7},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-N\"},\"count\":-16774633,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},"
+    "\"count\":-16774632,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16774631,\"index\":"
+    "10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16774630,\"index\":11},{\"signal\":{\"type\":\"v"
+    "irtual\",\"name\":\"signal-R\"},\"count\":-16774629,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\""
+    "},\"count\":-16774628,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16774627,\"index"
+    "\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16774626,\"index\":15},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-V\"},\"count\":-16774625,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":1"
+    "91},{\"entity_id\":193}]}}},{\"entity_number\":195,\"name\":\"constant-combinator\",\"position\":{\"x\":373.5,\"y\":-31."
+    "5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16774752,\"index\":1}"
+    ",{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16774751,\"index\":2},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"stone\"},\"count\":-16774750,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-1677474"
+    "9,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16774748,\"index\":5},{\"signal\":{\"t"
+    "ype\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16774747,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-"
+    "fish\"},\"count\":-16774746,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16774745,\"i"
+    "ndex\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16774744,\"index\":9},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16774743,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-p"
+    "late\"},\"count\":-16774742,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16774741,\""
+    "index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16774740,\"index\":13},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"battery\"},\"count\":-16774739,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"}"
+    ",\"count\":-16774738,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16774737,\"i"
+    "ndex\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":196},{\"entity_id\":200}]}}},{\"entity_number\":196,\"name\""
+    ":\"constant-combinator\",\"position\":{\"x\":372.5,\"y\":-31.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-G\"},\"count\":-16774768,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-H\"},\"count\":-16774767,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16774766,\"in"
+    "dex\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16774765,\"index\":4},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-K\"},\"count\":-16774764,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-L\"},\"count\":-16774763,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16774762,\""
+    "index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16774761,\"index\":8},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16774760,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-P\"},\"count\":-16774759,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16774758,\""
+    "index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16774757,\"index\":12},{\"signal\":{\"ty"
+    "pe\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16774756,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-T\"},\"count\":-16774755,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-1677475"
+    "4,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16774753,\"index\":16}]},\"connectio"
+    "ns\":{\"1\":{\"red\":[{\"entity_id\":192},{\"entity_id\":195}]}}},{\"entity_number\":197,\"name\":\"decider-combinator\""
+    ",\"position\":{\"x\":376,\"y\":-30.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":40,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual"
+    "\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":198}"
+    "],\"green\":[{\"entity_id\":199,\"circuit_id\":1},{\"entity_id\":219,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":"
+    "199,\"circuit_id\":2},{\"entity_id\":219,\"circuit_id\":2}]}}},{\"entity_number\":198,\"name\":\"constant-combinator\",\""
+    "position\":{\"x\":374.5,\"y\":-30.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-"
+    "oil-barrel\"},\"count\":-16774608,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-"
+    "16774607,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16774606,\"index\":3},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16774605,\"index\":4},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16774604,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"wat"
+    "er-barrel\"},\"count\":-16774603,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16774"
+    "602,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16774601,\"index\":8},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16774600,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "empty-barrel\"},\"count\":-16774599,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"coun"
+    "t\":-16774598,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16774597,\"index\":"
+    "12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16774596,\"index\":13},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"engine-unit\"},\"count\":-16774595,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric"
+    "-engine-unit\"},\"count\":-16774594,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"coun"
+    "t\":-16774593,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":193},{\"entity_id\":197,\"circuit_id\":1}]"
+    "}}},{\"entity_number\":199,\"name\":\"decider-combinator\",\"position\":{\"x\":376,\"y\":-31.5},\"direction\":2,\"contro"
+    "l_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":38,"
+    "\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":t"
+    "rue}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":200}],\"green\":[{\"entity_id\":177,\"circuit_id\":1},{\"entity_id"
+    "\":197,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":177,\"circuit_id\":2},{\"entity_id\":197,\"circuit_id\":2}]}}}"
+    ",{\"entity_number\":200,\"name\":\"constant-combinator\",\"position\":{\"x\":374.5,\"y\":-31.5},\"control_behavior\":{\""
+    "filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16774736,\"index\":1},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16774735,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"lubricant-barrel\"},\"count\":-16774734,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"}"
+    ",\"count\":-16774733,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16774732,"
+    "\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16774731,\"index\":6},{\"signal\":{\"t"
+    "ype\":\"item\",\"name\":\"copper-cable\"},\"count\":-16774730,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iro"
+    "n-stick\"},\"count\":-16774729,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-1677"
+    "4728,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16774727,\"index\":10},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16774726,\"index\":11},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"advanced-circuit\"},\"count\":-16774725,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit"
+    "\"},\"count\":-16774724,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16774723,\"ind"
+    "ex\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16774722,\"index\":15},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16774721,\"index\":16}]},\"connections\":{\"1\":{\"red\""
+    ":[{\"entity_id\":195},{\"entity_id\":199,\"circuit_id\":1}]}}},{\"entity_number\":201,\"name\":\"constant-combinator\",\""
+    "position\":{\"x\":377.5,\"y\":-30.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"sig"
+    "nal-0\"},\"count\":-16774592,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16774591,\""
+    "index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16774590,\"index\":3},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16774589,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-4\"},\"count\":-16774588,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16774587,\""
+    "index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16774586,\"index\":7},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16774585,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-8\"},\"count\":-16774584,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16774583,\""
+    "index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16774582,\"index\":11},{\"signal\":{\"ty"
+    "pe\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16774581,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-C\"},\"count\":-16774580,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-1677457"
+    "9,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16774578,\"index\":15},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16774577,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"enti"
+    "ty_id\":204}]}}},{\"entity_number\":202,\"name\":\"constant-combinator\",\"position\":{\"x\":377.5,\"y\":-31.5},\"contro"
+    "l_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16774720,\"index\":1},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16774719,\"index\":2},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-2\"},\"count\":-16774718,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"coun"
+    "t\":-16774717,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16774716,\"index\":5},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16774715,\"index\":6},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-6\"},\"count\":-16774714,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"coun"
+    "t\":-16774713,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16774712,\"index\":9},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16774711,\"index\":10},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-A\"},\"count\":-16774710,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"cou"
+    "nt\":-16774709,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16774708,\"index\":13},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16774707,\"index\":14},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-E\"},\"count\":-16774706,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\""
+    "count\":-16774705,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":206}]}}},{\"entity_number\":203,\"name"
+    "\":\"constant-combinator\",\"position\":{\"x\":379.5,\"y\":-30.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"wood\"},\"count\":-16774560,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"coun"
+    "t\":-16774559,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16774558,\"index\":3},{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16774557,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "copper-ore\"},\"count\":-16774556,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16774"
+    "555,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16774554,\"index\":7},{\"signal\":{\"t"
+    "ype\":\"item\",\"name\":\"iron-plate\"},\"count\":-16774553,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"coppe"
+    "r-plate\"},\"count\":-16774552,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16774551,"
+    "\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16774550,\"index\":11},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16774549,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"su"
+    "lfur\"},\"count\":-16774548,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16774547,\"ind"
+    "ex\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16774546,\"index\":15},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16774545,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_"
+    "id\":204},{\"entity_id\":208}]}}},{\"entity_number\":204,\"name\":\"constant-combinator\",\"position\":{\"x\":378.5,\"y\""
+    ":-30.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16774576,"
+    "\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16774575,\"index\":2},{\"signal\":{\"ty"
+    "pe\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16774574,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"si"
+    "gnal-J\"},\"count\":-16774573,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16774572,"
+    "\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16774571,\"index\":6},{\"signal\":{\"ty"
+    "pe\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16774570,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-N\"},\"count\":-16774569,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-1677456"
+    "8,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16774567,\"index\":10},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16774566,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-R\"},\"count\":-16774565,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-167745"
+    "64,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16774563,\"index\":14},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16774562,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-V\"},\"count\":-16774561,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":201},{\"entity_id\":2"
+    "03}]}}},{\"entity_number\":205,\"name\":\"constant-combinator\",\"position\":{\"x\":379.5,\"y\":-31.5},\"control_behavio"
+    "r\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16774688,\"index\":1},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"coal\"},\"count\":-16774687,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"cou"
+    "nt\":-16774686,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16774685,\"index\":4},{\"si"
+    "gnal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16774684,\"index\":5},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"uranium-ore\"},\"count\":-16774683,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-1"
+    "6774682,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16774681,\"index\":8},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16774680,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"solid-fuel\"},\"count\":-16774679,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16"
+    "774678,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16774677,\"index\":12},{\"signa"
+    "l\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16774676,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "battery\"},\"count\":-16774675,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16774674"
+    ",\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16774673,\"index\":16}]},\"conne"
+    "ctions\":{\"1\":{\"red\":[{\"entity_id\":206},{\"entity_id\":210}]}}},{\"entity_number\":206,\"name\":\"constant-combina"
+    "tor\",\"position\":{\"x\":378.5,\"y\":-31.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name"
+    "\":\"signal-G\"},\"count\":-16774704,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16"
+    "774703,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16774702,\"index\":3},{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16774701,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-K\"},\"count\":-16774700,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-1677"
+    "4699,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16774698,\"index\":7},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16774697,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"nam"
+    "e\":\"signal-O\"},\"count\":-16774696,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-1"
+    "6774695,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16774694,\"index\":11},{\"sign"
+    "al\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16774693,\"index\":12},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-S\"},\"count\":-16774692,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\""
+    ":-16774691,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16774690,\"index\":15},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16774689,\"index\":16}]},\"connections\":{\"1\":{\"red\""
+    ":[{\"entity_id\":202},{\"entity_id\":205}]}}},{\"entity_number\":207,\"name\":\"decider-combinator\",\"position\":{\"x\""
+    ":382,\"y\":-30.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-check\"},\"constant\":41,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-"
+    "everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":208}],\"green\":[{\"entit"
+    "y_id\":209,\"circuit_id\":1},{\"entity_id\":229,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":209,\"circuit_id\":2}"
+    ",{\"entity_id\":229,\"circuit_id\":2}]}}},{\"entity_number\":208,\"name\":\"constant-combinator\",\"position\":{\"x\":38"
+    "0.5,\"y\":-30.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"coun"
+    "t\":-16774544,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16774543,\"index\":2"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16774542,\"index\":3},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16774541,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sul"
+    "furic-acid-barrel\"},\"count\":-16774540,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\""
+    ":-16774539,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16774538,\"index\":7},{\"si"
+    "gnal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16774537,\"index\":8},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"iron-gear-wheel\"},\"count\":-16774536,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"co"
+    "unt\":-16774535,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16774534,\"inde"
+    "x\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16774533,\"index\":12},{\"signal\":{\"t"
+    "ype\":\"item\",\"name\":\"processing-unit\"},\"count\":-16774532,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "engine-unit\"},\"count\":-16774531,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"cou"
+    "nt\":-16774530,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16774529,\"index"
+    "\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":203},{\"entity_id\":207,\"circuit_id\":1}]}}},{\"entity_number\""
+    ":209,\"name\":\"decider-combinator\",\"position\":{\"x\":382,\"y\":-31.5},\"direction\":2,\"control_behavior\":{\"decide"
+    "r_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":39,\"comparator\":\"=\",\""
+    "output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{"
+    "\"1\":{\"red\":[{\"entity_id\":210}],\"green\":[{\"entity_id\":187,\"circuit_id\":1},{\"entity_id\":207,\"circuit_id\":1"
+    "}]},\"2\":{\"red\":[{\"entity_id\":187,\"circuit_id\":2},{\"entity_id\":207,\"circuit_id\":2}]}}},{\"entity_number\":210"
+    ",\"name\":\"constant-combinator\",\"position\":{\"x\":380.5,\"y\":-31.5},\"control_behavior\":{\"filters\":[{\"signal\":"
+    "{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16774672,\"index\":1},{\"signal\":{\"type\":\"item\",\"name"
+    "\":\"light-oil-barrel\"},\"count\":-16774671,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},"
+    "\"count\":-16774670,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16774669,\""
+    "index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16774668,\"index\":5},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16774667,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"copper-cable\"},\"count\":-16774666,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16"
+    "774665,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16774664,\"index\":9},{\"sig"
+    "nal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16774663,\"index\":10},{\"signal\":{\"type\":\"item\",\"n"
+    "ame\":\"electronic-circuit\"},\"count\":-16774662,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circu"
+    "it\"},\"count\":-16774661,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16774660"
+    ",\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16774659,\"index\":14},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16774658,\"index\":15},{\"signal\":{\"type\":\"item\",\"na"
+    "me\":\"flying-robot-frame\"},\"count\":-16774657,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":205},{\""
+    "entity_id\":209,\"circuit_id\":1}]}}},{\"entity_number\":211,\"name\":\"constant-combinator\",\"position\":{\"x\":371.5,"
+    "\"y\":-28.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-1677"
+    "4400,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16774399,\"index\":2},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16774398,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-3\"},\"count\":-16774397,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-1677"
+    "4396,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16774395,\"index\":6},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16774394,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-7\"},\"count\":-16774393,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-1677"
+    "4392,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16774391,\"index\":10},{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16774390,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name"
+    "\":\"signal-B\"},\"count\":-16774389,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-1"
+    "6774388,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16774387,\"index\":14},{\"sign"
+    "al\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16774386,\"index\":15},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-F\"},\"count\":-16774385,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":214}]}}},{\"ent"
+    "ity_number\":212,\"name\":\"constant-combinator\",\"position\":{\"x\":371.5,\"y\":-29.5},\"control_behavior\":{\"filters"
+    "\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16774528,\"index\":1},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-1\"},\"count\":-16774527,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"}"
+    ",\"count\":-16774526,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16774525,\"index\""
+    ":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16774524,\"index\":5},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-5\"},\"count\":-16774523,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"}"
+    ",\"count\":-16774522,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16774521,\"index\""
+    ":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16774520,\"index\":9},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-9\"},\"count\":-16774519,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\""
+    "},\"count\":-16774518,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16774517,\"index"
+    "\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16774516,\"index\":13},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-D\"},\"count\":-16774515,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-E\"},\"count\":-16774514,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16774513,\"i"
+    "ndex\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":216}]}}},{\"entity_number\":213,\"name\":\"constant-combina"
+    "tor\",\"position\":{\"x\":373.5,\"y\":-28.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"wood\"},\"count\":-16774368,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16774367,\"index"
+    "\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16774366,\"index\":3},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"iron-ore\"},\"count\":-16774365,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count"
+    "\":-16774364,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16774363,\"index\":6},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16774362,\"index\":7},{\"signal\":{\"type\":\"item\",\"name"
+    "\":\"iron-plate\"},\"count\":-16774361,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":"
+    "-16774360,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16774359,\"index\":10},{\"sign"
+    "al\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16774358,\"index\":11},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"plastic-bar\"},\"count\":-16774357,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16"
+    "774356,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16774355,\"index\":14},{\"signal\":"
+    "{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16774354,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "crude-oil-barrel\"},\"count\":-16774353,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":214},{\"entity_i"
+    "d\":218}]}}},{\"entity_number\":214,\"name\":\"constant-combinator\",\"position\":{\"x\":372.5,\"y\":-28.5},\"control_be"
+    "havior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16774384,\"index\":1},{\"sign"
+    "al\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16774383,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"n"
+    "ame\":\"signal-I\"},\"count\":-16774382,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":"
+    "-16774381,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16774380,\"index\":5},{\"sign"
+    "al\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16774379,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"n"
+    "ame\":\"signal-pink\"},\"count\":-16774378,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count"
+    "\":-16774377,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16774376,\"index\":9},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16774375,\"index\":10},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-Q\"},\"count\":-16774374,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"cou"
+    "nt\":-16774373,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16774372,\"index\":13},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16774371,\"index\":14},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-U\"},\"count\":-16774370,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\""
+    "count\":-16774369,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":211},{\"entity_id\":213}]}}},{\"entity"
+    "_number\":215,\"name\":\"constant-combinator\",\"position\":{\"x\":373.5,\"y\":-29.5},\"control_behavior\":{\"filters\":"
+    "[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16774496,\"index\":1},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"coal\"},\"count\":-16774495,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16774494,\""
+    "index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16774493,\"index\":4},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"copper-ore\"},\"count\":-16774492,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore"
+    "\"},\"count\":-16774491,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16774490,\"index\""
+    ":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16774489,\"index\":8},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"copper-plate\"},\"count\":-16774488,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},"
+    "\"count\":-16774487,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16774486,\"index\""
+    ":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16774485,\"index\":12},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"sulfur\"},\"count\":-16774484,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"cou"
+    "nt\":-16774483,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16774482,\"index\":15},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16774481,\"index\":16}]},\"connections\":{\"1\":"
+    "{\"red\":[{\"entity_id\":216},{\"entity_id\":220}]}}},{\"entity_number\":216,\"name\":\"constant-combinator\",\"position"
+    "\":{\"x\":372.5,\"y\":-29.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"}"
+    ",\"count\":-16774512,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16774511,\"index\""
+    ":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16774510,\"index\":3},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-J\"},\"count\":-16774509,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"}"
+    ",\"count\":-16774508,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16774507,\"index\""
+    ":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16774506,\"index\":7},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-N\"},\"count\":-16774505,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\""
+    "},\"count\":-16774504,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16774503,\"index\""
+    ":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16774502,\"index\":11},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-R\"},\"count\":-16774501,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S"
+    "\"},\"count\":-16774500,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16774499,\"ind"
+    "ex\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16774498,\"index\":15},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-V\"},\"count\":-16774497,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":"
+    "212},{\"entity_id\":215}]}}},{\"entity_number\":217,\"name\":\"decider-combinator\",\"position\":{\"x\":376,\"y\":-28.5}"
+    ",\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-"
+    "check\"},\"constant\":44,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\""
+    "copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":218}],\"green\":[{\"entity_id\":219,\"cir"
+    "cuit_id\":1},{\"entity_id\":239,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":219,\"circuit_id\":2},{\"entity_id\":"
+    "239,\"circuit_id\":2}]}}},{\"entity_number\":218,\"name\":\"constant-combinator\",\"position\":{\"x\":374.5,\"y\":-28.5}"
+    ",\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16774352,\""
+    "index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16774351,\"index\":2},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16774350,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"petroleum-gas-barrel\"},\"count\":-16774349,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barre"
+    "l\"},\"count\":-16774348,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16774347,\"in"
+    "dex\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16774346,\"index\":7},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"iron-stick\"},\"count\":-16774345,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-"
+    "wheel\"},\"count\":-16774344,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16774343,"
+    "\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16774342,\"index\":11},{\"signa"
+    "l\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16774341,\"index\":12},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"processing-unit\"},\"count\":-16774340,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\""
+    "count\":-16774339,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16774338,\""
+    "index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16774337,\"index\":16}]},\"connec"
+    "tions\":{\"1\":{\"red\":[{\"entity_id\":213},{\"entity_id\":217,\"circuit_id\":1}]}}},{\"entity_number\":219,\"name\":\""
+    "decider-combinator\",\"position\":{\"x\":376,\"y\":-29.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{"
+    "\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":42,\"comparator\":\"=\",\"output_signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":"
+    "[{\"entity_id\":220}],\"green\":[{\"entity_id\":197,\"circuit_id\":1},{\"entity_id\":217,\"circuit_id\":1}]},\"2\":{\"re"
+    "d\":[{\"entity_id\":197,\"circuit_id\":2},{\"entity_id\":217,\"circuit_id\":2}]}}},{\"entity_number\":220,\"name\":\"con"
+    "stant-combinator\",\"position\":{\"x\":374.5,\"y\":-29.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"heavy-oil-barrel\"},\"count\":-16774480,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-"
+    "barrel\"},\"count\":-16774479,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-1677"
+    "4478,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16774477,\"index\":4},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16774476,\"index\":5},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"water-barrel\"},\"count\":-16774475,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cabl"
+    "e\"},\"count\":-16774474,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16774473,\"inde"
+    "x\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16774472,\"index\":9},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16774471,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"elect"
+    "ronic-circuit\"},\"count\":-16774470,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count"
+    "\":-16774469,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16774468,\"index\":13"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16774467,\"index\":14},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"electric-engine-unit\"},\"count\":-16774466,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flyin"
+    "g-robot-frame\"},\"count\":-16774465,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":215},{\"entity_id\""
+    ":219,\"circuit_id\":1}]}}},{\"entity_number\":221,\"name\":\"constant-combinator\",\"position\":{\"x\":377.5,\"y\":-28.5"
+    "},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16774336,\"inde"
+    "x\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16774335,\"index\":2},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-2\"},\"count\":-16774334,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\""
+    "},\"count\":-16774333,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16774332,\"index\""
+    ":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16774331,\"index\":6},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-6\"},\"count\":-16774330,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"}"
+    ",\"count\":-16774329,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16774328,\"index\""
+    ":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16774327,\"index\":10},{\"signal\":{\"type\":\"v"
+    "irtual\",\"name\":\"signal-A\"},\"count\":-16774326,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\""
+    "},\"count\":-16774325,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16774324,\"index"
+    "\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16774323,\"index\":14},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-E\"},\"count\":-16774322,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-F\"},\"count\":-16774321,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":224}]}}},{\"entity_number\":22"
+    "2,\"name\":\"constant-combinator\",\"position\":{\"x\":377.5,\"y\":-29.5},\"control_behavior\":{\"filters\":[{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16774464,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-1\"},\"count\":-16774463,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-1677"
+    "4462,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16774461,\"index\":4},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16774460,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-5\"},\"count\":-16774459,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-1677"
+    "4458,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16774457,\"index\":8},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16774456,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-9\"},\"count\":-16774455,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-167"
+    "74454,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16774453,\"index\":12},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16774452,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-D\"},\"count\":-16774451,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":"
+    "-16774450,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16774449,\"index\":16}]},\"c"
+    "onnections\":{\"1\":{\"red\":[{\"entity_id\":226}]}}},{\"entity_number\":223,\"name\":\"constant-combinator\",\"position"
+    "\":{\"x\":379.5,\"y\":-28.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"coun"
+    "t\":-16774304,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16774303,\"index\":2},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16774302,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-"
+    "ore\"},\"count\":-16774301,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16774300,\"in"
+    "dex\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16774299,\"index\":6},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"raw-fish\"},\"count\":-16774298,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\""
+    "},\"count\":-16774297,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16774296,\"index"
+    "\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16774295,\"index\":10},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"steel-plate\"},\"count\":-16774294,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar"
+    "\"},\"count\":-16774293,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16774292,\"index\":"
+    "13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16774291,\"index\":14},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"explosives\"},\"count\":-16774290,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\""
+    "},\"count\":-16774289,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":224},{\"entity_id\":228}]}}},{\"en"
+    "tity_number\":224,\"name\":\"constant-combinator\",\"position\":{\"x\":378.5,\"y\":-28.5},\"control_behavior\":{\"filter"
+    "s\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16774320,\"index\":1},{\"signal\":{\"type\":\"v"
+    "irtual\",\"name\":\"signal-H\"},\"count\":-16774319,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\""
+    "},\"count\":-16774318,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16774317,\"index\""
+    ":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16774316,\"index\":5},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-L\"},\"count\":-16774315,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink"
+    "\"},\"count\":-16774314,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16774313,\"inde"
+    "x\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16774312,\"index\":9},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-P\"},\"count\":-16774311,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q"
+    "\"},\"count\":-16774310,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16774309,\"ind"
+    "ex\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16774308,\"index\":13},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-T\"},\"count\":-16774307,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signa"
+    "l-U\"},\"count\":-16774306,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16774305,\""
+    "index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":221},{\"entity_id\":223}]}}},{\"entity_number\":225,\"name"
+    "\":\"constant-combinator\",\"position\":{\"x\":379.5,\"y\":-29.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"wood\"},\"count\":-16774432,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"coun"
+    "t\":-16774431,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16774430,\"index\":3},{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16774429,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "copper-ore\"},\"count\":-16774428,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16774"
+    "427,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16774426,\"index\":7},{\"signal\":{\"t"
+    "ype\":\"item\",\"name\":\"iron-plate\"},\"count\":-16774425,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"coppe"
+    "r-plate\"},\"count\":-16774424,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16774423,"
+    "\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16774422,\"index\":11},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16774421,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"su"
+    "lfur\"},\"count\":-16774420,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16774419,\"ind"
+    "ex\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16774418,\"index\":15},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16774417,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_"
+    "id\":226},{\"entity_id\":230}]}}},{\"entity_number\":226,\"name\":\"constant-combinator\",\"position\":{\"x\":378.5,\"y\""
+    ":-29.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16774448,"
+    "\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16774447,\"index\":2},{\"signal\":{\"ty"
+    "pe\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16774446,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"si"
+    "gnal-J\"},\"count\":-16774445,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16774444,"
+    "\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16774443,\"index\":6},{\"signal\":{\"ty"
+    "pe\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16774442,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-N\"},\"count\":-16774441,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-1677444"
+    "0,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16774439,\"index\":10},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16774438,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-R\"},\"count\":-16774437,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-167744"
+    "36,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16774435,\"index\":14},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16774434,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-V\"},\"count\":-16774433,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":222},{\"entity_id\":2"
+    "25}]}}},{\"entity_number\":227,\"name\":\"decider-combinator\",\"position\":{\"x\":382,\"y\":-28.5},\"direction\":2,\"co"
+    "ntrol_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\""
+    ":45,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input"
+    "\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":228}],\"green\":[{\"entity_id\":229,\"circuit_id\":1},{\"entit"
+    "y_id\":249,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":229,\"circuit_id\":2},{\"entity_id\":249,\"circuit_id\":2}"
+    "]}}},{\"entity_number\":228,\"name\":\"constant-combinator\",\"position\":{\"x\":380.5,\"y\":-28.5},\"control_behavior\""
+    ":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16774288,\"index\":1},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16774287,\"index\":2},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"lubricant-barrel\"},\"count\":-16774286,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barre"
+    "l\"},\"count\":-16774285,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16774"
+    "284,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16774283,\"index\":6},{\"signal\":"
+    "{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16774282,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "iron-stick\"},\"count\":-16774281,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-1"
+    "6774280,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16774279,\"index\":10},{\"sign"
+    "al\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16774278,\"index\":11},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"advanced-circuit\"},\"count\":-16774277,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-u"
+    "nit\"},\"count\":-16774276,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16774275,\""
+    "index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16774274,\"index\":15},{\"signa"
+    "l\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16774273,\"index\":16}]},\"connections\":{\"1\":{\"re"
+    "d\":[{\"entity_id\":223},{\"entity_id\":227,\"circuit_id\":1}]}}},{\"entity_number\":229,\"name\":\"decider-combinator\""
+    ",\"position\":{\"x\":382,\"y\":-29.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":43,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual"
+    "\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":230}"
+    "],\"green\":[{\"entity_id\":207,\"circuit_id\":1},{\"entity_id\":227,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":"
+    "207,\"circuit_id\":2},{\"entity_id\":227,\"circuit_id\":2}]}}},{\"entity_number\":230,\"name\":\"constant-combinator\",\""
+    "position\":{\"x\":380.5,\"y\":-29.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-"
+    "oil-barrel\"},\"count\":-16774416,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-"
+    "16774415,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16774414,\"index\":3},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16774413,\"index\":4},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16774412,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"wat"
+    "er-barrel\"},\"count\":-16774411,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16774"
+    "410,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16774409,\"index\":8},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16774408,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "empty-barrel\"},\"count\":-16774407,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"coun"
+    "t\":-16774406,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16774405,\"index\":"
+    "12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16774404,\"index\":13},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"engine-unit\"},\"count\":-16774403,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric"
+    "-engine-unit\"},\"count\":-16774402,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"coun"
+    "t\":-16774401,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":225},{\"entity_id\":229,\"circuit_id\":1}]"
+    "}}},{\"entity_number\":231,\"name\":\"constant-combinator\",\"position\":{\"x\":371.5,\"y\":-26.5},\"control_behavior\":"
+    "{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16774144,\"index\":1},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16774143,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-2\"},\"count\":-16774142,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16774141"
+    ",\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16774140,\"index\":5},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16774139,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-6\"},\"count\":-16774138,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16774137"
+    ",\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16774136,\"index\":9},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16774135,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-A\"},\"count\":-16774134,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-167741"
+    "33,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16774132,\"index\":13},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16774131,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-E\"},\"count\":-16774130,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-167"
+    "74129,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":234}]}}},{\"entity_number\":232,\"name\":\"constan"
+    "t-combinator\",\"position\":{\"x\":371.5,\"y\":-27.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual"
+    "\",\"name\":\"signal-0\"},\"count\":-16774272,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"co"
+    "unt\":-16774271,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16774270,\"index\":3},{"
+    "\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16774269,\"index\":4},{\"signal\":{\"type\":\"virtual"
+    "\",\"name\":\"signal-4\"},\"count\":-16774268,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"co"
+    "unt\":-16774267,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16774266,\"index\":7},{"
+    "\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16774265,\"index\":8},{\"signal\":{\"type\":\"virtual"
+    "\",\"name\":\"signal-8\"},\"count\":-16774264,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"co"
+    "unt\":-16774263,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16774262,\"index\":11}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16774261,\"index\":12},{\"signal\":{\"type\":\"virt"
+    "ual\",\"name\":\"signal-C\"},\"count\":-16774260,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},"
+    "\"count\":-16774259,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16774258,\"index\""
+    ":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16774257,\"index\":16}]},\"connections\":{\"1\""
+    ":{\"red\":[{\"entity_id\":236}]}}},{\"entity_number\":233,\"name\":\"constant-combinator\",\"position\":{\"x\":373.5,\"y"
+    "\":-26.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16774112,\"ind"
+    "ex\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16774111,\"index\":2},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"stone\"},\"count\":-16774110,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-1"
+    "6774109,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16774108,\"index\":5},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16774107,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "raw-fish\"},\"count\":-16774106,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16774105"
+    ",\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16774104,\"index\":9},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16774103,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"ste"
+    "el-plate\"},\"count\":-16774102,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-167741"
+    "01,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16774100,\"index\":13},{\"signal\":{\"ty"
+    "pe\":\"item\",\"name\":\"battery\"},\"count\":-16774099,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosiv"
+    "es\"},\"count\":-16774098,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-1677409"
+    "7,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":234},{\"entity_id\":238}]}}},{\"entity_number\":234,\""
+    "name\":\"constant-combinator\",\"position\":{\"x\":372.5,\"y\":-26.5},\"control_behavior\":{\"filters\":[{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16774128,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-H\"},\"count\":-16774127,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-1677412"
+    "6,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16774125,\"index\":4},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16774124,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-L\"},\"count\":-16774123,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-1677"
+    "4122,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16774121,\"index\":8},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16774120,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-P\"},\"count\":-16774119,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-167"
+    "74118,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16774117,\"index\":12},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16774116,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-T\"},\"count\":-16774115,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":"
+    "-16774114,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16774113,\"index\":16}]},\"c"
+    "onnections\":{\"1\":{\"red\":[{\"entity_id\":231},{\"entity_id\":233}]}}},{\"entity_number\":235,\"name\":\"constant-com"
+    "binator\",\"position\":{\"x\":373.5,\"y\":-27.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"wood\"},\"count\":-16774240,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16774239,\"i"
+    "ndex\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16774238,\"index\":3},{\"signal\":{\"type\":\"it"
+    "em\",\"name\":\"iron-ore\"},\"count\":-16774237,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"c"
+    "ount\":-16774236,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16774235,\"index\":6},"
+    "{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16774234,\"index\":7},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"iron-plate\"},\"count\":-16774233,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"coun"
+    "t\":-16774232,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16774231,\"index\":10},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16774230,\"index\":11},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"plastic-bar\"},\"count\":-16774229,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":"
+    "-16774228,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16774227,\"index\":14},{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16774226,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"crude-oil-barrel\"},\"count\":-16774225,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":236},{\"entit"
+    "y_id\":240}]}}},{\"entity_number\":236,\"name\":\"constant-combinator\",\"position\":{\"x\":372.5,\"y\":-27.5},\"control"
+    "_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16774256,\"index\":1},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16774255,\"index\":2},{\"signal\":{\"type\":\"virtual\","
+    "\"name\":\"signal-I\"},\"count\":-16774254,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count"
+    "\":-16774253,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16774252,\"index\":5},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16774251,\"index\":6},{\"signal\":{\"type\":\"virtual\","
+    "\"name\":\"signal-pink\"},\"count\":-16774250,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"co"
+    "unt\":-16774249,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16774248,\"index\":9},{"
+    "\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16774247,\"index\":10},{\"signal\":{\"type\":\"virtua"
+    "l\",\"name\":\"signal-Q\"},\"count\":-16774246,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\""
+    "count\":-16774245,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16774244,\"index\":1"
+    "3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16774243,\"index\":14},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-U\"},\"count\":-16774242,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\""
+    "},\"count\":-16774241,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":232},{\"entity_id\":235}]}}},{\"en"
+    "tity_number\":237,\"name\":\"decider-combinator\",\"position\":{\"x\":376,\"y\":-26.5},\"direction\":2,\"control_behavio"
+    "r\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":48,\"compara"
+    "tor\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"c"
+    "onnections\":{\"1\":{\"red\":[{\"entity_id\":238}],\"green\":[{\"entity_id\":239,\"circuit_id\":1},{\"entity_id\":259,\""
+    "circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":239,\"circuit_id\":2},{\"entity_id\":259,\"circuit_id\":2}]}}},{\"entit"
+    "y_number\":238,\"name\":\"constant-combinator\",\"position\":{\"x\":374.5,\"y\":-26.5},\"control_behavior\":{\"filters\""
+    ":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16774096,\"index\":1},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"light-oil-barrel\"},\"count\":-16774095,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubrica"
+    "nt-barrel\"},\"count\":-16774094,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\""
+    ":-16774093,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16774092,\"index\":"
+    "5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16774091,\"index\":6},{\"signal\":{\"type\":\"it"
+    "em\",\"name\":\"copper-cable\"},\"count\":-16774090,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"}"
+    ",\"count\":-16774089,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16774088,\"ind"
+    "ex\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16774087,\"index\":10},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16774086,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"a"
+    "dvanced-circuit\"},\"count\":-16774085,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"coun"
+    "t\":-16774084,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16774083,\"index\":14},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16774082,\"index\":15},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16774081,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entit"
+    "y_id\":233},{\"entity_id\":237,\"circuit_id\":1}]}}},{\"entity_number\":239,\"name\":\"decider-combinator\",\"position\""
+    ":{\"x\":376,\"y\":-27.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virt"
+    "ual\",\"name\":\"signal-check\"},\"constant\":46,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":240}],\"green\":[{"
+    "\"entity_id\":217,\"circuit_id\":1},{\"entity_id\":237,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":217,\"circuit_"
+    "id\":2},{\"entity_id\":237,\"circuit_id\":2}]}}},{\"entity_number\":240,\"name\":\"constant-combinator\",\"position\":{\""
+    "x\":374.5,\"y\":-27.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},"
+    "\"count\":-16774224,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16774223,\"ind"
+    "ex\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16774222,\"index\":3},{\"signal\":{\"ty"
+    "pe\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16774221,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"sulfuric-acid-barrel\"},\"count\":-16774220,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\""
+    "count\":-16774219,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16774218,\"index\":7"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16774217,\"index\":8},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"iron-gear-wheel\"},\"count\":-16774216,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\""
+    "},\"count\":-16774215,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16774214,"
+    "\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16774213,\"index\":12},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16774212,\"index\":13},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"engine-unit\"},\"count\":-16774211,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"}"
+    ",\"count\":-16774210,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16774209,\""
+    "index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":235},{\"entity_id\":239,\"circuit_id\":1}]}}},{\"entity_nu"
+    "mber\":241,\"name\":\"constant-combinator\",\"position\":{\"x\":377.5,\"y\":-26.5},\"control_behavior\":{\"filters\":[{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16774080,\"index\":1},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-1\"},\"count\":-16774079,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"coun"
+    "t\":-16774078,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16774077,\"index\":4},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16774076,\"index\":5},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-5\"},\"count\":-16774075,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"coun"
+    "t\":-16774074,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16774073,\"index\":8},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16774072,\"index\":9},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-9\"},\"count\":-16774071,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"cou"
+    "nt\":-16774070,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16774069,\"index\":12},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16774068,\"index\":13},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-D\"},\"count\":-16774067,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\""
+    "count\":-16774066,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16774065,\"index\":1"
+    "6}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":244}]}}},{\"entity_number\":242,\"name\":\"constant-combinator\",\""
+    "position\":{\"x\":377.5,\"y\":-27.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"sig"
+    "nal-0\"},\"count\":-16774208,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16774207,\""
+    "index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16774206,\"index\":3},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16774205,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-4\"},\"count\":-16774204,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16774203,\""
+    "index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16774202,\"index\":7},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16774201,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-8\"},\"count\":-16774200,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16774199,\""
+    "index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16774198,\"index\":11},{\"signal\":{\"ty"
+    "pe\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16774197,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-C\"},\"count\":-16774196,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-1677419"
+    "5,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16774194,\"index\":15},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16774193,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"enti"
+    "ty_id\":246}]}}},{\"entity_number\":243,\"name\":\"constant-combinator\",\"position\":{\"x\":379.5,\"y\":-26.5},\"contro"
+    "l_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16774048,\"index\":1},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16774047,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\""
+    "},\"count\":-16774046,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16774045,\"index\":4"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16774044,\"index\":5},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"uranium-ore\"},\"count\":-16774043,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"coun"
+    "t\":-16774042,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16774041,\"index\":8},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16774040,\"index\":9},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"solid-fuel\"},\"count\":-16774039,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"coun"
+    "t\":-16774038,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16774037,\"index\":12},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16774036,\"index\":13},{\"signal\":{\"type\":\"item\",\"na"
+    "me\":\"battery\"},\"count\":-16774035,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-1"
+    "6774034,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16774033,\"index\":16}]},"
+    "\"connections\":{\"1\":{\"red\":[{\"entity_id\":244},{\"entity_id\":248}]}}},{\"entity_number\":244,\"name\":\"constant-"
+    "combinator\",\"position\":{\"x\":378.5,\"y\":-26.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-G\"},\"count\":-16774064,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"coun"
+    "t\":-16774063,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16774062,\"index\":3},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16774061,\"index\":4},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-K\"},\"count\":-16774060,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"coun"
+    "t\":-16774059,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16774058,\"index\":7},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16774057,\"index\":8},{\"signal\":{\"type\":\"virtua"
+    "l\",\"name\":\"signal-O\"},\"count\":-16774056,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"c"
+    "ount\":-16774055,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16774054,\"index\":11"
+    "},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16774053,\"index\":12},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-S\"},\"count\":-16774052,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"}"
+    ",\"count\":-16774051,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16774050,\"index\""
+    ":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16774049,\"index\":16}]},\"connections\":{\"1\""
+    ":{\"red\":[{\"entity_id\":241},{\"entity_id\":243}]}}},{\"entity_number\":245,\"name\":\"constant-combinator\",\"positio"
+    "n\":{\"x\":379.5,\"y\":-27.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"cou"
+    "nt\":-16774176,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16774175,\"index\":2},{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16774174,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iro"
+    "n-ore\"},\"count\":-16774173,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16774172,\""
+    "index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16774171,\"index\":6},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"raw-fish\"},\"count\":-16774170,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate"
+    "\"},\"count\":-16774169,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16774168,\"ind"
+    "ex\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16774167,\"index\":10},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"steel-plate\"},\"count\":-16774166,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-b"
+    "ar\"},\"count\":-16774165,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16774164,\"index\""
+    ":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16774163,\"index\":14},{\"signal\":{\"type\":\"item"
+    "\",\"name\":\"explosives\"},\"count\":-16774162,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel"
+    "\"},\"count\":-16774161,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":246},{\"entity_id\":250}]}}},{\""
+    "entity_number\":246,\"name\":\"constant-combinator\",\"position\":{\"x\":378.5,\"y\":-27.5},\"control_behavior\":{\"filt"
+    "ers\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16774192,\"index\":1},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-H\"},\"count\":-16774191,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\""
+    "},\"count\":-16774190,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16774189,\"index\""
+    ":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16774188,\"index\":5},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-L\"},\"count\":-16774187,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink"
+    "\"},\"count\":-16774186,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16774185,\"inde"
+    "x\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16774184,\"index\":9},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-P\"},\"count\":-16774183,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q"
+    "\"},\"count\":-16774182,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16774181,\"ind"
+    "ex\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16774180,\"index\":13},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-T\"},\"count\":-16774179,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signa"
+    "l-U\"},\"count\":-16774178,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16774177,\""
+    "index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":242},{\"entity_id\":245}]}}},{\"entity_number\":247,\"name"
+    "\":\"decider-combinator\",\"position\":{\"x\":382,\"y\":-26.5},\"direction\":2,\"control_behavior\":{\"decider_condition"
+    "s\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":49,\"comparator\":\"=\",\"output_sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"r"
+    "ed\":[{\"entity_id\":248}],\"green\":[{\"entity_id\":249,\"circuit_id\":1},{\"entity_id\":269,\"circuit_id\":1}]},\"2\":"
+    "{\"red\":[{\"entity_id\":249,\"circuit_id\":2},{\"entity_id\":269,\"circuit_id\":2}]}}},{\"entity_number\":248,\"name\":"
+    "\"constant-combinator\",\"position\":{\"x\":380.5,\"y\":-26.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16774032,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light"
+    "-oil-barrel\"},\"count\":-16774031,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":"
+    "-16774030,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16774029,\"index\":4"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16774028,\"index\":5},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"water-barrel\"},\"count\":-16774027,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper"
+    "-cable\"},\"count\":-16774026,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16774025,\""
+    "index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16774024,\"index\":9},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16774023,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"e"
+    "lectronic-circuit\"},\"count\":-16774022,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"c"
+    "ount\":-16774021,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16774020,\"index\""
+    ":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16774019,\"index\":14},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"electric-engine-unit\"},\"count\":-16774018,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"fl"
+    "ying-robot-frame\"},\"count\":-16774017,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":243},{\"entity_i"
+    "d\":247,\"circuit_id\":1}]}}},{\"entity_number\":249,\"name\":\"decider-combinator\",\"position\":{\"x\":382,\"y\":-27.5"
+    "},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-check\"},\"constant\":47,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\""
+    "copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":250}],\"green\":[{\"entity_id\":227,\"cir"
+    "cuit_id\":1},{\"entity_id\":247,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":227,\"circuit_id\":2},{\"entity_id\":"
+    "247,\"circuit_id\":2}]}}},{\"entity_number\":250,\"name\":\"constant-combinator\",\"position\":{\"x\":380.5,\"y\":-27.5}"
+    ",\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16774160,\""
+    "index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16774159,\"index\":2},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16774158,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"petroleum-gas-barrel\"},\"count\":-16774157,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barre"
+    "l\"},\"count\":-16774156,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16774155,\"in"
+    "dex\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16774154,\"index\":7},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"iron-stick\"},\"count\":-16774153,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-"
+    "wheel\"},\"count\":-16774152,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16774151,"
+    "\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16774150,\"index\":11},{\"signa"
+    "l\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16774149,\"index\":12},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"processing-unit\"},\"count\":-16774148,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\""
+    "count\":-16774147,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16774146,\""
+    "index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16774145,\"index\":16}]},\"connec"
+    "tions\":{\"1\":{\"red\":[{\"entity_id\":245},{\"entity_id\":249,\"circuit_id\":1}]}}},{\"entity_number\":251,\"name\":\""
+    "constant-combinator\",\"position\":{\"x\":371.5,\"y\":-24.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-0\"},\"count\":-16773888,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\""
+    "},\"count\":-16773887,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16773886,\"index\""
+    ":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16773885,\"index\":4},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-4\"},\"count\":-16773884,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"}"
+    ",\"count\":-16773883,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16773882,\"index\""
+    ":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16773881,\"index\":8},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-8\"},\"count\":-16773880,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"}"
+    ",\"count\":-16773879,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16773878,\"index\""
+    ":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16773877,\"index\":12},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-C\"},\"count\":-16773876,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D"
+    "\"},\"count\":-16773875,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16773874,\"ind"
+    "ex\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16773873,\"index\":16}]},\"connections\":{\""
+    "1\":{\"red\":[{\"entity_id\":254}]}}},{\"entity_number\":252,\"name\":\"constant-combinator\",\"position\":{\"x\":371.5,"
+    "\"y\":-25.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-1677"
+    "4016,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16774015,\"index\":2},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16774014,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-3\"},\"count\":-16774013,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-1677"
+    "4012,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16774011,\"index\":6},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16774010,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-7\"},\"count\":-16774009,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-1677"
+    "4008,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16774007,\"index\":10},{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16774006,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name"
+    "\":\"signal-B\"},\"count\":-16774005,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-1"
+    "6774004,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16774003,\"index\":14},{\"sign"
+    "al\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16774002,\"index\":15},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-F\"},\"count\":-16774001,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":256}]}}},{\"ent"
+    "ity_number\":253,\"name\":\"constant-combinator\",\"position\":{\"x\":373.5,\"y\":-24.5},\"control_behavior\":{\"filters"
+    "\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16773856,\"index\":1},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"coal\"},\"count\":-16773855,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16773854"
+    ",\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16773853,\"index\":4},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"copper-ore\"},\"count\":-16773852,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-"
+    "ore\"},\"count\":-16773851,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16773850,\"inde"
+    "x\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16773849,\"index\":8},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"copper-plate\"},\"count\":-16773848,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\""
+    "},\"count\":-16773847,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16773846,\"index"
+    "\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16773845,\"index\":12},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"sulfur\"},\"count\":-16773844,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"c"
+    "ount\":-16773843,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16773842,\"index\":15}"
+    ",{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16773841,\"index\":16}]},\"connections\":{\"1\""
+    ":{\"red\":[{\"entity_id\":254},{\"entity_id\":258}]}}},{\"entity_number\":254,\"name\":\"constant-combinator\",\"positio"
+    "n\":{\"x\":372.5,\"y\":-24.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\""
+    "},\"count\":-16773872,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16773871,\"index\""
+    ":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16773870,\"index\":3},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-J\"},\"count\":-16773869,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"}"
+    ",\"count\":-16773868,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16773867,\"index\""
+    ":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16773866,\"index\":7},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-N\"},\"count\":-16773865,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\""
+    "},\"count\":-16773864,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16773863,\"index\""
+    ":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16773862,\"index\":11},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-R\"},\"count\":-16773861,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S"
+    "\"},\"count\":-16773860,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16773859,\"ind"
+    "ex\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16773858,\"index\":15},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-V\"},\"count\":-16773857,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":"
+    "251},{\"entity_id\":253}]}}},{\"entity_number\":255,\"name\":\"constant-combinator\",\"position\":{\"x\":373.5,\"y\":-25"
+    ".5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16773984,\"index\":1"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16773983,\"index\":2},{\"signal\":{\"type\":\"item\",\"na"
+    "me\":\"stone\"},\"count\":-16773982,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-167739"
+    "81,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16773980,\"index\":5},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16773979,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw"
+    "-fish\"},\"count\":-16773978,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16773977,\""
+    "index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16773976,\"index\":9},{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16773975,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-"
+    "plate\"},\"count\":-16773974,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16773973,"
+    "\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16773972,\"index\":13},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"battery\"},\"count\":-16773971,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\""
+    "},\"count\":-16773970,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16773969,\""
+    "index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":256},{\"entity_id\":260}]}}},{\"entity_number\":256,\"name"
+    "\":\"constant-combinator\",\"position\":{\"x\":372.5,\"y\":-25.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16774000,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-H\"},\"count\":-16773999,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16773998,\""
+    "index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16773997,\"index\":4},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16773996,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-L\"},\"count\":-16773995,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16773994"
+    ",\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16773993,\"index\":8},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16773992,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-P\"},\"count\":-16773991,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-1677399"
+    "0,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16773989,\"index\":12},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16773988,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-T\"},\"count\":-16773987,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-167"
+    "73986,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16773985,\"index\":16}]},\"conne"
+    "ctions\":{\"1\":{\"red\":[{\"entity_id\":252},{\"entity_id\":255}]}}},{\"entity_number\":257,\"name\":\"decider-combinat"
+    "or\",\"position\":{\"x\":376,\"y\":-24.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":52,\"comparator\":\"=\",\"output_signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":"
+    "258}],\"green\":[{\"entity_id\":259,\"circuit_id\":1},{\"entity_id\":279,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_i"
+    "d\":259,\"circuit_id\":2},{\"entity_id\":279,\"circuit_id\":2}]}}},{\"entity_number\":258,\"name\":\"constant-combinator"
+    "\",\"position\":{\"x\":374.5,\"y\":-24.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"h"
+    "eavy-oil-barrel\"},\"count\":-16773840,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"coun"
+    "t\":-16773839,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16773838,\"index\":3"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16773837,\"index\":4},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16773836,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"water-barrel\"},\"count\":-16773835,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-"
+    "16773834,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16773833,\"index\":8},{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16773832,\"index\":9},{\"signal\":{\"type\":\"item\",\"na"
+    "me\":\"empty-barrel\"},\"count\":-16773831,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"}"
+    ",\"count\":-16773830,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16773829,\"i"
+    "ndex\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16773828,\"index\":13},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16773827,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"el"
+    "ectric-engine-unit\"},\"count\":-16773826,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},"
+    "\"count\":-16773825,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":253},{\"entity_id\":257,\"circuit_id"
+    "\":1}]}}},{\"entity_number\":259,\"name\":\"decider-combinator\",\"position\":{\"x\":376,\"y\":-25.5},\"direction\":2,\""
+    "control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant"
+    "\":50,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_inp"
+    "ut\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":260}],\"green\":[{\"entity_id\":237,\"circuit_id\":1},{\"ent"
+    "ity_id\":257,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":237,\"circuit_id\":2},{\"entity_id\":257,\"circuit_id\":"
+    "2}]}}},{\"entity_number\":260,\"name\":\"constant-combinator\",\"position\":{\"x\":374.5,\"y\":-25.5},\"control_behavior"
+    "\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16773968,\"index\":1},{\"signa"
+    "l\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16773967,\"index\":2},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"lubricant-barrel\"},\"count\":-16773966,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-ba"
+    "rrel\"},\"count\":-16773965,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16"
+    "773964,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16773963,\"index\":6},{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16773962,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"iron-stick\"},\"count\":-16773961,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\""
+    ":-16773960,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16773959,\"index\":10},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16773958,\"index\":11},{\"signal\":{\"type\":\"it"
+    "em\",\"name\":\"advanced-circuit\"},\"count\":-16773957,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processi"
+    "ng-unit\"},\"count\":-16773956,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-1677395"
+    "5,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16773954,\"index\":15},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16773953,\"index\":16}]},\"connections\":{\"1\":{"
+    "\"red\":[{\"entity_id\":255},{\"entity_id\":259,\"circuit_id\":1}]}}},{\"entity_number\":261,\"name\":\"constant-combina"
+    "tor\",\"position\":{\"x\":377.5,\"y\":-24.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name"
+    "\":\"signal-0\"},\"count\":-16773824,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16"
+    "773823,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16773822,\"index\":3},{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16773821,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-4\"},\"count\":-16773820,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-1677"
+    "3819,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16773818,\"index\":7},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16773817,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-8\"},\"count\":-16773816,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-1677"
+    "3815,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16773814,\"index\":11},{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16773813,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name"
+    "\":\"signal-C\"},\"count\":-16773812,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-1"
+    "6773811,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16773810,\"index\":15},{\"sign"
+    "al\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16773809,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{"
+    "\"entity_id\":264}]}}},{\"entity_number\":262,\"name\":\"constant-combinator\",\"position\":{\"x\":377.5,\"y\":-25.5},\""
+    "control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16773952,\"index\":"
+    "1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16773951,\"index\":2},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-2\"},\"count\":-16773950,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},"
+    "\"count\":-16773949,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16773948,\"index\":"
+    "5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16773947,\"index\":6},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-6\"},\"count\":-16773946,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},"
+    "\"count\":-16773945,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16773944,\"index\":"
+    "9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16773943,\"index\":10},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-A\"},\"count\":-16773942,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\""
+    "},\"count\":-16773941,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16773940,\"index"
+    "\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16773939,\"index\":14},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-E\"},\"count\":-16773938,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-F\"},\"count\":-16773937,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":266}]}}},{\"entity_number\":26"
+    "3,\"name\":\"constant-combinator\",\"position\":{\"x\":379.5,\"y\":-24.5},\"control_behavior\":{\"filters\":[{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16773792,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\""
+    "},\"count\":-16773791,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16773790,\"index\":3},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16773789,\"index\":4},{\"signal\":{\"type\":\"item\",\"n"
+    "ame\":\"copper-ore\"},\"count\":-16773788,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\""
+    ":-16773787,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16773786,\"index\":7},{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16773785,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"copper-plate\"},\"count\":-16773784,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16"
+    "773783,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16773782,\"index\":11},{\"signa"
+    "l\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16773781,\"index\":12},{\"signal\":{\"type\":\"item\",\"name"
+    "\":\"sulfur\"},\"count\":-16773780,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-1677377"
+    "9,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16773778,\"index\":15},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16773777,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"e"
+    "ntity_id\":264},{\"entity_id\":268}]}}},{\"entity_number\":264,\"name\":\"constant-combinator\",\"position\":{\"x\":378."
+    "5,\"y\":-24.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16"
+    "773808,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16773807,\"index\":2},{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16773806,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-J\"},\"count\":-16773805,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-1677"
+    "3804,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16773803,\"index\":6},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16773802,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"nam"
+    "e\":\"signal-N\"},\"count\":-16773801,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-1"
+    "6773800,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16773799,\"index\":10},{\"signa"
+    "l\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16773798,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"n"
+    "ame\":\"signal-R\"},\"count\":-16773797,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\""
+    ":-16773796,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16773795,\"index\":14},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16773794,\"index\":15},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-V\"},\"count\":-16773793,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":261},{\"enti"
+    "ty_id\":263}]}}},{\"entity_number\":265,\"name\":\"constant-combinator\",\"position\":{\"x\":379.5,\"y\":-25.5},\"contro"
+    "l_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16773920,\"index\":1},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16773919,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\""
+    "},\"count\":-16773918,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16773917,\"index\":4"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16773916,\"index\":5},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"uranium-ore\"},\"count\":-16773915,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"coun"
+    "t\":-16773914,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16773913,\"index\":8},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16773912,\"index\":9},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"solid-fuel\"},\"count\":-16773911,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"coun"
+    "t\":-16773910,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16773909,\"index\":12},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16773908,\"index\":13},{\"signal\":{\"type\":\"item\",\"na"
+    "me\":\"battery\"},\"count\":-16773907,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-1"
+    "6773906,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16773905,\"index\":16}]},"
+    "\"connections\":{\"1\":{\"red\":[{\"entity_id\":266},{\"entity_id\":270}]}}},{\"entity_number\":266,\"name\":\"constant-"
+    "combinator\",\"position\":{\"x\":378.5,\"y\":-25.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-G\"},\"count\":-16773936,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"coun"
+    "t\":-16773935,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16773934,\"index\":3},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16773933,\"index\":4},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-K\"},\"count\":-16773932,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"coun"
+    "t\":-16773931,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16773930,\"index\":7},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16773929,\"index\":8},{\"signal\":{\"type\":\"virtua"
+    "l\",\"name\":\"signal-O\"},\"count\":-16773928,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"c"
+    "ount\":-16773927,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16773926,\"index\":11"
+    "},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16773925,\"index\":12},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-S\"},\"count\":-16773924,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"}"
+    ",\"count\":-16773923,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16773922,\"index\""
+    ":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16773921,\"index\":16}]},\"connections\":{\"1\""
+    ":{\"red\":[{\"entity_id\":262},{\"entity_id\":265}]}}},{\"entity_number\":267,\"name\":\"decider-combinator\",\"position"
+    "\":{\"x\":382,\"y\":-24.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-check\"},\"constant\":53,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":268}],\"green\""
+    ":[{\"entity_id\":269,\"circuit_id\":1},{\"entity_id\":289,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":269,\"circu"
+    "it_id\":2},{\"entity_id\":289,\"circuit_id\":2}]}}},{\"entity_number\":268,\"name\":\"constant-combinator\",\"position\""
+    ":{\"x\":380.5,\"y\":-24.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel"
+    "\"},\"count\":-16773776,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16773775,\""
+    "index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16773774,\"index\":3},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16773773,\"index\":4},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"sulfuric-acid-barrel\"},\"count\":-16773772,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"}"
+    ",\"count\":-16773771,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16773770,\"index\""
+    ":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16773769,\"index\":8},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"iron-gear-wheel\"},\"count\":-16773768,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barre"
+    "l\"},\"count\":-16773767,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-167737"
+    "66,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16773765,\"index\":12},{\"sign"
+    "al\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16773764,\"index\":13},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"engine-unit\"},\"count\":-16773763,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit"
+    "\"},\"count\":-16773762,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-1677376"
+    "1,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":263},{\"entity_id\":267,\"circuit_id\":1}]}}},{\"entit"
+    "y_number\":269,\"name\":\"decider-combinator\",\"position\":{\"x\":382,\"y\":-25.5},\"direction\":2,\"control_behavior\""
+    ":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":51,\"comparator"
+    "\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"conn"
+    "ections\":{\"1\":{\"red\":[{\"entity_id\":270}],\"green\":[{\"entity_id\":247,\"circuit_id\":1},{\"entity_id\":267,\"cir"
+    "cuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":247,\"circuit_id\":2},{\"entity_id\":267,\"circuit_id\":2}]}}},{\"entity_n"
+    "umber\":270,\"name\":\"constant-combinator\",\"position\":{\"x\":380.5,\"y\":-25.5},\"control_behavior\":{\"filters\":[{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16773904,\"index\":1},{\"signal\":{\"type\":\"it"
+    "em\",\"name\":\"light-oil-barrel\"},\"count\":-16773903,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant"
+    "-barrel\"},\"count\":-16773902,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":"
+    "-16773901,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16773900,\"index\":5"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16773899,\"index\":6},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"copper-cable\"},\"count\":-16773898,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},"
+    "\"count\":-16773897,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16773896,\"inde"
+    "x\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16773895,\"index\":10},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16773894,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"a"
+    "dvanced-circuit\"},\"count\":-16773893,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"coun"
+    "t\":-16773892,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16773891,\"index\":14},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16773890,\"index\":15},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16773889,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entit"
+    "y_id\":265},{\"entity_id\":269,\"circuit_id\":1}]}}},{\"entity_number\":271,\"name\":\"constant-combinator\",\"position\""
+    ":{\"x\":371.5,\"y\":-22.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\""
+    "count\":-16773632,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16773631,\"index\":2}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16773630,\"index\":3},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-3\"},\"count\":-16773629,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\""
+    "count\":-16773628,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16773627,\"index\":6}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16773626,\"index\":7},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-7\"},\"count\":-16773625,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\""
+    "count\":-16773624,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16773623,\"index\":10"
+    "},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16773622,\"index\":11},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-B\"},\"count\":-16773621,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"}"
+    ",\"count\":-16773620,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16773619,\"index\""
+    ":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16773618,\"index\":15},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-F\"},\"count\":-16773617,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":274"
+    "}]}}},{\"entity_number\":272,\"name\":\"constant-combinator\",\"position\":{\"x\":371.5,\"y\":-23.5},\"control_behavior\""
+    ":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16773760,\"index\":1},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16773759,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-2\"},\"count\":-16773758,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-1677375"
+    "7,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16773756,\"index\":5},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16773755,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-6\"},\"count\":-16773754,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-1677375"
+    "3,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16773752,\"index\":9},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16773751,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-A\"},\"count\":-16773750,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-167737"
+    "49,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16773748,\"index\":13},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16773747,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-E\"},\"count\":-16773746,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-167"
+    "73745,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":276}]}}},{\"entity_number\":273,\"name\":\"constan"
+    "t-combinator\",\"position\":{\"x\":373.5,\"y\":-22.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\","
+    "\"name\":\"wood\"},\"count\":-16773600,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-1677359"
+    "9,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16773598,\"index\":3},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"iron-ore\"},\"count\":-16773597,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\""
+    "},\"count\":-16773596,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16773595,\"index\""
+    ":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16773594,\"index\":7},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"iron-plate\"},\"count\":-16773593,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"c"
+    "ount\":-16773592,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16773591,\"index\":10},"
+    "{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16773590,\"index\":11},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"plastic-bar\"},\"count\":-16773589,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count"
+    "\":-16773588,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16773587,\"index\":14},{\"sig"
+    "nal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16773586,\"index\":15},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"crude-oil-barrel\"},\"count\":-16773585,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":274},{\"en"
+    "tity_id\":278}]}}},{\"entity_number\":274,\"name\":\"constant-combinator\",\"position\":{\"x\":372.5,\"y\":-22.5},\"cont"
+    "rol_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16773616,\"index\":1},{"
+    "\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16773615,\"index\":2},{\"signal\":{\"type\":\"virtual"
+    "\",\"name\":\"signal-I\"},\"count\":-16773614,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"co"
+    "unt\":-16773613,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16773612,\"index\":5},{"
+    "\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16773611,\"index\":6},{\"signal\":{\"type\":\"virtual"
+    "\",\"name\":\"signal-pink\"},\"count\":-16773610,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\""
+    "count\":-16773609,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16773608,\"index\":9}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16773607,\"index\":10},{\"signal\":{\"type\":\"virt"
+    "ual\",\"name\":\"signal-Q\"},\"count\":-16773606,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},"
+    "\"count\":-16773605,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16773604,\"index\""
+    ":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16773603,\"index\":14},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-U\"},\"count\":-16773602,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V"
+    "\"},\"count\":-16773601,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":271},{\"entity_id\":273}]}}},{\""
+    "entity_number\":275,\"name\":\"constant-combinator\",\"position\":{\"x\":373.5,\"y\":-23.5},\"control_behavior\":{\"filt"
+    "ers\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16773728,\"index\":1},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"coal\"},\"count\":-16773727,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16773"
+    "726,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16773725,\"index\":4},{\"signal\":{\"t"
+    "ype\":\"item\",\"name\":\"copper-ore\"},\"count\":-16773724,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"urani"
+    "um-ore\"},\"count\":-16773723,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16773722,\"i"
+    "ndex\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16773721,\"index\":8},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"copper-plate\"},\"count\":-16773720,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fu"
+    "el\"},\"count\":-16773719,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16773718,\"i"
+    "ndex\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16773717,\"index\":12},{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"sulfur\"},\"count\":-16773716,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"}"
+    ",\"count\":-16773715,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16773714,\"index\""
+    ":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16773713,\"index\":16}]},\"connections\":{"
+    "\"1\":{\"red\":[{\"entity_id\":276},{\"entity_id\":280}]}}},{\"entity_number\":276,\"name\":\"constant-combinator\",\"po"
+    "sition\":{\"x\":372.5,\"y\":-23.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signa"
+    "l-G\"},\"count\":-16773744,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16773743,\"i"
+    "ndex\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16773742,\"index\":3},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-J\"},\"count\":-16773741,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-K\"},\"count\":-16773740,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16773739,\"in"
+    "dex\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16773738,\"index\":7},{\"signal\":{\"typ"
+    "e\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16773737,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"sig"
+    "nal-O\"},\"count\":-16773736,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16773735,\""
+    "index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16773734,\"index\":11},{\"signal\":{\"ty"
+    "pe\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16773733,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-S\"},\"count\":-16773732,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-1677373"
+    "1,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16773730,\"index\":15},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16773729,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"enti"
+    "ty_id\":272},{\"entity_id\":275}]}}},{\"entity_number\":277,\"name\":\"decider-combinator\",\"position\":{\"x\":376,\"y\""
+    ":-22.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-check\"},\"constant\":56,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everythin"
+    "g\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":278}],\"green\":[{\"entity_id\":27"
+    "9,\"circuit_id\":1},{\"entity_id\":299,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":279,\"circuit_id\":2},{\"entit"
+    "y_id\":299,\"circuit_id\":2}]}}},{\"entity_number\":278,\"name\":\"constant-combinator\",\"position\":{\"x\":374.5,\"y\""
+    ":-22.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-1677"
+    "3584,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16773583,\"index\":2},{\"sign"
+    "al\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16773582,\"index\":3},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"petroleum-gas-barrel\"},\"count\":-16773581,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-aci"
+    "d-barrel\"},\"count\":-16773580,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-167735"
+    "79,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16773578,\"index\":7},{\"signal\":{"
+    "\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16773577,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"ir"
+    "on-gear-wheel\"},\"count\":-16773576,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-1"
+    "6773575,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16773574,\"index\":11},"
+    "{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16773573,\"index\":12},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"processing-unit\"},\"count\":-16773572,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-"
+    "unit\"},\"count\":-16773571,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-1"
+    "6773570,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16773569,\"index\":16}]"
+    "},\"connections\":{\"1\":{\"red\":[{\"entity_id\":273},{\"entity_id\":277,\"circuit_id\":1}]}}},{\"entity_number\":279,\""
+    "name\":\"decider-combinator\",\"position\":{\"x\":376,\"y\":-23.5},\"direction\":2,\"control_behavior\":{\"decider_condi"
+    "tions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":54,\"comparator\":\"=\",\"output"
+    "_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":"
+    "{\"red\":[{\"entity_id\":280}],\"green\":[{\"entity_id\":257,\"circuit_id\":1},{\"entity_id\":277,\"circuit_id\":1}]},\""
+    "2\":{\"red\":[{\"entity_id\":257,\"circuit_id\":2},{\"entity_id\":277,\"circuit_id\":2}]}}},{\"entity_number\":280,\"nam"
+    "e\":\"constant-combinator\",\"position\":{\"x\":374.5,\"y\":-23.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16773712,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"l"
+    "ight-oil-barrel\"},\"count\":-16773711,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"coun"
+    "t\":-16773710,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16773709,\"index"
+    "\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16773708,\"index\":5},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16773707,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"co"
+    "pper-cable\"},\"count\":-16773706,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-167737"
+    "05,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16773704,\"index\":9},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16773703,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"electronic-circuit\"},\"count\":-16773702,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"}"
+    ",\"count\":-16773701,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16773700,\"in"
+    "dex\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16773699,\"index\":14},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16773698,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"flying-robot-frame\"},\"count\":-16773697,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":275},{\"ent"
+    "ity_id\":279,\"circuit_id\":1}]}}},{\"entity_number\":281,\"name\":\"constant-combinator\",\"position\":{\"x\":377.5,\"y"
+    "\":-22.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-1677356"
+    "8,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16773567,\"index\":2},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16773566,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-3\"},\"count\":-16773565,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-1677356"
+    "4,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16773563,\"index\":6},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16773562,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-7\"},\"count\":-16773561,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-1677356"
+    "0,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16773559,\"index\":10},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16773558,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-B\"},\"count\":-16773557,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-167735"
+    "56,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16773555,\"index\":14},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16773554,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-F\"},\"count\":-16773553,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":284}]}}},{\"entity_nu"
+    "mber\":282,\"name\":\"constant-combinator\",\"position\":{\"x\":377.5,\"y\":-23.5},\"control_behavior\":{\"filters\":[{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16773696,\"index\":1},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-1\"},\"count\":-16773695,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"coun"
+    "t\":-16773694,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16773693,\"index\":4},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16773692,\"index\":5},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-5\"},\"count\":-16773691,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"coun"
+    "t\":-16773690,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16773689,\"index\":8},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16773688,\"index\":9},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-9\"},\"count\":-16773687,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"cou"
+    "nt\":-16773686,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16773685,\"index\":12},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16773684,\"index\":13},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-D\"},\"count\":-16773683,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\""
+    "count\":-16773682,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16773681,\"index\":1"
+    "6}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":286}]}}},{\"entity_number\":283,\"name\":\"constant-combinator\",\""
+    "position\":{\"x\":379.5,\"y\":-22.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\""
+    "},\"count\":-16773536,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16773535,\"index\":2},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16773534,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"iron-ore\"},\"count\":-16773533,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16773"
+    "532,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16773531,\"index\":6},{\"signal\":{"
+    "\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16773530,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron"
+    "-plate\"},\"count\":-16773529,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16773528"
+    ",\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16773527,\"index\":10},{\"signal\":{\"t"
+    "ype\":\"item\",\"name\":\"steel-plate\"},\"count\":-16773526,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"pla"
+    "stic-bar\"},\"count\":-16773525,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16773524,\""
+    "index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16773523,\"index\":14},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"explosives\"},\"count\":-16773522,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil"
+    "-barrel\"},\"count\":-16773521,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":284},{\"entity_id\":288}]"
+    "}}},{\"entity_number\":284,\"name\":\"constant-combinator\",\"position\":{\"x\":378.5,\"y\":-22.5},\"control_behavior\":"
+    "{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16773552,\"index\":1},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16773551,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-I\"},\"count\":-16773550,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16773549"
+    ",\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16773548,\"index\":5},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16773547,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-pink\"},\"count\":-16773546,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16773"
+    "545,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16773544,\"index\":9},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16773543,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-Q\"},\"count\":-16773542,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-167"
+    "73541,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16773540,\"index\":13},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16773539,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-U\"},\"count\":-16773538,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":"
+    "-16773537,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":281},{\"entity_id\":283}]}}},{\"entity_number\""
+    ":285,\"name\":\"constant-combinator\",\"position\":{\"x\":379.5,\"y\":-23.5},\"control_behavior\":{\"filters\":[{\"signa"
+    "l\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16773664,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coa"
+    "l\"},\"count\":-16773663,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16773662,\"index\":3"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16773661,\"index\":4},{\"signal\":{\"type\":\"item\","
+    "\"name\":\"copper-ore\"},\"count\":-16773660,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"cou"
+    "nt\":-16773659,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16773658,\"index\":7},{\"si"
+    "gnal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16773657,\"index\":8},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"copper-plate\"},\"count\":-16773656,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\""
+    ":-16773655,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16773654,\"index\":11},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16773653,\"index\":12},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"sulfur\"},\"count\":-16773652,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-167"
+    "73651,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16773650,\"index\":15},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16773649,\"index\":16}]},\"connections\":{\"1\":{\"red\":["
+    "{\"entity_id\":286},{\"entity_id\":290}]}}},{\"entity_number\":286,\"name\":\"constant-combinator\",\"position\":{\"x\":"
+    "378.5,\"y\":-23.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\""
+    ":-16773680,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16773679,\"index\":2},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16773678,\"index\":3},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-J\"},\"count\":-16773677,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\""
+    ":-16773676,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16773675,\"index\":6},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16773674,\"index\":7},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-N\"},\"count\":-16773673,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"coun"
+    "t\":-16773672,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16773671,\"index\":10},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16773670,\"index\":11},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-R\"},\"count\":-16773669,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"cou"
+    "nt\":-16773668,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16773667,\"index\":14},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16773666,\"index\":15},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-V\"},\"count\":-16773665,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":282},{\""
+    "entity_id\":285}]}}},{\"entity_number\":287,\"name\":\"decider-combinator\",\"position\":{\"x\":382,\"y\":-22.5},\"direc"
+    "tion\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"}"
+    ",\"constant\":57,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_cou"
+    "nt_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":288}],\"green\":[{\"entity_id\":289,\"circuit_id\""
+    ":1},{\"entity_id\":309,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":289,\"circuit_id\":2},{\"entity_id\":309,\"cir"
+    "cuit_id\":2}]}}},{\"entity_number\":288,\"name\":\"constant-combinator\",\"position\":{\"x\":380.5,\"y\":-22.5},\"contro"
+    "l_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16773520,\"index\":1"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16773519,\"index\":2},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"lubricant-barrel\"},\"count\":-16773518,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petrole"
+    "um-gas-barrel\"},\"count\":-16773517,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"co"
+    "unt\":-16773516,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16773515,\"index\":6},"
+    "{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16773514,\"index\":7},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"iron-stick\"},\"count\":-16773513,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},"
+    "\"count\":-16773512,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16773511,\"index\""
+    ":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16773510,\"index\":11},{\"signal\":{\"ty"
+    "pe\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16773509,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "processing-unit\"},\"count\":-16773508,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":"
+    "-16773507,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16773506,\"index\":"
+    "15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16773505,\"index\":16}]},\"connections\":"
+    "{\"1\":{\"red\":[{\"entity_id\":283},{\"entity_id\":287,\"circuit_id\":1}]}}},{\"entity_number\":289,\"name\":\"decider-"
+    "combinator\",\"position\":{\"x\":382,\"y\":-23.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_"
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":55,\"comparator\":\"=\",\"output_signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"enti"
+    "ty_id\":290}],\"green\":[{\"entity_id\":267,\"circuit_id\":1},{\"entity_id\":287,\"circuit_id\":1}]},\"2\":{\"red\":[{\""
+    "entity_id\":267,\"circuit_id\":2},{\"entity_id\":287,\"circuit_id\":2}]}}},{\"entity_number\":290,\"name\":\"constant-co"
+    "mbinator\",\"position\":{\"x\":380.5,\"y\":-23.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"na"
+    "me\":\"heavy-oil-barrel\"},\"count\":-16773648,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\""
+    "},\"count\":-16773647,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16773646,\"i"
+    "ndex\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16773645,\"index\":4},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16773644,\"index\":5},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"water-barrel\"},\"count\":-16773643,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"co"
+    "unt\":-16773642,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16773641,\"index\":8},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16773640,\"index\":9},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"empty-barrel\"},\"count\":-16773639,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circu"
+    "it\"},\"count\":-16773638,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-1677363"
+    "7,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16773636,\"index\":13},{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16773635,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"electric-engine-unit\"},\"count\":-16773634,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-fram"
+    "e\"},\"count\":-16773633,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":285},{\"entity_id\":289,\"circu"
+    "it_id\":1}]}}},{\"entity_number\":291,\"name\":\"constant-combinator\",\"position\":{\"x\":371.5,\"y\":-20.5},\"control_"
+    "behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16773376,\"index\":1},{\"si"
+    "gnal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16773375,\"index\":2},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-2\"},\"count\":-16773374,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\""
+    ":-16773373,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16773372,\"index\":5},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16773371,\"index\":6},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-6\"},\"count\":-16773370,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\""
+    ":-16773369,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16773368,\"index\":9},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16773367,\"index\":10},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-A\"},\"count\":-16773366,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\""
+    ":-16773365,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16773364,\"index\":13},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16773363,\"index\":14},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-E\"},\"count\":-16773362,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"cou"
+    "nt\":-16773361,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":294}]}}},{\"entity_number\":292,\"name\":"
+    "\"constant-combinator\",\"position\":{\"x\":371.5,\"y\":-21.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-0\"},\"count\":-16773504,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-"
+    "1\"},\"count\":-16773503,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16773502,\"ind"
+    "ex\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16773501,\"index\":4},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-4\"},\"count\":-16773500,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-"
+    "5\"},\"count\":-16773499,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16773498,\"ind"
+    "ex\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16773497,\"index\":8},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-8\"},\"count\":-16773496,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-"
+    "9\"},\"count\":-16773495,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16773494,\"in"
+    "dex\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16773493,\"index\":12},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16773492,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"sig"
+    "nal-D\"},\"count\":-16773491,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16773490,"
+    "\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16773489,\"index\":16}]},\"connections"
+    "\":{\"1\":{\"red\":[{\"entity_id\":296}]}}},{\"entity_number\":293,\"name\":\"constant-combinator\",\"position\":{\"x\":"
+    "373.5,\"y\":-20.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16773"
+    "344,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16773343,\"index\":2},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"stone\"},\"count\":-16773342,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"c"
+    "ount\":-16773341,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16773340,\"index\":5},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16773339,\"index\":6},{\"signal\":{\"type\":\"item\","
+    "\"name\":\"raw-fish\"},\"count\":-16773338,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\""
+    ":-16773337,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16773336,\"index\":9},{\"si"
+    "gnal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16773335,\"index\":10},{\"signal\":{\"type\":\"item\",\"na"
+    "me\":\"steel-plate\"},\"count\":-16773334,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count"
+    "\":-16773333,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16773332,\"index\":13},{\"sign"
+    "al\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16773331,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"explosives\"},\"count\":-16773330,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\""
+    ":-16773329,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":294},{\"entity_id\":298}]}}},{\"entity_number"
+    "\":294,\"name\":\"constant-combinator\",\"position\":{\"x\":372.5,\"y\":-20.5},\"control_behavior\":{\"filters\":[{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16773360,\"index\":1},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-H\"},\"count\":-16773359,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\""
+    ":-16773358,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16773357,\"index\":4},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16773356,\"index\":5},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-L\"},\"count\":-16773355,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"coun"
+    "t\":-16773354,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16773353,\"index\":8},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16773352,\"index\":9},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-P\"},\"count\":-16773351,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"cou"
+    "nt\":-16773350,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16773349,\"index\":12},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16773348,\"index\":13},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-T\"},\"count\":-16773347,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\""
+    "count\":-16773346,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16773345,\"index\":1"
+    "6}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":291},{\"entity_id\":293}]}}},{\"entity_number\":295,\"name\":\"cons"
+    "tant-combinator\",\"position\":{\"x\":373.5,\"y\":-21.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item"
+    "\",\"name\":\"wood\"},\"count\":-16773472,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-1677"
+    "3471,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16773470,\"index\":3},{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"iron-ore\"},\"count\":-16773469,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-or"
+    "e\"},\"count\":-16773468,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16773467,\"ind"
+    "ex\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16773466,\"index\":7},{\"signal\":{\"type\":\"i"
+    "tem\",\"name\":\"iron-plate\"},\"count\":-16773465,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\""
+    "},\"count\":-16773464,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16773463,\"index\""
+    ":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16773462,\"index\":11},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"plastic-bar\"},\"count\":-16773461,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\""
+    "count\":-16773460,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16773459,\"index\":14},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16773458,\"index\":15},{\"signal\":{\"type\":\"item\","
+    "\"name\":\"crude-oil-barrel\"},\"count\":-16773457,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":296},"
+    "{\"entity_id\":300}]}}},{\"entity_number\":296,\"name\":\"constant-combinator\",\"position\":{\"x\":372.5,\"y\":-21.5},\""
+    "control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16773488,\"index\":"
+    "1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16773487,\"index\":2},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-I\"},\"count\":-16773486,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},"
+    "\"count\":-16773485,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16773484,\"index\":"
+    "5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16773483,\"index\":6},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-pink\"},\"count\":-16773482,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\""
+    "},\"count\":-16773481,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16773480,\"index\""
+    ":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16773479,\"index\":10},{\"signal\":{\"type\":\"v"
+    "irtual\",\"name\":\"signal-Q\"},\"count\":-16773478,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\""
+    "},\"count\":-16773477,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16773476,\"index"
+    "\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16773475,\"index\":14},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-U\"},\"count\":-16773474,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-V\"},\"count\":-16773473,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":292},{\"entity_id\":295}]}}},{"
+    "\"entity_number\":297,\"name\":\"decider-combinator\",\"position\":{\"x\":376,\"y\":-20.5},\"direction\":2,\"control_beh"
+    "avior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":60,\"com"
+    "parator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}}"
+    ",\"connections\":{\"1\":{\"red\":[{\"entity_id\":298}],\"green\":[{\"entity_id\":299,\"circuit_id\":1},{\"entity_id\":31"
+    "4,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":299,\"circuit_id\":2},{\"entity_id\":314,\"circuit_id\":2}]}}},{\"e"
+    "ntity_number\":298,\"name\":\"constant-combinator\",\"position\":{\"x\":374.5,\"y\":-20.5},\"control_behavior\":{\"filte"
+    "rs\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16773328,\"index\":1},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16773327,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lu"
+    "bricant-barrel\"},\"count\":-16773326,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"c"
+    "ount\":-16773325,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16773324,\"in"
+    "dex\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16773323,\"index\":6},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"copper-cable\"},\"count\":-16773322,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-sti"
+    "ck\"},\"count\":-16773321,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16773320,"
+    "\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16773319,\"index\":10},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16773318,\"index\":11},{\"signal\":{\"type\":\"item\",\"name"
+    "\":\"advanced-circuit\"},\"count\":-16773317,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},"
+    "\"count\":-16773316,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16773315,\"index\""
+    ":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16773314,\"index\":15},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16773313,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\""
+    "entity_id\":293},{\"entity_id\":297,\"circuit_id\":1}]}}},{\"entity_number\":299,\"name\":\"decider-combinator\",\"posit"
+    "ion\":{\"x\":376,\"y\":-21.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-check\"},\"constant\":58,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name"
+    "\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":300}],\"green"
+    "\":[{\"entity_id\":277,\"circuit_id\":1},{\"entity_id\":297,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":277,\"cir"
+    "cuit_id\":2},{\"entity_id\":297,\"circuit_id\":2}]}}},{\"entity_number\":300,\"name\":\"constant-combinator\",\"position"
+    "\":{\"x\":374.5,\"y\":-21.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barr"
+    "el\"},\"count\":-16773456,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16773455"
+    ",\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16773454,\"index\":3},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16773453,\"index\":4},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"sulfuric-acid-barrel\"},\"count\":-16773452,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel"
+    "\"},\"count\":-16773451,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16773450,\"ind"
+    "ex\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16773449,\"index\":8},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"iron-gear-wheel\"},\"count\":-16773448,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-ba"
+    "rrel\"},\"count\":-16773447,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-167"
+    "73446,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16773445,\"index\":12},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16773444,\"index\":13},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"engine-unit\"},\"count\":-16773443,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-u"
+    "nit\"},\"count\":-16773442,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-1677"
+    "3441,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":295},{\"entity_id\":299,\"circuit_id\":1}]}}},{\"en"
+    "tity_number\":301,\"name\":\"constant-combinator\",\"position\":{\"x\":377.5,\"y\":-20.5},\"control_behavior\":{\"filter"
+    "s\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16773312,\"index\":1},{\"signal\":{\"type\":\"v"
+    "irtual\",\"name\":\"signal-1\"},\"count\":-16773311,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\""
+    "},\"count\":-16773310,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16773309,\"index\""
+    ":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16773308,\"index\":5},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-5\"},\"count\":-16773307,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"}"
+    ",\"count\":-16773306,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16773305,\"index\""
+    ":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16773304,\"index\":9},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-9\"},\"count\":-16773303,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\""
+    "},\"count\":-16773302,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16773301,\"index"
+    "\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16773300,\"index\":13},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-D\"},\"count\":-16773299,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-E\"},\"count\":-16773298,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16773297,\"i"
+    "ndex\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":304}]}}},{\"entity_number\":302,\"name\":\"constant-combina"
+    "tor\",\"position\":{\"x\":377.5,\"y\":-21.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name"
+    "\":\"signal-0\"},\"count\":-16773440,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16"
+    "773439,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16773438,\"index\":3},{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16773437,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-4\"},\"count\":-16773436,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-1677"
+    "3435,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16773434,\"index\":7},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16773433,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-8\"},\"count\":-16773432,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-1677"
+    "3431,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16773430,\"index\":11},{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16773429,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name"
+    "\":\"signal-C\"},\"count\":-16773428,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-1"
+    "6773427,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16773426,\"index\":15},{\"sign"
+    "al\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16773425,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{"
+    "\"entity_id\":306}]}}},{\"entity_number\":303,\"name\":\"constant-combinator\",\"position\":{\"x\":379.5,\"y\":-20.5},\""
+    "control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16773280,\"index\":1},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16773279,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "stone\"},\"count\":-16773278,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16773277,\"in"
+    "dex\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16773276,\"index\":5},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"uranium-ore\"},\"count\":-16773275,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\""
+    "},\"count\":-16773274,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16773273,\"index\""
+    ":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16773272,\"index\":9},{\"signal\":{\"type\":\"i"
+    "tem\",\"name\":\"solid-fuel\"},\"count\":-16773271,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\""
+    "},\"count\":-16773270,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16773269,\"index"
+    "\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16773268,\"index\":13},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"battery\"},\"count\":-16773267,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"co"
+    "unt\":-16773266,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16773265,\"index\""
+    ":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":304},{\"entity_id\":308}]}}},{\"entity_number\":304,\"name\":\"co"
+    "nstant-combinator\",\"position\":{\"x\":378.5,\"y\":-20.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-G\"},\"count\":-16773296,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"}"
+    ",\"count\":-16773295,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16773294,\"index\""
+    ":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16773293,\"index\":4},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-K\"},\"count\":-16773292,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"}"
+    ",\"count\":-16773291,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16773290,\"inde"
+    "x\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16773289,\"index\":8},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-O\"},\"count\":-16773288,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\""
+    "},\"count\":-16773287,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16773286,\"index"
+    "\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16773285,\"index\":12},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-S\"},\"count\":-16773284,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-T\"},\"count\":-16773283,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16773282,\"i"
+    "ndex\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16773281,\"index\":16}]},\"connections\":"
+    "{\"1\":{\"red\":[{\"entity_id\":301},{\"entity_id\":303}]}}},{\"entity_number\":305,\"name\":\"constant-combinator\",\"p"
+    "osition\":{\"x\":379.5,\"y\":-21.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"}"
+    ",\"count\":-16773408,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16773407,\"index\":2},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16773406,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"iron-ore\"},\"count\":-16773405,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16773"
+    "404,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16773403,\"index\":6},{\"signal\":{"
+    "\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16773402,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron"
+    "-plate\"},\"count\":-16773401,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16773400"
+    ",\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16773399,\"index\":10},{\"signal\":{\"t"
+    "ype\":\"item\",\"name\":\"steel-plate\"},\"count\":-16773398,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"pla"
+    "stic-bar\"},\"count\":-16773397,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16773396,\""
+    "index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16773395,\"index\":14},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"explosives\"},\"count\":-16773394,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil"
+    "-barrel\"},\"count\":-16773393,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":306},{\"entity_id\":310}]"
+    "}}},{\"entity_number\":306,\"name\":\"constant-combinator\",\"position\":{\"x\":378.5,\"y\":-21.5},\"control_behavior\":"
+    "{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16773424,\"index\":1},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16773423,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-I\"},\"count\":-16773422,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16773421"
+    ",\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16773420,\"index\":5},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16773419,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-pink\"},\"count\":-16773418,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16773"
+    "417,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16773416,\"index\":9},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16773415,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-Q\"},\"count\":-16773414,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-167"
+    "73413,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16773412,\"index\":13},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16773411,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-U\"},\"count\":-16773410,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":"
+    "-16773409,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":302},{\"entity_id\":305}]}}},{\"entity_number\""
+    ":307,\"name\":\"decider-combinator\",\"position\":{\"x\":382,\"y\":-20.5},\"direction\":2,\"control_behavior\":{\"decide"
+    "r_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":61,\"comparator\":\"=\",\""
+    "output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{"
+    "\"1\":{\"red\":[{\"entity_id\":308}],\"green\":[{\"entity_id\":309,\"circuit_id\":1},{\"entity_id\":319,\"circuit_id\":1"
+    "}]},\"2\":{\"red\":[{\"entity_id\":309,\"circuit_id\":2},{\"entity_id\":319,\"circuit_id\":2}]}}},{\"entity_number\":308"
+    ",\"name\":\"constant-combinator\",\"position\":{\"x\":380.5,\"y\":-20.5},\"control_behavior\":{\"filters\":[{\"signal\":"
+    "{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16773264,\"index\":1},{\"signal\":{\"type\":\"item\",\"name"
+    "\":\"light-oil-barrel\"},\"count\":-16773263,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},"
+    "\"count\":-16773262,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16773261,\""
+    "index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16773260,\"index\":5},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16773259,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"copper-cable\"},\"count\":-16773258,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16"
+    "773257,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16773256,\"index\":9},{\"sig"
+    "nal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16773255,\"index\":10},{\"signal\":{\"type\":\"item\",\"n"
+    "ame\":\"electronic-circuit\"},\"count\":-16773254,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circu"
+    "it\"},\"count\":-16773253,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16773252"
+    ",\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16773251,\"index\":14},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16773250,\"index\":15},{\"signal\":{\"type\":\"item\",\"na"
+    "me\":\"flying-robot-frame\"},\"count\":-16773249,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":303},{\""
+    "entity_id\":307,\"circuit_id\":1}]}}},{\"entity_number\":309,\"name\":\"decider-combinator\",\"position\":{\"x\":382,\"y"
+    "\":-21.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":"
+    "\"signal-check\"},\"constant\":59,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everyth"
+    "ing\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":310}],\"green\":[{\"entity_id\":"
+    "287,\"circuit_id\":1},{\"entity_id\":307,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":287,\"circuit_id\":2},{\"ent"
+    "ity_id\":307,\"circuit_id\":2}]}}},{\"entity_number\":310,\"name\":\"constant-combinator\",\"position\":{\"x\":380.5,\"y"
+    "\":-21.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16"
+    "773392,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16773391,\"index\":2},{\"si"
+    "gnal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16773390,\"index\":3},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"petroleum-gas-barrel\"},\"count\":-16773389,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-"
+    "acid-barrel\"},\"count\":-16773388,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-167"
+    "73387,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16773386,\"index\":7},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16773385,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "iron-gear-wheel\"},\"count\":-16773384,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":"
+    "-16773383,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16773382,\"index\":11"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16773381,\"index\":12},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"processing-unit\"},\"count\":-16773380,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engin"
+    "e-unit\"},\"count\":-16773379,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":"
+    "-16773378,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16773377,\"index\":16"
+    "}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":305},{\"entity_id\":309,\"circuit_id\":1}]}}},{\"entity_number\":311"
+    ",\"name\":\"constant-combinator\",\"position\":{\"x\":371.5,\"y\":-19.5},\"control_behavior\":{\"filters\":[{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16773248,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-1\"},\"count\":-16773247,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-1677"
+    "3246,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16773245,\"index\":4},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16773244,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-5\"},\"count\":-16773243,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-1677"
+    "3242,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16773241,\"index\":8},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16773240,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-9\"},\"count\":-16773239,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-167"
+    "73238,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16773237,\"index\":12},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16773236,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-D\"},\"count\":-16773235,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":"
+    "-16773234,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16773233,\"index\":16}]},\"c"
+    "onnections\":{\"1\":{\"red\":[{\"entity_id\":313}]}}},{\"entity_number\":312,\"name\":\"constant-combinator\",\"position"
+    "\":{\"x\":373.5,\"y\":-19.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"coun"
+    "t\":-16773216,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16773215,\"index\":2},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16773214,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-"
+    "ore\"},\"count\":-16773213,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16773212,\"in"
+    "dex\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16773211,\"index\":6},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"raw-fish\"},\"count\":-16773210,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\""
+    "},\"count\":-16773209,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16773208,\"index"
+    "\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16773207,\"index\":10},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"steel-plate\"},\"count\":-16773206,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar"
+    "\"},\"count\":-16773205,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16773204,\"index\":"
+    "13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16773203,\"index\":14},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"explosives\"},\"count\":-16773202,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\""
+    "},\"count\":-16773201,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":313},{\"entity_id\":315}]}}},{\"en"
+    "tity_number\":313,\"name\":\"constant-combinator\",\"position\":{\"x\":372.5,\"y\":-19.5},\"control_behavior\":{\"filter"
+    "s\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16773232,\"index\":1},{\"signal\":{\"type\":\"v"
+    "irtual\",\"name\":\"signal-H\"},\"count\":-16773231,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\""
+    "},\"count\":-16773230,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16773229,\"index\""
+    ":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16773228,\"index\":5},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-L\"},\"count\":-16773227,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink"
+    "\"},\"count\":-16773226,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16773225,\"inde"
+    "x\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16773224,\"index\":9},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-P\"},\"count\":-16773223,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q"
+    "\"},\"count\":-16773222,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16773221,\"ind"
+    "ex\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16773220,\"index\":13},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-T\"},\"count\":-16773219,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signa"
+    "l-U\"},\"count\":-16773218,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16773217,\""
+    "index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":311},{\"entity_id\":312}]}}},{\"entity_number\":314,\"name"
+    "\":\"decider-combinator\",\"position\":{\"x\":376,\"y\":-19.5},\"direction\":2,\"control_behavior\":{\"decider_condition"
+    "s\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":62,\"comparator\":\"=\",\"output_sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"r"
+    "ed\":[{\"entity_id\":315}],\"green\":[{\"entity_id\":297,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":297,\"circui"
+    "t_id\":2}]}}},{\"entity_number\":315,\"name\":\"constant-combinator\",\"position\":{\"x\":374.5,\"y\":-19.5},\"control_b"
+    "ehavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16773200,\"index\":1},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16773199,\"index\":2},{\"signal\":{\"type\":\"it"
+    "em\",\"name\":\"lubricant-barrel\"},\"count\":-16773198,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum"
+    "-gas-barrel\"},\"count\":-16773197,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"coun"
+    "t\":-16773196,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16773195,\"index\":6},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16773194,\"index\":7},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"iron-stick\"},\"count\":-16773193,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"c"
+    "ount\":-16773192,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16773191,\"index\":10"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16773190,\"index\":11},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16773189,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"pro"
+    "cessing-unit\"},\"count\":-16773188,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16"
+    "773187,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16773186,\"index\":15}"
+    ",{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16773185,\"index\":16}]},\"connections\":{\""
+    "1\":{\"red\":[{\"entity_id\":312},{\"entity_id\":314,\"circuit_id\":1}]}}},{\"entity_number\":316,\"name\":\"constant-co"
+    "mbinator\",\"position\":{\"x\":377.5,\"y\":-19.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-0\"},\"count\":-16773184,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\""
+    ":-16773183,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16773182,\"index\":3},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16773181,\"index\":4},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-4\"},\"count\":-16773180,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\""
+    ":-16773179,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16773178,\"index\":7},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16773177,\"index\":8},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-8\"},\"count\":-16773176,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\""
+    ":-16773175,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16773174,\"index\":11},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16773173,\"index\":12},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-C\"},\"count\":-16773172,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"cou"
+    "nt\":-16773171,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16773170,\"index\":15},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16773169,\"index\":16}]},\"connections\":{\"1\":{\"r"
+    "ed\":[{\"entity_id\":318}]}}},{\"entity_number\":317,\"name\":\"constant-combinator\",\"position\":{\"x\":379.5,\"y\":-1"
+    "9.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16773152,\"index\":"
+    "1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16773151,\"index\":2},{\"signal\":{\"type\":\"item\",\"n"
+    "ame\":\"stone\"},\"count\":-16773150,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16773"
+    "149,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16773148,\"index\":5},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16773147,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw"
+    "-fish\"},\"count\":-16773146,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16773145,\""
+    "index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16773144,\"index\":9},{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16773143,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-"
+    "plate\"},\"count\":-16773142,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16773141,"
+    "\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16773140,\"index\":13},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"battery\"},\"count\":-16773139,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\""
+    "},\"count\":-16773138,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16773137,\""
+    "index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":318},{\"entity_id\":320}]}}},{\"entity_number\":318,\"name"
+    "\":\"constant-combinator\",\"position\":{\"x\":378.5,\"y\":-19.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16773168,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-H\"},\"count\":-16773167,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16773166,\""
+    "index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16773165,\"index\":4},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16773164,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-L\"},\"count\":-16773163,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16773162"
+    ",\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16773161,\"index\":8},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16773160,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-P\"},\"count\":-16773159,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-1677315"
+    "8,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16773157,\"index\":12},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16773156,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-T\"},\"count\":-16773155,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-167"
+    "73154,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16773153,\"index\":16}]},\"conne"
+    "ctions\":{\"1\":{\"red\":[{\"entity_id\":316},{\"entity_id\":317}]}}},{\"entity_number\":319,\"name\":\"decider-combinat"
+    "or\",\"position\":{\"x\":382,\"y\":-19.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":63,\"comparator\":\"=\",\"output_signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":"
+    "320}],\"green\":[{\"entity_id\":307,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":307,\"circuit_id\":2}]}}},{\"enti"
+    "ty_number\":320,\"name\":\"constant-combinator\",\"position\":{\"x\":380.5,\"y\":-19.5},\"control_behavior\":{\"filters\""
+    ":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16773136,\"index\":1},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"light-oil-barrel\"},\"count\":-16773135,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubrica"
+    "nt-barrel\"},\"count\":-16773134,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\""
+    ":-16773133,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16773132,\"index\":"
+    "5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16773131,\"index\":6},{\"signal\":{\"type\":\"it"
+    "em\",\"name\":\"copper-cable\"},\"count\":-16773130,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"}"
+    ",\"count\":-16773129,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16773128,\"ind"
+    "ex\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16773127,\"index\":10},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16773126,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"a"
+    "dvanced-circuit\"},\"count\":-16773125,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"coun"
+    "t\":-16773124,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16773123,\"index\":14},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16773122,\"index\":15},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16773121,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entit"
+    "y_id\":317},{\"entity_id\":319,\"circuit_id\":1}]}}}],\"item\":\"blueprint\",\"label\":\"64-value ROM\",\"version\":2814"
+    "79278690304}}";
+
+static const rom_span_t rom_12_spans[] = {
+    { 29, 130, ROM_SPAN_DESC },
+    { 582, 9, 0 },
+    { 658, 9, 1 },
+    { 734, 9, 2 },
+    { 810, 9, 3 },
+    { 886, 9, 4 },
+    { 962, 9, 5 },
+    { 1038, 9, 6 },
+    { 1114, 9, 7 },
+    { 1190, 9, 8 },
+    { 1266, 9, 9 },
+    { 1343, 9, 10 },
+    { 1420, 9, 11 },
+    { 1497, 9, 12 },
+    { 1574, 9, 13 },
+    { 1651, 9, 14 },
+    { 1728, 9, 15 },
+    { 1959, 9, 32 },
+    { 2028, 9, 33 },
+    { 2098, 9, 34 },
+    { 2171, 9, 35 },
+    { 2246, 9, 36 },
+    { 2322, 9, 37 },
+    { 2395, 9, 38 },
+    { 2470, 9, 39 },
+    { 2547, 9, 40 },
+    { 2622, 9, 41 },
+    { 2699, 9, 42 },
+    { 2776, 9, 43 },
+    { 2848, 9, 44 },
+    { 2921, 9, 45 },
+    { 2997, 9, 46 },
+    { 3079, 9, 47 },
+    { 3333, 9, 16 },
+    { 3409, 9, 17 },
+    { 3485, 9, 18 },
+    { 3561, 9, 19 },
+    { 3637, 9, 20 },
+    { 3713, 9, 21 },
+    { 3792, 9, 22 },
+    { 3868, 9, 23 },
+    { 3944, 9, 24 },
+    { 4020, 9, 25 },
+    { 4097, 9, 26 },
+    { 4174, 9, 27 },
+    { 4251, 9, 28 },
+    { 4328, 9, 29 },
+    { 4405, 9, 30 },
+    { 4482, 9, 31 },
+    { 4770, 1, ROM_SPAN_ROW },
+    { 5251, 9, 48 },
+    { 5332, 9, 49 },
+    { 5413, 9, 50 },
+    { 5498, 9, 51 },
+    { 5583, 9, 52 },
+    { 5660, 9, 53 },
+    { 5737, 9, 54 },
+    { 5812, 9, 55 },
+    { 5892, 9, 56 },
+    { 5969, 9, 57 },
+    { 6053, 9, 58 },
+    { 6135, 9, 59 },
+    { 6216, 9, 60 },
+    { 6293, 9, 61 },
+    { 6379, 9, 62 },
+    { 6463, 9, 63 },
+    { 6732, 9, 64 },
+    { 6808, 9, 65 },
+    { 6884, 9, 66 },
+    { 6960, 9, 67 },
+    { 7036, 9, 68 },
+    { 7112, 9, 69 },
+    { 7188, 9, 70 },
+    { 7264, 9, 71 },
+    { 7340, 9, 72 },
+    { 7416, 9, 73 },
+    { 7493, 9, 74 },
+    { 7570, 9, 75 },
+    { 7647, 9, 76 },
+    { 7724, 9, 77 },
+    { 7801, 9, 78 },
+    { 7878, 9, 79 },
+    { 8109, 9, 96 },
+    { 8178, 9, 97 },
+    { 8248, 9, 98 },
+    { 8321, 9, 99 },
+    { 8396, 9, 100 },
+    { 8472, 9, 101 },
+    { 8545, 9, 102 },
+    { 8620, 9, 103 },
+    { 8697, 9, 104 },
+    { 8772, 9, 105 },
+    { 8849, 9, 106 },
+    { 8926, 9, 107 },
+    { 8998, 9, 108 },
+    { 9071, 9, 109 },
+    { 9147, 9, 110 },
+    { 9229, 9, 111 },
+    { 9484, 9, 80 },
+    { 9560, 9, 81 },
+    { 9636, 9, 82 },
+    { 9712, 9, 83 },
+    { 9788, 9, 84 },
+    { 9864, 9, 85 },
+    { 9943, 9, 86 },
+    { 10019, 9, 87 },
+    { 10095, 9, 88 },
+    { 10171, 9, 89 },
+    { 10248, 9, 90 },
+    { 10325, 9, 91 },
+    { 10402, 9, 92 },
+    { 10479, 9, 93 },
+    { 10556, 9, 94 },
+    { 10633, 9, 95 },
+    { 10921, 1, ROM_SPAN_ROW },
+    { 11404, 9, 112 },
+    { 11485, 9, 113 },
+    { 11566, 9, 114 },
+    { 11651, 9, 115 },
+    { 11736, 9, 116 },
+    { 11813, 9, 117 },
+    { 11890, 9, 118 },
+    { 11965, 9, 119 },
+    { 12045, 9, 120 },
+    { 12122, 9, 121 },
+    { 12206, 9, 122 },
+    { 12288, 9, 123 },
+    { 12369, 9, 124 },
+    { 12446, 9, 125 },
+    { 12532, 9, 126 },
+    { 12616, 9, 127 },
+    { 12886, 9, 256 },
+    { 12962, 9, 257 },
+    { 13038, 9, 258 },
+    { 13114, 9, 259 },
+    { 13190, 9, 260 },
+    { 13266, 9, 261 },
+    { 13342, 9, 262 },
+    { 13418, 9, 263 },
+    { 13494, 9, 264 },
+    { 13570, 9, 265 },
+    { 13647, 9, 266 },
+    { 13724, 9, 267 },
+    { 13801, 9, 268 },
+    { 13878, 9, 269 },
+    { 13955, 9, 270 },
+    { 14032, 9, 271 },
+    { 14272, 9, 128 },
+    { 14348, 9, 129 },
+    { 14424, 9, 130 },
+    { 14500, 9, 131 },
+    { 14576, 9, 132 },
+    { 14652, 9, 133 },
+    { 14728, 9, 134 },
+    { 14804, 9, 135 },
+    { 14880, 9, 136 },
+    { 14956, 9, 137 },
+    { 15033, 9, 138 },
+    { 15110, 9, 139 },
+    { 15187, 9, 140 },
+    { 15264, 9, 141 },
+    { 15341, 9, 142 },
+    { 15418, 9, 143 },
+    { 15651, 9, 288 },
+    { 15720, 9, 289 },
+    { 15790, 9, 290 },
+    { 15863, 9, 291 },
+    { 15938, 9, 292 },
+    { 16014, 9, 293 },
+    { 16087, 9, 294 },
+    { 16162, 9, 295 },
+    { 16239, 9, 296 },
+    { 16314, 9, 297 },
+    { 16391, 9, 298 },
+    { 16468, 9, 299 },
+    { 16540, 9, 300 },
+    { 16613, 9, 301 },
+    { 16689, 9, 302 },
+    { 16771, 9, 303 },
+    { 17028, 9, 272 },
+    { 17104, 9, 273 },
+    { 17180, 9, 274 },
+    { 17256, 9, 275 },
+    { 17332, 9, 276 },
+    { 17408, 9, 277 },
+    { 17487, 9, 278 },
+    { 17563, 9, 279 },
+    { 17639, 9, 280 },
+    { 17715, 9, 281 },
+    { 17792, 9, 282 },
+    { 17869, 9, 283 },
+    { 17946, 9, 284 },
+    { 18023, 9, 285 },
+    { 18100, 9, 286 },
+    { 18177, 9, 287 },
+    { 18427, 9, 160 },
+    { 18496, 9, 161 },
+    { 18566, 9, 162 },
+    { 18639, 9, 163 },
+    { 18714, 9, 164 },
+    { 18790, 9, 165 },
+    { 18863, 9, 166 },
+    { 18938, 9, 167 },
+    { 19015, 9, 168 },
+    { 19090, 9, 169 },
+    { 19167, 9, 170 },
+    { 19244, 9, 171 },
+    { 19316, 9, 172 },
+    { 19389, 9, 173 },
+    { 19465, 9, 174 },
+    { 19547, 9, 175 },
+    { 19804, 9, 144 },
+    { 19880, 9, 145 },
+    { 19956, 9, 146 },
+    { 20032, 9, 147 },
+    { 20108, 9, 148 },
+    { 20184, 9, 149 },
+    { 20263, 9, 150 },
+    { 20339, 9, 151 },
+    { 20415, 9, 152 },
+    { 20491, 9, 153 },
+    { 20568, 9, 154 },
+    { 20645, 9, 155 },
+    { 20722, 9, 156 },
+    { 20799, 9, 157 },
+    { 20876, 9, 158 },
+    { 20953, 9, 159 },
+    { 21244, 1, ROM_SPAN_ROW },
+    { 21729, 9, 304 },
+    { 21810, 9, 305 },
+    { 21891, 9, 306 },
+    { 21976, 9, 307 },
+    { 22061, 9, 308 },
+    { 22138, 9, 309 },
+    { 22215, 9, 310 },
+    { 22290, 9, 311 },
+    { 22370, 9, 312 },
+    { 22447, 9, 313 },
+    { 22531, 9, 314 },
+    { 22613, 9, 315 },
+    { 22694, 9, 316 },
+    { 22771, 9, 317 },
+    { 22857, 9, 318 },
+    { 22941, 9, 319 },
+    { 23247, 1, ROM_SPAN_ROW },
+    { 23730, 9, 176 },
+    { 23811, 9, 177 },
+    { 23892, 9, 178 },
+    { 23977, 9, 179 },
+    { 24062, 9, 180 },
+    { 24139, 9, 181 },
+    { 24216, 9, 182 },
+    { 24291, 9, 183 },
+    { 24371, 9, 184 },
+    { 24448, 9, 185 },
+    { 24532, 9, 186 },
+    { 24614, 9, 187 },
+    { 24695, 9, 188 },
+    { 24772, 9, 189 },
+    { 24858, 9, 190 },
+    { 24942, 9, 191 },
+    { 25214, 9, 320 },
+    { 25290, 9, 321 },
+    { 25366, 9, 322 },
+    { 25442, 9, 323 },
+    { 25518, 9, 324 },
+    { 25594, 9, 325 },
+    { 25670, 9, 326 },
+    { 25746, 9, 327 },
+    { 25822, 9, 328 },
+    { 25898, 9, 329 },
+    { 25975, 9, 330 },
+    { 26052, 9, 331 },
+    { 26129, 9, 332 },
+    { 26206, 9, 333 },
+    { 26283, 9, 334 },
+    { 26360, 9, 335 },
+    { 26600, 9, 192 },
+    { 26676, 9, 193 },
+    { 26752, 9, 194 },
+    { 26828, 9, 195 },
+    { 26904, 9, 196 },
+    { 26980, 9, 197 },
+    { 27056, 9, 198 },
+    { 27132, 9, 199 },
+    { 27208, 9, 200 },
+    { 27284, 9, 201 },
+    { 27361, 9, 202 },
+    { 27438, 9, 203 },
+    { 27515, 9, 204 },
+    { 27592, 9, 205 },
+    { 27669, 9, 206 },
+    { 27746, 9, 207 },
+    { 27979, 9, 352 },
+    { 28048, 9, 353 },
+    { 28118, 9, 354 },
+    { 28191, 9, 355 },
+    { 28266, 9, 356 },
+    { 28342, 9, 357 },
+    { 28415, 9, 358 },
+    { 28490, 9, 359 },
+    { 28567, 9, 360 },
+    { 28642, 9, 361 },
+    { 28719, 9, 362 },
+    { 28796, 9, 363 },
+    { 28868, 9, 364 },
+    { 28941, 9, 365 },
+    { 29017, 9, 366 },
+    { 29099, 9, 367 },
+    { 29356, 9, 336 },
+    { 29432, 9, 337 },
+    { 29508, 9, 338 },
+    { 29584, 9, 339 },
+    { 29660, 9, 340 },
+    { 29736, 9, 341 },
+    { 29815, 9, 342 },
+    { 29891, 9, 343 },
+    { 29967, 9, 344 },
+    { 30043, 9, 345 },
+    { 30120, 9, 346 },
+    { 30197, 9, 347 },
+    { 30274, 9, 348 },
+    { 30351, 9, 349 },
+    { 30428, 9, 350 },
+    { 30505, 9, 351 },
+    { 30755, 9, 224 },
+    { 30824, 9, 225 },
+    { 30894, 9, 226 },
+    { 30967, 9, 227 },
+    { 31042, 9, 228 },
+    { 31118, 9, 229 },
+    { 31191, 9, 230 },
+    { 31266, 9, 231 },
+    { 31343, 9, 232 },
+    { 31418, 9, 233 },
+    { 31495, 9, 234 },
+    { 31572, 9, 235 },
+    { 31644, 9, 236 },
+    { 31717, 9, 237 },
+    { 31793, 9, 238 },
+    { 31875, 9, 239 },
+    { 32132, 9, 208 },
+    { 32208, 9, 209 },
+    { 32284, 9, 210 },
+    { 32360, 9, 211 },
+    { 32436, 9, 212 },
+    { 32512, 9, 213 },
+    { 32591, 9, 214 },
+    { 32667, 9, 215 },
+    { 32743, 9, 216 },
+    { 32819, 9, 217 },
+    { 32896, 9, 218 },
+    { 32973, 9, 219 },
+    { 33050, 9, 220 },
+    { 33127, 9, 221 },
+    { 33204, 9, 222 },
+    { 33281, 9, 223 },
+    { 33572, 1, ROM_SPAN_ROW },
+    { 34057, 9, 368 },
+    { 34138, 9, 369 },
+    { 34219, 9, 370 },
+    { 34304, 9, 371 },
+    { 34389, 9, 372 },
+    { 34466, 9, 373 },
+    { 34543, 9, 374 },
+    { 34618, 9, 375 },
+    { 34698, 9, 376 },
+    { 34775, 9, 377 },
+    { 34859, 9, 378 },
+    { 34941, 9, 379 },
+    { 35022, 9, 380 },
+    { 35099, 9, 381 },
+    { 35185, 9, 382 },
+    { 35269, 9, 383 },
+    { 35575, 1, ROM_SPAN_ROW },
+    { 36058, 9, 240 },
+    { 36139, 9, 241 },
+    { 36220, 9, 242 },
+    { 36305, 9, 243 },
+    { 36390, 9, 244 },
+    { 36467, 9, 245 },
+    { 36544, 9, 246 },
+    { 36619, 9, 247 },
+    { 36699, 9, 248 },
+    { 36776, 9, 249 },
+    { 36860, 9, 250 },
+    { 36942, 9, 251 },
+    { 37023, 9, 252 },
+    { 37100, 9, 253 },
+    { 37186, 9, 254 },
+    { 37270, 9, 255 },
+    { 37542, 9, 512 },
+    { 37618, 9, 513 },
+    { 37694, 9, 514 },
+    { 37770, 9, 515 },
+    { 37846, 9, 516 },
+    { 37922, 9, 517 },
+    { 37998, 9, 518 },
+    { 38074, 9, 519 },
+    { 38150, 9, 520 },
+    { 38226, 9, 521 },
+    { 38303, 9, 522 },
+    { 38380, 9, 523 },
+    { 38457, 9, 524 },
+    { 38534, 9, 525 },
+    { 38611, 9, 526 },
+    { 38688, 9, 527 },
+    { 38928, 9, 384 },
+    { 39004, 9, 385 },
+    { 39080, 9, 386 },
+    { 39156, 9, 387 },
+    { 39232, 9, 388 },
+    { 39308, 9, 389 },
+    { 39384, 9, 390 },
+    { 39460, 9, 391 },
+    { 39536, 9, 392 },
+    { 39612, 9, 393 },
+    { 39689, 9, 394 },
+    { 39766, 9, 395 },
+    { 39843, 9, 396 },
+    { 39920, 9, 397 },
+    { 39997, 9, 398 },
+    { 40074, 9, 399 },
+    { 40307, 9, 544 },
+    { 40376, 9, 545 },
+    { 40446, 9, 546 },
+    { 40519, 9, 547 },
+    { 40594, 9, 548 },
+    { 40670, 9, 549 },
+    { 40743, 9, 550 },
+    { 40818, 9, 551 },
+    { 40895, 9, 552 },
+    { 40970, 9, 553 },
+    { 41047, 9, 554 },
+    { 41124, 9, 555 },
+    { 41196, 9, 556 },
+    { 41269, 9, 557 },
+    { 41345, 9, 558 },
+    { 41427, 9, 559 },
+    { 41684, 9, 528 },
+    { 41760, 9, 529 },
+    { 41836, 9, 530 },
+    { 41912, 9, 531 },
+    { 41988, 9, 532 },
+    { 42064, 9, 533 },
+    { 42143, 9, 534 },
+    { 42219, 9, 535 },
+    { 42295, 9, 536 },
+    { 42371, 9, 537 },
+    { 42448, 9, 538 },
+    { 42525, 9, 539 },
+    { 42602, 9, 540 },
+    { 42679, 9, 541 },
+    { 42756, 9, 542 },
+    { 42833, 9, 543 },
+    { 43083, 9, 416 },
+    { 43152, 9, 417 },
+    { 43222, 9, 418 },
+    { 43295, 9, 419 },
+    { 43370, 9, 420 },
+    { 43446, 9, 421 },
+    { 43519, 9, 422 },
+    { 43594, 9, 423 },
+    { 43671, 9, 424 },
+    { 43746, 9, 425 },
+    { 43823, 9, 426 },
+    { 43900, 9, 427 },
+    { 43972, 9, 428 },
+    { 44045, 9, 429 },
+    { 44121, 9, 430 },
+    { 44203, 9, 431 },
+    { 44460, 9, 400 },
+    { 44536, 9, 401 },
+    { 44612, 9, 402 },
+    { 44688, 9, 403 },
+    { 44764, 9, 404 },
+    { 44840, 9, 405 },
+    { 44919, 9, 406 },
+    { 44995, 9, 407 },
+    { 45071, 9, 408 },
+    { 45147, 9, 409 },
+    { 45224, 9, 410 },
+    { 45301, 9, 411 },
+    { 45378, 9, 412 },
+    { 45455, 9, 413 },
+    { 45532, 9, 414 },
+    { 45609, 9, 415 },
+    { 45900, 1, ROM_SPAN_ROW },
+    { 46385, 9, 560 },
+    { 46466, 9, 561 },
+    { 46547, 9, 562 },
+    { 46632, 9, 563 },
+    { 46717, 9, 564 },
+    { 46794, 9, 565 },
+    { 46871, 9, 566 },
+    { 46946, 9, 567 },
+    { 47026, 9, 568 },
+    { 47103, 9, 569 },
+    { 47187, 9, 570 },
+    { 47269, 9, 571 },
+    { 47350, 9, 572 },
+    { 47427, 9, 573 },
+    { 47513, 9, 574 },
+    { 47597, 9, 575 },
+    { 47903, 1, ROM_SPAN_ROW },
+    { 48388, 9, 432 },
+    { 48469, 9, 433 },
+    { 48550, 9, 434 },
+    { 48635, 9, 435 },
+    { 48720, 9, 436 },
+    { 48797, 9, 437 },
+    { 48874, 9, 438 },
+    { 48949, 9, 439 },
+    { 49029, 9, 440 },
+    { 49106, 9, 441 },
+    { 49190, 9, 442 },
+    { 49272, 9, 443 },
+    { 49353, 9, 444 },
+    { 49430, 9, 445 },
+    { 49516, 9, 446 },
+    { 49600, 9, 447 },
+    { 49872, 9, 576 },
+    { 49948, 9, 577 },
+    { 50024, 9, 578 },
+    { 50100, 9, 579 },
+    { 50176, 9, 580 },
+    { 50252, 9, 581 },
+    { 50328, 9, 582 },
+    { 50404, 9, 583 },
+    { 50480, 9, 584 },
+    { 50556, 9, 585 },
+    { 50633, 9, 586 },
+    { 50710, 9, 587 },
+    { 50787, 9, 588 },
+    { 50864, 9, 589 },
+    { 50941, 9, 590 },
+    { 51018, 9, 591 },
+    { 51258, 9, 448 },
+    { 51334, 9, 449 },
+    { 51410, 9, 450 },
+    { 51486, 9, 451 },
+    { 51562, 9, 452 },
+    { 51638, 9, 453 },
+    { 51714, 9, 454 },
+    { 51790, 9, 455 },
+    { 51866, 9, 456 },
+    { 51942, 9, 457 },
+    { 52019, 9, 458 },
+    { 52096, 9, 459 },
+    { 52173, 9, 460 },
+    { 52250, 9, 461 },
+    { 52327, 9, 462 },
+    { 52404, 9, 463 },
+    { 52637, 9, 608 },
+    { 52706, 9, 609 },
+    { 52776, 9, 610 },
+    { 52849, 9, 611 },
+    { 52924, 9, 612 },
+    { 53000, 9, 613 },
+    { 53073, 9, 614 },
+    { 53148, 9, 615 },
+    { 53225, 9, 616 },
+    { 53300, 9, 617 },
+    { 53377, 9, 618 },
+    { 53454, 9, 619 },
+    { 53526, 9, 620 },
+    { 53599, 9, 621 },
+    { 53675, 9, 622 },
+    { 53757, 9, 623 },
+    { 54014, 9, 592 },
+    { 54090, 9, 593 },
+    { 54166, 9, 594 },
+    { 54242, 9, 595 },
+    { 54318, 9, 596 },
+    { 54394, 9, 597 },
+    { 54473, 9, 598 },
+    { 54549, 9, 599 },
+    { 54625, 9, 600 },
+    { 54701, 9, 601 },
+    { 54778, 9, 602 },
+    { 54855, 9, 603 },
+    { 54932, 9, 604 },
+    { 55009, 9, 605 },
+    { 55086, 9, 606 },
+    { 55163, 9, 607 },
+    { 55413, 9, 480 },
+    { 55482, 9, 481 },
+    { 55552, 9, 482 },
+    { 55625, 9, 483 },
+    { 55700, 9, 484 },
+    { 55776, 9, 485 },
+    { 55849, 9, 486 },
+    { 55924, 9, 487 },
+    { 56001, 9, 488 },
+    { 56076, 9, 489 },
+    { 56153, 9, 490 },
+    { 56230, 9, 491 },
+    { 56302, 9, 492 },
+    { 56375, 9, 493 },
+    { 56451, 9, 494 },
+    { 56533, 9, 495 },
+    { 56790, 9, 464 },
+    { 56866, 9, 465 },
+    { 56942, 9, 466 },
+    { 57018, 9, 467 },
+    { 57094, 9, 468 },
+    { 57170, 9, 469 },
+    { 57249, 9, 470 },
+    { 57325, 9, 471 },
+    { 57401, 9, 472 },
+    { 57477, 9, 473 },
+    { 57554, 9, 474 },
+    { 57631, 9, 475 },
+    { 57708, 9, 476 },
+    { 57785, 9, 477 },
+    { 57862, 9, 478 },
+    { 57939, 9, 479 },
+    { 58230, 1, ROM_SPAN_ROW },
+    { 58715, 9, 624 },
+    { 58796, 9, 625 },
+    { 58877, 9, 626 },
+    { 58962, 9, 627 },
+    { 59047, 9, 628 },
+    { 59124, 9, 629 },
+    { 59201, 9, 630 },
+    { 59276, 9, 631 },
+    { 59356, 9, 632 },
+    { 59433, 9, 633 },
+    { 59517, 9, 634 },
+    { 59599, 9, 635 },
+    { 59680, 9, 636 },
+    { 59757, 9, 637 },
+    { 59843, 9, 638 },
+    { 59927, 9, 639 },
+    { 60233, 1, ROM_SPAN_ROW },
+    { 60718, 9, 496 },
+    { 60799, 9, 497 },
+    { 60880, 9, 498 },
+    { 60965, 9, 499 },
+    { 61050, 9, 500 },
+    { 61127, 9, 501 },
+    { 61204, 9, 502 },
+    { 61279, 9, 503 },
+    { 61359, 9, 504 },
+    { 61436, 9, 505 },
+    { 61520, 9, 506 },
+    { 61602, 9, 507 },
+    { 61683, 9, 508 },
+    { 61760, 9, 509 },
+    { 61846, 9, 510 },
+    { 61930, 9, 511 },
+    { 62202, 9, 768 },
+    { 62278, 9, 769 },
+    { 62354, 9, 770 },
+    { 62430, 9, 771 },
+    { 62506, 9, 772 },
+    { 62582, 9, 773 },
+    { 62658, 9, 774 },
+    { 62734, 9, 775 },
+    { 62810, 9, 776 },
+    { 62886, 9, 777 },
+    { 62963, 9, 778 },
+    { 63040, 9, 779 },
+    { 63117, 9, 780 },
+    { 63194, 9, 781 },
+    { 63271, 9, 782 },
+    { 63348, 9, 783 },
+    { 63588, 9, 640 },
+    { 63664, 9, 641 },
+    { 63740, 9, 642 },
+    { 63816, 9, 643 },
+    { 63892, 9, 644 },
+    { 63968, 9, 645 },
+    { 64044, 9, 646 },
+    { 64120, 9, 647 },
+    { 64196, 9, 648 },
+    { 64272, 9, 649 },
+    { 64349, 9, 650 },
+    { 64426, 9, 651 },
+    { 64503, 9, 652 },
+    { 64580, 9, 653 },
+    { 64657, 9, 654 },
+    { 64734, 9, 655 },
+    { 64967, 9, 800 },
+    { 65036, 9, 801 },
+    { 65106, 9, 802 },
+    { 65179, 9, 803 },
+    { 65254, 9, 804 },
+    { 65330, 9, 805 },
+    { 65403, 9, 806 },
+    { 65478, 9, 807 },
+    { 65555, 9, 808 },
+    { 65630, 9, 809 },
+    { 65707, 9, 810 },
+    { 65784, 9, 811 },
+    { 65856, 9, 812 },
+    { 65929, 9, 813 },
+    { 66005, 9, 814 },
+    { 66087, 9, 815 },
+    { 66344, 9, 784 },
+    { 66420, 9, 785 },
+    { 66496, 9, 786 },
+    { 66572, 9, 787 },
+    { 66648, 9, 788 },
+    { 66724, 9, 789 },
+    { 66803, 9, 790 },
+    { 66879, 9, 791 },
+    { 66955, 9, 792 },
+    { 67031, 9, 793 },
+    { 67108, 9, 794 },
+    { 67185, 9, 795 },
+    { 67262, 9, 796 },
+    { 67339, 9, 797 },
+    { 67416, 9, 798 },
+    { 67493, 9, 799 },
+    { 67743, 9, 672 },
+    { 67812, 9, 673 },
+    { 67882, 9, 674 },
+    { 67955, 9, 675 },
+    { 68030, 9, 676 },
+    { 68106, 9, 677 },
+    { 68179, 9, 678 },
+    { 68254, 9, 679 },
+    { 68331, 9, 680 },
+    { 68406, 9, 681 },
+    { 68483, 9, 682 },
+    { 68560, 9, 683 },
+    { 68632, 9, 684 },
+    { 68705, 9, 685 },
+    { 68781, 9, 686 },
+    { 68863, 9, 687 },
+    { 69120, 9, 656 },
+    { 69196, 9, 657 },
+    { 69272, 9, 658 },
+    { 69348, 9, 659 },
+    { 69424, 9, 660 },
+    { 69500, 9, 661 },
+    { 69579, 9, 662 },
+    { 69655, 9, 663 },
+    { 69731, 9, 664 },
+    { 69807, 9, 665 },
+    { 69884, 9, 666 },
+    { 69961, 9, 667 },
+    { 70038, 9, 668 },
+    { 70115, 9, 669 },
+    { 70192, 9, 670 },
+    { 70269, 9, 671 },
+    { 70560, 2, ROM_SPAN_ROW },
+    { 71046, 9, 816 },
+    { 71127, 9, 817 },
+    { 71208, 9, 818 },
+    { 71293, 9, 819 },
+    { 71378, 9, 820 },
+    { 71455, 9, 821 },
+    { 71532, 9, 822 },
+    { 71607, 9, 823 },
+    { 71687, 9, 824 },
+    { 71764, 9, 825 },
+    { 71848, 9, 826 },
+    { 71930, 9, 827 },
+    { 72011, 9, 828 },
+    { 72088, 9, 829 },
+    { 72174, 9, 830 },
+    { 72258, 9, 831 },
+    { 72564, 2, ROM_SPAN_ROW },
+    { 73050, 9, 688 },
+    { 73131, 9, 689 },
+    { 73212, 9, 690 },
+    { 73297, 9, 691 },
+    { 73382, 9, 692 },
+    { 73459, 9, 693 },
+    { 73536, 9, 694 },
+    { 73611, 9, 695 },
+    { 73691, 9, 696 },
+    { 73768, 9, 697 },
+    { 73852, 9, 698 },
+    { 73934, 9, 699 },
+    { 74015, 9, 700 },
+    { 74092, 9, 701 },
+    { 74178, 9, 702 },
+    { 74262, 9, 703 },
+    { 74534, 9, 832 },
+    { 74610, 9, 833 },
+    { 74686, 9, 834 },
+    { 74762, 9, 835 },
+    { 74838, 9, 836 },
+    { 74914, 9, 837 },
+    { 74990, 9, 838 },
+    { 75066, 9, 839 },
+    { 75142, 9, 840 },
+    { 75218, 9, 841 },
+    { 75295, 9, 842 },
+    { 75372, 9, 843 },
+    { 75449, 9, 844 },
+    { 75526, 9, 845 },
+    { 75603, 9, 846 },
+    { 75680, 9, 847 },
+    { 75920, 9, 704 },
+    { 75996, 9, 705 },
+    { 76072, 9, 706 },
+    { 76148, 9, 707 },
+    { 76224, 9, 708 },
+    { 76300, 9, 709 },
+    { 76376, 9, 710 },
+    { 76452, 9, 711 },
+    { 76528, 9, 712 },
+    { 76604, 9, 713 },
+    { 76681, 9, 714 },
+    { 76758, 9, 715 },
+    { 76835, 9, 716 },
+    { 76912, 9, 717 },
+    { 76989, 9, 718 },
+    { 77066, 9, 719 },
+    { 77299, 9, 864 },
+    { 77368, 9, 865 },
+    { 77438, 9, 866 },
+    { 77511, 9, 867 },
+    { 77586, 9, 868 },
+    { 77662, 9, 869 },
+    { 77735, 9, 870 },
+    { 77810, 9, 871 },
+    { 77887, 9, 872 },
+    { 77962, 9, 873 },
+    { 78039, 9, 874 },
+    { 78116, 9, 875 },
+    { 78188, 9, 876 },
+    { 78261, 9, 877 },
+    { 78337, 9, 878 },
+    { 78419, 9, 879 },
+    { 78676, 9, 848 },
+    { 78752, 9, 849 },
+    { 78828, 9, 850 },
+    { 78904, 9, 851 },
+    { 78980, 9, 852 },
+    { 79056, 9, 853 },
+    { 79135, 9, 854 },
+    { 79211, 9, 855 },
+    { 79287, 9, 856 },
+    { 79363, 9, 857 },
+    { 79440, 9, 858 },
+    { 79517, 9, 859 },
+    { 79594, 9, 860 },
+    { 79671, 9, 861 },
+    { 79748, 9, 862 },
+    { 79825, 9, 863 },
+    { 80075, 9, 736 },
+    { 80144, 9, 737 },
+    { 80214, 9, 738 },
+    { 80287, 9, 739 },
+    { 80362, 9, 740 },
+    { 80438, 9, 741 },
+    { 80511, 9, 742 },
+    { 80586, 9, 743 },
+    { 80663, 9, 744 },
+    { 80738, 9, 745 },
+    { 80815, 9, 746 },
+    { 80892, 9, 747 },
+    { 80964, 9, 748 },
+    { 81037, 9, 749 },
+    { 81113, 9, 750 },
+    { 81195, 9, 751 },
+    { 81452, 9, 720 },
+    { 81528, 9, 721 },
+    { 81604, 9, 722 },
+    { 81680, 9, 723 },
+    { 81756, 9, 724 },
+    { 81832, 9, 725 },
+    { 81911, 9, 726 },
+    { 81987, 9, 727 },
+    { 82063, 9, 728 },
+    { 82139, 9, 729 },
+    { 82216, 9, 730 },
+    { 82293, 9, 731 },
+    { 82370, 9, 732 },
+    { 82447, 9, 733 },
+    { 82524, 9, 734 },
+    { 82601, 9, 735 },
+    { 82892, 2, ROM_SPAN_ROW },
+    { 83378, 9, 880 },
+    { 83459, 9, 881 },
+    { 83540, 9, 882 },
+    { 83625, 9, 883 },
+    { 83710, 9, 884 },
+    { 83787, 9, 885 },
+    { 83864, 9, 886 },
+    { 83939, 9, 887 },
+    { 84019, 9, 888 },
+    { 84096, 9, 889 },
+    { 84180, 9, 890 },
+    { 84262, 9, 891 },
+    { 84343, 9, 892 },
+    { 84420, 9, 893 },
+    { 84506, 9, 894 },
+    { 84590, 9, 895 },
+    { 84896, 2, ROM_SPAN_ROW },
+    { 85382, 9, 752 },
+    { 85463, 9, 753 },
+    { 85544, 9, 754 },
+    { 85629, 9, 755 },
+    { 85714, 9, 756 },
+    { 85791, 9, 757 },
+    { 85868, 9, 758 },
+    { 85943, 9, 759 },
+    { 86023, 9, 760 },
+    { 86100, 9, 761 },
+    { 86184, 9, 762 },
+    { 86266, 9, 763 },
+    { 86347, 9, 764 },
+    { 86424, 9, 765 },
+    { 86510, 9, 766 },
+    { 86594, 9, 767 },
+    { 86866, 9, 1024 },
+    { 86942, 9, 1025 },
+    { 87018, 9, 1026 },
+    { 87094, 9, 1027 },
+    { 87170, 9, 1028 },
+    { 87246, 9, 1029 },
+    { 87322, 9, 1030 },
+    { 87398, 9, 1031 },
+    { 87474, 9, 1032 },
+    { 87550, 9, 1033 },
+    { 87627, 9, 1034 },
+    { 87704, 9, 1035 },
+    { 87781, 9, 1036 },
+    { 87858, 9, 1037 },
+    { 87935, 9, 1038 },
+    { 88012, 9, 1039 },
+    { 88252, 9, 896 },
+    { 88328, 9, 897 },
+    { 88404, 9, 898 },
+    { 88480, 9, 899 },
+    { 88556, 9, 900 },
+    { 88632, 9, 901 },
+    { 88708, 9, 902 },
+    { 88784, 9, 903 },
+    { 88860, 9, 904 },
+    { 88936, 9, 905 },
+    { 89013, 9, 906 },
+    { 89090, 9, 907 },
+    { 89167, 9, 908 },
+    { 89244, 9, 909 },
+    { 89321, 9, 910 },
+    { 89398, 9, 911 },
+    { 89631, 9, 1056 },
+    { 89700, 9, 1057 },
+    { 89770, 9, 1058 },
+    { 89843, 9, 1059 },
+    { 89918, 9, 1060 },
+    { 89994, 9, 1061 },
+    { 90067, 9, 1062 },
+    { 90142, 9, 1063 },
+    { 90219, 9, 1064 },
+    { 90294, 9, 1065 },
+    { 90371, 9, 1066 },
+    { 90448, 9, 1067 },
+    { 90520, 9, 1068 },
+    { 90593, 9, 1069 },
+    { 90669, 9, 1070 },
+    { 90751, 9, 1071 },
+    { 91008, 9, 1040 },
+    { 91084, 9, 1041 },
+    { 91160, 9, 1042 },
+    { 91236, 9, 1043 },
+    { 91312, 9, 1044 },
+    { 91388, 9, 1045 },
+    { 91467, 9, 1046 },
+    { 91543, 9, 1047 },
+    { 91619, 9, 1048 },
+    { 91695, 9, 1049 },
+    { 91772, 9, 1050 },
+    { 91849, 9, 1051 },
+    { 91926, 9, 1052 },
+    { 92003, 9, 1053 },
+    { 92080, 9, 1054 },
+    { 92157, 9, 1055 },
+    { 92407, 9, 928 },
+    { 92476, 9, 929 },
+    { 92546, 9, 930 },
+    { 92619, 9, 931 },
+    { 92694, 9, 932 },
+    { 92770, 9, 933 },
+    { 92843, 9, 934 },
+    { 92918, 9, 935 },
+    { 92995, 9, 936 },
+    { 93070, 9, 937 },
+    { 93147, 9, 938 },
+    { 93224, 9, 939 },
+    { 93296, 9, 940 },
+    { 93369, 9, 941 },
+    { 93445, 9, 942 },
+    { 93527, 9, 943 },
+    { 93784, 9, 912 },
+    { 93860, 9, 913 },
+    { 93936, 9, 914 },
+    { 94012, 9, 915 },
+    { 94088, 9, 916 },
+    { 94164, 9, 917 },
+    { 94243, 9, 918 },
+    { 94319, 9, 919 },
+    { 94395, 9, 920 },
+    { 94471, 9, 921 },
+    { 94548, 9, 922 },
+    { 94625, 9, 923 },
+    { 94702, 9, 924 },
+    { 94779, 9, 925 },
+    { 94856, 9, 926 },
+    { 94933, 9, 927 },
+    { 95224, 2, ROM_SPAN_ROW },
+    { 95710, 9, 1072 },
+    { 95791, 9, 1073 },
+    { 95872, 9, 1074 },
+    { 95957, 9, 1075 },
+    { 96042, 9, 1076 },
+    { 96119, 9, 1077 },
+    { 96196, 9, 1078 },
+    { 96271, 9, 1079 },
+    { 96351, 9, 1080 },
+    { 96428, 9, 1081 },
+    { 96512, 9, 1082 },
+    { 96594, 9, 1083 },
+    { 96675, 9, 1084 },
+    { 96752, 9, 1085 },
+    { 96838, 9, 1086 },
+    { 96922, 9, 1087 },
+    { 97228, 2, ROM_SPAN_ROW },
+    { 97714, 9, 944 },
+    { 97795, 9, 945 },
+    { 97876, 9, 946 },
+    { 97961, 9, 947 },
+    { 98046, 9, 948 },
+    { 98123, 9, 949 },
+    { 98200, 9, 950 },
+    { 98275, 9, 951 },
+    { 98355, 9, 952 },
+    { 98432, 9, 953 },
+    { 98516, 9, 954 },
+    { 98598, 9, 955 },
+    { 98679, 9, 956 },
+    { 98756, 9, 957 },
+    { 98842, 9, 958 },
+    { 98926, 9, 959 },
+    { 99198, 9, 1088 },
+    { 99274, 9, 1089 },
+    { 99350, 9, 1090 },
+    { 99426, 9, 1091 },
+    { 99502, 9, 1092 },
+    { 99578, 9, 1093 },
+    { 99654, 9, 1094 },
+    { 99730, 9, 1095 },
+    { 99806, 9, 1096 },
+    { 99882, 9, 1097 },
+    { 99959, 9, 1098 },
+    { 100036, 9, 1099 },
+    { 100113, 9, 1100 },
+    { 100190, 9, 1101 },
+    { 100267, 9, 1102 },
+    { 100344, 9, 1103 },
+    { 100584, 9, 960 },
+    { 100660, 9, 961 },
+    { 100736, 9, 962 },
+    { 100812, 9, 963 },
+    { 100888, 9, 964 },
+    { 100964, 9, 965 },
+    { 101040, 9, 966 },
+    { 101116, 9, 967 },
+    { 101192, 9, 968 },
+    { 101268, 9, 969 },
+    { 101345, 9, 970 },
+    { 101422, 9, 971 },
+    { 101499, 9, 972 },
+    { 101576, 9, 973 },
+    { 101653, 9, 974 },
+    { 101730, 9, 975 },
+    { 101963, 9, 1120 },
+    { 102032, 9, 1121 },
+    { 102102, 9, 1122 },
+    { 102175, 9, 1123 },
+    { 102250, 9, 1124 },
+    { 102326, 9, 1125 },
+    { 102399, 9, 1126 },
+    { 102474, 9, 1127 },
+    { 102551, 9, 1128 },
+    { 102626, 9, 1129 },
+    { 102703, 9, 1130 },
+    { 102780, 9, 1131 },
+    { 102852, 9, 1132 },
+    { 102925, 9, 1133 },
+    { 103001, 9, 1134 },
+    { 103083, 9, 1135 },
+    { 103340, 9, 1104 },
+    { 103416, 9, 1105 },
+    { 103492, 9, 1106 },
+    { 103568, 9, 1107 },
+    { 103644, 9, 1108 },
+    { 103720, 9, 1109 },
+    { 103799, 9, 1110 },
+    { 103875, 9, 1111 },
+    { 103951, 9, 1112 },
+    { 104027, 9, 1113 },
+    { 104104, 9, 1114 },
+    { 104181, 9, 1115 },
+    { 104258, 9, 1116 },
+    { 104335, 9, 1117 },
+    { 104412, 9, 1118 },
+    { 104489, 9, 1119 },
+    { 104739, 9, 992 },
+    { 104808, 9, 993 },
+    { 104878, 9, 994 },
+    { 104951, 9, 995 },
+    { 105026, 9, 996 },
+    { 105102, 9, 997 },
+    { 105175, 9, 998 },
+    { 105250, 9, 999 },
+    { 105327, 9, 1000 },
+    { 105402, 9, 1001 },
+    { 105479, 9, 1002 },
+    { 105556, 9, 1003 },
+    { 105628, 9, 1004 },
+    { 105701, 9, 1005 },
+    { 105777, 9, 1006 },
+    { 105859, 9, 1007 },
+    { 106116, 9, 976 },
+    { 106192, 9, 977 },
+    { 106268, 9, 978 },
+    { 106344, 9, 979 },
+    { 106420, 9, 980 },
+    { 106496, 9, 981 },
+    { 106575, 9, 982 },
+    { 106651, 9, 983 },
+    { 106727, 9, 984 },
+    { 106803, 9, 985 },
+    { 106880, 9, 986 },
+    { 106957, 9, 987 },
+    { 107034, 9, 988 },
+    { 107111, 9, 989 },
+    { 107188, 9, 990 },
+    { 107265, 9, 991 },
+    { 107556, 2, ROM_SPAN_ROW },
+    { 108044, 9, 1136 },
+    { 108125, 9, 1137 },
+    { 108206, 9, 1138 },
+    { 108291, 9, 1139 },
+    { 108376, 9, 1140 },
+    { 108453, 9, 1141 },
+    { 108530, 9, 1142 },
+    { 108605, 9, 1143 },
+    { 108685, 9, 1144 },
+    { 108762, 9, 1145 },
+    { 108846, 9, 1146 },
+    { 108928, 9, 1147 },
+    { 109009, 9, 1148 },
+    { 109086, 9, 1149 },
+    { 109172, 9, 1150 },
+    { 109256, 9, 1151 },
+    { 109562, 2, ROM_SPAN_ROW },
+    { 110048, 9, 1008 },
+    { 110129, 9, 1009 },
+    { 110210, 9, 1010 },
+    { 110295, 9, 1011 },
+    { 110380, 9, 1012 },
+    { 110457, 9, 1013 },
+    { 110534, 9, 1014 },
+    { 110609, 9, 1015 },
+    { 110689, 9, 1016 },
+    { 110766, 9, 1017 },
+    { 110850, 9, 1018 },
+    { 110932, 9, 1019 },
+    { 111013, 9, 1020 },
+    { 111090, 9, 1021 },
+    { 111176, 9, 1022 },
+    { 111260, 9, 1023 },
+    { 111532, 9, 1280 },
+    { 111608, 9, 1281 },
+    { 111684, 9, 1282 },
+    { 111760, 9, 1283 },
+    { 111836, 9, 1284 },
+    { 111912, 9, 1285 },
+    { 111988, 9, 1286 },
+    { 112064, 9, 1287 },
+    { 112140, 9, 1288 },
+    { 112216, 9, 1289 },
+    { 112293, 9, 1290 },
+    { 112370, 9, 1291 },
+    { 112447, 9, 1292 },
+    { 112524, 9, 1293 },
+    { 112601, 9, 1294 },
+    { 112678, 9, 1295 },
+    { 112918, 9, 1152 },
+    { 112994, 9, 1153 },
+    { 113070, 9, 1154 },
+    { 113146, 9, 1155 },
+    { 113222, 9, 1156 },
+    { 113298, 9, 1157 },
+    { 113374, 9, 1158 },
+    { 113450, 9, 1159 },
+    { 113526, 9, 1160 },
+    { 113602, 9, 1161 },
+    { 113679, 9, 1162 },
+    { 113756, 9, 1163 },
+    { 113833, 9, 1164 },
+    { 113910, 9, 1165 },
+    { 113987, 9, 1166 },
+    { 114064, 9, 1167 },
+    { 114297, 9, 1312 },
+    { 114366, 9, 1313 },
+    { 114436, 9, 1314 },
+    { 114509, 9, 1315 },
+    { 114584, 9, 1316 },
+    { 114660, 9, 1317 },
+    { 114733, 9, 1318 },
+    { 114808, 9, 1319 },
+    { 114885, 9, 1320 },
+    { 114960, 9, 1321 },
+    { 115037, 9, 1322 },
+    { 115114, 9, 1323 },
+    { 115186, 9, 1324 },
+    { 115259, 9, 1325 },
+    { 115335, 9, 1326 },
+    { 115417, 9, 1327 },
+    { 115674, 9, 1296 },
+    { 115750, 9, 1297 },
+    { 115826, 9, 1298 },
+    { 115902, 9, 1299 },
+    { 115978, 9, 1300 },
+    { 116054, 9, 1301 },
+    { 116133, 9, 1302 },
+    { 116209, 9, 1303 },
+    { 116285, 9, 1304 },
+    { 116361, 9, 1305 },
+    { 116438, 9, 1306 },
+    { 116515, 9, 1307 },
+    { 116592, 9, 1308 },
+    { 116669, 9, 1309 },
+    { 116746, 9, 1310 },
+    { 116823, 9, 1311 },
+    { 117073, 9, 1184 },
+    { 117142, 9, 1185 },
+    { 117212, 9, 1186 },
+    { 117285, 9, 1187 },
+    { 117360, 9, 1188 },
+    { 117436, 9, 1189 },
+    { 117509, 9, 1190 },
+    { 117584, 9, 1191 },
+    { 117661, 9, 1192 },
+    { 117736, 9, 1193 },
+    { 117813, 9, 1194 },
+    { 117890, 9, 1195 },
+    { 117962, 9, 1196 },
+    { 118035, 9, 1197 },
+    { 118111, 9, 1198 },
+    { 118193, 9, 1199 },
+    { 118451, 9, 1168 },
+    { 118527, 9, 1169 },
+    { 118603, 9, 1170 },
+    { 118679, 9, 1171 },
+    { 118755, 9, 1172 },
+    { 118831, 9, 1173 },
+    { 118910, 9, 1174 },
+    { 118986, 9, 1175 },
+    { 119062, 9, 1176 },
+    { 119138, 9, 1177 },
+    { 119215, 9, 1178 },
+    { 119292, 9, 1179 },
+    { 119369, 9, 1180 },
+    { 119446, 9, 1181 },
+    { 119523, 9, 1182 },
+    { 119600, 9, 1183 },
+    { 119891, 2, ROM_SPAN_ROW },
+    { 120379, 9, 1328 },
+    { 120460, 9, 1329 },
+    { 120541, 9, 1330 },
+    { 120626, 9, 1331 },
+    { 120711, 9, 1332 },
+    { 120788, 9, 1333 },
+    { 120865, 9, 1334 },
+    { 120940, 9, 1335 },
+    { 121020, 9, 1336 },
+    { 121097, 9, 1337 },
+    { 121181, 9, 1338 },
+    { 121263, 9, 1339 },
+    { 121344, 9, 1340 },
+    { 121421, 9, 1341 },
+    { 121507, 9, 1342 },
+    { 121591, 9, 1343 },
+    { 121897, 2, ROM_SPAN_ROW },
+    { 122385, 9, 1200 },
+    { 122466, 9, 1201 },
+    { 122547, 9, 1202 },
+    { 122632, 9, 1203 },
+    { 122717, 9, 1204 },
+    { 122794, 9, 1205 },
+    { 122871, 9, 1206 },
+    { 122946, 9, 1207 },
+    { 123026, 9, 1208 },
+    { 123103, 9, 1209 },
+    { 123187, 9, 1210 },
+    { 123269, 9, 1211 },
+    { 123350, 9, 1212 },
+    { 123427, 9, 1213 },
+    { 123513, 9, 1214 },
+    { 123597, 9, 1215 },
+    { 123870, 9, 1344 },
+    { 123946, 9, 1345 },
+    { 124022, 9, 1346 },
+    { 124098, 9, 1347 },
+    { 124174, 9, 1348 },
+    { 124250, 9, 1349 },
+    { 124326, 9, 1350 },
+    { 124402, 9, 1351 },
+    { 124478, 9, 1352 },
+    { 124554, 9, 1353 },
+    { 124631, 9, 1354 },
+    { 124708, 9, 1355 },
+    { 124785, 9, 1356 },
+    { 124862, 9, 1357 },
+    { 124939, 9, 1358 },
+    { 125016, 9, 1359 },
+    { 125258, 9, 1216 },
+    { 125334, 9, 1217 },
+    { 125410, 9, 1218 },
+    { 125486, 9, 1219 },
+    { 125562, 9, 1220 },
+    { 125638, 9, 1221 },
+    { 125714, 9, 1222 },
+    { 125790, 9, 1223 },
+    { 125866, 9, 1224 },
+    { 125942, 9, 1225 },
+    { 126019, 9, 1226 },
+    { 126096, 9, 1227 },
+    { 126173, 9, 1228 },
+    { 126250, 9, 1229 },
+    { 126327, 9, 1230 },
+    { 126404, 9, 1231 },
+    { 126639, 9, 1376 },
+    { 126708, 9, 1377 },
+    { 126778, 9, 1378 },
+    { 126851, 9, 1379 },
+    { 126926, 9, 1380 },
+    { 127002, 9, 1381 },
+    { 127075, 9, 1382 },
+    { 127150, 9, 1383 },
+    { 127227, 9, 1384 },
+    { 127302, 9, 1385 },
+    { 127379, 9, 1386 },
+    { 127456, 9, 1387 },
+    { 127528, 9, 1388 },
+    { 127601, 9, 1389 },
+    { 127677, 9, 1390 },
+    { 127759, 9, 1391 },
+    { 128019, 9, 1360 },
+    { 128095, 9, 1361 },
+    { 128171, 9, 1362 },
+    { 128247, 9, 1363 },
+    { 128323, 9, 1364 },
+    { 128399, 9, 1365 },
+    { 128478, 9, 1366 },
+    { 128554, 9, 1367 },
+    { 128630, 9, 1368 },
+    { 128706, 9, 1369 },
+    { 128783, 9, 1370 },
+    { 128860, 9, 1371 },
+    { 128937, 9, 1372 },
+    { 129014, 9, 1373 },
+    { 129091, 9, 1374 },
+    { 129168, 9, 1375 },
+    { 129421, 9, 1248 },
+    { 129490, 9, 1249 },
+    { 129560, 9, 1250 },
+    { 129633, 9, 1251 },
+    { 129708, 9, 1252 },
+    { 129784, 9, 1253 },
+    { 129857, 9, 1254 },
+    { 129932, 9, 1255 },
+    { 130009, 9, 1256 },
+    { 130084, 9, 1257 },
+    { 130161, 9, 1258 },
+    { 130238, 9, 1259 },
+    { 130310, 9, 1260 },
+    { 130383, 9, 1261 },
+    { 130459, 9, 1262 },
+    { 130541, 9, 1263 },
+    { 130801, 9, 1232 },
+    { 130877, 9, 1233 },
+    { 130953, 9, 1234 },
+    { 131029, 9, 1235 },
+    { 131105, 9, 1236 },
+    { 131181, 9, 1237 },
+    { 131260, 9, 1238 },
+    { 131336, 9, 1239 },
+    { 131412, 9, 1240 },
+    { 131488, 9, 1241 },
+    { 131565, 9, 1242 },
+    { 131642, 9, 1243 },
+    { 131719, 9, 1244 },
+    { 131796, 9, 1245 },
+    { 131873, 9, 1246 },
+    { 131950, 9, 1247 },
+    { 132244, 2, ROM_SPAN_ROW },
+    { 132736, 9, 1392 },
+    { 132817, 9, 1393 },
+    { 132898, 9, 1394 },
+    { 132983, 9, 1395 },
+    { 133068, 9, 1396 },
+    { 133145, 9, 1397 },
+    { 133222, 9, 1398 },
+    { 133297, 9, 1399 },
+    { 133377, 9, 1400 },
+    { 133454, 9, 1401 },
+    { 133538, 9, 1402 },
+    { 133620, 9, 1403 },
+    { 133701, 9, 1404 },
+    { 133778, 9, 1405 },
+    { 133864, 9, 1406 },
+    { 133948, 9, 1407 },
+    { 134257, 2, ROM_SPAN_ROW },
+    { 134747, 9, 1264 },
+    { 134828, 9, 1265 },
+    { 134909, 9, 1266 },
+    { 134994, 9, 1267 },
+    { 135079, 9, 1268 },
+    { 135156, 9, 1269 },
+    { 135233, 9, 1270 },
+    { 135308, 9, 1271 },
+    { 135388, 9, 1272 },
+    { 135465, 9, 1273 },
+    { 135549, 9, 1274 },
+    { 135631, 9, 1275 },
+    { 135712, 9, 1276 },
+    { 135789, 9, 1277 },
+    { 135875, 9, 1278 },
+    { 135959, 9, 1279 },
+    { 136234, 9, 1536 },
+    { 136310, 9, 1537 },
+    { 136386, 9, 1538 },
+    { 136462, 9, 1539 },
+    { 136538, 9, 1540 },
+    { 136614, 9, 1541 },
+    { 136690, 9, 1542 },
+    { 136766, 9, 1543 },
+    { 136842, 9, 1544 },
+    { 136918, 9, 1545 },
+    { 136995, 9, 1546 },
+    { 137072, 9, 1547 },
+    { 137149, 9, 1548 },
+    { 137226, 9, 1549 },
+    { 137303, 9, 1550 },
+    { 137380, 9, 1551 },
+    { 137622, 9, 1408 },
+    { 137698, 9, 1409 },
+    { 137774, 9, 1410 },
+    { 137850, 9, 1411 },
+    { 137926, 9, 1412 },
+    { 138002, 9, 1413 },
+    { 138078, 9, 1414 },
+    { 138154, 9, 1415 },
+    { 138230, 9, 1416 },
+    { 138306, 9, 1417 },
+    { 138383, 9, 1418 },
+    { 138460, 9, 1419 },
+    { 138537, 9, 1420 },
+    { 138614, 9, 1421 },
+    { 138691, 9, 1422 },
+    { 138768, 9, 1423 },
+    { 139003, 9, 1568 },
+    { 139072, 9, 1569 },
+    { 139142, 9, 1570 },
+    { 139215, 9, 1571 },
+    { 139290, 9, 1572 },
+    { 139366, 9, 1573 },
+    { 139439, 9, 1574 },
+    { 139514, 9, 1575 },
+    { 139591, 9, 1576 },
+    { 139666, 9, 1577 },
+    { 139743, 9, 1578 },
+    { 139820, 9, 1579 },
+    { 139892, 9, 1580 },
+    { 139965, 9, 1581 },
+    { 140041, 9, 1582 },
+    { 140123, 9, 1583 },
+    { 140383, 9, 1552 },
+    { 140459, 9, 1553 },
+    { 140535, 9, 1554 },
+    { 140611, 9, 1555 },
+    { 140687, 9, 1556 },
+    { 140763, 9, 1557 },
+    { 140842, 9, 1558 },
+    { 140918, 9, 1559 },
+    { 140994, 9, 1560 },
+    { 141070, 9, 1561 },
+    { 141147, 9, 1562 },
+    { 141224, 9, 1563 },
+    { 141301, 9, 1564 },
+    { 141378, 9, 1565 },
+    { 141455, 9, 1566 },
+    { 141532, 9, 1567 },
+    { 141785, 9, 1440 },
+    { 141854, 9, 1441 },
+    { 141924, 9, 1442 },
+    { 141997, 9, 1443 },
+    { 142072, 9, 1444 },
+    { 142148, 9, 1445 },
+    { 142221, 9, 1446 },
+    { 142296, 9, 1447 },
+    { 142373, 9, 1448 },
+    { 142448, 9, 1449 },
+    { 142525, 9, 1450 },
+    { 142602, 9, 1451 },
+    { 142674, 9, 1452 },
+    { 142747, 9, 1453 },
+    { 142823, 9, 1454 },
+    { 142905, 9, 1455 },
+    { 143165, 9, 1424 },
+    { 143241, 9, 1425 },
+    { 143317, 9, 1426 },
+    { 143393, 9, 1427 },
+    { 143469, 9, 1428 },
+    { 143545, 9, 1429 },
+    { 143624, 9, 1430 },
+    { 143700, 9, 1431 },
+    { 143776, 9, 1432 },
+    { 143852, 9, 1433 },
+    { 143929, 9, 1434 },
+    { 144006, 9, 1435 },
+    { 144083, 9, 1436 },
+    { 144160, 9, 1437 },
+    { 144237, 9, 1438 },
+    { 144314, 9, 1439 },
+    { 144608, 2, ROM_SPAN_ROW },
+    { 145100, 9, 1584 },
+    { 145181, 9, 1585 },
+    { 145262, 9, 1586 },
+    { 145347, 9, 1587 },
+    { 145432, 9, 1588 },
+    { 145509, 9, 1589 },
+    { 145586, 9, 1590 },
+    { 145661, 9, 1591 },
+    { 145741, 9, 1592 },
+    { 145818, 9, 1593 },
+    { 145902, 9, 1594 },
+    { 145984, 9, 1595 },
+    { 146065, 9, 1596 },
+    { 146142, 9, 1597 },
+    { 146228, 9, 1598 },
+    { 146312, 9, 1599 },
+    { 146621, 2, ROM_SPAN_ROW },
+    { 147111, 9, 1456 },
+    { 147192, 9, 1457 },
+    { 147273, 9, 1458 },
+    { 147358, 9, 1459 },
+    { 147443, 9, 1460 },
+    { 147520, 9, 1461 },
+    { 147597, 9, 1462 },
+    { 147672, 9, 1463 },
+    { 147752, 9, 1464 },
+    { 147829, 9, 1465 },
+    { 147913, 9, 1466 },
+    { 147995, 9, 1467 },
+    { 148076, 9, 1468 },
+    { 148153, 9, 1469 },
+    { 148239, 9, 1470 },
+    { 148323, 9, 1471 },
+    { 148598, 9, 1600 },
+    { 148674, 9, 1601 },
+    { 148750, 9, 1602 },
+    { 148826, 9, 1603 },
+    { 148902, 9, 1604 },
+    { 148978, 9, 1605 },
+    { 149054, 9, 1606 },
+    { 149130, 9, 1607 },
+    { 149206, 9, 1608 },
+    { 149282, 9, 1609 },
+    { 149359, 9, 1610 },
+    { 149436, 9, 1611 },
+    { 149513, 9, 1612 },
+    { 149590, 9, 1613 },
+    { 149667, 9, 1614 },
+    { 149744, 9, 1615 },
+    { 149986, 9, 1472 },
+    { 150062, 9, 1473 },
+    { 150138, 9, 1474 },
+    { 150214, 9, 1475 },
+    { 150290, 9, 1476 },
+    { 150366, 9, 1477 },
+    { 150442, 9, 1478 },
+    { 150518, 9, 1479 },
+    { 150594, 9, 1480 },
+    { 150670, 9, 1481 },
+    { 150747, 9, 1482 },
+    { 150824, 9, 1483 },
+    { 150901, 9, 1484 },
+    { 150978, 9, 1485 },
+    { 151055, 9, 1486 },
+    { 151132, 9, 1487 },
+    { 151367, 9, 1632 },
+    { 151436, 9, 1633 },
+    { 151506, 9, 1634 },
+    { 151579, 9, 1635 },
+    { 151654, 9, 1636 },
+    { 151730, 9, 1637 },
+    { 151803, 9, 1638 },
+    { 151878, 9, 1639 },
+    { 151955, 9, 1640 },
+    { 152030, 9, 1641 },
+    { 152107, 9, 1642 },
+    { 152184, 9, 1643 },
+    { 152256, 9, 1644 },
+    { 152329, 9, 1645 },
+    { 152405, 9, 1646 },
+    { 152487, 9, 1647 },
+    { 152747, 9, 1616 },
+    { 152823, 9, 1617 },
+    { 152899, 9, 1618 },
+    { 152975, 9, 1619 },
+    { 153051, 9, 1620 },
+    { 153127, 9, 1621 },
+    { 153206, 9, 1622 },
+    { 153282, 9, 1623 },
+    { 153358, 9, 1624 },
+    { 153434, 9, 1625 },
+    { 153511, 9, 1626 },
+    { 153588, 9, 1627 },
+    { 153665, 9, 1628 },
+    { 153742, 9, 1629 },
+    { 153819, 9, 1630 },
+    { 153896, 9, 1631 },
+    { 154149, 9, 1504 },
+    { 154218, 9, 1505 },
+    { 154288, 9, 1506 },
+    { 154361, 9, 1507 },
+    { 154436, 9, 1508 },
+    { 154512, 9, 1509 },
+    { 154585, 9, 1510 },
+    { 154660, 9, 1511 },
+    { 154737, 9, 1512 },
+    { 154812, 9, 1513 },
+    { 154889, 9, 1514 },
+    { 154966, 9, 1515 },
+    { 155038, 9, 1516 },
+    { 155111, 9, 1517 },
+    { 155187, 9, 1518 },
+    { 155269, 9, 1519 },
+    { 155529, 9, 1488 },
+    { 155605, 9, 1489 },
+    { 155681, 9, 1490 },
+    { 155757, 9, 1491 },
+    { 155833, 9, 1492 },
+    { 155909, 9, 1493 },
+    { 155988, 9, 1494 },
+    { 156064, 9, 1495 },
+    { 156140, 9, 1496 },
+    { 156216, 9, 1497 },
+    { 156293, 9, 1498 },
+    { 156370, 9, 1499 },
+    { 156447, 9, 1500 },
+    { 156524, 9, 1501 },
+    { 156601, 9, 1502 },
+    { 156678, 9, 1503 },
+    { 156972, 2, ROM_SPAN_ROW },
+    { 157464, 9, 1648 },
+    { 157545, 9, 1649 },
+    { 157626, 9, 1650 },
+    { 157711, 9, 1651 },
+    { 157796, 9, 1652 },
+    { 157873, 9, 1653 },
+    { 157950, 9, 1654 },
+    { 158025, 9, 1655 },
+    { 158105, 9, 1656 },
+    { 158182, 9, 1657 },
+    { 158266, 9, 1658 },
+    { 158348, 9, 1659 },
+    { 158429, 9, 1660 },
+    { 158506, 9, 1661 },
+    { 158592, 9, 1662 },
+    { 158676, 9, 1663 },
+    { 158985, 2, ROM_SPAN_ROW },
+    { 159477, 9, 1520 },
+    { 159558, 9, 1521 },
+    { 159639, 9, 1522 },
+    { 159724, 9, 1523 },
+    { 159809, 9, 1524 },
+    { 159886, 9, 1525 },
+    { 159963, 9, 1526 },
+    { 160038, 9, 1527 },
+    { 160118, 9, 1528 },
+    { 160195, 9, 1529 },
+    { 160279, 9, 1530 },
+    { 160361, 9, 1531 },
+    { 160442, 9, 1532 },
+    { 160519, 9, 1533 },
+    { 160605, 9, 1534 },
+    { 160689, 9, 1535 },
+    { 160964, 9, 1792 },
+    { 161040, 9, 1793 },
+    { 161116, 9, 1794 },
+    { 161192, 9, 1795 },
+    { 161268, 9, 1796 },
+    { 161344, 9, 1797 },
+    { 161420, 9, 1798 },
+    { 161496, 9, 1799 },
+    { 161572, 9, 1800 },
+    { 161648, 9, 1801 },
+    { 161725, 9, 1802 },
+    { 161802, 9, 1803 },
+    { 161879, 9, 1804 },
+    { 161956, 9, 1805 },
+    { 162033, 9, 1806 },
+    { 162110, 9, 1807 },
+    { 162352, 9, 1664 },
+    { 162428, 9, 1665 },
+    { 162504, 9, 1666 },
+    { 162580, 9, 1667 },
+    { 162656, 9, 1668 },
+    { 162732, 9, 1669 },
+    { 162808, 9, 1670 },
+    { 162884, 9, 1671 },
+    { 162960, 9, 1672 },
+    { 163036, 9, 1673 },
+    { 163113, 9, 1674 },
+    { 163190, 9, 1675 },
+    { 163267, 9, 1676 },
+    { 163344, 9, 1677 },
+    { 163421, 9, 1678 },
+    { 163498, 9, 1679 },
+    { 163733, 9, 1824 },
+    { 163802, 9, 1825 },
+    { 163872, 9, 1826 },
+    { 163945, 9, 1827 },
+    { 164020, 9, 1828 },
+    { 164096, 9, 1829 },
+    { 164169, 9, 1830 },
+    { 164244, 9, 1831 },
+    { 164321, 9, 1832 },
+    { 164396, 9, 1833 },
+    { 164473, 9, 1834 },
+    { 164550, 9, 1835 },
+    { 164622, 9, 1836 },
+    { 164695, 9, 1837 },
+    { 164771, 9, 1838 },
+    { 164853, 9, 1839 },
+    { 165113, 9, 1808 },
+    { 165189, 9, 1809 },
+    { 165265, 9, 1810 },
+    { 165341, 9, 1811 },
+    { 165417, 9, 1812 },
+    { 165493, 9, 1813 },
+    { 165572, 9, 1814 },
+    { 165648, 9, 1815 },
+    { 165724, 9, 1816 },
+    { 165800, 9, 1817 },
+    { 165877, 9, 1818 },
+    { 165954, 9, 1819 },
+    { 166031, 9, 1820 },
+    { 166108, 9, 1821 },
+    { 166185, 9, 1822 },
+    { 166262, 9, 1823 },
+    { 166515, 9, 1696 },
+    { 166584, 9, 1697 },
+    { 166654, 9, 1698 },
+    { 166727, 9, 1699 },
+    { 166802, 9, 1700 },
+    { 166878, 9, 1701 },
+    { 166951, 9, 1702 },
+    { 167026, 9, 1703 },
+    { 167103, 9, 1704 },
+    { 167178, 9, 1705 },
+    { 167255, 9, 1706 },
+    { 167332, 9, 1707 },
+    { 167404, 9, 1708 },
+    { 167477, 9, 1709 },
+    { 167553, 9, 1710 },
+    { 167635, 9, 1711 },
+    { 167895, 9, 1680 },
+    { 167971, 9, 1681 },
+    { 168047, 9, 1682 },
+    { 168123, 9, 1683 },
+    { 168199, 9, 1684 },
+    { 168275, 9, 1685 },
+    { 168354, 9, 1686 },
+    { 168430, 9, 1687 },
+    { 168506, 9, 1688 },
+    { 168582, 9, 1689 },
+    { 168659, 9, 1690 },
+    { 168736, 9, 1691 },
+    { 168813, 9, 1692 },
+    { 168890, 9, 1693 },
+    { 168967, 9, 1694 },
+    { 169044, 9, 1695 },
+    { 169338, 2, ROM_SPAN_ROW },
+    { 169830, 9, 1840 },
+    { 169911, 9, 1841 },
+    { 169992, 9, 1842 },
+    { 170077, 9, 1843 },
+    { 170162, 9, 1844 },
+    { 170239, 9, 1845 },
+    { 170316, 9, 1846 },
+    { 170391, 9, 1847 },
+    { 170471, 9, 1848 },
+    { 170548, 9, 1849 },
+    { 170632, 9, 1850 },
+    { 170714, 9, 1851 },
+    { 170795, 9, 1852 },
+    { 170872, 9, 1853 },
+    { 170958, 9, 1854 },
+    { 171042, 9, 1855 },
+    { 171351, 2, ROM_SPAN_ROW },
+    { 171843, 9, 1712 },
+    { 171924, 9, 1713 },
+    { 172005, 9, 1714 },
+    { 172090, 9, 1715 },
+    { 172175, 9, 1716 },
+    { 172252, 9, 1717 },
+    { 172329, 9, 1718 },
+    { 172404, 9, 1719 },
+    { 172484, 9, 1720 },
+    { 172561, 9, 1721 },
+    { 172645, 9, 1722 },
+    { 172727, 9, 1723 },
+    { 172808, 9, 1724 },
+    { 172885, 9, 1725 },
+    { 172971, 9, 1726 },
+    { 173055, 9, 1727 },
+    { 173330, 9, 1856 },
+    { 173406, 9, 1857 },
+    { 173482, 9, 1858 },
+    { 173558, 9, 1859 },
+    { 173634, 9, 1860 },
+    { 173710, 9, 1861 },
+    { 173786, 9, 1862 },
+    { 173862, 9, 1863 },
+    { 173938, 9, 1864 },
+    { 174014, 9, 1865 },
+    { 174091, 9, 1866 },
+    { 174168, 9, 1867 },
+    { 174245, 9, 1868 },
+    { 174322, 9, 1869 },
+    { 174399, 9, 1870 },
+    { 174476, 9, 1871 },
+    { 174718, 9, 1728 },
+    { 174794, 9, 1729 },
+    { 174870, 9, 1730 },
+    { 174946, 9, 1731 },
+    { 175022, 9, 1732 },
+    { 175098, 9, 1733 },
+    { 175174, 9, 1734 },
+    { 175250, 9, 1735 },
+    { 175326, 9, 1736 },
+    { 175402, 9, 1737 },
+    { 175479, 9, 1738 },
+    { 175556, 9, 1739 },
+    { 175633, 9, 1740 },
+    { 175710, 9, 1741 },
+    { 175787, 9, 1742 },
+    { 175864, 9, 1743 },
+    { 176099, 9, 1888 },
+    { 176168, 9, 1889 },
+    { 176238, 9, 1890 },
+    { 176311, 9, 1891 },
+    { 176386, 9, 1892 },
+    { 176462, 9, 1893 },
+    { 176535, 9, 1894 },
+    { 176610, 9, 1895 },
+    { 176687, 9, 1896 },
+    { 176762, 9, 1897 },
+    { 176839, 9, 1898 },
+    { 176916, 9, 1899 },
+    { 176988, 9, 1900 },
+    { 177061, 9, 1901 },
+    { 177137, 9, 1902 },
+    { 177219, 9, 1903 },
+    { 177479, 9, 1872 },
+    { 177555, 9, 1873 },
+    { 177631, 9, 1874 },
+    { 177707, 9, 1875 },
+    { 177783, 9, 1876 },
+    { 177859, 9, 1877 },
+    { 177938, 9, 1878 },
+    { 178014, 9, 1879 },
+    { 178090, 9, 1880 },
+    { 178166, 9, 1881 },
+    { 178243, 9, 1882 },
+    { 178320, 9, 1883 },
+    { 178397, 9, 1884 },
+    { 178474, 9, 1885 },
+    { 178551, 9, 1886 },
+    { 178628, 9, 1887 },
+    { 178881, 9, 1760 },
+    { 178950, 9, 1761 },
+    { 179020, 9, 1762 },
+    { 179093, 9, 1763 },
+    { 179168, 9, 1764 },
+    { 179244, 9, 1765 },
+    { 179317, 9, 1766 },
+    { 179392, 9, 1767 },
+    { 179469, 9, 1768 },
+    { 179544, 9, 1769 },
+    { 179621, 9, 1770 },
+    { 179698, 9, 1771 },
+    { 179770, 9, 1772 },
+    { 179843, 9, 1773 },
+    { 179919, 9, 1774 },
+    { 180001, 9, 1775 },
+    { 180261, 9, 1744 },
+    { 180337, 9, 1745 },
+    { 180413, 9, 1746 },
+    { 180489, 9, 1747 },
+    { 180565, 9, 1748 },
+    { 180641, 9, 1749 },
+    { 180720, 9, 1750 },
+    { 180796, 9, 1751 },
+    { 180872, 9, 1752 },
+    { 180948, 9, 1753 },
+    { 181025, 9, 1754 },
+    { 181102, 9, 1755 },
+    { 181179, 9, 1756 },
+    { 181256, 9, 1757 },
+    { 181333, 9, 1758 },
+    { 181410, 9, 1759 },
+    { 181704, 2, ROM_SPAN_ROW },
+    { 182196, 9, 1904 },
+    { 182277, 9, 1905 },
+    { 182358, 9, 1906 },
+    { 182443, 9, 1907 },
+    { 182528, 9, 1908 },
+    { 182605, 9, 1909 },
+    { 182682, 9, 1910 },
+    { 182757, 9, 1911 },
+    { 182837, 9, 1912 },
+    { 182914, 9, 1913 },
+    { 182998, 9, 1914 },
+    { 183080, 9, 1915 },
+    { 183161, 9, 1916 },
+    { 183238, 9, 1917 },
+    { 183324, 9, 1918 },
+    { 183408, 9, 1919 },
+    { 183717, 2, ROM_SPAN_ROW },
+    { 184209, 9, 1776 },
+    { 184290, 9, 1777 },
+    { 184371, 9, 1778 },
+    { 184456, 9, 1779 },
+    { 184541, 9, 1780 },
+    { 184618, 9, 1781 },
+    { 184695, 9, 1782 },
+    { 184770, 9, 1783 },
+    { 184850, 9, 1784 },
+    { 184927, 9, 1785 },
+    { 185011, 9, 1786 },
+    { 185093, 9, 1787 },
+    { 185174, 9, 1788 },
+    { 185251, 9, 1789 },
+    { 185337, 9, 1790 },
+    { 185421, 9, 1791 },
+    { 185696, 9, 2048 },
+    { 185772, 9, 2049 },
+    { 185848, 9, 2050 },
+    { 185924, 9, 2051 },
+    { 186000, 9, 2052 },
+    { 186076, 9, 2053 },
+    { 186152, 9, 2054 },
+    { 186228, 9, 2055 },
+    { 186304, 9, 2056 },
+    { 186380, 9, 2057 },
+    { 186457, 9, 2058 },
+    { 186534, 9, 2059 },
+    { 186611, 9, 2060 },
+    { 186688, 9, 2061 },
+    { 186765, 9, 2062 },
+    { 186842, 9, 2063 },
+    { 187084, 9, 1920 },
+    { 187160, 9, 1921 },
+    { 187236, 9, 1922 },
+    { 187312, 9, 1923 },
+    { 187388, 9, 1924 },
+    { 187464, 9, 1925 },
+    { 187540, 9, 1926 },
+    { 187616, 9, 1927 },
+    { 187692, 9, 1928 },
+    { 187768, 9, 1929 },
+    { 187845, 9, 1930 },
+    { 187922, 9, 1931 },
+    { 187999, 9, 1932 },
+    { 188076, 9, 1933 },
+    { 188153, 9, 1934 },
+    { 188230, 9, 1935 },
+    { 188465, 9, 2080 },
+    { 188534, 9, 2081 },
+    { 188604, 9, 2082 },
+    { 188677, 9, 2083 },
+    { 188752, 9, 2084 },
+    { 188828, 9, 2085 },
+    { 188901, 9, 2086 },
+    { 188976, 9, 2087 },
+    { 189053, 9, 2088 },
+    { 189128, 9, 2089 },
+    { 189205, 9, 2090 },
+    { 189282, 9, 2091 },
+    { 189354, 9, 2092 },
+    { 189427, 9, 2093 },
+    { 189503, 9, 2094 },
+    { 189585, 9, 2095 },
+    { 189845, 9, 2064 },
+    { 189921, 9, 2065 },
+    { 189997, 9, 2066 },
+    { 190073, 9, 2067 },
+    { 190149, 9, 2068 },
+    { 190225, 9, 2069 },
+    { 190304, 9, 2070 },
+    { 190380, 9, 2071 },
+    { 190456, 9, 2072 },
+    { 190532, 9, 2073 },
+    { 190609, 9, 2074 },
+    { 190686, 9, 2075 },
+    { 190763, 9, 2076 },
+    { 190840, 9, 2077 },
+    { 190917, 9, 2078 },
+    { 190994, 9, 2079 },
+    { 191247, 9, 1952 },
+    { 191316, 9, 1953 },
+    { 191386, 9, 1954 },
+    { 191459, 9, 1955 },
+    { 191534, 9, 1956 },
+    { 191610, 9, 1957 },
+    { 191683, 9, 1958 },
+    { 191758, 9, 1959 },
+    { 191835, 9, 1960 },
+    { 191910, 9, 1961 },
+    { 191987, 9, 1962 },
+    { 192064, 9, 1963 },
+    { 192136, 9, 1964 },
+    { 192209, 9, 1965 },
+    { 192285, 9, 1966 },
+    { 192367, 9, 1967 },
+    { 192627, 9, 1936 },
+    { 192703, 9, 1937 },
+    { 192779, 9, 1938 },
+    { 192855, 9, 1939 },
+    { 192931, 9, 1940 },
+    { 193007, 9, 1941 },
+    { 193086, 9, 1942 },
+    { 193162, 9, 1943 },
+    { 193238, 9, 1944 },
+    { 193314, 9, 1945 },
+    { 193391, 9, 1946 },
+    { 193468, 9, 1947 },
+    { 193545, 9, 1948 },
+    { 193622, 9, 1949 },
+    { 193699, 9, 1950 },
+    { 193776, 9, 1951 },
+    { 194070, 2, ROM_SPAN_ROW },
+    { 194562, 9, 2096 },
+    { 194643, 9, 2097 },
+    { 194724, 9, 2098 },
+    { 194809, 9, 2099 },
+    { 194894, 9, 2100 },
+    { 194971, 9, 2101 },
+    { 195048, 9, 2102 },
+    { 195123, 9, 2103 },
+    { 195203, 9, 2104 },
+    { 195280, 9, 2105 },
+    { 195364, 9, 2106 },
+    { 195446, 9, 2107 },
+    { 195527, 9, 2108 },
+    { 195604, 9, 2109 },
+    { 195690, 9, 2110 },
+    { 195774, 9, 2111 },
+    { 196083, 2, ROM_SPAN_ROW },
+    { 196575, 9, 1968 },
+    { 196656, 9, 1969 },
+    { 196737, 9, 1970 },
+    { 196822, 9, 1971 },
+    { 196907, 9, 1972 },
+    { 196984, 9, 1973 },
+    { 197061, 9, 1974 },
+    { 197136, 9, 1975 },
+    { 197216, 9, 1976 },
+    { 197293, 9, 1977 },
+    { 197377, 9, 1978 },
+    { 197459, 9, 1979 },
+    { 197540, 9, 1980 },
+    { 197617, 9, 1981 },
+    { 197703, 9, 1982 },
+    { 197787, 9, 1983 },
+    { 198062, 9, 2112 },
+    { 198138, 9, 2113 },
+    { 198214, 9, 2114 },
+    { 198290, 9, 2115 },
+    { 198366, 9, 2116 },
+    { 198442, 9, 2117 },
+    { 198518, 9, 2118 },
+    { 198594, 9, 2119 },
+    { 198670, 9, 2120 },
+    { 198746, 9, 2121 },
+    { 198823, 9, 2122 },
+    { 198900, 9, 2123 },
+    { 198977, 9, 2124 },
+    { 199054, 9, 2125 },
+    { 199131, 9, 2126 },
+    { 199208, 9, 2127 },
+    { 199450, 9, 1984 },
+    { 199526, 9, 1985 },
+    { 199602, 9, 1986 },
+    { 199678, 9, 1987 },
+    { 199754, 9, 1988 },
+    { 199830, 9, 1989 },
+    { 199906, 9, 1990 },
+    { 199982, 9, 1991 },
+    { 200058, 9, 1992 },
+    { 200134, 9, 1993 },
+    { 200211, 9, 1994 },
+    { 200288, 9, 1995 },
+    { 200365, 9, 1996 },
+    { 200442, 9, 1997 },
+    { 200519, 9, 1998 },
+    { 200596, 9, 1999 },
+    { 200831, 9, 2144 },
+    { 200900, 9, 2145 },
+    { 200970, 9, 2146 },
+    { 201043, 9, 2147 },
+    { 201118, 9, 2148 },
+    { 201194, 9, 2149 },
+    { 201267, 9, 2150 },
+    { 201342, 9, 2151 },
+    { 201419, 9, 2152 },
+    { 201494, 9, 2153 },
+    { 201571, 9, 2154 },
+    { 201648, 9, 2155 },
+    { 201720, 9, 2156 },
+    { 201793, 9, 2157 },
+    { 201869, 9, 2158 },
+    { 201951, 9, 2159 },
+    { 202211, 9, 2128 },
+    { 202287, 9, 2129 },
+    { 202363, 9, 2130 },
+    { 202439, 9, 2131 },
+    { 202515, 9, 2132 },
+    { 202591, 9, 2133 },
+    { 202670, 9, 2134 },
+    { 202746, 9, 2135 },
+    { 202822, 9, 2136 },
+    { 202898, 9, 2137 },
+    { 202975, 9, 2138 },
+    { 203052, 9, 2139 },
+    { 203129, 9, 2140 },
+    { 203206, 9, 2141 },
+    { 203283, 9, 2142 },
+    { 203360, 9, 2143 },
+    { 203613, 9, 2016 },
+    { 203682, 9, 2017 },
+    { 203752, 9, 2018 },
+    { 203825, 9, 2019 },
+    { 203900, 9, 2020 },
+    { 203976, 9, 2021 },
+    { 204049, 9, 2022 },
+    { 204124, 9, 2023 },
+    { 204201, 9, 2024 },
+    { 204276, 9, 2025 },
+    { 204353, 9, 2026 },
+    { 204430, 9, 2027 },
+    { 204502, 9, 2028 },
+    { 204575, 9, 2029 },
+    { 204651, 9, 2030 },
+    { 204733, 9, 2031 },
+    { 204993, 9, 2000 },
+    { 205069, 9, 2001 },
+    { 205145, 9, 2002 },
+    { 205221, 9, 2003 },
+    { 205297, 9, 2004 },
+    { 205373, 9, 2005 },
+    { 205452, 9, 2006 },
+    { 205528, 9, 2007 },
+    { 205604, 9, 2008 },
+    { 205680, 9, 2009 },
+    { 205757, 9, 2010 },
+    { 205834, 9, 2011 },
+    { 205911, 9, 2012 },
+    { 205988, 9, 2013 },
+    { 206065, 9, 2014 },
+    { 206142, 9, 2015 },
+    { 206436, 2, ROM_SPAN_ROW },
+    { 206928, 9, 2160 },
+    { 207009, 9, 2161 },
+    { 207090, 9, 2162 },
+    { 207175, 9, 2163 },
+    { 207260, 9, 2164 },
+    { 207337, 9, 2165 },
+    { 207414, 9, 2166 },
+    { 207489, 9, 2167 },
+    { 207569, 9, 2168 },
+    { 207646, 9, 2169 },
+    { 207730, 9, 2170 },
+    { 207812, 9, 2171 },
+    { 207893, 9, 2172 },
+    { 207970, 9, 2173 },
+    { 208056, 9, 2174 },
+    { 208140, 9, 2175 },
+    { 208449, 2, ROM_SPAN_ROW },
+    { 208941, 9, 2032 },
+    { 209022, 9, 2033 },
+    { 209103, 9, 2034 },
+    { 209188, 9, 2035 },
+    { 209273, 9, 2036 },
+    { 209350, 9, 2037 },
+    { 209427, 9, 2038 },
+    { 209502, 9, 2039 },
+    { 209582, 9, 2040 },
+    { 209659, 9, 2041 },
+    { 209743, 9, 2042 },
+    { 209825, 9, 2043 },
+    { 209906, 9, 2044 },
+    { 209983, 9, 2045 },
+    { 210069, 9, 2046 },
+    { 210153, 9, 2047 },
+    { 210428, 9, 2304 },
+    { 210504, 9, 2305 },
+    { 210580, 9, 2306 },
+    { 210656, 9, 2307 },
+    { 210732, 9, 2308 },
+    { 210808, 9, 2309 },
+    { 210884, 9, 2310 },
+    { 210960, 9, 2311 },
+    { 211036, 9, 2312 },
+    { 211112, 9, 2313 },
+    { 211189, 9, 2314 },
+    { 211266, 9, 2315 },
+    { 211343, 9, 2316 },
+    { 211420, 9, 2317 },
+    { 211497, 9, 2318 },
+    { 211574, 9, 2319 },
+    { 211816, 9, 2176 },
+    { 211892, 9, 2177 },
+    { 211968, 9, 2178 },
+    { 212044, 9, 2179 },
+    { 212120, 9, 2180 },
+    { 212196, 9, 2181 },
+    { 212272, 9, 2182 },
+    { 212348, 9, 2183 },
+    { 212424, 9, 2184 },
+    { 212500, 9, 2185 },
+    { 212577, 9, 2186 },
+    { 212654, 9, 2187 },
+    { 212731, 9, 2188 },
+    { 212808, 9, 2189 },
+    { 212885, 9, 2190 },
+    { 212962, 9, 2191 },
+    { 213197, 9, 2336 },
+    { 213266, 9, 2337 },
+    { 213336, 9, 2338 },
+    { 213409, 9, 2339 },
+    { 213484, 9, 2340 },
+    { 213560, 9, 2341 },
+    { 213633, 9, 2342 },
+    { 213708, 9, 2343 },
+    { 213785, 9, 2344 },
+    { 213860, 9, 2345 },
+    { 213937, 9, 2346 },
+    { 214014, 9, 2347 },
+    { 214086, 9, 2348 },
+    { 214159, 9, 2349 },
+    { 214235, 9, 2350 },
+    { 214317, 9, 2351 },
+    { 214577, 9, 2320 },
+    { 214653, 9, 2321 },
+    { 214729, 9, 2322 },
+    { 214805, 9, 2323 },
+    { 214881, 9, 2324 },
+    { 214957, 9, 2325 },
+    { 215036, 9, 2326 },
+    { 215112, 9, 2327 },
+    { 215188, 9, 2328 },
+    { 215264, 9, 2329 },
+    { 215341, 9, 2330 },
+    { 215418, 9, 2331 },
+    { 215495, 9, 2332 },
+    { 215572, 9, 2333 },
+    { 215649, 9, 2334 },
+    { 215726, 9, 2335 },
+    { 215979, 9, 2208 },
+    { 216048, 9, 2209 },
+    { 216118, 9, 2210 },
+    { 216191, 9, 2211 },
+    { 216266, 9, 2212 },
+    { 216342, 9, 2213 },
+    { 216415, 9, 2214 },
+    { 216490, 9, 2215 },
+    { 216567, 9, 2216 },
+    { 216642, 9, 2217 },
+    { 216719, 9, 2218 },
+    { 216796, 9, 2219 },
+    { 216868, 9, 2220 },
+    { 216941, 9, 2221 },
+    { 217017, 9, 2222 },
+    { 217099, 9, 2223 },
+    { 217359, 9, 2192 },
+    { 217435, 9, 2193 },
+    { 217511, 9, 2194 },
+    { 217587, 9, 2195 },
+    { 217663, 9, 2196 },
+    { 217739, 9, 2197 },
+    { 217818, 9, 2198 },
+    { 217894, 9, 2199 },
+    { 217970, 9, 2200 },
+    { 218046, 9, 2201 },
+    { 218123, 9, 2202 },
+    { 218200, 9, 2203 },
+    { 218277, 9, 2204 },
+    { 218354, 9, 2205 },
+    { 218431, 9, 2206 },
+    { 218508, 9, 2207 },
+    { 218802, 2, ROM_SPAN_ROW },
+    { 219294, 9, 2352 },
+    { 219375, 9, 2353 },
+    { 219456, 9, 2354 },
+    { 219541, 9, 2355 },
+    { 219626, 9, 2356 },
+    { 219703, 9, 2357 },
+    { 219780, 9, 2358 },
+    { 219855, 9, 2359 },
+    { 219935, 9, 2360 },
+    { 220012, 9, 2361 },
+    { 220096, 9, 2362 },
+    { 220178, 9, 2363 },
+    { 220259, 9, 2364 },
+    { 220336, 9, 2365 },
+    { 220422, 9, 2366 },
+    { 220506, 9, 2367 },
+    { 220815, 2, ROM_SPAN_ROW },
+    { 221307, 9, 2224 },
+    { 221388, 9, 2225 },
+    { 221469, 9, 2226 },
+    { 221554, 9, 2227 },
+    { 221639, 9, 2228 },
+    { 221716, 9, 2229 },
+    { 221793, 9, 2230 },
+    { 221868, 9, 2231 },
+    { 221948, 9, 2232 },
+    { 222025, 9, 2233 },
+    { 222109, 9, 2234 },
+    { 222191, 9, 2235 },
+    { 222272, 9, 2236 },
+    { 222349, 9, 2237 },
+    { 222435, 9, 2238 },
+    { 222519, 9, 2239 },
+    { 222794, 9, 2368 },
+    { 222870, 9, 2369 },
+    { 222946, 9, 2370 },
+    { 223022, 9, 2371 },
+    { 223098, 9, 2372 },
+    { 223174, 9, 2373 },
+    { 223250, 9, 2374 },
+    { 223326, 9, 2375 },
+    { 223402, 9, 2376 },
+    { 223478, 9, 2377 },
+    { 223555, 9, 2378 },
+    { 223632, 9, 2379 },
+    { 223709, 9, 2380 },
+    { 223786, 9, 2381 },
+    { 223863, 9, 2382 },
+    { 223940, 9, 2383 },
+    { 224182, 9, 2240 },
+    { 224258, 9, 2241 },
+    { 224334, 9, 2242 },
+    { 224410, 9, 2243 },
+    { 224486, 9, 2244 },
+    { 224562, 9, 2245 },
+    { 224638, 9, 2246 },
+    { 224714, 9, 2247 },
+    { 224790, 9, 2248 },
+    { 224866, 9, 2249 },
+    { 224943, 9, 2250 },
+    { 225020, 9, 2251 },
+    { 225097, 9, 2252 },
+    { 225174, 9, 2253 },
+    { 225251, 9, 2254 },
+    { 225328, 9, 2255 },
+    { 225563, 9, 2400 },
+    { 225632, 9, 2401 },
+    { 225702, 9, 2402 },
+    { 225775, 9, 2403 },
+    { 225850, 9, 2404 },
+    { 225926, 9, 2405 },
+    { 225999, 9, 2406 },
+    { 226074, 9, 2407 },
+    { 226151, 9, 2408 },
+    { 226226, 9, 2409 },
+    { 226303, 9, 2410 },
+    { 226380, 9, 2411 },
+    { 226452, 9, 2412 },
+    { 226525, 9, 2413 },
+    { 226601, 9, 2414 },
+    { 226683, 9, 2415 },
+    { 226943, 9, 2384 },
+    { 227019, 9, 2385 },
+    { 227095, 9, 2386 },
+    { 227171, 9, 2387 },
+    { 227247, 9, 2388 },
+    { 227323, 9, 2389 },
+    { 227402, 9, 2390 },
+    { 227478, 9, 2391 },
+    { 227554, 9, 2392 },
+    { 227630, 9, 2393 },
+    { 227707, 9, 2394 },
+    { 227784, 9, 2395 },
+    { 227861, 9, 2396 },
+    { 227938, 9, 2397 },
+    { 228015, 9, 2398 },
+    { 228092, 9, 2399 },
+    { 228345, 9, 2272 },
+    { 228414, 9, 2273 },
+    { 228484, 9, 2274 },
+    { 228557, 9, 2275 },
+    { 228632, 9, 2276 },
+    { 228708, 9, 2277 },
+    { 228781, 9, 2278 },
+    { 228856, 9, 2279 },
+    { 228933, 9, 2280 },
+    { 229008, 9, 2281 },
+    { 229085, 9, 2282 },
+    { 229162, 9, 2283 },
+    { 229234, 9, 2284 },
+    { 229307, 9, 2285 },
+    { 229383, 9, 2286 },
+    { 229465, 9, 2287 },
+    { 229725, 9, 2256 },
+    { 229801, 9, 2257 },
+    { 229877, 9, 2258 },
+    { 229953, 9, 2259 },
+    { 230029, 9, 2260 },
+    { 230105, 9, 2261 },
+    { 230184, 9, 2262 },
+    { 230260, 9, 2263 },
+    { 230336, 9, 2264 },
+    { 230412, 9, 2265 },
+    { 230489, 9, 2266 },
+    { 230566, 9, 2267 },
+    { 230643, 9, 2268 },
+    { 230720, 9, 2269 },
+    { 230797, 9, 2270 },
+    { 230874, 9, 2271 },
+    { 231168, 2, ROM_SPAN_ROW },
+    { 231660, 9, 2416 },
+    { 231741, 9, 2417 },
+    { 231822, 9, 2418 },
+    { 231907, 9, 2419 },
+    { 231992, 9, 2420 },
+    { 232069, 9, 2421 },
+    { 232146, 9, 2422 },
+    { 232221, 9, 2423 },
+    { 232301, 9, 2424 },
+    { 232378, 9, 2425 },
+    { 232462, 9, 2426 },
+    { 232544, 9, 2427 },
+    { 232625, 9, 2428 },
+    { 232702, 9, 2429 },
+    { 232788, 9, 2430 },
+    { 232872, 9, 2431 },
+    { 233181, 2, ROM_SPAN_ROW },
+    { 233673, 9, 2288 },
+    { 233754, 9, 2289 },
+    { 233835, 9, 2290 },
+    { 233920, 9, 2291 },
+    { 234005, 9, 2292 },
+    { 234082, 9, 2293 },
+    { 234159, 9, 2294 },
+    { 234234, 9, 2295 },
+    { 234314, 9, 2296 },
+    { 234391, 9, 2297 },
+    { 234475, 9, 2298 },
+    { 234557, 9, 2299 },
+    { 234638, 9, 2300 },
+    { 234715, 9, 2301 },
+    { 234801, 9, 2302 },
+    { 234885, 9, 2303 },
+    { 235160, 9, 2560 },
+    { 235236, 9, 2561 },
+    { 235312, 9, 2562 },
+    { 235388, 9, 2563 },
+    { 235464, 9, 2564 },
+    { 235540, 9, 2565 },
+    { 235616, 9, 2566 },
+    { 235692, 9, 2567 },
+    { 235768, 9, 2568 },
+    { 235844, 9, 2569 },
+    { 235921, 9, 2570 },
+    { 235998, 9, 2571 },
+    { 236075, 9, 2572 },
+    { 236152, 9, 2573 },
+    { 236229, 9, 2574 },
+    { 236306, 9, 2575 },
+    { 236548, 9, 2432 },
+    { 236624, 9, 2433 },
+    { 236700, 9, 2434 },
+    { 236776, 9, 2435 },
+    { 236852, 9, 2436 },
+    { 236928, 9, 2437 },
+    { 237004, 9, 2438 },
+    { 237080, 9, 2439 },
+    { 237156, 9, 2440 },
+    { 237232, 9, 2441 },
+    { 237309, 9, 2442 },
+    { 237386, 9, 2443 },
+    { 237463, 9, 2444 },
+    { 237540, 9, 2445 },
+    { 237617, 9, 2446 },
+    { 237694, 9, 2447 },
+    { 237929, 9, 2592 },
+    { 237998, 9, 2593 },
+    { 238068, 9, 2594 },
+    { 238141, 9, 2595 },
+    { 238216, 9, 2596 },
+    { 238292, 9, 2597 },
+    { 238365, 9, 2598 },
+    { 238440, 9, 2599 },
+    { 238517, 9, 2600 },
+    { 238592, 9, 2601 },
+    { 238669, 9, 2602 },
+    { 238746, 9, 2603 },
+    { 238818, 9, 2604 },
+    { 238891, 9, 2605 },
+    { 238967, 9, 2606 },
+    { 239049, 9, 2607 },
+    { 239309, 9, 2576 },
+    { 239385, 9, 2577 },
+    { 239461, 9, 2578 },
+    { 239537, 9, 2579 },
+    { 239613, 9, 2580 },
+    { 239689, 9, 2581 },
+    { 239768, 9, 2582 },
+    { 239844, 9, 2583 },
+    { 239920, 9, 2584 },
+    { 239996, 9, 2585 },
+    { 240073, 9, 2586 },
+    { 240150, 9, 2587 },
+    { 240227, 9, 2588 },
+    { 240304, 9, 2589 },
+    { 240381, 9, 2590 },
+    { 240458, 9, 2591 },
+    { 240711, 9, 2464 },
+    { 240780, 9, 2465 },
+    { 240850, 9, 2466 },
+    { 240923, 9, 2467 },
+    { 240998, 9, 2468 },
+    { 241074, 9, 2469 },
+    { 241147, 9, 2470 },
+    { 241222, 9, 2471 },
+    { 241299, 9, 2472 },
+    { 241374, 9, 2473 },
+    { 241451, 9, 2474 },
+    { 241528, 9, 2475 },
+    { 241600, 9, 2476 },
+    { 241673, 9, 2477 },
+    { 241749, 9, 2478 },
+    { 241831, 9, 2479 },
+    { 242091, 9, 2448 },
+    { 242167, 9, 2449 },
+    { 242243, 9, 2450 },
+    { 242319, 9, 2451 },
+    { 242395, 9, 2452 },
+    { 242471, 9, 2453 },
+    { 242550, 9, 2454 },
+    { 242626, 9, 2455 },
+    { 242702, 9, 2456 },
+    { 242778, 9, 2457 },
+    { 242855, 9, 2458 },
+    { 242932, 9, 2459 },
+    { 243009, 9, 2460 },
+    { 243086, 9, 2461 },
+    { 243163, 9, 2462 },
+    { 243240, 9, 2463 },
+    { 243534, 2, ROM_SPAN_ROW },
+    { 244026, 9, 2608 },
+    { 244107, 9, 2609 },
+    { 244188, 9, 2610 },
+    { 244273, 9, 2611 },
+    { 244358, 9, 2612 },
+    { 244435, 9, 2613 },
+    { 244512, 9, 2614 },
+    { 244587, 9, 2615 },
+    { 244667, 9, 2616 },
+    { 244744, 9, 2617 },
+    { 244828, 9, 2618 },
+    { 244910, 9, 2619 },
+    { 244991, 9, 2620 },
+    { 245068, 9, 2621 },
+    { 245154, 9, 2622 },
+    { 245238, 9, 2623 },
+    { 245547, 2, ROM_SPAN_ROW },
+    { 246039, 9, 2480 },
+    { 246120, 9, 2481 },
+    { 246201, 9, 2482 },
+    { 246286, 9, 2483 },
+    { 246371, 9, 2484 },
+    { 246448, 9, 2485 },
+    { 246525, 9, 2486 },
+    { 246600, 9, 2487 },
+    { 246680, 9, 2488 },
+    { 246757, 9, 2489 },
+    { 246841, 9, 2490 },
+    { 246923, 9, 2491 },
+    { 247004, 9, 2492 },
+    { 247081, 9, 2493 },
+    { 247167, 9, 2494 },
+    { 247251, 9, 2495 },
+    { 247526, 9, 2624 },
+    { 247602, 9, 2625 },
+    { 247678, 9, 2626 },
+    { 247754, 9, 2627 },
+    { 247830, 9, 2628 },
+    { 247906, 9, 2629 },
+    { 247982, 9, 2630 },
+    { 248058, 9, 2631 },
+    { 248134, 9, 2632 },
+    { 248210, 9, 2633 },
+    { 248287, 9, 2634 },
+    { 248364, 9, 2635 },
+    { 248441, 9, 2636 },
+    { 248518, 9, 2637 },
+    { 248595, 9, 2638 },
+    { 248672, 9, 2639 },
+    { 248914, 9, 2496 },
+    { 248990, 9, 2497 },
+    { 249066, 9, 2498 },
+    { 249142, 9, 2499 },
+    { 249218, 9, 2500 },
+    { 249294, 9, 2501 },
+    { 249370, 9, 2502 },
+    { 249446, 9, 2503 },
+    { 249522, 9, 2504 },
+    { 249598, 9, 2505 },
+    { 249675, 9, 2506 },
+    { 249752, 9, 2507 },
+    { 249829, 9, 2508 },
+    { 249906, 9, 2509 },
+    { 249983, 9, 2510 },
+    { 250060, 9, 2511 },
+    { 250295, 9, 2656 },
+    { 250364, 9, 2657 },
+    { 250434, 9, 2658 },
+    { 250507, 9, 2659 },
+    { 250582, 9, 2660 },
+    { 250658, 9, 2661 },
+    { 250731, 9, 2662 },
+    { 250806, 9, 2663 },
+    { 250883, 9, 2664 },
+    { 250958, 9, 2665 },
+    { 251035, 9, 2666 },
+    { 251112, 9, 2667 },
+    { 251184, 9, 2668 },
+    { 251257, 9, 2669 },
+    { 251333, 9, 2670 },
+    { 251415, 9, 2671 },
+    { 251675, 9, 2640 },
+    { 251751, 9, 2641 },
+    { 251827, 9, 2642 },
+    { 251903, 9, 2643 },
+    { 251979, 9, 2644 },
+    { 252055, 9, 2645 },
+    { 252134, 9, 2646 },
+    { 252210, 9, 2647 },
+    { 252286, 9, 2648 },
+    { 252362, 9, 2649 },
+    { 252439, 9, 2650 },
+    { 252516, 9, 2651 },
+    { 252593, 9, 2652 },
+    { 252670, 9, 2653 },
+    { 252747, 9, 2654 },
+    { 252824, 9, 2655 },
+    { 253077, 9, 2528 },
+    { 253146, 9, 2529 },
+    { 253216, 9, 2530 },
+    { 253289, 9, 2531 },
+    { 253364, 9, 2532 },
+    { 253440, 9, 2533 },
+    { 253513, 9, 2534 },
+    { 253588, 9, 2535 },
+    { 253665, 9, 2536 },
+    { 253740, 9, 2537 },
+    { 253817, 9, 2538 },
+    { 253894, 9, 2539 },
+    { 253966, 9, 2540 },
+    { 254039, 9, 2541 },
+    { 254115, 9, 2542 },
+    { 254197, 9, 2543 },
+    { 254457, 9, 2512 },
+    { 254533, 9, 2513 },
+    { 254609, 9, 2514 },
+    { 254685, 9, 2515 },
+    { 254761, 9, 2516 },
+    { 254837, 9, 2517 },
+    { 254916, 9, 2518 },
+    { 254992, 9, 2519 },
+    { 255068, 9, 2520 },
+    { 255144, 9, 2521 },
+    { 255221, 9, 2522 },
+    { 255298, 9, 2523 },
+    { 255375, 9, 2524 },
+    { 255452, 9, 2525 },
+    { 255529, 9, 2526 },
+    { 255606, 9, 2527 },
+    { 255900, 2, ROM_SPAN_ROW },
+    { 256392, 9, 2672 },
+    { 256473, 9, 2673 },
+    { 256554, 9, 2674 },
+    { 256639, 9, 2675 },
+    { 256724, 9, 2676 },
+    { 256801, 9, 2677 },
+    { 256878, 9, 2678 },
+    { 256953, 9, 2679 },
+    { 257033, 9, 2680 },
+    { 257110, 9, 2681 },
+    { 257194, 9, 2682 },
+    { 257276, 9, 2683 },
+    { 257357, 9, 2684 },
+    { 257434, 9, 2685 },
+    { 257520, 9, 2686 },
+    { 257604, 9, 2687 },
+    { 257913, 2, ROM_SPAN_ROW },
+    { 258405, 9, 2544 },
+    { 258486, 9, 2545 },
+    { 258567, 9, 2546 },
+    { 258652, 9, 2547 },
+    { 258737, 9, 2548 },
+    { 258814, 9, 2549 },
+    { 258891, 9, 2550 },
+    { 258966, 9, 2551 },
+    { 259046, 9, 2552 },
+    { 259123, 9, 2553 },
+    { 259207, 9, 2554 },
+    { 259289, 9, 2555 },
+    { 259370, 9, 2556 },
+    { 259447, 9, 2557 },
+    { 259533, 9, 2558 },
+    { 259617, 9, 2559 },
+    { 259892, 9, 2816 },
+    { 259968, 9, 2817 },
+    { 260044, 9, 2818 },
+    { 260120, 9, 2819 },
+    { 260196, 9, 2820 },
+    { 260272, 9, 2821 },
+    { 260348, 9, 2822 },
+    { 260424, 9, 2823 },
+    { 260500, 9, 2824 },
+    { 260576, 9, 2825 },
+    { 260653, 9, 2826 },
+    { 260730, 9, 2827 },
+    { 260807, 9, 2828 },
+    { 260884, 9, 2829 },
+    { 260961, 9, 2830 },
+    { 261038, 9, 2831 },
+    { 261280, 9, 2688 },
+    { 261356, 9, 2689 },
+    { 261432, 9, 2690 },
+    { 261508, 9, 2691 },
+    { 261584, 9, 2692 },
+    { 261660, 9, 2693 },
+    { 261736, 9, 2694 },
+    { 261812, 9, 2695 },
+    { 261888, 9, 2696 },
+    { 261964, 9, 2697 },
+    { 262041, 9, 2698 },
+    { 262118, 9, 2699 },
+    { 262195, 9, 2700 },
+    { 262272, 9, 2701 },
+    { 262349, 9, 2702 },
+    { 262426, 9, 2703 },
+    { 262661, 9, 2848 },
+    { 262730, 9, 2849 },
+    { 262800, 9, 2850 },
+    { 262873, 9, 2851 },
+    { 262948, 9, 2852 },
+    { 263024, 9, 2853 },
+    { 263097, 9, 2854 },
+    { 263172, 9, 2855 },
+    { 263249, 9, 2856 },
+    { 263324, 9, 2857 },
+    { 263401, 9, 2858 },
+    { 263478, 9, 2859 },
+    { 263550, 9, 2860 },
+    { 263623, 9, 2861 },
+    { 263699, 9, 2862 },
+    { 263781, 9, 2863 },
+    { 264041, 9, 2832 },
+    { 264117, 9, 2833 },
+    { 264193, 9, 2834 },
+    { 264269, 9, 2835 },
+    { 264345, 9, 2836 },
+    { 264421, 9, 2837 },
+    { 264500, 9, 2838 },
+    { 264576, 9, 2839 },
+    { 264652, 9, 2840 },
+    { 264728, 9, 2841 },
+    { 264805, 9, 2842 },
+    { 264882, 9, 2843 },
+    { 264959, 9, 2844 },
+    { 265036, 9, 2845 },
+    { 265113, 9, 2846 },
+    { 265190, 9, 2847 },
+    { 265443, 9, 2720 },
+    { 265512, 9, 2721 },
+    { 265582, 9, 2722 },
+    { 265655, 9, 2723 },
+    { 265730, 9, 2724 },
+    { 265806, 9, 2725 },
+    { 265879, 9, 2726 },
+    { 265954, 9, 2727 },
+    { 266031, 9, 2728 },
+    { 266106, 9, 2729 },
+    { 266183, 9, 2730 },
+    { 266260, 9, 2731 },
+    { 266332, 9, 2732 },
+    { 266405, 9, 2733 },
+    { 266481, 9, 2734 },
+    { 266563, 9, 2735 },
+    { 266823, 9, 2704 },
+    { 266899, 9, 2705 },
+    { 266975, 9, 2706 },
+    { 267051, 9, 2707 },
+    { 267127, 9, 2708 },
+    { 267203, 9, 2709 },
+    { 267282, 9, 2710 },
+    { 267358, 9, 2711 },
+    { 267434, 9, 2712 },
+    { 267510, 9, 2713 },
+    { 267587, 9, 2714 },
+    { 267664, 9, 2715 },
+    { 267741, 9, 2716 },
+    { 267818, 9, 2717 },
+    { 267895, 9, 2718 },
+    { 267972, 9, 2719 },
+    { 268266, 2, ROM_SPAN_ROW },
+    { 268758, 9, 2864 },
+    { 268839, 9, 2865 },
+    { 268920, 9, 2866 },
+    { 269005, 9, 2867 },
+    { 269090, 9, 2868 },
+    { 269167, 9, 2869 },
+    { 269244, 9, 2870 },
+    { 269319, 9, 2871 },
+    { 269399, 9, 2872 },
+    { 269476, 9, 2873 },
+    { 269560, 9, 2874 },
+    { 269642, 9, 2875 },
+    { 269723, 9, 2876 },
+    { 269800, 9, 2877 },
+    { 269886, 9, 2878 },
+    { 269970, 9, 2879 },
+    { 270279, 2, ROM_SPAN_ROW },
+    { 270771, 9, 2736 },
+    { 270852, 9, 2737 },
+    { 270933, 9, 2738 },
+    { 271018, 9, 2739 },
+    { 271103, 9, 2740 },
+    { 271180, 9, 2741 },
+    { 271257, 9, 2742 },
+    { 271332, 9, 2743 },
+    { 271412, 9, 2744 },
+    { 271489, 9, 2745 },
+    { 271573, 9, 2746 },
+    { 271655, 9, 2747 },
+    { 271736, 9, 2748 },
+    { 271813, 9, 2749 },
+    { 271899, 9, 2750 },
+    { 271983, 9, 2751 },
+    { 272258, 9, 2880 },
+    { 272334, 9, 2881 },
+    { 272410, 9, 2882 },
+    { 272486, 9, 2883 },
+    { 272562, 9, 2884 },
+    { 272638, 9, 2885 },
+    { 272714, 9, 2886 },
+    { 272790, 9, 2887 },
+    { 272866, 9, 2888 },
+    { 272942, 9, 2889 },
+    { 273019, 9, 2890 },
+    { 273096, 9, 2891 },
+    { 273173, 9, 2892 },
+    { 273250, 9, 2893 },
+    { 273327, 9, 2894 },
+    { 273404, 9, 2895 },
+    { 273646, 9, 2752 },
+    { 273722, 9, 2753 },
+    { 273798, 9, 2754 },
+    { 273874, 9, 2755 },
+    { 273950, 9, 2756 },
+    { 274026, 9, 2757 },
+    { 274102, 9, 2758 },
+    { 274178, 9, 2759 },
+    { 274254, 9, 2760 },
+    { 274330, 9, 2761 },
+    { 274407, 9, 2762 },
+    { 274484, 9, 2763 },
+    { 274561, 9, 2764 },
+    { 274638, 9, 2765 },
+    { 274715, 9, 2766 },
+    { 274792, 9, 2767 },
+    { 275027, 9, 2912 },
+    { 275096, 9, 2913 },
+    { 275166, 9, 2914 },
+    { 275239, 9, 2915 },
+    { 275314, 9, 2916 },
+    { 275390, 9, 2917 },
+    { 275463, 9, 2918 },
+    { 275538, 9, 2919 },
+    { 275615, 9, 2920 },
+    { 275690, 9, 2921 },
+    { 275767, 9, 2922 },
+    { 275844, 9, 2923 },
+    { 275916, 9, 2924 },
+    { 275989, 9, 2925 },
+    { 276065, 9, 2926 },
+    { 276147, 9, 2927 },
+    { 276407, 9, 2896 },
+    { 276483, 9, 2897 },
+    { 276559, 9, 2898 },
+    { 276635, 9, 2899 },
+    { 276711, 9, 2900 },
+    { 276787, 9, 2901 },
+    { 276866, 9, 2902 },
+    { 276942, 9, 2903 },
+    { 277018, 9, 2904 },
+    { 277094, 9, 2905 },
+    { 277171, 9, 2906 },
+    { 277248, 9, 2907 },
+    { 277325, 9, 2908 },
+    { 277402, 9, 2909 },
+    { 277479, 9, 2910 },
+    { 277556, 9, 2911 },
+    { 277809, 9, 2784 },
+    { 277878, 9, 2785 },
+    { 277948, 9, 2786 },
+    { 278021, 9, 2787 },
+    { 278096, 9, 2788 },
+    { 278172, 9, 2789 },
+    { 278245, 9, 2790 },
+    { 278320, 9, 2791 },
+    { 278397, 9, 2792 },
+    { 278472, 9, 2793 },
+    { 278549, 9, 2794 },
+    { 278626, 9, 2795 },
+    { 278698, 9, 2796 },
+    { 278771, 9, 2797 },
+    { 278847, 9, 2798 },
+    { 278929, 9, 2799 },
+    { 279189, 9, 2768 },
+    { 279265, 9, 2769 },
+    { 279341, 9, 2770 },
+    { 279417, 9, 2771 },
+    { 279493, 9, 2772 },
+    { 279569, 9, 2773 },
+    { 279648, 9, 2774 },
+    { 279724, 9, 2775 },
+    { 279800, 9, 2776 },
+    { 279876, 9, 2777 },
+    { 279953, 9, 2778 },
+    { 280030, 9, 2779 },
+    { 280107, 9, 2780 },
+    { 280184, 9, 2781 },
+    { 280261, 9, 2782 },
+    { 280338, 9, 2783 },
+    { 280632, 2, ROM_SPAN_ROW },
+    { 281124, 9, 2928 },
+    { 281205, 9, 2929 },
+    { 281286, 9, 2930 },
+    { 281371, 9, 2931 },
+    { 281456, 9, 2932 },
+    { 281533, 9, 2933 },
+    { 281610, 9, 2934 },
+    { 281685, 9, 2935 },
+    { 281765, 9, 2936 },
+    { 281842, 9, 2937 },
+    { 281926, 9, 2938 },
+    { 282008, 9, 2939 },
+    { 282089, 9, 2940 },
+    { 282166, 9, 2941 },
+    { 282252, 9, 2942 },
+    { 282336, 9, 2943 },
+    { 282645, 2, ROM_SPAN_ROW },
+    { 283137, 9, 2800 },
+    { 283218, 9, 2801 },
+    { 283299, 9, 2802 },
+    { 283384, 9, 2803 },
+    { 283469, 9, 2804 },
+    { 283546, 9, 2805 },
+    { 283623, 9, 2806 },
+    { 283698, 9, 2807 },
+    { 283778, 9, 2808 },
+    { 283855, 9, 2809 },
+    { 283939, 9, 2810 },
+    { 284021, 9, 2811 },
+    { 284102, 9, 2812 },
+    { 284179, 9, 2813 },
+    { 284265, 9, 2814 },
+    { 284349, 9, 2815 },
+    { 284624, 9, 3072 },
+    { 284700, 9, 3073 },
+    { 284776, 9, 3074 },
+    { 284852, 9, 3075 },
+    { 284928, 9, 3076 },
+    { 285004, 9, 3077 },
+    { 285080, 9, 3078 },
+    { 285156, 9, 3079 },
+    { 285232, 9, 3080 },
+    { 285308, 9, 3081 },
+    { 285385, 9, 3082 },
+    { 285462, 9, 3083 },
+    { 285539, 9, 3084 },
+    { 285616, 9, 3085 },
+    { 285693, 9, 3086 },
+    { 285770, 9, 3087 },
+    { 286012, 9, 2944 },
+    { 286088, 9, 2945 },
+    { 286164, 9, 2946 },
+    { 286240, 9, 2947 },
+    { 286316, 9, 2948 },
+    { 286392, 9, 2949 },
+    { 286468, 9, 2950 },
+    { 286544, 9, 2951 },
+    { 286620, 9, 2952 },
+    { 286696, 9, 2953 },
+    { 286773, 9, 2954 },
+    { 286850, 9, 2955 },
+    { 286927, 9, 2956 },
+    { 287004, 9, 2957 },
+    { 287081, 9, 2958 },
+    { 287158, 9, 2959 },
+    { 287393, 9, 3104 },
+    { 287462, 9, 3105 },
+    { 287532, 9, 3106 },
+    { 287605, 9, 3107 },
+    { 287680, 9, 3108 },
+    { 287756, 9, 3109 },
+    { 287829, 9, 3110 },
+    { 287904, 9, 3111 },
+    { 287981, 9, 3112 },
+    { 288056, 9, 3113 },
+    { 288133, 9, 3114 },
+    { 288210, 9, 3115 },
+    { 288282, 9, 3116 },
+    { 288355, 9, 3117 },
+    { 288431, 9, 3118 },
+    { 288513, 9, 3119 },
+    { 288773, 9, 3088 },
+    { 288849, 9, 3089 },
+    { 288925, 9, 3090 },
+    { 289001, 9, 3091 },
+    { 289077, 9, 3092 },
+    { 289153, 9, 3093 },
+    { 289232, 9, 3094 },
+    { 289308, 9, 3095 },
+    { 289384, 9, 3096 },
+    { 289460, 9, 3097 },
+    { 289537, 9, 3098 },
+    { 289614, 9, 3099 },
+    { 289691, 9, 3100 },
+    { 289768, 9, 3101 },
+    { 289845, 9, 3102 },
+    { 289922, 9, 3103 },
+    { 290175, 9, 2976 },
+    { 290244, 9, 2977 },
+    { 290314, 9, 2978 },
+    { 290387, 9, 2979 },
+    { 290462, 9, 2980 },
+    { 290538, 9, 2981 },
+    { 290611, 9, 2982 },
+    { 290686, 9, 2983 },
+    { 290763, 9, 2984 },
+    { 290838, 9, 2985 },
+    { 290915, 9, 2986 },
+    { 290992, 9, 2987 },
+    { 291064, 9, 2988 },
+    { 291137, 9, 2989 },
+    { 291213, 9, 2990 },
+    { 291295, 9, 2991 },
+    { 291555, 9, 2960 },
+    { 291631, 9, 2961 },
+    { 291707, 9, 2962 },
+    { 291783, 9, 2963 },
+    { 291859, 9, 2964 },
+    { 291935, 9, 2965 },
+    { 292014, 9, 2966 },
+    { 292090, 9, 2967 },
+    { 292166, 9, 2968 },
+    { 292242, 9, 2969 },
+    { 292319, 9, 2970 },
+    { 292396, 9, 2971 },
+    { 292473, 9, 2972 },
+    { 292550, 9, 2973 },
+    { 292627, 9, 2974 },
+    { 292704, 9, 2975 },
+    { 292998, 2, ROM_SPAN_ROW },
+    { 293490, 9, 3120 },
+    { 293571, 9, 3121 },
+    { 293652, 9, 3122 },
+    { 293737, 9, 3123 },
+    { 293822, 9, 3124 },
+    { 293899, 9, 3125 },
+    { 293976, 9, 3126 },
+    { 294051, 9, 3127 },
+    { 294131, 9, 3128 },
+    { 294208, 9, 3129 },
+    { 294292, 9, 3130 },
+    { 294374, 9, 3131 },
+    { 294455, 9, 3132 },
+    { 294532, 9, 3133 },
+    { 294618, 9, 3134 },
+    { 294702, 9, 3135 },
+    { 295011, 2, ROM_SPAN_ROW },
+    { 295503, 9, 2992 },
+    { 295584, 9, 2993 },
+    { 295665, 9, 2994 },
+    { 295750, 9, 2995 },
+    { 295835, 9, 2996 },
+    { 295912, 9, 2997 },
+    { 295989, 9, 2998 },
+    { 296064, 9, 2999 },
+    { 296144, 9, 3000 },
+    { 296221, 9, 3001 },
+    { 296305, 9, 3002 },
+    { 296387, 9, 3003 },
+    { 296468, 9, 3004 },
+    { 296545, 9, 3005 },
+    { 296631, 9, 3006 },
+    { 296715, 9, 3007 },
+    { 296990, 9, 3136 },
+    { 297066, 9, 3137 },
+    { 297142, 9, 3138 },
+    { 297218, 9, 3139 },
+    { 297294, 9, 3140 },
+    { 297370, 9, 3141 },
+    { 297446, 9, 3142 },
+    { 297522, 9, 3143 },
+    { 297598, 9, 3144 },
+    { 297674, 9, 3145 },
+    { 297751, 9, 3146 },
+    { 297828, 9, 3147 },
+    { 297905, 9, 3148 },
+    { 297982, 9, 3149 },
+    { 298059, 9, 3150 },
+    { 298136, 9, 3151 },
+    { 298378, 9, 3008 },
+    { 298454, 9, 3009 },
+    { 298530, 9, 3010 },
+    { 298606, 9, 3011 },
+    { 298682, 9, 3012 },
+    { 298758, 9, 3013 },
+    { 298834, 9, 3014 },
+    { 298910, 9, 3015 },
+    { 298986, 9, 3016 },
+    { 299062, 9, 3017 },
+    { 299139, 9, 3018 },
+    { 299216, 9, 3019 },
+    { 299293, 9, 3020 },
+    { 299370, 9, 3021 },
+    { 299447, 9, 3022 },
+    { 299524, 9, 3023 },
+    { 299759, 9, 3168 },
+    { 299828, 9, 3169 },
+    { 299898, 9, 3170 },
+    { 299971, 9, 3171 },
+    { 300046, 9, 3172 },
+    { 300122, 9, 3173 },
+    { 300195, 9, 3174 },
+    { 300270, 9, 3175 },
+    { 300347, 9, 3176 },
+    { 300422, 9, 3177 },
+    { 300499, 9, 3178 },
+    { 300576, 9, 3179 },
+    { 300648, 9, 3180 },
+    { 300721, 9, 3181 },
+    { 300797, 9, 3182 },
+    { 300879, 9, 3183 },
+    { 301139, 9, 3152 },
+    { 301215, 9, 3153 },
+    { 301291, 9, 3154 },
+    { 301367, 9, 3155 },
+    { 301443, 9, 3156 },
+    { 301519, 9, 3157 },
+    { 301598, 9, 3158 },
+    { 301674, 9, 3159 },
+    { 301750, 9, 3160 },
+    { 301826, 9, 3161 },
+    { 301903, 9, 3162 },
+    { 301980, 9, 3163 },
+    { 302057, 9, 3164 },
+    { 302134, 9, 3165 },
+    { 302211, 9, 3166 },
+    { 302288, 9, 3167 },
+    { 302541, 9, 3040 },
+    { 302610, 9, 3041 },
+    { 302680, 9, 3042 },
+    { 302753, 9, 3043 },
+    { 302828, 9, 3044 },
+    { 302904, 9, 3045 },
+    { 302977, 9, 3046 },
+    { 303052, 9, 3047 },
+    { 303129, 9, 3048 },
+    { 303204, 9, 3049 },
+    { 303281, 9, 3050 },
+    { 303358, 9, 3051 },
+    { 303430, 9, 3052 },
+    { 303503, 9, 3053 },
+    { 303579, 9, 3054 },
+    { 303661, 9, 3055 },
+    { 303921, 9, 3024 },
+    { 303997, 9, 3025 },
+    { 304073, 9, 3026 },
+    { 304149, 9, 3027 },
+    { 304225, 9, 3028 },
+    { 304301, 9, 3029 },
+    { 304380, 9, 3030 },
+    { 304456, 9, 3031 },
+    { 304532, 9, 3032 },
+    { 304608, 9, 3033 },
+    { 304685, 9, 3034 },
+    { 304762, 9, 3035 },
+    { 304839, 9, 3036 },
+    { 304916, 9, 3037 },
+    { 304993, 9, 3038 },
+    { 305070, 9, 3039 },
+    { 305364, 2, ROM_SPAN_ROW },
+    { 305856, 9, 3184 },
+    { 305937, 9, 3185 },
+    { 306018, 9, 3186 },
+    { 306103, 9, 3187 },
+    { 306188, 9, 3188 },
+    { 306265, 9, 3189 },
+    { 306342, 9, 3190 },
+    { 306417, 9, 3191 },
+    { 306497, 9, 3192 },
+    { 306574, 9, 3193 },
+    { 306658, 9, 3194 },
+    { 306740, 9, 3195 },
+    { 306821, 9, 3196 },
+    { 306898, 9, 3197 },
+    { 306984, 9, 3198 },
+    { 307068, 9, 3199 },
+    { 307377, 2, ROM_SPAN_ROW },
+    { 307869, 9, 3056 },
+    { 307950, 9, 3057 },
+    { 308031, 9, 3058 },
+    { 308116, 9, 3059 },
+    { 308201, 9, 3060 },
+    { 308278, 9, 3061 },
+    { 308355, 9, 3062 },
+    { 308430, 9, 3063 },
+    { 308510, 9, 3064 },
+    { 308587, 9, 3065 },
+    { 308671, 9, 3066 },
+    { 308753, 9, 3067 },
+    { 308834, 9, 3068 },
+    { 308911, 9, 3069 },
+    { 308997, 9, 3070 },
+    { 309081, 9, 3071 },
+    { 309356, 9, 3328 },
+    { 309432, 9, 3329 },
+    { 309508, 9, 3330 },
+    { 309584, 9, 3331 },
+    { 309660, 9, 3332 },
+    { 309736, 9, 3333 },
+    { 309812, 9, 3334 },
+    { 309888, 9, 3335 },
+    { 309964, 9, 3336 },
+    { 310040, 9, 3337 },
+    { 310117, 9, 3338 },
+    { 310194, 9, 3339 },
+    { 310271, 9, 3340 },
+    { 310348, 9, 3341 },
+    { 310425, 9, 3342 },
+    { 310502, 9, 3343 },
+    { 310744, 9, 3200 },
+    { 310820, 9, 3201 },
+    { 310896, 9, 3202 },
+    { 310972, 9, 3203 },
+    { 311048, 9, 3204 },
+    { 311124, 9, 3205 },
+    { 311200, 9, 3206 },
+    { 311276, 9, 3207 },
+    { 311352, 9, 3208 },
+    { 311428, 9, 3209 },
+    { 311505, 9, 3210 },
+    { 311582, 9, 3211 },
+    { 311659, 9, 3212 },
+    { 311736, 9, 3213 },
+    { 311813, 9, 3214 },
+    { 311890, 9, 3215 },
+    { 312125, 9, 3360 },
+    { 312194, 9, 3361 },
+    { 312264, 9, 3362 },
+    { 312337, 9, 3363 },
+    { 312412, 9, 3364 },
+    { 312488, 9, 3365 },
+    { 312561, 9, 3366 },
+    { 312636, 9, 3367 },
+    { 312713, 9, 3368 },
+    { 312788, 9, 3369 },
+    { 312865, 9, 3370 },
+    { 312942, 9, 3371 },
+    { 313014, 9, 3372 },
+    { 313087, 9, 3373 },
+    { 313163, 9, 3374 },
+    { 313245, 9, 3375 },
+    { 313505, 9, 3344 },
+    { 313581, 9, 3345 },
+    { 313657, 9, 3346 },
+    { 313733, 9, 3347 },
+    { 313809, 9, 3348 },
+    { 313885, 9, 3349 },
+    { 313964, 9, 3350 },
+    { 314040, 9, 3351 },
+    { 314116, 9, 3352 },
+    { 314192, 9, 3353 },
+    { 314269, 9, 3354 },
+    { 314346, 9, 3355 },
+    { 314423, 9, 3356 },
+    { 314500, 9, 3357 },
+    { 314577, 9, 3358 },
+    { 314654, 9, 3359 },
+    { 314907, 9, 3232 },
+    { 314976, 9, 3233 },
+    { 315046, 9, 3234 },
+    { 315119, 9, 3235 },
+    { 315194, 9, 3236 },
+    { 315270, 9, 3237 },
+    { 315343, 9, 3238 },
+    { 315418, 9, 3239 },
+    { 315495, 9, 3240 },
+    { 315570, 9, 3241 },
+    { 315647, 9, 3242 },
+    { 315724, 9, 3243 },
+    { 315796, 9, 3244 },
+    { 315869, 9, 3245 },
+    { 315945, 9, 3246 },
+    { 316027, 9, 3247 },
+    { 316287, 9, 3216 },
+    { 316363, 9, 3217 },
+    { 316439, 9, 3218 },
+    { 316515, 9, 3219 },
+    { 316591, 9, 3220 },
+    { 316667, 9, 3221 },
+    { 316746, 9, 3222 },
+    { 316822, 9, 3223 },
+    { 316898, 9, 3224 },
+    { 316974, 9, 3225 },
+    { 317051, 9, 3226 },
+    { 317128, 9, 3227 },
+    { 317205, 9, 3228 },
+    { 317282, 9, 3229 },
+    { 317359, 9, 3230 },
+    { 317436, 9, 3231 },
+    { 317730, 2, ROM_SPAN_ROW },
+    { 318222, 9, 3376 },
+    { 318303, 9, 3377 },
+    { 318384, 9, 3378 },
+    { 318469, 9, 3379 },
+    { 318554, 9, 3380 },
+    { 318631, 9, 3381 },
+    { 318708, 9, 3382 },
+    { 318783, 9, 3383 },
+    { 318863, 9, 3384 },
+    { 318940, 9, 3385 },
+    { 319024, 9, 3386 },
+    { 319106, 9, 3387 },
+    { 319187, 9, 3388 },
+    { 319264, 9, 3389 },
+    { 319350, 9, 3390 },
+    { 319434, 9, 3391 },
+    { 319743, 2, ROM_SPAN_ROW },
+    { 320235, 9, 3248 },
+    { 320316, 9, 3249 },
+    { 320397, 9, 3250 },
+    { 320482, 9, 3251 },
+    { 320567, 9, 3252 },
+    { 320644, 9, 3253 },
+    { 320721, 9, 3254 },
+    { 320796, 9, 3255 },
+    { 320876, 9, 3256 },
+    { 320953, 9, 3257 },
+    { 321037, 9, 3258 },
+    { 321119, 9, 3259 },
+    { 321200, 9, 3260 },
+    { 321277, 9, 3261 },
+    { 321363, 9, 3262 },
+    { 321447, 9, 3263 },
+    { 321722, 9, 3392 },
+    { 321798, 9, 3393 },
+    { 321874, 9, 3394 },
+    { 321950, 9, 3395 },
+    { 322026, 9, 3396 },
+    { 322102, 9, 3397 },
+    { 322178, 9, 3398 },
+    { 322254, 9, 3399 },
+    { 322330, 9, 3400 },
+    { 322406, 9, 3401 },
+    { 322483, 9, 3402 },
+    { 322560, 9, 3403 },
+    { 322637, 9, 3404 },
+    { 322714, 9, 3405 },
+    { 322791, 9, 3406 },
+    { 322868, 9, 3407 },
+    { 323110, 9, 3264 },
+    { 323186, 9, 3265 },
+    { 323262, 9, 3266 },
+    { 323338, 9, 3267 },
+    { 323414, 9, 3268 },
+    { 323490, 9, 3269 },
+    { 323566, 9, 3270 },
+    { 323642, 9, 3271 },
+    { 323718, 9, 3272 },
+    { 323794, 9, 3273 },
+    { 323871, 9, 3274 },
+    { 323948, 9, 3275 },
+    { 324025, 9, 3276 },
+    { 324102, 9, 3277 },
+    { 324179, 9, 3278 },
+    { 324256, 9, 3279 },
+    { 324491, 9, 3424 },
+    { 324560, 9, 3425 },
+    { 324630, 9, 3426 },
+    { 324703, 9, 3427 },
+    { 324778, 9, 3428 },
+    { 324854, 9, 3429 },
+    { 324927, 9, 3430 },
+    { 325002, 9, 3431 },
+    { 325079, 9, 3432 },
+    { 325154, 9, 3433 },
+    { 325231, 9, 3434 },
+    { 325308, 9, 3435 },
+    { 325380, 9, 3436 },
+    { 325453, 9, 3437 },
+    { 325529, 9, 3438 },
+    { 325611, 9, 3439 },
+    { 325871, 9, 3408 },
+    { 325947, 9, 3409 },
+    { 326023, 9, 3410 },
+    { 326099, 9, 3411 },
+    { 326175, 9, 3412 },
+    { 326251, 9, 3413 },
+    { 326330, 9, 3414 },
+    { 326406, 9, 3415 },
+    { 326482, 9, 3416 },
+    { 326558, 9, 3417 },
+    { 326635, 9, 3418 },
+    { 326712, 9, 3419 },
+    { 326789, 9, 3420 },
+    { 326866, 9, 3421 },
+    { 326943, 9, 3422 },
+    { 327020, 9, 3423 },
+    { 327273, 9, 3296 },
+    { 327342, 9, 3297 },
+    { 327412, 9, 3298 },
+    { 327485, 9, 3299 },
+    { 327560, 9, 3300 },
+    { 327636, 9, 3301 },
+    { 327709, 9, 3302 },
+    { 327784, 9, 3303 },
+    { 327861, 9, 3304 },
+    { 327936, 9, 3305 },
+    { 328013, 9, 3306 },
+    { 328090, 9, 3307 },
+    { 328162, 9, 3308 },
+    { 328235, 9, 3309 },
+    { 328311, 9, 3310 },
+    { 328393, 9, 3311 },
+    { 328653, 9, 3280 },
+    { 328729, 9, 3281 },
+    { 328805, 9, 3282 },
+    { 328881, 9, 3283 },
+    { 328957, 9, 3284 },
+    { 329033, 9, 3285 },
+    { 329112, 9, 3286 },
+    { 329188, 9, 3287 },
+    { 329264, 9, 3288 },
+    { 329340, 9, 3289 },
+    { 329417, 9, 3290 },
+    { 329494, 9, 3291 },
+    { 329571, 9, 3292 },
+    { 329648, 9, 3293 },
+    { 329725, 9, 3294 },
+    { 329802, 9, 3295 },
+    { 330096, 2, ROM_SPAN_ROW },
+    { 330588, 9, 3440 },
+    { 330669, 9, 3441 },
+    { 330750, 9, 3442 },
+    { 330835, 9, 3443 },
+    { 330920, 9, 3444 },
+    { 330997, 9, 3445 },
+    { 331074, 9, 3446 },
+    { 331149, 9, 3447 },
+    { 331229, 9, 3448 },
+    { 331306, 9, 3449 },
+    { 331390, 9, 3450 },
+    { 331472, 9, 3451 },
+    { 331553, 9, 3452 },
+    { 331630, 9, 3453 },
+    { 331716, 9, 3454 },
+    { 331800, 9, 3455 },
+    { 332109, 2, ROM_SPAN_ROW },
+    { 332601, 9, 3312 },
+    { 332682, 9, 3313 },
+    { 332763, 9, 3314 },
+    { 332848, 9, 3315 },
+    { 332933, 9, 3316 },
+    { 333010, 9, 3317 },
+    { 333087, 9, 3318 },
+    { 333162, 9, 3319 },
+    { 333242, 9, 3320 },
+    { 333319, 9, 3321 },
+    { 333403, 9, 3322 },
+    { 333485, 9, 3323 },
+    { 333566, 9, 3324 },
+    { 333643, 9, 3325 },
+    { 333729, 9, 3326 },
+    { 333813, 9, 3327 },
+    { 334088, 9, 3584 },
+    { 334164, 9, 3585 },
+    { 334240, 9, 3586 },
+    { 334316, 9, 3587 },
+    { 334392, 9, 3588 },
+    { 334468, 9, 3589 },
+    { 334544, 9, 3590 },
+    { 334620, 9, 3591 },
+    { 334696, 9, 3592 },
+    { 334772, 9, 3593 },
+    { 334849, 9, 3594 },
+    { 334926, 9, 3595 },
+    { 335003, 9, 3596 },
+    { 335080, 9, 3597 },
+    { 335157, 9, 3598 },
+    { 335234, 9, 3599 },
+    { 335476, 9, 3456 },
+    { 335552, 9, 3457 },
+    { 335628, 9, 3458 },
+    { 335704, 9, 3459 },
+    { 335780, 9, 3460 },
+    { 335856, 9, 3461 },
+    { 335932, 9, 3462 },
+    { 336008, 9, 3463 },
+    { 336084, 9, 3464 },
+    { 336160, 9, 3465 },
+    { 336237, 9, 3466 },
+    { 336314, 9, 3467 },
+    { 336391, 9, 3468 },
+    { 336468, 9, 3469 },
+    { 336545, 9, 3470 },
+    { 336622, 9, 3471 },
+    { 336857, 9, 3616 },
+    { 336926, 9, 3617 },
+    { 336996, 9, 3618 },
+    { 337069, 9, 3619 },
+    { 337144, 9, 3620 },
+    { 337220, 9, 3621 },
+    { 337293, 9, 3622 },
+    { 337368, 9, 3623 },
+    { 337445, 9, 3624 },
+    { 337520, 9, 3625 },
+    { 337597, 9, 3626 },
+    { 337674, 9, 3627 },
+    { 337746, 9, 3628 },
+    { 337819, 9, 3629 },
+    { 337895, 9, 3630 },
+    { 337977, 9, 3631 },
+    { 338237, 9, 3600 },
+    { 338313, 9, 3601 },
+    { 338389, 9, 3602 },
+    { 338465, 9, 3603 },
+    { 338541, 9, 3604 },
+    { 338617, 9, 3605 },
+    { 338696, 9, 3606 },
+    { 338772, 9, 3607 },
+    { 338848, 9, 3608 },
+    { 338924, 9, 3609 },
+    { 339001, 9, 3610 },
+    { 339078, 9, 3611 },
+    { 339155, 9, 3612 },
+    { 339232, 9, 3613 },
+    { 339309, 9, 3614 },
+    { 339386, 9, 3615 },
+    { 339639, 9, 3488 },
+    { 339708, 9, 3489 },
+    { 339778, 9, 3490 },
+    { 339851, 9, 3491 },
+    { 339926, 9, 3492 },
+    { 340002, 9, 3493 },
+    { 340075, 9, 3494 },
+    { 340150, 9, 3495 },
+    { 340227, 9, 3496 },
+    { 340302, 9, 3497 },
+    { 340379, 9, 3498 },
+    { 340456, 9, 3499 },
+    { 340528, 9, 3500 },
+    { 340601, 9, 3501 },
+    { 340677, 9, 3502 },
+    { 340759, 9, 3503 },
+    { 341019, 9, 3472 },
+    { 341095, 9, 3473 },
+    { 341171, 9, 3474 },
+    { 341247, 9, 3475 },
+    { 341323, 9, 3476 },
+    { 341399, 9, 3477 },
+    { 341478, 9, 3478 },
+    { 341554, 9, 3479 },
+    { 341630, 9, 3480 },
+    { 341706, 9, 3481 },
+    { 341783, 9, 3482 },
+    { 341860, 9, 3483 },
+    { 341937, 9, 3484 },
+    { 342014, 9, 3485 },
+    { 342091, 9, 3486 },
+    { 342168, 9, 3487 },
+    { 342462, 2, ROM_SPAN_ROW },
+    { 342954, 9, 3632 },
+    { 343035, 9, 3633 },
+    { 343116, 9, 3634 },
+    { 343201, 9, 3635 },
+    { 343286, 9, 3636 },
+    { 343363, 9, 3637 },
+    { 343440, 9, 3638 },
+    { 343515, 9, 3639 },
+    { 343595, 9, 3640 },
+    { 343672, 9, 3641 },
+    { 343756, 9, 3642 },
+    { 343838, 9, 3643 },
+    { 343919, 9, 3644 },
+    { 343996, 9, 3645 },
+    { 344082, 9, 3646 },
+    { 344166, 9, 3647 },
+    { 344475, 2, ROM_SPAN_ROW },
+    { 344967, 9, 3504 },
+    { 345048, 9, 3505 },
+    { 345129, 9, 3506 },
+    { 345214, 9, 3507 },
+    { 345299, 9, 3508 },
+    { 345376, 9, 3509 },
+    { 345453, 9, 3510 },
+    { 345528, 9, 3511 },
+    { 345608, 9, 3512 },
+    { 345685, 9, 3513 },
+    { 345769, 9, 3514 },
+    { 345851, 9, 3515 },
+    { 345932, 9, 3516 },
+    { 346009, 9, 3517 },
+    { 346095, 9, 3518 },
+    { 346179, 9, 3519 },
+    { 346454, 9, 3648 },
+    { 346530, 9, 3649 },
+    { 346606, 9, 3650 },
+    { 346682, 9, 3651 },
+    { 346758, 9, 3652 },
+    { 346834, 9, 3653 },
+    { 346910, 9, 3654 },
+    { 346986, 9, 3655 },
+    { 347062, 9, 3656 },
+    { 347138, 9, 3657 },
+    { 347215, 9, 3658 },
+    { 347292, 9, 3659 },
+    { 347369, 9, 3660 },
+    { 347446, 9, 3661 },
+    { 347523, 9, 3662 },
+    { 347600, 9, 3663 },
+    { 347842, 9, 3520 },
+    { 347918, 9, 3521 },
+    { 347994, 9, 3522 },
+    { 348070, 9, 3523 },
+    { 348146, 9, 3524 },
+    { 348222, 9, 3525 },
+    { 348298, 9, 3526 },
+    { 348374, 9, 3527 },
+    { 348450, 9, 3528 },
+    { 348526, 9, 3529 },
+    { 348603, 9, 3530 },
+    { 348680, 9, 3531 },
+    { 348757, 9, 3532 },
+    { 348834, 9, 3533 },
+    { 348911, 9, 3534 },
+    { 348988, 9, 3535 },
+    { 349223, 9, 3680 },
+    { 349292, 9, 3681 },
+    { 349362, 9, 3682 },
+    { 349435, 9, 3683 },
+    { 349510, 9, 3684 },
+    { 349586, 9, 3685 },
+    { 349659, 9, 3686 },
+    { 349734, 9, 3687 },
+    { 349811, 9, 3688 },
+    { 349886, 9, 3689 },
+    { 349963, 9, 3690 },
+    { 350040, 9, 3691 },
+    { 350112, 9, 3692 },
+    { 350185, 9, 3693 },
+    { 350261, 9, 3694 },
+    { 350343, 9, 3695 },
+    { 350603, 9, 3664 },
+    { 350679, 9, 3665 },
+    { 350755, 9, 3666 },
+    { 350831, 9, 3667 },
+    { 350907, 9, 3668 },
+    { 350983, 9, 3669 },
+    { 351062, 9, 3670 },
+    { 351138, 9, 3671 },
+    { 351214, 9, 3672 },
+    { 351290, 9, 3673 },
+    { 351367, 9, 3674 },
+    { 351444, 9, 3675 },
+    { 351521, 9, 3676 },
+    { 351598, 9, 3677 },
+    { 351675, 9, 3678 },
+    { 351752, 9, 3679 },
+    { 352005, 9, 3552 },
+    { 352074, 9, 3553 },
+    { 352144, 9, 3554 },
+    { 352217, 9, 3555 },
+    { 352292, 9, 3556 },
+    { 352368, 9, 3557 },
+    { 352441, 9, 3558 },
+    { 352516, 9, 3559 },
+    { 352593, 9, 3560 },
+    { 352668, 9, 3561 },
+    { 352745, 9, 3562 },
+    { 352822, 9, 3563 },
+    { 352894, 9, 3564 },
+    { 352967, 9, 3565 },
+    { 353043, 9, 3566 },
+    { 353125, 9, 3567 },
+    { 353385, 9, 3536 },
+    { 353461, 9, 3537 },
+    { 353537, 9, 3538 },
+    { 353613, 9, 3539 },
+    { 353689, 9, 3540 },
+    { 353765, 9, 3541 },
+    { 353844, 9, 3542 },
+    { 353920, 9, 3543 },
+    { 353996, 9, 3544 },
+    { 354072, 9, 3545 },
+    { 354149, 9, 3546 },
+    { 354226, 9, 3547 },
+    { 354303, 9, 3548 },
+    { 354380, 9, 3549 },
+    { 354457, 9, 3550 },
+    { 354534, 9, 3551 },
+    { 354828, 2, ROM_SPAN_ROW },
+    { 355320, 9, 3696 },
+    { 355401, 9, 3697 },
+    { 355482, 9, 3698 },
+    { 355567, 9, 3699 },
+    { 355652, 9, 3700 },
+    { 355729, 9, 3701 },
+    { 355806, 9, 3702 },
+    { 355881, 9, 3703 },
+    { 355961, 9, 3704 },
+    { 356038, 9, 3705 },
+    { 356122, 9, 3706 },
+    { 356204, 9, 3707 },
+    { 356285, 9, 3708 },
+    { 356362, 9, 3709 },
+    { 356448, 9, 3710 },
+    { 356532, 9, 3711 },
+    { 356841, 2, ROM_SPAN_ROW },
+    { 357333, 9, 3568 },
+    { 357414, 9, 3569 },
+    { 357495, 9, 3570 },
+    { 357580, 9, 3571 },
+    { 357665, 9, 3572 },
+    { 357742, 9, 3573 },
+    { 357819, 9, 3574 },
+    { 357894, 9, 3575 },
+    { 357974, 9, 3576 },
+    { 358051, 9, 3577 },
+    { 358135, 9, 3578 },
+    { 358217, 9, 3579 },
+    { 358298, 9, 3580 },
+    { 358375, 9, 3581 },
+    { 358461, 9, 3582 },
+    { 358545, 9, 3583 },
+    { 358820, 9, 3840 },
+    { 358896, 9, 3841 },
+    { 358972, 9, 3842 },
+    { 359048, 9, 3843 },
+    { 359124, 9, 3844 },
+    { 359200, 9, 3845 },
+    { 359276, 9, 3846 },
+    { 359352, 9, 3847 },
+    { 359428, 9, 3848 },
+    { 359504, 9, 3849 },
+    { 359581, 9, 3850 },
+    { 359658, 9, 3851 },
+    { 359735, 9, 3852 },
+    { 359812, 9, 3853 },
+    { 359889, 9, 3854 },
+    { 359966, 9, 3855 },
+    { 360208, 9, 3712 },
+    { 360284, 9, 3713 },
+    { 360360, 9, 3714 },
+    { 360436, 9, 3715 },
+    { 360512, 9, 3716 },
+    { 360588, 9, 3717 },
+    { 360664, 9, 3718 },
+    { 360740, 9, 3719 },
+    { 360816, 9, 3720 },
+    { 360892, 9, 3721 },
+    { 360969, 9, 3722 },
+    { 361046, 9, 3723 },
+    { 361123, 9, 3724 },
+    { 361200, 9, 3725 },
+    { 361277, 9, 3726 },
+    { 361354, 9, 3727 },
+    { 361589, 9, 3872 },
+    { 361658, 9, 3873 },
+    { 361728, 9, 3874 },
+    { 361801, 9, 3875 },
+    { 361876, 9, 3876 },
+    { 361952, 9, 3877 },
+    { 362025, 9, 3878 },
+    { 362100, 9, 3879 },
+    { 362177, 9, 3880 },
+    { 362252, 9, 3881 },
+    { 362329, 9, 3882 },
+    { 362406, 9, 3883 },
+    { 362478, 9, 3884 },
+    { 362551, 9, 3885 },
+    { 362627, 9, 3886 },
+    { 362709, 9, 3887 },
+    { 362969, 9, 3856 },
+    { 363045, 9, 3857 },
+    { 363121, 9, 3858 },
+    { 363197, 9, 3859 },
+    { 363273, 9, 3860 },
+    { 363349, 9, 3861 },
+    { 363428, 9, 3862 },
+    { 363504, 9, 3863 },
+    { 363580, 9, 3864 },
+    { 363656, 9, 3865 },
+    { 363733, 9, 3866 },
+    { 363810, 9, 3867 },
+    { 363887, 9, 3868 },
+    { 363964, 9, 3869 },
+    { 364041, 9, 3870 },
+    { 364118, 9, 3871 },
+    { 364371, 9, 3744 },
+    { 364440, 9, 3745 },
+    { 364510, 9, 3746 },
+    { 364583, 9, 3747 },
+    { 364658, 9, 3748 },
+    { 364734, 9, 3749 },
+    { 364807, 9, 3750 },
+    { 364882, 9, 3751 },
+    { 364959, 9, 3752 },
+    { 365034, 9, 3753 },
+    { 365111, 9, 3754 },
+    { 365188, 9, 3755 },
+    { 365260, 9, 3756 },
+    { 365333, 9, 3757 },
+    { 365409, 9, 3758 },
+    { 365491, 9, 3759 },
+    { 365751, 9, 3728 },
+    { 365827, 9, 3729 },
+    { 365903, 9, 3730 },
+    { 365979, 9, 3731 },
+    { 366055, 9, 3732 },
+    { 366131, 9, 3733 },
+    { 366210, 9, 3734 },
+    { 366286, 9, 3735 },
+    { 366362, 9, 3736 },
+    { 366438, 9, 3737 },
+    { 366515, 9, 3738 },
+    { 366592, 9, 3739 },
+    { 366669, 9, 3740 },
+    { 366746, 9, 3741 },
+    { 366823, 9, 3742 },
+    { 366900, 9, 3743 },
+    { 367194, 2, ROM_SPAN_ROW },
+    { 367686, 9, 3888 },
+    { 367767, 9, 3889 },
+    { 367848, 9, 3890 },
+    { 367933, 9, 3891 },
+    { 368018, 9, 3892 },
+    { 368095, 9, 3893 },
+    { 368172, 9, 3894 },
+    { 368247, 9, 3895 },
+    { 368327, 9, 3896 },
+    { 368404, 9, 3897 },
+    { 368488, 9, 3898 },
+    { 368570, 9, 3899 },
+    { 368651, 9, 3900 },
+    { 368728, 9, 3901 },
+    { 368814, 9, 3902 },
+    { 368898, 9, 3903 },
+    { 369207, 2, ROM_SPAN_ROW },
+    { 369699, 9, 3760 },
+    { 369780, 9, 3761 },
+    { 369861, 9, 3762 },
+    { 369946, 9, 3763 },
+    { 370031, 9, 3764 },
+    { 370108, 9, 3765 },
+    { 370185, 9, 3766 },
+    { 370260, 9, 3767 },
+    { 370340, 9, 3768 },
+    { 370417, 9, 3769 },
+    { 370501, 9, 3770 },
+    { 370583, 9, 3771 },
+    { 370664, 9, 3772 },
+    { 370741, 9, 3773 },
+    { 370827, 9, 3774 },
+    { 370911, 9, 3775 },
+    { 371186, 9, 3904 },
+    { 371262, 9, 3905 },
+    { 371338, 9, 3906 },
+    { 371414, 9, 3907 },
+    { 371490, 9, 3908 },
+    { 371566, 9, 3909 },
+    { 371642, 9, 3910 },
+    { 371718, 9, 3911 },
+    { 371794, 9, 3912 },
+    { 371870, 9, 3913 },
+    { 371947, 9, 3914 },
+    { 372024, 9, 3915 },
+    { 372101, 9, 3916 },
+    { 372178, 9, 3917 },
+    { 372255, 9, 3918 },
+    { 372332, 9, 3919 },
+    { 372574, 9, 3776 },
+    { 372650, 9, 3777 },
+    { 372726, 9, 3778 },
+    { 372802, 9, 3779 },
+    { 372878, 9, 3780 },
+    { 372954, 9, 3781 },
+    { 373030, 9, 3782 },
+    { 373106, 9, 3783 },
+    { 373182, 9, 3784 },
+    { 373258, 9, 3785 },
+    { 373335, 9, 3786 },
+    { 373412, 9, 3787 },
+    { 373489, 9, 3788 },
+    { 373566, 9, 3789 },
+    { 373643, 9, 3790 },
+    { 373720, 9, 3791 },
+    { 373955, 9, 3936 },
+    { 374024, 9, 3937 },
+    { 374094, 9, 3938 },
+    { 374167, 9, 3939 },
+    { 374242, 9, 3940 },
+    { 374318, 9, 3941 },
+    { 374391, 9, 3942 },
+    { 374466, 9, 3943 },
+    { 374543, 9, 3944 },
+    { 374618, 9, 3945 },
+    { 374695, 9, 3946 },
+    { 374772, 9, 3947 },
+    { 374844, 9, 3948 },
+    { 374917, 9, 3949 },
+    { 374993, 9, 3950 },
+    { 375075, 9, 3951 },
+    { 375335, 9, 3920 },
+    { 375411, 9, 3921 },
+    { 375487, 9, 3922 },
+    { 375563, 9, 3923 },
+    { 375639, 9, 3924 },
+    { 375715, 9, 3925 },
+    { 375794, 9, 3926 },
+    { 375870, 9, 3927 },
+    { 375946, 9, 3928 },
+    { 376022, 9, 3929 },
+    { 376099, 9, 3930 },
+    { 376176, 9, 3931 },
+    { 376253, 9, 3932 },
+    { 376330, 9, 3933 },
+    { 376407, 9, 3934 },
+    { 376484, 9, 3935 },
+    { 376737, 9, 3808 },
+    { 376806, 9, 3809 },
+    { 376876, 9, 3810 },
+    { 376949, 9, 3811 },
+    { 377024, 9, 3812 },
+    { 377100, 9, 3813 },
+    { 377173, 9, 3814 },
+    { 377248, 9, 3815 },
+    { 377325, 9, 3816 },
+    { 377400, 9, 3817 },
+    { 377477, 9, 3818 },
+    { 377554, 9, 3819 },
+    { 377626, 9, 3820 },
+    { 377699, 9, 3821 },
+    { 377775, 9, 3822 },
+    { 377857, 9, 3823 },
+    { 378117, 9, 3792 },
+    { 378193, 9, 3793 },
+    { 378269, 9, 3794 },
+    { 378345, 9, 3795 },
+    { 378421, 9, 3796 },
+    { 378497, 9, 3797 },
+    { 378576, 9, 3798 },
+    { 378652, 9, 3799 },
+    { 378728, 9, 3800 },
+    { 378804, 9, 3801 },
+    { 378881, 9, 3802 },
+    { 378958, 9, 3803 },
+    { 379035, 9, 3804 },
+    { 379112, 9, 3805 },
+    { 379189, 9, 3806 },
+    { 379266, 9, 3807 },
+    { 379560, 2, ROM_SPAN_ROW },
+    { 380052, 9, 3952 },
+    { 380133, 9, 3953 },
+    { 380214, 9, 3954 },
+    { 380299, 9, 3955 },
+    { 380384, 9, 3956 },
+    { 380461, 9, 3957 },
+    { 380538, 9, 3958 },
+    { 380613, 9, 3959 },
+    { 380693, 9, 3960 },
+    { 380770, 9, 3961 },
+    { 380854, 9, 3962 },
+    { 380936, 9, 3963 },
+    { 381017, 9, 3964 },
+    { 381094, 9, 3965 },
+    { 381180, 9, 3966 },
+    { 381264, 9, 3967 },
+    { 381573, 2, ROM_SPAN_ROW },
+    { 382065, 9, 3824 },
+    { 382146, 9, 3825 },
+    { 382227, 9, 3826 },
+    { 382312, 9, 3827 },
+    { 382397, 9, 3828 },
+    { 382474, 9, 3829 },
+    { 382551, 9, 3830 },
+    { 382626, 9, 3831 },
+    { 382706, 9, 3832 },
+    { 382783, 9, 3833 },
+    { 382867, 9, 3834 },
+    { 382949, 9, 3835 },
+    { 383030, 9, 3836 },
+    { 383107, 9, 3837 },
+    { 383193, 9, 3838 },
+    { 383277, 9, 3839 },
+    { 383552, 9, 3968 },
+    { 383628, 9, 3969 },
+    { 383704, 9, 3970 },
+    { 383780, 9, 3971 },
+    { 383856, 9, 3972 },
+    { 383932, 9, 3973 },
+    { 384008, 9, 3974 },
+    { 384084, 9, 3975 },
+    { 384160, 9, 3976 },
+    { 384236, 9, 3977 },
+    { 384313, 9, 3978 },
+    { 384390, 9, 3979 },
+    { 384467, 9, 3980 },
+    { 384544, 9, 3981 },
+    { 384621, 9, 3982 },
+    { 384698, 9, 3983 },
+    { 384933, 9, 4000 },
+    { 385002, 9, 4001 },
+    { 385072, 9, 4002 },
+    { 385145, 9, 4003 },
+    { 385220, 9, 4004 },
+    { 385296, 9, 4005 },
+    { 385369, 9, 4006 },
+    { 385444, 9, 4007 },
+    { 385521, 9, 4008 },
+    { 385596, 9, 4009 },
+    { 385673, 9, 4010 },
+    { 385750, 9, 4011 },
+    { 385822, 9, 4012 },
+    { 385895, 9, 4013 },
+    { 385971, 9, 4014 },
+    { 386053, 9, 4015 },
+    { 386313, 9, 3984 },
+    { 386389, 9, 3985 },
+    { 386465, 9, 3986 },
+    { 386541, 9, 3987 },
+    { 386617, 9, 3988 },
+    { 386693, 9, 3989 },
+    { 386772, 9, 3990 },
+    { 386848, 9, 3991 },
+    { 386924, 9, 3992 },
+    { 387000, 9, 3993 },
+    { 387077, 9, 3994 },
+    { 387154, 9, 3995 },
+    { 387231, 9, 3996 },
+    { 387308, 9, 3997 },
+    { 387385, 9, 3998 },
+    { 387462, 9, 3999 },
+    { 387756, 2, ROM_SPAN_ROW },
+    { 388182, 9, 4016 },
+    { 388263, 9, 4017 },
+    { 388344, 9, 4018 },
+    { 388429, 9, 4019 },
+    { 388514, 9, 4020 },
+    { 388591, 9, 4021 },
+    { 388668, 9, 4022 },
+    { 388743, 9, 4023 },
+    { 388823, 9, 4024 },
+    { 388900, 9, 4025 },
+    { 388984, 9, 4026 },
+    { 389066, 9, 4027 },
+    { 389147, 9, 4028 },
+    { 389224, 9, 4029 },
+    { 389310, 9, 4030 },
+    { 389394, 9, 4031 },
+    { 389669, 9, 4032 },
+    { 389745, 9, 4033 },
+    { 389821, 9, 4034 },
+    { 389897, 9, 4035 },
+    { 389973, 9, 4036 },
+    { 390049, 9, 4037 },
+    { 390125, 9, 4038 },
+    { 390201, 9, 4039 },
+    { 390277, 9, 4040 },
+    { 390353, 9, 4041 },
+    { 390430, 9, 4042 },
+    { 390507, 9, 4043 },
+    { 390584, 9, 4044 },
+    { 390661, 9, 4045 },
+    { 390738, 9, 4046 },
+    { 390815, 9, 4047 },
+    { 391050, 9, 4064 },
+    { 391119, 9, 4065 },
+    { 391189, 9, 4066 },
+    { 391262, 9, 4067 },
+    { 391337, 9, 4068 },
+    { 391413, 9, 4069 },
+    { 391486, 9, 4070 },
+    { 391561, 9, 4071 },
+    { 391638, 9, 4072 },
+    { 391713, 9, 4073 },
+    { 391790, 9, 4074 },
+    { 391867, 9, 4075 },
+    { 391939, 9, 4076 },
+    { 392012, 9, 4077 },
+    { 392088, 9, 4078 },
+    { 392170, 9, 4079 },
+    { 392430, 9, 4048 },
+    { 392506, 9, 4049 },
+    { 392582, 9, 4050 },
+    { 392658, 9, 4051 },
+    { 392734, 9, 4052 },
+    { 392810, 9, 4053 },
+    { 392889, 9, 4054 },
+    { 392965, 9, 4055 },
+    { 393041, 9, 4056 },
+    { 393117, 9, 4057 },
+    { 393194, 9, 4058 },
+    { 393271, 9, 4059 },
+    { 393348, 9, 4060 },
+    { 393425, 9, 4061 },
+    { 393502, 9, 4062 },
+    { 393579, 9, 4063 },
+    { 393873, 2, ROM_SPAN_ROW },
+    { 394299, 9, 4080 },
+    { 394380, 9, 4081 },
+    { 394461, 9, 4082 },
+    { 394546, 9, 4083 },
+    { 394631, 9, 4084 },
+    { 394708, 9, 4085 },
+    { 394785, 9, 4086 },
+    { 394860, 9, 4087 },
+    { 394940, 9, 4088 },
+    { 395017, 9, 4089 },
+    { 395101, 9, 4090 },
+    { 395183, 9, 4091 },
+    { 395264, 9, 4092 },
+    { 395341, 9, 4093 },
+    { 395427, 9, 4094 },
+    { 395511, 9, 4095 },
+    { 395646, 12, ROM_SPAN_NAME },
+};
+
+static const char rom_11_json[] =
+    "{\"blueprint\":{\"description\":\"64-value ROM with decimal(0xFF000000 + i) as a placeholder value for the ith word.\\\\"
+    "n\\\\nFor programming with outside tools.\",\"icons\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"index\""
+    ":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-R\"},\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"index\":4}],\"entities\":[{\"entity_n"
+    "umber\":1,\"name\":\"constant-combinator\",\"position\":{\"x\":-41.5,\"y\":-107.5},\"direction\":4,\"control_behavior\":"
+    "{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"count\":0,\"index\":1}]},\"connections\":{\""
+    "1\":{\"green\":[{\"entity_id\":6,\"circuit_id\":1}]}}},{\"entity_number\":2,\"name\":\"constant-combinator\",\"position\""
+    ":{\"x\":-44.5,\"y\":-104.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},"
+    "\"count\":-16777200,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16777199,\"index\":"
+    "2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16777198,\"index\":3},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-J\"},\"count\":-16777197,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},"
+    "\"count\":-16777196,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16777195,\"index\":"
+    "6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16777194,\"index\":7},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-N\"},\"count\":-16777193,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\""
+    "},\"count\":-16777192,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16777191,\"index\""
+    ":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16777190,\"index\":11},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-R\"},\"count\":-16777189,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S"
+    "\"},\"count\":-16777188,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16777187,\"ind"
+    "ex\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16777186,\"index\":15},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-V\"},\"count\":-16777185,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":"
+    "3},{\"entity_id\":5}]}}},{\"entity_number\":3,\"name\":\"constant-combinator\",\"position\":{\"x\":-45.5,\"y\":-104.5},\""
+    "control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16777216,\"index\":"
+    "1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16777215,\"index\":2},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-2\"},\"count\":-16777214,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},"
+    "\"count\":-16777213,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16777212,\"index\":"
+    "5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16777211,\"index\":6},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-6\"},\"count\":-16777210,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},"
+    "\"count\":-16777209,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16777208,\"index\":"
+    "9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16777207,\"index\":10},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-A\"},\"count\":-16777206,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\""
+    "},\"count\":-16777205,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16777204,\"index"
+    "\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16777203,\"index\":14},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-E\"},\"count\":-16777202,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-F\"},\"count\":-16777201,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":2}]}}},{\"entity_number\":4,\""
+    "name\":\"constant-combinator\",\"position\":{\"x\":-42.5,\"y\":-104.5},\"control_behavior\":{\"filters\":[{\"signal\":{\""
+    "type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16777168,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"light-oil-barrel\"},\"count\":-16777167,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"c"
+    "ount\":-16777166,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16777165,\"in"
+    "dex\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16777164,\"index\":5},{\"signal\":"
+    "{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16777163,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "copper-cable\"},\"count\":-16777162,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-1677"
+    "7161,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16777160,\"index\":9},{\"signa"
+    "l\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16777159,\"index\":10},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"electronic-circuit\"},\"count\":-16777158,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit"
+    "\"},\"count\":-16777157,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16777156,\""
+    "index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16777155,\"index\":14},{\"signal\":{\"ty"
+    "pe\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16777154,\"index\":15},{\"signal\":{\"type\":\"item\",\"name"
+    "\":\"flying-robot-frame\"},\"count\":-16777153,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":5},{\"ent"
+    "ity_id\":6,\"circuit_id\":1}]}}},{\"entity_number\":5,\"name\":\"constant-combinator\",\"position\":{\"x\":-43.5,\"y\":-"
+    "104.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16777184,\"index\""
+    ":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16777183,\"index\":2},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"stone\"},\"count\":-16777182,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-1677"
+    "7181,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16777180,\"index\":5},{\"signal\":{"
+    "\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16777179,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"r"
+    "aw-fish\"},\"count\":-16777178,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16777177,"
+    "\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16777176,\"index\":9},{\"signal\":{\"t"
+    "ype\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16777175,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"stee"
+    "l-plate\"},\"count\":-16777174,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-1677717"
+    "3,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16777172,\"index\":13},{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"battery\"},\"count\":-16777171,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosive"
+    "s\"},\"count\":-16777170,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16777169"
+    ",\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":2},{\"entity_id\":4}]}}},{\"entity_number\":6,\"name\":"
+    "\"decider-combinator\",\"position\":{\"x\":-41,\"y\":-104.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\""
+    ":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":0,\"comparator\":\"=\",\"output_signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":"
+    "[{\"entity_id\":4}],\"green\":[{\"entity_id\":1},{\"entity_id\":11,\"circuit_id\":1},{\"entity_id\":24,\"circuit_id\":1}"
+    "]},\"2\":{\"red\":[{\"entity_id\":11,\"circuit_id\":2},{\"entity_id\":24,\"circuit_id\":2}]}}},{\"entity_number\":7,\"na"
+    "me\":\"constant-combinator\",\"position\":{\"x\":-39.5,\"y\":-104.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16777152,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-1\"},\"count\":-16777151,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16777150"
+    ",\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16777149,\"index\":4},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16777148,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-5\"},\"count\":-16777147,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16777146"
+    ",\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16777145,\"index\":8},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16777144,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-9\"},\"count\":-16777143,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-1677714"
+    "2,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16777141,\"index\":12},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16777140,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-D\"},\"count\":-16777139,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-167"
+    "77138,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16777137,\"index\":16}]},\"conne"
+    "ctions\":{\"1\":{\"red\":[{\"entity_id\":8}]}}},{\"entity_number\":8,\"name\":\"constant-combinator\",\"position\":{\"x\""
+    ":-38.5,\"y\":-104.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count"
+    "\":-16777136,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16777135,\"index\":2},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16777134,\"index\":3},{\"signal\":{\"type\":\"virtual\","
+    "\"name\":\"signal-J\"},\"count\":-16777133,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count"
+    "\":-16777132,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16777131,\"index\":6},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16777130,\"index\":7},{\"signal\":{\"type\":\"virtual"
+    "\",\"name\":\"signal-N\"},\"count\":-16777129,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"co"
+    "unt\":-16777128,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16777127,\"index\":10},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16777126,\"index\":11},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-R\"},\"count\":-16777125,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\""
+    "count\":-16777124,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16777123,\"index\":1"
+    "4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16777122,\"index\":15},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-V\"},\"count\":-16777121,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":7},{\""
+    "entity_id\":9}]}}},{\"entity_number\":9,\"name\":\"constant-combinator\",\"position\":{\"x\":-37.5,\"y\":-104.5},\"contr"
+    "ol_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16777120,\"index\":1},{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16777119,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"ston"
+    "e\"},\"count\":-16777118,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16777117,\"index\""
+    ":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16777116,\"index\":5},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"uranium-ore\"},\"count\":-16777115,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"c"
+    "ount\":-16777114,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16777113,\"index\":8},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16777112,\"index\":9},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"solid-fuel\"},\"count\":-16777111,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"c"
+    "ount\":-16777110,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16777109,\"index\":12"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16777108,\"index\":13},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"battery\"},\"count\":-16777107,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":"
+    "-16777106,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16777105,\"index\":16}]"
+    "},\"connections\":{\"1\":{\"red\":[{\"entity_id\":8},{\"entity_id\":10}]}}},{\"entity_number\":10,\"name\":\"constant-co"
+    "mbinator\",\"position\":{\"x\":-36.5,\"y\":-104.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"n"
+    "ame\":\"heavy-oil-barrel\"},\"count\":-16777104,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\""
+    "},\"count\":-16777103,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16777102,\"i"
+    "ndex\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16777101,\"index\":4},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16777100,\"index\":5},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"water-barrel\"},\"count\":-16777099,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"co"
+    "unt\":-16777098,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16777097,\"index\":8},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16777096,\"index\":9},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"empty-barrel\"},\"count\":-16777095,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circu"
+    "it\"},\"count\":-16777094,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-1677709"
+    "3,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16777092,\"index\":13},{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16777091,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"electric-engine-unit\"},\"count\":-16777090,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-fram"
+    "e\"},\"count\":-16777089,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":9},{\"entity_id\":11,\"circuit_"
+    "id\":1}]}}},{\"entity_number\":11,\"name\":\"decider-combinator\",\"position\":{\"x\":-35,\"y\":-104.5},\"direction\":2,"
+    "\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"consta"
+    "nt\":1,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_in"
+    "put\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":10}],\"green\":[{\"entity_id\":6,\"circuit_id\":1},{\"entit"
+    "y_id\":34,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":6,\"circuit_id\":2},{\"entity_id\":13,\"circuit_id\":1},{\""
+    "entity_id\":34,\"circuit_id\":2}]}}},{\"entity_number\":12,\"name\":\"arithmetic-combinator\",\"position\":{\"x\":-33,\""
+    "y\":-104.5},\"direction\":2,\"control_behavior\":{\"arithmetic_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-check\"},\"second_constant\":-1,\"operation\":\"*\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"sig"
+    "nal-check\"}}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":13,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":13,"
+    "\"circuit_id\":2}]}}},{\"entity_number\":13,\"name\":\"arithmetic-combinator\",\"position\":{\"x\":-33,\"y\":-105.5},\"d"
+    "irection\":2,\"control_behavior\":{\"arithmetic_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-e"
+    "ach\"},\"second_constant\":0,\"operation\":\"+\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-each\"}}},\"c"
+    "onnections\":{\"1\":{\"red\":[{\"entity_id\":12,\"circuit_id\":1},{\"entity_id\":11,\"circuit_id\":2}]},\"2\":{\"red\":["
+    "{\"entity_id\":12,\"circuit_id\":2},{\"entity_id\":14}]}}},{\"entity_number\":14,\"name\":\"medium-electric-pole\",\"pos"
+    "ition\":{\"x\":-31.5,\"y\":-104.5},\"connections\":{\"1\":{\"red\":[{\"entity_id\":13,\"circuit_id\":2}]}}},{\"entity_nu"
+    "mber\":15,\"name\":\"constant-combinator\",\"position\":{\"x\":-45.5,\"y\":-102.5},\"control_behavior\":{\"filters\":[{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16776960,\"index\":1},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-1\"},\"count\":-16776959,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"coun"
+    "t\":-16776958,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16776957,\"index\":4},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16776956,\"index\":5},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-5\"},\"count\":-16776955,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"coun"
+    "t\":-16776954,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16776953,\"index\":8},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16776952,\"index\":9},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-9\"},\"count\":-16776951,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"cou"
+    "nt\":-16776950,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16776949,\"index\":12},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16776948,\"index\":13},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-D\"},\"count\":-16776947,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\""
+    "count\":-16776946,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16776945,\"index\":1"
+    "6}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":16}]}}},{\"entity_number\":16,\"name\":\"constant-combinator\",\"po"
+    "sition\":{\"x\":-44.5,\"y\":-102.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-G\"},\"count\":-16776944,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16776943,\""
+    "index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16776942,\"index\":3},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16776941,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-K\"},\"count\":-16776940,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16776939,\""
+    "index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16776938,\"index\":7},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16776937,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-O\"},\"count\":-16776936,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16776935"
+    ",\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16776934,\"index\":11},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16776933,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-S\"},\"count\":-16776932,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-167769"
+    "31,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16776930,\"index\":15},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16776929,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"ent"
+    "ity_id\":15},{\"entity_id\":19}]}}},{\"entity_number\":17,\"name\":\"constant-combinator\",\"position\":{\"x\":-44.5,\"y"
+    "\":-103.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-167770"
+    "72,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16777071,\"index\":2},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16777070,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-J\"},\"count\":-16777069,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-1677706"
+    "8,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16777067,\"index\":6},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16777066,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-N\"},\"count\":-16777065,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-1677"
+    "7064,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16777063,\"index\":10},{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16777062,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name"
+    "\":\"signal-R\"},\"count\":-16777061,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-1"
+    "6777060,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16777059,\"index\":14},{\"sign"
+    "al\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16777058,\"index\":15},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-V\"},\"count\":-16777057,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":18},{\"entity_i"
+    "d\":22}]}}},{\"entity_number\":18,\"name\":\"constant-combinator\",\"position\":{\"x\":-45.5,\"y\":-103.5},\"control_beh"
+    "avior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16777088,\"index\":1},{\"signa"
+    "l\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16777087,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-2\"},\"count\":-16777086,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-"
+    "16777085,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16777084,\"index\":5},{\"signa"
+    "l\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16777083,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-6\"},\"count\":-16777082,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-"
+    "16777081,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16777080,\"index\":9},{\"signa"
+    "l\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16777079,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"n"
+    "ame\":\"signal-A\"},\"count\":-16777078,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\""
+    ":-16777077,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16777076,\"index\":13},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16777075,\"index\":14},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-E\"},\"count\":-16777074,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"cou"
+    "nt\":-16777073,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":17}]}}},{\"entity_number\":19,\"name\":\""
+    "constant-combinator\",\"position\":{\"x\":-43.5,\"y\":-102.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\""
+    "item\",\"name\":\"wood\"},\"count\":-16776928,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-"
+    "16776927,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16776926,\"index\":3},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16776925,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper"
+    "-ore\"},\"count\":-16776924,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16776923,\""
+    "index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16776922,\"index\":7},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"iron-plate\"},\"count\":-16776921,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plat"
+    "e\"},\"count\":-16776920,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16776919,\"inde"
+    "x\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16776918,\"index\":11},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"plastic-bar\"},\"count\":-16776917,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\""
+    "},\"count\":-16776916,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16776915,\"index\":1"
+    "4},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16776914,\"index\":15},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"crude-oil-barrel\"},\"count\":-16776913,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":1"
+    "6},{\"entity_id\":20}]}}},{\"entity_number\":20,\"name\":\"constant-combinator\",\"position\":{\"x\":-42.5,\"y\":-102.5}"
+    ",\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16776912,\""
+    "index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16776911,\"index\":2},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16776910,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"petroleum-gas-barrel\"},\"count\":-16776909,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barre"
+    "l\"},\"count\":-16776908,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16776907,\"in"
+    "dex\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16776906,\"index\":7},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"iron-stick\"},\"count\":-16776905,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-"
+    "wheel\"},\"count\":-16776904,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16776903,"
+    "\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16776902,\"index\":11},{\"signa"
+    "l\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16776901,\"index\":12},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"processing-unit\"},\"count\":-16776900,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\""
+    "count\":-16776899,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16776898,\""
+    "index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16776897,\"index\":16}]},\"connec"
+    "tions\":{\"1\":{\"red\":[{\"entity_id\":19},{\"entity_id\":23,\"circuit_id\":1}]}}},{\"entity_number\":21,\"name\":\"con"
+    "stant-combinator\",\"position\":{\"x\":-42.5,\"y\":-103.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"it"
+    "em\",\"name\":\"heavy-oil-barrel\"},\"count\":-16777040,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil"
+    "-barrel\"},\"count\":-16777039,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-167"
+    "77038,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16777037,\"index\":4},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16777036,\"index\":5},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"water-barrel\"},\"count\":-16777035,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cabl"
+    "e\"},\"count\":-16777034,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16777033,\"inde"
+    "x\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16777032,\"index\":9},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16777031,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"elect"
+    "ronic-circuit\"},\"count\":-16777030,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count"
+    "\":-16777029,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16777028,\"index\":13"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16777027,\"index\":14},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"electric-engine-unit\"},\"count\":-16777026,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flyin"
+    "g-robot-frame\"},\"count\":-16777025,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":22},{\"entity_id\":"
+    "24,\"circuit_id\":1}]}}},{\"entity_number\":22,\"name\":\"constant-combinator\",\"position\":{\"x\":-43.5,\"y\":-103.5},"
+    "\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16777056,\"index\":1},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16777055,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"stone\"},\"count\":-16777054,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16777053,\""
+    "index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16777052,\"index\":5},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"uranium-ore\"},\"count\":-16777051,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\""
+    "},\"count\":-16777050,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16777049,\"index\""
+    ":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16777048,\"index\":9},{\"signal\":{\"type\":\"i"
+    "tem\",\"name\":\"solid-fuel\"},\"count\":-16777047,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\""
+    "},\"count\":-16777046,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16777045,\"index"
+    "\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16777044,\"index\":13},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"battery\"},\"count\":-16777043,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"co"
+    "unt\":-16777042,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16777041,\"index\""
+    ":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":17},{\"entity_id\":21}]}}},{\"entity_number\":23,\"name\":\"decid"
+    "er-combinator\",\"position\":{\"x\":-41,\"y\":-102.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"fi"
+    "rst_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":4,\"comparator\":\"=\",\"output_signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"e"
+    "ntity_id\":20}],\"green\":[{\"entity_id\":24,\"circuit_id\":1},{\"entity_id\":44,\"circuit_id\":1}]},\"2\":{\"red\":[{\""
+    "entity_id\":24,\"circuit_id\":2},{\"entity_id\":44,\"circuit_id\":2}]}}},{\"entity_number\":24,\"name\":\"decider-combin"
+    "ator\",\"position\":{\"x\":-41,\"y\":-103.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signa"
+    "l\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":2,\"comparator\":\"=\",\"output_signal\":{\"type\":\"v"
+    "irtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\""
+    ":21}],\"green\":[{\"entity_id\":6,\"circuit_id\":1},{\"entity_id\":23,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\""
+    ":6,\"circuit_id\":2},{\"entity_id\":23,\"circuit_id\":2}]}}},{\"entity_number\":25,\"name\":\"constant-combinator\",\"po"
+    "sition\":{\"x\":-38.5,\"y\":-102.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-G\"},\"count\":-16776880,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16776879,\""
+    "index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16776878,\"index\":3},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16776877,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-K\"},\"count\":-16776876,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16776875,\""
+    "index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16776874,\"index\":7},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16776873,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-O\"},\"count\":-16776872,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16776871"
+    ",\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16776870,\"index\":11},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16776869,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-S\"},\"count\":-16776868,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-167768"
+    "67,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16776866,\"index\":15},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16776865,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"ent"
+    "ity_id\":26},{\"entity_id\":30}]}}},{\"entity_number\":26,\"name\":\"constant-combinator\",\"position\":{\"x\":-39.5,\"y"
+    "\":-102.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-167768"
+    "96,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16776895,\"index\":2},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16776894,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-3\"},\"count\":-16776893,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-1677689"
+    "2,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16776891,\"index\":6},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16776890,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-7\"},\"count\":-16776889,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-1677688"
+    "8,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16776887,\"index\":10},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16776886,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-B\"},\"count\":-16776885,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-167768"
+    "84,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16776883,\"index\":14},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16776882,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-F\"},\"count\":-16776881,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":25}]}}},{\"entity_num"
+    "ber\":27,\"name\":\"constant-combinator\",\"position\":{\"x\":-39.5,\"y\":-103.5},\"control_behavior\":{\"filters\":[{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16777024,\"index\":1},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-1\"},\"count\":-16777023,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"coun"
+    "t\":-16777022,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16777021,\"index\":4},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16777020,\"index\":5},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-5\"},\"count\":-16777019,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"coun"
+    "t\":-16777018,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16777017,\"index\":8},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16777016,\"index\":9},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-9\"},\"count\":-16777015,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"cou"
+    "nt\":-16777014,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16777013,\"index\":12},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16777012,\"index\":13},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-D\"},\"count\":-16777011,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\""
+    "count\":-16777010,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16777009,\"index\":1"
+    "6}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":28}]}}},{\"entity_number\":28,\"name\":\"constant-combinator\",\"po"
+    "sition\":{\"x\":-38.5,\"y\":-103.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-G\"},\"count\":-16777008,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16777007,\""
+    "index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16777006,\"index\":3},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16777005,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-K\"},\"count\":-16777004,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16777003,\""
+    "index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16777002,\"index\":7},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16777001,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-O\"},\"count\":-16777000,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16776999"
+    ",\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16776998,\"index\":11},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16776997,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-S\"},\"count\":-16776996,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-167769"
+    "95,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16776994,\"index\":15},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16776993,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"ent"
+    "ity_id\":27},{\"entity_id\":31}]}}},{\"entity_number\":29,\"name\":\"constant-combinator\",\"position\":{\"x\":-36.5,\"y"
+    "\":-102.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-1"
+    "6776848,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16776847,\"index\":2},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16776846,\"index\":3},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"petroleum-gas-barrel\"},\"count\":-16776845,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-"
+    "acid-barrel\"},\"count\":-16776844,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-167"
+    "76843,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16776842,\"index\":7},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16776841,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "iron-gear-wheel\"},\"count\":-16776840,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":"
+    "-16776839,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16776838,\"index\":11"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16776837,\"index\":12},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"processing-unit\"},\"count\":-16776836,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engin"
+    "e-unit\"},\"count\":-16776835,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":"
+    "-16776834,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16776833,\"index\":16"
+    "}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":30},{\"entity_id\":33,\"circuit_id\":1}]}}},{\"entity_number\":30,\""
+    "name\":\"constant-combinator\",\"position\":{\"x\":-37.5,\"y\":-102.5},\"control_behavior\":{\"filters\":[{\"signal\":{\""
+    "type\":\"item\",\"name\":\"wood\"},\"count\":-16776864,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\""
+    "count\":-16776863,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16776862,\"index\":3},{\"si"
+    "gnal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16776861,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"copper-ore\"},\"count\":-16776860,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16"
+    "776859,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16776858,\"index\":7},{\"signal\":{"
+    "\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16776857,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"co"
+    "pper-plate\"},\"count\":-16776856,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-167768"
+    "55,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16776854,\"index\":11},{\"signal\":"
+    "{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16776853,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "sulfur\"},\"count\":-16776852,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16776851,\"i"
+    "ndex\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16776850,\"index\":15},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16776849,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entit"
+    "y_id\":25},{\"entity_id\":29}]}}},{\"entity_number\":31,\"name\":\"constant-combinator\",\"position\":{\"x\":-37.5,\"y\""
+    ":-103.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16776992,\"inde"
+    "x\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16776991,\"index\":2},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"stone\"},\"count\":-16776990,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-1"
+    "6776989,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16776988,\"index\":5},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16776987,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "raw-fish\"},\"count\":-16776986,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16776985"
+    ",\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16776984,\"index\":9},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16776983,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"ste"
+    "el-plate\"},\"count\":-16776982,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-167769"
+    "81,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16776980,\"index\":13},{\"signal\":{\"ty"
+    "pe\":\"item\",\"name\":\"battery\"},\"count\":-16776979,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosiv"
+    "es\"},\"count\":-16776978,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-1677697"
+    "7,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":28},{\"entity_id\":32}]}}},{\"entity_number\":32,\"nam"
+    "e\":\"constant-combinator\",\"position\":{\"x\":-36.5,\"y\":-103.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"ty"
+    "pe\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16776976,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "light-oil-barrel\"},\"count\":-16776975,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"cou"
+    "nt\":-16776974,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16776973,\"inde"
+    "x\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16776972,\"index\":5},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16776971,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"co"
+    "pper-cable\"},\"count\":-16776970,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-167769"
+    "69,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16776968,\"index\":9},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16776967,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"electronic-circuit\"},\"count\":-16776966,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"}"
+    ",\"count\":-16776965,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16776964,\"in"
+    "dex\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16776963,\"index\":14},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16776962,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"flying-robot-frame\"},\"count\":-16776961,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":31},{\"enti"
+    "ty_id\":34,\"circuit_id\":1}]}}},{\"entity_number\":33,\"name\":\"decider-combinator\",\"position\":{\"x\":-35,\"y\":-10"
+    "2.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"sig"
+    "nal-check\"},\"constant\":5,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"}"
+    ",\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":29}],\"green\":[{\"entity_id\":34,\"ci"
+    "rcuit_id\":1},{\"entity_id\":54,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":34,\"circuit_id\":2},{\"entity_id\":5"
+    "4,\"circuit_id\":2}]}}},{\"entity_number\":34,\"name\":\"decider-combinator\",\"position\":{\"x\":-35,\"y\":-103.5},\"di"
+    "rection\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check"
+    "\"},\"constant\":3,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_c"
+    "ount_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":32}],\"green\":[{\"entity_id\":11,\"circuit_id\""
+    ":1},{\"entity_id\":33,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":11,\"circuit_id\":2},{\"entity_id\":33,\"circui"
+    "t_id\":2}]}}},{\"entity_number\":35,\"name\":\"constant-combinator\",\"position\":{\"x\":-45.5,\"y\":-100.5},\"control_b"
+    "ehavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16776704,\"index\":1},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16776703,\"index\":2},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-2\"},\"count\":-16776702,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\""
+    ":-16776701,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16776700,\"index\":5},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16776699,\"index\":6},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-6\"},\"count\":-16776698,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\""
+    ":-16776697,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16776696,\"index\":9},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16776695,\"index\":10},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-A\"},\"count\":-16776694,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\""
+    ":-16776693,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16776692,\"index\":13},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16776691,\"index\":14},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-E\"},\"count\":-16776690,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"cou"
+    "nt\":-16776689,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":36}]}}},{\"entity_number\":36,\"name\":\""
+    "constant-combinator\",\"position\":{\"x\":-44.5,\"y\":-100.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-G\"},\"count\":-16776688,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\""
+    "},\"count\":-16776687,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16776686,\"index\""
+    ":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16776685,\"index\":4},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-K\"},\"count\":-16776684,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"}"
+    ",\"count\":-16776683,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16776682,\"inde"
+    "x\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16776681,\"index\":8},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-O\"},\"count\":-16776680,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\""
+    "},\"count\":-16776679,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16776678,\"index"
+    "\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16776677,\"index\":12},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-S\"},\"count\":-16776676,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-T\"},\"count\":-16776675,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16776674,\"i"
+    "ndex\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16776673,\"index\":16}]},\"connections\":"
+    "{\"1\":{\"red\":[{\"entity_id\":35},{\"entity_id\":39}]}}},{\"entity_number\":37,\"name\":\"constant-combinator\",\"posi"
+    "tion\":{\"x\":-45.5,\"y\":-101.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-0\"},\"count\":-16776832,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16776831,\"in"
+    "dex\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16776830,\"index\":3},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-3\"},\"count\":-16776829,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-4\"},\"count\":-16776828,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16776827,\"in"
+    "dex\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16776826,\"index\":7},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-7\"},\"count\":-16776825,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-8\"},\"count\":-16776824,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16776823,\"in"
+    "dex\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16776822,\"index\":11},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16776821,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"sig"
+    "nal-C\"},\"count\":-16776820,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16776819,"
+    "\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16776818,\"index\":15},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16776817,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity"
+    "_id\":38}]}}},{\"entity_number\":38,\"name\":\"constant-combinator\",\"position\":{\"x\":-44.5,\"y\":-101.5},\"control_b"
+    "ehavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16776816,\"index\":1},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16776815,\"index\":2},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-I\"},\"count\":-16776814,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\""
+    ":-16776813,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16776812,\"index\":5},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16776811,\"index\":6},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-pink\"},\"count\":-16776810,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"coun"
+    "t\":-16776809,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16776808,\"index\":9},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16776807,\"index\":10},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-Q\"},\"count\":-16776806,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"cou"
+    "nt\":-16776805,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16776804,\"index\":13},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16776803,\"index\":14},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-U\"},\"count\":-16776802,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\""
+    "count\":-16776801,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":37},{\"entity_id\":41}]}}},{\"entity_n"
+    "umber\":39,\"name\":\"constant-combinator\",\"position\":{\"x\":-43.5,\"y\":-100.5},\"control_behavior\":{\"filters\":[{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16776672,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"coal\"},\"count\":-16776671,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16776670,\"ind"
+    "ex\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16776669,\"index\":4},{\"signal\":{\"type\":\"i"
+    "tem\",\"name\":\"copper-ore\"},\"count\":-16776668,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"}"
+    ",\"count\":-16776667,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16776666,\"index\":7}"
+    ",{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16776665,\"index\":8},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"copper-plate\"},\"count\":-16776664,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"c"
+    "ount\":-16776663,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16776662,\"index\":11"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16776661,\"index\":12},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"sulfur\"},\"count\":-16776660,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\""
+    ":-16776659,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16776658,\"index\":15},{\"si"
+    "gnal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16776657,\"index\":16}]},\"connections\":{\"1\":{\"r"
+    "ed\":[{\"entity_id\":36},{\"entity_id\":40}]}}},{\"entity_number\":40,\"name\":\"constant-combinator\",\"position\":{\"x"
+    "\":-42.5,\"y\":-100.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},"
+    "\"count\":-16776656,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16776655,\"ind"
+    "ex\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16776654,\"index\":3},{\"signal\":{\"ty"
+    "pe\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16776653,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"sulfuric-acid-barrel\"},\"count\":-16776652,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\""
+    "count\":-16776651,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16776650,\"index\":7"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16776649,\"index\":8},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"iron-gear-wheel\"},\"count\":-16776648,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\""
+    "},\"count\":-16776647,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16776646,"
+    "\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16776645,\"index\":12},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16776644,\"index\":13},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"engine-unit\"},\"count\":-16776643,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"}"
+    ",\"count\":-16776642,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16776641,\""
+    "index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":39},{\"entity_id\":43,\"circuit_id\":1}]}}},{\"entity_numb"
+    "er\":41,\"name\":\"constant-combinator\",\"position\":{\"x\":-43.5,\"y\":-101.5},\"control_behavior\":{\"filters\":[{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16776800,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "coal\"},\"count\":-16776799,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16776798,\"index\""
+    ":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16776797,\"index\":4},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"copper-ore\"},\"count\":-16776796,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"co"
+    "unt\":-16776795,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16776794,\"index\":7},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16776793,\"index\":8},{\"signal\":{\"type\":\"item\",\"na"
+    "me\":\"copper-plate\"},\"count\":-16776792,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\""
+    ":-16776791,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16776790,\"index\":11},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16776789,\"index\":12},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"sulfur\"},\"count\":-16776788,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-167"
+    "76787,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16776786,\"index\":15},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16776785,\"index\":16}]},\"connections\":{\"1\":{\"red\":["
+    "{\"entity_id\":38},{\"entity_id\":42}]}}},{\"entity_number\":42,\"name\":\"constant-combinator\",\"position\":{\"x\":-42"
+    ".5,\"y\":-101.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"coun"
+    "t\":-16776784,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16776783,\"index\":2"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16776782,\"index\":3},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16776781,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sul"
+    "furic-acid-barrel\"},\"count\":-16776780,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\""
+    ":-16776779,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16776778,\"index\":7},{\"si"
+    "gnal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16776777,\"index\":8},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"iron-gear-wheel\"},\"count\":-16776776,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"co"
+    "unt\":-16776775,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16776774,\"inde"
+    "x\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16776773,\"index\":12},{\"signal\":{\"t"
+    "ype\":\"item\",\"name\":\"processing-unit\"},\"count\":-16776772,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "engine-unit\"},\"count\":-16776771,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"cou"
+    "nt\":-16776770,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16776769,\"index"
+    "\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":41},{\"entity_id\":44,\"circuit_id\":1}]}}},{\"entity_number\":"
+    "43,\"name\":\"decider-combinator\",\"position\":{\"x\":-41,\"y\":-100.5},\"direction\":2,\"control_behavior\":{\"decider"
+    "_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":8,\"comparator\":\"=\",\"o"
+    "utput_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\""
+    "1\":{\"red\":[{\"entity_id\":40}],\"green\":[{\"entity_id\":44,\"circuit_id\":1},{\"entity_id\":63,\"circuit_id\":1}]},\""
+    "2\":{\"red\":[{\"entity_id\":44,\"circuit_id\":2},{\"entity_id\":63,\"circuit_id\":2}]}}},{\"entity_number\":44,\"name\""
+    ":\"decider-combinator\",\"position\":{\"x\":-41,\"y\":-101.5},\"direction\":2,\"control_behavior\":{\"decider_conditions"
+    "\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":6,\"comparator\":\"=\",\"output_signa"
+    "l\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red"
+    "\":[{\"entity_id\":42}],\"green\":[{\"entity_id\":23,\"circuit_id\":1},{\"entity_id\":43,\"circuit_id\":1}]},\"2\":{\"re"
+    "d\":[{\"entity_id\":23,\"circuit_id\":2},{\"entity_id\":43,\"circuit_id\":2}]}}},{\"entity_number\":45,\"name\":\"consta"
+    "nt-combinator\",\"position\":{\"x\":-38.5,\"y\":-100.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-G\"},\"count\":-16776624,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\""
+    "count\":-16776623,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16776622,\"index\":3}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16776621,\"index\":4},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-K\"},\"count\":-16776620,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\""
+    "count\":-16776619,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16776618,\"index\""
+    ":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16776617,\"index\":8},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-O\"},\"count\":-16776616,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"}"
+    ",\"count\":-16776615,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16776614,\"index\""
+    ":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16776613,\"index\":12},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-S\"},\"count\":-16776612,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T"
+    "\"},\"count\":-16776611,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16776610,\"ind"
+    "ex\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16776609,\"index\":16}]},\"connections\":{\""
+    "1\":{\"red\":[{\"entity_id\":46},{\"entity_id\":50}]}}},{\"entity_number\":46,\"name\":\"constant-combinator\",\"positio"
+    "n\":{\"x\":-39.5,\"y\":-100.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\""
+    "},\"count\":-16776640,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16776639,\"index\""
+    ":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16776638,\"index\":3},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-3\"},\"count\":-16776637,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"}"
+    ",\"count\":-16776636,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16776635,\"index\""
+    ":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16776634,\"index\":7},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-7\"},\"count\":-16776633,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"}"
+    ",\"count\":-16776632,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16776631,\"index\""
+    ":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16776630,\"index\":11},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-B\"},\"count\":-16776629,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C"
+    "\"},\"count\":-16776628,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16776627,\"ind"
+    "ex\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16776626,\"index\":15},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-F\"},\"count\":-16776625,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":"
+    "45}]}}},{\"entity_number\":47,\"name\":\"constant-combinator\",\"position\":{\"x\":-38.5,\"y\":-101.5},\"control_behavio"
+    "r\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16776752,\"index\":1},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16776751,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-I\"},\"count\":-16776750,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-1677"
+    "6749,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16776748,\"index\":5},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16776747,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-pink\"},\"count\":-16776746,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-1"
+    "6776745,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16776744,\"index\":9},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16776743,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-Q\"},\"count\":-16776742,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":"
+    "-16776741,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16776740,\"index\":13},{\"si"
+    "gnal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16776739,\"index\":14},{\"signal\":{\"type\":\"virtual\","
+    "\"name\":\"signal-U\"},\"count\":-16776738,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"coun"
+    "t\":-16776737,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":48},{\"entity_id\":52}]}}},{\"entity_numbe"
+    "r\":48,\"name\":\"constant-combinator\",\"position\":{\"x\":-39.5,\"y\":-101.5},\"control_behavior\":{\"filters\":[{\"si"
+    "gnal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16776768,\"index\":1},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-1\"},\"count\":-16776767,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\""
+    ":-16776766,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16776765,\"index\":4},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16776764,\"index\":5},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-5\"},\"count\":-16776763,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\""
+    ":-16776762,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16776761,\"index\":8},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16776760,\"index\":9},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-9\"},\"count\":-16776759,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\""
+    ":-16776758,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16776757,\"index\":12},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16776756,\"index\":13},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-D\"},\"count\":-16776755,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"cou"
+    "nt\":-16776754,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16776753,\"index\":16}]"
+    "},\"connections\":{\"1\":{\"red\":[{\"entity_id\":47}]}}},{\"entity_number\":49,\"name\":\"constant-combinator\",\"posit"
+    "ion\":{\"x\":-36.5,\"y\":-100.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-"
+    "barrel\"},\"count\":-16776592,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-1677"
+    "6591,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16776590,\"index\":3},{\"sign"
+    "al\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16776589,\"index\":4},{\"signal\":{\"type\":\"item"
+    "\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16776588,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-b"
+    "arrel\"},\"count\":-16776587,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16776586,"
+    "\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16776585,\"index\":8},{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16776584,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"em"
+    "pty-barrel\"},\"count\":-16776583,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\""
+    ":-16776582,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16776581,\"index\":12}"
+    ",{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16776580,\"index\":13},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"engine-unit\"},\"count\":-16776579,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-en"
+    "gine-unit\"},\"count\":-16776578,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\""
+    ":-16776577,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":50},{\"entity_id\":53,\"circuit_id\":1}]}}},{"
+    "\"entity_number\":50,\"name\":\"constant-combinator\",\"position\":{\"x\":-37.5,\"y\":-100.5},\"control_behavior\":{\"fi"
+    "lters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16776608,\"index\":1},{\"signal\":{\"type\":\"item"
+    "\",\"name\":\"coal\"},\"count\":-16776607,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-167"
+    "76606,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16776605,\"index\":4},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16776604,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uran"
+    "ium-ore\"},\"count\":-16776603,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16776602,\""
+    "index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16776601,\"index\":8},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"copper-plate\"},\"count\":-16776600,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fu"
+    "el\"},\"count\":-16776599,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16776598,\"i"
+    "ndex\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16776597,\"index\":12},{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"sulfur\"},\"count\":-16776596,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"}"
+    ",\"count\":-16776595,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16776594,\"index\""
+    ":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16776593,\"index\":16}]},\"connections\":{"
+    "\"1\":{\"red\":[{\"entity_id\":45},{\"entity_id\":49}]}}},{\"entity_number\":51,\"name\":\"constant-combinator\",\"posit"
+    "ion\":{\"x\":-36.5,\"y\":-101.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-"
+    "barrel\"},\"count\":-16776720,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-1677"
+    "6719,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16776718,\"index\":3},{\"sign"
+    "al\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16776717,\"index\":4},{\"signal\":{\"type\":\"item"
+    "\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16776716,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-b"
+    "arrel\"},\"count\":-16776715,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16776714,"
+    "\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16776713,\"index\":8},{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16776712,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"em"
+    "pty-barrel\"},\"count\":-16776711,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\""
+    ":-16776710,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16776709,\"index\":12}"
+    ",{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16776708,\"index\":13},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"engine-unit\"},\"count\":-16776707,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-en"
+    "gine-unit\"},\"count\":-16776706,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\""
+    ":-16776705,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":52},{\"entity_id\":54,\"circuit_id\":1}]}}},{"
+    "\"entity_number\":52,\"name\":\"constant-combinator\",\"position\":{\"x\":-37.5,\"y\":-101.5},\"control_behavior\":{\"fi"
+    "lters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16776736,\"index\":1},{\"signal\":{\"type\":\"item"
+    "\",\"name\":\"coal\"},\"count\":-16776735,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-167"
+    "76734,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16776733,\"index\":4},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16776732,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uran"
+    "ium-ore\"},\"count\":-16776731,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16776730,\""
+    "index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16776729,\"index\":8},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"copper-plate\"},\"count\":-16776728,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fu"
+    "el\"},\"count\":-16776727,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16776726,\"i"
+    "ndex\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16776725,\"index\":12},{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"sulfur\"},\"count\":-16776724,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"}"
+    ",\"count\":-16776723,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16776722,\"index\""
+    ":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16776721,\"index\":16}]},\"connections\":{"
+    "\"1\":{\"red\":[{\"entity_id\":47},{\"entity_id\":51}]}}},{\"entity_number\":53,\"name\":\"decider-combinator\",\"positi"
+    "on\":{\"x\":-35,\"y\":-100.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-check\"},\"constant\":9,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":49}],\"green\":"
+    "[{\"entity_id\":54,\"circuit_id\":1},{\"entity_id\":73,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":54,\"circuit_i"
+    "d\":2},{\"entity_id\":73,\"circuit_id\":2}]}}},{\"entity_number\":54,\"name\":\"decider-combinator\",\"position\":{\"x\""
+    ":-35,\"y\":-101.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\","
+    "\"name\":\"signal-check\"},\"constant\":7,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":51}],\"green\":[{\"entit"
+    "y_id\":33,\"circuit_id\":1},{\"entity_id\":53,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":33,\"circuit_id\":2},{\""
+    "entity_id\":53,\"circuit_id\":2}]}}},{\"entity_number\":55,\"name\":\"constant-combinator\",\"position\":{\"x\":-45.5,\""
+    "y\":-99.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-167765"
+    "76,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16776575,\"index\":2},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16776574,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-3\"},\"count\":-16776573,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-1677657"
+    "2,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16776571,\"index\":6},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16776570,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-7\"},\"count\":-16776569,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-1677656"
+    "8,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16776567,\"index\":10},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16776566,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-B\"},\"count\":-16776565,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-167765"
+    "64,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16776563,\"index\":14},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16776562,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-F\"},\"count\":-16776561,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":56}]}}},{\"entity_num"
+    "ber\":56,\"name\":\"constant-combinator\",\"position\":{\"x\":-44.5,\"y\":-99.5},\"control_behavior\":{\"filters\":[{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16776560,\"index\":1},{\"signal\":{\"type\":\"virtual\","
+    "\"name\":\"signal-H\"},\"count\":-16776559,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count"
+    "\":-16776558,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16776557,\"index\":4},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16776556,\"index\":5},{\"signal\":{\"type\":\"virtual\","
+    "\"name\":\"signal-L\"},\"count\":-16776555,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"co"
+    "unt\":-16776554,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16776553,\"index\":8},{"
+    "\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16776552,\"index\":9},{\"signal\":{\"type\":\"virtual"
+    "\",\"name\":\"signal-P\"},\"count\":-16776551,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"c"
+    "ount\":-16776550,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16776549,\"index\":12"
+    "},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16776548,\"index\":13},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-T\"},\"count\":-16776547,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"}"
+    ",\"count\":-16776546,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16776545,\"index\""
+    ":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":55},{\"entity_id\":59}]}}},{\"entity_number\":57,\"name\":\"const"
+    "ant-combinator\",\"position\":{\"x\":-44.5,\"y\":-98.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-G\"},\"count\":-16776432,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\""
+    "count\":-16776431,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16776430,\"index\":3}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16776429,\"index\":4},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-K\"},\"count\":-16776428,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\""
+    "count\":-16776427,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16776426,\"index\""
+    ":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16776425,\"index\":8},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-O\"},\"count\":-16776424,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"}"
+    ",\"count\":-16776423,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16776422,\"index\""
+    ":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16776421,\"index\":12},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-S\"},\"count\":-16776420,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T"
+    "\"},\"count\":-16776419,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16776418,\"ind"
+    "ex\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16776417,\"index\":16}]},\"connections\":{\""
+    "1\":{\"red\":[{\"entity_id\":58},{\"entity_id\":62}]}}},{\"entity_number\":58,\"name\":\"constant-combinator\",\"positio"
+    "n\":{\"x\":-45.5,\"y\":-98.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\""
+    "},\"count\":-16776448,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16776447,\"index\""
+    ":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16776446,\"index\":3},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-3\"},\"count\":-16776445,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"}"
+    ",\"count\":-16776444,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16776443,\"index\""
+    ":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16776442,\"index\":7},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-7\"},\"count\":-16776441,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"}"
+    ",\"count\":-16776440,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16776439,\"index\""
+    ":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16776438,\"index\":11},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-B\"},\"count\":-16776437,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C"
+    "\"},\"count\":-16776436,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16776435,\"ind"
+    "ex\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16776434,\"index\":15},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-F\"},\"count\":-16776433,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":"
+    "57}]}}},{\"entity_number\":59,\"name\":\"constant-combinator\",\"position\":{\"x\":-43.5,\"y\":-99.5},\"control_behavior"
+    "\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16776544,\"index\":1},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"coal\"},\"count\":-16776543,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count"
+    "\":-16776542,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16776541,\"index\":4},{\"sign"
+    "al\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16776540,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"uranium-ore\"},\"count\":-16776539,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-1677"
+    "6538,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16776537,\"index\":8},{\"signal\":{"
+    "\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16776536,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "solid-fuel\"},\"count\":-16776535,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-1677"
+    "6534,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16776533,\"index\":12},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16776532,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"bat"
+    "tery\"},\"count\":-16776531,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16776530,\""
+    "index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16776529,\"index\":16}]},\"connecti"
+    "ons\":{\"1\":{\"red\":[{\"entity_id\":56},{\"entity_id\":60}]}}},{\"entity_number\":60,\"name\":\"constant-combinator\","
+    "\"position\":{\"x\":-42.5,\"y\":-99.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heav"
+    "y-oil-barrel\"},\"count\":-16776528,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\""
+    ":-16776527,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16776526,\"index\":3},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16776525,\"index\":4},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16776524,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"w"
+    "ater-barrel\"},\"count\":-16776523,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-167"
+    "76522,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16776521,\"index\":8},{\"signal\":"
+    "{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16776520,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"empty-barrel\"},\"count\":-16776519,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"c"
+    "ount\":-16776518,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16776517,\"index"
+    "\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16776516,\"index\":13},{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"engine-unit\"},\"count\":-16776515,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"elect"
+    "ric-engine-unit\"},\"count\":-16776514,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"c"
+    "ount\":-16776513,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":59},{\"entity_id\":63,\"circuit_id\":1}"
+    "]}}},{\"entity_number\":61,\"name\":\"constant-combinator\",\"position\":{\"x\":-42.5,\"y\":-98.5},\"control_behavior\":"
+    "{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16776400,\"index\":1},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16776399,\"index\":2},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"lubricant-barrel\"},\"count\":-16776398,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barre"
+    "l\"},\"count\":-16776397,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16776"
+    "396,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16776395,\"index\":6},{\"signal\":"
+    "{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16776394,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "iron-stick\"},\"count\":-16776393,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-1"
+    "6776392,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16776391,\"index\":10},{\"sign"
+    "al\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16776390,\"index\":11},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"advanced-circuit\"},\"count\":-16776389,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-u"
+    "nit\"},\"count\":-16776388,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16776387,\""
+    "index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16776386,\"index\":15},{\"signa"
+    "l\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16776385,\"index\":16}]},\"connections\":{\"1\":{\"re"
+    "d\":[{\"entity_id\":62},{\"entity_id\":64,\"circuit_id\":1}]}}},{\"entity_number\":62,\"name\":\"constant-combinator\",\""
+    "position\":{\"x\":-43.5,\"y\":-98.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\""
+    "},\"count\":-16776416,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16776415,\"index\":2},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16776414,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"iron-ore\"},\"count\":-16776413,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16776"
+    "412,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16776411,\"index\":6},{\"signal\":{"
+    "\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16776410,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron"
+    "-plate\"},\"count\":-16776409,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16776408"
+    ",\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16776407,\"index\":10},{\"signal\":{\"t"
+    "ype\":\"item\",\"name\":\"steel-plate\"},\"count\":-16776406,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"pla"
+    "stic-bar\"},\"count\":-16776405,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16776404,\""
+    "index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16776403,\"index\":14},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"explosives\"},\"count\":-16776402,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil"
+    "-barrel\"},\"count\":-16776401,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":57},{\"entity_id\":61}]}}"
+    "},{\"entity_number\":63,\"name\":\"decider-combinator\",\"position\":{\"x\":-41,\"y\":-99.5},\"direction\":2,\"control_b"
+    "ehavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":10,\"c"
+    "omparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true"
+    "}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":60}],\"green\":[{\"entity_id\":43,\"circuit_id\":1},{\"entity_id\":64"
+    ",\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":43,\"circuit_id\":2},{\"entity_id\":64,\"circuit_id\":2}]}}},{\"enti"
+    "ty_number\":64,\"name\":\"decider-combinator\",\"position\":{\"x\":-41,\"y\":-98.5},\"direction\":2,\"control_behavior\""
+    ":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":12,\"comparator"
+    "\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"conn"
+    "ections\":{\"1\":{\"red\":[{\"entity_id\":61}],\"green\":[{\"entity_id\":63,\"circuit_id\":1},{\"entity_id\":84,\"circui"
+    "t_id\":1}]},\"2\":{\"red\":[{\"entity_id\":63,\"circuit_id\":2},{\"entity_id\":84,\"circuit_id\":2}]}}},{\"entity_number"
+    "\":65,\"name\":\"constant-combinator\",\"position\":{\"x\":-38.5,\"y\":-99.5},\"control_behavior\":{\"filters\":[{\"sign"
+    "al\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16776496,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"n"
+    "ame\":\"signal-H\"},\"count\":-16776495,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":"
+    "-16776494,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16776493,\"index\":4},{\"sign"
+    "al\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16776492,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"n"
+    "ame\":\"signal-L\"},\"count\":-16776491,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count"
+    "\":-16776490,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16776489,\"index\":8},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16776488,\"index\":9},{\"signal\":{\"type\":\"virtual\","
+    "\"name\":\"signal-P\"},\"count\":-16776487,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"coun"
+    "t\":-16776486,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16776485,\"index\":12},{"
+    "\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16776484,\"index\":13},{\"signal\":{\"type\":\"virtua"
+    "l\",\"name\":\"signal-T\"},\"count\":-16776483,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\""
+    "count\":-16776482,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16776481,\"index\":1"
+    "6}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":66},{\"entity_id\":70}]}}},{\"entity_number\":66,\"name\":\"constan"
+    "t-combinator\",\"position\":{\"x\":-39.5,\"y\":-99.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual"
+    "\",\"name\":\"signal-0\"},\"count\":-16776512,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"co"
+    "unt\":-16776511,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16776510,\"index\":3},{"
+    "\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16776509,\"index\":4},{\"signal\":{\"type\":\"virtual"
+    "\",\"name\":\"signal-4\"},\"count\":-16776508,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"co"
+    "unt\":-16776507,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16776506,\"index\":7},{"
+    "\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16776505,\"index\":8},{\"signal\":{\"type\":\"virtual"
+    "\",\"name\":\"signal-8\"},\"count\":-16776504,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"co"
+    "unt\":-16776503,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16776502,\"index\":11}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16776501,\"index\":12},{\"signal\":{\"type\":\"virt"
+    "ual\",\"name\":\"signal-C\"},\"count\":-16776500,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},"
+    "\"count\":-16776499,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16776498,\"index\""
+    ":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16776497,\"index\":16}]},\"connections\":{\"1\""
+    ":{\"red\":[{\"entity_id\":65}]}}},{\"entity_number\":67,\"name\":\"constant-combinator\",\"position\":{\"x\":-39.5,\"y\""
+    ":-98.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16776384,"
+    "\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16776383,\"index\":2},{\"signal\":{\"ty"
+    "pe\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16776382,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"si"
+    "gnal-3\"},\"count\":-16776381,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16776380,"
+    "\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16776379,\"index\":6},{\"signal\":{\"ty"
+    "pe\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16776378,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"si"
+    "gnal-7\"},\"count\":-16776377,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16776376,"
+    "\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16776375,\"index\":10},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16776374,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-B\"},\"count\":-16776373,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-167763"
+    "72,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16776371,\"index\":14},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16776370,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-F\"},\"count\":-16776369,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":68}]}}},{\"entity_num"
+    "ber\":68,\"name\":\"constant-combinator\",\"position\":{\"x\":-38.5,\"y\":-98.5},\"control_behavior\":{\"filters\":[{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16776368,\"index\":1},{\"signal\":{\"type\":\"virtual\","
+    "\"name\":\"signal-H\"},\"count\":-16776367,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count"
+    "\":-16776366,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16776365,\"index\":4},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16776364,\"index\":5},{\"signal\":{\"type\":\"virtual\","
+    "\"name\":\"signal-L\"},\"count\":-16776363,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"co"
+    "unt\":-16776362,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16776361,\"index\":8},{"
+    "\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16776360,\"index\":9},{\"signal\":{\"type\":\"virtual"
+    "\",\"name\":\"signal-P\"},\"count\":-16776359,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"c"
+    "ount\":-16776358,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16776357,\"index\":12"
+    "},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16776356,\"index\":13},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-T\"},\"count\":-16776355,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"}"
+    ",\"count\":-16776354,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16776353,\"index\""
+    ":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":67},{\"entity_id\":71}]}}},{\"entity_number\":69,\"name\":\"const"
+    "ant-combinator\",\"position\":{\"x\":-36.5,\"y\":-99.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"heavy-oil-barrel\"},\"count\":-16776464,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-bar"
+    "rel\"},\"count\":-16776463,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-1677646"
+    "2,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16776461,\"index\":4},{\"sig"
+    "nal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16776460,\"index\":5},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"water-barrel\"},\"count\":-16776459,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\""
+    "},\"count\":-16776458,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16776457,\"index\""
+    ":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16776456,\"index\":9},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"empty-barrel\"},\"count\":-16776455,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electron"
+    "ic-circuit\"},\"count\":-16776454,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":"
+    "-16776453,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16776452,\"index\":13},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16776451,\"index\":14},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"electric-engine-unit\"},\"count\":-16776450,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-r"
+    "obot-frame\"},\"count\":-16776449,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":70},{\"entity_id\":73,"
+    "\"circuit_id\":1}]}}},{\"entity_number\":70,\"name\":\"constant-combinator\",\"position\":{\"x\":-37.5,\"y\":-99.5},\"co"
+    "ntrol_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16776480,\"index\":1},{\"sig"
+    "nal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16776479,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"s"
+    "tone\"},\"count\":-16776478,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16776477,\"ind"
+    "ex\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16776476,\"index\":5},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"uranium-ore\"},\"count\":-16776475,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},"
+    "\"count\":-16776474,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16776473,\"index\":8"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16776472,\"index\":9},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"solid-fuel\"},\"count\":-16776471,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},"
+    "\"count\":-16776470,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16776469,\"index\""
+    ":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16776468,\"index\":13},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"battery\"},\"count\":-16776467,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count"
+    "\":-16776466,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16776465,\"index\":1"
+    "6}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":65},{\"entity_id\":69}]}}},{\"entity_number\":71,\"name\":\"constan"
+    "t-combinator\",\"position\":{\"x\":-37.5,\"y\":-98.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\","
+    "\"name\":\"wood\"},\"count\":-16776352,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-1677635"
+    "1,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16776350,\"index\":3},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"iron-ore\"},\"count\":-16776349,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\""
+    "},\"count\":-16776348,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16776347,\"index\""
+    ":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16776346,\"index\":7},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"iron-plate\"},\"count\":-16776345,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"c"
+    "ount\":-16776344,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16776343,\"index\":10},"
+    "{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16776342,\"index\":11},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"plastic-bar\"},\"count\":-16776341,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count"
+    "\":-16776340,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16776339,\"index\":14},{\"sig"
+    "nal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16776338,\"index\":15},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"crude-oil-barrel\"},\"count\":-16776337,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":68},{\"ent"
+    "ity_id\":72}]}}},{\"entity_number\":72,\"name\":\"constant-combinator\",\"position\":{\"x\":-36.5,\"y\":-98.5},\"control"
+    "_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16776336,\"index\":1}"
+    ",{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16776335,\"index\":2},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"lubricant-barrel\"},\"count\":-16776334,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petrole"
+    "um-gas-barrel\"},\"count\":-16776333,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"co"
+    "unt\":-16776332,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16776331,\"index\":6},"
+    "{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16776330,\"index\":7},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"iron-stick\"},\"count\":-16776329,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},"
+    "\"count\":-16776328,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16776327,\"index\""
+    ":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16776326,\"index\":11},{\"signal\":{\"ty"
+    "pe\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16776325,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "processing-unit\"},\"count\":-16776324,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":"
+    "-16776323,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16776322,\"index\":"
+    "15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16776321,\"index\":16}]},\"connections\":"
+    "{\"1\":{\"red\":[{\"entity_id\":71},{\"entity_id\":74,\"circuit_id\":1}]}}},{\"entity_number\":73,\"name\":\"decider-com"
+    "binator\",\"position\":{\"x\":-35,\"y\":-99.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":11,\"comparator\":\"=\",\"output_signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_"
+    "id\":69}],\"green\":[{\"entity_id\":53,\"circuit_id\":1},{\"entity_id\":74,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity"
+    "_id\":53,\"circuit_id\":2},{\"entity_id\":74,\"circuit_id\":2}]}}},{\"entity_number\":74,\"name\":\"decider-combinator\""
+    ",\"position\":{\"x\":-35,\"y\":-98.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":13,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual"
+    "\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":72}]"
+    ",\"green\":[{\"entity_id\":73,\"circuit_id\":1},{\"entity_id\":94,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":73,"
+    "\"circuit_id\":2},{\"entity_id\":94,\"circuit_id\":2}]}}},{\"entity_number\":75,\"name\":\"constant-combinator\",\"posit"
+    "ion\":{\"x\":-45.5,\"y\":-96.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0"
+    "\"},\"count\":-16776192,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16776191,\"inde"
+    "x\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16776190,\"index\":3},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-3\"},\"count\":-16776189,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\""
+    "},\"count\":-16776188,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16776187,\"index\""
+    ":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16776186,\"index\":7},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-7\"},\"count\":-16776185,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"}"
+    ",\"count\":-16776184,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16776183,\"index\""
+    ":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16776182,\"index\":11},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-B\"},\"count\":-16776181,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C"
+    "\"},\"count\":-16776180,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16776179,\"ind"
+    "ex\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16776178,\"index\":15},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-F\"},\"count\":-16776177,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":"
+    "76}]}}},{\"entity_number\":76,\"name\":\"constant-combinator\",\"position\":{\"x\":-44.5,\"y\":-96.5},\"control_behavior"
+    "\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16776176,\"index\":1},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16776175,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":"
+    "\"signal-I\"},\"count\":-16776174,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16776"
+    "173,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16776172,\"index\":5},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16776171,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":"
+    "\"signal-pink\"},\"count\":-16776170,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16"
+    "776169,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16776168,\"index\":9},{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16776167,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name"
+    "\":\"signal-Q\"},\"count\":-16776166,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-1"
+    "6776165,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16776164,\"index\":13},{\"sign"
+    "al\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16776163,\"index\":14},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-U\"},\"count\":-16776162,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\""
+    ":-16776161,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":75},{\"entity_id\":79}]}}},{\"entity_number\""
+    ":77,\"name\":\"constant-combinator\",\"position\":{\"x\":-44.5,\"y\":-97.5},\"control_behavior\":{\"filters\":[{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16776304,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"nam"
+    "e\":\"signal-H\"},\"count\":-16776303,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-1"
+    "6776302,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16776301,\"index\":4},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16776300,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"nam"
+    "e\":\"signal-L\"},\"count\":-16776299,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\""
+    ":-16776298,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16776297,\"index\":8},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16776296,\"index\":9},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-P\"},\"count\":-16776295,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\""
+    ":-16776294,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16776293,\"index\":12},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16776292,\"index\":13},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-T\"},\"count\":-16776291,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"cou"
+    "nt\":-16776290,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16776289,\"index\":16}]"
+    "},\"connections\":{\"1\":{\"red\":[{\"entity_id\":78},{\"entity_id\":82}]}}},{\"entity_number\":78,\"name\":\"constant-c"
+    "ombinator\",\"position\":{\"x\":-45.5,\"y\":-97.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\","
+    "\"name\":\"signal-0\"},\"count\":-16776320,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count"
+    "\":-16776319,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16776318,\"index\":3},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16776317,\"index\":4},{\"signal\":{\"type\":\"virtual\","
+    "\"name\":\"signal-4\"},\"count\":-16776316,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count"
+    "\":-16776315,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16776314,\"index\":7},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16776313,\"index\":8},{\"signal\":{\"type\":\"virtual\","
+    "\"name\":\"signal-8\"},\"count\":-16776312,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count"
+    "\":-16776311,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16776310,\"index\":11},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16776309,\"index\":12},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-C\"},\"count\":-16776308,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"cou"
+    "nt\":-16776307,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16776306,\"index\":15},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16776305,\"index\":16}]},\"connections\":{\"1\":{\"r"
+    "ed\":[{\"entity_id\":77}]}}},{\"entity_number\":79,\"name\":\"constant-combinator\",\"position\":{\"x\":-43.5,\"y\":-96."
+    "5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16776160,\"index\":1}"
+    ",{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16776159,\"index\":2},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"stone\"},\"count\":-16776158,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-1677615"
+    "7,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16776156,\"index\":5},{\"signal\":{\"t"
+    "ype\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16776155,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-"
+    "fish\"},\"count\":-16776154,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16776153,\"i"
+    "ndex\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16776152,\"index\":9},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16776151,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-p"
+    "late\"},\"count\":-16776150,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16776149,\""
+    "index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16776148,\"index\":13},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"battery\"},\"count\":-16776147,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"}"
+    ",\"count\":-16776146,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16776145,\"i"
+    "ndex\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":76},{\"entity_id\":80}]}}},{\"entity_number\":80,\"name\":\""
+    "constant-combinator\",\"position\":{\"x\":-42.5,\"y\":-96.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\""
+    "item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16776144,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-o"
+    "il-barrel\"},\"count\":-16776143,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-1"
+    "6776142,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16776141,\"index\":4},"
+    "{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16776140,\"index\":5},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"water-barrel\"},\"count\":-16776139,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-c"
+    "able\"},\"count\":-16776138,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16776137,\"i"
+    "ndex\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16776136,\"index\":9},{\"signal\":{\"t"
+    "ype\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16776135,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"el"
+    "ectronic-circuit\"},\"count\":-16776134,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"co"
+    "unt\":-16776133,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16776132,\"index\""
+    ":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16776131,\"index\":14},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"electric-engine-unit\"},\"count\":-16776130,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"fl"
+    "ying-robot-frame\"},\"count\":-16776129,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":79},{\"entity_id"
+    "\":83,\"circuit_id\":1}]}}},{\"entity_number\":81,\"name\":\"constant-combinator\",\"position\":{\"x\":-42.5,\"y\":-97.5"
+    "},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16776272,\""
+    "index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16776271,\"index\":2},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16776270,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"petroleum-gas-barrel\"},\"count\":-16776269,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barre"
+    "l\"},\"count\":-16776268,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16776267,\"in"
+    "dex\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16776266,\"index\":7},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"iron-stick\"},\"count\":-16776265,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-"
+    "wheel\"},\"count\":-16776264,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16776263,"
+    "\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16776262,\"index\":11},{\"signa"
+    "l\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16776261,\"index\":12},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"processing-unit\"},\"count\":-16776260,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\""
+    "count\":-16776259,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16776258,\""
+    "index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16776257,\"index\":16}]},\"connec"
+    "tions\":{\"1\":{\"red\":[{\"entity_id\":82},{\"entity_id\":84,\"circuit_id\":1}]}}},{\"entity_number\":82,\"name\":\"con"
+    "stant-combinator\",\"position\":{\"x\":-43.5,\"y\":-97.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"wood\"},\"count\":-16776288,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-167"
+    "76287,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16776286,\"index\":3},{\"signal\":{\"ty"
+    "pe\":\"item\",\"name\":\"iron-ore\"},\"count\":-16776285,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-o"
+    "re\"},\"count\":-16776284,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16776283,\"in"
+    "dex\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16776282,\"index\":7},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"iron-plate\"},\"count\":-16776281,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\""
+    "},\"count\":-16776280,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16776279,\"index\""
+    ":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16776278,\"index\":11},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"plastic-bar\"},\"count\":-16776277,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\""
+    "count\":-16776276,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16776275,\"index\":14},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16776274,\"index\":15},{\"signal\":{\"type\":\"item\","
+    "\"name\":\"crude-oil-barrel\"},\"count\":-16776273,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":77},{"
+    "\"entity_id\":81}]}}},{\"entity_number\":83,\"name\":\"decider-combinator\",\"position\":{\"x\":-41,\"y\":-96.5},\"direc"
+    "tion\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"}"
+    ",\"constant\":16,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_cou"
+    "nt_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":80}],\"green\":[{\"entity_id\":84,\"circuit_id\":"
+    "1},{\"entity_id\":103,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":84,\"circuit_id\":2},{\"entity_id\":103,\"circu"
+    "it_id\":2}]}}},{\"entity_number\":84,\"name\":\"decider-combinator\",\"position\":{\"x\":-41,\"y\":-97.5},\"direction\":"
+    "2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"cons"
+    "tant\":14,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from"
+    "_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":81}],\"green\":[{\"entity_id\":64,\"circuit_id\":1},{\"e"
+    "ntity_id\":83,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":64,\"circuit_id\":2},{\"entity_id\":83,\"circuit_id\":2"
+    "}]}}},{\"entity_number\":85,\"name\":\"constant-combinator\",\"position\":{\"x\":-38.5,\"y\":-96.5},\"control_behavior\""
+    ":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16776112,\"index\":1},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16776111,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-I\"},\"count\":-16776110,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-1677610"
+    "9,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16776108,\"index\":5},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16776107,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-pink\"},\"count\":-16776106,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-1677"
+    "6105,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16776104,\"index\":9},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16776103,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-Q\"},\"count\":-16776102,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-167"
+    "76101,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16776100,\"index\":13},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16776099,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-U\"},\"count\":-16776098,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":"
+    "-16776097,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":86},{\"entity_id\":90}]}}},{\"entity_number\":"
+    "86,\"name\":\"constant-combinator\",\"position\":{\"x\":-39.5,\"y\":-96.5},\"control_behavior\":{\"filters\":[{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16776128,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-1\"},\"count\":-16776127,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-1677"
+    "6126,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16776125,\"index\":4},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16776124,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-5\"},\"count\":-16776123,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-1677"
+    "6122,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16776121,\"index\":8},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16776120,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-9\"},\"count\":-16776119,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-167"
+    "76118,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16776117,\"index\":12},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16776116,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-D\"},\"count\":-16776115,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":"
+    "-16776114,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16776113,\"index\":16}]},\"c"
+    "onnections\":{\"1\":{\"red\":[{\"entity_id\":85}]}}},{\"entity_number\":87,\"name\":\"constant-combinator\",\"position\""
+    ":{\"x\":-39.5,\"y\":-97.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\""
+    "count\":-16776256,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16776255,\"index\":2}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16776254,\"index\":3},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-3\"},\"count\":-16776253,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\""
+    "count\":-16776252,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16776251,\"index\":6}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16776250,\"index\":7},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-7\"},\"count\":-16776249,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\""
+    "count\":-16776248,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16776247,\"index\":10"
+    "},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16776246,\"index\":11},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-B\"},\"count\":-16776245,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"}"
+    ",\"count\":-16776244,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16776243,\"index\""
+    ":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16776242,\"index\":15},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-F\"},\"count\":-16776241,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":88}"
+    "]}}},{\"entity_number\":88,\"name\":\"constant-combinator\",\"position\":{\"x\":-38.5,\"y\":-97.5},\"control_behavior\":"
+    "{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16776240,\"index\":1},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16776239,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-I\"},\"count\":-16776238,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16776237"
+    ",\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16776236,\"index\":5},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16776235,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-pink\"},\"count\":-16776234,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16776"
+    "233,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16776232,\"index\":9},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16776231,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-Q\"},\"count\":-16776230,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-167"
+    "76229,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16776228,\"index\":13},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16776227,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-U\"},\"count\":-16776226,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":"
+    "-16776225,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":87},{\"entity_id\":91}]}}},{\"entity_number\":"
+    "89,\"name\":\"constant-combinator\",\"position\":{\"x\":-36.5,\"y\":-96.5},\"control_behavior\":{\"filters\":[{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16776080,\"index\":1},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"light-oil-barrel\"},\"count\":-16776079,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"}"
+    ",\"count\":-16776078,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16776077,"
+    "\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16776076,\"index\":5},{\"signa"
+    "l\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16776075,\"index\":6},{\"signal\":{\"type\":\"item\",\"name"
+    "\":\"copper-cable\"},\"count\":-16776074,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":"
+    "-16776073,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16776072,\"index\":9},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16776071,\"index\":10},{\"signal\":{\"type\":\"item\","
+    "\"name\":\"electronic-circuit\"},\"count\":-16776070,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-ci"
+    "rcuit\"},\"count\":-16776069,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16776"
+    "068,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16776067,\"index\":14},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16776066,\"index\":15},{\"signal\":{\"type\":\"item\","
+    "\"name\":\"flying-robot-frame\"},\"count\":-16776065,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":90}"
+    ",{\"entity_id\":93,\"circuit_id\":1}]}}},{\"entity_number\":90,\"name\":\"constant-combinator\",\"position\":{\"x\":-37."
+    "5,\"y\":-96.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16776096,"
+    "\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16776095,\"index\":2},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"stone\"},\"count\":-16776094,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"coun"
+    "t\":-16776093,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16776092,\"index\":5},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16776091,\"index\":6},{\"signal\":{\"type\":\"item\",\"n"
+    "ame\":\"raw-fish\"},\"count\":-16776090,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-"
+    "16776089,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16776088,\"index\":9},{\"sign"
+    "al\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16776087,\"index\":10},{\"signal\":{\"type\":\"item\",\"name"
+    "\":\"steel-plate\"},\"count\":-16776086,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\""
+    ":-16776085,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16776084,\"index\":13},{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16776083,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "explosives\"},\"count\":-16776082,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":"
+    "-16776081,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":85},{\"entity_id\":89}]}}},{\"entity_number\":"
+    "91,\"name\":\"constant-combinator\",\"position\":{\"x\":-37.5,\"y\":-97.5},\"control_behavior\":{\"filters\":[{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16776224,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\""
+    "},\"count\":-16776223,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16776222,\"index\":3},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16776221,\"index\":4},{\"signal\":{\"type\":\"item\",\"n"
+    "ame\":\"copper-ore\"},\"count\":-16776220,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\""
+    ":-16776219,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16776218,\"index\":7},{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16776217,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"copper-plate\"},\"count\":-16776216,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16"
+    "776215,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16776214,\"index\":11},{\"signa"
+    "l\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16776213,\"index\":12},{\"signal\":{\"type\":\"item\",\"name"
+    "\":\"sulfur\"},\"count\":-16776212,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-1677621"
+    "1,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16776210,\"index\":15},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16776209,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"e"
+    "ntity_id\":88},{\"entity_id\":92}]}}},{\"entity_number\":92,\"name\":\"constant-combinator\",\"position\":{\"x\":-36.5,\""
+    "y\":-97.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-1"
+    "6776208,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16776207,\"index\":2},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16776206,\"index\":3},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"petroleum-gas-barrel\"},\"count\":-16776205,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-"
+    "acid-barrel\"},\"count\":-16776204,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-167"
+    "76203,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16776202,\"index\":7},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16776201,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "iron-gear-wheel\"},\"count\":-16776200,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":"
+    "-16776199,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16776198,\"index\":11"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16776197,\"index\":12},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"processing-unit\"},\"count\":-16776196,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engin"
+    "e-unit\"},\"count\":-16776195,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":"
+    "-16776194,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16776193,\"index\":16"
+    "}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":91},{\"entity_id\":94,\"circuit_id\":1}]}}},{\"entity_number\":93,\""
+    "name\":\"decider-combinator\",\"position\":{\"x\":-35,\"y\":-96.5},\"direction\":2,\"control_behavior\":{\"decider_condi"
+    "tions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":17,\"comparator\":\"=\",\"output"
+    "_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":"
+    "{\"red\":[{\"entity_id\":89}],\"green\":[{\"entity_id\":94,\"circuit_id\":1},{\"entity_id\":113,\"circuit_id\":1}]},\"2\""
+    ":{\"red\":[{\"entity_id\":94,\"circuit_id\":2},{\"entity_id\":113,\"circuit_id\":2}]}}},{\"entity_number\":94,\"name\":\""
+    "decider-combinator\",\"position\":{\"x\":-35,\"y\":-97.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{"
+    "\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":15,\"comparator\":\"=\",\"output_signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":"
+    "[{\"entity_id\":92}],\"green\":[{\"entity_id\":74,\"circuit_id\":1},{\"entity_id\":93,\"circuit_id\":1}]},\"2\":{\"red\""
+    ":[{\"entity_id\":74,\"circuit_id\":2},{\"entity_id\":93,\"circuit_id\":2}]}}},{\"entity_number\":95,\"name\":\"constant-"
+    "combinator\",\"position\":{\"x\":-45.5,\"y\":-95.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-0\"},\"count\":-16776064,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"coun"
+    "t\":-16776063,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16776062,\"index\":3},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16776061,\"index\":4},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-4\"},\"count\":-16776060,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"coun"
+    "t\":-16776059,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16776058,\"index\":7},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16776057,\"index\":8},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-8\"},\"count\":-16776056,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"coun"
+    "t\":-16776055,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16776054,\"index\":11},{"
+    "\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16776053,\"index\":12},{\"signal\":{\"type\":\"virtua"
+    "l\",\"name\":\"signal-C\"},\"count\":-16776052,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\""
+    "count\":-16776051,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16776050,\"index\":1"
+    "5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16776049,\"index\":16}]},\"connections\":{\"1\":{"
+    "\"red\":[{\"entity_id\":96}]}}},{\"entity_number\":96,\"name\":\"constant-combinator\",\"position\":{\"x\":-44.5,\"y\":-"
+    "95.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16776048,\""
+    "index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16776047,\"index\":2},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16776046,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-J\"},\"count\":-16776045,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16776044,\""
+    "index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16776043,\"index\":6},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16776042,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-N\"},\"count\":-16776041,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16776040"
+    ",\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16776039,\"index\":10},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16776038,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-R\"},\"count\":-16776037,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-167760"
+    "36,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16776035,\"index\":14},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16776034,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-V\"},\"count\":-16776033,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":95},{\"entity_id\":99"
+    "}]}}},{\"entity_number\":97,\"name\":\"constant-combinator\",\"position\":{\"x\":-44.5,\"y\":-94.5},\"control_behavior\""
+    ":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16775920,\"index\":1},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16775919,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-I\"},\"count\":-16775918,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-1677591"
+    "7,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16775916,\"index\":5},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16775915,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-pink\"},\"count\":-16775914,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-1677"
+    "5913,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16775912,\"index\":9},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16775911,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-Q\"},\"count\":-16775910,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-167"
+    "75909,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16775908,\"index\":13},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16775907,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-U\"},\"count\":-16775906,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":"
+    "-16775905,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":98},{\"entity_id\":102}]}}},{\"entity_number\""
+    ":98,\"name\":\"constant-combinator\",\"position\":{\"x\":-45.5,\"y\":-94.5},\"control_behavior\":{\"filters\":[{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16775936,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"nam"
+    "e\":\"signal-1\"},\"count\":-16775935,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-1"
+    "6775934,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16775933,\"index\":4},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16775932,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"nam"
+    "e\":\"signal-5\"},\"count\":-16775931,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-1"
+    "6775930,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16775929,\"index\":8},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16775928,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"nam"
+    "e\":\"signal-9\"},\"count\":-16775927,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-"
+    "16775926,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16775925,\"index\":12},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16775924,\"index\":13},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-D\"},\"count\":-16775923,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\""
+    ":-16775922,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16775921,\"index\":16}]},\""
+    "connections\":{\"1\":{\"red\":[{\"entity_id\":97}]}}},{\"entity_number\":99,\"name\":\"constant-combinator\",\"position\""
+    ":{\"x\":-43.5,\"y\":-95.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\""
+    ":-16776032,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16776031,\"index\":2},{\"signal\":{"
+    "\"type\":\"item\",\"name\":\"stone\"},\"count\":-16776030,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-or"
+    "e\"},\"count\":-16776029,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16776028,\"inde"
+    "x\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16776027,\"index\":6},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"raw-fish\"},\"count\":-16776026,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\""
+    "count\":-16776025,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16776024,\"index\":9"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16776023,\"index\":10},{\"signal\":{\"type\":\"item"
+    "\",\"name\":\"steel-plate\"},\"count\":-16776022,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},"
+    "\"count\":-16776021,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16776020,\"index\":13},"
+    "{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16776019,\"index\":14},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"explosives\"},\"count\":-16776018,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\""
+    "count\":-16776017,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":96},{\"entity_id\":100}]}}},{\"entity_"
+    "number\":100,\"name\":\"constant-combinator\",\"position\":{\"x\":-42.5,\"y\":-95.5},\"control_behavior\":{\"filters\":["
+    "{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16776016,\"index\":1},{\"signal\":{\"type\":\"i"
+    "tem\",\"name\":\"light-oil-barrel\"},\"count\":-16776015,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubrican"
+    "t-barrel\"},\"count\":-16776014,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\""
+    ":-16776013,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16776012,\"index\":"
+    "5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16776011,\"index\":6},{\"signal\":{\"type\":\"it"
+    "em\",\"name\":\"copper-cable\"},\"count\":-16776010,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"}"
+    ",\"count\":-16776009,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16776008,\"ind"
+    "ex\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16776007,\"index\":10},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16776006,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"a"
+    "dvanced-circuit\"},\"count\":-16776005,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"coun"
+    "t\":-16776004,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16776003,\"index\":14},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16776002,\"index\":15},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16776001,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entit"
+    "y_id\":99},{\"entity_id\":103,\"circuit_id\":1}]}}},{\"entity_number\":101,\"name\":\"constant-combinator\",\"position\""
+    ":{\"x\":-42.5,\"y\":-94.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel"
+    "\"},\"count\":-16775888,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16775887,\""
+    "index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16775886,\"index\":3},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16775885,\"index\":4},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"sulfuric-acid-barrel\"},\"count\":-16775884,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"}"
+    ",\"count\":-16775883,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16775882,\"index\""
+    ":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16775881,\"index\":8},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"iron-gear-wheel\"},\"count\":-16775880,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barre"
+    "l\"},\"count\":-16775879,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-167758"
+    "78,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16775877,\"index\":12},{\"sign"
+    "al\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16775876,\"index\":13},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"engine-unit\"},\"count\":-16775875,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit"
+    "\"},\"count\":-16775874,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-1677587"
+    "3,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":102},{\"entity_id\":104,\"circuit_id\":1}]}}},{\"entit"
+    "y_number\":102,\"name\":\"constant-combinator\",\"position\":{\"x\":-43.5,\"y\":-94.5},\"control_behavior\":{\"filters\""
+    ":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16775904,\"index\":1},{\"signal\":{\"type\":\"item\",\"na"
+    "me\":\"coal\"},\"count\":-16775903,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16775902,\""
+    "index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16775901,\"index\":4},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"copper-ore\"},\"count\":-16775900,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore"
+    "\"},\"count\":-16775899,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16775898,\"index\""
+    ":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16775897,\"index\":8},{\"signal\":{\"type\":\"ite"
+    "m\",\"name\":\"copper-plate\"},\"count\":-16775896,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},"
+    "\"count\":-16775895,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16775894,\"index\""
+    ":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16775893,\"index\":12},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"sulfur\"},\"count\":-16775892,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"cou"
+    "nt\":-16775891,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16775890,\"index\":15},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16775889,\"index\":16}]},\"connections\":{\"1\":"
+    "{\"red\":[{\"entity_id\":97},{\"entity_id\":101}]}}},{\"entity_number\":103,\"name\":\"decider-combinator\",\"position\""
+    ":{\"x\":-41,\"y\":-95.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virt"
+    "ual\",\"name\":\"signal-check\"},\"constant\":18,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":100}],\"green\":[{"
+    "\"entity_id\":83,\"circuit_id\":1},{\"entity_id\":104,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":83,\"circuit_id"
+    "\":2},{\"entity_id\":104,\"circuit_id\":2}]}}},{\"entity_number\":104,\"name\":\"decider-combinator\",\"position\":{\"x\""
+    ":-41,\"y\":-94.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-check\"},\"constant\":20,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-"
+    "everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":101}],\"green\":[{\"entit"
+    "y_id\":103,\"circuit_id\":1},{\"entity_id\":123,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":103,\"circuit_id\":2}"
+    ",{\"entity_id\":123,\"circuit_id\":2}]}}},{\"entity_number\":105,\"name\":\"constant-combinator\",\"position\":{\"x\":-3"
+    "8.5,\"y\":-95.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-"
+    "16775984,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16775983,\"index\":2},{\"signa"
+    "l\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16775982,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-J\"},\"count\":-16775981,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-"
+    "16775980,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16775979,\"index\":6},{\"signa"
+    "l\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16775978,\"index\":7},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-N\"},\"count\":-16775977,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\""
+    ":-16775976,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16775975,\"index\":10},{\"si"
+    "gnal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16775974,\"index\":11},{\"signal\":{\"type\":\"virtual\","
+    "\"name\":\"signal-R\"},\"count\":-16775973,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"coun"
+    "t\":-16775972,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16775971,\"index\":14},{"
+    "\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16775970,\"index\":15},{\"signal\":{\"type\":\"virtua"
+    "l\",\"name\":\"signal-V\"},\"count\":-16775969,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":106},{\"e"
+    "ntity_id\":110}]}}},{\"entity_number\":106,\"name\":\"constant-combinator\",\"position\":{\"x\":-39.5,\"y\":-95.5},\"con"
+    "trol_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16776000,\"index\":1},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16775999,\"index\":2},{\"signal\":{\"type\":\"virtua"
+    "l\",\"name\":\"signal-2\"},\"count\":-16775998,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"c"
+    "ount\":-16775997,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16775996,\"index\":5},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16775995,\"index\":6},{\"signal\":{\"type\":\"virtua"
+    "l\",\"name\":\"signal-6\"},\"count\":-16775994,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"c"
+    "ount\":-16775993,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16775992,\"index\":9},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16775991,\"index\":10},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-A\"},\"count\":-16775990,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\""
+    "count\":-16775989,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16775988,\"index\":1"
+    "3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16775987,\"index\":14},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-E\"},\"count\":-16775986,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\""
+    "},\"count\":-16775985,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":105}]}}},{\"entity_number\":107,\""
+    "name\":\"constant-combinator\",\"position\":{\"x\":-39.5,\"y\":-94.5},\"control_behavior\":{\"filters\":[{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16775872,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-1\"},\"count\":-16775871,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-1677587"
+    "0,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16775869,\"index\":4},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16775868,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-5\"},\"count\":-16775867,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-1677586"
+    "6,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16775865,\"index\":8},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16775864,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-9\"},\"count\":-16775863,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-167758"
+    "62,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16775861,\"index\":12},{\"signal\":"
+    "{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16775860,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-D\"},\"count\":-16775859,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-167"
+    "75858,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16775857,\"index\":16}]},\"conne"
+    "ctions\":{\"1\":{\"red\":[{\"entity_id\":108}]}}},{\"entity_number\":108,\"name\":\"constant-combinator\",\"position\":{"
+    "\"x\":-38.5,\"y\":-94.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"c"
+    "ount\":-16775856,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16775855,\"index\":2},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16775854,\"index\":3},{\"signal\":{\"type\":\"virtua"
+    "l\",\"name\":\"signal-J\"},\"count\":-16775853,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"c"
+    "ount\":-16775852,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16775851,\"index\":6},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16775850,\"index\":7},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-N\"},\"count\":-16775849,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},"
+    "\"count\":-16775848,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16775847,\"index\":"
+    "10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16775846,\"index\":11},{\"signal\":{\"type\":\"v"
+    "irtual\",\"name\":\"signal-R\"},\"count\":-16775845,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\""
+    "},\"count\":-16775844,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16775843,\"index"
+    "\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16775842,\"index\":15},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-V\"},\"count\":-16775841,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":1"
+    "07},{\"entity_id\":111}]}}},{\"entity_number\":109,\"name\":\"constant-combinator\",\"position\":{\"x\":-36.5,\"y\":-95."
+    "5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16775952,"
+    "\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16775951,\"index\":2},{\"signal\":"
+    "{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16775950,\"index\":3},{\"signal\":{\"type\":\"item\",\"name"
+    "\":\"petroleum-gas-barrel\"},\"count\":-16775949,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-ba"
+    "rrel\"},\"count\":-16775948,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16775947,\""
+    "index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16775946,\"index\":7},{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"iron-stick\"},\"count\":-16775945,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ge"
+    "ar-wheel\"},\"count\":-16775944,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-167759"
+    "43,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16775942,\"index\":11},{\"si"
+    "gnal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16775941,\"index\":12},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"processing-unit\"},\"count\":-16775940,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\""
+    "},\"count\":-16775939,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-1677593"
+    "8,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16775937,\"index\":16}]},\"co"
+    "nnections\":{\"1\":{\"red\":[{\"entity_id\":110},{\"entity_id\":113,\"circuit_id\":1}]}}},{\"entity_number\":110,\"name\""
+    ":\"constant-combinator\",\"position\":{\"x\":-37.5,\"y\":-95.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"wood\"},\"count\":-16775968,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\""
+    ":-16775967,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16775966,\"index\":3},{\"signal\":"
+    "{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16775965,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"cop"
+    "per-ore\"},\"count\":-16775964,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16775963"
+    ",\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16775962,\"index\":7},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"iron-plate\"},\"count\":-16775961,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-p"
+    "late\"},\"count\":-16775960,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16775959,\"i"
+    "ndex\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16775958,\"index\":11},{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16775957,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfu"
+    "r\"},\"count\":-16775956,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16775955,\"index\""
+    ":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16775954,\"index\":15},{\"signal\":{\"type\":\"i"
+    "tem\",\"name\":\"crude-oil-barrel\"},\"count\":-16775953,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\""
+    ":105},{\"entity_id\":109}]}}},{\"entity_number\":111,\"name\":\"constant-combinator\",\"position\":{\"x\":-37.5,\"y\":-9"
+    "4.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16775840,\"index\":"
+    "1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16775839,\"index\":2},{\"signal\":{\"type\":\"item\",\"n"
+    "ame\":\"stone\"},\"count\":-16775838,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16775"
+    "837,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16775836,\"index\":5},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16775835,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw"
+    "-fish\"},\"count\":-16775834,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16775833,\""
+    "index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16775832,\"index\":9},{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16775831,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-"
+    "plate\"},\"count\":-16775830,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16775829,"
+    "\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16775828,\"index\":13},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"battery\"},\"count\":-16775827,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\""
+    "},\"count\":-16775826,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16775825,\""
+    "index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":108},{\"entity_id\":112}]}}},{\"entity_number\":112,\"name"
+    "\":\"constant-combinator\",\"position\":{\"x\":-36.5,\"y\":-94.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16775824,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"li"
+    "ght-oil-barrel\"},\"count\":-16775823,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count"
+    "\":-16775822,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16775821,\"index\""
+    ":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16775820,\"index\":5},{\"signal\":{\"ty"
+    "pe\":\"item\",\"name\":\"water-barrel\"},\"count\":-16775819,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copp"
+    "er-cable\"},\"count\":-16775818,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16775817"
+    ",\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16775816,\"index\":9},{\"signal\":"
+    "{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16775815,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"electronic-circuit\"},\"count\":-16775814,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},"
+    "\"count\":-16775813,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16775812,\"ind"
+    "ex\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16775811,\"index\":14},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16775810,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "flying-robot-frame\"},\"count\":-16775809,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":111},{\"entity"
+    "_id\":114,\"circuit_id\":1}]}}},{\"entity_number\":113,\"name\":\"decider-combinator\",\"position\":{\"x\":-35,\"y\":-95"
+    ".5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-check\"},\"constant\":19,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"}"
+    ",\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":109}],\"green\":[{\"entity_id\":93,\"c"
+    "ircuit_id\":1},{\"entity_id\":114,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":93,\"circuit_id\":2},{\"entity_id\""
+    ":114,\"circuit_id\":2}]}}},{\"entity_number\":114,\"name\":\"decider-combinator\",\"position\":{\"x\":-35,\"y\":-94.5},\""
+    "direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-che"
+    "ck\"},\"constant\":21,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"cop"
+    "y_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":112}],\"green\":[{\"entity_id\":113,\"circui"
+    "t_id\":1},{\"entity_id\":133,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":113,\"circuit_id\":2},{\"entity_id\":133"
+    ",\"circuit_id\":2}]}}},{\"entity_number\":115,\"name\":\"constant-combinator\",\"position\":{\"x\":-44.5,\"y\":-93.5},\""
+    "control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16775792,\"index\":"
+    "1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16775791,\"index\":2},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-I\"},\"count\":-16775790,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},"
+    "\"count\":-16775789,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16775788,\"index\":"
+    "5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16775787,\"index\":6},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-pink\"},\"count\":-16775786,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\""
+    "},\"count\":-16775785,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16775784,\"index\""
+    ":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16775783,\"index\":10},{\"signal\":{\"type\":\"v"
+    "irtual\",\"name\":\"signal-Q\"},\"count\":-16775782,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\""
+    "},\"count\":-16775781,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16775780,\"index"
+    "\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16775779,\"index\":14},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-U\"},\"count\":-16775778,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-V\"},\"count\":-16775777,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":116},{\"entity_id\":120}]}}},{"
+    "\"entity_number\":116,\"name\":\"constant-combinator\",\"position\":{\"x\":-45.5,\"y\":-93.5},\"control_behavior\":{\"fi"
+    "lters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16775808,\"index\":1},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-1\"},\"count\":-16775807,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-2\"},\"count\":-16775806,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16775805,\"in"
+    "dex\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16775804,\"index\":5},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-5\"},\"count\":-16775803,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-6\"},\"count\":-16775802,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16775801,\"in"
+    "dex\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16775800,\"index\":9},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-9\"},\"count\":-16775799,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signa"
+    "l-A\"},\"count\":-16775798,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16775797,\""
+    "index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16775796,\"index\":13},{\"signal\":{\"ty"
+    "pe\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16775795,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-E\"},\"count\":-16775794,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-1677579"
+    "3,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":115}]}}},{\"entity_number\":117,\"name\":\"constant-co"
+    "mbinator\",\"position\":{\"x\":-44.5,\"y\":-92.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-G\"},\"count\":-16775664,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\""
+    ":-16775663,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16775662,\"index\":3},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16775661,\"index\":4},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-K\"},\"count\":-16775660,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\""
+    ":-16775659,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16775658,\"index\":7},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16775657,\"index\":8},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-O\"},\"count\":-16775656,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"coun"
+    "t\":-16775655,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16775654,\"index\":11},{"
+    "\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16775653,\"index\":12},{\"signal\":{\"type\":\"virtua"
+    "l\",\"name\":\"signal-S\"},\"count\":-16775652,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\""
+    "count\":-16775651,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16775650,\"index\":1"
+    "5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16775649,\"index\":16}]},\"connections\":{\"1\":{"
+    "\"red\":[{\"entity_id\":118},{\"entity_id\":122}]}}},{\"entity_number\":118,\"name\":\"constant-combinator\",\"position\""
+    ":{\"x\":-45.5,\"y\":-92.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\""
+    "count\":-16775680,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16775679,\"index\":2}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16775678,\"index\":3},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-3\"},\"count\":-16775677,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\""
+    "count\":-16775676,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16775675,\"index\":6}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16775674,\"index\":7},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-7\"},\"count\":-16775673,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\""
+    "count\":-16775672,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16775671,\"index\":10"
+    "},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16775670,\"index\":11},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-B\"},\"count\":-16775669,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"}"
+    ",\"count\":-16775668,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16775667,\"index\""
+    ":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16775666,\"index\":15},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-F\"},\"count\":-16775665,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":117"
+    "}]}}},{\"entity_number\":119,\"name\":\"constant-combinator\",\"position\":{\"x\":-42.5,\"y\":-93.5},\"control_behavior\""
+    ":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16775760,\"index\":1},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16775759,\"index\":2},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"lubricant-barrel\"},\"count\":-16775758,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barre"
+    "l\"},\"count\":-16775757,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16775"
+    "756,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16775755,\"index\":6},{\"signal\":"
+    "{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16775754,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "iron-stick\"},\"count\":-16775753,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-1"
+    "6775752,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16775751,\"index\":10},{\"sign"
+    "al\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16775750,\"index\":11},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"advanced-circuit\"},\"count\":-16775749,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-u"
+    "nit\"},\"count\":-16775748,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16775747,\""
+    "index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16775746,\"index\":15},{\"signa"
+    "l\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16775745,\"index\":16}]},\"connections\":{\"1\":{\"re"
+    "d\":[{\"entity_id\":120},{\"entity_id\":123,\"circuit_id\":1}]}}},{\"entity_number\":120,\"name\":\"constant-combinator\""
+    ",\"position\":{\"x\":-43.5,\"y\":-93.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"woo"
+    "d\"},\"count\":-16775776,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16775775,\"index\":2}"
+    ",{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16775774,\"index\":3},{\"signal\":{\"type\":\"item\",\"na"
+    "me\":\"iron-ore\"},\"count\":-16775773,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-1"
+    "6775772,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16775771,\"index\":6},{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16775770,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "iron-plate\"},\"count\":-16775769,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-1677"
+    "5768,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16775767,\"index\":10},{\"signal\":"
+    "{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16775766,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "plastic-bar\"},\"count\":-16775765,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16775764"
+    ",\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16775763,\"index\":14},{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"explosives\"},\"count\":-16775762,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-"
+    "oil-barrel\"},\"count\":-16775761,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":115},{\"entity_id\":11"
+    "9}]}}},{\"entity_number\":121,\"name\":\"constant-combinator\",\"position\":{\"x\":-42.5,\"y\":-92.5},\"control_behavior"
+    "\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16775632,\"index\":1},{\"signa"
+    "l\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16775631,\"index\":2},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"lubricant-barrel\"},\"count\":-16775630,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-ba"
+    "rrel\"},\"count\":-16775629,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16"
+    "775628,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16775627,\"index\":6},{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16775626,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"iron-stick\"},\"count\":-16775625,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\""
+    ":-16775624,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16775623,\"index\":10},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16775622,\"index\":11},{\"signal\":{\"type\":\"it"
+    "em\",\"name\":\"advanced-circuit\"},\"count\":-16775621,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processi"
+    "ng-unit\"},\"count\":-16775620,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-1677561"
+    "9,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16775618,\"index\":15},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16775617,\"index\":16}]},\"connections\":{\"1\":{"
+    "\"red\":[{\"entity_id\":122},{\"entity_id\":124,\"circuit_id\":1}]}}},{\"entity_number\":122,\"name\":\"constant-combina"
+    "tor\",\"position\":{\"x\":-43.5,\"y\":-92.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"wood\"},\"count\":-16775648,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16775647,\"index"
+    "\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16775646,\"index\":3},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"iron-ore\"},\"count\":-16775645,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count"
+    "\":-16775644,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16775643,\"index\":6},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16775642,\"index\":7},{\"signal\":{\"type\":\"item\",\"name"
+    "\":\"iron-plate\"},\"count\":-16775641,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":"
+    "-16775640,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16775639,\"index\":10},{\"sign"
+    "al\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16775638,\"index\":11},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"plastic-bar\"},\"count\":-16775637,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16"
+    "775636,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16775635,\"index\":14},{\"signal\":"
+    "{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16775634,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "crude-oil-barrel\"},\"count\":-16775633,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":117},{\"entity_i"
+    "d\":121}]}}},{\"entity_number\":123,\"name\":\"decider-combinator\",\"position\":{\"x\":-41,\"y\":-93.5},\"direction\":2"
+    ",\"control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"const"
+    "ant\":22,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_"
+    "input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":119}],\"green\":[{\"entity_id\":104,\"circuit_id\":1},{\""
+    "entity_id\":124,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":104,\"circuit_id\":2},{\"entity_id\":124,\"circuit_id"
+    "\":2}]}}},{\"entity_number\":124,\"name\":\"decider-combinator\",\"position\":{\"x\":-41,\"y\":-92.5},\"direction\":2,\""
+    "control_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant"
+    "\":24,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_inp"
+    "ut\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":121}],\"green\":[{\"entity_id\":123,\"circuit_id\":1},{\"ent"
+    "ity_id\":144,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":123,\"circuit_id\":2},{\"entity_id\":144,\"circuit_id\":"
+    "2}]}}},{\"entity_number\":125,\"name\":\"constant-combinator\",\"position\":{\"x\":-39.5,\"y\":-93.5},\"control_behavior"
+    "\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16775744,\"index\":1},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16775743,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":"
+    "\"signal-2\"},\"count\":-16775742,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16775"
+    "741,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16775740,\"index\":5},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16775739,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":"
+    "\"signal-6\"},\"count\":-16775738,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16775"
+    "737,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16775736,\"index\":9},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16775735,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-A\"},\"count\":-16775734,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-167"
+    "75733,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16775732,\"index\":13},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16775731,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-E\"},\"count\":-16775730,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":"
+    "-16775729,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":126}]}}},{\"entity_number\":126,\"name\":\"con"
+    "stant-combinator\",\"position\":{\"x\":-38.5,\"y\":-93.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-G\"},\"count\":-16775728,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},"
+    "\"count\":-16775727,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16775726,\"index\":"
+    "3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16775725,\"index\":4},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-K\"},\"count\":-16775724,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},"
+    "\"count\":-16775723,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16775722,\"index"
+    "\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16775721,\"index\":8},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-O\"},\"count\":-16775720,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\""
+    "},\"count\":-16775719,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16775718,\"index"
+    "\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16775717,\"index\":12},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-S\"},\"count\":-16775716,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-T\"},\"count\":-16775715,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16775714,\"i"
+    "ndex\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16775713,\"index\":16}]},\"connections\":"
+    "{\"1\":{\"red\":[{\"entity_id\":125},{\"entity_id\":129}]}}},{\"entity_number\":127,\"name\":\"constant-combinator\",\"p"
+    "osition\":{\"x\":-39.5,\"y\":-92.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-0\"},\"count\":-16775616,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16775615,\""
+    "index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16775614,\"index\":3},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16775613,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-4\"},\"count\":-16775612,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16775611,\""
+    "index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16775610,\"index\":7},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16775609,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-8\"},\"count\":-16775608,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16775607,\""
+    "index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16775606,\"index\":11},{\"signal\":{\"ty"
+    "pe\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16775605,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-C\"},\"count\":-16775604,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-1677560"
+    "3,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16775602,\"index\":15},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16775601,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"enti"
+    "ty_id\":128}]}}},{\"entity_number\":128,\"name\":\"constant-combinator\",\"position\":{\"x\":-38.5,\"y\":-92.5},\"contro"
+    "l_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16775600,\"index\":1},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16775599,\"index\":2},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-I\"},\"count\":-16775598,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"coun"
+    "t\":-16775597,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16775596,\"index\":5},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16775595,\"index\":6},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-pink\"},\"count\":-16775594,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"c"
+    "ount\":-16775593,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16775592,\"index\":9},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16775591,\"index\":10},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-Q\"},\"count\":-16775590,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\""
+    "count\":-16775589,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16775588,\"index\":1"
+    "3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16775587,\"index\":14},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-U\"},\"count\":-16775586,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\""
+    "},\"count\":-16775585,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":127},{\"entity_id\":131}]}}},{\"en"
+    "tity_number\":129,\"name\":\"constant-combinator\",\"position\":{\"x\":-37.5,\"y\":-93.5},\"control_behavior\":{\"filter"
+    "s\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16775712,\"index\":1},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"coal\"},\"count\":-16775711,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16775710"
+    ",\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16775709,\"index\":4},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"copper-ore\"},\"count\":-16775708,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-"
+    "ore\"},\"count\":-16775707,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16775706,\"inde"
+    "x\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16775705,\"index\":8},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"copper-plate\"},\"count\":-16775704,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\""
+    "},\"count\":-16775703,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16775702,\"index"
+    "\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16775701,\"index\":12},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"sulfur\"},\"count\":-16775700,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"c"
+    "ount\":-16775699,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16775698,\"index\":15}"
+    ",{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16775697,\"index\":16}]},\"connections\":{\"1\""
+    ":{\"red\":[{\"entity_id\":126},{\"entity_id\":130}]}}},{\"entity_number\":130,\"name\":\"constant-combinator\",\"positio"
+    "n\":{\"x\":-36.5,\"y\":-93.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-bar"
+    "rel\"},\"count\":-16775696,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-1677569"
+    "5,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16775694,\"index\":3},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16775693,\"index\":4},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"sulfuric-acid-barrel\"},\"count\":-16775692,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel"
+    "\"},\"count\":-16775691,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16775690,\"ind"
+    "ex\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16775689,\"index\":8},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"iron-gear-wheel\"},\"count\":-16775688,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-ba"
+    "rrel\"},\"count\":-16775687,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-167"
+    "75686,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16775685,\"index\":12},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16775684,\"index\":13},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"engine-unit\"},\"count\":-16775683,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-u"
+    "nit\"},\"count\":-16775682,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-1677"
+    "5681,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":129},{\"entity_id\":133,\"circuit_id\":1}]}}},{\"en"
+    "tity_number\":131,\"name\":\"constant-combinator\",\"position\":{\"x\":-37.5,\"y\":-92.5},\"control_behavior\":{\"filter"
+    "s\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16775584,\"index\":1},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"coal\"},\"count\":-16775583,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16775582"
+    ",\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16775581,\"index\":4},{\"signal\":{\"type"
+    "\":\"item\",\"name\":\"copper-ore\"},\"count\":-16775580,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-"
+    "ore\"},\"count\":-16775579,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16775578,\"inde"
+    "x\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16775577,\"index\":8},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"copper-plate\"},\"count\":-16775576,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\""
+    "},\"count\":-16775575,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16775574,\"index"
+    "\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16775573,\"index\":12},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"sulfur\"},\"count\":-16775572,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"c"
+    "ount\":-16775571,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16775570,\"index\":15}"
+    ",{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16775569,\"index\":16}]},\"connections\":{\"1\""
+    ":{\"red\":[{\"entity_id\":128},{\"entity_id\":132}]}}},{\"entity_number\":132,\"name\":\"constant-combinator\",\"positio"
+    "n\":{\"x\":-36.5,\"y\":-92.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-bar"
+    "rel\"},\"count\":-16775568,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-1677556"
+    "7,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16775566,\"index\":3},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16775565,\"index\":4},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"sulfuric-acid-barrel\"},\"count\":-16775564,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel"
+    "\"},\"count\":-16775563,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16775562,\"ind"
+    "ex\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16775561,\"index\":8},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"iron-gear-wheel\"},\"count\":-16775560,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-ba"
+    "rrel\"},\"count\":-16775559,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-167"
+    "75558,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16775557,\"index\":12},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16775556,\"index\":13},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"engine-unit\"},\"count\":-16775555,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-u"
+    "nit\"},\"count\":-16775554,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-1677"
+    "5553,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":131},{\"entity_id\":134,\"circuit_id\":1}]}}},{\"en"
+    "tity_number\":133,\"name\":\"decider-combinator\",\"position\":{\"x\":-35,\"y\":-93.5},\"direction\":2,\"control_behavio"
+    "r\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":23,\"compara"
+    "tor\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"c"
+    "onnections\":{\"1\":{\"red\":[{\"entity_id\":130}],\"green\":[{\"entity_id\":114,\"circuit_id\":1},{\"entity_id\":134,\""
+    "circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":114,\"circuit_id\":2},{\"entity_id\":134,\"circuit_id\":2}]}}},{\"entit"
+    "y_number\":134,\"name\":\"decider-combinator\",\"position\":{\"x\":-35,\"y\":-92.5},\"direction\":2,\"control_behavior\""
+    ":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":25,\"comparator"
+    "\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"conn"
+    "ections\":{\"1\":{\"red\":[{\"entity_id\":132}],\"green\":[{\"entity_id\":133,\"circuit_id\":1},{\"entity_id\":154,\"cir"
+    "cuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":133,\"circuit_id\":2},{\"entity_id\":154,\"circuit_id\":2}]}}},{\"entity_n"
+    "umber\":135,\"name\":\"constant-combinator\",\"position\":{\"x\":-45.5,\"y\":-90.5},\"control_behavior\":{\"filters\":[{"
+    "\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16775424,\"index\":1},{\"signal\":{\"type\":\"virtual"
+    "\",\"name\":\"signal-1\"},\"count\":-16775423,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"co"
+    "unt\":-16775422,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16775421,\"index\":4},{"
+    "\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16775420,\"index\":5},{\"signal\":{\"type\":\"virtual"
+    "\",\"name\":\"signal-5\"},\"count\":-16775419,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"co"
+    "unt\":-16775418,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16775417,\"index\":8},{"
+    "\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16775416,\"index\":9},{\"signal\":{\"type\":\"virtual"
+    "\",\"name\":\"signal-9\"},\"count\":-16775415,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"c"
+    "ount\":-16775414,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16775413,\"index\":12"
+    "},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16775412,\"index\":13},{\"signal\":{\"type\":\"vir"
+    "tual\",\"name\":\"signal-D\"},\"count\":-16775411,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"}"
+    ",\"count\":-16775410,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16775409,\"index\""
+    ":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":136}]}}},{\"entity_number\":136,\"name\":\"constant-combinator\","
+    "\"position\":{\"x\":-44.5,\"y\":-90.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-G\"},\"count\":-16775408,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16775407"
+    ",\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16775406,\"index\":3},{\"signal\":{\"t"
+    "ype\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16775405,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-K\"},\"count\":-16775404,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16775403"
+    ",\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16775402,\"index\":7},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16775401,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":"
+    "\"signal-O\"},\"count\":-16775400,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16775"
+    "399,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16775398,\"index\":11},{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16775397,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name"
+    "\":\"signal-S\"},\"count\":-16775396,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-1"
+    "6775395,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16775394,\"index\":15},{\"sign"
+    "al\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16775393,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{"
+    "\"entity_id\":135},{\"entity_id\":139}]}}},{\"entity_number\":137,\"name\":\"constant-combinator\",\"position\":{\"x\":-"
+    "44.5,\"y\":-91.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":"
+    "-16775536,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16775535,\"index\":2},{\"sign"
+    "al\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16775534,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"n"
+    "ame\":\"signal-J\"},\"count\":-16775533,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":"
+    "-16775532,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16775531,\"index\":6},{\"sign"
+    "al\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16775530,\"index\":7},{\"signal\":{\"type\":\"virtual\","
+    "\"name\":\"signal-N\"},\"count\":-16775529,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count"
+    "\":-16775528,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16775527,\"index\":10},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16775526,\"index\":11},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-R\"},\"count\":-16775525,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"cou"
+    "nt\":-16775524,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16775523,\"index\":14},"
+    "{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16775522,\"index\":15},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-V\"},\"count\":-16775521,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":138},{\""
+    "entity_id\":142}]}}},{\"entity_number\":138,\"name\":\"constant-combinator\",\"position\":{\"x\":-45.5,\"y\":-91.5},\"co"
+    "ntrol_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16775552,\"index\":1}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16775551,\"index\":2},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-2\"},\"count\":-16775550,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\""
+    "count\":-16775549,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16775548,\"index\":5}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16775547,\"index\":6},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-6\"},\"count\":-16775546,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\""
+    "count\":-16775545,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16775544,\"index\":9}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16775543,\"index\":10},{\"signal\":{\"type\":\"virt"
+    "ual\",\"name\":\"signal-A\"},\"count\":-16775542,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},"
+    "\"count\":-16775541,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16775540,\"index\""
+    ":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16775539,\"index\":14},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-E\"},\"count\":-16775538,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F"
+    "\"},\"count\":-16775537,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":137}]}}},{\"entity_number\":139,"
+    "\"name\":\"constant-combinator\",\"position\":{\"x\":-43.5,\"y\":-90.5},\"control_behavior\":{\"filters\":[{\"signal\":{"
+    "\"type\":\"item\",\"name\":\"wood\"},\"count\":-16775392,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},"
+    "\"count\":-16775391,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16775390,\"index\":3},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16775389,\"index\":4},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"copper-ore\"},\"count\":-16775388,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":"
+    "-16775387,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16775386,\"index\":7},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16775385,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "copper-plate\"},\"count\":-16775384,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-1677"
+    "5383,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16775382,\"index\":11},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16775381,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"sulfur\"},\"count\":-16775380,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16775379,\""
+    "index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16775378,\"index\":15},{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16775377,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"enti"
+    "ty_id\":136},{\"entity_id\":140}]}}},{\"entity_number\":140,\"name\":\"constant-combinator\",\"position\":{\"x\":-42.5,\""
+    "y\":-90.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-1"
+    "6775376,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16775375,\"index\":2},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16775374,\"index\":3},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"petroleum-gas-barrel\"},\"count\":-16775373,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-"
+    "acid-barrel\"},\"count\":-16775372,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-167"
+    "75371,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16775370,\"index\":7},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16775369,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "iron-gear-wheel\"},\"count\":-16775368,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":"
+    "-16775367,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16775366,\"index\":11"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16775365,\"index\":12},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"processing-unit\"},\"count\":-16775364,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engin"
+    "e-unit\"},\"count\":-16775363,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":"
+    "-16775362,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16775361,\"index\":16"
+    "}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":139},{\"entity_id\":143,\"circuit_id\":1}]}}},{\"entity_number\":141"
+    ",\"name\":\"constant-combinator\",\"position\":{\"x\":-42.5,\"y\":-91.5},\"control_behavior\":{\"filters\":[{\"signal\":"
+    "{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16775504,\"index\":1},{\"signal\":{\"type\":\"item\",\"name"
+    "\":\"light-oil-barrel\"},\"count\":-16775503,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},"
+    "\"count\":-16775502,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16775501,\""
+    "index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16775500,\"index\":5},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16775499,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"copper-cable\"},\"count\":-16775498,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16"
+    "775497,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16775496,\"index\":9},{\"sig"
+    "nal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16775495,\"index\":10},{\"signal\":{\"type\":\"item\",\"n"
+    "ame\":\"electronic-circuit\"},\"count\":-16775494,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circu"
+    "it\"},\"count\":-16775493,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16775492"
+    ",\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16775491,\"index\":14},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16775490,\"index\":15},{\"signal\":{\"type\":\"item\",\"na"
+    "me\":\"flying-robot-frame\"},\"count\":-16775489,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":142},{\""
+    "entity_id\":144,\"circuit_id\":1}]}}},{\"entity_number\":142,\"name\":\"constant-combinator\",\"position\":{\"x\":-43.5,"
+    "\"y\":-91.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16775520,\""
+    "index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16775519,\"index\":2},{\"signal\":{\"type\":\"it"
+    "em\",\"name\":\"stone\"},\"count\":-16775518,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\""
+    ":-16775517,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16775516,\"index\":5},{\"sign"
+    "al\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16775515,\"index\":6},{\"signal\":{\"type\":\"item\",\"name"
+    "\":\"raw-fish\"},\"count\":-16775514,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-167"
+    "75513,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16775512,\"index\":9},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16775511,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "steel-plate\"},\"count\":-16775510,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-167"
+    "75509,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16775508,\"index\":13},{\"signal\":{\""
+    "type\":\"item\",\"name\":\"battery\"},\"count\":-16775507,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explos"
+    "ives\"},\"count\":-16775506,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16775"
+    "505,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":137},{\"entity_id\":141}]}}},{\"entity_number\":143,"
+    "\"name\":\"decider-combinator\",\"position\":{\"x\":-41,\"y\":-90.5},\"direction\":2,\"control_behavior\":{\"decider_con"
+    "ditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":28,\"comparator\":\"=\",\"outp"
+    "ut_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\""
+    ":{\"red\":[{\"entity_id\":140}],\"green\":[{\"entity_id\":144,\"circuit_id\":1},{\"entity_id\":159,\"circuit_id\":1}]},\""
+    "2\":{\"red\":[{\"entity_id\":144,\"circuit_id\":2},{\"entity_id\":159,\"circuit_id\":2}]}}},{\"entity_number\":144,\"nam"
+    "e\":\"decider-combinator\",\"position\":{\"x\":-41,\"y\":-91.5},\"direction\":2,\"control_behavior\":{\"decider_conditio"
+    "ns\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":26,\"comparator\":\"=\",\"output_si"
+    "gnal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\""
+    "red\":[{\"entity_id\":141}],\"green\":[{\"entity_id\":124,\"circuit_id\":1},{\"entity_id\":143,\"circuit_id\":1}]},\"2\""
+    ":{\"red\":[{\"entity_id\":124,\"circuit_id\":2},{\"entity_id\":143,\"circuit_id\":2}]}}},{\"entity_number\":145,\"name\""
+    ":\"constant-combinator\",\"position\":{\"x\":-38.5,\"y\":-90.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-G\"},\"count\":-16775344,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-H\"},\"count\":-16775343,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16775342,\"in"
+    "dex\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16775341,\"index\":4},{\"signal\":{\"type\""
+    ":\"virtual\",\"name\":\"signal-K\"},\"count\":-16775340,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-L\"},\"count\":-16775339,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16775338,\""
+    "index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16775337,\"index\":8},{\"signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16775336,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"sign"
+    "al-P\"},\"count\":-16775335,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16775334,\""
+    "index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16775333,\"index\":12},{\"signal\":{\"ty"
+    "pe\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16775332,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"s"
+    "ignal-T\"},\"count\":-16775331,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-1677533"
+    "0,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16775329,\"index\":16}]},\"connectio"
+    "ns\":{\"1\":{\"red\":[{\"entity_id\":146},{\"entity_id\":150}]}}},{\"entity_number\":146,\"name\":\"constant-combinator\""
+    ",\"position\":{\"x\":-39.5,\"y\":-90.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-0\"},\"count\":-16775360,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-1677535"
+    "9,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16775358,\"index\":3},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16775357,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-4\"},\"count\":-16775356,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-1677535"
+    "5,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16775354,\"index\":7},{\"signal\":{\""
+    "type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16775353,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\""
+    "signal-8\"},\"count\":-16775352,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-1677535"
+    "1,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16775350,\"index\":11},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16775349,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-C\"},\"count\":-16775348,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-167"
+    "75347,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16775346,\"index\":15},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16775345,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\""
+    "entity_id\":145}]}}},{\"entity_number\":147,\"name\":\"constant-combinator\",\"position\":{\"x\":-39.5,\"y\":-91.5},\"co"
+    "ntrol_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16775488,\"index\":1}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16775487,\"index\":2},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-2\"},\"count\":-16775486,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\""
+    "count\":-16775485,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16775484,\"index\":5}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16775483,\"index\":6},{\"signal\":{\"type\":\"virtu"
+    "al\",\"name\":\"signal-6\"},\"count\":-16775482,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\""
+    "count\":-16775481,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16775480,\"index\":9}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16775479,\"index\":10},{\"signal\":{\"type\":\"virt"
+    "ual\",\"name\":\"signal-A\"},\"count\":-16775478,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},"
+    "\"count\":-16775477,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16775476,\"index\""
+    ":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16775475,\"index\":14},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-E\"},\"count\":-16775474,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-F"
+    "\"},\"count\":-16775473,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":148}]}}},{\"entity_number\":148,"
+    "\"name\":\"constant-combinator\",\"position\":{\"x\":-38.5,\"y\":-91.5},\"control_behavior\":{\"filters\":[{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16775472,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":"
+    "\"signal-H\"},\"count\":-16775471,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16775"
+    "470,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\"},\"count\":-16775469,\"index\":4},{\"signal\":{"
+    "\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16775468,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":"
+    "\"signal-L\"},\"count\":-16775467,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16"
+    "775466,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N\"},\"count\":-16775465,\"index\":8},{\"signal\""
+    ":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16775464,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\""
+    ":\"signal-P\"},\"count\":-16775463,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-167"
+    "75462,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-R\"},\"count\":-16775461,\"index\":12},{\"signal"
+    "\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16775460,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-T\"},\"count\":-16775459,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":"
+    "-16775458,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-V\"},\"count\":-16775457,\"index\":16}]},\"c"
+    "onnections\":{\"1\":{\"red\":[{\"entity_id\":147},{\"entity_id\":151}]}}},{\"entity_number\":149,\"name\":\"constant-com"
+    "binator\",\"position\":{\"x\":-36.5,\"y\":-90.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"heavy-oil-barrel\"},\"count\":-16775312,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"}"
+    ",\"count\":-16775311,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16775310,\"in"
+    "dex\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16775309,\"index\":4},{\"signal\":"
+    "{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16775308,\"index\":5},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"water-barrel\"},\"count\":-16775307,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"co"
+    "unt\":-16775306,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16775305,\"index\":8},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16775304,\"index\":9},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"empty-barrel\"},\"count\":-16775303,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circu"
+    "it\"},\"count\":-16775302,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-1677530"
+    "1,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16775300,\"index\":13},{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16775299,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"electric-engine-unit\"},\"count\":-16775298,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-fram"
+    "e\"},\"count\":-16775297,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":150},{\"entity_id\":153,\"circu"
+    "it_id\":1}]}}},{\"entity_number\":150,\"name\":\"constant-combinator\",\"position\":{\"x\":-37.5,\"y\":-90.5},\"control_"
+    "behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16775328,\"index\":1},{\"signal\":"
+    "{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16775327,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\""
+    "},\"count\":-16775326,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16775325,\"index\":4"
+    "},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16775324,\"index\":5},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"uranium-ore\"},\"count\":-16775323,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"coun"
+    "t\":-16775322,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16775321,\"index\":8},{\"s"
+    "ignal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16775320,\"index\":9},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"solid-fuel\"},\"count\":-16775319,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"coun"
+    "t\":-16775318,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16775317,\"index\":12},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16775316,\"index\":13},{\"signal\":{\"type\":\"item\",\"na"
+    "me\":\"battery\"},\"count\":-16775315,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-1"
+    "6775314,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16775313,\"index\":16}]},"
+    "\"connections\":{\"1\":{\"red\":[{\"entity_id\":145},{\"entity_id\":149}]}}},{\"entity_number\":151,\"name\":\"constant-"
+    "combinator\",\"position\":{\"x\":-37.5,\"y\":-91.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\""
+    "name\":\"wood\"},\"count\":-16775456,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16775455,"
+    "\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":-16775454,\"index\":3},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"iron-ore\"},\"count\":-16775453,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\""
+    "count\":-16775452,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16775451,\"index\":6}"
+    ",{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-16775450,\"index\":7},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"iron-plate\"},\"count\":-16775449,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"coun"
+    "t\":-16775448,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16775447,\"index\":10},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-16775446,\"index\":11},{\"signal\":{\"type\":\"item\",\""
+    "name\":\"plastic-bar\"},\"count\":-16775445,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":"
+    "-16775444,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16775443,\"index\":14},{\"signal"
+    "\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16775442,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"crude-oil-barrel\"},\"count\":-16775441,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":148},{\"entit"
+    "y_id\":152}]}}},{\"entity_number\":152,\"name\":\"constant-combinator\",\"position\":{\"x\":-36.5,\"y\":-91.5},\"control"
+    "_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16775440,\"index\":1}"
+    ",{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\":-16775439,\"index\":2},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"lubricant-barrel\"},\"count\":-16775438,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petrole"
+    "um-gas-barrel\"},\"count\":-16775437,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"co"
+    "unt\":-16775436,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16775435,\"index\":6},"
+    "{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-16775434,\"index\":7},{\"signal\":{\"type\":\"item\""
+    ",\"name\":\"iron-stick\"},\"count\":-16775433,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},"
+    "\"count\":-16775432,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16775431,\"index\""
+    ":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"count\":-16775430,\"index\":11},{\"signal\":{\"ty"
+    "pe\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16775429,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "processing-unit\"},\"count\":-16775428,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":"
+    "-16775427,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16775426,\"index\":"
+    "15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"count\":-16775425,\"index\":16}]},\"connections\":"
+    "{\"1\":{\"red\":[{\"entity_id\":151},{\"entity_id\":154,\"circuit_id\":1}]}}},{\"entity_number\":153,\"name\":\"decider-"
+    "combinator\",\"position\":{\"x\":-35,\"y\":-90.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_"
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":29,\"comparator\":\"=\",\"output_signal\":{\"type"
+    "\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"enti"
+    "ty_id\":149}],\"green\":[{\"entity_id\":154,\"circuit_id\":1},{\"entity_id\":164,\"circuit_id\":1}]},\"2\":{\"red\":[{\""
+    "entity_id\":154,\"circuit_id\":2},{\"entity_id\":164,\"circuit_id\":2}]}}},{\"entity_number\":154,\"name\":\"decider-com"
+    "binator\",\"position\":{\"x\":-35,\"y\":-91.5},\"direction\":2,\"control_behavior\":{\"decider_conditions\":{\"first_sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":27,\"comparator\":\"=\",\"output_signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\":{\"1\":{\"red\":[{\"entity_"
+    "id\":152}],\"green\":[{\"entity_id\":134,\"circuit_id\":1},{\"entity_id\":153,\"circuit_id\":1}]},\"2\":{\"red\":[{\"ent"
+    "ity_id\":134,\"circuit_id\":2},{\"entity_id\":153,\"circuit_id\":2}]}}},{\"entity_number\":155,\"name\":\"constant-combi"
+    "nator\",\"position\":{\"x\":-45.5,\"y\":-89.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-0\"},\"count\":-16775296,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-"
+    "16775295,\"index\":2},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-2\"},\"count\":-16775294,\"index\":3},{\"signa"
+    "l\":{\"type\":\"virtual\",\"name\":\"signal-3\"},\"count\":-16775293,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-4\"},\"count\":-16775292,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-"
+    "16775291,\"index\":6},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-6\"},\"count\":-16775290,\"index\":7},{\"signa"
+    "l\":{\"type\":\"virtual\",\"name\":\"signal-7\"},\"count\":-16775289,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"na"
+    "me\":\"signal-8\"},\"count\":-16775288,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-"
+    "16775287,\"index\":10},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-A\"},\"count\":-16775286,\"index\":11},{\"sig"
+    "nal\":{\"type\":\"virtual\",\"name\":\"signal-B\"},\"count\":-16775285,\"index\":12},{\"signal\":{\"type\":\"virtual\",\""
+    "name\":\"signal-C\"},\"count\":-16775284,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\""
+    ":-16775283,\"index\":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-E\"},\"count\":-16775282,\"index\":15},{\"s"
+    "ignal\":{\"type\":\"virtual\",\"name\":\"signal-F\"},\"count\":-16775281,\"index\":16}]},\"connections\":{\"1\":{\"red\""
+    ":[{\"entity_id\":156}]}}},{\"entity_number\":156,\"name\":\"constant-combinator\",\"position\":{\"x\":-44.5,\"y\":-89.5}"
+    ",\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"count\":-16775280,\"index"
+    "\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16775279,\"index\":2},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-I\"},\"count\":-16775278,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-J\""
+    "},\"count\":-16775277,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"count\":-16775276,\"index\""
+    ":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16775275,\"index\":6},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-pink\"},\"count\":-16775274,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-N"
+    "\"},\"count\":-16775273,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"count\":-16775272,\"inde"
+    "x\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16775271,\"index\":10},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-Q\"},\"count\":-16775270,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-R\"},\"count\":-16775269,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},\"count\":-16775268,\"i"
+    "ndex\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16775267,\"index\":14},{\"signal\":{\"typ"
+    "e\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16775266,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"si"
+    "gnal-V\"},\"count\":-16775265,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":155},{\"entity_id\":157}]}"
+    "}},{\"entity_number\":157,\"name\":\"constant-combinator\",\"position\":{\"x\":-43.5,\"y\":-89.5},\"control_behavior\":{"
+    "\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-16775264,\"index\":1},{\"signal\":{\"type\":\""
+    "item\",\"name\":\"coal\"},\"count\":-16775263,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"stone\"},\"count\":"
+    "-16775262,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"count\":-16775261,\"index\":4},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16775260,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\""
+    "uranium-ore\"},\"count\":-16775259,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"raw-fish\"},\"count\":-1677525"
+    "8,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\":-16775257,\"index\":8},{\"signal\":{\"t"
+    "ype\":\"item\",\"name\":\"copper-plate\"},\"count\":-16775256,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\":\"sol"
+    "id-fuel\"},\"count\":-16775255,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"steel-plate\"},\"count\":-1677525"
+    "4,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count\":-16775253,\"index\":12},{\"signal\":{"
+    "\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16775252,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"batte"
+    "ry\"},\"count\":-16775251,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"explosives\"},\"count\":-16775250,\"in"
+    "dex\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\":-16775249,\"index\":16}]},\"connection"
+    "s\":{\"1\":{\"red\":[{\"entity_id\":156},{\"entity_id\":158}]}}},{\"entity_number\":158,\"name\":\"constant-combinator\""
+    ",\"position\":{\"x\":-42.5,\"y\":-89.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"hea"
+    "vy-oil-barrel\"},\"count\":-16775248,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"light-oil-barrel\"},\"count\""
+    ":-16775247,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"},\"count\":-16775246,\"index\":3},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16775245,\"index\":4},{\"signal\":{\"type\":"
+    "\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16775244,\"index\":5},{\"signal\":{\"type\":\"item\",\"name\":\"w"
+    "ater-barrel\"},\"count\":-16775243,\"index\":6},{\"signal\":{\"type\":\"item\",\"name\":\"copper-cable\"},\"count\":-167"
+    "75242,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":-16775241,\"index\":8},{\"signal\":"
+    "{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16775240,\"index\":9},{\"signal\":{\"type\":\"item\",\"name\""
+    ":\"empty-barrel\"},\"count\":-16775239,\"index\":10},{\"signal\":{\"type\":\"item\",\"name\":\"electronic-circuit\"},\"c"
+    "ount\":-16775238,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-circuit\"},\"count\":-16775237,\"index"
+    "\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16775236,\"index\":13},{\"signal\":{\"typ"
+    "e\":\"item\",\"name\":\"engine-unit\"},\"count\":-16775235,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":\"elect"
+    "ric-engine-unit\"},\"count\":-16775234,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"flying-robot-frame\"},\"c"
+    "ount\":-16775233,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":157},{\"entity_id\":159,\"circuit_id\":"
+    "1}]}}},{\"entity_number\":159,\"name\":\"decider-combinator\",\"position\":{\"x\":-41,\"y\":-89.5},\"direction\":2,\"con"
+    "trol_behavior\":{\"decider_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":"
+    "30,\"comparator\":\"=\",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\""
+    ":true}},\"connections\":{\"1\":{\"red\":[{\"entity_id\":158}],\"green\":[{\"entity_id\":143,\"circuit_id\":1}]},\"2\":{\""
+    "red\":[{\"entity_id\":143,\"circuit_id\":2}]}}},{\"entity_number\":160,\"name\":\"constant-combinator\",\"position\":{\""
+    "x\":-38.5,\"y\":-89.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-G\"},\"cou"
+    "nt\":-16775216,\"index\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-H\"},\"count\":-16775215,\"index\":2},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-I\"},\"count\":-16775214,\"index\":3},{\"signal\":{\"type\":\"virtual\""
+    ",\"name\":\"signal-J\"},\"count\":-16775213,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-K\"},\"coun"
+    "t\":-16775212,\"index\":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-L\"},\"count\":-16775211,\"index\":6},{\""
+    "signal\":{\"type\":\"virtual\",\"name\":\"signal-pink\"},\"count\":-16775210,\"index\":7},{\"signal\":{\"type\":\"virtua"
+    "l\",\"name\":\"signal-N\"},\"count\":-16775209,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-O\"},\"c"
+    "ount\":-16775208,\"index\":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-P\"},\"count\":-16775207,\"index\":10}"
+    ",{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-Q\"},\"count\":-16775206,\"index\":11},{\"signal\":{\"type\":\"virt"
+    "ual\",\"name\":\"signal-R\"},\"count\":-16775205,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-S\"},"
+    "\"count\":-16775204,\"index\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-T\"},\"count\":-16775203,\"index\""
+    ":14},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-U\"},\"count\":-16775202,\"index\":15},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-V\"},\"count\":-16775201,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":161"
+    "},{\"entity_id\":163}]}}},{\"entity_number\":161,\"name\":\"constant-combinator\",\"position\":{\"x\":-39.5,\"y\":-89.5}"
+    ",\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-0\"},\"count\":-16775232,\"index"
+    "\":1},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-1\"},\"count\":-16775231,\"index\":2},{\"signal\":{\"type\":\""
+    "virtual\",\"name\":\"signal-2\"},\"count\":-16775230,\"index\":3},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-3\""
+    "},\"count\":-16775229,\"index\":4},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-4\"},\"count\":-16775228,\"index\""
+    ":5},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-5\"},\"count\":-16775227,\"index\":6},{\"signal\":{\"type\":\"vi"
+    "rtual\",\"name\":\"signal-6\"},\"count\":-16775226,\"index\":7},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-7\"}"
+    ",\"count\":-16775225,\"index\":8},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-8\"},\"count\":-16775224,\"index\""
+    ":9},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-9\"},\"count\":-16775223,\"index\":10},{\"signal\":{\"type\":\"v"
+    "irtual\",\"name\":\"signal-A\"},\"count\":-16775222,\"index\":11},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-B\""
+    "},\"count\":-16775221,\"index\":12},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-C\"},\"count\":-16775220,\"index"
+    "\":13},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal-D\"},\"count\":-16775219,\"index\":14},{\"signal\":{\"type\":"
+    "\"virtual\",\"name\":\"signal-E\"},\"count\":-16775218,\"index\":15},{\"signal\":{\"type\":\"virtual\",\"name\":\"signal"
+    "-F\"},\"count\":-16775217,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":160}]}}},{\"entity_number\":16"
+    "2,\"name\":\"constant-combinator\",\"position\":{\"x\":-36.5,\"y\":-89.5},\"control_behavior\":{\"filters\":[{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"heavy-oil-barrel\"},\"count\":-16775184,\"index\":1},{\"signal\":{\"type\":\"item\",\"nam"
+    "e\":\"light-oil-barrel\"},\"count\":-16775183,\"index\":2},{\"signal\":{\"type\":\"item\",\"name\":\"lubricant-barrel\"}"
+    ",\"count\":-16775182,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"petroleum-gas-barrel\"},\"count\":-16775181,"
+    "\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"sulfuric-acid-barrel\"},\"count\":-16775180,\"index\":5},{\"signa"
+    "l\":{\"type\":\"item\",\"name\":\"water-barrel\"},\"count\":-16775179,\"index\":6},{\"signal\":{\"type\":\"item\",\"name"
+    "\":\"copper-cable\"},\"count\":-16775178,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-stick\"},\"count\":"
+    "-16775177,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"iron-gear-wheel\"},\"count\":-16775176,\"index\":9},{\""
+    "signal\":{\"type\":\"item\",\"name\":\"empty-barrel\"},\"count\":-16775175,\"index\":10},{\"signal\":{\"type\":\"item\","
+    "\"name\":\"electronic-circuit\"},\"count\":-16775174,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"advanced-ci"
+    "rcuit\"},\"count\":-16775173,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"processing-unit\"},\"count\":-16775"
+    "172,\"index\":13},{\"signal\":{\"type\":\"item\",\"name\":\"engine-unit\"},\"count\":-16775171,\"index\":14},{\"signal\""
+    ":{\"type\":\"item\",\"name\":\"electric-engine-unit\"},\"count\":-16775170,\"index\":15},{\"signal\":{\"type\":\"item\","
+    "\"name\":\"flying-robot-frame\"},\"count\":-16775169,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":163"
+    "},{\"entity_id\":164,\"circuit_id\":1}]}}},{\"entity_number\":163,\"name\":\"constant-combinator\",\"position\":{\"x\":-"
+    "37.5,\"y\":-89.5},\"control_behavior\":{\"filters\":[{\"signal\":{\"type\":\"item\",\"name\":\"wood\"},\"count\":-167752"
+    "00,\"index\":1},{\"signal\":{\"type\":\"item\",\"name\":\"coal\"},\"count\":-16775199,\"index\":2},{\"signal\":{\"type\""
+    ":\"item\",\"name\":\"stone\"},\"count\":-16775198,\"index\":3},{\"signal\":{\"type\":\"item\",\"name\":\"iron-ore\"},\"c"
+    "ount\":-16775197,\"index\":4},{\"signal\":{\"type\":\"item\",\"name\":\"copper-ore\"},\"count\":-16775196,\"index\":5},{"
+    "\"signal\":{\"type\":\"item\",\"name\":\"uranium-ore\"},\"count\":-16775195,\"index\":6},{\"signal\":{\"type\":\"item\","
+    "\"name\":\"raw-fish\"},\"count\":-16775194,\"index\":7},{\"signal\":{\"type\":\"item\",\"name\":\"iron-plate\"},\"count\""
+    ":-16775193,\"index\":8},{\"signal\":{\"type\":\"item\",\"name\":\"copper-plate\"},\"count\":-16775192,\"index\":9},{\"si"
+    "gnal\":{\"type\":\"item\",\"name\":\"solid-fuel\"},\"count\":-16775191,\"index\":10},{\"signal\":{\"type\":\"item\",\"na"
+    "me\":\"steel-plate\"},\"count\":-16775190,\"index\":11},{\"signal\":{\"type\":\"item\",\"name\":\"plastic-bar\"},\"count"
+    "\":-16775189,\"index\":12},{\"signal\":{\"type\":\"item\",\"name\":\"sulfur\"},\"count\":-16775188,\"index\":13},{\"sign"
+    "al\":{\"type\":\"item\",\"name\":\"battery\"},\"count\":-16775187,\"index\":14},{\"signal\":{\"type\":\"item\",\"name\":"
+    "\"explosives\"},\"count\":-16775186,\"index\":15},{\"signal\":{\"type\":\"item\",\"name\":\"crude-oil-barrel\"},\"count\""
+    ":-16775185,\"index\":16}]},\"connections\":{\"1\":{\"red\":[{\"entity_id\":160},{\"entity_id\":162}]}}},{\"entity_number"
+    "\":164,\"name\":\"decider-combinator\",\"position\":{\"x\":-35,\"y\":-89.5},\"direction\":2,\"control_behavior\":{\"deci"
+    "der_conditions\":{\"first_signal\":{\"type\":\"virtual\",\"name\":\"signal-check\"},\"constant\":31,\"comparator\":\"=\""
+    ",\"output_signal\":{\"type\":\"virtual\",\"name\":\"signal-everything\"},\"copy_count_from_input\":true}},\"connections\""
+    ":{\"1\":{\"red\":[{\"entity_id\":162}],\"green\":[{\"entity_id\":153,\"circuit_id\":1}]},\"2\":{\"red\":[{\"entity_id\":"
+    "153,\"circuit_id\":2}]}}}],\"item\":\"blueprint\",\"label\":\"64-value ROM\",\"version\":281479277838336}}";
+
+static const rom_span_t rom_11_spans[] = {
+    { 29, 123, ROM_SPAN_DESC },
+    { 841, 9, 16 },
+    { 917, 9, 17 },
+    { 993, 9, 18 },
+    { 1069, 9, 19 },
+    { 1145, 9, 20 },
+    { 1221, 9, 21 },
+    { 1300, 9, 22 },
+    { 1376, 9, 23 },
+    { 1452, 9, 24 },
+    { 1528, 9, 25 },
+    { 1605, 9, 26 },
+    { 1682, 9, 27 },
+    { 1759, 9, 28 },
+    { 1836, 9, 29 },
+    { 1913, 9, 30 },
+    { 1990, 9, 31 },
+    { 2245, 9, 0 },
+    { 2321, 9, 1 },
+    { 2397, 9, 2 },
+    { 2473, 9, 3 },
+    { 2549, 9, 4 },
+    { 2625, 9, 5 },
+    { 2701, 9, 6 },
+    { 2777, 9, 7 },
+    { 2853, 9, 8 },
+    { 2929, 9, 9 },
+    { 3006, 9, 10 },
+    { 3083, 9, 11 },
+    { 3160, 9, 12 },
+    { 3237, 9, 13 },
+    { 3314, 9, 14 },
+    { 3391, 9, 15 },
+    { 3635, 9, 48 },
+    { 3716, 9, 49 },
+    { 3797, 9, 50 },
+    { 3882, 9, 51 },
+    { 3967, 9, 52 },
+    { 4044, 9, 53 },
+    { 4121, 9, 54 },
+    { 4196, 9, 55 },
+    { 4276, 9, 56 },
+    { 4353, 9, 57 },
+    { 4437, 9, 58 },
+    { 4519, 9, 59 },
+    { 4600, 9, 60 },
+    { 4677, 9, 61 },
+    { 4763, 9, 62 },
+    { 4847, 9, 63 },
+    { 5110, 9, 32 },
+    { 5179, 9, 33 },
+    { 5249, 9, 34 },
+    { 5322, 9, 35 },
+    { 5397, 9, 36 },
+    { 5473, 9, 37 },
+    { 5546, 9, 38 },
+    { 5621, 9, 39 },
+    { 5698, 9, 40 },
+    { 5773, 9, 41 },
+    { 5850, 9, 42 },
+    { 5927, 9, 43 },
+    { 5999, 9, 44 },
+    { 6072, 9, 45 },
+    { 6148, 9, 46 },
+    { 6230, 9, 47 },
+    { 6519, 1, ROM_SPAN_ROW },
+    { 7014, 9, 64 },
+    { 7090, 9, 65 },
+    { 7166, 9, 66 },
+    { 7242, 9, 67 },
+    { 7318, 9, 68 },
+    { 7394, 9, 69 },
+    { 7470, 9, 70 },
+    { 7546, 9, 71 },
+    { 7622, 9, 72 },
+    { 7698, 9, 73 },
+    { 7775, 9, 74 },
+    { 7852, 9, 75 },
+    { 7929, 9, 76 },
+    { 8006, 9, 77 },
+    { 8083, 9, 78 },
+    { 8160, 9, 79 },
+    { 8399, 9, 80 },
+    { 8475, 9, 81 },
+    { 8551, 9, 82 },
+    { 8627, 9, 83 },
+    { 8703, 9, 84 },
+    { 8779, 9, 85 },
+    { 8858, 9, 86 },
+    { 8934, 9, 87 },
+    { 9010, 9, 88 },
+    { 9086, 9, 89 },
+    { 9163, 9, 90 },
+    { 9240, 9, 91 },
+    { 9317, 9, 92 },
+    { 9394, 9, 93 },
+    { 9471, 9, 94 },
+    { 9548, 9, 95 },
+    { 9796, 9, 96 },
+    { 9865, 9, 97 },
+    { 9935, 9, 98 },
+    { 10008, 9, 99 },
+    { 10083, 9, 100 },
+    { 10159, 9, 101 },
+    { 10232, 9, 102 },
+    { 10307, 9, 103 },
+    { 10384, 9, 104 },
+    { 10459, 9, 105 },
+    { 10536, 9, 106 },
+    { 10613, 9, 107 },
+    { 10685, 9, 108 },
+    { 10758, 9, 109 },
+    { 10834, 9, 110 },
+    { 10916, 9, 111 },
+    { 11178, 9, 112 },
+    { 11259, 9, 113 },
+    { 11340, 9, 114 },
+    { 11425, 9, 115 },
+    { 11510, 9, 116 },
+    { 11587, 9, 117 },
+    { 11664, 9, 118 },
+    { 11739, 9, 119 },
+    { 11819, 9, 120 },
+    { 11896, 9, 121 },
+    { 11980, 9, 122 },
+    { 12062, 9, 123 },
+    { 12143, 9, 124 },
+    { 12220, 9, 125 },
+    { 12306, 9, 126 },
+    { 12390, 9, 127 },
+    { 12696, 1, ROM_SPAN_ROW },
+    { 14206, 9, 256 },
+    { 14282, 9, 257 },
+    { 14358, 9, 258 },
+    { 14434, 9, 259 },
+    { 14510, 9, 260 },
+    { 14586, 9, 261 },
+    { 14662, 9, 262 },
+    { 14738, 9, 263 },
+    { 14814, 9, 264 },
+    { 14890, 9, 265 },
+    { 14967, 9, 266 },
+    { 15044, 9, 267 },
+    { 15121, 9, 268 },
+    { 15198, 9, 269 },
+    { 15275, 9, 270 },
+    { 15352, 9, 271 },
+    { 15593, 9, 272 },
+    { 15669, 9, 273 },
+    { 15745, 9, 274 },
+    { 15821, 9, 275 },
+    { 15897, 9, 276 },
+    { 15973, 9, 277 },
+    { 16052, 9, 278 },
+    { 16128, 9, 279 },
+    { 16204, 9, 280 },
+    { 16280, 9, 281 },
+    { 16357, 9, 282 },
+    { 16434, 9, 283 },
+    { 16511, 9, 284 },
+    { 16588, 9, 285 },
+    { 16665, 9, 286 },
+    { 16742, 9, 287 },
+    { 17000, 9, 144 },
+    { 17076, 9, 145 },
+    { 17152, 9, 146 },
+    { 17228, 9, 147 },
+    { 17304, 9, 148 },
+    { 17380, 9, 149 },
+    { 17459, 9, 150 },
+    { 17535, 9, 151 },
+    { 17611, 9, 152 },
+    { 17687, 9, 153 },
+    { 17764, 9, 154 },
+    { 17841, 9, 155 },
+    { 17918, 9, 156 },
+    { 17995, 9, 157 },
+    { 18072, 9, 158 },
+    { 18149, 9, 159 },
+    { 18407, 9, 128 },
+    { 18483, 9, 129 },
+    { 18559, 9, 130 },
+    { 18635, 9, 131 },
+    { 18711, 9, 132 },
+    { 18787, 9, 133 },
+    { 18863, 9, 134 },
+    { 18939, 9, 135 },
+    { 19015, 9, 136 },
+    { 19091, 9, 137 },
+    { 19168, 9, 138 },
+    { 19245, 9, 139 },
+    { 19322, 9, 140 },
+    { 19399, 9, 141 },
+    { 19476, 9, 142 },
+    { 19553, 9, 143 },
+    { 19787, 9, 288 },
+    { 19856, 9, 289 },
+    { 19926, 9, 290 },
+    { 19999, 9, 291 },
+    { 20074, 9, 292 },
+    { 20150, 9, 293 },
+    { 20223, 9, 294 },
+    { 20298, 9, 295 },
+    { 20375, 9, 296 },
+    { 20450, 9, 297 },
+    { 20527, 9, 298 },
+    { 20604, 9, 299 },
+    { 20676, 9, 300 },
+    { 20749, 9, 301 },
+    { 20825, 9, 302 },
+    { 20907, 9, 303 },
+    { 21170, 9, 304 },
+    { 21251, 9, 305 },
+    { 21332, 9, 306 },
+    { 21417, 9, 307 },
+    { 21502, 9, 308 },
+    { 21579, 9, 309 },
+    { 21656, 9, 310 },
+    { 21731, 9, 311 },
+    { 21811, 9, 312 },
+    { 21888, 9, 313 },
+    { 21972, 9, 314 },
+    { 22054, 9, 315 },
+    { 22135, 9, 316 },
+    { 22212, 9, 317 },
+    { 22298, 9, 318 },
+    { 22382, 9, 319 },
+    { 22660, 9, 176 },
+    { 22741, 9, 177 },
+    { 22822, 9, 178 },
+    { 22907, 9, 179 },
+    { 22992, 9, 180 },
+    { 23069, 9, 181 },
+    { 23146, 9, 182 },
+    { 23221, 9, 183 },
+    { 23301, 9, 184 },
+    { 23378, 9, 185 },
+    { 23462, 9, 186 },
+    { 23544, 9, 187 },
+    { 23625, 9, 188 },
+    { 23702, 9, 189 },
+    { 23788, 9, 190 },
+    { 23872, 9, 191 },
+    { 24138, 9, 160 },
+    { 24207, 9, 161 },
+    { 24277, 9, 162 },
+    { 24350, 9, 163 },
+    { 24425, 9, 164 },
+    { 24501, 9, 165 },
+    { 24574, 9, 166 },
+    { 24649, 9, 167 },
+    { 24726, 9, 168 },
+    { 24801, 9, 169 },
+    { 24878, 9, 170 },
+    { 24955, 9, 171 },
+    { 25027, 9, 172 },
+    { 25100, 9, 173 },
+    { 25176, 9, 174 },
+    { 25258, 9, 175 },
+    { 25550, 1, ROM_SPAN_ROW },
+    { 26065, 1, ROM_SPAN_ROW },
+    { 26544, 9, 336 },
+    { 26620, 9, 337 },
+    { 26696, 9, 338 },
+    { 26772, 9, 339 },
+    { 26848, 9, 340 },
+    { 26924, 9, 341 },
+    { 27003, 9, 342 },
+    { 27079, 9, 343 },
+    { 27155, 9, 344 },
+    { 27231, 9, 345 },
+    { 27308, 9, 346 },
+    { 27385, 9, 347 },
+    { 27462, 9, 348 },
+    { 27539, 9, 349 },
+    { 27616, 9, 350 },
+    { 27693, 9, 351 },
+    { 27951, 9, 320 },
+    { 28027, 9, 321 },
+    { 28103, 9, 322 },
+    { 28179, 9, 323 },
+    { 28255, 9, 324 },
+    { 28331, 9, 325 },
+    { 28407, 9, 326 },
+    { 28483, 9, 327 },
+    { 28559, 9, 328 },
+    { 28635, 9, 329 },
+    { 28712, 9, 330 },
+    { 28789, 9, 331 },
+    { 28866, 9, 332 },
+    { 28943, 9, 333 },
+    { 29020, 9, 334 },
+    { 29097, 9, 335 },
+    { 29338, 9, 192 },
+    { 29414, 9, 193 },
+    { 29490, 9, 194 },
+    { 29566, 9, 195 },
+    { 29642, 9, 196 },
+    { 29718, 9, 197 },
+    { 29794, 9, 198 },
+    { 29870, 9, 199 },
+    { 29946, 9, 200 },
+    { 30022, 9, 201 },
+    { 30099, 9, 202 },
+    { 30176, 9, 203 },
+    { 30253, 9, 204 },
+    { 30330, 9, 205 },
+    { 30407, 9, 206 },
+    { 30484, 9, 207 },
+    { 30725, 9, 208 },
+    { 30801, 9, 209 },
+    { 30877, 9, 210 },
+    { 30953, 9, 211 },
+    { 31029, 9, 212 },
+    { 31105, 9, 213 },
+    { 31184, 9, 214 },
+    { 31260, 9, 215 },
+    { 31336, 9, 216 },
+    { 31412, 9, 217 },
+    { 31489, 9, 218 },
+    { 31566, 9, 219 },
+    { 31643, 9, 220 },
+    { 31720, 9, 221 },
+    { 31797, 9, 222 },
+    { 31874, 9, 223 },
+    { 32137, 9, 368 },
+    { 32218, 9, 369 },
+    { 32299, 9, 370 },
+    { 32384, 9, 371 },
+    { 32469, 9, 372 },
+    { 32546, 9, 373 },
+    { 32623, 9, 374 },
+    { 32698, 9, 375 },
+    { 32778, 9, 376 },
+    { 32855, 9, 377 },
+    { 32939, 9, 378 },
+    { 33021, 9, 379 },
+    { 33102, 9, 380 },
+    { 33179, 9, 381 },
+    { 33265, 9, 382 },
+    { 33349, 9, 383 },
+    { 33615, 9, 352 },
+    { 33684, 9, 353 },
+    { 33754, 9, 354 },
+    { 33827, 9, 355 },
+    { 33902, 9, 356 },
+    { 33978, 9, 357 },
+    { 34051, 9, 358 },
+    { 34126, 9, 359 },
+    { 34203, 9, 360 },
+    { 34278, 9, 361 },
+    { 34355, 9, 362 },
+    { 34432, 9, 363 },
+    { 34504, 9, 364 },
+    { 34577, 9, 365 },
+    { 34653, 9, 366 },
+    { 34735, 9, 367 },
+    { 34986, 9, 224 },
+    { 35055, 9, 225 },
+    { 35125, 9, 226 },
+    { 35198, 9, 227 },
+    { 35273, 9, 228 },
+    { 35349, 9, 229 },
+    { 35422, 9, 230 },
+    { 35497, 9, 231 },
+    { 35574, 9, 232 },
+    { 35649, 9, 233 },
+    { 35726, 9, 234 },
+    { 35803, 9, 235 },
+    { 35875, 9, 236 },
+    { 35948, 9, 237 },
+    { 36024, 9, 238 },
+    { 36106, 9, 239 },
+    { 36369, 9, 240 },
+    { 36450, 9, 241 },
+    { 36531, 9, 242 },
+    { 36616, 9, 243 },
+    { 36701, 9, 244 },
+    { 36778, 9, 245 },
+    { 36855, 9, 246 },
+    { 36930, 9, 247 },
+    { 37010, 9, 248 },
+    { 37087, 9, 249 },
+    { 37171, 9, 250 },
+    { 37253, 9, 251 },
+    { 37334, 9, 252 },
+    { 37411, 9, 253 },
+    { 37497, 9, 254 },
+    { 37581, 9, 255 },
+    { 37888, 1, ROM_SPAN_ROW },
+    { 38403, 1, ROM_SPAN_ROW },
+    { 38884, 9, 512 },
+    { 38960, 9, 513 },
+    { 39036, 9, 514 },
+    { 39112, 9, 515 },
+    { 39188, 9, 516 },
+    { 39264, 9, 517 },
+    { 39340, 9, 518 },
+    { 39416, 9, 519 },
+    { 39492, 9, 520 },
+    { 39568, 9, 521 },
+    { 39645, 9, 522 },
+    { 39722, 9, 523 },
+    { 39799, 9, 524 },
+    { 39876, 9, 525 },
+    { 39953, 9, 526 },
+    { 40030, 9, 527 },
+    { 40271, 9, 528 },
+    { 40347, 9, 529 },
+    { 40423, 9, 530 },
+    { 40499, 9, 531 },
+    { 40575, 9, 532 },
+    { 40651, 9, 533 },
+    { 40730, 9, 534 },
+    { 40806, 9, 535 },
+    { 40882, 9, 536 },
+    { 40958, 9, 537 },
+    { 41035, 9, 538 },
+    { 41112, 9, 539 },
+    { 41189, 9, 540 },
+    { 41266, 9, 541 },
+    { 41343, 9, 542 },
+    { 41420, 9, 543 },
+    { 41678, 9, 384 },
+    { 41754, 9, 385 },
+    { 41830, 9, 386 },
+    { 41906, 9, 387 },
+    { 41982, 9, 388 },
+    { 42058, 9, 389 },
+    { 42134, 9, 390 },
+    { 42210, 9, 391 },
+    { 42286, 9, 392 },
+    { 42362, 9, 393 },
+    { 42439, 9, 394 },
+    { 42516, 9, 395 },
+    { 42593, 9, 396 },
+    { 42670, 9, 397 },
+    { 42747, 9, 398 },
+    { 42824, 9, 399 },
+    { 43065, 9, 400 },
+    { 43141, 9, 401 },
+    { 43217, 9, 402 },
+    { 43293, 9, 403 },
+    { 43369, 9, 404 },
+    { 43445, 9, 405 },
+    { 43524, 9, 406 },
+    { 43600, 9, 407 },
+    { 43676, 9, 408 },
+    { 43752, 9, 409 },
+    { 43829, 9, 410 },
+    { 43906, 9, 411 },
+    { 43983, 9, 412 },
+    { 44060, 9, 413 },
+    { 44137, 9, 414 },
+    { 44214, 9, 415 },
+    { 44465, 9, 544 },
+    { 44534, 9, 545 },
+    { 44604, 9, 546 },
+    { 44677, 9, 547 },
+    { 44752, 9, 548 },
+    { 44828, 9, 549 },
+    { 44901, 9, 550 },
+    { 44976, 9, 551 },
+    { 45053, 9, 552 },
+    { 45128, 9, 553 },
+    { 45205, 9, 554 },
+    { 45282, 9, 555 },
+    { 45354, 9, 556 },
+    { 45427, 9, 557 },
+    { 45503, 9, 558 },
+    { 45585, 9, 559 },
+    { 45848, 9, 560 },
+    { 45929, 9, 561 },
+    { 46010, 9, 562 },
+    { 46095, 9, 563 },
+    { 46180, 9, 564 },
+    { 46257, 9, 565 },
+    { 46334, 9, 566 },
+    { 46409, 9, 567 },
+    { 46489, 9, 568 },
+    { 46566, 9, 569 },
+    { 46650, 9, 570 },
+    { 46732, 9, 571 },
+    { 46813, 9, 572 },
+    { 46890, 9, 573 },
+    { 46976, 9, 574 },
+    { 47060, 9, 575 },
+    { 47326, 9, 416 },
+    { 47395, 9, 417 },
+    { 47465, 9, 418 },
+    { 47538, 9, 419 },
+    { 47613, 9, 420 },
+    { 47689, 9, 421 },
+    { 47762, 9, 422 },
+    { 47837, 9, 423 },
+    { 47914, 9, 424 },
+    { 47989, 9, 425 },
+    { 48066, 9, 426 },
+    { 48143, 9, 427 },
+    { 48215, 9, 428 },
+    { 48288, 9, 429 },
+    { 48364, 9, 430 },
+    { 48446, 9, 431 },
+    { 48709, 9, 432 },
+    { 48790, 9, 433 },
+    { 48871, 9, 434 },
+    { 48956, 9, 435 },
+    { 49041, 9, 436 },
+    { 49118, 9, 437 },
+    { 49195, 9, 438 },
+    { 49270, 9, 439 },
+    { 49350, 9, 440 },
+    { 49427, 9, 441 },
+    { 49511, 9, 442 },
+    { 49593, 9, 443 },
+    { 49674, 9, 444 },
+    { 49751, 9, 445 },
+    { 49837, 9, 446 },
+    { 49921, 9, 447 },
+    { 50228, 1, ROM_SPAN_ROW },
+    { 50743, 1, ROM_SPAN_ROW },
+    { 51224, 9, 592 },
+    { 51300, 9, 593 },
+    { 51376, 9, 594 },
+    { 51452, 9, 595 },
+    { 51528, 9, 596 },
+    { 51604, 9, 597 },
+    { 51683, 9, 598 },
+    { 51759, 9, 599 },
+    { 51835, 9, 600 },
+    { 51911, 9, 601 },
+    { 51988, 9, 602 },
+    { 52065, 9, 603 },
+    { 52142, 9, 604 },
+    { 52219, 9, 605 },
+    { 52296, 9, 606 },
+    { 52373, 9, 607 },
+    { 52631, 9, 576 },
+    { 52707, 9, 577 },
+    { 52783, 9, 578 },
+    { 52859, 9, 579 },
+    { 52935, 9, 580 },
+    { 53011, 9, 581 },
+    { 53087, 9, 582 },
+    { 53163, 9, 583 },
+    { 53239, 9, 584 },
+    { 53315, 9, 585 },
+    { 53392, 9, 586 },
+    { 53469, 9, 587 },
+    { 53546, 9, 588 },
+    { 53623, 9, 589 },
+    { 53700, 9, 590 },
+    { 53777, 9, 591 },
+    { 54018, 9, 464 },
+    { 54094, 9, 465 },
+    { 54170, 9, 466 },
+    { 54246, 9, 467 },
+    { 54322, 9, 468 },
+    { 54398, 9, 469 },
+    { 54477, 9, 470 },
+    { 54553, 9, 471 },
+    { 54629, 9, 472 },
+    { 54705, 9, 473 },
+    { 54782, 9, 474 },
+    { 54859, 9, 475 },
+    { 54936, 9, 476 },
+    { 55013, 9, 477 },
+    { 55090, 9, 478 },
+    { 55167, 9, 479 },
+    { 55425, 9, 448 },
+    { 55501, 9, 449 },
+    { 55577, 9, 450 },
+    { 55653, 9, 451 },
+    { 55729, 9, 452 },
+    { 55805, 9, 453 },
+    { 55881, 9, 454 },
+    { 55957, 9, 455 },
+    { 56033, 9, 456 },
+    { 56109, 9, 457 },
+    { 56186, 9, 458 },
+    { 56263, 9, 459 },
+    { 56340, 9, 460 },
+    { 56417, 9, 461 },
+    { 56494, 9, 462 },
+    { 56571, 9, 463 },
+    { 56817, 9, 624 },
+    { 56898, 9, 625 },
+    { 56979, 9, 626 },
+    { 57064, 9, 627 },
+    { 57149, 9, 628 },
+    { 57226, 9, 629 },
+    { 57303, 9, 630 },
+    { 57378, 9, 631 },
+    { 57458, 9, 632 },
+    { 57535, 9, 633 },
+    { 57619, 9, 634 },
+    { 57701, 9, 635 },
+    { 57782, 9, 636 },
+    { 57859, 9, 637 },
+    { 57945, 9, 638 },
+    { 58029, 9, 639 },
+    { 58295, 9, 608 },
+    { 58364, 9, 609 },
+    { 58434, 9, 610 },
+    { 58507, 9, 611 },
+    { 58582, 9, 612 },
+    { 58658, 9, 613 },
+    { 58731, 9, 614 },
+    { 58806, 9, 615 },
+    { 58883, 9, 616 },
+    { 58958, 9, 617 },
+    { 59035, 9, 618 },
+    { 59112, 9, 619 },
+    { 59184, 9, 620 },
+    { 59257, 9, 621 },
+    { 59333, 9, 622 },
+    { 59415, 9, 623 },
+    { 59678, 9, 496 },
+    { 59759, 9, 497 },
+    { 59840, 9, 498 },
+    { 59925, 9, 499 },
+    { 60010, 9, 500 },
+    { 60087, 9, 501 },
+    { 60164, 9, 502 },
+    { 60239, 9, 503 },
+    { 60319, 9, 504 },
+    { 60396, 9, 505 },
+    { 60480, 9, 506 },
+    { 60562, 9, 507 },
+    { 60643, 9, 508 },
+    { 60720, 9, 509 },
+    { 60806, 9, 510 },
+    { 60890, 9, 511 },
+    { 61156, 9, 480 },
+    { 61225, 9, 481 },
+    { 61295, 9, 482 },
+    { 61368, 9, 483 },
+    { 61443, 9, 484 },
+    { 61519, 9, 485 },
+    { 61592, 9, 486 },
+    { 61667, 9, 487 },
+    { 61744, 9, 488 },
+    { 61819, 9, 489 },
+    { 61896, 9, 490 },
+    { 61973, 9, 491 },
+    { 62045, 9, 492 },
+    { 62118, 9, 493 },
+    { 62194, 9, 494 },
+    { 62276, 9, 495 },
+    { 62568, 1, ROM_SPAN_ROW },
+    { 63083, 1, ROM_SPAN_ROW },
+    { 63563, 9, 640 },
+    { 63639, 9, 641 },
+    { 63715, 9, 642 },
+    { 63791, 9, 643 },
+    { 63867, 9, 644 },
+    { 63943, 9, 645 },
+    { 64019, 9, 646 },
+    { 64095, 9, 647 },
+    { 64171, 9, 648 },
+    { 64247, 9, 649 },
+    { 64324, 9, 650 },
+    { 64401, 9, 651 },
+    { 64478, 9, 652 },
+    { 64555, 9, 653 },
+    { 64632, 9, 654 },
+    { 64709, 9, 655 },
+    { 64949, 9, 656 },
+    { 65025, 9, 657 },
+    { 65101, 9, 658 },
+    { 65177, 9, 659 },
+    { 65253, 9, 660 },
+    { 65329, 9, 661 },
+    { 65408, 9, 662 },
+    { 65484, 9, 663 },
+    { 65560, 9, 664 },
+    { 65636, 9, 665 },
+    { 65713, 9, 666 },
+    { 65790, 9, 667 },
+    { 65867, 9, 668 },
+    { 65944, 9, 669 },
+    { 66021, 9, 670 },
+    { 66098, 9, 671 },
+    { 66355, 9, 784 },
+    { 66431, 9, 785 },
+    { 66507, 9, 786 },
+    { 66583, 9, 787 },
+    { 66659, 9, 788 },
+    { 66735, 9, 789 },
+    { 66814, 9, 790 },
+    { 66890, 9, 791 },
+    { 66966, 9, 792 },
+    { 67042, 9, 793 },
+    { 67119, 9, 794 },
+    { 67196, 9, 795 },
+    { 67273, 9, 796 },
+    { 67350, 9, 797 },
+    { 67427, 9, 798 },
+    { 67504, 9, 799 },
+    { 67761, 9, 768 },
+    { 67837, 9, 769 },
+    { 67913, 9, 770 },
+    { 67989, 9, 771 },
+    { 68065, 9, 772 },
+    { 68141, 9, 773 },
+    { 68217, 9, 774 },
+    { 68293, 9, 775 },
+    { 68369, 9, 776 },
+    { 68445, 9, 777 },
+    { 68522, 9, 778 },
+    { 68599, 9, 779 },
+    { 68676, 9, 780 },
+    { 68753, 9, 781 },
+    { 68830, 9, 782 },
+    { 68907, 9, 783 },
+    { 69140, 9, 672 },
+    { 69209, 9, 673 },
+    { 69279, 9, 674 },
+    { 69352, 9, 675 },
+    { 69427, 9, 676 },
+    { 69503, 9, 677 },
+    { 69576, 9, 678 },
+    { 69651, 9, 679 },
+    { 69728, 9, 680 },
+    { 69803, 9, 681 },
+    { 69880, 9, 682 },
+    { 69957, 9, 683 },
+    { 70029, 9, 684 },
+    { 70102, 9, 685 },
+    { 70178, 9, 686 },
+    { 70260, 9, 687 },
+    { 70522, 9, 688 },
+    { 70603, 9, 689 },
+    { 70684, 9, 690 },
+    { 70769, 9, 691 },
+    { 70854, 9, 692 },
+    { 70931, 9, 693 },
+    { 71008, 9, 694 },
+    { 71083, 9, 695 },
+    { 71163, 9, 696 },
+    { 71240, 9, 697 },
+    { 71324, 9, 698 },
+    { 71406, 9, 699 },
+    { 71487, 9, 700 },
+    { 71564, 9, 701 },
+    { 71650, 9, 702 },
+    { 71734, 9, 703 },
+    { 72011, 9, 816 },
+    { 72092, 9, 817 },
+    { 72173, 9, 818 },
+    { 72258, 9, 819 },
+    { 72343, 9, 820 },
+    { 72420, 9, 821 },
+    { 72497, 9, 822 },
+    { 72572, 9, 823 },
+    { 72652, 9, 824 },
+    { 72729, 9, 825 },
+    { 72813, 9, 826 },
+    { 72895, 9, 827 },
+    { 72976, 9, 828 },
+    { 73053, 9, 829 },
+    { 73139, 9, 830 },
+    { 73223, 9, 831 },
+    { 73488, 9, 800 },
+    { 73557, 9, 801 },
+    { 73627, 9, 802 },
+    { 73700, 9, 803 },
+    { 73775, 9, 804 },
+    { 73851, 9, 805 },
+    { 73924, 9, 806 },
+    { 73999, 9, 807 },
+    { 74076, 9, 808 },
+    { 74151, 9, 809 },
+    { 74228, 9, 810 },
+    { 74305, 9, 811 },
+    { 74377, 9, 812 },
+    { 74450, 9, 813 },
+    { 74526, 9, 814 },
+    { 74608, 9, 815 },
+    { 74899, 2, ROM_SPAN_ROW },
+    { 75414, 2, ROM_SPAN_ROW },
+    { 75895, 9, 720 },
+    { 75971, 9, 721 },
+    { 76047, 9, 722 },
+    { 76123, 9, 723 },
+    { 76199, 9, 724 },
+    { 76275, 9, 725 },
+    { 76354, 9, 726 },
+    { 76430, 9, 727 },
+    { 76506, 9, 728 },
+    { 76582, 9, 729 },
+    { 76659, 9, 730 },
+    { 76736, 9, 731 },
+    { 76813, 9, 732 },
+    { 76890, 9, 733 },
+    { 76967, 9, 734 },
+    { 77044, 9, 735 },
+    { 77301, 9, 704 },
+    { 77377, 9, 705 },
+    { 77453, 9, 706 },
+    { 77529, 9, 707 },
+    { 77605, 9, 708 },
+    { 77681, 9, 709 },
+    { 77757, 9, 710 },
+    { 77833, 9, 711 },
+    { 77909, 9, 712 },
+    { 77985, 9, 713 },
+    { 78062, 9, 714 },
+    { 78139, 9, 715 },
+    { 78216, 9, 716 },
+    { 78293, 9, 717 },
+    { 78370, 9, 718 },
+    { 78447, 9, 719 },
+    { 78687, 9, 832 },
+    { 78763, 9, 833 },
+    { 78839, 9, 834 },
+    { 78915, 9, 835 },
+    { 78991, 9, 836 },
+    { 79067, 9, 837 },
+    { 79143, 9, 838 },
+    { 79219, 9, 839 },
+    { 79295, 9, 840 },
+    { 79371, 9, 841 },
+    { 79448, 9, 842 },
+    { 79525, 9, 843 },
+    { 79602, 9, 844 },
+    { 79679, 9, 845 },
+    { 79756, 9, 846 },
+    { 79833, 9, 847 },
+    { 80073, 9, 848 },
+    { 80149, 9, 849 },
+    { 80225, 9, 850 },
+    { 80301, 9, 851 },
+    { 80377, 9, 852 },
+    { 80453, 9, 853 },
+    { 80532, 9, 854 },
+    { 80608, 9, 855 },
+    { 80684, 9, 856 },
+    { 80760, 9, 857 },
+    { 80837, 9, 858 },
+    { 80914, 9, 859 },
+    { 80991, 9, 860 },
+    { 81068, 9, 861 },
+    { 81145, 9, 862 },
+    { 81222, 9, 863 },
+    { 81484, 9, 752 },
+    { 81565, 9, 753 },
+    { 81646, 9, 754 },
+    { 81731, 9, 755 },
+    { 81816, 9, 756 },
+    { 81893, 9, 757 },
+    { 81970, 9, 758 },
+    { 82045, 9, 759 },
+    { 82125, 9, 760 },
+    { 82202, 9, 761 },
+    { 82286, 9, 762 },
+    { 82368, 9, 763 },
+    { 82449, 9, 764 },
+    { 82526, 9, 765 },
+    { 82612, 9, 766 },
+    { 82696, 9, 767 },
+    { 82961, 9, 736 },
+    { 83030, 9, 737 },
+    { 83100, 9, 738 },
+    { 83173, 9, 739 },
+    { 83248, 9, 740 },
+    { 83324, 9, 741 },
+    { 83397, 9, 742 },
+    { 83472, 9, 743 },
+    { 83549, 9, 744 },
+    { 83624, 9, 745 },
+    { 83701, 9, 746 },
+    { 83778, 9, 747 },
+    { 83850, 9, 748 },
+    { 83923, 9, 749 },
+    { 83999, 9, 750 },
+    { 84081, 9, 751 },
+    { 84331, 9, 864 },
+    { 84400, 9, 865 },
+    { 84470, 9, 866 },
+    { 84543, 9, 867 },
+    { 84618, 9, 868 },
+    { 84694, 9, 869 },
+    { 84767, 9, 870 },
+    { 84842, 9, 871 },
+    { 84919, 9, 872 },
+    { 84994, 9, 873 },
+    { 85071, 9, 874 },
+    { 85148, 9, 875 },
+    { 85220, 9, 876 },
+    { 85293, 9, 877 },
+    { 85369, 9, 878 },
+    { 85451, 9, 879 },
+    { 85713, 9, 880 },
+    { 85794, 9, 881 },
+    { 85875, 9, 882 },
+    { 85960, 9, 883 },
+    { 86045, 9, 884 },
+    { 86122, 9, 885 },
+    { 86199, 9, 886 },
+    { 86274, 9, 887 },
+    { 86354, 9, 888 },
+    { 86431, 9, 889 },
+    { 86515, 9, 890 },
+    { 86597, 9, 891 },
+    { 86678, 9, 892 },
+    { 86755, 9, 893 },
+    { 86841, 9, 894 },
+    { 86925, 9, 895 },
+    { 87231, 2, ROM_SPAN_ROW },
+    { 87746, 2, ROM_SPAN_ROW },
+    { 88227, 9, 1024 },
+    { 88303, 9, 1025 },
+    { 88379, 9, 1026 },
+    { 88455, 9, 1027 },
+    { 88531, 9, 1028 },
+    { 88607, 9, 1029 },
+    { 88683, 9, 1030 },
+    { 88759, 9, 1031 },
+    { 88835, 9, 1032 },
+    { 88911, 9, 1033 },
+    { 88988, 9, 1034 },
+    { 89065, 9, 1035 },
+    { 89142, 9, 1036 },
+    { 89219, 9, 1037 },
+    { 89296, 9, 1038 },
+    { 89373, 9, 1039 },
+    { 89613, 9, 1040 },
+    { 89689, 9, 1041 },
+    { 89765, 9, 1042 },
+    { 89841, 9, 1043 },
+    { 89917, 9, 1044 },
+    { 89993, 9, 1045 },
+    { 90072, 9, 1046 },
+    { 90148, 9, 1047 },
+    { 90224, 9, 1048 },
+    { 90300, 9, 1049 },
+    { 90377, 9, 1050 },
+    { 90454, 9, 1051 },
+    { 90531, 9, 1052 },
+    { 90608, 9, 1053 },
+    { 90685, 9, 1054 },
+    { 90762, 9, 1055 },
+    { 91019, 9, 912 },
+    { 91095, 9, 913 },
+    { 91171, 9, 914 },
+    { 91247, 9, 915 },
+    { 91323, 9, 916 },
+    { 91399, 9, 917 },
+    { 91478, 9, 918 },
+    { 91554, 9, 919 },
+    { 91630, 9, 920 },
+    { 91706, 9, 921 },
+    { 91783, 9, 922 },
+    { 91860, 9, 923 },
+    { 91937, 9, 924 },
+    { 92014, 9, 925 },
+    { 92091, 9, 926 },
+    { 92168, 9, 927 },
+    { 92425, 9, 896 },
+    { 92501, 9, 897 },
+    { 92577, 9, 898 },
+    { 92653, 9, 899 },
+    { 92729, 9, 900 },
+    { 92805, 9, 901 },
+    { 92881, 9, 902 },
+    { 92957, 9, 903 },
+    { 93033, 9, 904 },
+    { 93109, 9, 905 },
+    { 93186, 9, 906 },
+    { 93263, 9, 907 },
+    { 93340, 9, 908 },
+    { 93417, 9, 909 },
+    { 93494, 9, 910 },
+    { 93571, 9, 911 },
+    { 93804, 9, 1056 },
+    { 93873, 9, 1057 },
+    { 93943, 9, 1058 },
+    { 94016, 9, 1059 },
+    { 94091, 9, 1060 },
+    { 94167, 9, 1061 },
+    { 94240, 9, 1062 },
+    { 94315, 9, 1063 },
+    { 94392, 9, 1064 },
+    { 94467, 9, 1065 },
+    { 94544, 9, 1066 },
+    { 94621, 9, 1067 },
+    { 94693, 9, 1068 },
+    { 94766, 9, 1069 },
+    { 94842, 9, 1070 },
+    { 94924, 9, 1071 },
+    { 95186, 9, 1072 },
+    { 95267, 9, 1073 },
+    { 95348, 9, 1074 },
+    { 95433, 9, 1075 },
+    { 95518, 9, 1076 },
+    { 95595, 9, 1077 },
+    { 95672, 9, 1078 },
+    { 95747, 9, 1079 },
+    { 95827, 9, 1080 },
+    { 95904, 9, 1081 },
+    { 95988, 9, 1082 },
+    { 96070, 9, 1083 },
+    { 96151, 9, 1084 },
+    { 96228, 9, 1085 },
+    { 96314, 9, 1086 },
+    { 96398, 9, 1087 },
+    { 96675, 9, 944 },
+    { 96756, 9, 945 },
+    { 96837, 9, 946 },
+    { 96922, 9, 947 },
+    { 97007, 9, 948 },
+    { 97084, 9, 949 },
+    { 97161, 9, 950 },
+    { 97236, 9, 951 },
+    { 97316, 9, 952 },
+    { 97393, 9, 953 },
+    { 97477, 9, 954 },
+    { 97559, 9, 955 },
+    { 97640, 9, 956 },
+    { 97717, 9, 957 },
+    { 97803, 9, 958 },
+    { 97887, 9, 959 },
+    { 98152, 9, 928 },
+    { 98221, 9, 929 },
+    { 98291, 9, 930 },
+    { 98364, 9, 931 },
+    { 98439, 9, 932 },
+    { 98515, 9, 933 },
+    { 98588, 9, 934 },
+    { 98663, 9, 935 },
+    { 98740, 9, 936 },
+    { 98815, 9, 937 },
+    { 98892, 9, 938 },
+    { 98969, 9, 939 },
+    { 99041, 9, 940 },
+    { 99114, 9, 941 },
+    { 99190, 9, 942 },
+    { 99272, 9, 943 },
+    { 99563, 2, ROM_SPAN_ROW },
+    { 100080, 2, ROM_SPAN_ROW },
+    { 100561, 9, 1104 },
+    { 100637, 9, 1105 },
+    { 100713, 9, 1106 },
+    { 100789, 9, 1107 },
+    { 100865, 9, 1108 },
+    { 100941, 9, 1109 },
+    { 101020, 9, 1110 },
+    { 101096, 9, 1111 },
+    { 101172, 9, 1112 },
+    { 101248, 9, 1113 },
+    { 101325, 9, 1114 },
+    { 101402, 9, 1115 },
+    { 101479, 9, 1116 },
+    { 101556, 9, 1117 },
+    { 101633, 9, 1118 },
+    { 101710, 9, 1119 },
+    { 101967, 9, 1088 },
+    { 102043, 9, 1089 },
+    { 102119, 9, 1090 },
+    { 102195, 9, 1091 },
+    { 102271, 9, 1092 },
+    { 102347, 9, 1093 },
+    { 102423, 9, 1094 },
+    { 102499, 9, 1095 },
+    { 102575, 9, 1096 },
+    { 102651, 9, 1097 },
+    { 102728, 9, 1098 },
+    { 102805, 9, 1099 },
+    { 102882, 9, 1100 },
+    { 102959, 9, 1101 },
+    { 103036, 9, 1102 },
+    { 103113, 9, 1103 },
+    { 103353, 9, 960 },
+    { 103429, 9, 961 },
+    { 103505, 9, 962 },
+    { 103581, 9, 963 },
+    { 103657, 9, 964 },
+    { 103733, 9, 965 },
+    { 103809, 9, 966 },
+    { 103885, 9, 967 },
+    { 103961, 9, 968 },
+    { 104037, 9, 969 },
+    { 104114, 9, 970 },
+    { 104191, 9, 971 },
+    { 104268, 9, 972 },
+    { 104345, 9, 973 },
+    { 104422, 9, 974 },
+    { 104499, 9, 975 },
+    { 104739, 9, 976 },
+    { 104815, 9, 977 },
+    { 104891, 9, 978 },
+    { 104967, 9, 979 },
+    { 105043, 9, 980 },
+    { 105119, 9, 981 },
+    { 105198, 9, 982 },
+    { 105274, 9, 983 },
+    { 105350, 9, 984 },
+    { 105426, 9, 985 },
+    { 105503, 9, 986 },
+    { 105580, 9, 987 },
+    { 105657, 9, 988 },
+    { 105734, 9, 989 },
+    { 105811, 9, 990 },
+    { 105888, 9, 991 },
+    { 106150, 9, 1136 },
+    { 106231, 9, 1137 },
+    { 106312, 9, 1138 },
+    { 106397, 9, 1139 },
+    { 106482, 9, 1140 },
+    { 106559, 9, 1141 },
+    { 106636, 9, 1142 },
+    { 106711, 9, 1143 },
+    { 106791, 9, 1144 },
+    { 106868, 9, 1145 },
+    { 106952, 9, 1146 },
+    { 107034, 9, 1147 },
+    { 107115, 9, 1148 },
+    { 107192, 9, 1149 },
+    { 107278, 9, 1150 },
+    { 107362, 9, 1151 },
+    { 107627, 9, 1120 },
+    { 107696, 9, 1121 },
+    { 107766, 9, 1122 },
+    { 107839, 9, 1123 },
+    { 107914, 9, 1124 },
+    { 107990, 9, 1125 },
+    { 108063, 9, 1126 },
+    { 108138, 9, 1127 },
+    { 108215, 9, 1128 },
+    { 108290, 9, 1129 },
+    { 108367, 9, 1130 },
+    { 108444, 9, 1131 },
+    { 108516, 9, 1132 },
+    { 108589, 9, 1133 },
+    { 108665, 9, 1134 },
+    { 108747, 9, 1135 },
+    { 108997, 9, 992 },
+    { 109066, 9, 993 },
+    { 109136, 9, 994 },
+    { 109209, 9, 995 },
+    { 109284, 9, 996 },
+    { 109360, 9, 997 },
+    { 109433, 9, 998 },
+    { 109508, 9, 999 },
+    { 109585, 9, 1000 },
+    { 109660, 9, 1001 },
+    { 109737, 9, 1002 },
+    { 109814, 9, 1003 },
+    { 109886, 9, 1004 },
+    { 109959, 9, 1005 },
+    { 110035, 9, 1006 },
+    { 110117, 9, 1007 },
+    { 110379, 9, 1008 },
+    { 110460, 9, 1009 },
+    { 110541, 9, 1010 },
+    { 110626, 9, 1011 },
+    { 110711, 9, 1012 },
+    { 110788, 9, 1013 },
+    { 110865, 9, 1014 },
+    { 110940, 9, 1015 },
+    { 111020, 9, 1016 },
+    { 111097, 9, 1017 },
+    { 111181, 9, 1018 },
+    { 111263, 9, 1019 },
+    { 111344, 9, 1020 },
+    { 111421, 9, 1021 },
+    { 111507, 9, 1022 },
+    { 111591, 9, 1023 },
+    { 111897, 2, ROM_SPAN_ROW },
+    { 112414, 2, ROM_SPAN_ROW },
+    { 112895, 9, 1152 },
+    { 112971, 9, 1153 },
+    { 113047, 9, 1154 },
+    { 113123, 9, 1155 },
+    { 113199, 9, 1156 },
+    { 113275, 9, 1157 },
+    { 113351, 9, 1158 },
+    { 113427, 9, 1159 },
+    { 113503, 9, 1160 },
+    { 113579, 9, 1161 },
+    { 113656, 9, 1162 },
+    { 113733, 9, 1163 },
+    { 113810, 9, 1164 },
+    { 113887, 9, 1165 },
+    { 113964, 9, 1166 },
+    { 114041, 9, 1167 },
+    { 114281, 9, 1168 },
+    { 114357, 9, 1169 },
+    { 114433, 9, 1170 },
+    { 114509, 9, 1171 },
+    { 114585, 9, 1172 },
+    { 114661, 9, 1173 },
+    { 114740, 9, 1174 },
+    { 114816, 9, 1175 },
+    { 114892, 9, 1176 },
+    { 114968, 9, 1177 },
+    { 115045, 9, 1178 },
+    { 115122, 9, 1179 },
+    { 115199, 9, 1180 },
+    { 115276, 9, 1181 },
+    { 115353, 9, 1182 },
+    { 115430, 9, 1183 },
+    { 115687, 9, 1296 },
+    { 115763, 9, 1297 },
+    { 115839, 9, 1298 },
+    { 115915, 9, 1299 },
+    { 115991, 9, 1300 },
+    { 116067, 9, 1301 },
+    { 116146, 9, 1302 },
+    { 116222, 9, 1303 },
+    { 116298, 9, 1304 },
+    { 116374, 9, 1305 },
+    { 116451, 9, 1306 },
+    { 116528, 9, 1307 },
+    { 116605, 9, 1308 },
+    { 116682, 9, 1309 },
+    { 116759, 9, 1310 },
+    { 116836, 9, 1311 },
+    { 117094, 9, 1280 },
+    { 117170, 9, 1281 },
+    { 117246, 9, 1282 },
+    { 117322, 9, 1283 },
+    { 117398, 9, 1284 },
+    { 117474, 9, 1285 },
+    { 117550, 9, 1286 },
+    { 117626, 9, 1287 },
+    { 117702, 9, 1288 },
+    { 117778, 9, 1289 },
+    { 117855, 9, 1290 },
+    { 117932, 9, 1291 },
+    { 118009, 9, 1292 },
+    { 118086, 9, 1293 },
+    { 118163, 9, 1294 },
+    { 118240, 9, 1295 },
+    { 118473, 9, 1184 },
+    { 118542, 9, 1185 },
+    { 118612, 9, 1186 },
+    { 118685, 9, 1187 },
+    { 118760, 9, 1188 },
+    { 118836, 9, 1189 },
+    { 118909, 9, 1190 },
+    { 118984, 9, 1191 },
+    { 119061, 9, 1192 },
+    { 119136, 9, 1193 },
+    { 119213, 9, 1194 },
+    { 119290, 9, 1195 },
+    { 119362, 9, 1196 },
+    { 119435, 9, 1197 },
+    { 119511, 9, 1198 },
+    { 119593, 9, 1199 },
+    { 119857, 9, 1200 },
+    { 119938, 9, 1201 },
+    { 120019, 9, 1202 },
+    { 120104, 9, 1203 },
+    { 120189, 9, 1204 },
+    { 120266, 9, 1205 },
+    { 120343, 9, 1206 },
+    { 120418, 9, 1207 },
+    { 120498, 9, 1208 },
+    { 120575, 9, 1209 },
+    { 120659, 9, 1210 },
+    { 120741, 9, 1211 },
+    { 120822, 9, 1212 },
+    { 120899, 9, 1213 },
+    { 120985, 9, 1214 },
+    { 121069, 9, 1215 },
+    { 121348, 9, 1328 },
+    { 121429, 9, 1329 },
+    { 121510, 9, 1330 },
+    { 121595, 9, 1331 },
+    { 121680, 9, 1332 },
+    { 121757, 9, 1333 },
+    { 121834, 9, 1334 },
+    { 121909, 9, 1335 },
+    { 121989, 9, 1336 },
+    { 122066, 9, 1337 },
+    { 122150, 9, 1338 },
+    { 122232, 9, 1339 },
+    { 122313, 9, 1340 },
+    { 122390, 9, 1341 },
+    { 122476, 9, 1342 },
+    { 122560, 9, 1343 },
+    { 122828, 9, 1312 },
+    { 122897, 9, 1313 },
+    { 122967, 9, 1314 },
+    { 123040, 9, 1315 },
+    { 123115, 9, 1316 },
+    { 123191, 9, 1317 },
+    { 123264, 9, 1318 },
+    { 123339, 9, 1319 },
+    { 123416, 9, 1320 },
+    { 123491, 9, 1321 },
+    { 123568, 9, 1322 },
+    { 123645, 9, 1323 },
+    { 123717, 9, 1324 },
+    { 123790, 9, 1325 },
+    { 123866, 9, 1326 },
+    { 123948, 9, 1327 },
+    { 124241, 2, ROM_SPAN_ROW },
+    { 124760, 2, ROM_SPAN_ROW },
+    { 125247, 9, 1232 },
+    { 125323, 9, 1233 },
+    { 125399, 9, 1234 },
+    { 125475, 9, 1235 },
+    { 125551, 9, 1236 },
+    { 125627, 9, 1237 },
+    { 125706, 9, 1238 },
+    { 125782, 9, 1239 },
+    { 125858, 9, 1240 },
+    { 125934, 9, 1241 },
+    { 126011, 9, 1242 },
+    { 126088, 9, 1243 },
+    { 126165, 9, 1244 },
+    { 126242, 9, 1245 },
+    { 126319, 9, 1246 },
+    { 126396, 9, 1247 },
+    { 126656, 9, 1216 },
+    { 126732, 9, 1217 },
+    { 126808, 9, 1218 },
+    { 126884, 9, 1219 },
+    { 126960, 9, 1220 },
+    { 127036, 9, 1221 },
+    { 127112, 9, 1222 },
+    { 127188, 9, 1223 },
+    { 127264, 9, 1224 },
+    { 127340, 9, 1225 },
+    { 127417, 9, 1226 },
+    { 127494, 9, 1227 },
+    { 127571, 9, 1228 },
+    { 127648, 9, 1229 },
+    { 127725, 9, 1230 },
+    { 127802, 9, 1231 },
+    { 128044, 9, 1344 },
+    { 128120, 9, 1345 },
+    { 128196, 9, 1346 },
+    { 128272, 9, 1347 },
+    { 128348, 9, 1348 },
+    { 128424, 9, 1349 },
+    { 128500, 9, 1350 },
+    { 128576, 9, 1351 },
+    { 128652, 9, 1352 },
+    { 128728, 9, 1353 },
+    { 128805, 9, 1354 },
+    { 128882, 9, 1355 },
+    { 128959, 9, 1356 },
+    { 129036, 9, 1357 },
+    { 129113, 9, 1358 },
+    { 129190, 9, 1359 },
+    { 129432, 9, 1360 },
+    { 129508, 9, 1361 },
+    { 129584, 9, 1362 },
+    { 129660, 9, 1363 },
+    { 129736, 9, 1364 },
+    { 129812, 9, 1365 },
+    { 129891, 9, 1366 },
+    { 129967, 9, 1367 },
+    { 130043, 9, 1368 },
+    { 130119, 9, 1369 },
+    { 130196, 9, 1370 },
+    { 130273, 9, 1371 },
+    { 130350, 9, 1372 },
+    { 130427, 9, 1373 },
+    { 130504, 9, 1374 },
+    { 130581, 9, 1375 },
+    { 130846, 9, 1264 },
+    { 130927, 9, 1265 },
+    { 131008, 9, 1266 },
+    { 131093, 9, 1267 },
+    { 131178, 9, 1268 },
+    { 131255, 9, 1269 },
+    { 131332, 9, 1270 },
+    { 131407, 9, 1271 },
+    { 131487, 9, 1272 },
+    { 131564, 9, 1273 },
+    { 131648, 9, 1274 },
+    { 131730, 9, 1275 },
+    { 131811, 9, 1276 },
+    { 131888, 9, 1277 },
+    { 131974, 9, 1278 },
+    { 132058, 9, 1279 },
+    { 132326, 9, 1248 },
+    { 132395, 9, 1249 },
+    { 132465, 9, 1250 },
+    { 132538, 9, 1251 },
+    { 132613, 9, 1252 },
+    { 132689, 9, 1253 },
+    { 132762, 9, 1254 },
+    { 132837, 9, 1255 },
+    { 132914, 9, 1256 },
+    { 132989, 9, 1257 },
+    { 133066, 9, 1258 },
+    { 133143, 9, 1259 },
+    { 133215, 9, 1260 },
+    { 133288, 9, 1261 },
+    { 133364, 9, 1262 },
+    { 133446, 9, 1263 },
+    { 133699, 9, 1376 },
+    { 133768, 9, 1377 },
+    { 133838, 9, 1378 },
+    { 133911, 9, 1379 },
+    { 133986, 9, 1380 },
+    { 134062, 9, 1381 },
+    { 134135, 9, 1382 },
+    { 134210, 9, 1383 },
+    { 134287, 9, 1384 },
+    { 134362, 9, 1385 },
+    { 134439, 9, 1386 },
+    { 134516, 9, 1387 },
+    { 134588, 9, 1388 },
+    { 134661, 9, 1389 },
+    { 134737, 9, 1390 },
+    { 134819, 9, 1391 },
+    { 135084, 9, 1392 },
+    { 135165, 9, 1393 },
+    { 135246, 9, 1394 },
+    { 135331, 9, 1395 },
+    { 135416, 9, 1396 },
+    { 135493, 9, 1397 },
+    { 135570, 9, 1398 },
+    { 135645, 9, 1399 },
+    { 135725, 9, 1400 },
+    { 135802, 9, 1401 },
+    { 135886, 9, 1402 },
+    { 135968, 9, 1403 },
+    { 136049, 9, 1404 },
+    { 136126, 9, 1405 },
+    { 136212, 9, 1406 },
+    { 136296, 9, 1407 },
+    { 136605, 2, ROM_SPAN_ROW },
+    { 137124, 2, ROM_SPAN_ROW },
+    { 137611, 9, 1424 },
+    { 137687, 9, 1425 },
+    { 137763, 9, 1426 },
+    { 137839, 9, 1427 },
+    { 137915, 9, 1428 },
+    { 137991, 9, 1429 },
+    { 138070, 9, 1430 },
+    { 138146, 9, 1431 },
+    { 138222, 9, 1432 },
+    { 138298, 9, 1433 },
+    { 138375, 9, 1434 },
+    { 138452, 9, 1435 },
+    { 138529, 9, 1436 },
+    { 138606, 9, 1437 },
+    { 138683, 9, 1438 },
+    { 138760, 9, 1439 },
+    { 139020, 9, 1408 },
+    { 139096, 9, 1409 },
+    { 139172, 9, 1410 },
+    { 139248, 9, 1411 },
+    { 139324, 9, 1412 },
+    { 139400, 9, 1413 },
+    { 139476, 9, 1414 },
+    { 139552, 9, 1415 },
+    { 139628, 9, 1416 },
+    { 139704, 9, 1417 },
+    { 139781, 9, 1418 },
+    { 139858, 9, 1419 },
+    { 139935, 9, 1420 },
+    { 140012, 9, 1421 },
+    { 140089, 9, 1422 },
+    { 140166, 9, 1423 },
+    { 140408, 9, 1552 },
+    { 140484, 9, 1553 },
+    { 140560, 9, 1554 },
+    { 140636, 9, 1555 },
+    { 140712, 9, 1556 },
+    { 140788, 9, 1557 },
+    { 140867, 9, 1558 },
+    { 140943, 9, 1559 },
+    { 141019, 9, 1560 },
+    { 141095, 9, 1561 },
+    { 141172, 9, 1562 },
+    { 141249, 9, 1563 },
+    { 141326, 9, 1564 },
+    { 141403, 9, 1565 },
+    { 141480, 9, 1566 },
+    { 141557, 9, 1567 },
+    { 141817, 9, 1536 },
+    { 141893, 9, 1537 },
+    { 141969, 9, 1538 },
+    { 142045, 9, 1539 },
+    { 142121, 9, 1540 },
+    { 142197, 9, 1541 },
+    { 142273, 9, 1542 },
+    { 142349, 9, 1543 },
+    { 142425, 9, 1544 },
+    { 142501, 9, 1545 },
+    { 142578, 9, 1546 },
+    { 142655, 9, 1547 },
+    { 142732, 9, 1548 },
+    { 142809, 9, 1549 },
+    { 142886, 9, 1550 },
+    { 142963, 9, 1551 },
+    { 143210, 9, 1456 },
+    { 143291, 9, 1457 },
+    { 143372, 9, 1458 },
+    { 143457, 9, 1459 },
+    { 143542, 9, 1460 },
+    { 143619, 9, 1461 },
+    { 143696, 9, 1462 },
+    { 143771, 9, 1463 },
+    { 143851, 9, 1464 },
+    { 143928, 9, 1465 },
+    { 144012, 9, 1466 },
+    { 144094, 9, 1467 },
+    { 144175, 9, 1468 },
+    { 144252, 9, 1469 },
+    { 144338, 9, 1470 },
+    { 144422, 9, 1471 },
+    { 144690, 9, 1440 },
+    { 144759, 9, 1441 },
+    { 144829, 9, 1442 },
+    { 144902, 9, 1443 },
+    { 144977, 9, 1444 },
+    { 145053, 9, 1445 },
+    { 145126, 9, 1446 },
+    { 145201, 9, 1447 },
+    { 145278, 9, 1448 },
+    { 145353, 9, 1449 },
+    { 145430, 9, 1450 },
+    { 145507, 9, 1451 },
+    { 145579, 9, 1452 },
+    { 145652, 9, 1453 },
+    { 145728, 9, 1454 },
+    { 145810, 9, 1455 },
+    { 146075, 9, 1584 },
+    { 146156, 9, 1585 },
+    { 146237, 9, 1586 },
+    { 146322, 9, 1587 },
+    { 146407, 9, 1588 },
+    { 146484, 9, 1589 },
+    { 146561, 9, 1590 },
+    { 146636, 9, 1591 },
+    { 146716, 9, 1592 },
+    { 146793, 9, 1593 },
+    { 146877, 9, 1594 },
+    { 146959, 9, 1595 },
+    { 147040, 9, 1596 },
+    { 147117, 9, 1597 },
+    { 147203, 9, 1598 },
+    { 147287, 9, 1599 },
+    { 147555, 9, 1568 },
+    { 147624, 9, 1569 },
+    { 147694, 9, 1570 },
+    { 147767, 9, 1571 },
+    { 147842, 9, 1572 },
+    { 147918, 9, 1573 },
+    { 147991, 9, 1574 },
+    { 148066, 9, 1575 },
+    { 148143, 9, 1576 },
+    { 148218, 9, 1577 },
+    { 148295, 9, 1578 },
+    { 148372, 9, 1579 },
+    { 148444, 9, 1580 },
+    { 148517, 9, 1581 },
+    { 148593, 9, 1582 },
+    { 148675, 9, 1583 },
+    { 148969, 2, ROM_SPAN_ROW },
+    { 149490, 2, ROM_SPAN_ROW },
+    { 149977, 9, 1472 },
+    { 150053, 9, 1473 },
+    { 150129, 9, 1474 },
+    { 150205, 9, 1475 },
+    { 150281, 9, 1476 },
+    { 150357, 9, 1477 },
+    { 150433, 9, 1478 },
+    { 150509, 9, 1479 },
+    { 150585, 9, 1480 },
+    { 150661, 9, 1481 },
+    { 150738, 9, 1482 },
+    { 150815, 9, 1483 },
+    { 150892, 9, 1484 },
+    { 150969, 9, 1485 },
+    { 151046, 9, 1486 },
+    { 151123, 9, 1487 },
+    { 151365, 9, 1488 },
+    { 151441, 9, 1489 },
+    { 151517, 9, 1490 },
+    { 151593, 9, 1491 },
+    { 151669, 9, 1492 },
+    { 151745, 9, 1493 },
+    { 151824, 9, 1494 },
+    { 151900, 9, 1495 },
+    { 151976, 9, 1496 },
+    { 152052, 9, 1497 },
+    { 152129, 9, 1498 },
+    { 152206, 9, 1499 },
+    { 152283, 9, 1500 },
+    { 152360, 9, 1501 },
+    { 152437, 9, 1502 },
+    { 152514, 9, 1503 },
+    { 152774, 9, 1600 },
+    { 152850, 9, 1601 },
+    { 152926, 9, 1602 },
+    { 153002, 9, 1603 },
+    { 153078, 9, 1604 },
+    { 153154, 9, 1605 },
+    { 153230, 9, 1606 },
+    { 153306, 9, 1607 },
+    { 153382, 9, 1608 },
+    { 153458, 9, 1609 },
+    { 153535, 9, 1610 },
+    { 153612, 9, 1611 },
+    { 153689, 9, 1612 },
+    { 153766, 9, 1613 },
+    { 153843, 9, 1614 },
+    { 153920, 9, 1615 },
+    { 154162, 9, 1616 },
+    { 154238, 9, 1617 },
+    { 154314, 9, 1618 },
+    { 154390, 9, 1619 },
+    { 154466, 9, 1620 },
+    { 154542, 9, 1621 },
+    { 154621, 9, 1622 },
+    { 154697, 9, 1623 },
+    { 154773, 9, 1624 },
+    { 154849, 9, 1625 },
+    { 154926, 9, 1626 },
+    { 155003, 9, 1627 },
+    { 155080, 9, 1628 },
+    { 155157, 9, 1629 },
+    { 155234, 9, 1630 },
+    { 155311, 9, 1631 },
+    { 155564, 9, 1504 },
+    { 155633, 9, 1505 },
+    { 155703, 9, 1506 },
+    { 155776, 9, 1507 },
+    { 155851, 9, 1508 },
+    { 155927, 9, 1509 },
+    { 156000, 9, 1510 },
+    { 156075, 9, 1511 },
+    { 156152, 9, 1512 },
+    { 156227, 9, 1513 },
+    { 156304, 9, 1514 },
+    { 156381, 9, 1515 },
+    { 156453, 9, 1516 },
+    { 156526, 9, 1517 },
+    { 156602, 9, 1518 },
+    { 156684, 9, 1519 },
+    { 156949, 9, 1520 },
+    { 157030, 9, 1521 },
+    { 157111, 9, 1522 },
+    { 157196, 9, 1523 },
+    { 157281, 9, 1524 },
+    { 157358, 9, 1525 },
+    { 157435, 9, 1526 },
+    { 157510, 9, 1527 },
+    { 157590, 9, 1528 },
+    { 157667, 9, 1529 },
+    { 157751, 9, 1530 },
+    { 157833, 9, 1531 },
+    { 157914, 9, 1532 },
+    { 157991, 9, 1533 },
+    { 158077, 9, 1534 },
+    { 158161, 9, 1535 },
+    { 158429, 9, 1632 },
+    { 158498, 9, 1633 },
+    { 158568, 9, 1634 },
+    { 158641, 9, 1635 },
+    { 158716, 9, 1636 },
+    { 158792, 9, 1637 },
+    { 158865, 9, 1638 },
+    { 158940, 9, 1639 },
+    { 159017, 9, 1640 },
+    { 159092, 9, 1641 },
+    { 159169, 9, 1642 },
+    { 159246, 9, 1643 },
+    { 159318, 9, 1644 },
+    { 159391, 9, 1645 },
+    { 159467, 9, 1646 },
+    { 159549, 9, 1647 },
+    { 159814, 9, 1648 },
+    { 159895, 9, 1649 },
+    { 159976, 9, 1650 },
+    { 160061, 9, 1651 },
+    { 160146, 9, 1652 },
+    { 160223, 9, 1653 },
+    { 160300, 9, 1654 },
+    { 160375, 9, 1655 },
+    { 160455, 9, 1656 },
+    { 160532, 9, 1657 },
+    { 160616, 9, 1658 },
+    { 160698, 9, 1659 },
+    { 160779, 9, 1660 },
+    { 160856, 9, 1661 },
+    { 160942, 9, 1662 },
+    { 161026, 9, 1663 },
+    { 161335, 2, ROM_SPAN_ROW },
+    { 161856, 2, ROM_SPAN_ROW },
+    { 162343, 9, 1792 },
+    { 162419, 9, 1793 },
+    { 162495, 9, 1794 },
+    { 162571, 9, 1795 },
+    { 162647, 9, 1796 },
+    { 162723, 9, 1797 },
+    { 162799, 9, 1798 },
+    { 162875, 9, 1799 },
+    { 162951, 9, 1800 },
+    { 163027, 9, 1801 },
+    { 163104, 9, 1802 },
+    { 163181, 9, 1803 },
+    { 163258, 9, 1804 },
+    { 163335, 9, 1805 },
+    { 163412, 9, 1806 },
+    { 163489, 9, 1807 },
+    { 163731, 9, 1808 },
+    { 163807, 9, 1809 },
+    { 163883, 9, 1810 },
+    { 163959, 9, 1811 },
+    { 164035, 9, 1812 },
+    { 164111, 9, 1813 },
+    { 164190, 9, 1814 },
+    { 164266, 9, 1815 },
+    { 164342, 9, 1816 },
+    { 164418, 9, 1817 },
+    { 164495, 9, 1818 },
+    { 164572, 9, 1819 },
+    { 164649, 9, 1820 },
+    { 164726, 9, 1821 },
+    { 164803, 9, 1822 },
+    { 164880, 9, 1823 },
+    { 165140, 9, 1680 },
+    { 165216, 9, 1681 },
+    { 165292, 9, 1682 },
+    { 165368, 9, 1683 },
+    { 165444, 9, 1684 },
+    { 165520, 9, 1685 },
+    { 165599, 9, 1686 },
+    { 165675, 9, 1687 },
+    { 165751, 9, 1688 },
+    { 165827, 9, 1689 },
+    { 165904, 9, 1690 },
+    { 165981, 9, 1691 },
+    { 166058, 9, 1692 },
+    { 166135, 9, 1693 },
+    { 166212, 9, 1694 },
+    { 166289, 9, 1695 },
+    { 166549, 9, 1664 },
+    { 166625, 9, 1665 },
+    { 166701, 9, 1666 },
+    { 166777, 9, 1667 },
+    { 166853, 9, 1668 },
+    { 166929, 9, 1669 },
+    { 167005, 9, 1670 },
+    { 167081, 9, 1671 },
+    { 167157, 9, 1672 },
+    { 167233, 9, 1673 },
+    { 167310, 9, 1674 },
+    { 167387, 9, 1675 },
+    { 167464, 9, 1676 },
+    { 167541, 9, 1677 },
+    { 167618, 9, 1678 },
+    { 167695, 9, 1679 },
+    { 167930, 9, 1824 },
+    { 167999, 9, 1825 },
+    { 168069, 9, 1826 },
+    { 168142, 9, 1827 },
+    { 168217, 9, 1828 },
+    { 168293, 9, 1829 },
+    { 168366, 9, 1830 },
+    { 168441, 9, 1831 },
+    { 168518, 9, 1832 },
+    { 168593, 9, 1833 },
+    { 168670, 9, 1834 },
+    { 168747, 9, 1835 },
+    { 168819, 9, 1836 },
+    { 168892, 9, 1837 },
+    { 168968, 9, 1838 },
+    { 169050, 9, 1839 },
+    { 169315, 9, 1840 },
+    { 169396, 9, 1841 },
+    { 169477, 9, 1842 },
+    { 169562, 9, 1843 },
+    { 169647, 9, 1844 },
+    { 169724, 9, 1845 },
+    { 169801, 9, 1846 },
+    { 169876, 9, 1847 },
+    { 169956, 9, 1848 },
+    { 170033, 9, 1849 },
+    { 170117, 9, 1850 },
+    { 170199, 9, 1851 },
+    { 170280, 9, 1852 },
+    { 170357, 9, 1853 },
+    { 170443, 9, 1854 },
+    { 170527, 9, 1855 },
+    { 170807, 9, 1712 },
+    { 170888, 9, 1713 },
+    { 170969, 9, 1714 },
+    { 171054, 9, 1715 },
+    { 171139, 9, 1716 },
+    { 171216, 9, 1717 },
+    { 171293, 9, 1718 },
+    { 171368, 9, 1719 },
+    { 171448, 9, 1720 },
+    { 171525, 9, 1721 },
+    { 171609, 9, 1722 },
+    { 171691, 9, 1723 },
+    { 171772, 9, 1724 },
+    { 171849, 9, 1725 },
+    { 171935, 9, 1726 },
+    { 172019, 9, 1727 },
+    { 172287, 9, 1696 },
+    { 172356, 9, 1697 },
+    { 172426, 9, 1698 },
+    { 172499, 9, 1699 },
+    { 172574, 9, 1700 },
+    { 172650, 9, 1701 },
+    { 172723, 9, 1702 },
+    { 172798, 9, 1703 },
+    { 172875, 9, 1704 },
+    { 172950, 9, 1705 },
+    { 173027, 9, 1706 },
+    { 173104, 9, 1707 },
+    { 173176, 9, 1708 },
+    { 173249, 9, 1709 },
+    { 173325, 9, 1710 },
+    { 173407, 9, 1711 },
+    { 173701, 2, ROM_SPAN_ROW },
+    { 174222, 2, ROM_SPAN_ROW },
+    { 174709, 9, 1872 },
+    { 174785, 9, 1873 },
+    { 174861, 9, 1874 },
+    { 174937, 9, 1875 },
+    { 175013, 9, 1876 },
+    { 175089, 9, 1877 },
+    { 175168, 9, 1878 },
+    { 175244, 9, 1879 },
+    { 175320, 9, 1880 },
+    { 175396, 9, 1881 },
+    { 175473, 9, 1882 },
+    { 175550, 9, 1883 },
+    { 175627, 9, 1884 },
+    { 175704, 9, 1885 },
+    { 175781, 9, 1886 },
+    { 175858, 9, 1887 },
+    { 176118, 9, 1856 },
+    { 176194, 9, 1857 },
+    { 176270, 9, 1858 },
+    { 176346, 9, 1859 },
+    { 176422, 9, 1860 },
+    { 176498, 9, 1861 },
+    { 176574, 9, 1862 },
+    { 176650, 9, 1863 },
+    { 176726, 9, 1864 },
+    { 176802, 9, 1865 },
+    { 176879, 9, 1866 },
+    { 176956, 9, 1867 },
+    { 177033, 9, 1868 },
+    { 177110, 9, 1869 },
+    { 177187, 9, 1870 },
+    { 177264, 9, 1871 },
+    { 177506, 9, 1728 },
+    { 177582, 9, 1729 },
+    { 177658, 9, 1730 },
+    { 177734, 9, 1731 },
+    { 177810, 9, 1732 },
+    { 177886, 9, 1733 },
+    { 177962, 9, 1734 },
+    { 178038, 9, 1735 },
+    { 178114, 9, 1736 },
+    { 178190, 9, 1737 },
+    { 178267, 9, 1738 },
+    { 178344, 9, 1739 },
+    { 178421, 9, 1740 },
+    { 178498, 9, 1741 },
+    { 178575, 9, 1742 },
+    { 178652, 9, 1743 },
+    { 178894, 9, 1744 },
+    { 178970, 9, 1745 },
+    { 179046, 9, 1746 },
+    { 179122, 9, 1747 },
+    { 179198, 9, 1748 },
+    { 179274, 9, 1749 },
+    { 179353, 9, 1750 },
+    { 179429, 9, 1751 },
+    { 179505, 9, 1752 },
+    { 179581, 9, 1753 },
+    { 179658, 9, 1754 },
+    { 179735, 9, 1755 },
+    { 179812, 9, 1756 },
+    { 179889, 9, 1757 },
+    { 179966, 9, 1758 },
+    { 180043, 9, 1759 },
+    { 180308, 9, 1904 },
+    { 180389, 9, 1905 },
+    { 180470, 9, 1906 },
+    { 180555, 9, 1907 },
+    { 180640, 9, 1908 },
+    { 180717, 9, 1909 },
+    { 180794, 9, 1910 },
+    { 180869, 9, 1911 },
+    { 180949, 9, 1912 },
+    { 181026, 9, 1913 },
+    { 181110, 9, 1914 },
+    { 181192, 9, 1915 },
+    { 181273, 9, 1916 },
+    { 181350, 9, 1917 },
+    { 181436, 9, 1918 },
+    { 181520, 9, 1919 },
+    { 181788, 9, 1888 },
+    { 181857, 9, 1889 },
+    { 181927, 9, 1890 },
+    { 182000, 9, 1891 },
+    { 182075, 9, 1892 },
+    { 182151, 9, 1893 },
+    { 182224, 9, 1894 },
+    { 182299, 9, 1895 },
+    { 182376, 9, 1896 },
+    { 182451, 9, 1897 },
+    { 182528, 9, 1898 },
+    { 182605, 9, 1899 },
+    { 182677, 9, 1900 },
+    { 182750, 9, 1901 },
+    { 182826, 9, 1902 },
+    { 182908, 9, 1903 },
+    { 183161, 9, 1760 },
+    { 183230, 9, 1761 },
+    { 183300, 9, 1762 },
+    { 183373, 9, 1763 },
+    { 183448, 9, 1764 },
+    { 183524, 9, 1765 },
+    { 183597, 9, 1766 },
+    { 183672, 9, 1767 },
+    { 183749, 9, 1768 },
+    { 183824, 9, 1769 },
+    { 183901, 9, 1770 },
+    { 183978, 9, 1771 },
+    { 184050, 9, 1772 },
+    { 184123, 9, 1773 },
+    { 184199, 9, 1774 },
+    { 184281, 9, 1775 },
+    { 184546, 9, 1776 },
+    { 184627, 9, 1777 },
+    { 184708, 9, 1778 },
+    { 184793, 9, 1779 },
+    { 184878, 9, 1780 },
+    { 184955, 9, 1781 },
+    { 185032, 9, 1782 },
+    { 185107, 9, 1783 },
+    { 185187, 9, 1784 },
+    { 185264, 9, 1785 },
+    { 185348, 9, 1786 },
+    { 185430, 9, 1787 },
+    { 185511, 9, 1788 },
+    { 185588, 9, 1789 },
+    { 185674, 9, 1790 },
+    { 185758, 9, 1791 },
+    { 186067, 2, ROM_SPAN_ROW },
+    { 186588, 2, ROM_SPAN_ROW },
+    { 187075, 9, 1920 },
+    { 187151, 9, 1921 },
+    { 187227, 9, 1922 },
+    { 187303, 9, 1923 },
+    { 187379, 9, 1924 },
+    { 187455, 9, 1925 },
+    { 187531, 9, 1926 },
+    { 187607, 9, 1927 },
+    { 187683, 9, 1928 },
+    { 187759, 9, 1929 },
+    { 187836, 9, 1930 },
+    { 187913, 9, 1931 },
+    { 187990, 9, 1932 },
+    { 188067, 9, 1933 },
+    { 188144, 9, 1934 },
+    { 188221, 9, 1935 },
+    { 188463, 9, 1936 },
+    { 188539, 9, 1937 },
+    { 188615, 9, 1938 },
+    { 188691, 9, 1939 },
+    { 188767, 9, 1940 },
+    { 188843, 9, 1941 },
+    { 188922, 9, 1942 },
+    { 188998, 9, 1943 },
+    { 189074, 9, 1944 },
+    { 189150, 9, 1945 },
+    { 189227, 9, 1946 },
+    { 189304, 9, 1947 },
+    { 189381, 9, 1948 },
+    { 189458, 9, 1949 },
+    { 189535, 9, 1950 },
+    { 189612, 9, 1951 },
+    { 189865, 9, 1952 },
+    { 189934, 9, 1953 },
+    { 190004, 9, 1954 },
+    { 190077, 9, 1955 },
+    { 190152, 9, 1956 },
+    { 190228, 9, 1957 },
+    { 190301, 9, 1958 },
+    { 190376, 9, 1959 },
+    { 190453, 9, 1960 },
+    { 190528, 9, 1961 },
+    { 190605, 9, 1962 },
+    { 190682, 9, 1963 },
+    { 190754, 9, 1964 },
+    { 190827, 9, 1965 },
+    { 190903, 9, 1966 },
+    { 190985, 9, 1967 },
+    { 191250, 9, 1968 },
+    { 191331, 9, 1969 },
+    { 191412, 9, 1970 },
+    { 191497, 9, 1971 },
+    { 191582, 9, 1972 },
+    { 191659, 9, 1973 },
+    { 191736, 9, 1974 },
+    { 191811, 9, 1975 },
+    { 191891, 9, 1976 },
+    { 191968, 9, 1977 },
+    { 192052, 9, 1978 },
+    { 192134, 9, 1979 },
+    { 192215, 9, 1980 },
+    { 192292, 9, 1981 },
+    { 192378, 9, 1982 },
+    { 192462, 9, 1983 },
+    { 192771, 2, ROM_SPAN_ROW },
+    { 193192, 9, 2000 },
+    { 193268, 9, 2001 },
+    { 193344, 9, 2002 },
+    { 193420, 9, 2003 },
+    { 193496, 9, 2004 },
+    { 193572, 9, 2005 },
+    { 193651, 9, 2006 },
+    { 193727, 9, 2007 },
+    { 193803, 9, 2008 },
+    { 193879, 9, 2009 },
+    { 193956, 9, 2010 },
+    { 194033, 9, 2011 },
+    { 194110, 9, 2012 },
+    { 194187, 9, 2013 },
+    { 194264, 9, 2014 },
+    { 194341, 9, 2015 },
+    { 194601, 9, 1984 },
+    { 194677, 9, 1985 },
+    { 194753, 9, 1986 },
+    { 194829, 9, 1987 },
+    { 194905, 9, 1988 },
+    { 194981, 9, 1989 },
+    { 195057, 9, 1990 },
+    { 195133, 9, 1991 },
+    { 195209, 9, 1992 },
+    { 195285, 9, 1993 },
+    { 195362, 9, 1994 },
+    { 195439, 9, 1995 },
+    { 195516, 9, 1996 },
+    { 195593, 9, 1997 },
+    { 195670, 9, 1998 },
+    { 195747, 9, 1999 },
+    { 195994, 9, 2032 },
+    { 196075, 9, 2033 },
+    { 196156, 9, 2034 },
+    { 196241, 9, 2035 },
+    { 196326, 9, 2036 },
+    { 196403, 9, 2037 },
+    { 196480, 9, 2038 },
+    { 196555, 9, 2039 },
+    { 196635, 9, 2040 },
+    { 196712, 9, 2041 },
+    { 196796, 9, 2042 },
+    { 196878, 9, 2043 },
+    { 196959, 9, 2044 },
+    { 197036, 9, 2045 },
+    { 197122, 9, 2046 },
+    { 197206, 9, 2047 },
+    { 197474, 9, 2016 },
+    { 197543, 9, 2017 },
+    { 197613, 9, 2018 },
+    { 197686, 9, 2019 },
+    { 197761, 9, 2020 },
+    { 197837, 9, 2021 },
+    { 197910, 9, 2022 },
+    { 197985, 9, 2023 },
+    { 198062, 9, 2024 },
+    { 198137, 9, 2025 },
+    { 198214, 9, 2026 },
+    { 198291, 9, 2027 },
+    { 198363, 9, 2028 },
+    { 198436, 9, 2029 },
+    { 198512, 9, 2030 },
+    { 198594, 9, 2031 },
+    { 198888, 2, ROM_SPAN_ROW },
+    { 199169, 12, ROM_SPAN_NAME },
+};
+
+const rom_template_t rom_templates[] = {
+    {
+        .name = "rom_12",
+        .capacity = 4096,
+        .combinators = 320,
+        .placeholder_base = 0xFF000000,
+        .placeholder_name = "64-value ROM",
+        .placeholder_desc = "64-value ROM with decimal(0xFF000000 + i) as a placeholder value for the ith word. 4096 words. For programming with outside tools.",
+        .json = rom_12_json,
+        .json_len = 395687,
+        .len_spans = 4162,
+        .spans = rom_12_spans,
+    },
+    {
+        .name = "rom_11",
+        .capacity = 2048,
+        .combinators = 163,
+        .placeholder_base = 0xFF000000,
+        .placeholder_name = "64-value ROM",
+        .placeholder_desc = "64-value ROM with decimal(0xFF000000 + i) as a placeholder value for the ith word.\\\\n\\\\nFor programming with outside tools.",
+        .json = rom_11_json,
+        .json_len = 199210,
+        .len_spans = 2082,
+        .spans = rom_11_spans,
+    },
+};
+const int len_rom_templates = 2;
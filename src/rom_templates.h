@@ -0,0 +1,42 @@
+#ifndef ROM_TEMPLATES_H
+#define ROM_TEMPLATES_H
+
+#include <stdint.h>
+
+// Kinds of placeholder texts in rom_span_t, word placeholders have their index instead
+#define ROM_SPAN_NAME   -1
+#define ROM_SPAN_DESC   -2
+#define ROM_SPAN_ROW    -3      // decider constant selecting a row of ROM_ROW_WORDS words
+
+// Words answered by each decider combinator of a ROM, the row of an address is
+// address / ROM_ROW_WORDS
+#define ROM_ROW_WORDS   64
+
+// Placeholder in the JSON of a template
+typedef struct {
+    int32_t offset;
+    int32_t len;
+    int32_t index;          // word index or ROM_SPAN_*
+} rom_span_t;
+
+// ROM template blueprint, generated by src/python/template-registry.py from the JSON in
+// src/templates into rom_templates.c
+typedef struct {
+    const char *name;                   // file name of the JSON, for fcc -T
+    int32_t capacity;                   // words
+    int32_t combinators;                // the size of the ROM
+    uint32_t placeholder_base;          // the placeholder of word i is placeholder_base + i
+    const char *placeholder_name;       // label, as written in the JSON
+    const char *placeholder_desc;       // description, which starts with the label
+    const char *json;                   // decoded blueprint
+    int32_t json_len;
+    int32_t len_spans;
+    const rom_span_t *spans;            // every placeholder in order, so they are replaced
+                                        // without searching the JSON
+} rom_template_t;
+
+// Every template, largest first
+extern const rom_template_t rom_templates[];
+extern const int len_rom_templates;
+
+#endif // ROM_TEMPLATES_H